@@ -870,6 +870,195 @@ Tensor mm_batching_rule(const Tensor& self, const Tensor& other) {
   TORCH_INTERNAL_ASSERT(false, "either self or other must be a BatchedTensor");
 }
 
+// Note [Batching rules for convolution]
+// `convolution` is what conv{1,2,3}d and the transposed variants decompose
+// into, so one batching rule covers the whole family. Three reshape tricks
+// cover every combination of batched arguments without the per-example
+// for-loop fallback:
+// - batched input only: fold the vmap dims into the example batch dim N.
+// - batched weight only: fold the vmap dims into the output channels. The
+//   fold has to happen per group so that each group block keeps all of its
+//   per-example slices together.
+// - batched input and weight: fold the vmap dims into the channel dims and
+//   multiply `groups`, so every example becomes its own channel group.
+// A batched bias is peeled off up front and added back with a regular
+// (already batched-aware) add.
+Tensor convolution_batching_rule(
+    const Tensor& input,
+    const Tensor& weight,
+    const c10::optional<Tensor>& bias_opt,
+    IntArrayRef stride,
+    IntArrayRef padding,
+    IntArrayRef dilation,
+    bool transposed,
+    IntArrayRef output_padding,
+    int64_t groups) {
+  auto input_batched = isBatchedTensor(input);
+  auto weight_batched = isBatchedTensor(weight);
+  const bool has_bias = bias_opt.has_value() && bias_opt->defined();
+  const bool bias_batched = has_bias && isBatchedTensor(*bias_opt);
+
+  // Per-example inputs may be unbatched (conv2d also accepts (C, H, W));
+  // insert a singleton example dim so the tricks below always see one.
+  if (/*logical*/input.dim() == /*logical*/weight.dim() - 1) {
+    auto result = at::convolution(
+        input.unsqueeze(0), weight, bias_opt, stride, padding, dilation,
+        transposed, output_padding, groups);
+    return result.squeeze(0);
+  }
+
+  // Peel off the bias if it is batched, or if the weight is (in which case
+  // the folded output channels no longer line up with it). A broadcasted
+  // add handles either case.
+  if (has_bias && (bias_batched || weight_batched)) {
+    auto result = at::convolution(
+        input, weight, c10::nullopt, stride, padding, dilation, transposed,
+        output_padding, groups);
+    auto bias_view = *bias_opt;
+    for (int64_t i = 0; i < /*logical*/result.dim() - 2; i++) {
+      bias_view = bias_view.unsqueeze(-1);
+    }
+    return result + bias_view;
+  }
+
+  if (input_batched && !weight_batched) {
+    auto input_physical = MultiBatchVmapTransform::logicalToPhysical(input);
+    // (B..., N, C, *) -> (B*N, C, *)
+    auto input_flat = input_physical.tensor().flatten(
+        0, input_physical.numBatchDims());
+    auto result = at::convolution(
+        input_flat, weight, bias_opt, stride, padding, dilation, transposed,
+        output_padding, groups);
+    // (B*N, Oc, *) -> (B..., N, Oc, *)
+    VmapDimVector logical_result_shape(
+        result.sizes().begin(), result.sizes().end());
+    logical_result_shape[0] = input.size(0);
+    return input_physical.getPhysicalToLogicalMap().apply(
+        result.reshape(input_physical.getPhysicalShape(logical_result_shape)));
+  }
+
+  if (!input_batched && weight_batched) {
+    auto weight_physical = MultiBatchVmapTransform::logicalToPhysical(weight);
+    auto weight_flat = weight_physical.tensor().flatten(
+        0, weight_physical.numBatchDims() - 1);
+    const auto batch_size = weight_flat.size(0);
+    const auto per_example_out_channels =
+        transposed ? weight_flat.size(2) * groups : weight_flat.size(1);
+    Tensor weight_grouped;
+    if (!transposed) {
+      // (B, Oc, Ic/g, *) -> (g, B, Oc/g, Ic/g, *) -> (B*Oc, Ic/g, *), so
+      // each group block holds all per-example slices for that group.
+      weight_grouped = weight_flat
+          .unflatten(1, {groups, weight_flat.size(1) / groups})
+          .movedim(1, 0)
+          .flatten(0, 2);
+    } else {
+      // Transposed weights are (B, Ic, Oc/g, *); fold the vmap dim into
+      // the per-group output channels instead: -> (Ic, B*Oc/g, *).
+      weight_grouped = weight_flat.movedim(0, 1).flatten(1, 2);
+    }
+    auto result = at::convolution(
+        input, weight_grouped, c10::nullopt, stride, padding, dilation,
+        transposed, output_padding, groups);
+    // Output channels come out ordered (g, B, Oc/g); restore (B, Oc) and
+    // move the vmap dim to the front.
+    result = result
+        .unflatten(1, {groups, batch_size, per_example_out_channels / groups})
+        .movedim(2, 1)
+        .flatten(2, 3)
+        .movedim(1, 0);
+    VmapDimVector logical_result_shape(
+        result.sizes().begin() + 1, result.sizes().end());
+    return weight_physical.getPhysicalToLogicalMap().apply(
+        result.reshape(weight_physical.getPhysicalShape(logical_result_shape)));
+  }
+
+  TORCH_INTERNAL_ASSERT(
+      input_batched && weight_batched,
+      "either input or weight must be a BatchedTensor");
+  auto physical_args = MultiBatchVmapTransform::logicalToPhysical({input, weight});
+  auto num_batch_dims = physical_args[0].numBatchDims();
+  auto input_flat = physical_args[0].tensor().flatten(0, num_batch_dims - 1);
+  auto weight_flat = physical_args[1].tensor().flatten(0, num_batch_dims - 1);
+  const auto batch_size = input_flat.size(0);
+  // Fold the vmap dim into the channels and give every example its own set
+  // of groups: (B, N, C, *) -> (N, B*C, *) and (B, W0, W1, *) -> (B*W0, W1, *).
+  auto input_grouped = input_flat.movedim(0, 1).flatten(1, 2);
+  auto weight_grouped = weight_flat.flatten(0, 1);
+  auto result = at::convolution(
+      input_grouped, weight_grouped, c10::nullopt, stride, padding, dilation,
+      transposed, output_padding, groups * batch_size);
+  // (N, B*Oc, *) -> (B, N, Oc, *)
+  result = result
+      .unflatten(1, {batch_size, result.size(1) / batch_size})
+      .movedim(1, 0);
+  VmapDimVector logical_result_shape(
+      result.sizes().begin() + 1, result.sizes().end());
+  return physical_args[0].getPhysicalToLogicalMap().apply(
+      result.reshape(physical_args[0].getPhysicalShape(logical_result_shape)));
+}
+
+// Group normalization treats examples independently, so extra vmap dims can
+// be folded straight into the example batch dim. Batched affine parameters
+// are peeled off and applied with ordinary pointwise ops, which already
+// know how to broadcast batched operands.
+std::tuple<Tensor, Tensor, Tensor> native_group_norm_batching_rule(
+    const Tensor& input,
+    const c10::optional<Tensor>& weight_opt,
+    const c10::optional<Tensor>& bias_opt,
+    int64_t N,
+    int64_t C,
+    int64_t HxW,
+    int64_t group,
+    double eps) {
+  const bool has_weight = weight_opt.has_value() && weight_opt->defined();
+  const bool has_bias = bias_opt.has_value() && bias_opt->defined();
+  const bool weight_batched = has_weight && isBatchedTensor(*weight_opt);
+  const bool bias_batched = has_bias && isBatchedTensor(*bias_opt);
+
+  if (weight_batched || bias_batched) {
+    // Normalize without the affine parameters, then apply them separately.
+    auto result = at::native_group_norm(
+        input, c10::nullopt, c10::nullopt, N, C, HxW, group, eps);
+    auto out = std::get<0>(result);
+    const auto num_spatial_dims = /*logical*/input.dim() - 2;
+    if (has_weight) {
+      auto weight_view = *weight_opt;
+      for (int64_t i = 0; i < num_spatial_dims; i++) {
+        weight_view = weight_view.unsqueeze(-1);
+      }
+      out = out * weight_view;
+    }
+    if (has_bias) {
+      auto bias_view = *bias_opt;
+      for (int64_t i = 0; i < num_spatial_dims; i++) {
+        bias_view = bias_view.unsqueeze(-1);
+      }
+      out = out + bias_view;
+    }
+    return std::make_tuple(out, std::get<1>(result), std::get<2>(result));
+  }
+
+  TORCH_INTERNAL_ASSERT(
+      isBatchedTensor(input), "input must be a BatchedTensor");
+  auto input_physical = MultiBatchVmapTransform::logicalToPhysical(input);
+  // (B..., N, C, *) -> (B*N, C, *); the kernel normalizes each example of
+  // the flattened batch independently.
+  auto input_flat =
+      input_physical.tensor().flatten(0, input_physical.numBatchDims());
+  auto result = at::native_group_norm(
+      input_flat.contiguous(), weight_opt, bias_opt, input_flat.size(0), C,
+      HxW, group, eps);
+  auto map = input_physical.getPhysicalToLogicalMap();
+  return std::make_tuple(
+      map.apply(std::get<0>(result).reshape(
+          input_physical.getPhysicalShape(input.sizes()))),
+      map.apply(std::get<1>(result).reshape(
+          input_physical.getPhysicalShape({N, group}))),
+      map.apply(std::get<2>(result).reshape(
+          input_physical.getPhysicalShape({N, group}))));
+}
+
 Tensor cat_batching_rule(TensorList tensors, int64_t dim) {
   auto physical_views = MultiBatchVmapTransform::logicalToPhysical(tensors);
   auto physical_tensors = fmap(
@@ -1196,6 +1385,10 @@ TORCH_LIBRARY_IMPL(aten, Batched, m) {
   m.impl("bmm", bmm_batching_rule);
   m.impl("mm", mm_batching_rule);
 
+  // convolution and normalization
+  m.impl("convolution", convolution_batching_rule);
+  m.impl("native_group_norm", native_group_norm_batching_rule);
+
   // cat/stack
   m.impl("cat", cat_batching_rule);
   m.impl("stack", stack_batching_rule);
@@ -12,6 +12,10 @@
 #include <thread>
 
 #include <ATen/Tensor.h>
+
+#if AT_MKLDNN_ENABLED()
+#include <ATen/native/mkldnn/MKLDNNCommon.h>
+#endif
 #include <ATen/cpu/FlushDenormal.h>
 
 #ifdef USE_FBGEMM
@@ -50,6 +54,25 @@ void Context::setUserEnabledMkldnn(bool e) {
   enabled_mkldnn = e;
 }
 
+int Context::mkldnnPrimitiveCacheCapacity() const {
+#if AT_MKLDNN_ENABLED()
+  return at::native::mkldnn_get_primitive_cache_capacity();
+#else
+  return 0;
+#endif
+}
+
+void Context::setMkldnnPrimitiveCacheCapacity(int capacity) {
+#if AT_MKLDNN_ENABLED()
+  TORCH_CHECK(capacity >= 0,
+      "mkldnn primitive cache capacity must be non-negative, got ", capacity);
+  at::native::mkldnn_set_primitive_cache_capacity(capacity);
+#else
+  TORCH_CHECK(false,
+      "Cannot set MKL-DNN primitive cache capacity: PyTorch was compiled without MKL-DNN support");
+#endif
+}
+
 bool Context::deterministicCuDNN() const {
   return deterministic_cudnn;
 }
@@ -147,6 +170,14 @@ void Context::setAllowTF32CuBLAS(bool b) {
   allow_tf32_cublas = b;
 }
 
+bool Context::allowBF16MatmulCPU() const {
+  return allow_bf16_matmul_cpu;
+}
+
+void Context::setAllowBF16MatmulCPU(bool b) {
+  allow_bf16_matmul_cpu = b;
+}
+
 bool Context::hasMKL() {
 #if AT_MKL_ENABLED()
   return true;
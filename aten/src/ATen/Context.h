@@ -117,6 +117,11 @@ class TORCH_API Context {
   void setUserEnabledCuDNN(bool e);
   bool userEnabledMkldnn() const;
   void setUserEnabledMkldnn(bool e);
+  // Capacity of the oneDNN primitive cache, which memoizes compiled
+  // primitives keyed on their full descriptor (op, shapes, strides,
+  // attributes). Setting it requires a build with MKL-DNN support.
+  int mkldnnPrimitiveCacheCapacity() const;
+  void setMkldnnPrimitiveCacheCapacity(int capacity);
   bool benchmarkCuDNN() const;
   void setBenchmarkCuDNN(bool);
   bool deterministicCuDNN() const;
@@ -202,6 +207,11 @@ class TORCH_API Context {
   void setAllowTF32CuDNN(bool);
   bool allowTF32CuBLAS() const;
   void setAllowTF32CuBLAS(bool);
+  // CPU analogue of allowTF32CuBLAS: when enabled, float32 GEMMs may be
+  // computed with bfloat16 tiles and float32 accumulation. See
+  // Note [BF16 reduced precision CPU matmul] in native/mkldnn/Matmul.cpp.
+  bool allowBF16MatmulCPU() const;
+  void setAllowBF16MatmulCPU(bool);
   at::QEngine qEngine() const;
   void setQEngine(at::QEngine e);
   static const std::vector<at::QEngine>& supportedQEngines() ;
@@ -239,6 +249,7 @@ class TORCH_API Context {
   bool benchmark_cudnn = false;
   bool allow_tf32_cudnn = true;
   bool allow_tf32_cublas = true;
+  bool allow_bf16_matmul_cpu = false;
   bool enabled_mkldnn = true;
   #ifdef C10_MOBILE
   bool release_original_weights = true;
@@ -79,6 +79,14 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
   if ((flags ^ ALLOCATOR_MAPPED_EXCLUSIVE) == 0) {
     TORCH_INTERNAL_ASSERT(false, "ALLOCATOR_MAPPED_EXCLUSIVE flag requires opening the file in shared mode");
   }
+  if (flags & ALLOCATOR_MAPPED_READONLY) {
+    TORCH_CHECK(
+        (flags & ALLOCATOR_MAPPED_SHARED) && !(flags & ALLOCATOR_MAPPED_SHAREDMEM),
+        "ALLOCATOR_MAPPED_READONLY requires ALLOCATOR_MAPPED_SHARED");
+#ifdef _WIN32
+    TORCH_CHECK(false, "ALLOCATOR_MAPPED_READONLY is unsupported on Windows");
+#endif
+  }
 #ifdef _WIN32
   if (fd != -1) {
     TORCH_INTERNAL_ASSERT(false, "MapAllocator_newWithFd is unsupported on Windows");
@@ -239,7 +247,9 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
     struct stat file_stat;
 
-    if (flags_ & (ALLOCATOR_MAPPED_SHARED | ALLOCATOR_MAPPED_SHAREDMEM)) {
+    if (flags_ & ALLOCATOR_MAPPED_READONLY) {
+      flags = O_RDONLY;
+    } else if (flags_ & (ALLOCATOR_MAPPED_SHARED | ALLOCATOR_MAPPED_SHAREDMEM)) {
       flags = O_RDWR | O_CREAT;
     } else {
       flags = O_RDONLY;
@@ -255,7 +265,8 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
     if (!(flags_ & ALLOCATOR_MAPPED_FROMFD)) {
       if (flags_ & ALLOCATOR_MAPPED_SHARED) {
         if ((fd = open(filename_.c_str(), flags, (mode_t)0600)) == -1) {
-          TORCH_INTERNAL_ASSERT(false, "unable to open file <", filename_, "> in read-write mode");
+          TORCH_INTERNAL_ASSERT(false, "unable to open file <", filename_, "> in ",
+              (flags_ & ALLOCATOR_MAPPED_READONLY) ? "read-only" : "read-write", " mode");
         }
       } else if (flags_ & ALLOCATOR_MAPPED_SHAREDMEM) {
 #ifdef HAVE_SHM_OPEN
@@ -283,7 +294,7 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
 
     if (size > 0) {
       if (static_cast<int64_t>(size) > file_stat.st_size) {
-        if (flags_) {
+        if (flags_ && !(flags_ & ALLOCATOR_MAPPED_READONLY)) {
           if (ftruncate(fd, size) == -1) {
             TORCH_INTERNAL_ASSERT(false, "unable to resize file <", filename_, "> to the right size");
           }
@@ -312,10 +323,13 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
     size_ = size; /* if we are here, it must be the right size */
 
     /* map it */
+    const int prot = (flags_ & ALLOCATOR_MAPPED_READONLY)
+        ? PROT_READ
+        : (PROT_READ | PROT_WRITE);
     if (flags_ & (ALLOCATOR_MAPPED_SHARED | ALLOCATOR_MAPPED_SHAREDMEM)) {
-      base_ptr_ = mmap(nullptr, size_, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+      base_ptr_ = mmap(nullptr, size_, prot, MAP_SHARED, fd, 0);
     } else {
-      base_ptr_ = mmap(nullptr, size_, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+      base_ptr_ = mmap(nullptr, size_, prot, MAP_PRIVATE, fd, 0);
     }
 
     if (base_ptr_ == MAP_FAILED) {
@@ -323,6 +337,17 @@ MapAllocator::MapAllocator(WithFd, std::string filename, int fd, int flags, size
       TORCH_INTERNAL_ASSERT(false, "unable to mmap ", size_, " bytes from file <", filename_, ">: ", strerror(errno), " (", errno, ")");
     }
 
+#ifdef MADV_HUGEPAGE
+    /* Large mappings (e.g. shared embedding tables read with data-dependent
+     * access patterns) are TLB-bound with 4K pages; ask the kernel to back
+     * them with transparent huge pages. This is only a hint, so the return
+     * value is deliberately ignored. */
+    constexpr size_t kHugePageAdviseThreshold = static_cast<size_t>(1) << 25; /* 32 MiB */
+    if (size_ >= kHugePageAdviseThreshold) {
+      madvise(base_ptr_, size_, MADV_HUGEPAGE);
+    }
+#endif
+
     if (flags_ & ALLOCATOR_MAPPED_KEEPFD) {
       fd_ = fd;
     } else {
@@ -445,6 +470,10 @@ RefcountedMapAllocatorArgCheck::RefcountedMapAllocatorArgCheck(int flags) {
   if (flags & ALLOCATOR_MAPPED_UNLINK) {
     TORCH_INTERNAL_ASSERT(false, "RefcountedMapAllocator doesn't support ALLOCATOR_MAPPED_UNLINK flag");
   }
+  if (flags & ALLOCATOR_MAPPED_READONLY) {
+    // The refcount header at the front of the mapping must be writable
+    TORCH_INTERNAL_ASSERT(false, "RefcountedMapAllocator doesn't support ALLOCATOR_MAPPED_READONLY flag");
+  }
   if (!(flags & ALLOCATOR_MAPPED_SHAREDMEM)) {
     TORCH_INTERNAL_ASSERT(false, "RefcountedMapAllocator requires ALLOCATOR_MAPPED_SHAREDMEM flag");
   }
@@ -553,6 +582,67 @@ void RefcountedMapAllocator::close() {}
 
 #endif
 
+void MapAllocator::advise(MappedAdvice advice, ptrdiff_t offset, ptrdiff_t length) const {
+#if defined(HAVE_MMAP) && !defined(_WIN32)
+  if (base_ptr_ == nullptr || size_ == 0) {
+    return;
+  }
+  char* region = static_cast<char*>(data());
+  const ptrdiff_t available = size_ - (region - static_cast<char*>(base_ptr_));
+  TORCH_CHECK(offset >= 0 && offset <= available,
+      "advise: offset ", offset, " out of range [0, ", available, "]");
+  if (length < 0) {
+    length = available - offset;
+  }
+  TORCH_CHECK(length <= available - offset,
+      "advise: range [", offset, ", ", offset + length,
+      ") extends past the end of the mapping (", available, " bytes)");
+  if (length == 0) {
+    return;
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int native_advice;
+  switch (advice) {
+    case ALLOCATOR_ADVICE_NORMAL:
+      native_advice = MADV_NORMAL;
+      break;
+    case ALLOCATOR_ADVICE_SEQUENTIAL:
+      native_advice = MADV_SEQUENTIAL;
+      break;
+    case ALLOCATOR_ADVICE_RANDOM:
+      native_advice = MADV_RANDOM;
+      break;
+    case ALLOCATOR_ADVICE_WILLNEED:
+      native_advice = MADV_WILLNEED;
+      break;
+    case ALLOCATOR_ADVICE_DONTNEED:
+      // On a shared file-backed mapping DONTNEED merely drops cached pages,
+      // which are re-faulted from the file; on a private mapping it would
+      // irrevocably destroy any dirtied pages.
+      TORCH_CHECK(flags_ & (ALLOCATOR_MAPPED_SHARED | ALLOCATOR_MAPPED_SHAREDMEM),
+          "advise: dontneed is only supported on shared file-backed mappings");
+      native_advice = MADV_DONTNEED;
+      break;
+    default:
+      TORCH_INTERNAL_ASSERT(false, "advise: unknown advice ", static_cast<int>(advice));
+  }
+
+  // madvise requires a page-aligned address, so extend the range down to the
+  // enclosing page boundary. Like the MADV_HUGEPAGE hint in the constructor,
+  // this is advisory only and the return value is deliberately ignored.
+  const auto addr = reinterpret_cast<uintptr_t>(region + offset);
+  const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto aligned_addr = addr & ~(page_size - 1);
+  madvise(reinterpret_cast<void*>(aligned_addr),
+          static_cast<size_t>(length) + (addr - aligned_addr), native_advice);
+#else
+  (void)advice;
+  (void)offset;
+  (void)length;
+#endif
+}
+
 static void deleteMapAllocator(void* ptr) {
   delete static_cast<MapAllocator*>(ptr);
 }
@@ -11,7 +11,21 @@ enum MappedAllocatorModes {
   ALLOCATOR_MAPPED_NOCREATE = 8,
   ALLOCATOR_MAPPED_KEEPFD = 16,
   ALLOCATOR_MAPPED_FROMFD = 32,
-  ALLOCATOR_MAPPED_UNLINK = 64
+  ALLOCATOR_MAPPED_UNLINK = 64,
+  // Map the file PROT_READ only (requires ALLOCATOR_MAPPED_SHARED). Lets
+  // huge checkpoint files be served off disk without write access, and
+  // guarantees the mapping can never dirty the file. Writing through a
+  // tensor backed by such a mapping faults.
+  ALLOCATOR_MAPPED_READONLY = 128
+};
+
+// Paging hints for mapped regions; see MapAllocator::advise.
+enum MappedAdvice {
+  ALLOCATOR_ADVICE_NORMAL = 0,
+  ALLOCATOR_ADVICE_SEQUENTIAL = 1,
+  ALLOCATOR_ADVICE_RANDOM = 2,
+  ALLOCATOR_ADVICE_WILLNEED = 3,
+  ALLOCATOR_ADVICE_DONTNEED = 4
 };
 
 // Sentinel value/type to help distinguish the file descriptor constructor from
@@ -47,6 +61,16 @@ class TORCH_API MapAllocator {
   static at::DataPtr makeDataPtr(std::string filename, int flags, size_t size, size_t* actual_size_out);
   static at::DataPtr makeDataPtr(WithFd, const char *filename, int fd, int flags, size_t size, size_t* actual_size_out);
 
+  // Applies a paging hint to `length` bytes starting `offset` bytes into
+  // data() (length < 0 means "to the end of the mapping"). This lets
+  // cache-tier code manage residency of giant mapped tensors explicitly:
+  // WILLNEED prefetches a region, DONTNEED drops its clean pages back to
+  // the file. Hints are advisory, so failures are ignored; on platforms
+  // without madvise this is a no-op. DONTNEED is refused on private
+  // mappings, where it would destroy dirtied pages instead of dropping
+  // cached ones.
+  void advise(MappedAdvice advice, ptrdiff_t offset = 0, ptrdiff_t length = -1) const;
+
   // Closes the data.  Helps us avoid destructor shenanigans
   virtual void close();
 
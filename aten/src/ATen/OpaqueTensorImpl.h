@@ -32,7 +32,11 @@ struct TORCH_API OpaqueTensorImpl : public TensorImpl {
     set_has_contiguity_policy(HasContiguityPolicy::ContiguityNotSupported);
     sizes_and_strides_.set_sizes(sizes);
     refresh_numel();
-    is_non_overlapping_and_dense_ = is_non_overlapping_and_dense;
+    if (is_non_overlapping_and_dense) {
+      contiguity_flags_ |= kFlagNonOverlappingAndDense;
+    } else {
+      contiguity_flags_ &= static_cast<uint8_t>(~kFlagNonOverlappingAndDense);
+    }
   }
 
   void release_resources() override {
@@ -10,4 +10,13 @@ namespace at {
 TORCH_API c10::intrusive_ptr<c10::ivalue::Future> intraop_launch_future(
     std::function<void()> func);
 
+// Launches `func` on the inter-op thread pool and returns a future that
+// completes with its result (or carries its exception). The value-returning
+// counterpart of at::launch: expensive CPU ops can run as overlapping
+// pipeline stages - e.g. an embedding gather concurrently with a GEMM -
+// without spinning up threads of one's own. Forked TorchScript subgraphs
+// run on the same pool, so C++ and JIT async work interleave naturally.
+TORCH_API c10::intrusive_ptr<c10::ivalue::Future> launch_future(
+    std::function<c10::IValue()> func);
+
 }  // namespace at
@@ -5,13 +5,23 @@
 #include <ATen/PTThreadPool.h>
 
 #ifndef C10_MOBILE
+#include <c10/core/WorkStealingThreadPool.h>
 #include <c10/core/thread_pool.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+#include <c10/util/numa.h>
 #else
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #endif // C10_MOBILE
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -72,22 +82,270 @@ int _num_pool_threads(int nthreads) {
   return nthreads - 1;
 }
 
+// Explicit CPU binding for the intra-op pool, opt-in via
+// AT_INTRAOP_CPU_LIST=<cpu list> (e.g. "0-7,16-23"). Each pool thread is
+// pinned to one CPU from the list, assigned round-robin in creation order,
+// and the default pool size becomes the list length. This lets an
+// orchestrator co-locating several models on one host hand each process a
+// disjoint slice of a socket, so one model's intra-op threads stop
+// migrating onto cores whose cache holds another model's weights. The
+// calling thread is left unbound; its placement belongs to the
+// orchestrator. AT_PARALLEL_NUMA_AWARE takes precedence if both are set,
+// since _run_with_pool consults the NUMA sub-pools first.
+const std::vector<int>& _intraop_cpu_list() {
+  static std::vector<int> cpus = []() {
+    std::vector<int> result;
+    const char* flag = std::getenv("AT_INTRAOP_CPU_LIST");
+    if (flag == nullptr) {
+      return result;
+    }
+#if !defined(__linux__)
+    TORCH_WARN("AT_INTRAOP_CPU_LIST is only supported on Linux, ignoring");
+    return result;
+#else
+    const char* pos = flag;
+    while (*pos) {
+      char* end = nullptr;
+      long first = std::strtol(pos, &end, 10);
+      if (end == pos || first < 0) {
+        break;
+      }
+      long last = first;
+      pos = end;
+      if (*pos == '-') {
+        last = std::strtol(pos + 1, &end, 10);
+        if (end == pos + 1 || last < first) {
+          break;
+        }
+        pos = end;
+      }
+      for (long cpu = first; cpu <= last; ++cpu) {
+        result.push_back(static_cast<int>(cpu));
+      }
+      if (*pos != ',') {
+        break;
+      }
+      ++pos;
+    }
+    if (*pos != '\0') {
+      TORCH_WARN(
+          "Failed to parse AT_INTRAOP_CPU_LIST (\"", flag, "\"), ignoring");
+      result.clear();
+    }
+    return result;
+#endif // __linux__
+  }();
+  return cpus;
+}
+
+void _bind_to_cpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#else
+  (void)cpu;
+#endif
+}
+
+// Thread init function binding pool threads to the CPUs from
+// AT_INTRAOP_CPU_LIST; returns nullptr when the list is not set so the
+// pool keeps its default init.
+std::function<void()> _intraop_init_thread() {
+  const auto& cpus = _intraop_cpu_list();
+  if (cpus.empty()) {
+    return nullptr;
+  }
+  auto next_cpu = std::make_shared<std::atomic<size_t>>(0);
+  return [&cpus, next_cpu]() {
+    c10::setThreadName("PTThreadPool");
+    at::init_num_threads();
+    _bind_to_cpu(cpus[next_cpu->fetch_add(1) % cpus.size()]);
+  };
+}
+
 TaskThreadPoolBase& _get_intraop_pool() {
   static std::shared_ptr<TaskThreadPoolBase> pool =
-      ThreadPoolRegistry()->Create(
-          "C10",
-          /* device_id */ 0,
-          /* pool_size */ _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
-          /* create_new */ true); // create a separate thread pool for intra-op
+      []() -> std::shared_ptr<TaskThreadPoolBase> {
+    int nthreads = num_intraop_threads.exchange(CONSUMED);
+    if (nthreads == NOT_SET && !_intraop_cpu_list().empty()) {
+      // One thread per listed CPU, counting the master thread.
+      nthreads = static_cast<int>(_intraop_cpu_list().size());
+    }
+    const int pool_size = _num_pool_threads(nthreads);
+    auto init_thread = _intraop_init_thread();
+    // Work-stealing executor for fine-grained, irregular parallel
+    // sections; see c10::WorkStealingThreadPool.
+    const char* flag = std::getenv("AT_PARALLEL_WORK_STEALING");
+    if (flag != nullptr && flag[0] == '1') {
+      return std::make_shared<c10::WorkStealingThreadPool>(
+          pool_size, /* numa_node_id */ -1, std::move(init_thread));
+    }
+    if (init_thread) {
+      return std::make_shared<c10::ThreadPool>(
+          pool_size, /* numa_node_id */ -1, std::move(init_thread));
+    }
+    return ThreadPoolRegistry()->Create(
+        "C10",
+        /* device_id */ 0,
+        pool_size,
+        /* create_new */ true); // create a separate thread pool for intra-op
+  }();
   return *pool;
 }
 
+// NUMA-aware scheduling mode, opt-in via AT_PARALLEL_NUMA_AWARE=1.
+// Instead of one flat intra-op pool, a sub-pool is created per NUMA node
+// with its threads bound to that node, and task ids are mapped to nodes in
+// contiguous blocks: task i of an N-task parallel_for runs on node
+// i * num_nodes / N. The mapping is deterministic, so a buffer first
+// touched under this partitioning keeps being scanned by threads on the
+// socket that owns its pages (alloc_cpu already NUMAMove's fresh
+// allocations to the touching thread's node).
+bool _numa_aware_enabled() {
+  static bool enabled = []() {
+    const char* flag = std::getenv("AT_PARALLEL_NUMA_AWARE");
+    return flag != nullptr && flag[0] == '1' && c10::IsNUMAEnabled() &&
+        c10::GetNumNUMANodes() > 1;
+  }();
+  return enabled;
+}
+
+std::vector<std::shared_ptr<c10::TaskThreadPool>>& _get_numa_pools() {
+  static std::vector<std::shared_ptr<c10::TaskThreadPool>> pools = []() {
+    std::vector<std::shared_ptr<c10::TaskThreadPool>> result;
+    const int num_nodes = c10::GetNumNUMANodes();
+    // Split the configured intra-op threads evenly across nodes (at least
+    // one thread per node); the master thread participates on whichever
+    // node it happens to run on.
+    int nthreads = _num_pool_threads(num_intraop_threads.exchange(CONSUMED));
+    nthreads = std::max(nthreads, num_nodes);
+    for (const auto node : c10::irange(num_nodes)) {
+      result.push_back(std::make_shared<c10::TaskThreadPool>(
+          std::max(1, nthreads / num_nodes), node));
+    }
+    return result;
+  }();
+  return pools;
+}
+
+bool _in_numa_pool() {
+  for (const auto& pool : _get_numa_pools()) {
+    if (pool->inThreadPool()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Adaptive task-count selection, opt-in via AT_PARALLEL_ADAPTIVE=1.
+// The static heuristic in calc_num_tasks_and_chunk_size trusts the
+// per-kernel grain_size constants, which are hand-tuned guesses: small
+// sections can lose more time to thread wakeups than they save, while
+// large sections with a conservative grain underparallelize. When
+// enabled, each size class (log2 of the iteration count) hill-climbs its
+// task count online: most calls reuse the best known value, every
+// kProbePeriod-th call tries a neighboring value, and a probe whose
+// measured wall time beats the incumbent's smoothed time is adopted.
+// Kernel identity is not observable at this layer, so the size class is
+// the key; in practice kernels of similar per-iteration cost share a
+// sweet spot at a given size.
+struct AdaptiveSizeClass {
+  std::mutex mutex;
+  // 0 means "not measured yet": use the static heuristic.
+  int num_tasks{0};
+  // EWMA of section wall time (ns) when running with num_tasks.
+  double avg_time_ns{0.0};
+  int probe_offset{1};
+  uint64_t calls{0};
+};
+
+constexpr size_t kAdaptiveSizeClasses = 64;
+constexpr uint64_t kProbePeriod = 16;
+constexpr double kAdaptiveEwmaWeight = 0.25;
+// A probe has to win by this margin to displace the incumbent so that
+// run-to-run noise does not make the task count oscillate.
+constexpr double kAdaptiveHysteresis = 0.95;
+
+bool _adaptive_enabled() {
+  static bool enabled = []() {
+    const char* flag = std::getenv("AT_PARALLEL_ADAPTIVE");
+    return flag != nullptr && flag[0] == '1';
+  }();
+  return enabled;
+}
+
+AdaptiveSizeClass& _adaptive_size_class(int64_t range) {
+  static std::array<AdaptiveSizeClass, kAdaptiveSizeClasses> classes;
+  const auto bucket = std::min(
+      kAdaptiveSizeClasses - 1,
+      static_cast<size_t>(c10::llvm::Log2_64(static_cast<uint64_t>(range))));
+  return classes[bucket];
+}
+
+// Picks the task count for this call; every kProbePeriod-th call per size
+// class deviates from the incumbent to keep exploring.
+size_t _adaptive_choose_num_tasks(
+    AdaptiveSizeClass& size_class,
+    size_t heuristic_num_tasks,
+    size_t max_tasks,
+    bool& probing) {
+  std::lock_guard<std::mutex> lk(size_class.mutex);
+  size_class.calls++;
+  int chosen = size_class.num_tasks != 0
+      ? size_class.num_tasks
+      : static_cast<int>(heuristic_num_tasks);
+  if (size_class.calls % kProbePeriod == 0) {
+    probing = true;
+    chosen += size_class.probe_offset;
+  }
+  return std::min(max_tasks, static_cast<size_t>(std::max(1, chosen)));
+}
+
+void _adaptive_report_time(
+    AdaptiveSizeClass& size_class,
+    size_t num_tasks,
+    bool probing,
+    double elapsed_ns) {
+  std::lock_guard<std::mutex> lk(size_class.mutex);
+  if (size_class.num_tasks == 0) {
+    size_class.num_tasks = static_cast<int>(num_tasks);
+    size_class.avg_time_ns = elapsed_ns;
+    return;
+  }
+  if (static_cast<int>(num_tasks) == size_class.num_tasks) {
+    size_class.avg_time_ns = kAdaptiveEwmaWeight * elapsed_ns +
+        (1.0 - kAdaptiveEwmaWeight) * size_class.avg_time_ns;
+    return;
+  }
+  // A probe (or a call clamped to a different task count) finished.
+  if (elapsed_ns < size_class.avg_time_ns * kAdaptiveHysteresis) {
+    size_class.num_tasks = static_cast<int>(num_tasks);
+    size_class.avg_time_ns = elapsed_ns;
+  } else if (probing) {
+    // Losing probe: explore the other direction next time.
+    size_class.probe_offset = -size_class.probe_offset;
+  }
+}
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
 // `fn` will be called with params: (thread_pool_task_id, task_id).
 void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 #ifndef C10_MOBILE
+  if (_numa_aware_enabled()) {
+    auto& pools = _get_numa_pools();
+    const size_t num_nodes = pools.size();
+    for (const auto i : c10::irange(1, range)) {
+      const size_t node = i * num_nodes / range;
+      pools[node]->run([fn, i]() { fn((int)i, i); });
+    }
+    // Run the first task on the current thread directly.
+    fn(0, 0);
+    return;
+  }
   for (const auto i : c10::irange(1, range)) {
     _get_intraop_pool().run([fn, i]() { fn((int)i, i); });
   }
@@ -148,6 +406,24 @@ void invoke_parallel(
   std::tie(num_tasks, chunk_size) =
       internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
 
+#ifndef C10_MOBILE
+  AdaptiveSizeClass* size_class = nullptr;
+  bool probing = false;
+  std::chrono::steady_clock::time_point start_time;
+  if (_adaptive_enabled() && (end - begin) > 0 && (end - begin) >= grain_size) {
+    size_class = &_adaptive_size_class(end - begin);
+    // The learned task count may exceed what the grain size allows, but
+    // never the pool capacity or the iteration count.
+    const size_t max_tasks = std::min(
+        static_cast<size_t>(get_num_threads()),
+        static_cast<size_t>(end - begin));
+    num_tasks =
+        _adaptive_choose_num_tasks(*size_class, num_tasks, max_tasks, probing);
+    chunk_size = divup((end - begin), num_tasks);
+    start_time = std::chrono::steady_clock::now();
+  }
+#endif // C10_MOBILE
+
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   struct {
     std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
@@ -188,6 +464,16 @@ void invoke_parallel(
       state.cv.wait(lk);
     }
   }
+
+#ifndef C10_MOBILE
+  if (size_class) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+    _adaptive_report_time(
+        *size_class, num_tasks, probing, static_cast<double>(elapsed));
+  }
+#endif // C10_MOBILE
+
   if (state.eptr) {
     std::rethrow_exception(state.eptr);
   }
@@ -245,9 +531,20 @@ int get_num_threads() {
   if (nthreads > 0) {
     return nthreads;
   } else if (nthreads == NOT_SET) {
+    if (!_intraop_cpu_list().empty()) {
+      return static_cast<int>(_intraop_cpu_list().size());
+    }
     return intraop_default_num_threads();
   } else {
     TORCH_INTERNAL_ASSERT(nthreads == CONSUMED);
+    if (_numa_aware_enabled()) {
+      size_t pool_threads = 0;
+      for (const auto& pool : _get_numa_pools()) {
+        pool_threads += pool->size();
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
+      return pool_threads + 1;
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions,bugprone-narrowing-conversions)
     return _get_intraop_pool().size() + 1;
   }
@@ -267,7 +564,8 @@ bool in_parallel_region() {
   return in_parallel_region_ || (
     num_intraop_threads.load() == CONSUMED &&
     // Needed as intraop_launch() doesn't set in_parallel_region().
-    _get_intraop_pool().inThreadPool()
+    (_numa_aware_enabled() ? _in_numa_pool()
+                           : _get_intraop_pool().inThreadPool())
   );
 #else
   return in_parallel_region_;
@@ -277,7 +575,11 @@ bool in_parallel_region() {
 void intraop_launch(std::function<void()> func) {
 #ifndef C10_MOBILE
   if (!in_parallel_region() && get_num_threads() > 1) {
-    _get_intraop_pool().run(func);
+    if (_numa_aware_enabled()) {
+      _get_numa_pools()[0]->run(func);
+    } else {
+      _get_intraop_pool().run(func);
+    }
   } else {
     // execute inline if we're in parallel region
     func();
@@ -294,12 +596,15 @@ c10::intrusive_ptr<c10::ivalue::Future> intraop_launch_future(
 #ifndef C10_MOBILE
   auto future = c10::make_intrusive<c10::ivalue::Future>(c10::NoneType::get());
   if (!in_parallel_region() && get_num_threads() > 1) {
-    _get_intraop_pool().run(
-      [func, future]() {
-        func();
-        future->markCompleted();
-      }
-    );
+    auto task = [func, future]() {
+      func();
+      future->markCompleted();
+    };
+    if (_numa_aware_enabled()) {
+      _get_numa_pools()[0]->run(task);
+    } else {
+      _get_intraop_pool().run(task);
+    }
   } else {
     func();
     future->markCompleted();
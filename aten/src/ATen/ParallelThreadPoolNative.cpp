@@ -1,6 +1,7 @@
 #include <ATen/Config.h>
 #if AT_PARALLEL_OPENMP || AT_PARALLEL_NATIVE || AT_PARALLEL_NATIVE_TBB
 #include <ATen/Parallel.h>
+#include <ATen/ParallelFuture.h>
 #include <ATen/PTThreadPool.h>
 #include <ATen/ThreadLocalState.h>
 
@@ -92,5 +93,18 @@ void launch(std::function<void()> func) {
   ));
 }
 
+c10::intrusive_ptr<c10::ivalue::Future> launch_future(
+    std::function<c10::IValue()> func) {
+  auto future = c10::make_intrusive<c10::ivalue::Future>(c10::AnyType::get());
+  launch([func = std::move(func), future]() {
+    try {
+      future->markCompleted(func());
+    } catch (...) {
+      future->setError(std::current_exception());
+    }
+  });
+  return future;
+}
+
 } // namespace at
 #endif
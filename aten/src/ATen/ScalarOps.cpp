@@ -9,6 +9,10 @@
 #include <ATen/ScalarOps.h>
 #include <ATen/ATen.h>
 #include <ATen/Utils.h>
+#include <c10/util/hash.h>
+
+#include <cstring>
+#include <unordered_map>
 
 namespace at {
 namespace {
@@ -36,5 +40,69 @@ Tensor scalar_tensor_static(const Scalar& s, c10::optional<ScalarType> dtype_opt
   scalar_fill(result, s);
   return result;
 }
+
+// Note [Wrapped scalar cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// `tensor + 2` materializes 2 into a wrapped 0-dim CPU tensor, which costs a
+// TensorImpl plus a StorageImpl allocation for an 8-byte payload.
+// Elementwise-heavy code wraps the same handful of values millions of times,
+// so we hand out the same tensor every time a value repeats. This is safe
+// because wrapped numbers only ever appear as read-only inputs; nothing
+// writes through them. The cache is thread-local to keep lookups free of
+// locking and refcount contention, keyed by (dtype, bit pattern) so that
+// e.g. long 1 and bool true stay distinct, and cleared when it grows past
+// kWrappedScalarCacheSize to bound memory in code that wraps many distinct
+// values.
+namespace {
+
+constexpr size_t kWrappedScalarCacheSize = 64;
+
+using WrappedScalarKey = std::pair<ScalarType, uint64_t>;
+
+struct WrappedScalarKeyHash {
+  size_t operator()(const WrappedScalarKey& key) const {
+    return c10::get_hash(key.first, key.second);
+  }
+};
+
+} // namespace
+
+Tensor wrapped_scalar_tensor_cached(const Scalar& s) {
+  ScalarType dtype;
+  uint64_t bits = 0;
+  if (s.isFloatingPoint()) {
+    dtype = kDouble;
+    auto value = s.toDouble();
+    std::memcpy(&bits, &value, sizeof(value));
+  } else if (s.isBoolean()) {
+    dtype = kBool;
+    bits = s.toBool() ? 1 : 0;
+  } else if (s.isComplex()) {
+    // The 128-bit payload doesn't fit the key and complex wrapped scalars
+    // are rare enough that widening it for them isn't worth it.
+    auto tensor = scalar_tensor_static(s, kComplexDouble, kCPU);
+    tensor.unsafeGetTensorImpl()->set_wrapped_number(true);
+    return tensor;
+  } else {
+    AT_ASSERT(s.isIntegral(false));
+    dtype = kLong;
+    auto value = s.toLong();
+    std::memcpy(&bits, &value, sizeof(value));
+  }
+  thread_local std::unordered_map<WrappedScalarKey, Tensor, WrappedScalarKeyHash>
+      cache;
+  auto key = WrappedScalarKey(dtype, bits);
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  if (cache.size() >= kWrappedScalarCacheSize) {
+    cache.clear();
+  }
+  auto tensor = scalar_tensor_static(s, dtype, kCPU);
+  tensor.unsafeGetTensorImpl()->set_wrapped_number(true);
+  cache.emplace(key, tensor);
+  return tensor;
+}
 } // namespace detail
 } // namespace at
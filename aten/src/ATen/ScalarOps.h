@@ -13,6 +13,9 @@ namespace detail {
 // in TensorIterator for now.
 Tensor& scalar_fill(Tensor& self, const Scalar& value);
 TORCH_API Tensor scalar_tensor_static(const Scalar& s, c10::optional<ScalarType> dtype_opt, c10::optional<Device> device_opt);
+// Returns a cached immutable wrapped 0-dim CPU tensor for `s` when the value
+// has been wrapped before on this thread; see Note [Wrapped scalar cache].
+TORCH_API Tensor wrapped_scalar_tensor_cached(const Scalar& s);
 } // namespace detail
 } // namespace at
 
@@ -53,6 +56,11 @@ namespace at {
 namespace native {
 
 inline Tensor wrapped_scalar_tensor(const Scalar& scalar, const Device device = at::kCPU) {
+  // CPU wrapped numbers repeat the same handful of values constantly, so
+  // they are served from a cache; see Note [Wrapped scalar cache].
+  if (device == at::kCPU) {
+    return at::detail::wrapped_scalar_tensor_cached(scalar);
+  }
   auto tensor = scalar_to_tensor(scalar, device);
   tensor.unsafeGetTensorImpl()->set_wrapped_number(true);
   return tensor;
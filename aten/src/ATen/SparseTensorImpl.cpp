@@ -49,7 +49,7 @@ SparseTensorImpl::SparseTensorImpl(at::DispatchKeySet key_set, const caffe2::Typ
   AT_ASSERT(values_.device() == indices_.device());
   AT_ASSERT(values_.device() == device());
 
-  is_non_overlapping_and_dense_ = false;
+  contiguity_flags_ &= static_cast<uint8_t>(~kFlagNonOverlappingAndDense);
   set_storage_access_should_throw();
   set_has_contiguity_policy(HasContiguityPolicy::ContiguityNotSupported);
 }
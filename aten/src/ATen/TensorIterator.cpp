@@ -15,6 +15,8 @@
 
 #include <c10/util/irange.h>
 #include <c10/util/SmallBuffer.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/hash.h>
 
 #include <array>
 #include <algorithm>
@@ -1400,6 +1402,132 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
 
 TensorIteratorBase::TensorIteratorBase() = default;
 
+namespace {
+
+// Thread-local memoization of the iteration plan computed by build():
+// the coalesced computation shape and per-operand byte strides.
+// See TensorIteratorConfig::cache_iteration_plan.
+struct IterationPlan {
+  // Full (unhashed) key, re-checked on lookup to guard against hash
+  // collisions: per operand dtype, sizes and strides, plus iteration flags.
+  SmallVector<int64_t, 32> key;
+  DimVector shape;
+  SmallVector<OperandInfo::StrideVector, 4> stride_bytes;
+  ScalarType common_dtype = ScalarType::Undefined;
+  Device common_device = kCPU;
+  bool all_ops_same_shape = false;
+};
+
+using PlanKey = SmallVector<int64_t, 32>;
+
+// Bounded so that shape-churning workloads can't grow the cache without
+// limit; steady-state serving workloads see a handful of distinct plans.
+constexpr size_t kMaxCachedPlans = 512;
+
+ska::flat_hash_map<uint64_t, IterationPlan>& plan_cache() {
+  static thread_local ska::flat_hash_map<uint64_t, IterationPlan> cache;
+  return cache;
+}
+
+void append_plan_key(PlanKey& key, ArrayRef<OperandInfo> operands, bool enforce_linear_iteration) {
+  key.push_back(enforce_linear_iteration);
+  for (const auto& op : operands) {
+    const auto& t = op.tensor_base();
+    key.push_back(static_cast<int64_t>(t.scalar_type()));
+    key.push_back(t.dim());
+    for (const auto s : t.sizes()) {
+      key.push_back(s);
+    }
+    for (const auto s : t.strides()) {
+      key.push_back(s);
+    }
+  }
+}
+
+uint64_t plan_key_hash(const PlanKey& key) {
+  size_t h = key.size();
+  for (const auto v : key) {
+    h = c10::hash_combine(h, static_cast<size_t>(v));
+  }
+  return h;
+}
+
+} // namespace
+
+bool TensorIteratorBase::plan_cache_eligible() const {
+  // The cached fast path skips compute_types, output allocation and any
+  // temporary creation, so it is restricted to iterators where build()
+  // would not have done any of that: every operand defined, a single
+  // dtype and a single (non-virtual) device.
+  if (is_reduction_ || is_meta_ || !names_.empty()) {
+    return false;
+  }
+  const auto& first = operands_[0].tensor_base();
+  if (!first.defined()) {
+    return false;
+  }
+  const auto device = first.device();
+  if (device.type() == DeviceType::XLA || device.type() == DeviceType::Lazy ||
+      device.type() == DeviceType::Meta) {
+    return false;
+  }
+  const auto dtype = first.scalar_type();
+  for (const auto& op : operands_) {
+    const auto& t = op.tensor_base();
+    if (!t.defined() || t.scalar_type() != dtype || t.device() != device) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TensorIteratorBase::try_restore_cached_plan() {
+  PlanKey key;
+  append_plan_key(key, operands_, enforce_linear_iteration_);
+  auto& cache = plan_cache();
+  auto it = cache.find(plan_key_hash(key));
+  if (it == cache.end() || it->second.key != key) {
+    return false;
+  }
+  const auto& plan = it->second;
+  shape_ = plan.shape;
+  for (const auto i : c10::irange(operands_.size())) {
+    operands_[i].stride_bytes = plan.stride_bytes[i];
+  }
+  common_dtype_ = plan.common_dtype;
+  common_device_ = plan.common_device;
+  all_ops_same_shape_ = plan.all_ops_same_shape;
+  // The cached shape is already reordered and coalesced; perm_ is not
+  // reconstructed, matching the state after coalesce_dimensions().
+  has_coalesced_dimensions_ = true;
+  return true;
+}
+
+void TensorIteratorBase::save_plan_to_cache() const {
+  // Only cache plans whose build did not resize outputs or swap in
+  // temporaries; otherwise restoring the plan would skip those steps.
+  for (const auto& op : operands_) {
+    if (op.will_resize || op.original_tensor_base().defined()) {
+      return;
+    }
+  }
+  auto& cache = plan_cache();
+  if (cache.size() >= kMaxCachedPlans) {
+    cache.clear();
+  }
+  IterationPlan plan;
+  append_plan_key(plan.key, operands_, enforce_linear_iteration_);
+  plan.shape = shape_;
+  for (const auto& op : operands_) {
+    plan.stride_bytes.push_back(op.stride_bytes);
+  }
+  plan.common_dtype = common_dtype_;
+  plan.common_device = common_device_;
+  plan.all_ops_same_shape = all_ops_same_shape_;
+  const auto hash = plan_key_hash(plan.key);
+  cache[hash] = std::move(plan);
+}
+
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
@@ -1414,6 +1542,17 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   compute_mem_overlaps(config);
   // Check that input dimensions are aligned correctly & compute outnames.
   compute_names(config);
+
+  const bool use_plan_cache = config.cache_iteration_plan_ && plan_cache_eligible();
+  if (use_plan_cache && try_restore_cached_plan()) {
+    for (auto& op : operands_) {
+      op.data = op.tensor_base().data_ptr();
+    }
+    int64_t ndim_offsets = (ndim() ? ndim() : 1);
+    view_offsets_ = DimVector(ndim_offsets, 0);
+    return;
+  }
+
   // compute the broadcasted shape
   compute_shape(config);
   // mark outputs for resizing if necessary
@@ -1432,6 +1571,10 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
     if (!is_meta_) coalesce_dimensions();
   }
 
+  if (use_plan_cache) {
+    save_plan_to_cache();
+  }
+
   if (is_meta_) return;
 
   // XLA and lazy tensors don't have storage, so they don't have an underlying data pointer.
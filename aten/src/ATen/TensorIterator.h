@@ -452,6 +452,12 @@ protected:
   void propagate_names_to_outputs();
   void coalesce_dimensions();
 
+  // See TensorIteratorConfig::cache_iteration_plan. Returns true if the
+  // iterator could be fully initialized from a cached plan.
+  bool plan_cache_eligible() const;
+  bool try_restore_cached_plan();
+  void save_plan_to_cache() const;
+
 protected:
 
   /// Records the "computation" shape of the output tensor. The computation
@@ -724,6 +730,21 @@ public:
     return *this;
   }
 
+  // Sets the cache_iteration_plan_ flag, which is false by default.
+  // If true, the shape/stride analysis done by build() (broadcasting,
+  // dimension reordering and coalescing) is memoized in a thread-local
+  // cache keyed on the operands' sizes, strides and dtypes. Repeated
+  // calls with metadata-identical operands restore the coalesced
+  // iteration plan directly instead of recomputing it. This only kicks
+  // in for non-reduction iterators whose operands are all defined, all
+  // on the same device, and share a dtype (i.e. no temporaries would be
+  // allocated by build()); other configurations silently take the
+  // normal path.
+  TensorIteratorConfig& cache_iteration_plan(const bool _cache_iteration_plan = true) {
+    cache_iteration_plan_ = _cache_iteration_plan;
+    return *this;
+  }
+
   // Bypass output dtype/device computation and fix the dtype/device as specified here.
   TensorIteratorConfig& declare_static_dtype_and_device(ScalarType dtype, Device device);
   TensorIteratorConfig& declare_static_dtype(ScalarType dtype);
@@ -749,6 +770,7 @@ private:
   c10::optional<Device> static_device_ = c10::nullopt;
   bool check_mem_overlap_ = true;
   bool allow_cpu_scalars_ = false;
+  bool cache_iteration_plan_ = false;
   bool is_reduction_ = false;
   bool resize_outputs_ = true;
   bool check_all_same_dtype_ = true;
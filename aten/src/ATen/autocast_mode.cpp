@@ -45,10 +45,28 @@ namespace {
 //
 // I'm not using the weak_intrusive_ptr as the key because it's more difficult to compare
 // directly against incoming TensorImpl*s.
+//
+// The value also records the source tensor's version counter at cast time.
+// A hit whose stored version no longer matches the source means the source
+// was mutated in place (e.g. by an optimizer step) after the cast, so the
+// entry is dropped and the cast redone.  Views share their base's version
+// counter, so a mutation through any alias invalidates the entry as well,
+// which is what makes caching views safe.
+//
+// The final bool marks entries that may be retained across autocast regions
+// by prune_cache() (casts of leaf non-view sources, whose cached value holds
+// at most a single ToCopyBackward node).  Casts of non-leaf or view sources
+// keep their autograd graph alive, so they are only cached within a region.
 using weakref_type = c10::weak_intrusive_ptr<TensorImpl, UndefinedTensorImpl>;
-using val_type = std::tuple<weakref_type, Tensor>;
+using val_type = std::tuple<weakref_type, Tensor, uint32_t, bool>;
 thread_local std::unordered_map<TensorImpl*, val_type> cached_casts;
 
+// Cast-cache instrumentation, see cached_cast below. Counts only lookups
+// that were eligible for caching; a stale (version-mismatched) hit counts
+// as a miss because the cast is redone.
+thread_local int64_t cache_hits = 0;
+thread_local int64_t cache_misses = 0;
+
 // nesting tracks the nesting depth of the Python-side context manager.
 // When the autocast context manager exits to a nesting level that's outside
 // any instance of autocast (which should occur at the end of each forward pass)
@@ -69,6 +87,38 @@ void clear_cache() {
   cached_casts.clear();
 }
 
+// Called when the outermost autocast region exits.  Unlike clear_cache(),
+// entries for leaf non-view sources whose version counter is unchanged are
+// kept, so the next forward pass reuses the casted weights instead of
+// re-issuing the casts.  Entries whose source was mutated, freed, or whose
+// cached value would keep an autograd graph alive are dropped.
+void prune_cache() {
+  for (auto it = cached_casts.begin(); it != cached_casts.end();) {
+    const auto& weakref = std::get<0>(it->second);
+    bool retain = std::get<3>(it->second) && !weakref.expired() &&
+        it->first->version_counter().current_version() ==
+            std::get<2>(it->second);
+    if (retain) {
+      ++it;
+    } else {
+      it = cached_casts.erase(it);
+    }
+  }
+}
+
+int64_t get_autocast_cache_hit_count() {
+  return cache_hits;
+}
+
+int64_t get_autocast_cache_miss_count() {
+  return cache_misses;
+}
+
+void reset_autocast_cache_stats() {
+  cache_hits = 0;
+  cache_misses = 0;
+}
+
 int increment_nesting() {
   return ++nesting;
 }
@@ -110,18 +160,33 @@ void set_autocast_cache_enabled(bool enabled) {
 // extern thread_local in the header.
 Tensor cached_cast(at::ScalarType to_type, const Tensor& arg, DeviceType device_type) {
   if (is_eligible(arg, device_type) && (arg.scalar_type() != to_type)) {
-    // Heuristic:  Do what Apex does, and cache lower_precision_fp casts of fp32 model weights (leaves).
+    // Heuristic:  Do what Apex does, and cache lower_precision_fp casts of fp32 model weights.
+    // Unlike Apex, views and non-leaf sources (e.g. tied weights materialized by an op)
+    // are cached too; the version check below keeps that sound under in-place mutation.
     // See cached_casts declaration above for detailed strategy.
     bool can_try_cache = (to_type == get_lower_precision_fp_from_device_type(device_type) &&
                          arg.scalar_type() == at::kFloat && arg.requires_grad() &&
-                         arg.is_leaf() && !arg.is_view() && cache_enabled);
+                         cache_enabled);
     if (can_try_cache) {
+      const auto version =
+          arg.unsafeGetTensorImpl()->version_counter().current_version();
       auto it = cached_casts.find(arg.unsafeGetTensorImpl());
+      if (it != cached_casts.end() && std::get<2>(it->second) != version) {
+        // The source was mutated in place since the cast was cached
+        // (possibly through another view of the same storage).
+        cached_casts.erase(it);
+        it = cached_casts.end();
+      }
       if (it != cached_casts.end()) {
+        cache_hits++;
         return std::get<1>(it->second);
       } else {
+        cache_misses++;
         auto casted_arg = arg.to(to_type);
-        cached_casts.emplace(arg.unsafeGetTensorImpl(), val_type{weakref_type(arg.getIntrusivePtr()), casted_arg});
+        bool retain_across_regions = arg.is_leaf() && !arg.is_view();
+        cached_casts.emplace(
+            arg.unsafeGetTensorImpl(),
+            val_type{weakref_type(arg.getIntrusivePtr()), casted_arg, version, retain_across_regions});
         return casted_arg;
       }
     } else {
@@ -6,6 +6,10 @@ namespace autocast {
 TORCH_API bool is_enabled();
 TORCH_API void set_enabled(bool enabled);
 TORCH_API void clear_cache();
+TORCH_API void prune_cache();
+TORCH_API int64_t get_autocast_cache_hit_count();
+TORCH_API int64_t get_autocast_cache_miss_count();
+TORCH_API void reset_autocast_cache_stats();
 TORCH_API int increment_nesting();
 TORCH_API int decrement_nesting();
 TORCH_API bool is_cpu_enabled();
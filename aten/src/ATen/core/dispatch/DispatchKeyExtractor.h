@@ -128,7 +128,12 @@ public:
     dispatch_arg_indices_reverse_ = c10::utils::bitset();
   }
 
-  DispatchKeySet getDispatchKeySetBoxed(const torch::jit::Stack* stack) const {
+  // Union of the key sets of the dispatch-relevant arguments, with no
+  // thread-local overrides or fallthrough masking applied. Exposed
+  // separately so call sites whose argument keys are provably constant
+  // (e.g. Static Runtime nodes) can extract once and cache the result;
+  // the per-call pieces are folded in by getDispatchKeySetFromArgKeys.
+  DispatchKeySet getArgDispatchKeySetBoxed(const torch::jit::Stack* stack) const {
     DispatchKeySet ks;
     dispatch_arg_indices_reverse_.for_each_set_bit([&] (size_t reverse_arg_index) {
       const auto& ivalue = torch::jit::peek(*stack, 0, reverse_arg_index + 1);
@@ -150,10 +155,21 @@ public:
         }
       }
     });
+    return ks;
+  }
+
+  // Applies the pieces of key computation that may legitimately change
+  // between calls - the thread-local include/exclude sets and the
+  // fallthrough mask - to a previously extracted argument key set.
+  DispatchKeySet getDispatchKeySetFromArgKeys(DispatchKeySet ks) const {
     // Keys that are fallthrough should be skipped
     return impl::computeDispatchKeySet(ks, nonFallthroughKeys_);
   }
 
+  DispatchKeySet getDispatchKeySetBoxed(const torch::jit::Stack* stack) const {
+    return getDispatchKeySetFromArgKeys(getArgDispatchKeySetBoxed(stack));
+  }
+
   template<class... Args>
   DispatchKeySet getDispatchKeySetUnboxed(const Args&... args) const {
     auto ks = detail::multi_dispatch_key_set(args...);
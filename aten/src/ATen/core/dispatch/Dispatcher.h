@@ -164,6 +164,19 @@ public:
   // Invoke an operator via the boxed calling convention using an IValue stack
   void callBoxed(const OperatorHandle& op, Stack* stack) const;
 
+  // Like callBoxed, but takes the union of the argument key sets
+  // pre-extracted by the caller (typically cached across calls at a
+  // call site whose tensor arguments never change backend, such as a
+  // Static Runtime node). Unlike redispatchBoxed, the thread-local
+  // include/exclude sets and fallthrough masking are still applied on
+  // every call, so modes like InferenceMode behave as usual.
+  void callBoxedWithPrecomputedDispatchKeySet(const OperatorHandle& op, DispatchKeySet argKeySet, Stack* stack) const;
+
+  // Extracts the argument key set a boxed call would dispatch on,
+  // without thread-local overrides or fallthrough masking, so it can be
+  // cached and passed to callBoxedWithPrecomputedDispatchKeySet.
+  DispatchKeySet extractArgDispatchKeySetBoxed(const OperatorHandle& op, const Stack* stack) const;
+
   // TODO: This will only be useful if we write a backend fallback that plumbs dispatch keys (currently there are none)
   // See Note [Plumbing Keys Through The Dispatcher]
   void redispatchBoxed(const OperatorHandle& op, DispatchKeySet dispatchKeySet, Stack* stack) const;
@@ -262,6 +275,10 @@ public:
 private:
   Dispatcher();
 
+  // Shared tail of callBoxed and callBoxedWithPrecomputedDispatchKeySet:
+  // runs the kernel for an already fully computed dispatch key set.
+  void callBoxedForDispatchKeySet(const OperatorHandle& op, DispatchKeySet dispatchKeySet, Stack* stack) const;
+
   static int64_t sequenceNumberForRunningRecordFunction(DispatchKey dispatchKey);
   static void runRecordFunction(at::RecordFunction& guard, const OperatorHandle& op, DispatchKey dispatchKey);
   static void runRecordFunction(at::RecordFunction& guard, const OperatorHandle& op, DispatchKey dispatchKey, torch::jit::Stack &&stack);
@@ -360,6 +377,11 @@ public:
     callBoxed(&stack);
   }
 
+  void callBoxedWithPrecomputedDispatchKeySet(DispatchKeySet argKeySet, Stack* stack) const {
+    c10::Dispatcher::singleton().callBoxedWithPrecomputedDispatchKeySet(
+        *this, argKeySet, stack);
+  }
+
   void redispatchBoxed(DispatchKeySet ks, Stack* stack) const {
     c10::Dispatcher::singleton().redispatchBoxed(*this, ks, stack);
   }
@@ -556,6 +578,21 @@ inline void Dispatcher::callBoxed(const OperatorHandle& op, Stack* stack) const
   // note: this doesn't need the mutex because write operations on the list keep iterators intact.
   const auto& entry = op.operatorDef_->op;
   auto dispatchKeySet = entry.dispatchKeyExtractor().getDispatchKeySetBoxed(stack);
+  callBoxedForDispatchKeySet(op, dispatchKeySet, stack);
+}
+
+inline void Dispatcher::callBoxedWithPrecomputedDispatchKeySet(const OperatorHandle& op, DispatchKeySet argKeySet, Stack* stack) const {
+  const auto& entry = op.operatorDef_->op;
+  auto dispatchKeySet = entry.dispatchKeyExtractor().getDispatchKeySetFromArgKeys(argKeySet);
+  callBoxedForDispatchKeySet(op, dispatchKeySet, stack);
+}
+
+inline DispatchKeySet Dispatcher::extractArgDispatchKeySetBoxed(const OperatorHandle& op, const Stack* stack) const {
+  return op.operatorDef_->op.dispatchKeyExtractor().getArgDispatchKeySetBoxed(stack);
+}
+
+inline void Dispatcher::callBoxedForDispatchKeySet(const OperatorHandle& op, DispatchKeySet dispatchKeySet, Stack* stack) const {
+  const auto& entry = op.operatorDef_->op;
   const auto& kernel = entry.lookup(dispatchKeySet.highestPriorityTypeId());
 #ifndef PYTORCH_DISABLE_PER_OP_PROFILING
   bool pre_sampled = false;
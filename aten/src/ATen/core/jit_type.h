@@ -737,6 +737,11 @@ struct TORCH_API TensorType : public Type {
     return strides;
   }
 
+  static VaryingShape<Stride> computeStrideProps(
+      at::IntArrayRef sizes,
+      at::IntArrayRef strides,
+      bool tensor_contiguity = false);
+
  private:
   TensorType(
       c10::optional<at::ScalarType> scalar_type,
@@ -751,11 +756,6 @@ struct TORCH_API TensorType : public Type {
         scalar_type_, device_, sizes_, strides_, requires_grad_, undefined_));
   }
 
-  static VaryingShape<Stride> computeStrideProps(
-      at::IntArrayRef sizes,
-      at::IntArrayRef strides,
-      bool tensor_contiguity = false);
-
   c10::optional<at::ScalarType> scalar_type_;
   c10::optional<at::Device> device_;
   SymbolicShape sizes_;
@@ -256,6 +256,15 @@ public:
   Vectorized<BFloat16> atan() const {
     return map(Sleef_atanf8_u10);
   }
+  Vectorized<BFloat16> acosh() const {
+    return map(Sleef_acoshf8_u10);
+  }
+  Vectorized<BFloat16> asinh() const {
+    return map(Sleef_asinhf8_u10);
+  }
+  Vectorized<BFloat16> atanh() const {
+    return map(Sleef_atanhf8_u10);
+  }
   Vectorized<BFloat16> atan2(const Vectorized<BFloat16> &b) const {
     __m256 lo, hi;
     __m256 b1, b2;
@@ -300,6 +309,9 @@ public:
   Vectorized<BFloat16> expm1() const {
     return map(Sleef_expm1f8_u10);
   }
+  Vectorized<BFloat16> exp2() const {
+    return map(Sleef_exp2f8_u10);
+  }
   Vectorized<BFloat16> fmod(const Vectorized<BFloat16> & q) const {
     __m256 x_lo, x_hi;
     cvtbf16_fp32(values, x_lo, x_hi);
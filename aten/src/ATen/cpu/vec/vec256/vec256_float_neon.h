@@ -332,6 +332,15 @@ public:
   Vectorized<float> atan() const {
     return map(std::atan);
   }
+  Vectorized<float> acosh() const {
+    return map(std::acosh);
+  }
+  Vectorized<float> asinh() const {
+    return map(std::asinh);
+  }
+  Vectorized<float> atanh() const {
+    return map(std::atanh);
+  }
   Vectorized<float> atan2(const Vectorized<float> &exp) const {
     __at_align__ float tmp[size()];
     __at_align__ float tmp_exp[size()];
@@ -367,6 +376,9 @@ public:
   Vectorized<float> expm1() const {
     return map(std::expm1);
   }
+  Vectorized<float> exp2() const {
+    return map(std::exp2);
+  }
   Vectorized<float> fmod(const Vectorized<float>& q) const {
     __at_align__ float tmp[size()];
     __at_align__ float tmp_q[size()];
@@ -307,6 +307,18 @@ class Vectorized<ComplexDbl> {
     return Vectorized(vd_pi_2) - asin();
   }
 
+  Vectorized<ComplexDbl> acosh() const {
+    return map(std::acosh);
+  }
+
+  Vectorized<ComplexDbl> asinh() const {
+    return map(std::asinh);
+  }
+
+  Vectorized<ComplexDbl> atanh() const {
+    return map(std::atanh);
+  }
+
   Vectorized<ComplexDbl> atan() const {
     // atan(x) = i/2 * ln((i + z)/(i - z))
     auto ione = Vectorized(vd_imag_one);
@@ -451,6 +451,18 @@ class Vectorized<ComplexFlt> {
     return Vectorized(pi_2) - asin();
   }
 
+  Vectorized<ComplexFlt> acosh() const {
+    return map(std::acosh);
+  }
+
+  Vectorized<ComplexFlt> asinh() const {
+    return map(std::asinh);
+  }
+
+  Vectorized<ComplexFlt> atanh() const {
+    return map(std::atanh);
+  }
+
   Vectorized<ComplexFlt> inline operator*(const Vectorized<ComplexFlt>& b) const {
     //(a + bi)  * (c + di) = (ac - bd) + (ad + bc)i
 
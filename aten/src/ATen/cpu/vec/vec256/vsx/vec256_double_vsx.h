@@ -223,6 +223,15 @@ class Vectorized<double> {
   Vectorized<double> atan() const {
      return {Sleef_atand2_u10vsx(_vec0), Sleef_atand2_u10vsx(_vec1)};
   }
+  Vectorized<double> acosh() const {
+     return {Sleef_acoshd2_u10vsx(_vec0), Sleef_acoshd2_u10vsx(_vec1)};
+  }
+  Vectorized<double> asinh() const {
+     return {Sleef_asinhd2_u10vsx(_vec0), Sleef_asinhd2_u10vsx(_vec1)};
+  }
+  Vectorized<double> atanh() const {
+     return {Sleef_atanhd2_u10vsx(_vec0), Sleef_atanhd2_u10vsx(_vec1)};
+  }
   Vectorized<double> atan2(const Vectorized<double>& b) const {
      return {Sleef_atan2d2_u10vsx(_vec0, b._vec0), Sleef_atan2d2_u10vsx(_vec1, b._vec1)};
   }
@@ -241,6 +250,9 @@ class Vectorized<double> {
   Vectorized<double> expm1() const {
      return {Sleef_expm1d2_u10vsx(_vec0), Sleef_expm1d2_u10vsx(_vec1)};
   }
+  Vectorized<double> exp2() const {
+     return {Sleef_exp2d2_u10vsx(_vec0), Sleef_exp2d2_u10vsx(_vec1)};
+  }
 
   Vectorized<double> lgamma() const __ubsan_ignore_undefined__ {
      return {Sleef_lgammad2_u10vsx(_vec0), Sleef_lgammad2_u10vsx(_vec1)};
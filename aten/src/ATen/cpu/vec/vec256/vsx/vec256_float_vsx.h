@@ -264,6 +264,15 @@ class Vectorized<float> {
   Vectorized<float> atan() const {
      return {Sleef_atanf4_u10vsx(_vec0), Sleef_atanf4_u10vsx(_vec1)};
   }
+  Vectorized<float> acosh() const {
+     return {Sleef_acoshf4_u10vsx(_vec0), Sleef_acoshf4_u10vsx(_vec1)};
+  }
+  Vectorized<float> asinh() const {
+     return {Sleef_asinhf4_u10vsx(_vec0), Sleef_asinhf4_u10vsx(_vec1)};
+  }
+  Vectorized<float> atanh() const {
+     return {Sleef_atanhf4_u10vsx(_vec0), Sleef_atanhf4_u10vsx(_vec1)};
+  }
   Vectorized<float> atan2(const Vectorized<float>& b) const {
      return {Sleef_atan2f4_u10vsx(_vec0, b._vec0), Sleef_atan2f4_u10vsx(_vec1, b._vec1)};
   }
@@ -344,6 +353,9 @@ class Vectorized<float> {
   Vectorized<float> expm1() const {
     return exp() - one;
   }
+  Vectorized<float> exp2() const {
+     return {Sleef_exp2f4_u10vsx(_vec0), Sleef_exp2f4_u10vsx(_vec1)};
+  }
 
   Vectorized<float> C10_ALWAYS_INLINE log() const {
     return {Sleef_logf4_u10vsx(_vec0), Sleef_logf4_u10vsx(_vec1)};
@@ -334,6 +334,15 @@ public:
   Vectorized<BFloat16> atan() const {
     return map(Sleef_atanf16_u10);
   }
+  Vectorized<BFloat16> acosh() const {
+    return map(Sleef_acoshf16_u10);
+  }
+  Vectorized<BFloat16> asinh() const {
+    return map(Sleef_asinhf16_u10);
+  }
+  Vectorized<BFloat16> atanh() const {
+    return map(Sleef_atanhf16_u10);
+  }
   Vectorized<BFloat16> atan2(const Vectorized<BFloat16> &b) const {
     __m512 lo, hi;
     __m512 b1, b2;
@@ -378,6 +387,9 @@ public:
   Vectorized<BFloat16> expm1() const {
     return map(Sleef_expm1f16_u10);
   }
+  Vectorized<BFloat16> exp2() const {
+    return map(Sleef_exp2f16_u10);
+  }
   Vectorized<BFloat16> fmod(const Vectorized<BFloat16> & q) const {
     __m512 x_lo, x_hi;
     cvtbf16_fp32(values, x_lo, x_hi);
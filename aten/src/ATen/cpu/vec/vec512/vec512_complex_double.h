@@ -276,6 +276,15 @@ public:
     const __m512d pi_2 = _mm512_setr_pd(pi_2d, 0.0, pi_2d, 0.0, pi_2d, 0.0, pi_2d, 0.0);
     return _mm512_sub_pd(pi_2, asin());
   }
+  Vectorized<c10::complex<double>> acosh() const {
+    return map(std::acosh);
+  }
+  Vectorized<c10::complex<double>> asinh() const {
+    return map(std::asinh);
+  }
+  Vectorized<c10::complex<double>> atanh() const {
+    return map(std::atanh);
+  }
   Vectorized<c10::complex<double>> atan() const;
   Vectorized<c10::complex<double>> atan2(const Vectorized<c10::complex<double>> &b) const {
     AT_ERROR("not supported for complex numbers");
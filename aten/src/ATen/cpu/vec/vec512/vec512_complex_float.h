@@ -777,6 +777,15 @@ public:
   Vectorized<c10::complex<float>> acos() const {
     return map(std::acos);
   }
+  Vectorized<c10::complex<float>> acosh() const {
+    return map(std::acosh);
+  }
+  Vectorized<c10::complex<float>> asinh() const {
+    return map(std::asinh);
+  }
+  Vectorized<c10::complex<float>> atanh() const {
+    return map(std::atanh);
+  }
   Vectorized<c10::complex<float>> atan() const;
   Vectorized<c10::complex<float>> atan2(const Vectorized<c10::complex<float>> &b) const {
     AT_ERROR("not supported for complex numbers");
@@ -339,6 +339,15 @@ public:
   Vectorized<T> atan() const {
     return map(std::atan);
   }
+  Vectorized<T> acosh() const {
+    return map(std::acosh);
+  }
+  Vectorized<T> asinh() const {
+    return map(std::asinh);
+  }
+  Vectorized<T> atanh() const {
+    return map(std::atanh);
+  }
   Vectorized<T> atan2(const Vectorized<T> &exp) const {
     Vectorized<T> ret;
     for (const auto i : c10::irange(size())) {
@@ -371,6 +380,9 @@ public:
   Vectorized<T> expm1() const {
     return map(std::expm1);
   }
+  Vectorized<T> exp2() const {
+    return map(std::exp2);
+  }
   Vectorized<T> frac() const {
     return *this - this->trunc();
   }
@@ -2,6 +2,7 @@
 
 #include <ATen/cuda/ATenCUDAGeneral.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAStream.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <ATen/cuda/Exceptions.h>
@@ -47,7 +48,12 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
   // CUDA context on other devices.
   ~CUDAEvent() {
     try {
-      if (is_created_) {
+      if (is_pooled_) {
+        // Returning to the pool is just a list push, no driver call; the
+        // next acquirer re-records before relying on the event's state.
+        // See Note [CUDA event pool].
+        c10::cuda::returnEventToPool(device_index_, event_);
+      } else if (is_created_) {
         CUDAGuard guard(device_index_);
         cudaEventDestroy(event_);
       }
@@ -110,7 +116,7 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
   // Note: cudaEventRecord must be called on the same device as the event.
   void record(const CUDAStream& stream) {
     if (!is_created_) {
-      createEvent(stream.device_index());
+      createEvent(stream.device_index(), /*use_pool=*/true);
     }
 
     TORCH_CHECK(device_index_ == stream.device_index(), "Event device ", device_index_,
@@ -151,9 +157,12 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
     #if !defined(USE_ROCM)
       if (!is_created_) {
         // this CUDAEvent object was initially constructed from flags but event_
-        // is not created yet.
-        createEvent(getCurrentCUDAStream().device_index());
+        // is not created yet. An IPC-shared event outlives this wrapper in
+        // the peer process, so it must never come from (or go back to) the
+        // event pool.
+        createEvent(getCurrentCUDAStream().device_index(), /*use_pool=*/false);
       }
+      is_pooled_ = false;
       CUDAGuard guard(device_index_);
       AT_CUDA_CHECK(cudaIpcGetEventHandle(handle, event_));
     #else
@@ -164,20 +173,30 @@ struct TORCH_CUDA_CPP_API CUDAEvent {
 private:
   unsigned int flags_ = cudaEventDisableTiming;
   bool is_created_ = false;
+  bool is_pooled_ = false;
   bool was_recorded_ = false;
   DeviceIndex device_index_ = -1;
   cudaEvent_t event_{};
 
-  void createEvent(DeviceIndex device_index) {
+  void createEvent(DeviceIndex device_index, bool use_pool) {
     device_index_ = device_index;
     CUDAGuard guard(device_index_);
-    AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    if (use_pool && flags_ == cudaEventDisableTiming) {
+      // The pool only holds cudaEventDisableTiming events; anything else
+      // (e.g. timing-enabled events) is created and destroyed per use.
+      // See Note [CUDA event pool].
+      event_ = c10::cuda::getEventFromPool(device_index_);
+      is_pooled_ = true;
+    } else {
+      AT_CUDA_CHECK(cudaEventCreateWithFlags(&event_, flags_));
+    }
     is_created_ = true;
   }
 
   void moveHelper(CUDAEvent&& other) {
     std::swap(flags_, other.flags_);
     std::swap(is_created_, other.is_created_);
+    std::swap(is_pooled_, other.is_pooled_);
     std::swap(was_recorded_, other.was_recorded_);
     std::swap(device_index_, other.device_index_);
     std::swap(event_, other.event_);
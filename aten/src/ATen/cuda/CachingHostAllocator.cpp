@@ -4,11 +4,16 @@
 #include <ATen/cuda/detail/CUDAHooks.h>
 
 
+#include <c10/util/thread_name.h>
+
 #include <cuda_runtime_api.h>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <memory>
 #include <mutex>
 #include <stdint.h>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <set>
@@ -61,8 +66,30 @@ struct HostAllocator
   // outstanding cuda events
   std::deque<std::pair<cudaEvent_t, void*>> cuda_events;
 
+  // Background thread that polls outstanding events and returns blocks to
+  // the available list, so recycling doesn't have to wait for the next
+  // malloc/free call from a (possibly latency-sensitive) client thread.
+  // Started lazily when the first event is queued; disable with
+  // PYTORCH_NO_CUDA_HOST_ALLOC_REAPER.
+  std::thread reaper_thread;
+  std::condition_variable reaper_cv;
+  bool reaper_started = false;
+  bool shutdown = false;
+
   HostAllocator() : available(BlockComparator) {}
 
+  ~HostAllocator()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      shutdown = true;
+    }
+    reaper_cv.notify_all();
+    if (reaper_thread.joinable()) {
+      reaper_thread.join();
+    }
+  }
+
   cudaError_t malloc(void** ptr, size_t size)
   {
     std::lock_guard<std::mutex> lock(mutex);
@@ -142,7 +169,36 @@ struct HostAllocator
     if (block.event_count == 0) {
       // the block can be re-used if there are no outstanding cuda events
       available.insert(block);
+    } else {
+      startReaper();
+      reaper_cv.notify_one();
+    }
+    return cudaSuccess;
+  }
+
+  cudaError_t reserve(size_t size)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (size == 0) {
+      return cudaSuccess;
+    }
+
+    // same primary-context dance as malloc; see pytorch/pytorch#21081
+    at::OptionalDeviceGuard device_guard;
+    auto primary_ctx_device_index = at::cuda::detail::getDeviceIndexWithPrimaryContext();
+    if (primary_ctx_device_index.has_value()) {
+      device_guard.reset_device(at::Device(at::DeviceType::CUDA, *primary_ctx_device_index));
     }
+
+    void* ptr = nullptr;
+    cudaError_t err = cudaHostAlloc(&ptr, size, cudaHostAllocDefault);
+    if (err != cudaSuccess) {
+      return err;
+    }
+
+    auto inserted = blocks.insert({ptr, Block(size, ptr, false)});
+    available.insert(inserted.first->second);
     return cudaSuccess;
   }
 
@@ -229,6 +285,34 @@ struct HostAllocator
     }
   }
 
+  // must be called with `mutex` held
+  void startReaper()
+  {
+    static bool enabled =
+        getenv("PYTORCH_NO_CUDA_HOST_ALLOC_REAPER") == nullptr;
+    if (reaper_started || !enabled) {
+      return;
+    }
+    reaper_started = true;
+    reaper_thread = std::thread([this]() {
+      c10::setThreadName("CachingHostAllocator_reaper");
+      std::unique_lock<std::mutex> lock(mutex);
+      while (!shutdown) {
+        if (cuda_events.empty()) {
+          reaper_cv.wait(lock);
+        } else {
+          reaper_cv.wait_for(lock, std::chrono::milliseconds(10));
+        }
+        if (shutdown) {
+          break;
+        }
+        // Errors (if any) will resurface on the next malloc/free; here we
+        // only recycle opportunistically.
+        (void)processEvents();
+      }
+    });
+  }
+
   cudaError_t insertEvents(Block& block)
   {
     cudaError_t err;
@@ -267,6 +351,11 @@ cudaError_t CachingHostAllocator_recordEvent(void *ptr, at::cuda::CUDAStream str
   return allocator.recordEvent(ptr, stream);
 }
 
+cudaError_t CachingHostAllocator_reserve(size_t size)
+{
+  return allocator.reserve(size);
+}
+
 void CachingHostAllocator_emptyCache()
 {
   allocator.emptyCache();
@@ -28,6 +28,12 @@ TORCH_CUDA_CPP_API c10::Allocator* getCachingHostAllocator();
 TORCH_CUDA_CPP_API cudaError_t
 CachingHostAllocator_recordEvent(void* ptr, c10::cuda::CUDAStream stream);
 
+// Eagerly adds an unallocated pinned block of 'size' bytes to the cache, so
+// later allocations of up to that size are served from the cache instead of
+// paying for cudaHostAlloc (~ms each) on the hot path. Call once per buffer
+// you expect to need, e.g. before the first epoch.
+TORCH_CUDA_CPP_API cudaError_t CachingHostAllocator_reserve(size_t size);
+
 // Releases cached pinned memory allocations via cudaHostFree
 TORCH_CUDA_CPP_API void CachingHostAllocator_emptyCache();
 
@@ -0,0 +1,308 @@
+#include <ATen/ATen.h>
+#include <torch/library.h>
+#include <ATen/autocast_mode.h>
+#include <ATen/memoize_mode.h>
+
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/grad_mode.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
+#include <c10/util/hash.h>
+#include <c10/util/intrusive_ptr.h>
+#include <c10/util/irange.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace at {
+namespace memoize {
+
+bool is_enabled() {
+  return c10::impl::tls_is_dispatch_key_included(DispatchKey::Memoize);
+}
+
+void set_enabled(bool enabled) {
+  c10::impl::tls_set_dispatch_key_included(DispatchKey::Memoize, enabled);
+}
+
+namespace {
+// Note [Memoize mode]
+// ~~~~~~~~~~~~~~~~~~~
+// Serving pipelines often recompute identical functional ops over the same
+// frozen tensors on every request (e.g. normalizing a cached weight).  While
+// this mode is enabled, allowlisted pure ops are served from a bounded LRU
+// cache keyed by the op name, each input tensor's TensorImpl* and version
+// counter, and the values of all non-tensor arguments.  A hit returns the
+// previously computed output tensor itself, so repeated constant
+// preprocessing collapses into a pointer return.  Callers opting in must
+// treat cached results as immutable; a mutation is detected via the output's
+// version counter and drops the entry rather than serving the mutated value.
+//
+// What makes a hit safe:
+// * Only ops whose schema neither mutates nor aliases any argument or return
+//   and which return a single Tensor are eligible; everything else (in-place
+//   and out= variants, views, multi-output ops) passes through uncached.
+// * As in the autocast cast cache, each entry holds weakrefs to its input
+//   TensorImpls.  The weakrefs keep those TensorImpl addresses from being
+//   reused, so a pointer match in the key always means "the same tensor",
+//   and an expired weakref marks the entry dead.
+// * The version counter in the key catches in-place mutation of an input,
+//   including mutation through a view (views share their base's counter),
+//   which is what makes the inputs provably unmutated on a hit.
+// * Calls where autograd would record a graph (GradMode on with an input
+//   requiring grad), under autocast (whose casts aren't part of the key),
+//   or involving inference tensors (no version counter to validate) also
+//   pass through uncached.
+using weakref_type = c10::weak_intrusive_ptr<TensorImpl, UndefinedTensorImpl>;
+
+// One argument's contribution to a cache key.  Tensors are identified by
+// TensorImpl* + version; everything else is kept by value.
+struct ArgKey {
+  bool is_tensor = false;
+  TensorImpl* impl = nullptr;
+  uint64_t version = 0;
+  IValue value;
+};
+
+struct CacheKey {
+  std::string op;
+  std::vector<ArgKey> args;
+  size_t hash = 0;
+
+  bool operator==(const CacheKey& other) const {
+    if (hash != other.hash || op != other.op ||
+        args.size() != other.args.size()) {
+      return false;
+    }
+    for (const auto i : c10::irange(args.size())) {
+      const auto& a = args[i];
+      const auto& b = other.args[i];
+      if (a.is_tensor != b.is_tensor) {
+        return false;
+      }
+      if (a.is_tensor) {
+        if (a.impl != b.impl || a.version != b.version) {
+          return false;
+        }
+      } else if (!(a.value == b.value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+struct CacheKeyHash {
+  size_t operator()(const CacheKey& key) const {
+    return key.hash;
+  }
+};
+
+struct CacheEntry {
+  Tensor output;
+  uint64_t output_version = 0;
+  std::vector<weakref_type> input_refs;
+  std::list<const CacheKey*>::iterator lru_it;
+};
+
+using Cache = std::unordered_map<CacheKey, CacheEntry, CacheKeyHash>;
+
+std::mutex cache_mutex;
+Cache cache;
+// Most recently used keys at the front.  The pointers stay valid across
+// rehashing because unordered_map never moves its elements.
+std::list<const CacheKey*> cache_lru;
+size_t cache_max_entries = 1024;
+std::unordered_set<std::string> memoized_ops;
+
+void erase_entry(Cache::iterator it) {
+  cache_lru.erase(it->second.lru_it);
+  cache.erase(it);
+}
+
+void evict_until(size_t max_entries) {
+  while (cache.size() > max_entries) {
+    erase_entry(cache.find(*cache_lru.back()));
+  }
+}
+
+// In-place/out variants and views can't be replayed as a pointer return.
+bool is_pure_schema(const c10::FunctionSchema& schema) {
+  if (schema.is_mutable() || schema.hasAnyAliasInfo()) {
+    return false;
+  }
+  const auto& returns = schema.returns();
+  return returns.size() == 1 &&
+      returns[0].type()->kind() == c10::TypeKind::TensorType;
+}
+
+// IValue::hash covers the scalar argument types but throws for generic
+// lists, so the common list arguments (sizes, dims, scales) are hashed by
+// element here.  Returns false for argument types the cache can't key on.
+bool append_value_hash(const IValue& v, size_t& seed) {
+  if (v.isIntList()) {
+    for (const auto x : v.toIntVector()) {
+      seed = c10::hash_combine(seed, c10::get_hash(x));
+    }
+    return true;
+  }
+  if (v.isDoubleList()) {
+    for (const auto x : v.toDoubleVector()) {
+      seed = c10::hash_combine(seed, c10::get_hash(x));
+    }
+    return true;
+  }
+  if (v.isBoolList()) {
+    for (const auto x : v.toBoolList()) {
+      seed = c10::hash_combine(seed, c10::get_hash(static_cast<bool>(x)));
+    }
+    return true;
+  }
+  if (v.isNone() || v.isBool() || v.isInt() || v.isDouble() ||
+      v.isString() || v.isDevice()) {
+    seed = c10::hash_combine(seed, IValue::hash(v));
+    return true;
+  }
+  return false;
+}
+
+void memoize_fallback(const c10::OperatorHandle& op, torch::jit::Stack* stack) {
+  // Redispatch below Memoize, both for the pass-through path and for the
+  // actual computation on a miss.
+  c10::impl::ExcludeDispatchKeyGuard no_memoize(DispatchKey::Memoize);
+
+  const auto& schema = op.schema();
+  const auto num_args = schema.arguments().size();
+
+  bool cacheable = is_pure_schema(schema) && !at::autocast::is_enabled() &&
+      !at::autocast::is_cpu_enabled();
+
+  if (cacheable) {
+    const auto& op_name = schema.operator_name();
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cacheable = memoized_ops.count(op_name.name) != 0 ||
+        (!op_name.overload_name.empty() &&
+         memoized_ops.count(c10::toString(op_name)) != 0);
+  }
+
+  CacheKey key;
+  std::vector<weakref_type> input_refs;
+  if (cacheable) {
+    key.op = c10::toString(schema.operator_name());
+    size_t seed = c10::get_hash(key.op);
+    auto args = torch::jit::last(*stack, num_args);
+    for (const auto& arg : args) {
+      ArgKey ak;
+      if (arg.isTensor()) {
+        const auto& t = arg.toTensor();
+        ak.is_tensor = true;
+        ak.impl = t.unsafeGetTensorImpl();
+        if (t.defined()) {
+          if (t.is_inference() ||
+              (t.requires_grad() && GradMode::is_enabled())) {
+            cacheable = false;
+            break;
+          }
+          ak.version = ak.impl->version_counter().current_version();
+          input_refs.emplace_back(t.getIntrusivePtr());
+        }
+        seed = c10::hash_combine(seed, c10::get_hash(ak.impl, ak.version));
+      } else {
+        if (!append_value_hash(arg, seed)) {
+          cacheable = false;
+          break;
+        }
+        ak.value = arg;
+      }
+      key.args.push_back(std::move(ak));
+    }
+    key.hash = seed;
+  }
+
+  if (cacheable) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+      auto& entry = it->second;
+      bool valid = entry.output.unsafeGetTensorImpl()
+                       ->version_counter()
+                       .current_version() == entry.output_version;
+      for (const auto& ref : entry.input_refs) {
+        valid = valid && !ref.expired();
+      }
+      if (valid) {
+        Tensor output = entry.output;
+        cache_lru.splice(cache_lru.begin(), cache_lru, entry.lru_it);
+        torch::jit::drop(*stack, num_args);
+        torch::jit::push(*stack, std::move(output));
+        return;
+      }
+      // The cached output was mutated (or an input died); recompute.
+      erase_entry(it);
+    }
+  }
+
+  op.callBoxed(stack);
+
+  if (!cacheable) {
+    return;
+  }
+  const auto& ret = torch::jit::peek(*stack, 0, 1);
+  if (!ret.isTensor()) {
+    return;
+  }
+  const auto& output = ret.toTensor();
+  if (!output.defined() || output.is_inference() || output.requires_grad()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if (cache_max_entries == 0) {
+    return;
+  }
+  evict_until(cache_max_entries - 1);
+  CacheEntry entry;
+  entry.output = output;
+  entry.output_version =
+      output.unsafeGetTensorImpl()->version_counter().current_version();
+  entry.input_refs = std::move(input_refs);
+  auto emplaced = cache.emplace(std::move(key), std::move(entry));
+  if (emplaced.second) {
+    cache_lru.push_front(&emplaced.first->first);
+    emplaced.first->second.lru_it = cache_lru.begin();
+  }
+}
+
+} // namespace
+
+void add_memoized_op(const std::string& op_name) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  memoized_ops.insert(op_name);
+}
+
+void remove_memoized_op(const std::string& op_name) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  memoized_ops.erase(op_name);
+}
+
+void clear_cache() {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  cache.clear();
+  cache_lru.clear();
+}
+
+void set_cache_max_entries(size_t max_entries) {
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  cache_max_entries = max_entries;
+  evict_until(cache_max_entries);
+}
+
+TORCH_LIBRARY_IMPL(_, Memoize, m) {
+  m.fallback(torch::CppFunction::makeFromBoxedFunction<&memoize_fallback>());
+}
+
+} // namespace memoize
+} // namespace at
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+
+#include <cstddef>
+#include <string>
+
+namespace at {
+namespace memoize {
+
+TORCH_API bool is_enabled();
+TORCH_API void set_enabled(bool enabled);
+
+// The cache only serves ops that have been explicitly allowlisted (and whose
+// schema is pure; see Note [Memoize mode]).  `op_name` may name a specific
+// overload ("aten::mul.Tensor") or a base name ("aten::layer_norm"), which
+// covers all of its overloads.
+TORCH_API void add_memoized_op(const std::string& op_name);
+TORCH_API void remove_memoized_op(const std::string& op_name);
+
+TORCH_API void clear_cache();
+// Bounds the number of cached outputs; least recently used entries are
+// evicted first.  Lowering the bound below the current size evicts eagerly.
+TORCH_API void set_cache_max_entries(size_t max_entries);
+
+} // namespace memoize
+} // namespace at
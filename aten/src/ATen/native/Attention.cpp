@@ -0,0 +1,114 @@
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace at {
+namespace native {
+
+namespace {
+
+// Attention rows are independent of each other, so the query can be
+// processed in row chunks of this size; only a (..., chunk, S) block of
+// scores is ever materialized instead of the full (..., L, S) matrix.
+// This is exact, not an approximation.
+constexpr int64_t kQueryChunkSize = 1024;
+
+Tensor attention_chunk(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& attn_mask,
+    double dropout_p,
+    bool is_causal,
+    int64_t row_offset,
+    double scale_factor) {
+  auto attn = at::matmul(query, key.transpose(-2, -1)).mul_(scale_factor);
+  constexpr auto neg_inf = -std::numeric_limits<double>::infinity();
+  if (is_causal) {
+    // Row i of this chunk is global row (row_offset + i) and may attend to
+    // columns <= its global row index; tril with a diagonal offset encodes
+    // exactly that.
+    auto allowed = at::ones(
+        {query.size(-2), key.size(-2)}, query.options().dtype(at::kBool))
+        .tril(row_offset);
+    attn.masked_fill_(allowed.logical_not(), neg_inf);
+  } else if (attn_mask.defined()) {
+    if (attn_mask.scalar_type() == at::kBool) {
+      // Boolean masks mark positions that participate in attention.
+      attn.masked_fill_(attn_mask.logical_not(), neg_inf);
+    } else {
+      attn = attn + attn_mask;
+    }
+  }
+  attn = at::softmax(attn, -1);
+  if (dropout_p > 0.0) {
+    attn = at::dropout(attn, dropout_p, /*train=*/true);
+  }
+  return at::matmul(attn, value);
+}
+
+} // namespace
+
+Tensor _scaled_dot_product_attention(
+    const Tensor& query,
+    const Tensor& key,
+    const Tensor& value,
+    const c10::optional<Tensor>& attn_mask_opt,
+    double dropout_p,
+    bool is_causal,
+    c10::optional<double> scale) {
+  c10::MaybeOwned<Tensor> attn_mask_maybe_owned =
+      at::borrow_from_optional_tensor(attn_mask_opt);
+  const Tensor& attn_mask = *attn_mask_maybe_owned;
+
+  TORCH_CHECK(
+      query.dim() >= 2 && key.dim() == query.dim() &&
+          value.dim() == query.dim(),
+      "_scaled_dot_product_attention: expected query, key and value to have "
+      "the same number of dimensions (at least 2), got ",
+      query.dim(), ", ", key.dim(), " and ", value.dim());
+  TORCH_CHECK(
+      query.size(-1) == key.size(-1),
+      "_scaled_dot_product_attention: query and key must have the same head "
+      "dimension, got ", query.size(-1), " and ", key.size(-1));
+  TORCH_CHECK(
+      key.size(-2) == value.size(-2),
+      "_scaled_dot_product_attention: key and value must have the same "
+      "sequence length, got ", key.size(-2), " and ", value.size(-2));
+  TORCH_CHECK(
+      !(is_causal && attn_mask.defined()),
+      "_scaled_dot_product_attention: an explicit attn_mask cannot be "
+      "combined with is_causal=True");
+
+  const auto scale_factor = scale.has_value()
+      ? *scale
+      : 1.0 / std::sqrt(static_cast<double>(query.size(-1)));
+
+  const auto num_rows = query.size(-2);
+  if (num_rows <= kQueryChunkSize) {
+    return attention_chunk(
+        query, key, value, attn_mask, dropout_p, is_causal, 0, scale_factor);
+  }
+
+  std::vector<Tensor> chunks;
+  chunks.reserve((num_rows + kQueryChunkSize - 1) / kQueryChunkSize);
+  for (int64_t start = 0; start < num_rows; start += kQueryChunkSize) {
+    const auto rows = std::min(kQueryChunkSize, num_rows - start);
+    auto query_chunk = query.narrow(-2, start, rows);
+    auto mask_chunk = attn_mask;
+    if (attn_mask.defined() && attn_mask.dim() >= 2 &&
+        attn_mask.size(-2) == num_rows) {
+      mask_chunk = attn_mask.narrow(-2, start, rows);
+    }
+    chunks.push_back(attention_chunk(
+        query_chunk, key, value, mask_chunk, dropout_p, is_causal, start,
+        scale_factor));
+  }
+  return at::cat(chunks, -2);
+}
+
+} // namespace native
+} // namespace at
@@ -1,5 +1,4 @@
 #include <ATen/ATen.h>
-#include <ATen/CPUApplyUtils.h>
 #include <ATen/Dispatch.h>
 #include <ATen/TensorMeta.h>
 #include <ATen/NativeFunctions.h>
@@ -214,7 +213,7 @@ TORCH_META_FUNC(triangular_solve)(const Tensor& self, const Tensor& A, bool uppe
 
   at::native::linearSolveCheckInputs(self, A, "triangular_solve");
 
-  std::vector<int64_t> self_broadcast_size, A_broadcast_size;
+  at::DimVector self_broadcast_size, A_broadcast_size;
   std::tie(self_broadcast_size, A_broadcast_size) = at::native::_linalg_broadcast_batch_dims(self, A);
 
   auto ndim = self_broadcast_size.size();
@@ -3216,7 +3215,7 @@ static void linalg_lstsq_out_info(
 
   TORCH_INTERNAL_ASSERT(input.size(-2) == other_2d.size(-2));
 
-  std::vector<int64_t> expected_solution_shape = broadcast_batch_size(input, other_2d, input.dim() - 2);
+  DimVector expected_solution_shape = broadcast_batch_size(input, other_2d, input.dim() - 2);
   // the actual shape of the solution returned is (*, n,) or (*, n, nrhs)
   // but LAPACK requires extra dimensions to store raw residuals
   // so the expected shape is (*, max(m, n),) or (*, max(m, n), nrhs)
@@ -3437,7 +3436,7 @@ std::tuple<Tensor&, Tensor&, Tensor&, Tensor&> linalg_lstsq_out(
   // 3. the tensor is contiguous
 
   // Checks for the 'solution' tensor
-  std::vector<int64_t> expected_solution_shape = broadcast_batch_size(input, other_2d, input.dim() - 2);
+  DimVector expected_solution_shape = broadcast_batch_size(input, other_2d, input.dim() - 2);
   // the actual shape of the shape of the solution returned in (*, n,) or (*, n, nrhs)
   // but LAPACK requires extra dimensions so the expected shape is (*, max(m, n),) or (*, max(m, n), nrhs)
   expected_solution_shape.push_back(std::max(input.size(-1), input.size(-2)));
@@ -10,6 +10,110 @@
 namespace at { namespace native {
 
 namespace {
+
+// Note [Batched small-matrix factorizations]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Workloads such as Kalman filters factor very large batches of very small
+// matrices, where a serial loop over one-matrix LAPACK calls runs on a single
+// core and the per-call LAPACK overhead rivals the factorization itself. Two
+// things help here:
+//   1. the batch loop is spread over threads with at::parallel_for, with a
+//      grain size derived from the per-matrix flop count (LAPACK libraries
+//      detect being invoked from inside a parallel region and run the
+//      individual call sequentially, so this does not oversubscribe);
+//   2. matrices with dim <= kUnblockedMaxDim bypass LAPACK entirely and use
+//      the unblocked reference algorithms below (the counterparts of xPOTF2
+//      and xGETF2), for which a blocked routine has no advantage anyway.
+constexpr int64_t kUnblockedMaxDim = 32;
+
+// Grain size for parallelizing a batch of factorizations whose cost is
+// roughly `work` flops each.
+inline int64_t batch_grain_size(int64_t work) {
+  return std::max<int64_t>(1, at::internal::GRAIN_SIZE / std::max<int64_t>(1, work));
+}
+
+/*
+  Unblocked in-place Cholesky factorization (lower triangular) of a single
+  column-major n-by-n matrix, following LAPACK's xPOTF2. Only the lower
+  triangle is read and written. Returns 0 on success, or the 1-based index of
+  the first non-positive-definite leading minor, matching the LAPACK info
+  convention.
+*/
+template <typename scalar_t>
+int cholesky_lower_unblocked(scalar_t* a, int64_t n, int64_t lda) {
+  using value_t = typename c10::scalar_value_type<scalar_t>::type;
+  for (const auto j : c10::irange(n)) {
+    value_t diag = real_impl<scalar_t, value_t>(a[j * lda + j]);
+    for (const auto k : c10::irange(j)) {
+      const scalar_t a_jk = a[k * lda + j];
+      diag -= real_impl<scalar_t, value_t>(a_jk * conj_impl(a_jk));
+    }
+    // The negated comparison also catches NaN, as xPOTF2 does explicitly.
+    if (!(diag > value_t(0))) {
+      a[j * lda + j] = scalar_t(diag);
+      return j + 1;
+    }
+    const value_t d = std::sqrt(diag);
+    const value_t inv_d = value_t(1) / d;
+    a[j * lda + j] = scalar_t(d);
+    for (int64_t i = j + 1; i < n; i++) {
+      scalar_t v = a[j * lda + i];
+      for (const auto k : c10::irange(j)) {
+        v -= a[k * lda + i] * conj_impl(a[k * lda + j]);
+      }
+      a[j * lda + i] = v * inv_d;
+    }
+  }
+  return 0;
+}
+
+/*
+  Unblocked in-place LU factorization with partial pivoting of a single
+  column-major m-by-n matrix, following LAPACK's xGETF2. `pivots` receives
+  1-based pivot indices. Returns 0, or the 1-based index of the first zero
+  pivot (the factorization still completes, as in LAPACK).
+*/
+template <typename scalar_t>
+int lu_unblocked(scalar_t* a, int64_t m, int64_t n, int64_t lda, int* pivots) {
+  using value_t = typename c10::scalar_value_type<scalar_t>::type;
+  int info = 0;
+  const int64_t k_max = std::min(m, n);
+  for (const auto j : c10::irange(k_max)) {
+    // Find the pivot: the largest absolute value on or below the diagonal.
+    int64_t p = j;
+    value_t max_val = std::abs(a[j * lda + j]);
+    for (int64_t i = j + 1; i < m; i++) {
+      const value_t v = std::abs(a[j * lda + i]);
+      if (v > max_val) {
+        max_val = v;
+        p = i;
+      }
+    }
+    pivots[j] = p + 1;
+    if (a[j * lda + p] != scalar_t(0)) {
+      if (p != j) {
+        for (const auto k : c10::irange(n)) {
+          std::swap(a[k * lda + j], a[k * lda + p]);
+        }
+      }
+      const scalar_t pivot = a[j * lda + j];
+      for (int64_t i = j + 1; i < m; i++) {
+        a[j * lda + i] = a[j * lda + i] / pivot;
+      }
+    } else if (info == 0) {
+      info = j + 1;
+    }
+    // Rank-1 update of the trailing submatrix.
+    for (int64_t k = j + 1; k < n; k++) {
+      const scalar_t a_jk = a[k * lda + j];
+      for (int64_t i = j + 1; i < m; i++) {
+        a[k * lda + i] -= a[j * lda + i] * a_jk;
+      }
+    }
+  }
+  return info;
+}
+
 /*
   Computes the Cholesky decomposition of matrices stored in `input`.
   This is an in-place routine and the content of 'input' is overwritten with the result.
@@ -39,11 +143,22 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
   auto n = input.size(-2);
   auto lda = std::max<int64_t>(1, n);
 
-  for (const auto i : c10::irange(batch_size)) {
-    scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
-    int* info_working_ptr = &info_data[i];
-    lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
-  }
+  // See Note [Batched small-matrix factorizations]. The unblocked kernel only
+  // implements the (default) lower-triangular variant; the rare upper case
+  // stays on LAPACK.
+  const bool use_unblocked = !upper && n <= kUnblockedMaxDim;
+  at::parallel_for(
+      0, batch_size, batch_grain_size(n * n * n), [&](int64_t start, int64_t end) {
+        for (const auto i : c10::irange(start, end)) {
+          scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
+          int* info_working_ptr = &info_data[i];
+          if (use_unblocked) {
+            *info_working_ptr = cholesky_lower_unblocked(input_working_ptr, n, lda);
+          } else {
+            lapackCholesky<scalar_t>(uplo, n, input_working_ptr, lda, info_working_ptr);
+          }
+        }
+      });
 #endif
 }
 
@@ -865,12 +980,22 @@ void apply_lu(const Tensor& input, const Tensor& pivots, const Tensor& infos, bo
   auto n = input.size(-1);
   auto leading_dimension = std::max<int64_t>(1, m);
 
-  for (const auto i : c10::irange(batch_size)) {
-    scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
-    int* pivots_working_ptr = &pivots_data[i * pivots_stride];
-    int* infos_working_ptr = &infos_data[i];
-    lapackLu<scalar_t>(m, n, input_working_ptr, leading_dimension, pivots_working_ptr, infos_working_ptr);
-  }
+  // See Note [Batched small-matrix factorizations]
+  const bool use_unblocked = std::max(m, n) <= kUnblockedMaxDim;
+  at::parallel_for(
+      0, batch_size, batch_grain_size(m * n * std::min(m, n)), [&](int64_t start, int64_t end) {
+        for (const auto i : c10::irange(start, end)) {
+          scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
+          int* pivots_working_ptr = &pivots_data[i * pivots_stride];
+          int* infos_working_ptr = &infos_data[i];
+          if (use_unblocked) {
+            *infos_working_ptr = lu_unblocked(
+                input_working_ptr, m, n, leading_dimension, pivots_working_ptr);
+          } else {
+            lapackLu<scalar_t>(m, n, input_working_ptr, leading_dimension, pivots_working_ptr, infos_working_ptr);
+          }
+        }
+      });
 #endif
 }
 
@@ -3,6 +3,9 @@
 #include <ATen/native/BucketizationUtils.h>
 #include <ATen/native/Resize.h>
 #include <c10/util/irange.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <vector>
 
 /* Implement a TF like searchsorted and a bucketize function running on cpu
  *
@@ -29,22 +32,104 @@ namespace {
 // minimal size for searchsorted_cpu_contiguous to run parallel (multithread)
 constexpr int64_t SEARCHSORTED_GRAIN_SIZE = 200;
 
-// customized lower_bound func to ensure the low bound of 'nan', 'inf' etc. be the end of boundary
-// std::lower_bound can not be used here since its customized comparator need strict weak ordering
-template<typename input_t>
-const input_t* cus_lower_bound(const input_t* start, const input_t* end, input_t val) {
-  while (start < end) {
-    const input_t* mid = start + ((end - start) >> 1);
-    if (!(*mid >= val)) {
-      start = mid + 1;
-    }
-    else {
-      end = mid;
-    }
+// Note [Branchless bucketization]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// For random search values every comparison in a binary search is a coin
+// flip, so a branching loop mispredicts on about half its steps and the
+// pipeline restarts serialize the billions of lookups a feature bucketizer
+// performs. Two remedies are used below:
+//
+// 1. The searches are branchless: each step narrows [base, base + len] with
+//    a conditional move instead of a taken/not-taken branch, so the only
+//    unpredictable dependency left is the load of the probed boundary.
+//
+// 2. For the common bucketize shape - one shared 1d boundary array probed by
+//    many values - the boundaries are additionally repacked per call into
+//    Eytzinger (BFS) order. A descent then walks node k to 2k or 2k + 1, so
+//    the top levels of the tree share a handful of cache lines that stay
+//    L1-resident across lookups instead of being strided powers-of-two
+//    apart. The repack costs one O(#boundaries) pass and is only taken when
+//    there are enough values to amortize it.
+//
+// The comparison expressions mirror the customized lower bound (and
+// std::upper_bound) exactly, including their treatment of 'nan'/'inf'
+// values: std::lower_bound cannot be used since its customized comparator
+// would need strict weak ordering.
+template<bool right, typename input_t>
+inline bool search_advances_past(const input_t& elem, const input_t& val) {
+  // Lower bound keeps elements with elem >= val; upper bound keeps elements
+  // with val < elem.
+  return right ? !(val < elem) : !(elem >= val);
+}
+
+template<bool right, typename input_t>
+int64_t branchless_search(const input_t* bd, int64_t n, input_t val) {
+  const input_t* base = bd;
+  int64_t len = n;
+  while (len > 1) {
+    int64_t half = len >> 1;
+    // Compiles to a conditional move; the answer lies strictly past
+    // base[half - 1] iff the search advances past it.
+    base += search_advances_past<right>(base[half - 1], val) ? half : 0;
+    len -= half;
+  }
+  int64_t pos = base - bd;
+  if (n > 0 && search_advances_past<right>(base[0], val)) {
+    pos += 1;
+  }
+  return pos;
+}
+
+// Shared 1d boundaries repacked in BFS order: node k (1-indexed) has
+// children 2k and 2k + 1, and ranks maps each node back to its index in the
+// sorted array. layout[0] is unused.
+template <typename input_t>
+struct EytzingerPlan {
+  std::vector<input_t> layout;
+  std::vector<int64_t> ranks;
+};
+
+template <typename input_t>
+void eytzinger_fill(const input_t* bd, EytzingerPlan<input_t>& plan, int64_t n, int64_t k, int64_t& i) {
+  if (k > n) {
+    return;
   }
-  return start;
+  eytzinger_fill(bd, plan, n, 2 * k, i);
+  plan.layout[k] = bd[i];
+  plan.ranks[k] = i++;
+  eytzinger_fill(bd, plan, n, 2 * k + 1, i);
 }
 
+template <typename input_t>
+EytzingerPlan<input_t> make_eytzinger_plan(const input_t* bd, int64_t n) {
+  EytzingerPlan<input_t> plan;
+  plan.layout.resize(n + 1);
+  plan.ranks.resize(n + 1);
+  int64_t i = 0;
+  eytzinger_fill(bd, plan, n, 1, i);
+  return plan;
+}
+
+template <bool right, typename input_t>
+int64_t eytzinger_search(const EytzingerPlan<input_t>& plan, int64_t n, input_t val) {
+  const input_t* layout = plan.layout.data();
+  uint64_t k = 1;
+  while (static_cast<int64_t>(k) <= n) {
+    k = 2 * k + search_advances_past<right>(layout[k], val);
+  }
+  // The turn bits of the descent now trail k. Cancelling the trailing right
+  // turns (and the final left turn's zero bit) leaves the last node the
+  // search went left at, which holds the answer; if the search only ever
+  // went right, no element keeps the value and the result is the end.
+  k >>= c10::llvm::countTrailingOnes(k) + 1;
+  return k == 0 ? n : plan.ranks[k];
+}
+
+// Eytzinger repacking pays off once the boundary array outgrows the
+// hardware's fast levels for strided access and there are enough lookups to
+// amortize the O(n) build.
+constexpr int64_t EYTZINGER_MIN_BOUNDARIES = 64;
+
 template<typename input_t, typename output_t>
 void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tensor& boundaries, const bool& right) {
   int64_t numel_in = input.numel();
@@ -58,15 +143,29 @@ void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tens
   output_t *data_out = result.data_ptr<output_t>();
 
   bool is_1d_boundaries = boundaries.dim() == 1;
+  if (is_1d_boundaries && idim_bd >= EYTZINGER_MIN_BOUNDARIES &&
+      numel_in >= idim_bd) {
+    // See Note [Branchless bucketization]
+    const auto plan = make_eytzinger_plan(data_bd, idim_bd);
+    at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+      for (const auto i : c10::irange(start, end)) {
+        data_out[i] = right ?
+          eytzinger_search<true>(plan, idim_bd, data_in[i]) :
+          eytzinger_search<false>(plan, idim_bd, data_in[i]);
+      }
+    });
+    return;
+  }
+
   at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
     for (const auto i : c10::irange(start, end)) {
       // If boundaries tensor is 1d, we always search the entire boundary tensor
       int64_t start_bd = is_1d_boundaries ? 0 : i / idim_in * idim_bd;
       const input_t *data_bd_start = &data_bd[start_bd];
 
-      int64_t pos = !right ?
-        cus_lower_bound(data_bd_start, data_bd_start + idim_bd, data_in[i]) - data_bd_start :
-        std::upper_bound(data_bd_start, data_bd_start + idim_bd, data_in[i]) - data_bd_start;
+      int64_t pos = right ?
+        branchless_search<true>(data_bd_start, idim_bd, data_in[i]) :
+        branchless_search<false>(data_bd_start, idim_bd, data_in[i]);
 
       // type conversion might happen here
       data_out[i] = pos;
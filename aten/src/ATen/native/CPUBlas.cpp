@@ -4,8 +4,11 @@
 
 #include <c10/util/SmallBuffer.h>
 #include <c10/util/C++17.h>
+#include <c10/util/irange.h>
 
+#include <algorithm>
 #include <climits>
+#include <cmath>
 
 #if AT_BUILD_WITH_BLAS()
 extern "C" void dgemm_(char *transa, char *transb, int *m, int *n, int *k, double *alpha, const double *a, int *lda, const double *b, int *ldb, double *beta, double *c, int *ldc);
@@ -152,6 +155,68 @@ void gemm(
       transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
 
+namespace {
+
+void apply_gemm_epilogue(
+    int64_t m, int64_t n,
+    const float *bias,
+    GemmEpilogue epilogue,
+    float *c, int64_t ldc) {
+  for (const auto j : c10::irange(n)) {
+    float* column = c + j * ldc;
+    if (bias != nullptr) {
+      for (const auto i : c10::irange(m)) {
+        column[i] += bias[i];
+      }
+    }
+    switch (epilogue) {
+      case GemmEpilogue::None:
+        break;
+      case GemmEpilogue::ReLU:
+        for (const auto i : c10::irange(m)) {
+          column[i] = std::max(column[i], 0.f);
+        }
+        break;
+      case GemmEpilogue::GELU:
+        for (const auto i : c10::irange(m)) {
+          // Exact GELU, matching at::gelu on CPU. 0.70710678f is 1/sqrt(2).
+          column[i] =
+              column[i] * 0.5f * (1.f + std::erf(column[i] * 0.70710678f));
+        }
+        break;
+    }
+  }
+}
+
+} // namespace
+
+void gemm_with_epilogue(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    const float alpha,
+    const float *a, int64_t lda,
+    const float *b, int64_t ldb,
+    const float *bias,
+    GemmEpilogue epilogue,
+    float *c, int64_t ldc) {
+  // Aim for one block of C around 256 KiB so the epilogue re-reads it from
+  // L2, while keeping blocks wide enough for the BLAS call to parallelize.
+  constexpr int64_t kTargetBlockElements = 256 * 1024 / sizeof(float);
+  const int64_t block_cols = std::max<int64_t>(
+      64, kTargetBlockElements / std::max<int64_t>(m, 1));
+  for (int64_t begin = 0; begin < n; begin += block_cols) {
+    const int64_t cols = std::min(block_cols, n - begin);
+    // Columns of C correspond to columns of op(B), i.e. columns of B when it
+    // is not transposed and rows of B otherwise.
+    const float* b_block = (transb == TransposeType::NoTranspose)
+        ? b + begin * ldb
+        : b + begin;
+    float* c_block = c + begin * ldc;
+    gemm(transa, transb, m, cols, k, alpha, a, lda, b_block, ldb, 0.f, c_block, ldc);
+    apply_gemm_epilogue(m, cols, bias, epilogue, c_block, ldc);
+  }
+}
+
 void gemm(
     TransposeType transa, TransposeType transb,
     int64_t m, int64_t n, int64_t k,
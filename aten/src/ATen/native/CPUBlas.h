@@ -62,6 +62,32 @@ void gemm(
     float beta,
     float *c, int64_t ldc);
 
+// Activation applied by gemm_with_epilogue while the output block is still
+// cache-resident.
+enum class GemmEpilogue {
+  None,
+  ReLU,
+  GELU,
+};
+
+// Single-precision gemm with a fused epilogue:
+//   C = act(alpha * op(A) op(B) + bias)
+// where `bias` (if non-null) has length m and is broadcast-added to every
+// column of C, and `act` is given by `epilogue`. The product is computed in
+// column blocks and the epilogue runs on each block right after it is
+// produced, while it is still in cache, instead of re-reading the whole
+// output in separate bias/activation sweeps afterwards. C is overwritten
+// (beta == 0).
+void gemm_with_epilogue(
+    TransposeType transa, TransposeType transb,
+    int64_t m, int64_t n, int64_t k,
+    float alpha,
+    const float *a, int64_t lda,
+    const float *b, int64_t ldb,
+    const float *bias,
+    GemmEpilogue epilogue,
+    float *c, int64_t ldc);
+
 void gemm(
     TransposeType transa, TransposeType transb,
     int64_t m, int64_t n, int64_t k,
@@ -1,9 +1,74 @@
 #include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 
 #include <c10/util/irange.h>
 
+#include <cstring>
+#include <vector>
+
 namespace at { namespace native {
 
+namespace {
+
+// Executes a non-negative constant pad over contiguous CPU tensors as one
+// contiguous memcpy per input row plus fill spans for the padding, so every
+// output element is written exactly once. The generic path below fills the
+// whole output and then rewrites the interior through a strided copy_, which
+// costs an extra full pass over the output.
+template <typename scalar_t>
+void constant_pad_nd_cpu_contiguous(
+    scalar_t* out_p,
+    const scalar_t* in_p,
+    IntArrayRef out_sizes,
+    IntArrayRef in_sizes,
+    IntArrayRef pad_before,
+    scalar_t value) {
+  const int64_t dim = out_sizes.size();
+  const int64_t out_row = out_sizes[dim - 1];
+  const int64_t in_row = in_sizes[dim - 1];
+  const int64_t left = pad_before[dim - 1];
+  const int64_t right = out_row - left - in_row;
+
+  int64_t out_rows = 1;
+  std::vector<int64_t> in_row_strides(std::max<int64_t>(dim - 1, 1), 1);
+  for (int64_t d = dim - 2; d >= 0; d--) {
+    out_rows *= out_sizes[d];
+    in_row_strides[d] = d == dim - 2 ? 1 : in_row_strides[d + 1] * in_sizes[d + 1];
+  }
+
+  at::parallel_for(0, out_rows,
+      std::max<int64_t>(1, at::internal::GRAIN_SIZE / out_row),
+      [&](int64_t begin, int64_t end) {
+    for (const auto r : c10::irange(begin, end)) {
+      scalar_t* out_row_p = out_p + r * out_row;
+      // Decode the row index and map it into the input, if it lands there.
+      int64_t in_row_index = 0;
+      bool inside = true;
+      int64_t rest = r;
+      for (int64_t d = dim - 2; d >= 0; d--) {
+        const int64_t in_idx = rest % out_sizes[d] - pad_before[d];
+        rest /= out_sizes[d];
+        if (in_idx < 0 || in_idx >= in_sizes[d]) {
+          inside = false;
+          break;
+        }
+        in_row_index += in_idx * in_row_strides[d];
+      }
+      if (inside) {
+        std::fill_n(out_row_p, left, value);
+        std::memcpy(out_row_p + left, in_p + in_row_index * in_row,
+            in_row * sizeof(scalar_t));
+        std::fill_n(out_row_p + left + in_row, right, value);
+      } else {
+        std::fill_n(out_row_p, out_row, value);
+      }
+    }
+  });
+}
+
+} // namespace
+
 Tensor constant_pad_nd(const Tensor& self, IntArrayRef pad, const Scalar& value) {
     TORCH_CHECK(pad.size() % 2 == 0, "Length of pad must be even but instead it equals ",
              pad.size());
@@ -20,17 +85,20 @@ Tensor constant_pad_nd(const Tensor& self, IntArrayRef pad, const Scalar& value)
     std::vector<int64_t> new_shape;
 
     bool all_pads_non_positive = true;
+    bool has_negative_pads = false;
 
     auto c_input = self;
     for (const auto i : c10::irange(l_diff, l_inp)) {
         auto pad_idx = 2 * (l_inp - i - 1);
         if (pad[pad_idx] < 0) {
             c_input = c_input.narrow(i, -pad[pad_idx], c_input.size(i) + pad[pad_idx]);
+            has_negative_pads = true;
         } else if (pad[pad_idx] != 0) {
             all_pads_non_positive = false;
         }
         if (pad[pad_idx + 1] < 0) {
             c_input = c_input.narrow(i, 0, c_input.size(i) + pad[pad_idx + 1]);
+            has_negative_pads = true;
         } else if (pad[pad_idx + 1] != 0) {
             all_pads_non_positive = false;
         }
@@ -56,6 +124,29 @@ Tensor constant_pad_nd(const Tensor& self, IntArrayRef pad, const Scalar& value)
         new_shape.emplace_back(new_dim);
     }
 
+    // Contiguous CPU tensors take the single-pass row-copy path above.
+    // Negative pads make c_input a view with gaps, so those stay on the
+    // generic path.
+    if (self.device().is_cpu() && !self.is_quantized() && !has_negative_pads &&
+        self.is_contiguous() && !self.is_conj() && !self.is_neg()) {
+        std::vector<int64_t> pad_before(l_inp, 0);
+        for (const auto i : c10::irange(l_diff, l_inp)) {
+            pad_before[i] = pad[2 * (l_inp - i - 1)];
+        }
+        Tensor result = at::empty(new_shape, self.options());
+        AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(kBool, kHalf, kBFloat16,
+            self.scalar_type(), "constant_pad_nd_cpu", [&] {
+            constant_pad_nd_cpu_contiguous<scalar_t>(
+                result.data_ptr<scalar_t>(),
+                self.data_ptr<scalar_t>(),
+                result.sizes(),
+                self.sizes(),
+                pad_before,
+                value.to<scalar_t>());
+        });
+        return result;
+    }
+
     at::Tensor output;
     const auto memory_format = self.suggest_memory_format();
     if (self.is_quantized()) {
@@ -12,7 +12,17 @@
 #include <ATen/Config.h>
 #include <c10/macros/Macros.h>
 
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #if AT_NNPACK_ENABLED()
 #include <nnpack.h>
@@ -24,6 +34,7 @@ constexpr int MIOPEN_DIM_MAX = 5;
 namespace at { namespace native {
 
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+DEFINE_DISPATCH(convolution_depthwise_nhwc_stub);
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 struct ConvParams {
@@ -47,6 +58,7 @@ struct ConvParams {
   bool is_stride_nonpos() const;
   void view1d_as_2d();
   bool use_cpu_depthwise3x3_winograd(const at::Tensor& input, const at::Tensor& weight, const at::Tensor& bias) const;
+  bool use_cpu_depthwise_nhwc(const at::Tensor& input, const at::Tensor& weight, const at::Tensor& bias) const;
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn_depthwise(const at::Tensor& input, const at::Tensor& weight) const;
@@ -173,6 +185,33 @@ auto ConvParams::use_cpu_depthwise3x3_winograd(
 #endif
 }
 
+auto ConvParams::use_cpu_depthwise_nhwc(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const at::Tensor& bias) const -> bool {
+  // Direct channels_last depthwise kernel (see DepthwiseConvKernel.cpp):
+  // float only, channel multiplier 1, arbitrary kernel size, stride, padding
+  // and dilation, inference only. NCHW inputs keep their existing paths.
+  return (input.ndimension() == 4) &&
+         (input.device().is_cpu()) &&
+         (input.scalar_type() == at::kFloat) &&
+         (input.suggest_memory_format() == at::MemoryFormat::ChannelsLast) &&
+         (weight.ndimension() == 4) &&
+         (weight.device().is_cpu()) &&
+         (weight.scalar_type() == at::kFloat) &&
+         (groups == input.size(1)) &&
+         (weight.size(0) == input.size(1)) &&
+         (weight.size(1) == 1) &&
+         (!bias.defined() ||
+            ((bias.device().is_cpu()) &&
+             (bias.scalar_type() == at::kFloat))) &&
+         !(GradMode::is_enabled() &&
+                 (input.requires_grad() ||
+                  weight.requires_grad() ||
+                 (bias.defined() && bias.requires_grad()))) &&
+         !transposed;
+}
+
 auto ConvParams::needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const -> bool {
   constexpr int64_t int_max = std::numeric_limits<int>::max();
   int64_t numel_input = input.numel();
@@ -615,6 +654,135 @@ static at::Tensor subtensor(at::Tensor& tensor, int dim, int groups, int g) {
   return tensor.narrow(dim, n * g, n).contiguous();
 }
 
+namespace {
+
+// Note [CPU convolution backend auto-tuning]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The CPU part of the backend chain in _convolution picks among
+// mkldnn/xnnpack/the depthwise kernels/the generic im2col path with static
+// heuristics, which can be off by integer factors for particular shapes.
+// With TORCH_CONV_CPU_AUTOTUNE=1, the first call for a given
+// (shapes, conv params, dtype, layout) key instead runs every applicable
+// backend once, keeps the fastest result, and records the winner so that
+// later calls with the same key dispatch directly — the same philosophy as
+// cuDNN benchmark mode. Every candidate computes the same convolution, so
+// the measurement pass wastes no work beyond the losing candidates.
+// Decisions can persist across processes: if TORCH_CONV_CPU_AUTOTUNE_CACHE
+// names a file, each recorded decision is appended to it and the file is
+// loaded back on first use. A persisted winner whose backend is not
+// applicable in the current process (e.g. a build without mkldnn) is
+// ignored and the key is re-measured.
+bool convAutotuneEnabled() {
+  static const bool enabled = []() {
+    const auto* env = std::getenv("TORCH_CONV_CPU_AUTOTUNE");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+// Candidate identifiers. The numeric values appear in the on-disk cache, so
+// they must stay stable.
+enum class CpuConvBackend : int64_t {
+  Mkldnn = 0,
+  Xnnpack = 1,
+  DepthwiseNhwc = 2,
+  Winograd3x3 = 3,
+  Generic = 4,
+};
+
+std::vector<int64_t> conv_autotune_key(
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const ConvParams& params) {
+  std::vector<int64_t> key;
+  key.reserve(
+      input.dim() + weight.dim() + params.stride.size() +
+      params.padding.size() + params.dilation.size() + 3);
+  key.push_back(static_cast<int64_t>(input.scalar_type()));
+  key.push_back(static_cast<int64_t>(input.suggest_memory_format()));
+  key.push_back(params.groups);
+  key.insert(key.end(), input.sizes().begin(), input.sizes().end());
+  key.insert(key.end(), weight.sizes().begin(), weight.sizes().end());
+  key.insert(key.end(), params.stride.begin(), params.stride.end());
+  key.insert(key.end(), params.padding.begin(), params.padding.end());
+  key.insert(key.end(), params.dilation.begin(), params.dilation.end());
+  return key;
+}
+
+struct ConvAutotuneKeyHash {
+  size_t operator()(const std::vector<int64_t>& key) const {
+    size_t h = 0xcbf29ce484222325ULL;
+    for (const auto v : key) {
+      h = (h ^ static_cast<size_t>(v)) * 0x100000001b3ULL;
+    }
+    return h;
+  }
+};
+
+class ConvAutotuneCache {
+ public:
+  static ConvAutotuneCache& instance() {
+    static ConvAutotuneCache cache;
+    return cache;
+  }
+
+  c10::optional<int64_t> find(const std::vector<int64_t>& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = decisions_.find(key);
+    if (it == decisions_.end()) {
+      return c10::nullopt;
+    }
+    return it->second;
+  }
+
+  void insert(const std::vector<int64_t>& key, int64_t backend) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!decisions_.emplace(key, backend).second) {
+      return;
+    }
+    const auto* path = std::getenv("TORCH_CONV_CPU_AUTOTUNE_CACHE");
+    if (path != nullptr) {
+      std::ofstream out(path, std::ios::app);
+      out << backend;
+      for (const auto v : key) {
+        out << ' ' << v;
+      }
+      out << '\n';
+    }
+  }
+
+ private:
+  ConvAutotuneCache() {
+    const auto* path = std::getenv("TORCH_CONV_CPU_AUTOTUNE_CACHE");
+    if (path == nullptr) {
+      return;
+    }
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream ss(line);
+      int64_t backend = -1;
+      if (!(ss >> backend)) {
+        continue;
+      }
+      std::vector<int64_t> key;
+      int64_t v = 0;
+      while (ss >> v) {
+        key.push_back(v);
+      }
+      if (!key.empty()) {
+        decisions_.emplace(std::move(key), backend);
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::vector<int64_t>, int64_t, ConvAutotuneKeyHash>
+      decisions_;
+};
+
+} // namespace
+
 
 at::Tensor conv1d(
     const Tensor& input, const Tensor& weight, const c10::optional<Tensor>& bias_opt,
@@ -905,7 +1073,95 @@ at::Tensor _convolution(
   }
 
   Tensor output;
-  if (params.is_depthwise(input, weight)) {
+  // See Note [CPU convolution backend auto-tuning]
+  if (convAutotuneEnabled() && input.device().is_cpu() && !input_is_mkldnn &&
+      !params.transposed && input.ndimension() == 4 &&
+      !(GradMode::is_enabled() &&
+        (input.requires_grad() || weight.requires_grad() ||
+         (bias.defined() && bias.requires_grad())))) {
+    std::vector<std::pair<CpuConvBackend, std::function<Tensor()>>> candidates;
+#if AT_MKLDNN_ENABLED()
+    if (params.use_mkldnn(input, weight)) {
+      candidates.emplace_back(CpuConvBackend::Mkldnn, [&]() -> Tensor {
+        return at::mkldnn_convolution(
+            input.contiguous(), weight.contiguous(),
+            bias.defined() ? bias.contiguous() : bias,
+            params.padding, params.stride, params.dilation, params.groups);
+      });
+    }
+#endif
+    if (params.use_xnnpack(input, weight, bias)) {
+      candidates.emplace_back(CpuConvBackend::Xnnpack, [&]() -> Tensor {
+        return xnnpack::convolution2d(
+            input, weight, bias,
+            params.padding, params.stride, params.dilation, params.groups);
+      });
+    }
+    if (params.use_cpu_depthwise_nhwc(input, weight, bias)) {
+      candidates.emplace_back(CpuConvBackend::DepthwiseNhwc, [&]() -> Tensor {
+        return convolution_depthwise_nhwc_stub(
+            input.device().type(), input, weight, bias,
+            params.stride, params.padding, params.dilation);
+      });
+    }
+    if (params.use_cpu_depthwise3x3_winograd(input, weight, bias)) {
+      candidates.emplace_back(CpuConvBackend::Winograd3x3, [&]() -> Tensor {
+        return convolution_depthwise3x3_winograd_stub(
+            input.device().type(), input, weight, bias,
+            params.stride, params.padding, params.groups);
+      });
+    }
+    // The generic path is always applicable and doubles as the baseline.
+    candidates.emplace_back(CpuConvBackend::Generic, [&]() -> Tensor {
+      Tensor input_contig = input.contiguous();
+      if (params.groups == 1) {
+        return at::_convolution_nogroup(
+            input_contig, weight, bias, params.stride, params.padding,
+            params.dilation, params.transposed, params.output_padding);
+      }
+      std::vector<Tensor> outputs(params.groups);
+      for (const auto g : c10::irange(params.groups)) {
+        auto input_g = subtensor(input_contig, 1, params.groups, g);
+        auto weight_g = subtensor(weight, 0, params.groups, g);
+        auto bias_g = subtensor(bias, 0, params.groups, g);
+        outputs[g] = at::_convolution_nogroup(
+            input_g, weight_g, bias_g, params.stride, params.padding,
+            params.dilation, params.transposed, params.output_padding);
+      }
+      return at::cat(outputs, 1);
+    });
+
+    const auto key = conv_autotune_key(input, weight, params);
+    auto& cache = ConvAutotuneCache::instance();
+    bool handled = false;
+    if (auto cached = cache.find(key)) {
+      for (auto& candidate : candidates) {
+        if (static_cast<int64_t>(candidate.first) == *cached) {
+          output = candidate.second();
+          handled = true;
+          break;
+        }
+      }
+      // A persisted winner that is not applicable here falls through and
+      // gets re-measured.
+    }
+    if (!handled) {
+      auto best = CpuConvBackend::Generic;
+      double best_time = std::numeric_limits<double>::infinity();
+      for (auto& candidate : candidates) {
+        const auto start = std::chrono::steady_clock::now();
+        Tensor result = candidate.second();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best_time) {
+          best_time = elapsed.count();
+          best = candidate.first;
+          output = std::move(result);
+        }
+      }
+      cache.insert(key, static_cast<int64_t>(best));
+    }
+  } else if (params.is_depthwise(input, weight)) {
       /* output.resize_(output_size(input, weight)); */
 
       auto kernel_size = weight.sizes().slice(2);
@@ -1003,6 +1259,15 @@ at::Tensor _convolution(
         params.stride,
         params.dilation,
         params.groups);
+  } else if (params.use_cpu_depthwise_nhwc(input, weight, bias)) {
+    output = convolution_depthwise_nhwc_stub(
+        input.device().type(),
+        input,
+        weight,
+        bias,
+        params.stride,
+        params.padding,
+        params.dilation);
   } else if (params.use_cpu_depthwise3x3_winograd(input, weight, bias)) {
     output = convolution_depthwise3x3_winograd_stub(
         input.device().type(),
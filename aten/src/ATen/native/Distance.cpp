@@ -81,20 +81,20 @@ static Tensor cdist_impl(const Tensor& x1, const Tensor& x2, const double p, c10
   //The last two dimensions will stay the same
   IntArrayRef batch_tensor1(x1.sizes().data(), dim1 - 2);
   IntArrayRef batch_tensor2(x2.sizes().data(), dim2 - 2);
-  std::vector<int64_t> expand_batch_portion = infer_size(batch_tensor1, batch_tensor2);
-  std::vector<int64_t> tensor1_expand_size(expand_batch_portion);
+  DimVector expand_batch_portion = infer_size_dimvector(batch_tensor1, batch_tensor2);
+  DimVector tensor1_expand_size(expand_batch_portion);
   tensor1_expand_size.insert(tensor1_expand_size.end(), {r1, c1});
-  std::vector<int64_t> tensor2_expand_size(expand_batch_portion);
+  DimVector tensor2_expand_size(expand_batch_portion);
   tensor2_expand_size.insert(tensor2_expand_size.end(), {r2, c2});
 
   const int64_t expand_batch_product = c10::multiply_integers(expand_batch_portion);
-  std::vector<int64_t> tensor1_view{expand_batch_product, r1, c1};
-  std::vector<int64_t> tensor2_view{expand_batch_product, r2, c2};
+  DimVector tensor1_view{expand_batch_product, r1, c1};
+  DimVector tensor2_view{expand_batch_product, r2, c2};
 
   Tensor tensor1_expanded = x1.expand(tensor1_expand_size).contiguous().view(tensor1_view);
   Tensor tensor2_expanded = x2.expand(tensor2_expand_size).contiguous().view(tensor2_view);
 
-  std::vector<int64_t> output_shape(expand_batch_portion);
+  DimVector output_shape(expand_batch_portion);
   output_shape.insert(output_shape.end(), {r1, r2});
 
   Tensor result;
@@ -166,10 +166,10 @@ Tensor _cdist_backward(const Tensor& grad, const Tensor& _x1, const Tensor& _x2,
   auto dim2 = _x2.dim();
   IntArrayRef batch_tensor1(_x1.sizes().data(), dim1 - 2);
   IntArrayRef batch_tensor2(_x2.sizes().data(), dim2 - 2);
-  std::vector<int64_t> expand_batch_portion = infer_size(batch_tensor1, batch_tensor2);
-  std::vector<int64_t> tensor1_expand_size(expand_batch_portion);
+  DimVector expand_batch_portion = infer_size_dimvector(batch_tensor1, batch_tensor2);
+  DimVector tensor1_expand_size(expand_batch_portion);
   tensor1_expand_size.insert(tensor1_expand_size.end(), {r1, c1});
-  std::vector<int64_t> tensor2_expand_size(expand_batch_portion);
+  DimVector tensor2_expand_size(expand_batch_portion);
   tensor2_expand_size.insert(tensor2_expand_size.end(), {r2, c2});
 
   // Compute the linearized batch size
@@ -181,11 +181,11 @@ Tensor _cdist_backward(const Tensor& grad, const Tensor& _x1, const Tensor& _x2,
   }
 
   Tensor x1 = _x1;
-  if (tensor1_expand_size != x1.sizes()) {
+  if (!x1.sizes().equals(tensor1_expand_size)) {
     x1 = x1.expand(tensor1_expand_size).contiguous();
   }
   Tensor x2 = _x2;
-  if (tensor2_expand_size != x2.sizes()) {
+  if (!x2.sizes().equals(tensor2_expand_size)) {
     x2 = x2.expand(tensor2_expand_size).contiguous();
   }
 
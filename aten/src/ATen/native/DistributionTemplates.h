@@ -169,7 +169,7 @@ static bool resize_output_for_normal(at::Tensor& output, const at::Tensor& mean,
   bool empty_output = output.numel() == 0;
 
   if (expandable) {
-    auto shape = at::infer_size(mean.sizes(), std.sizes());
+    auto shape = at::infer_size_dimvector(mean.sizes(), std.sizes());
     TORCH_CHECK(
         empty_output || output.sizes().equals(shape),
         "inconsistent tensor, output size (", output.sizes(), ") is not the same as broadcasted mean and std size (", shape, ")");
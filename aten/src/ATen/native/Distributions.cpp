@@ -1,5 +1,4 @@
 #include <ATen/ATen.h>
-#include <ATen/CPUApplyUtils.h>
 #include <ATen/Config.h>
 #include <ATen/Dispatch.h>
 #include <ATen/ExpandUtils.h>
@@ -19,6 +18,7 @@
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/native/cpu/Loops.h>
 
+#include <limits>
 #include <type_traits>
 #include <functional>
 // NOLINTNEXTLINE(modernize-deprecated-headers)
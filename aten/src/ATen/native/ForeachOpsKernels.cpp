@@ -4,10 +4,27 @@
 
 namespace at { namespace native {
 
-#define FOREACH_BINARY_OP_SCALAR(OP)                                                                      \
+DEFINE_DISPATCH(foreach_binary_scalar_stub);
+DEFINE_DISPATCH(foreach_binary_scalarlist_stub);
+DEFINE_DISPATCH(foreach_binary_list_stub);
+DEFINE_DISPATCH(foreach_pointwise_scalar_stub);
+DEFINE_DISPATCH(foreach_pointwise_scalarlist_stub);
+DEFINE_DISPATCH(foreach_zero_stub);
+
+// The in-place kernels below take a fused path when the lists qualify (see
+// can_use_fused_cpu_route): one stub call processes the whole list with a
+// single parallel_for over a chunked work queue instead of dispatching one
+// op per tensor. OPTYPE is the matching ForeachBinaryOpType /
+// ForeachPointwiseOpType enumerator.
+
+#define FOREACH_BINARY_OP_SCALAR(OP, OPTYPE)                                                              \
 void foreach_tensor_##OP##_scalar_kernel_slow_(TensorList tensors, const Scalar& scalar) {                       \
   check_foreach_api_restrictions(tensors);                                                                \
                                                                                                           \
+  if (can_use_fused_cpu_route({tensors}, {scalar})) {                                                     \
+    return foreach_binary_scalar_stub(kCPU, ForeachBinaryOpType::OPTYPE, tensors, scalar);                \
+  }                                                                                                       \
+                                                                                                          \
   for (auto& t: tensors) {                                                                                \
     t.OP##_(scalar);                                                                                      \
   }                                                                                                       \
@@ -25,10 +42,14 @@ std::vector<Tensor> foreach_tensor_##OP##_scalar_kernel_slow(TensorList tensors,
   return result;                                                                                          \
 }
 
-#define FOREACH_BINARY_OP_SCALARLIST(OP)                                                                                \
+#define FOREACH_BINARY_OP_SCALARLIST(OP, OPTYPE)                                                                        \
 void foreach_tensor_##OP##_scalarlist_kernel_slow_(TensorList tensors, at::ArrayRef<Scalar> scalars) {                  \
   check_foreach_api_restrictions(tensors, scalars);                                                                     \
                                                                                                                         \
+  if (can_use_fused_cpu_route({tensors}, scalars)) {                                                                    \
+    return foreach_binary_scalarlist_stub(kCPU, ForeachBinaryOpType::OPTYPE, tensors, scalars);                         \
+  }                                                                                                                     \
+                                                                                                                        \
   for (const auto i : c10::irange(tensors.size())) {                                                                    \
       tensors[i].OP##_(scalars[i]);                                                                                     \
     }                                                                                                                   \
@@ -45,7 +66,7 @@ std::vector<Tensor> foreach_tensor_##OP##_scalarlist_kernel_slow(TensorList tens
   return result;                                                                                                        \
 }
 
-#define FOREACH_BINARY_OP_LIST(OP)                                                                        \
+#define FOREACH_BINARY_OP_LIST(OP, OPTYPE)                                                                \
 std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2) {    \
   check_foreach_api_restrictions(tensors1, tensors2);                                                     \
                                                                                                           \
@@ -61,12 +82,16 @@ std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1,
 void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2) {                  \
   check_foreach_api_restrictions(tensors1, tensors2);                                                     \
                                                                                                           \
+  if (can_use_fused_cpu_route({tensors1, tensors2})) {                                                    \
+    return foreach_binary_list_stub(kCPU, ForeachBinaryOpType::OPTYPE, tensors1, tensors2, 1);            \
+  }                                                                                                       \
+                                                                                                          \
   for (const auto i : c10::irange(tensors1.size())) {                                                     \
     tensors1[i].OP##_(tensors2[i]);                                                                       \
   }                                                                                                       \
 }
 
-#define FOREACH_BINARY_OP_LIST_ALPHA(OP)                                                                                \
+#define FOREACH_BINARY_OP_LIST_ALPHA(OP, OPTYPE)                                                                        \
 std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {    \
   check_foreach_api_restrictions(tensors1, tensors2);                                                                   \
                                                                                                                         \
@@ -82,6 +107,10 @@ std::vector<Tensor> foreach_tensor_##OP##_list_kernel_slow(TensorList tensors1,
 void foreach_tensor_##OP##_list_kernel_slow_(TensorList tensors1, TensorList tensors2, const Scalar& alpha) {                  \
   check_foreach_api_restrictions(tensors1, tensors2);                                                                   \
                                                                                                                         \
+  if (can_use_fused_cpu_route({tensors1, tensors2}, {alpha})) {                                                         \
+    return foreach_binary_list_stub(kCPU, ForeachBinaryOpType::OPTYPE, tensors1, tensors2, alpha);                      \
+  }                                                                                                                     \
+                                                                                                                        \
   for (const auto i : c10::irange(tensors1.size())) {                                                                   \
     tensors1[i].OP##_(tensors2[i], alpha);                                                                              \
   }                                                                                                                     \
@@ -108,7 +137,7 @@ void foreach_tensor_##OP##_slow_(TensorList tensors) {                     \
   }                                                                        \
 }
 
-#define FOREACH_POINTWISE_OP_SCALAR(OP)                                                                                              \
+#define FOREACH_POINTWISE_OP_SCALAR(OP, OPTYPE)                                                                                      \
 std::vector<Tensor> foreach_tensor_##OP##_scalar_slow(TensorList input, TensorList tensors1, TensorList tensors2, const Scalar& scalar) {   \
   check_foreach_api_restrictions(input, tensors1, tensors2);                                                                         \
                                                                                                                                      \
@@ -123,12 +152,16 @@ std::vector<Tensor> foreach_tensor_##OP##_scalar_slow(TensorList input, TensorLi
 void foreach_tensor_##OP##_scalar_slow_(TensorList input, TensorList tensors1, TensorList tensors2, const Scalar& scalar) {                 \
   check_foreach_api_restrictions(input, tensors1, tensors2);                                                                         \
                                                                                                                                      \
+  if (can_use_fused_cpu_route({input, tensors1, tensors2}, {scalar})) {                                                              \
+    return foreach_pointwise_scalar_stub(kCPU, ForeachPointwiseOpType::OPTYPE, input, tensors1, tensors2, scalar);                   \
+  }                                                                                                                                  \
+                                                                                                                                     \
   for(const auto i : c10::irange(input.size())) {                                                                                    \
     input[i].OP##_(tensors1[i], tensors2[i], scalar);                                                                                \
   }                                                                                                                                  \
 }                                                                                                                                    \
 
-#define FOREACH_POINTWISE_OP_SCALARLIST(OP)                                                                                                             \
+#define FOREACH_POINTWISE_OP_SCALARLIST(OP, OPTYPE)                                                                                                     \
 std::vector<Tensor> foreach_tensor_##OP##_scalarlist_slow(TensorList input, TensorList tensors1, TensorList tensors2, at::ArrayRef<Scalar> scalars) {   \
   check_foreach_api_restrictions(input, tensors1, tensors2, scalars);                                                                                   \
                                                                                                                                                         \
@@ -143,26 +176,30 @@ std::vector<Tensor> foreach_tensor_##OP##_scalarlist_slow(TensorList input, Tens
 void foreach_tensor_##OP##_scalarlist_slow_(TensorList input, TensorList tensors1, TensorList tensors2, at::ArrayRef<Scalar> scalars) {                 \
   check_foreach_api_restrictions(input, tensors1, tensors2, scalars);                                                                                   \
                                                                                                                                                         \
+  if (can_use_fused_cpu_route({input, tensors1, tensors2}, scalars)) {                                                                                  \
+    return foreach_pointwise_scalarlist_stub(kCPU, ForeachPointwiseOpType::OPTYPE, input, tensors1, tensors2, scalars);                                 \
+  }                                                                                                                                                     \
+                                                                                                                                                        \
   for(const auto i : c10::irange(input.size())) {                                                                                                       \
     input[i].OP##_(tensors1[i], tensors2[i], scalars[i]);                                                                                               \
   }                                                                                                                                                     \
 }                                                                                                                                                       \
 
-FOREACH_BINARY_OP_LIST_ALPHA(add);
-FOREACH_BINARY_OP_LIST_ALPHA(sub);
+FOREACH_BINARY_OP_LIST_ALPHA(add, ADD);
+FOREACH_BINARY_OP_LIST_ALPHA(sub, SUB);
 
-FOREACH_BINARY_OP_SCALAR(add);
-FOREACH_BINARY_OP_SCALAR(sub);
-FOREACH_BINARY_OP_SCALAR(mul);
-FOREACH_BINARY_OP_SCALAR(div);
+FOREACH_BINARY_OP_SCALAR(add, ADD);
+FOREACH_BINARY_OP_SCALAR(sub, SUB);
+FOREACH_BINARY_OP_SCALAR(mul, MUL);
+FOREACH_BINARY_OP_SCALAR(div, DIV);
 
-FOREACH_BINARY_OP_SCALARLIST(add);
-FOREACH_BINARY_OP_SCALARLIST(sub);
-FOREACH_BINARY_OP_SCALARLIST(mul);
-FOREACH_BINARY_OP_SCALARLIST(div);
+FOREACH_BINARY_OP_SCALARLIST(add, ADD);
+FOREACH_BINARY_OP_SCALARLIST(sub, SUB);
+FOREACH_BINARY_OP_SCALARLIST(mul, MUL);
+FOREACH_BINARY_OP_SCALARLIST(div, DIV);
 
-FOREACH_BINARY_OP_LIST(mul);
-FOREACH_BINARY_OP_LIST(div);
+FOREACH_BINARY_OP_LIST(mul, MUL);
+FOREACH_BINARY_OP_LIST(div, DIV);
 
 FOREACH_UNARY_OP(sqrt);
 FOREACH_UNARY_OP(exp);
@@ -193,11 +230,11 @@ FOREACH_UNARY_OP(trunc);
 FOREACH_UNARY_OP(reciprocal);
 FOREACH_UNARY_OP(sigmoid);
 
-FOREACH_POINTWISE_OP_SCALAR(addcdiv);
-FOREACH_POINTWISE_OP_SCALAR(addcmul);
+FOREACH_POINTWISE_OP_SCALAR(addcdiv, ADDCDIV);
+FOREACH_POINTWISE_OP_SCALAR(addcmul, ADDCMUL);
 
-FOREACH_POINTWISE_OP_SCALARLIST(addcdiv);
-FOREACH_POINTWISE_OP_SCALARLIST(addcmul);
+FOREACH_POINTWISE_OP_SCALARLIST(addcdiv, ADDCDIV);
+FOREACH_POINTWISE_OP_SCALARLIST(addcmul, ADDCMUL);
 
 #define FOREACH_MAXIMUM_MINIMUM_OP(NAME)                                                     \
 std::vector<Tensor> foreach_tensor_##NAME##_slow(TensorList tensors1, TensorList tensors2) { \
@@ -215,9 +252,24 @@ std::vector<Tensor> foreach_tensor_##NAME##_slow(TensorList tensors1, TensorList
 FOREACH_MAXIMUM_MINIMUM_OP(maximum)
 FOREACH_MAXIMUM_MINIMUM_OP(minimum)
 
+void foreach_tensor_copy_list_kernel_slow_(
+    TensorList self,
+    TensorList src,
+    bool non_blocking) {
+  check_foreach_api_restrictions(self, src);
+
+  for (const auto i : c10::irange(self.size())) {
+    self[i].copy_(src[i], non_blocking);
+  }
+}
+
 void foreach_tensor_zero_slow_(TensorList tensors) {
   check_foreach_api_restrictions(tensors);
 
+  if (can_use_fused_cpu_route({tensors})) {
+    return foreach_zero_stub(kCPU, tensors);
+  }
+
   for (auto& t : tensors) {
     t.zero_();
   }
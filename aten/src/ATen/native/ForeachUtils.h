@@ -1,10 +1,48 @@
 #pragma once
 
 #include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
 #include <c10/util/irange.h>
 
 namespace at {
 namespace native {
+
+// Fused CPU kernels for the _foreach_* ops; see
+// native/cpu/ForeachOpsKernel.cpp. Each stub processes a whole tensor list
+// in one call, with the arithmetic op selected by tag so the handful of
+// variants don't each need their own stub.
+enum class ForeachBinaryOpType : uint8_t { ADD, SUB, MUL, DIV };
+enum class ForeachPointwiseOpType : uint8_t { ADDCMUL, ADDCDIV };
+
+using foreach_binary_scalar_fn =
+    void (*)(ForeachBinaryOpType, TensorList, const Scalar&);
+using foreach_binary_scalarlist_fn =
+    void (*)(ForeachBinaryOpType, TensorList, ArrayRef<Scalar>);
+using foreach_binary_list_fn =
+    void (*)(ForeachBinaryOpType, TensorList, TensorList, const Scalar&);
+using foreach_pointwise_scalar_fn = void (*)(
+    ForeachPointwiseOpType,
+    TensorList,
+    TensorList,
+    TensorList,
+    const Scalar&);
+using foreach_pointwise_scalarlist_fn = void (*)(
+    ForeachPointwiseOpType,
+    TensorList,
+    TensorList,
+    TensorList,
+    ArrayRef<Scalar>);
+using foreach_zero_fn = void (*)(TensorList);
+
+DECLARE_DISPATCH(foreach_binary_scalar_fn, foreach_binary_scalar_stub);
+DECLARE_DISPATCH(foreach_binary_scalarlist_fn, foreach_binary_scalarlist_stub);
+DECLARE_DISPATCH(foreach_binary_list_fn, foreach_binary_list_stub);
+DECLARE_DISPATCH(foreach_pointwise_scalar_fn, foreach_pointwise_scalar_stub);
+DECLARE_DISPATCH(
+    foreach_pointwise_scalarlist_fn,
+    foreach_pointwise_scalarlist_stub);
+DECLARE_DISPATCH(foreach_zero_fn, foreach_zero_stub);
+
 namespace {
 // Check if tensor list has either a boolean tensor or a integer tensor
 bool has_integral_tensor(TensorList tensors, const bool includeBool) {
@@ -135,5 +173,28 @@ bool can_use_fast_route(TensorList tensors1, TensorList tensors2, bool does_op_p
 #endif
 }
 
+// The fused CPU kernels flatten the lists into a chunk queue and run raw
+// pointer loops (see native/cpu/ForeachOpsKernel.cpp), so on top of the
+// fast-path restrictions everything must live on CPU, carry no pending
+// conj/neg, and use one of the dtypes the Vectorized loops are instantiated
+// for. The CUDA kernels also fall back to the slow kernels with CUDA
+// tensors, hence the explicit device check.
+bool can_use_fused_cpu_route(
+    ArrayRef<TensorList> tensorLists,
+    ArrayRef<Scalar> scalarList = {}) {
+  for (const auto& tensorList : tensorLists) {
+    for (const auto& tensor : tensorList) {
+      if (!tensor.is_cpu() || tensor.is_conj() || tensor.is_neg()) {
+        return false;
+      }
+    }
+  }
+  const auto dtype = tensorLists[0][0].scalar_type();
+  if (dtype != ScalarType::Float && dtype != ScalarType::Double) {
+    return false;
+  }
+  return check_fast_path_restrictions(tensorLists, scalarList);
+}
+
 }
 }} // at::native
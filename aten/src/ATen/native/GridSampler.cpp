@@ -383,6 +383,108 @@ namespace {
     return std::make_tuple(grad_input, grad_grid);
   }
 
+  // See Note [Compiled grid sampler plans] in GridSampler.h.
+  template<typename scalar_t>
+  void grid_sampler_2d_compile_plan_impl(
+      const Tensor& grid, int64_t inp_H, int64_t inp_W,
+      GridSamplerPadding padding_mode, bool align_corners,
+      const Tensor& offsets, const Tensor& weights) {
+    int64_t N = grid.size(0);
+    int64_t out_H = grid.size(1);
+    int64_t out_W = grid.size(2);
+    int64_t grid_sN = grid.stride(0);
+    int64_t grid_sH = grid.stride(1);
+    int64_t grid_sW = grid.stride(2);
+    int64_t grid_sCoor = grid.stride(3);
+    const scalar_t *grid_ptr = grid.data_ptr<scalar_t>();
+    int64_t *off_ptr = offsets.data_ptr<int64_t>();
+    scalar_t *w_ptr = weights.data_ptr<scalar_t>();
+    // stride between the four corner planes of the SoA layout
+    int64_t corner_sz = N * out_H * out_W;
+    at::parallel_for(0, N, 0, [&](int64_t start, int64_t end) {
+      for (const auto n : c10::irange(start, end)) {
+        const scalar_t *grid_ptr_N = grid_ptr + n * grid_sN;
+        for (const auto h : c10::irange(out_H)) {
+          for (const auto w : c10::irange(out_W)) {
+            const scalar_t *grid_ptr_NHW = grid_ptr_N + h * grid_sH + w * grid_sW;
+            scalar_t x = *grid_ptr_NHW;
+            scalar_t y = grid_ptr_NHW[grid_sCoor];
+
+            scalar_t ix = grid_sampler_compute_source_index(x, inp_W, padding_mode, align_corners);
+            scalar_t iy = grid_sampler_compute_source_index(y, inp_H, padding_mode, align_corners);
+
+            int64_t ix_nw = static_cast<int64_t>(std::floor(ix));
+            int64_t iy_nw = static_cast<int64_t>(std::floor(iy));
+
+            // corner coordinates and bilinear surface weights, in the
+            // nw/ne/sw/se order used by the fallback kernel above
+            int64_t corner_x[4] = {ix_nw, ix_nw + 1, ix_nw, ix_nw + 1};
+            int64_t corner_y[4] = {iy_nw, iy_nw, iy_nw + 1, iy_nw + 1};
+            scalar_t corner_w[4] = {
+                (ix_nw + 1 - ix) * (iy_nw + 1 - iy),
+                (ix - ix_nw)     * (iy_nw + 1 - iy),
+                (ix_nw + 1 - ix) * (iy - iy_nw),
+                (ix - ix_nw)     * (iy - iy_nw)};
+
+            int64_t i = (n * out_H + h) * out_W + w;
+            for (const auto k : c10::irange(4)) {
+              if (within_bounds_2d(corner_y[k], corner_x[k], inp_H, inp_W)) {
+                off_ptr[k * corner_sz + i] = corner_y[k] * inp_W + corner_x[k];
+                w_ptr[k * corner_sz + i] = corner_w[k];
+              } else {
+                // zeros padding folds into the weights; offset 0 is always
+                // safe to gather from
+                off_ptr[k * corner_sz + i] = 0;
+                w_ptr[k * corner_sz + i] = static_cast<scalar_t>(0);
+              }
+            }
+          }
+        }
+      }
+    });
+  }
+
+  // See Note [Compiled grid sampler plans] in GridSampler.h.
+  template<typename scalar_t>
+  void grid_sampler_2d_execute_plan_impl(
+      const Tensor& output, const Tensor& input,
+      const Tensor& offsets, const Tensor& weights) {
+    int64_t N = input.size(0);
+    int64_t C = input.size(1);
+    int64_t inp_sp = input.size(2) * input.size(3);
+    int64_t out_sp = output.size(2) * output.size(3);
+    int64_t corner_sz = N * out_sp;
+    const scalar_t *inp_ptr = input.data_ptr<scalar_t>();
+    scalar_t *out_ptr = output.data_ptr<scalar_t>();
+    const int64_t *off_ptr = offsets.data_ptr<int64_t>();
+    const scalar_t *w_ptr = weights.data_ptr<scalar_t>();
+    // the four corner offset/weight planes are shared by all channels of a
+    // batch entry, so parallelize over (N, C) and stream them per plane
+    int64_t grain_size = out_sp == 0 ? (N * C + 1)
+                                     : at::divup(at::internal::GRAIN_SIZE, out_sp * 8);
+    at::parallel_for(0, N * C, grain_size, [&](int64_t start, int64_t end) {
+      for (const auto nc : c10::irange(start, end)) {
+        int64_t n = nc / C;
+        const scalar_t *inp_ptr_NC = inp_ptr + nc * inp_sp;
+        scalar_t *out_ptr_NC = out_ptr + nc * out_sp;
+        const int64_t *off_nw = off_ptr + n * out_sp;
+        const int64_t *off_ne = off_nw + corner_sz;
+        const int64_t *off_sw = off_ne + corner_sz;
+        const int64_t *off_se = off_sw + corner_sz;
+        const scalar_t *w_nw = w_ptr + n * out_sp;
+        const scalar_t *w_ne = w_nw + corner_sz;
+        const scalar_t *w_sw = w_ne + corner_sz;
+        const scalar_t *w_se = w_sw + corner_sz;
+        for (const auto i : c10::irange(out_sp)) {
+          out_ptr_NC[i] = inp_ptr_NC[off_nw[i]] * w_nw[i]
+                        + inp_ptr_NC[off_ne[i]] * w_ne[i]
+                        + inp_ptr_NC[off_sw[i]] * w_sw[i]
+                        + inp_ptr_NC[off_se[i]] * w_se[i];
+        }
+      }
+    });
+  }
+
 }  // namespace
 
 Tensor _grid_sampler_2d_cpu_fallback(const Tensor& input, const Tensor& grid,
@@ -820,6 +922,65 @@ grid_sampler_3d_backward_cpu(const Tensor& grad_output, const Tensor& input, con
   });
 }
 
+// See Note [Compiled grid sampler plans] in GridSampler.h.
+GridSamplerPlan2d grid_sampler_2d_compile_plan(
+    const Tensor& grid,
+    IntArrayRef input_size,
+    int64_t padding_mode,
+    bool align_corners) {
+  TORCH_CHECK(
+      grid.dim() == 4 && grid.size(3) == 2,
+      "grid_sampler_2d_compile_plan(): expected a 4-D grid with last dimension 2, "
+      "but got grid with sizes ", grid.sizes());
+  TORCH_CHECK(
+      input_size.size() == 4,
+      "grid_sampler_2d_compile_plan(): expected a 4-D (NCHW) input size, but got ",
+      input_size.size(), " dimensions");
+  TORCH_CHECK(
+      input_size[0] == grid.size(0),
+      "grid_sampler_2d_compile_plan(): expected grid and input to have the same "
+      "batch size, but got input batch size ", input_size[0],
+      " and grid batch size ", grid.size(0));
+  int64_t inp_H = input_size[2];
+  int64_t inp_W = input_size[3];
+  auto offsets = at::empty(
+      {4, grid.size(0), grid.size(1), grid.size(2)}, grid.options().dtype(kLong));
+  auto weights = at::empty(
+      {4, grid.size(0), grid.size(1), grid.size(2)}, grid.options());
+  AT_DISPATCH_FLOATING_TYPES(grid.scalar_type(), "grid_sampler_2d_compile_plan", [&] {
+    grid_sampler_2d_compile_plan_impl<scalar_t>(
+        grid, inp_H, inp_W,
+        static_cast<GridSamplerPadding>(padding_mode), align_corners,
+        offsets, weights);
+  });
+  return {std::move(offsets), std::move(weights), inp_H, inp_W};
+}
+
+// See Note [Compiled grid sampler plans] in GridSampler.h.
+Tensor grid_sampler_2d_execute_plan(
+    const GridSamplerPlan2d& plan, const Tensor& input) {
+  TORCH_CHECK(
+      input.dim() == 4 &&
+      input.size(0) == plan.offsets.size(1) &&
+      input.size(2) == plan.inp_H &&
+      input.size(3) == plan.inp_W,
+      "grid_sampler_2d_execute_plan(): input sizes ", input.sizes(),
+      " do not match the sizes the plan was compiled for");
+  TORCH_CHECK(
+      input.scalar_type() == plan.weights.scalar_type(),
+      "grid_sampler_2d_execute_plan(): expected ", plan.weights.scalar_type(),
+      " input to match the plan, but got ", input.scalar_type());
+  auto input_c = input.contiguous();
+  auto output = at::empty(
+      {input.size(0), input.size(1), plan.offsets.size(2), plan.offsets.size(3)},
+      input.options());
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "grid_sampler_2d_execute_plan", [&] {
+    grid_sampler_2d_execute_plan_impl<scalar_t>(
+        output, input_c, plan.offsets, plan.weights);
+  });
+  return output;
+}
+
 Tensor grid_sampler(const Tensor& input, const Tensor& grid,
                     int64_t interpolation_mode, int64_t padding_mode,
                     bool align_corners) {
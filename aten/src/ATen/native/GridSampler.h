@@ -15,6 +15,40 @@ namespace detail {
 using detail::GridSamplerInterpolation;
 using detail::GridSamplerPadding;
 
+// Note [Compiled grid sampler plans]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When the same sampling grid is applied to many inputs (e.g. warping every
+// frame of a video with one stabilization grid), recomputing source indices
+// and interpolation weights from the normalized grid coordinates on every
+// call is pure overhead. A plan precomputes, per output pixel, the flattened
+// offsets of the four bilinear corners into an (H_in * W_in) input plane and
+// their interpolation weights. Padding is folded into the plan at compile
+// time: border/reflection remap the source coordinate before the corners are
+// taken, and zeros padding stores weight 0 (with a safe offset of 0) for
+// out-of-bounds corners. Executing the plan is then a pure gather + FMA over
+// each new input, with the corner arrays stored structure-of-arrays so each
+// corner's offsets and weights stream contiguously.
+struct GridSamplerPlan2d {
+  Tensor offsets;  // int64, [4, N, H_out, W_out]
+  Tensor weights;  // grid scalar type, [4, N, H_out, W_out]
+  int64_t inp_H;
+  int64_t inp_W;
+};
+
+// Builds a plan from `grid` for inputs of shape `input_size` (NCHW). Only
+// bilinear interpolation is supported; all padding modes are folded in.
+TORCH_API GridSamplerPlan2d grid_sampler_2d_compile_plan(
+    const Tensor& grid,
+    IntArrayRef input_size,
+    int64_t padding_mode,
+    bool align_corners);
+
+// Applies a compiled plan to a new input, equivalent to grid_sampler_2d with
+// the grid and flags the plan was compiled from.
+TORCH_API Tensor grid_sampler_2d_execute_plan(
+    const GridSamplerPlan2d& plan,
+    const Tensor& input);
+
 // Unnormalizes a coordinate from the -1 to +1 scale to its pixel index value,
 // where we view each pixel as an area between (idx - 0.5) and (idx + 0.5).
 // if align_corners: -1 and +1 get sent to the centers of the corner pixels
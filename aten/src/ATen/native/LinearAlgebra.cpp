@@ -1682,21 +1682,21 @@ Tensor matmul(
     IntArrayRef batch_tensor2(tensor2.sizes().data(), std::max<int64_t>(dim_tensor2 - 2, 0));
 
     // expand the batch portion (i.e. cut off matrix dimensions and expand rest)
-    std::vector<int64_t> expand_batch_portion = infer_size(batch_tensor1, batch_tensor2);
+    DimVector expand_batch_portion = infer_size_dimvector(batch_tensor1, batch_tensor2);
 
-    std::vector<int64_t> tensor1_expand_size(expand_batch_portion);
+    DimVector tensor1_expand_size(expand_batch_portion);
     tensor1_expand_size.insert(tensor1_expand_size.end(), {n, m1});
 
-    std::vector<int64_t> tensor2_expand_size(expand_batch_portion);
+    DimVector tensor2_expand_size(expand_batch_portion);
     tensor2_expand_size.insert(tensor2_expand_size.end(), {m2, p});
 
     const int64_t expand_batch_product =
         c10::multiply_integers(expand_batch_portion);
 
-    std::vector<int64_t> tensor1_bmm_view({expand_batch_product});
+    DimVector tensor1_bmm_view({expand_batch_product});
     tensor1_bmm_view.insert(tensor1_bmm_view.end(), {n, m1});
 
-    std::vector<int64_t> tensor2_bmm_view({expand_batch_product});
+    DimVector tensor2_bmm_view({expand_batch_product});
     tensor2_bmm_view.insert(tensor2_bmm_view.end(), {m2, p});
 
     // flatten expanded batches
@@ -1704,7 +1704,7 @@ Tensor matmul(
     Tensor tensor2_expanded = tensor2.expand(tensor2_expand_size).reshape(tensor2_bmm_view);
 
     // reshape batches back into result
-    std::vector<int64_t> output_shape(expand_batch_portion);
+    DimVector output_shape(expand_batch_portion);
     if (dim_tensor1 > 1) {
       output_shape.push_back(n);
     }
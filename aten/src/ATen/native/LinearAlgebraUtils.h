@@ -308,16 +308,16 @@ static inline void checkAllSameDim(TensorList tensors, int64_t dim) {
   }
 }
 
-static inline std::tuple<std::vector<int64_t>, std::vector<int64_t>> _linalg_broadcast_batch_dims(const Tensor& arg1, const Tensor& arg2) {
+static inline std::tuple<DimVector, DimVector> _linalg_broadcast_batch_dims(const Tensor& arg1, const Tensor& arg2) {
   // broadcast the batch dimensions of arg1 and arg2.
   IntArrayRef arg1_batch_sizes(arg1.sizes().data(), arg1.ndimension() - 2);
   IntArrayRef arg2_batch_sizes(arg2.sizes().data(), arg2.ndimension() - 2);
-  std::vector<int64_t> expand_batch_portion = infer_size(arg1_batch_sizes, arg2_batch_sizes);
+  DimVector expand_batch_portion = infer_size_dimvector(arg1_batch_sizes, arg2_batch_sizes);
 
-  std::vector<int64_t> arg1_expand_size({expand_batch_portion});
+  DimVector arg1_expand_size(expand_batch_portion);
   arg1_expand_size.insert(arg1_expand_size.end(), { arg1.size(-2), arg1.size(-1) });
 
-  std::vector<int64_t> arg2_expand_size({expand_batch_portion});
+  DimVector arg2_expand_size(expand_batch_portion);
   arg2_expand_size.insert(arg2_expand_size.end(), { arg2.size(-2), arg2.size(-1) });
   return std::make_tuple(std::move(arg1_expand_size), std::move(arg2_expand_size));
 }
@@ -325,7 +325,7 @@ static inline std::tuple<std::vector<int64_t>, std::vector<int64_t>> _linalg_bro
 static inline std::tuple<Tensor,Tensor> _linalg_broadcast_batch_dims(const Tensor& arg1, const Tensor& arg2, const char* name) {
   linearSolveCheckInputs(arg1, arg2, name);
 
-  std::vector<int64_t> arg1_expand_size, arg2_expand_size;
+  DimVector arg1_expand_size, arg2_expand_size;
   std::tie(arg1_expand_size, arg2_expand_size) = at::native::_linalg_broadcast_batch_dims(arg1, arg2);
 
   Tensor arg1_broadcasted  = arg1.expand(arg1_expand_size);
@@ -333,10 +333,10 @@ static inline std::tuple<Tensor,Tensor> _linalg_broadcast_batch_dims(const Tenso
   return std::make_tuple(arg1_broadcasted, arg2_broadcasted);
 }
 
-static inline std::vector<int64_t> broadcast_batch_size(const Tensor& t1, const Tensor& t2, int64_t n_batch_dims) {
+static inline DimVector broadcast_batch_size(const Tensor& t1, const Tensor& t2, int64_t n_batch_dims) {
   IntArrayRef t1_batch_sizes(t1.sizes().data(), n_batch_dims);
   IntArrayRef t2_batch_sizes(t2.sizes().data(), n_batch_dims);
-  auto broadcasted_batch_sizes = infer_size(t1_batch_sizes, t2_batch_sizes);
+  auto broadcasted_batch_sizes = infer_size_dimvector(t1_batch_sizes, t2_batch_sizes);
   return broadcasted_batch_sizes;
 }
 
@@ -0,0 +1,128 @@
+#include <ATen/ATen.h>
+#include <torch/custom_class.h>
+#include <torch/library.h>
+
+#include <tuple>
+#include <utility>
+
+namespace at {
+namespace native {
+namespace cpublas {
+
+// Note [Packed fp32/bf16 linear weights]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// On CPU builds that route linear through cpublas (no oneDNN and no MKL
+// packed-GEMM API), every call hands the BLAS kernel the weight as the
+// transpose of a row-major matrix and the kernel re-blocks it on every GEMM.
+// For inference the weight is constant, so that work is pure overhead; on
+// skinny activation shapes it can dominate the GEMM itself.
+//
+// cpublas::linear_prepack performs the layout conversion once, typically at
+// module freeze time: the weight is stored transposed and contiguous, in the
+// (in_features, out_features) order the GEMM streams directly, so repeated
+// cpublas::linear_run calls skip the per-call transpose handling. The holder
+// mirrors the quantized LinearPackedParamsBase / xnnpack LinearOpContext
+// pattern, including pickle support so frozen modules serialize.
+struct LinearPackedParams : public torch::CustomClassHolder {
+  LinearPackedParams(Tensor weight, c10::optional<Tensor> bias)
+      : orig_weight_(std::move(weight)), bias_(std::move(bias)) {
+    TORCH_CHECK(
+        orig_weight_.dim() == 2,
+        "cpublas::linear_prepack: expected a 2-D weight, got ",
+        orig_weight_.dim(),
+        "-D");
+    TORCH_CHECK(
+        orig_weight_.device().is_cpu(),
+        "cpublas::linear_prepack: expected a CPU weight, got ",
+        orig_weight_.device());
+    TORCH_CHECK(
+        orig_weight_.scalar_type() == kFloat ||
+            orig_weight_.scalar_type() == kBFloat16,
+        "cpublas::linear_prepack: only float and bfloat16 weights are "
+        "supported, got ",
+        orig_weight_.scalar_type());
+    if (bias_.has_value() && bias_->defined()) {
+      TORCH_CHECK(
+          bias_->dim() == 1 && bias_->size(0) == orig_weight_.size(0),
+          "cpublas::linear_prepack: expected a 1-D bias of size ",
+          orig_weight_.size(0),
+          ", got sizes ",
+          bias_->sizes());
+    }
+    packed_weight_ = orig_weight_.t().contiguous();
+  }
+
+  Tensor run(const Tensor& input) const {
+    TORCH_CHECK(
+        input.scalar_type() == packed_weight_.scalar_type(),
+        "cpublas::linear_run: input dtype ",
+        input.scalar_type(),
+        " doesn't match the packed weight dtype ",
+        packed_weight_.scalar_type());
+    const bool has_bias = bias_.has_value() && bias_->defined();
+    if (input.dim() == 2 && has_bias) {
+      // Fused op is marginally faster, as in at::native::linear.
+      return at::addmm(*bias_, input, packed_weight_);
+    }
+    auto output = at::matmul(input, packed_weight_);
+    if (has_bias) {
+      output.add_(*bias_);
+    }
+    return output;
+  }
+
+  std::tuple<Tensor, c10::optional<Tensor>> unpack() const {
+    return std::make_tuple(orig_weight_, bias_);
+  }
+
+ private:
+  Tensor orig_weight_;
+  c10::optional<Tensor> bias_;
+  Tensor packed_weight_;
+};
+
+namespace {
+
+c10::intrusive_ptr<LinearPackedParams> linear_prepack(
+    Tensor weight,
+    c10::optional<Tensor> bias) {
+  return c10::make_intrusive<LinearPackedParams>(
+      std::move(weight), std::move(bias));
+}
+
+Tensor linear_run(
+    const Tensor& input,
+    const c10::intrusive_ptr<LinearPackedParams>& packed_weight) {
+  return packed_weight->run(input);
+}
+
+} // namespace
+
+TORCH_LIBRARY(cpublas, m) {
+  m.class_<LinearPackedParams>("LinearPackedParams")
+      .def_pickle(
+          [](const c10::intrusive_ptr<LinearPackedParams>& packed_weight)
+              -> std::tuple<Tensor, c10::optional<Tensor>> { // __getstate__
+            return packed_weight->unpack();
+          },
+          [](std::tuple<Tensor, c10::optional<Tensor>> state)
+              -> c10::intrusive_ptr<LinearPackedParams> { // __setstate__
+            return c10::make_intrusive<LinearPackedParams>(
+                std::move(std::get<0>(state)), std::move(std::get<1>(state)));
+          });
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "cpublas::linear_prepack(Tensor W, Tensor? B=None) -> __torch__.torch.classes.cpublas.LinearPackedParams"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "cpublas::linear_run(Tensor X, __torch__.torch.classes.cpublas.LinearPackedParams W_prepack) -> Tensor Y"));
+}
+
+TORCH_LIBRARY_IMPL(cpublas, CPU, m) {
+  m.impl(
+      TORCH_SELECTIVE_NAME("cpublas::linear_prepack"),
+      TORCH_FN(linear_prepack));
+  m.impl(TORCH_SELECTIVE_NAME("cpublas::linear_run"), TORCH_FN(linear_run));
+}
+
+} // namespace cpublas
+} // namespace native
+} // namespace at
@@ -1,10 +1,103 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 
+#include <c10/util/accumulate.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace at { namespace native {
 
+namespace {
+
+// Note [Cached pack gather plans]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Packing a padded batch is a pure permutation: packed row k corresponds to
+// exactly one (step, sequence) row of the padded input, and the mapping only
+// depends on batch_sizes and the input layout, never on the values. Instead
+// of slicing out one block per distinct length (which materializes
+// intermediate tensors and runs one copy kernel per block), we build the
+// row-index vector once and run the whole pack as a single index_select;
+// unpacking and the pack backward scatter through the same index with
+// index_copy_. This also collapses the CUDA variants to one kernel each.
+//
+// Pipelines that pack many batches usually draw their lengths from a small
+// set of histograms (bucketed batching), so the index vector is cached,
+// keyed on the batch_sizes contents plus the layout stride and the target
+// device - caching per device also skips the host-to-device copy of the
+// index on repeated CUDA packs. The cache is dropped wholesale when it hits
+// the cap rather than tracking recency; rebuilding a plan is a cheap
+// O(total rows) host loop, and workloads with more than
+// kPackPlanCacheCapacity live histograms are not the case this is for.
+constexpr size_t kPackPlanCacheCapacity = 64;
+
+struct PackPlanHash {
+  size_t operator()(const std::vector<int64_t>& key) const {
+    size_t seed = key.size();
+    for (const auto v : key) {
+      seed = c10::hash_combine(seed, std::hash<int64_t>()(v));
+    }
+    return seed;
+  }
+};
+
+// Returns the packed-row -> padded-row index vector on `device`. With
+// batch_first the padded row of (step t, sequence b) is b * padded_length + t,
+// otherwise it is t * batch_size + b; `padded_length` may exceed the longest
+// length when the input carries trailing padding steps.
+Tensor pack_gather_index(
+    const int64_t* batch_sizes,
+    int64_t num_steps,
+    int64_t batch_size,
+    int64_t padded_length,
+    bool batch_first,
+    const Device& device) {
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::vector<int64_t>, Tensor, PackPlanHash> cache;
+
+  std::vector<int64_t> key;
+  key.reserve(num_steps + 4);
+  key.assign(batch_sizes, batch_sizes + num_steps);
+  key.push_back(batch_first ? padded_length : batch_size);
+  key.push_back(static_cast<int64_t>(batch_first));
+  key.push_back(static_cast<int64_t>(device.type()));
+  key.push_back(static_cast<int64_t>(device.index()));
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  int64_t total = 0;
+  for (const auto t : c10::irange(num_steps)) {
+    total += batch_sizes[t];
+  }
+  auto index_t = at::empty(total, at::device(at::kCPU).dtype(at::kLong));
+  int64_t* index = index_t.data_ptr<int64_t>();
+  for (const auto t : c10::irange(num_steps)) {
+    for (const auto b : c10::irange(batch_sizes[t])) {
+      *index++ = batch_first ? b * padded_length + t : t * batch_size + b;
+    }
+  }
+  if (!device.is_cpu()) {
+    index_t = index_t.to(device);
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if (cache.size() >= kPackPlanCacheCapacity) {
+    cache.clear();
+  }
+  cache.emplace(std::move(key), index_t);
+  return index_t;
+}
+
+} // namespace
+
 void checkLongTensor(const Tensor& tensor) {
   TORCH_CHECK(tensor.dim() == 1 && tensor.device().type() == at::kCPU && tensor.scalar_type() == at::kLong,
            "'lengths' argument should be a 1D CPU int64 tensor, but got ",
@@ -42,8 +135,6 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     }
   }
 
-  std::vector<at::Tensor> steps;
-  steps.reserve(batch_size);
   at::Tensor batch_sizes_t = at::empty(lengths[0], _lengths.options());
   int64_t * batch_sizes = batch_sizes_t.data_ptr<int64_t>();
 
@@ -56,32 +147,26 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     step_shape.insert(step_shape.end(), s_input_sizes.begin(), s_input_sizes.end());
   }
 
-  // To understand what's going on in this loop imagine that the input is a padded 2D
+  // To understand what's going on imagine that the input is a padded 2D
   // array that looks like this (x = valid entry, . = padding)
   //
-  //  1 1 1 1 1
-  //  2 2 2 . .
-  //  2 2 2 . .
-  //  4 . . . .
-  //  4 . . . .
+  //  x x x x x
+  //  x x x . .
+  //  x x x . .
+  //  x . . . .
+  //  x . . . .
   //
-  // Where the vertical dimension corresponds to time, and horizontal dim to batch.
-  // In this example, the lengths array will be equal to [5, 3, 3, 1, 1], and we will
-  // iterate over them in reverse order (from the rightmost column to the left).
-  // We want to avoid eager slicing of the input at every time step, and wait for
-  // the moments where the length increases. In this example, that will happen at the
-  // first, second and fourth steps. Then, we slice out the whole block of the input
-  // that corresponds to this length, and hasn't been sliced yet (the steps at which each
-  // element is sliced are annotated in the array above).  You can think of this as if we
-  // were scanning the sequences from the shortest one, and every time we realize there's
-  // more elements below in our column, we lower the counter (prev_l), and append the new
-  // block to the output.
+  // Where the vertical dimension corresponds to time, and horizontal dim to
+  // batch. In this example, the lengths array will be equal to [5, 3, 3, 1, 1].
+  // batch_sizes[t] is the number of columns that are still valid at step t;
+  // we compute it by scanning the lengths from the shortest sequence and
+  // bumping the count at every step where a longer sequence starts to
+  // contribute.
   int64_t prev_l = 0;
   for (const auto i : c10::irange(batch_size)) {
     int64_t l = lengths[batch_size - 1 - i];
     if (l > prev_l) {
       auto current_batch_size = batch_size - i;
-      steps.push_back(input.slice(0, prev_l, l).slice(1, 0, current_batch_size).contiguous().view(step_shape));
       for (int64_t j = 0; j < (l - prev_l); ++j) {
         (*batch_sizes++) = current_batch_size;
       }
@@ -90,7 +175,23 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     TORCH_CHECK(l >= prev_l);
   }
 
-  return std::make_tuple(at::cat(steps), batch_sizes_t);
+  // The pack itself is a single row gather; see
+  // Note [Cached pack gather plans].
+  auto values = _input.contiguous();
+  const int64_t padded_length = values.size(batch_first ? 1 : 0);
+  const int64_t rows = values.size(0) * values.size(1);
+  const int64_t row_numel = c10::multiply_integers(values.sizes().slice(2));
+  auto index = pack_gather_index(
+      batch_sizes_t.data_ptr<int64_t>(),
+      lengths[0],
+      batch_size,
+      padded_length,
+      batch_first,
+      values.device());
+  auto data =
+      values.view({rows, row_numel}).index_select(0, index).view(step_shape);
+
+  return std::make_tuple(std::move(data), std::move(batch_sizes_t));
 }
 
 // `grad` could be on arbitrary device and of arbitrary dtype, but `_batch_sizes`
@@ -106,13 +207,23 @@ Tensor _pack_padded_sequence_backward(const Tensor& grad, at::IntArrayRef input_
   auto batch_sizes_t = _batch_sizes.contiguous();
   checkLongTensor(batch_sizes_t);
 
-  int64_t offset = 0;
   int64_t max_seq_len = batch_sizes_t.size(0);
   int64_t * batch_sizes = batch_sizes_t.data_ptr<int64_t>();
-  for (const auto i : c10::irange(max_seq_len)) {
-    grad_input[i].slice(0, 0, batch_sizes[i]).copy_(grad.slice(0, offset, offset + batch_sizes[i]));
-    offset += batch_sizes[i];
-  }
+
+  // Scatter the packed gradient rows back into the padded layout in one
+  // index_copy_; see Note [Cached pack gather plans].
+  auto grad_c = grad.contiguous();
+  const int64_t batch_dim = input_size_after_t[1];
+  const int64_t row_numel = c10::multiply_integers(grad_c.sizes().slice(1));
+  auto index = pack_gather_index(
+      batch_sizes,
+      max_seq_len,
+      batch_dim,
+      /*padded_length=*/0,
+      /*batch_first=*/false,
+      grad.device());
+  grad_input.view({input_size_after_t[0] * batch_dim, row_numel})
+      .index_copy_(0, index, grad_c.view({grad_c.size(0), row_numel}));
 
   if (batch_first) {
     grad_input = grad_input.transpose(0, 1);
@@ -147,27 +258,25 @@ std::tuple<Tensor, Tensor> _pad_packed_sequence(const Tensor& data, const Tensor
   }
   auto output = at::full(output_size, padding_value, data.options());
 
-  // This will be modified at every iteration, but we reserve memory for it now.
-  std::vector<int64_t> tmp_view_size = std::move(output_size); // == [-1, -1, *var_data.size()[1:]]
+  // Scatter the packed rows into the padded layout in one index_copy_; see
+  // Note [Cached pack gather plans].
+  auto data_c = data.contiguous();
+  const int64_t row_numel = c10::multiply_integers(data_c.sizes().slice(1));
+  auto index = pack_gather_index(
+      batch_sizes,
+      max_real_seq_length,
+      max_batch_size,
+      /*padded_length=*/0,
+      /*batch_first=*/false,
+      data.device());
+  output.view({max_seq_length * max_batch_size, row_numel})
+      .index_copy_(0, index, data_c.view({data_c.size(0), row_numel}));
 
   at::Tensor lengths_t = at::empty(max_batch_size, batch_sizes_t.options());
   int64_t * lengths = lengths_t.data_ptr<int64_t>() + max_batch_size - 1;
-  int64_t data_offset = 0;
   int64_t prev_batch_size = max_batch_size;
-  int64_t prev_i = 0;
   for (int64_t i = 0; i <= max_real_seq_length; ++i) {
     int64_t batch_size = i != max_real_seq_length ? batch_sizes[i] : 0;
-    if (batch_size != prev_batch_size) {
-      int64_t l = prev_batch_size * (i - prev_i);
-      // The lines below are equivalent to this:
-      // output[prev_i:i, :prev_batch_size] = tmp.view(i - prev_i, prev_batch_size, *input.shape[2:])
-      auto tmp = data.slice(0, data_offset, data_offset + l);
-      tmp_view_size[0] = i - prev_i;
-      tmp_view_size[1] = prev_batch_size;
-      output.slice(0, prev_i, i).slice(1, 0, prev_batch_size).copy_(tmp.view(tmp_view_size));
-      data_offset += l;
-      prev_i = i;
-    }
     int64_t dec = prev_batch_size - batch_size;
     if (dec > 0) {
       for (const auto j : c10::irange(dec)) {
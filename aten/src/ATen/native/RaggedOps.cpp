@@ -0,0 +1,198 @@
+#include <ATen/ATen.h>
+#include <ATen/NativeFunctions.h>
+
+#include <c10/util/irange.h>
+
+namespace at { namespace native {
+
+// Note [Packed ragged batches]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Variable-length batches are usually padded to the longest sequence, which
+// wastes compute and bandwidth proportionally to the padding ratio.  The ops
+// in this file operate on a packed-ragged representation instead, following
+// the (values, offsets) design already used by EmbeddingBag: `values` holds
+// the B sequences concatenated along dim 0 (shape [total, *]) and `offsets`
+// is a CPU int64 tensor of shape [B + 1] where sequence i occupies rows
+// [offsets[i], offsets[i + 1]).  Unlike the PackedSequence (data,
+// batch_sizes) layout used by the RNNs, this layout keeps each sequence
+// contiguous, so a per-sequence computation is just a narrow() — no
+// re-sorting by length is required.
+//
+// All of these ops are composites built from differentiable ATen ops on
+// narrowed views, so they work on any device and get autograd for free; the
+// FLOP savings come from never materializing (or reading) padded positions.
+
+namespace {
+
+void checkRaggedOffsets(const Tensor& offsets) {
+  TORCH_CHECK(
+      offsets.dim() == 1 && offsets.device().type() == at::kCPU &&
+          offsets.scalar_type() == at::kLong,
+      "'offsets' argument should be a 1D CPU int64 tensor, but got ",
+      offsets.dim(), "D ", offsets.device().str(), " ",
+      offsets.scalar_type(), " tensor");
+  TORCH_CHECK(
+      offsets.size(0) >= 2,
+      "'offsets' must contain at least 2 elements, i.e. one segment, but got ",
+      offsets.size(0), " elements");
+  const int64_t* offsets_data = offsets.data_ptr<int64_t>();
+  TORCH_CHECK(
+      offsets_data[0] == 0,
+      "'offsets' must start at 0, but got ", offsets_data[0]);
+  const int64_t batch_size = offsets.size(0) - 1;
+  for (const auto i : c10::irange(batch_size)) {
+    TORCH_CHECK(
+        offsets_data[i] <= offsets_data[i + 1],
+        "'offsets' must be non-decreasing, but offsets[", i, "]=",
+        offsets_data[i], " > offsets[", i + 1, "]=", offsets_data[i + 1]);
+  }
+}
+
+void checkRaggedTotal(const Tensor& offsets, int64_t total) {
+  const int64_t batch_size = offsets.size(0) - 1;
+  TORCH_CHECK(
+      offsets.data_ptr<int64_t>()[batch_size] == total,
+      "expected the last element of 'offsets' to be the total number of rows (",
+      total, "), but got ", offsets.data_ptr<int64_t>()[batch_size]);
+}
+
+} // namespace
+
+Tensor _ragged_from_padded(const Tensor& padded, const Tensor& offsets_) {
+  TORCH_CHECK(
+      padded.dim() >= 2,
+      "expected 'padded' to be at least 2D (batch x length x ...), but got ",
+      padded.dim(), "D");
+  auto offsets_t = offsets_.contiguous();
+  checkRaggedOffsets(offsets_t);
+  TORCH_CHECK(
+      offsets_t.size(0) == padded.size(0) + 1,
+      "expected 'offsets' to have ", padded.size(0) + 1,
+      " elements for a batch of size ", padded.size(0), ", but got ",
+      offsets_t.size(0), " elements");
+  const int64_t batch_size = padded.size(0);
+  const int64_t* offsets = offsets_t.data_ptr<int64_t>();
+
+  std::vector<Tensor> slices;
+  slices.reserve(batch_size);
+  for (const auto i : c10::irange(batch_size)) {
+    const int64_t length = offsets[i + 1] - offsets[i];
+    TORCH_CHECK(
+        length >= 0 && length <= padded.size(1),
+        "length of sequence ", i, " (", length,
+        ") is out of bounds for 'padded' with max length ", padded.size(1));
+    slices.push_back(padded.select(0, i).narrow(0, 0, length));
+  }
+  return at::cat(slices, 0);
+}
+
+Tensor _padded_from_ragged(
+    const Tensor& values,
+    const Tensor& offsets_,
+    int64_t max_len,
+    const Scalar& padding_value) {
+  TORCH_CHECK(
+      values.dim() >= 1,
+      "expected 'values' to be at least 1D, but got 0D");
+  auto offsets_t = offsets_.contiguous();
+  checkRaggedOffsets(offsets_t);
+  checkRaggedTotal(offsets_t, values.size(0));
+  const int64_t batch_size = offsets_t.size(0) - 1;
+  const int64_t* offsets = offsets_t.data_ptr<int64_t>();
+
+  int64_t longest = 0;
+  for (const auto i : c10::irange(batch_size)) {
+    longest = std::max(longest, offsets[i + 1] - offsets[i]);
+  }
+  if (max_len < 0) {
+    max_len = longest;
+  } else {
+    TORCH_CHECK(
+        max_len >= longest,
+        "Expected max_len to be at least the length of the longest "
+        "sequence in 'values', but got max_len=", max_len,
+        " and max sequence length being ", longest);
+  }
+
+  std::vector<int64_t> out_dims; // == [batch_size, max_len, *values.size()[1:]]
+  out_dims.reserve(values.dim() + 1);
+  out_dims.push_back(batch_size);
+  out_dims.push_back(max_len);
+  auto trailing_dims = values.sizes().slice(1);
+  out_dims.insert(out_dims.end(), trailing_dims.begin(), trailing_dims.end());
+
+  Tensor out = at::full(out_dims, padding_value, values.options());
+  for (const auto i : c10::irange(batch_size)) {
+    const int64_t length = offsets[i + 1] - offsets[i];
+    if (length > 0) {
+      out.select(0, i).narrow(0, 0, length).copy_(
+          values.slice(0, offsets[i], offsets[i + 1]));
+    }
+  }
+  return out;
+}
+
+// Batched matmul of a ragged batch against a regular (dense) batch of
+// matrices.  Segment i of `self` ([len_i, K]) is multiplied with mat2[i]
+// ([K, N]); the result is ragged with the same offsets as the input, and
+// no FLOPs are spent on padded rows.
+Tensor _ragged_bmm(
+    const Tensor& self,
+    const Tensor& offsets_,
+    const Tensor& mat2) {
+  TORCH_CHECK(
+      self.dim() == 2,
+      "expected 'self' to be a 2D packed-ragged tensor, but got ",
+      self.dim(), "D");
+  TORCH_CHECK(
+      mat2.dim() == 3,
+      "expected 'mat2' to be a 3D batch of matrices, but got ",
+      mat2.dim(), "D");
+  auto offsets_t = offsets_.contiguous();
+  checkRaggedOffsets(offsets_t);
+  checkRaggedTotal(offsets_t, self.size(0));
+  const int64_t batch_size = offsets_t.size(0) - 1;
+  TORCH_CHECK(
+      mat2.size(0) == batch_size,
+      "expected 'mat2' to have batch size ", batch_size, ", but got ",
+      mat2.size(0));
+  TORCH_CHECK(
+      mat2.size(1) == self.size(1),
+      "mat1 and mat2 shapes cannot be multiplied (ragged x ",
+      self.size(1), " and ", mat2.size(1), "x", mat2.size(2), ")");
+  const int64_t* offsets = offsets_t.data_ptr<int64_t>();
+
+  std::vector<Tensor> products;
+  products.reserve(batch_size);
+  for (const auto i : c10::irange(batch_size)) {
+    products.push_back(
+        self.slice(0, offsets[i], offsets[i + 1]).mm(mat2.select(0, i)));
+  }
+  return at::cat(products, 0);
+}
+
+// Softmax over the ragged dimension: within each segment, dim 0 of the
+// segment is normalized independently (per trailing-dim column).  This is
+// the normalization step of attention pooling over variable-length
+// sequences; padded positions neither contribute to the normalizer nor get
+// computed at all.
+Tensor _ragged_softmax(const Tensor& values, const Tensor& offsets_) {
+  TORCH_CHECK(
+      values.dim() >= 1,
+      "expected 'values' to be at least 1D, but got 0D");
+  auto offsets_t = offsets_.contiguous();
+  checkRaggedOffsets(offsets_t);
+  checkRaggedTotal(offsets_t, values.size(0));
+  const int64_t batch_size = offsets_t.size(0) - 1;
+  const int64_t* offsets = offsets_t.data_ptr<int64_t>();
+
+  std::vector<Tensor> segments;
+  segments.reserve(batch_size);
+  for (const auto i : c10::irange(batch_size)) {
+    segments.push_back(
+        values.slice(0, offsets[i], offsets[i + 1]).softmax(0));
+  }
+  return at::cat(segments, 0);
+}
+
+}} // namespace at::native
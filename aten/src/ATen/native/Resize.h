@@ -149,10 +149,11 @@ static inline void checkSetStorage(Tensor& result, Storage storage, int64_t stor
 }
 
 /**
- * Set self's sizes, strides, and storage_offset.
- * (size, stride, storage_offset) must be in bounds for self's storage.
+ * Validate that (size, stride, storage_offset) describes a view that is in
+ * bounds for self's storage. Shared between setStrided and the view creation
+ * fast path in as_strided_tensorimpl.
  */
-inline void setStrided(
+inline void checkStrided(
     const Tensor& self,
     IntArrayRef size,
     IntArrayRef stride,
@@ -161,20 +162,33 @@ inline void setStrided(
   auto* self_ = self.unsafeGetTensorImpl();
   checkInBoundsForStorage(
       size, stride, storage_offset, self_->dtype(), self_->storage());
+  TORCH_CHECK(storage_offset >= 0, "Tensor: invalid storage offset ", storage_offset);
+  for (auto val : stride) {
+    TORCH_CHECK(val >= 0,
+                "as_strided: Negative strides are not supported at the moment, "
+                "got strides: ", stride);
+  }
+}
+
+/**
+ * Set self's sizes, strides, and storage_offset.
+ * (size, stride, storage_offset) must be in bounds for self's storage.
+ */
+inline void setStrided(
+    const Tensor& self,
+    IntArrayRef size,
+    IntArrayRef stride,
+    int64_t storage_offset) {
+  checkStrided(self, size, stride, storage_offset);
+  auto* self_ = self.unsafeGetTensorImpl();
 
   /* storage offset */
-  TORCH_CHECK(storage_offset >= 0, "Tensor: invalid storage offset ", storage_offset);
   self_->set_storage_offset(storage_offset);
 
   /* size and stride */
   if (self_->sizes() == size && self_->strides() == stride) {
     return;
   }
-  for (auto val : stride) {
-    TORCH_CHECK(val >= 0,
-                "as_strided: Negative strides are not supported at the moment, "
-                "got strides: ", stride);
-  }
   self_->set_sizes_and_strides(size, stride);
 }
 
@@ -276,6 +276,115 @@ void quantile_impl(
   out.copy_(values_below);
 }
 
+// Note [Approximate quantile sketch]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// quantile() fully sorts the input, which for very large telemetry-style
+// tensors costs O(n log n) time and a full copy of the data.  The sketch
+// below supports _approx_quantile: a KLL-style compactor hierarchy that
+// streams through the data once in O(n) at memory-bandwidth speed and keeps
+// only O(sketch_size * log(n / sketch_size)) values.
+//
+// Level l holds values that each represent 2^l input values.  When a level
+// fills up it is sorted and every other element is promoted to the next
+// level; the surviving parity alternates between compactions so the
+// discarded mass does not bias one direction.  Each compaction at level l
+// perturbs ranks by at most 2^l, so the total rank error is bounded by
+// roughly n * log2(n / sketch_size) / sketch_size — about 0.3% of n for the
+// default sketch_size of 2048 at n = 1e5, shrinking relative to tighter
+// sketches and growing only logarithmically with n.  Per-thread sketches are
+// filled via parallel_for and merged, which adds one extra compaction per
+// level in the worst case.
+template <typename scalar_t>
+struct QuantileSketch {
+  explicit QuantileSketch(int64_t k) : k_(k) {}
+
+  void insert(scalar_t v) {
+    if (levels_.empty()) {
+      levels_.emplace_back();
+      levels_[0].reserve(k_);
+    }
+    levels_[0].push_back(v);
+    count_++;
+    if (static_cast<int64_t>(levels_[0].size()) >= k_) {
+      compact(0);
+    }
+  }
+
+  void merge(QuantileSketch<scalar_t>&& other) {
+    for (size_t l = 0; l < other.levels_.size(); l++) {
+      if (levels_.size() <= l) {
+        levels_.emplace_back();
+      }
+      levels_[l].insert(
+          levels_[l].end(), other.levels_[l].begin(), other.levels_[l].end());
+    }
+    count_ += other.count_;
+    for (size_t l = 0; l < levels_.size(); l++) {
+      if (static_cast<int64_t>(levels_[l].size()) >= k_) {
+        compact(l);
+      }
+    }
+  }
+
+  // Returns the approximate q-quantile with linear interpolation between
+  // the two straddling weighted samples.
+  double query(double q) const {
+    std::vector<std::pair<scalar_t, int64_t>> samples; // (value, weight)
+    for (size_t l = 0; l < levels_.size(); l++) {
+      for (scalar_t v : levels_[l]) {
+        samples.emplace_back(v, static_cast<int64_t>(1) << l);
+      }
+    }
+    TORCH_INTERNAL_ASSERT(!samples.empty());
+    std::sort(samples.begin(), samples.end());
+
+    int64_t total_weight = 0;
+    for (const auto& sample : samples) {
+      total_weight += sample.second;
+    }
+    const double target = q * static_cast<double>(total_weight - 1);
+
+    // walk the weighted CDF to the two samples straddling the target rank
+    double rank = 0;
+    for (size_t i = 0; i + 1 < samples.size(); i++) {
+      double next_rank = rank + (samples[i].second + samples[i + 1].second) / 2.0;
+      if (target <= next_rank) {
+        const double weight = (target - rank) / (next_rank - rank);
+        return static_cast<double>(samples[i].first) +
+            weight *
+                (static_cast<double>(samples[i + 1].first) -
+                 static_cast<double>(samples[i].first));
+      }
+      rank = next_rank;
+    }
+    return static_cast<double>(samples.back().first);
+  }
+
+ private:
+  void compact(size_t l) {
+    auto& buf = levels_[l];
+    std::sort(buf.begin(), buf.end());
+    if (levels_.size() <= l + 1) {
+      levels_.emplace_back();
+      levels_[l + 1].reserve(k_);
+    }
+    auto& next = levels_[l + 1];
+    for (size_t i = parity_; i < buf.size(); i += 2) {
+      next.push_back(buf[i]);
+    }
+    parity_ ^= 1;
+    buf.clear();
+    if (static_cast<int64_t>(next.size()) >= k_) {
+      compact(l + 1);
+    }
+  }
+
+  int64_t k_;
+  size_t parity_ = 0;
+  int64_t count_ = 0;
+  std::vector<std::vector<scalar_t>> levels_;
+};
+
 std::tuple<Tensor&, Tensor&> kthvalue_out_impl_cpu(
     Tensor& values,
     Tensor& indices,
@@ -728,6 +837,60 @@ Tensor nanquantile(
   return at::native::nanquantile(self, q, std::move(dim), keepdim, "linear");
 }
 
+// Single-pass approximate quantiles over the flattened input, see
+// Note [Approximate quantile sketch].  NaNs are not given quantile()'s
+// poisoning semantics; callers that may have NaNs should filter them first.
+Tensor _approx_quantile_cpu(
+    const Tensor& self,
+    const Tensor& q,
+    int64_t sketch_size) {
+  TORCH_CHECK(
+      self.numel() > 0, "_approx_quantile() input tensor must be non-empty");
+  TORCH_CHECK(
+      q.dim() <= 1, "_approx_quantile() q must be a scalar or 1D tensor");
+  TORCH_CHECK(
+      self.scalar_type() == kFloat || self.scalar_type() == kDouble,
+      "_approx_quantile() input tensor must be either float or double dtype");
+  TORCH_CHECK(
+      q.device().is_cpu(),
+      "_approx_quantile() q must be a CPU tensor");
+  TORCH_CHECK(
+      sketch_size >= 8,
+      "_approx_quantile() sketch_size must be at least 8, but got ",
+      sketch_size);
+  auto q_double = q.toType(kDouble).contiguous();
+  TORCH_CHECK(
+      q_double.ge(0).logical_and_(q_double.le(1)).all().item<bool>(),
+      "_approx_quantile() q values must be in the range [0, 1]");
+
+  auto in = self.flatten().contiguous();
+  Tensor out = at::empty(q.sizes(), self.options());
+
+  AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "_approx_quantile_cpu", [&] {
+    const scalar_t* data = in.data_ptr<scalar_t>();
+    const int64_t numel = in.numel();
+    std::vector<QuantileSketch<scalar_t>> partial(
+        at::get_num_threads(), QuantileSketch<scalar_t>(sketch_size));
+    at::parallel_for(
+        0, numel, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+          auto& sketch = partial[at::get_thread_num()];
+          for (const auto i : c10::irange(begin, end)) {
+            sketch.insert(data[i]);
+          }
+        });
+    QuantileSketch<scalar_t> merged(sketch_size);
+    for (auto& sketch : partial) {
+      merged.merge(std::move(sketch));
+    }
+    scalar_t* out_data = out.data_ptr<scalar_t>();
+    const double* q_data = q_double.data_ptr<double>();
+    for (const auto i : c10::irange(q_double.numel())) {
+      out_data[i] = static_cast<scalar_t>(merged.query(q_data[i]));
+    }
+  });
+  return out;
+}
+
 std::tuple<Tensor&, Tensor&> kthvalue_out_cpu(
     const Tensor& self,
     int64_t k,
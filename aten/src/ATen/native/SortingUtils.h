@@ -2,8 +2,11 @@
 
 #include <ATen/NumericUtils.h>
 #include <ATen/native/Resize.h>
+#include <c10/util/SmallVector.h>
 #include <c10/util/irange.h>
 
+#include <cstring>
+
 namespace at {
 namespace native {
 
@@ -87,6 +90,172 @@ inline namespace CPU_CAPABILITY {
 inline namespace DEFAULT {
 #endif
 
+// Maps a floating-point value to an unsigned integer whose ascending order
+// matches the ascending order of the values, by flipping the sign bit of
+// non-negative values and all bits of negative ones. NaNs map to the maximum
+// key so they order after everything else; `largest` complements the key so
+// that the top-k is always the k smallest keys. Only specialized for types
+// where this bit view exists -- the generic template is never called.
+template <typename T>
+struct TopKRadixSelectTraits {
+  static constexpr bool available = false;
+  using key_t = uint64_t;
+  static key_t key(T /*v*/, bool /*largest*/) {
+    return 0;
+  }
+};
+
+template <>
+struct TopKRadixSelectTraits<float> {
+  static constexpr bool available = true;
+  using key_t = uint32_t;
+  static key_t key(float v, bool largest) {
+    key_t u;
+    if (_isnan<float>(v)) {
+      u = std::numeric_limits<key_t>::max();
+    } else {
+      std::memcpy(&u, &v, sizeof(u));
+      u = (u & key_t(1) << 31) ? ~u : (u | key_t(1) << 31);
+    }
+    return largest ? ~u : u;
+  }
+};
+
+template <>
+struct TopKRadixSelectTraits<double> {
+  static constexpr bool available = true;
+  using key_t = uint64_t;
+  static key_t key(double v, bool largest) {
+    key_t u;
+    if (_isnan<double>(v)) {
+      u = std::numeric_limits<key_t>::max();
+    } else {
+      std::memcpy(&u, &v, sizeof(u));
+      u = (u & key_t(1) << 63) ? ~u : (u | key_t(1) << 63);
+    }
+    return largest ? ~u : u;
+  }
+};
+
+// Radix select for the large-row, small-k regime. Determines the k-th key one
+// byte at a time, most significant byte first: each pass histograms the
+// current byte of the surviving candidates, locates the bucket containing the
+// k-th key, and keeps only the keys from that bucket as candidates for the
+// next pass (candidate counts shrink by ~256x per pass). A final sweep over
+// the row emits every element below the k-th key plus enough ties to fill k.
+// Unlike the nth_element path this never materializes a (value, index) pair
+// per input element -- the selection passes touch only the keys.
+template <typename scalar_t, typename accscalar_t>
+void topk_radix_select(
+    TensorAccessor<scalar_t, 1>& mode_values,
+    TensorAccessor<int64_t, 1>& mode_indices,
+    TensorAccessor<scalar_t, 1>& tmp_values,
+    const int64_t k,
+    const int64_t n,
+    const bool largest,
+    const bool sorted) {
+  using traits = TopKRadixSelectTraits<accscalar_t>;
+  using key_t = typename traits::key_t;
+  constexpr int RADIX_BITS = 8;
+  constexpr int RADIX_SIZE = 1 << RADIX_BITS;
+  constexpr key_t BYTE_MASK = RADIX_SIZE - 1;
+
+  int64_t counts[RADIX_SIZE];
+  std::vector<key_t> candidates;
+  key_t kth_key = 0;
+  // rank of the k-th key within the surviving candidate set
+  int64_t k_remaining = k;
+
+  for (int shift = 8 * sizeof(key_t) - RADIX_BITS; shift >= 0;
+       shift -= RADIX_BITS) {
+    const bool first_pass = shift == int(8 * sizeof(key_t)) - RADIX_BITS;
+    std::memset(counts, 0, sizeof(counts));
+    if (first_pass) {
+      for (const auto j : c10::irange(n)) {
+        key_t key = traits::key(static_cast<accscalar_t>(tmp_values[j]), largest);
+        counts[(key >> shift) & BYTE_MASK]++;
+      }
+    } else {
+      for (const key_t key : candidates) {
+        counts[(key >> shift) & BYTE_MASK]++;
+      }
+    }
+
+    int64_t bucket = 0;
+    while (counts[bucket] < k_remaining) {
+      k_remaining -= counts[bucket];
+      bucket++;
+    }
+    kth_key |= key_t(bucket) << shift;
+
+    if (shift == 0) {
+      break;
+    }
+
+    // keep only the keys from the k-th bucket as candidates for refinement
+    std::vector<key_t> next_candidates;
+    next_candidates.reserve(counts[bucket]);
+    const key_t prefix = kth_key >> shift;
+    if (first_pass) {
+      for (const auto j : c10::irange(n)) {
+        key_t key = traits::key(static_cast<accscalar_t>(tmp_values[j]), largest);
+        if ((key >> shift) == prefix) {
+          next_candidates.push_back(key);
+        }
+      }
+    } else {
+      for (const key_t key : candidates) {
+        if ((key >> shift) == prefix) {
+          next_candidates.push_back(key);
+        }
+      }
+    }
+    candidates = std::move(next_candidates);
+  }
+
+  // Emit every element strictly below the k-th key, then fill the remaining
+  // slots with ties, in row order.
+  int64_t num_ties = k_remaining;
+  int64_t out = 0;
+  for (int64_t j = 0; j < n && out < k; j++) {
+    const accscalar_t value = tmp_values[j];
+    const key_t key = traits::key(value, largest);
+    if (key < kth_key || (key == kth_key && num_ties-- > 0)) {
+      mode_values[out] = value;
+      mode_indices[out] = j;
+      out++;
+    }
+  }
+
+  if (sorted) {
+    using elem_t = std::pair<accscalar_t, int64_t>;
+    std::vector<elem_t> top(k);
+    for (const auto j : c10::irange(k)) {
+      top[j].first = mode_values[j];
+      top[j].second = mode_indices[j];
+    }
+    if (largest) {
+      std::sort(top.begin(), top.end(),
+        [](const elem_t& x, const elem_t& y) -> bool {
+          return ((_isnan<accscalar_t>(x.first) && !_isnan<accscalar_t>(y.first)) || (x.first > y.first));
+        });
+    } else {
+      std::sort(top.begin(), top.end(),
+        [](const elem_t& x, const elem_t& y) -> bool {
+          return ((!_isnan<accscalar_t>(x.first) && _isnan<accscalar_t>(y.first)) || (x.first < y.first));
+        });
+    }
+    for (const auto j : c10::irange(k)) {
+      mode_values[j] = top[j].first;
+      mode_indices[j] = top[j].second;
+    }
+  }
+}
+
+// Rows at least this long take the radix-select path when k is small; below
+// it, the candidate bookkeeping does not pay for itself.
+constexpr int64_t TOPK_RADIX_SELECT_MIN_DIM = 4096;
+
 // Core topk loop, shared between CPU and QuantizedCPU
 template <typename scalar_t, typename accscalar_t>
 void topk_impl_loop(
@@ -112,8 +281,17 @@ void topk_impl_loop(
     auto n = dim_size;
     auto use_partial_sort = k * 64 <= n;
 
+    if (TopKRadixSelectTraits<accscalar_t>::available && k > 0 &&
+        use_partial_sort && n >= TOPK_RADIX_SELECT_MIN_DIM) {
+      topk_radix_select<scalar_t, accscalar_t>(
+          mode_values, mode_indices, tmp_values, k, n, largest, sorted);
+      continue;
+    }
+
     using elem_t = std::pair<accscalar_t, int64_t>;
-    std::vector<elem_t> queue(n);
+    // beam-search-sized rows stay on the stack instead of heap-allocating a
+    // queue per row
+    c10::SmallVector<elem_t, 128> queue(n);
     for (const auto j : c10::irange(n)) {
       queue[j].first = tmp_values[j];
       queue[j].second = j;
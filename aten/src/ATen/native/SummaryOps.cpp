@@ -2,15 +2,52 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
 #include <tuple>
+#include <vector>
 
 namespace at { namespace native {
 
 ///////////////// bincount /////////////////
 namespace {
 
+// Large bin counts would blow the per-thread buffers out of cache, at which
+// point the serial loop wins again.
+constexpr int64_t BINCOUNT_MAX_PRIVATIZED_BINS = 1 << 15;
+
+// Accumulates the counts into privatized per-thread bin arrays and combines
+// them afterwards; the serial loop below carries a dependency through the
+// output bins and does not scale otherwise.
+template <typename input_t, typename acc_t, typename weight_fn_t>
+void _bincount_cpu_privatized(
+    const input_t* self_p,
+    int64_t self_size,
+    acc_t* output_p,
+    int64_t nbins,
+    const weight_fn_t& weight_fn) {
+  int num_threads = at::get_num_threads();
+  std::vector<acc_t> buffers(
+      static_cast<size_t>(num_threads) * nbins, acc_t(0));
+  at::parallel_for(0, self_size, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    acc_t* buffer = buffers.data() + at::get_thread_num() * nbins;
+    for (const auto i : c10::irange(begin, end)) {
+      buffer[self_p[i]] += weight_fn(i);
+    }
+  });
+  at::parallel_for(0, nbins, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    for (const auto t : c10::irange(num_threads)) {
+      const acc_t* buffer = buffers.data() + t * nbins;
+      for (const auto i : c10::irange(begin, end)) {
+        output_p[i] += buffer[i];
+      }
+    }
+  });
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -37,6 +74,11 @@ Tensor _bincount_cpu_template(
   nbins = std::max(nbins, minlength); // at least minlength # of bins
 
   const input_t* self_p = self.data_ptr<input_t>();
+  // Privatized floating-point accumulation changes the summation order, so
+  // the weighted case stays serial under deterministic algorithms.
+  bool privatize = self_size >= at::internal::GRAIN_SIZE &&
+      nbins <= BINCOUNT_MAX_PRIVATIZED_BINS && at::get_num_threads() > 1 &&
+      (!has_weights || !at::globalContext().deterministicAlgorithms());
   if (has_weights) {
     output = native::zeros(
         {nbins},
@@ -46,14 +88,26 @@ Tensor _bincount_cpu_template(
         weights.options().pinned_memory_opt());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += weights_p[i];
+    if (privatize) {
+      _bincount_cpu_privatized(
+          self_p, self_size, output_p, nbins,
+          [weights_p](int64_t i) { return weights_p[i]; });
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += weights_p[i];
+      }
     }
   } else {
     output = native::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += 1L;
+    if (privatize) {
+      _bincount_cpu_privatized(
+          self_p, self_size, output_p, nbins,
+          [](int64_t i) { (void)i; return int64_t(1); });
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += 1L;
+      }
     }
   }
   return output;
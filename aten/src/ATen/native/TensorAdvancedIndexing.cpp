@@ -185,6 +185,7 @@ DEFINE_DISPATCH(index_put_with_sort_stub);
 DEFINE_DISPATCH(put_stub);
 DEFINE_DISPATCH(take_stub);
 DEFINE_DISPATCH(masked_fill_stub);
+DEFINE_DISPATCH(masked_add_stub);
 REGISTER_NO_CPU_DISPATCH(index_put_with_sort_stub, index_put_with_sort_fn);
 DEFINE_DISPATCH(masked_select_serial_stub);
 DEFINE_DISPATCH(masked_select_stub);
@@ -520,6 +521,31 @@ Tensor & _index_put_impl_(Tensor & self, const torch::List<c10::optional<Tensor>
     if (std::get<0>(masked_fill_dispatch)) {
       return self.masked_fill_(std::get<1>(masked_fill_dispatch), value.item());
     }
+  } else {
+    // x[mask] += scalar is common in sparsity-masked updates; the generic
+    // path below materializes an int64 index tensor via nonzero() just to
+    // scatter into the masked positions.  When the indices are a single
+    // boolean/byte mask and the value is a scalar, fuse the mask test and
+    // the accumulation into one elementwise pass over self and mask instead.
+    auto masked_add_dispatch = canDispatchToMaskedFill(self, indices, value);
+    if (std::get<0>(masked_add_dispatch)) {
+      const Tensor& mask = std::get<1>(masked_add_dispatch);
+      if (mask.scalar_type() == kByte) {
+        TORCH_WARN("indexing with dtype torch.uint8 is now deprecated," \
+        " please use a dtype torch.bool instead.");
+      }
+      at::assert_no_partial_overlap(self, mask);
+      auto iter = TensorIteratorConfig()
+        .set_check_mem_overlap(false)  // deprecated, but not a hard error
+        .check_all_same_dtype(false)
+        .resize_outputs(false)
+        .add_output(self)
+        .add_input(self)
+        .add_input(mask)
+        .build();
+      masked_add_stub(iter.device_type(), iter, value.item());
+      return self;
+    }
   }
   auto value_ = value;
   if (value.device() != self.device() && value.numel() == 1 && value.dim() == 0) {
@@ -1361,16 +1387,6 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   std::tie(_mask, _self) = expand_outplace(mask, self);
 
   auto shape = _self->sizes();
-  int64_t numel = _mask->sum().item().toLong();
-  at::native::resize_output(result, {numel});
-  if (numel == 0) {
-    return result;
-  }
-
-  // Create strided view of result before feeding into TensorIterator
-  auto strides = DimVector(shape.size(), 0);
-  auto orig_stride = result.strides()[0];
-  auto result_strided = result.as_strided(shape, strides);
 
   // serial kernel
   // serial kernel requires that src is traversed in its logical order. However, TensorIterator might
@@ -1380,6 +1396,17 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   bool use_serial_kernel = (self.numel() < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ) &&
   _self->is_contiguous() && _mask->is_contiguous();
   if (use_serial_kernel) {
+    int64_t numel = _mask->sum().item().toLong();
+    at::native::resize_output(result, {numel});
+    if (numel == 0) {
+      return result;
+    }
+
+    // Create strided view of result before feeding into TensorIterator
+    auto strides = DimVector(shape.size(), 0);
+    auto orig_stride = result.strides()[0];
+    auto result_strided = result.as_strided(shape, strides);
+
     auto iter = TensorIteratorConfig()
       .set_check_mem_overlap(false)  // result is intenionally zero-strided above
       .check_all_same_dtype(false)
@@ -1394,15 +1421,80 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
   }
 
   // Use a prefix sum to record the output locations of the masked elements,
-  // so as to parallel with TensorIterator.
-  auto mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
+  // so as to parallel with TensorIterator. The prefix sum is built in two
+  // parallel phases: count the selected elements of each chunk, scan the
+  // per-chunk counts (cheap -- there is one count per chunk, not per
+  // element), then expand each chunk's running sum in parallel seeded with
+  // its chunk offset. The final running sum doubles as the output length, so
+  // no separate mask.sum() pass is needed.
   auto mask_prefix_sum = at::empty(shape, self.options().dtype(at::kLong));
-  auto mask_long_data = mask_long.data_ptr<int64_t>();
   auto mask_prefix_sum_data = mask_prefix_sum.data_ptr<int64_t>();
-  // TODO: Here can only use std::partial_sum for C++14,
-  // use std::exclusive_scan when PyTorch upgrades to C++17, which have better peformance.
-  // std::exclusive_scan(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data, 0);
-  std::partial_sum(mask_long_data, mask_long_data + mask_long.numel(), mask_prefix_sum_data);
+  const int64_t mask_numel = _mask->numel();
+  const int64_t chunk_size = at::internal::GRAIN_SIZE;
+  const int64_t num_chunks = at::divup(mask_numel, chunk_size);
+  std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+
+  // A one-byte mask (Bool or Byte) that is contiguous can be scanned in
+  // place; otherwise materialize it as int64 first, as before.
+  Tensor mask_long;
+  const uint8_t* mask_byte_data = nullptr;
+  const int64_t* mask_long_data = nullptr;
+  if (_mask->is_contiguous()) {
+    mask_byte_data = reinterpret_cast<const uint8_t*>(_mask->data_ptr());
+  } else {
+    mask_long = at::empty(shape, self.options().dtype(at::kLong)).copy_(*_mask);
+    mask_long_data = mask_long.data_ptr<int64_t>();
+  }
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto chunk : c10::irange(begin, end)) {
+      const int64_t chunk_begin = chunk * chunk_size;
+      const int64_t chunk_end = std::min(chunk_begin + chunk_size, mask_numel);
+      int64_t count = 0;
+      if (mask_byte_data != nullptr) {
+        for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+          count += mask_byte_data[i] != 0;
+        }
+      } else {
+        for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+          count += mask_long_data[i] != 0;
+        }
+      }
+      chunk_offsets[chunk + 1] = count;
+    }
+  });
+  for (const auto chunk : c10::irange(num_chunks)) {
+    chunk_offsets[chunk + 1] += chunk_offsets[chunk];
+  }
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (const auto chunk : c10::irange(begin, end)) {
+      const int64_t chunk_begin = chunk * chunk_size;
+      const int64_t chunk_end = std::min(chunk_begin + chunk_size, mask_numel);
+      int64_t running = chunk_offsets[chunk];
+      if (mask_byte_data != nullptr) {
+        for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+          running += mask_byte_data[i] != 0;
+          mask_prefix_sum_data[i] = running;
+        }
+      } else {
+        for (const auto i : c10::irange(chunk_begin, chunk_end)) {
+          running += mask_long_data[i] != 0;
+          mask_prefix_sum_data[i] = running;
+        }
+      }
+    }
+  });
+
+  const int64_t numel = chunk_offsets[num_chunks];
+  at::native::resize_output(result, {numel});
+  if (numel == 0) {
+    return result;
+  }
+
+  // Create strided view of result before feeding into TensorIterator
+  auto strides = DimVector(shape.size(), 0);
+  auto orig_stride = result.strides()[0];
+  auto result_strided = result.as_strided(shape, strides);
 
   auto iter = TensorIteratorConfig()
     .set_check_mem_overlap(false)  // result is intenionally zero-strided above
@@ -1435,7 +1527,7 @@ Tensor masked_select_backward(const Tensor& grad, const Tensor& input, const Ten
   // to explicitly broadcast here (the out-of-place variant of masked_scatter
   // implicitly handles broadcasting).
   auto result = at::zeros_like(
-      input.expand(at::infer_size(input.sizes(), mask.sizes())), at::MemoryFormat::Preserve);
+      input.expand(at::infer_size_dimvector(input.sizes(), mask.sizes())), at::MemoryFormat::Preserve);
   return result.masked_scatter_(mask, grad);
 }
 
@@ -1458,13 +1550,13 @@ inline std::tuple<Tensor, Tensor, int64_t> _take_along_dim_helper(
   DimVector self_sizes{self.sizes()};
   // update number of elements at dim as per indices
   self_sizes[dim] = indices.size(dim);
-  auto broadcast_shape = infer_size(self_sizes, indices.sizes());
+  auto broadcast_shape = infer_size_dimvector(self_sizes, indices.sizes());
   auto indices_broadcasted = at::broadcast_to(indices, broadcast_shape);
 
   DimVector indices_sizes{indices.sizes()};
   // update number of elements at dim as per self
   indices_sizes[dim] = self.size(dim);
-  broadcast_shape = infer_size(indices_sizes, self.sizes());
+  broadcast_shape = infer_size_dimvector(indices_sizes, self.sizes());
   auto self_broadcasted = at::broadcast_to(self, broadcast_shape);
 
   return std::make_tuple(self_broadcasted, indices_broadcasted, dim);
@@ -1,5 +1,4 @@
 #include <ATen/ATen.h>
-#include <ATen/CPUApplyUtils.h>
 #include <ATen/Dispatch.h>
 #include <ATen/ExpandUtils.h>
 #include <ATen/NativeFunctions.h>
@@ -10,6 +9,8 @@
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/TensorIndexing.h>
 
+#include <limits>
+
 namespace at {
 namespace meta {
 
@@ -111,6 +112,7 @@ DEFINE_DISPATCH(clamp_scalar_stub); // NOLINT(cppcoreguidelines-avoid-non-const-
 DEFINE_DISPATCH(clamp_min_scalar_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(clamp_max_scalar_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(isin_default_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(fused_clip_where_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 bool allclose(const Tensor& self, const Tensor& other, double rtol, double atol, bool equal_nan) {
   return at::isclose(self, other, rtol, atol, equal_nan).all().item<uint8_t>();
@@ -359,6 +361,59 @@ std::vector<Tensor> where(const Tensor& condition) {
   return condition.nonzero_numpy();
 }
 
+// Note [Fused clip/where chains]
+// Post-processing pipelines commonly clamp a tensor and then select between
+// the clamped value and a fallback based on a comparison against a scalar
+// threshold, e.g. where(x > t, x.clamp(lo, hi), other). Eagerly that is up
+// to five TensorIterator sweeps (comparison, clamp_min, clamp_max, where,
+// plus materializing the bool mask), each bound by memory traffic.
+// _fused_clip_where runs the whole chain in one branchless pass: the
+// comparison produces an all-ones lane mask and Vectorized<T>::blendv
+// selects between the clamped value and `other` without the mask ever
+// leaving registers. Both clamp bounds are optional, so the op also covers
+// plain compare-and-select and one-sided clip chains. As with _fused_unary,
+// an explicit entry point was chosen over a dispatcher peephole: eager
+// dispatch has no buffering point where the chain could be recognized.
+static FusedCmpOp parse_fused_cmp_op(c10::string_view cmp) {
+  if (cmp == "gt") {
+    return FusedCmpOp::Gt;
+  }
+  if (cmp == "ge") {
+    return FusedCmpOp::Ge;
+  }
+  if (cmp == "lt") {
+    return FusedCmpOp::Lt;
+  }
+  if (cmp == "le") {
+    return FusedCmpOp::Le;
+  }
+  if (cmp == "eq") {
+    return FusedCmpOp::Eq;
+  }
+  if (cmp == "ne") {
+    return FusedCmpOp::Ne;
+  }
+  TORCH_CHECK(
+      false,
+      "_fused_clip_where: unsupported comparison '",
+      cmp,
+      "'; expected one of gt, ge, lt, le, eq, ne");
+}
+
+Tensor fused_clip_where_cpu(
+    const Tensor& self,
+    const Tensor& other,
+    const Scalar& threshold,
+    c10::string_view cmp,
+    const c10::optional<Scalar>& min,
+    const c10::optional<Scalar>& max) {
+  auto cmp_op = parse_fused_cmp_op(cmp);
+  Tensor result;
+  auto iter = TensorIterator::binary_op(result, self, other);
+  fused_clip_where_stub(iter.device_type(), iter, threshold, cmp_op, min, max);
+  return iter.output();
+}
+
 Tensor _s_where(const Tensor& condition, const Tensor& self, const Tensor& other) {
   TORCH_CHECK(self.dtype() == other.dtype(), "expected scalar type ", self.dtype(), " but found ", other.dtype());
   Tensor ret = at::empty(self.sizes(), self.options());
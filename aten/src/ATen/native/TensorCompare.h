@@ -1,6 +1,9 @@
 #pragma once
 
 #include <ATen/native/DispatchStub.h>
+#include <c10/util/Optional.h>
+
+#include <cstdint>
 
 namespace c10 {
 class Scalar;
@@ -43,4 +46,23 @@ DECLARE_DISPATCH(void (*)(TensorIterator &, c10::Scalar), clamp_max_scalar_stub)
 
 using isin_default_fn = void (*)(const Tensor&, const Tensor&, bool, const Tensor&);
 DECLARE_DISPATCH(isin_default_fn, isin_default_stub);
+
+// The comparisons _fused_clip_where can apply between `self` and its scalar
+// threshold. See Note [Fused clip/where chains] in TensorCompare.cpp.
+enum class FusedCmpOp : uint8_t {
+  Gt,
+  Ge,
+  Lt,
+  Le,
+  Eq,
+  Ne,
+};
+
+using fused_clip_where_fn = void (*)(
+    TensorIteratorBase&,
+    const c10::Scalar&,
+    FusedCmpOp,
+    const c10::optional<c10::Scalar>&,
+    const c10::optional<c10::Scalar>&);
+DECLARE_DISPATCH(fused_clip_where_fn, fused_clip_where_stub);
 }} // namespace at::native
@@ -17,11 +17,14 @@
 #include <c10/util/irange.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/native/UnaryOps.h>
+#include <c10/core/impl/COW.h>
 
 #include <algorithm>
 #include <cctype>
 #include <cmath>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 
 namespace at {
@@ -1379,6 +1382,8 @@ Tensor tensor_complex_backend(ArrayRef<T> values, const TensorOptions& options)
 }
 
 Tensor from_file(c10::string_view filename, c10::optional<bool> shared, c10::optional<int64_t> size,
+    c10::optional<int64_t> offset,
+    c10::optional<bool> readonly,
     c10::optional<ScalarType> dtype,
     c10::optional<Layout> layout,
     c10::optional<Device> device,
@@ -1388,9 +1393,24 @@ Tensor from_file(c10::string_view filename, c10::optional<bool> shared, c10::opt
 
     TORCH_CHECK(!options.pinned_memory(), "tensors constructed from a file cannot be pinned");
     int64_t my_size = size.value_or(0);
+    int64_t byte_offset = offset.value_or(0);
     int flags = shared.value_or(false) ? ALLOCATOR_MAPPED_SHARED : 0;
+    if (readonly.value_or(false)) {
+      // A private (copy-on-write) mapping is already isolated from the file,
+      // so read-only is only meaningful - and only allowed - with shared=True.
+      TORCH_CHECK(flags & ALLOCATOR_MAPPED_SHARED,
+          "from_file: readonly=True requires shared=True");
+      flags |= ALLOCATOR_MAPPED_READONLY;
+    }
     auto my_dtype = options.dtype();
-    size_t size_bytes = my_size * my_dtype.itemsize();
+    TORCH_CHECK(byte_offset >= 0, "from_file: offset must be non-negative, got ", byte_offset);
+    TORCH_CHECK(byte_offset % my_dtype.itemsize() == 0,
+        "from_file: offset (", byte_offset, ") must be a multiple of the element size (",
+        my_dtype.itemsize(), ")");
+    // The mapping always starts at the beginning of the file; a nonzero
+    // offset selects a region of it via the tensor's storage offset. The
+    // prefix only costs virtual address space - its pages are never touched.
+    size_t size_bytes = byte_offset + my_size * my_dtype.itemsize();
     auto storage_impl = c10::make_intrusive<at::StorageImpl>(
         c10::StorageImpl::use_byte_size_t(),
         size_bytes,
@@ -1400,15 +1420,93 @@ Tensor from_file(c10::string_view filename, c10::optional<bool> shared, c10::opt
         /*resizable=*/false);
     auto tensor = detail::make_tensor<at::TensorImpl>(
         storage_impl, at::DispatchKey::CPU, my_dtype);
+    tensor.unsafeGetTensorImpl()->set_storage_offset(byte_offset / my_dtype.itemsize());
     tensor.unsafeGetTensorImpl()->set_sizes_contiguous({my_size});
     return tensor;
 }
 
+// Applies an madvise paging hint to the bytes of a tensor backed by a
+// memory-mapped file (see from_file). willneed prefetches the region from
+// disk; dontneed drops its resident pages so other tensors can use the page
+// cache. Hints are advisory: they never change the contents of the tensor.
+void mmap_advise(Tensor& self, c10::string_view advice) {
+  auto* allocator = MapAllocator::fromDataPtr(self.storage().data_ptr());
+  if (allocator == nullptr) {
+    allocator = RefcountedMapAllocator::fromDataPtr(self.storage().data_ptr());
+  }
+  TORCH_CHECK(allocator != nullptr,
+      "_mmap_advise: tensor is not backed by a memory-mapped file");
+
+  const auto my_advice = [&]() -> MappedAdvice {
+    if (advice == "normal") {
+      return ALLOCATOR_ADVICE_NORMAL;
+    } else if (advice == "sequential") {
+      return ALLOCATOR_ADVICE_SEQUENTIAL;
+    } else if (advice == "random") {
+      return ALLOCATOR_ADVICE_RANDOM;
+    } else if (advice == "willneed") {
+      return ALLOCATOR_ADVICE_WILLNEED;
+    } else if (advice == "dontneed") {
+      return ALLOCATOR_ADVICE_DONTNEED;
+    }
+    TORCH_CHECK(false, "_mmap_advise: unknown advice '", advice,
+        "'; expected one of normal, sequential, random, willneed, dontneed");
+  }();
+
+  const auto itemsize = static_cast<int64_t>(self.dtype().itemsize());
+  const int64_t start = self.storage_offset() * itemsize;
+  // For a non-contiguous view the element span is not a single range, so
+  // advise the rest of the storage instead.
+  const int64_t length = self.is_contiguous()
+      ? self.numel() * itemsize
+      : static_cast<int64_t>(self.storage().nbytes()) - start;
+  allocator->advise(my_advice, start, length);
+}
+
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ clone ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
+namespace {
+
+// Opt-in gate for copy-on-write clones (see Note [Copy-on-write storages]):
+// eligible clones become O(1) aliases whose copy is deferred until the first
+// data access of either alias, and skipped entirely when all but one alias
+// are released untouched.
+bool cow_clone_enabled() {
+  static const char* enable_c_str = std::getenv("PYTORCH_COW_CLONE");
+  return enable_c_str != nullptr && std::strcmp(enable_c_str, "1") == 0;
+}
+
+// A copy-on-write alias replicates the source tensor exactly, so the source
+// must already have the layout a clone would produce: contiguous, covering
+// its whole storage, and without pending conjugation/negation.
+bool clone_can_use_cow(const Tensor& src, MemoryFormat memory_format) {
+  if (memory_format != MemoryFormat::Preserve &&
+      memory_format != MemoryFormat::Contiguous) {
+    return false;
+  }
+  if (!src.has_storage() || !src.is_contiguous() ||
+      src.storage_offset() != 0 || src.is_conj() || src.is_neg()) {
+    return false;
+  }
+  return static_cast<size_t>(src.numel()) * src.dtype().itemsize() ==
+      src.storage().nbytes();
+}
+
+} // namespace
+
 Tensor clone(const Tensor& src, c10::optional<c10::MemoryFormat> optional_memory_format) {
   auto memory_format =
       optional_memory_format.value_or(MemoryFormat::Preserve);
+  if (cow_clone_enabled() && clone_can_use_cow(src, memory_format)) {
+    if (auto storage_impl = c10::impl::cow::lazy_clone_storage(
+            *src.storage().unsafeGetStorageImpl())) {
+      auto tensor = detail::make_tensor<TensorImpl>(
+          Storage(std::move(storage_impl)), src.key_set(), src.dtype());
+      tensor.unsafeGetTensorImpl()->set_sizes_contiguous(src.sizes());
+      namedinference::propagate_names(tensor, src);
+      return tensor;
+    }
+  }
   Tensor self;
   if (memory_format == MemoryFormat::Preserve) {
     if (src.is_non_overlapping_and_dense()) {
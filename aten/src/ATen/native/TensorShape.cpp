@@ -30,6 +30,7 @@ namespace at {
 namespace native {
 
 DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_parallel_stub);
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -198,6 +199,21 @@ Tensor & _cat_out_cpu(TensorList tensors, int64_t dim, Tensor& result) {
     return result;
   }
 
+  // Multi-threaded counterpart of the fast path above, taken when the result
+  // is big enough to split across threads.  It copies raw bytes, so any dtype
+  // qualifies, but conjugate/negative views must fall through to the
+  // TensorIterator path below to get resolved.
+  if (!use_serial_kernel && allContiguous && no_type_promotion) {
+    bool simple_layout = !result.is_conj() && !result.is_neg();
+    for (auto const &tensor : tensors) {
+      simple_layout = simple_layout && !tensor.is_conj() && !tensor.is_neg();
+    }
+    if (simple_layout) {
+      cat_parallel_stub(kCPU, result, tensors, dim);
+      return result;
+    }
+  }
+
   int64_t offset = 0;
   if (reuse_iterator &&
       result.is_contiguous(first_tensor_mem_format) &&
@@ -467,6 +483,93 @@ Tensor cat(TensorList tensors, int64_t dim) {
   return result;
 }
 
+// In-place append of `src` to `self` along `dim`, writing only the new rows.
+// This is the O(new) building block for incrementally grown tensors such as
+// autoregressive attention key/value caches, which would otherwise `cat` (and
+// thus copy) the whole cache on every step. The appended rows must land at
+// the tail of the storage, so `dim` has to be the outermost dimension in
+// memory: moving it to the front must yield a contiguous tensor. The storage
+// is grown geometrically, like std::vector, so an append-one-row-at-a-time
+// loop costs amortized O(rows appended) rather than O(total).
+//
+// Like resize_, this invalidates any views of `self` when the storage has to
+// be reallocated; callers are expected to re-slice after appending.
+Tensor& _append_(Tensor& self, const Tensor& src, int64_t dim) {
+  TORCH_CHECK(
+      self.layout() == kStrided && src.layout() == kStrided,
+      "_append_ is only supported for strided tensors");
+  TORCH_CHECK(
+      self.dim() > 0, "_append_ cannot be applied to a 0-dimensional tensor");
+  TORCH_CHECK(
+      self.dim() == src.dim(),
+      "_append_: self (", self.dim(), " dims) and src (", src.dim(),
+      " dims) must have the same number of dimensions");
+  TORCH_CHECK(
+      self.scalar_type() == src.scalar_type(),
+      "_append_: expected src dtype ", self.scalar_type(), " but got ",
+      src.scalar_type());
+  TORCH_CHECK(
+      self.device() == src.device(),
+      "_append_: expected src on ", self.device(), " but got ", src.device());
+  dim = maybe_wrap_dim(dim, self.dim());
+  for (const auto d : c10::irange(self.dim())) {
+    if (d != dim) {
+      TORCH_CHECK(
+          self.size(d) == src.size(d),
+          "_append_: sizes must match except in dimension ", dim,
+          ", but self has size ", self.size(d), " and src has size ",
+          src.size(d), " in dimension ", d);
+    }
+  }
+
+  // Move `dim` to the front; the result must be contiguous so the appended
+  // rows occupy the tail of the storage and existing rows stay in place.
+  std::vector<int64_t> perm;
+  perm.reserve(self.dim());
+  perm.push_back(dim);
+  for (const auto d : c10::irange(self.dim())) {
+    if (d != dim) {
+      perm.push_back(d);
+    }
+  }
+  Tensor base = self.permute(perm);
+  TORCH_CHECK(
+      base.is_contiguous(),
+      "_append_: the append dimension must be outermost in memory (moving "
+      "dimension ", dim, " to the front must give a contiguous tensor)");
+
+  const int64_t old_rows = self.size(dim);
+  const int64_t new_rows = old_rows + src.size(dim);
+  auto new_sizes = base.sizes().vec();
+  new_sizes[0] = new_rows;
+  const auto row_numel =
+      c10::multiply_integers(new_sizes.begin() + 1, new_sizes.end());
+
+  const auto itemsize = self.dtype().itemsize();
+  const size_t needed_bytes =
+      (self.storage_offset() + new_rows * row_numel) * itemsize;
+  if (row_numel > 0 && self.storage().nbytes() < needed_bytes) {
+    // Reserve capacity geometrically before setting the logical size.
+    // resize_ preserves the flat data prefix when growing a contiguous
+    // tensor along its outermost dimension, and never shrinks the storage
+    // when sizes are reduced again.
+    auto capacity_sizes = new_sizes;
+    capacity_sizes[0] = std::max<int64_t>(new_rows, 2 * old_rows);
+    base.resize_(capacity_sizes);
+  }
+  base.resize_(new_sizes);
+
+  // `base` shares the (possibly reallocated) storage but not the TensorImpl;
+  // publish the new length on self. Strides do not depend on the size of the
+  // outermost-in-memory dimension, so they stay valid.
+  self.unsafeGetTensorImpl()->set_size(dim, new_rows);
+
+  if (src.numel() > 0) {
+    self.narrow(dim, old_rows, src.size(dim)).copy_(src);
+  }
+  return self;
+}
+
 Tensor block_diag(TensorList tensors) {
   Tensor result;
   if (tensors.size() == 0) {
@@ -768,10 +871,13 @@ Tensor make_qtensor(const Tensor& self, IntArrayRef size, IntArrayRef stride, Qu
 
 Tensor as_strided_tensorimpl(const Tensor& self, IntArrayRef size, IntArrayRef stride, optional<int64_t> storage_offset_) {
   auto storage_offset = storage_offset_.value_or(self.storage_offset());
-  auto result = detail::make_tensor<TensorImpl>(
-      c10::TensorImpl::VIEW, Storage(self.storage()), self.key_set(), self.dtype());
-  setStrided(result, size, stride, storage_offset);
-  return result;
+  checkStrided(self, size, stride, storage_offset);
+  // Once the arguments are validated we can take the view creation fast
+  // path, which builds the new impl with its geometry in one shot; see
+  // TensorImpl::shallow_copy_with_strides. This is the hot path for all of
+  // view/slice/select, which funnel their (already in-bounds) geometry here.
+  return Tensor(self.unsafeGetTensorImpl()->shallow_copy_with_strides(
+      size, stride, storage_offset));
 }
 
 Tensor as_strided_qtensorimpl(const Tensor& self, IntArrayRef size, IntArrayRef stride, optional<int64_t> storage_offset_) {
@@ -1030,9 +1136,10 @@ Tensor alias_with_sizes_and_strides(
       c10::TensorImpl::VIEW, Storage(self.storage()), self.key_set(), self.dtype(), get_qtensorimpl(self)->quantizer());
     setStrided(self_, sizes, strides, self.storage_offset());
   } else {
-    self_ = detail::make_tensor<TensorImpl>(
-      c10::TensorImpl::VIEW, Storage(self.storage()), self.key_set(), self.dtype());
-    setStrided(self_, sizes, strides, self.storage_offset());
+    // The geometry is derived from self, so it is in bounds by construction
+    // and we can take the view creation fast path directly.
+    self_ = Tensor(self.unsafeGetTensorImpl()->shallow_copy_with_strides(
+        sizes, strides, self.storage_offset()));
   }
   namedinference::propagate_names(self_, self);
   return self_;
@@ -5,7 +5,6 @@
 #include <ATen/MemoryOverlap.h>
 #include <ATen/WrapDimUtils.h>
 
-#include <ATen/CPUApplyUtils.h>
 #include <ATen/Parallel.h>
 #include <ATen/native/Math.h>
 #include <ATen/native/Resize.h>
@@ -18,6 +17,8 @@
 #include <cmath>
 #include <functional>
 #include <numeric>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <map>
@@ -791,6 +792,58 @@ std::tuple<Tensor&, Tensor&> frexp_out(const Tensor& self,
 Tensor special_gammaln(const Tensor& self) { return self.lgamma(); }
 Tensor& special_gammaln_out(const Tensor& self, Tensor& result) { return at::lgamma_out(result, self); }
 
+// Note [Fused unary chains]
+// A chain like x.neg().exp().reciprocal() runs one TensorIterator sweep per
+// op, so for large tensors it is bound by memory traffic rather than by the
+// arithmetic. _fused_unary applies the whole chain to each element in a
+// single pass: `ops` is a comma-separated list of op names ("neg,exp" and so
+// on) that is parsed here into FusedUnaryOp codes, and the kernel walks that
+// list per element, in both the scalar and the Vectorized loop. Only ops
+// whose functors need no extra arguments are supported; anything else still
+// composes with the fused chain through ordinary eager calls around it.
+static FusedUnaryOp parse_fused_unary_op(c10::string_view name) {
+  static const std::unordered_map<std::string, FusedUnaryOp> ops = {
+      {"abs", FusedUnaryOp::Abs},
+      {"ceil", FusedUnaryOp::Ceil},
+      {"erf", FusedUnaryOp::Erf},
+      {"exp", FusedUnaryOp::Exp},
+      {"floor", FusedUnaryOp::Floor},
+      {"frac", FusedUnaryOp::Frac},
+      {"log", FusedUnaryOp::Log},
+      {"neg", FusedUnaryOp::Neg},
+      {"reciprocal", FusedUnaryOp::Reciprocal},
+      {"round", FusedUnaryOp::Round},
+      {"rsqrt", FusedUnaryOp::Rsqrt},
+      {"sigmoid", FusedUnaryOp::Sigmoid},
+      {"sqrt", FusedUnaryOp::Sqrt},
+      {"tanh", FusedUnaryOp::Tanh},
+      {"trunc", FusedUnaryOp::Trunc},
+  };
+  auto it = ops.find(std::string(name));
+  TORCH_CHECK(
+      it != ops.end(), "_fused_unary: unsupported op '", name, "'");
+  return it->second;
+}
+
+Tensor fused_unary_cpu(const Tensor& self, c10::string_view ops) {
+  TORCH_CHECK(!ops.empty(), "_fused_unary: expected at least one op");
+  std::vector<FusedUnaryOp> chain;
+  size_t pos = 0;
+  while (true) {
+    auto comma = ops.find(',', pos);
+    auto len = (comma == c10::string_view::npos ? ops.size() : comma) - pos;
+    chain.push_back(parse_fused_unary_op(ops.substr(pos, len)));
+    if (comma == c10::string_view::npos) {
+      break;
+    }
+    pos = comma + 1;
+  }
+  Tensor result;
+  auto iter = TensorIterator::unary_float_op(result, self);
+  fused_unary_stub(iter.device_type(), iter, chain);
+  return iter.output();
+}
+
 DEFINE_DISPATCH(abs_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(angle_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(real_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -813,6 +866,7 @@ DEFINE_DISPATCH(erf_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-va
 DEFINE_DISPATCH(erfc_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(erfinv_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(exp_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_DISPATCH(fused_unary_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(exp2_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(expm1_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_DISPATCH(floor_stub); // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -2,6 +2,8 @@
 
 #include <ATen/native/DispatchStub.h>
 #include <ATen/Generator.h>
+#include <c10/util/ArrayRef.h>
+#include <cstdint>
 #include <stdexcept>
 
 namespace at {
@@ -15,6 +17,29 @@ namespace at { namespace native {
 using unary_fn = void(*)(TensorIteratorBase&);
 using unary_fn_with_scalar = void(*)(TensorIteratorBase&, const Scalar& a);
 
+// The unary ops that _fused_unary can chain in a single pass.
+// See Note [Fused unary chains] in UnaryOps.cpp.
+enum class FusedUnaryOp : uint8_t {
+  Abs,
+  Ceil,
+  Erf,
+  Exp,
+  Floor,
+  Frac,
+  Log,
+  Neg,
+  Reciprocal,
+  Round,
+  Rsqrt,
+  Sigmoid,
+  Sqrt,
+  Tanh,
+  Trunc,
+};
+using fused_unary_fn =
+    void (*)(TensorIteratorBase&, c10::ArrayRef<FusedUnaryOp>);
+DECLARE_DISPATCH(fused_unary_fn, fused_unary_stub);
+
 DECLARE_DISPATCH(unary_fn, abs_stub);
 DECLARE_DISPATCH(unary_fn, angle_stub);
 DECLARE_DISPATCH(unary_fn, real_stub);
@@ -95,6 +95,47 @@ void cpu_avg_pool(
   }
 }
 
+// Walks one pooling window for all channel lanes, keeping the running sum in
+// vector registers across the whole window and folding the divide into the
+// final store, instead of streaming partial sums through the output buffer.
+// KH/KW are compile-time window extents so that common 2x2/3x3 windows get
+// fully unrolled; KH == 0 selects the runtime-bound fallback used for border
+// windows and uncommon kernel sizes.
+template <typename scalar_t, int64_t KH = 0, int64_t KW = 0>
+inline void cpu_avg_pool_window_channels_last(
+    scalar_t* out,
+    const scalar_t* in,
+    int64_t kh, int64_t kw,
+    int64_t divide_factor,
+    int64_t input_width, int64_t channels,
+    int64_t len, int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+
+  const int64_t rows = KH > 0 ? KH : kh;
+  const int64_t cols = KW > 0 ? KW : kw;
+
+  int64_t d = 0;
+  for (; d < len; d += Vec::size()) {
+    Vec sum_vec = Vec(scalar_t(0));
+    for (int64_t h = 0; h < rows; h++) {
+      for (int64_t w = 0; w < cols; w++) {
+        sum_vec = sum_vec + Vec::loadu(in + (h * input_width + w) * channels + d);
+      }
+    }
+    Vec out_vec = sum_vec / Vec(scalar_t(divide_factor));
+    out_vec.store(out + d);
+  }
+  for (; d < size; d++) {
+    scalar_t sum = 0;
+    for (int64_t h = 0; h < rows; h++) {
+      for (int64_t w = 0; w < cols; w++) {
+        sum += in[(h * input_width + w) * channels + d];
+      }
+    }
+    out[d] = sum / divide_factor;
+  }
+}
+
 template <typename scalar_t>
 void cpu_avg_pool_channels_last(
     const Tensor& output_,
@@ -155,47 +196,39 @@ void cpu_avg_pool_channels_last(
 
       scalar_t* out = output_data + i * channels;
 
-      // Pass I: zero the out lane
-      int64_t d1 = 0;
-      for (; d1 < len; d1 += Vec::size()) {
-        Vec out_vec = Vec(scalar_t(0));
-        out_vec.store(out + d1);
-      }
-      for (; d1 < size; d1++) {
-        out[d1] = scalar_t(0);
-      }
-
       if (ih0 >= ih1 || iw0 >= iw1) {
+        // zero the out lane
+        int64_t d1 = 0;
+        for (; d1 < len; d1 += Vec::size()) {
+          Vec out_vec = Vec(scalar_t(0));
+          out_vec.store(out + d1);
+        }
+        for (; d1 < size; d1++) {
+          out[d1] = scalar_t(0);
+        }
         // move on to next output index
         data_index_step(n, nbatch, oh, output_height, ow, output_width);
         continue;
       }
 
-      // Pass II: compute local sum
-      for (const auto ih : c10::irange(ih0, ih1)) {
-        for (const auto iw : c10::irange(iw0, iw1)) {
-          scalar_t* in = input_data + n * input_height * input_width * channels +
-              ih * input_width * channels + iw * channels;
-
-          int64_t d2 = 0;
-          for (; d2 < len; d2 += Vec::size()) {
-            Vec out_vec = Vec::loadu(out + d2) + Vec::loadu(in + d2);
-            out_vec.store(out + d2);
-          }
-          for (; d2 < size; d2++) {
-            out[d2] += in[d2];
-          }
-        }
-      }
-
-      // Pass III: compute local average
-      int64_t d3 = 0;
-      for (; d3 < len; d3 += Vec::size()) {
-        Vec out_vec = Vec::loadu(out + d3) / Vec(scalar_t(divide_factor));
-        out_vec.store(out + d3);
-      }
-      for (; d3 < size; d3++) {
-        out[d3] = out[d3] / divide_factor;
+      const scalar_t* in = input_data + n * input_height * input_width * channels +
+          ih0 * input_width * channels + iw0 * channels;
+
+      // number of window elements actually visited after border clipping
+      int64_t kh_eff = ih1 - ih0;
+      int64_t kw_eff = iw1 - iw0;
+
+      // dispatch to a compile-time unrolled window walk for the common
+      // 2x2/3x3 interior windows
+      if (kh_eff == 2 && kw_eff == 2) {
+        cpu_avg_pool_window_channels_last<scalar_t, 2, 2>(
+            out, in, kh_eff, kw_eff, divide_factor, input_width, channels, len, size);
+      } else if (kh_eff == 3 && kw_eff == 3) {
+        cpu_avg_pool_window_channels_last<scalar_t, 3, 3>(
+            out, in, kh_eff, kw_eff, divide_factor, input_width, channels, len, size);
+      } else {
+        cpu_avg_pool_window_channels_last<scalar_t>(
+            out, in, kh_eff, kw_eff, divide_factor, input_width, channels, len, size);
       }
 
       // move on to next output index
@@ -13,6 +13,7 @@
 #include <ATen/native/Math.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/copysign.h>
+#include <c10/util/irange.h>
 
 namespace at {
 namespace native {
@@ -29,6 +30,16 @@ void add_kernel(TensorIteratorBase& iter, const Scalar& alpha_scalar) {
       auto alpha = alpha_scalar.to<scalar_t>();
       cpu_kernel(iter,
         [=](scalar_t a, scalar_t b) __ubsan_ignore_undefined__ -> scalar_t { return a + alpha * b; });
+  } else if (iter.dtype() == ScalarType::BFloat16) {
+    auto alpha = alpha_scalar.to<float>();
+    auto alpha_vec = Vectorized<float>(alpha);
+    cpu_kernel_vec_bfloat16(iter,
+      [=](BFloat16 a, BFloat16 b) __ubsan_ignore_undefined__ -> BFloat16 {
+        return float(a) + alpha * float(b);
+      },
+      [=](Vectorized<float> a, Vectorized<float> b) __ubsan_ignore_undefined__ {
+        return vec::fmadd(b, alpha_vec, a);
+      });
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(kBFloat16, kHalf, iter.dtype(), "add_cpu/sub_cpu", [&]() {
       auto alpha = alpha_scalar.to<scalar_t>();
@@ -83,6 +94,10 @@ void sub_kernel(TensorIteratorBase& iter, const Scalar& alpha_scalar) __ubsan_ig
 void mul_kernel(TensorIteratorBase& iter) {
   if (iter.dtype() == ScalarType::Bool) {
     cpu_kernel(iter, [=](bool a, bool b) -> bool { return a && b; });
+  } else if (iter.dtype() == ScalarType::BFloat16) {
+    cpu_kernel_vec_bfloat16(iter,
+      [=](BFloat16 a, BFloat16 b) -> BFloat16 { return float(a) * float(b); },
+      [=](Vectorized<float> a, Vectorized<float> b) { return a * b; });
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(kBFloat16, kHalf, iter.dtype(), "mul_cpu", [&]() {
       cpu_kernel_vec(iter,
@@ -95,6 +110,14 @@ void mul_kernel(TensorIteratorBase& iter) {
 }
 
 void div_true_kernel(TensorIteratorBase& iter) {
+  if (iter.common_dtype() == ScalarType::BFloat16) {
+    cpu_kernel_vec_bfloat16(iter,
+      [](BFloat16 a, BFloat16 b) __ubsan_ignore_float_divide_by_zero__ -> BFloat16 {
+        return float(a) / float(b);
+      },
+      [](Vectorized<float> a, Vectorized<float> b) { return a / b; });
+    return;
+  }
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND2(kBFloat16, kHalf, iter.common_dtype(), "div_cpu", [&]() {
     cpu_kernel_vec(iter,
       [](scalar_t a, scalar_t b) __ubsan_ignore_float_divide_by_zero__ -> scalar_t {
@@ -433,9 +456,62 @@ void rshift_kernel(TensorIteratorBase& iter) {
   }
 }
 
+// Note [Vectorized byte comparisons]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Comparison kernels with bool outputs cannot go through cpu_kernel_vec:
+// vectorized_loop requires every operand to share one lane type, while here
+// the output is bool and the inputs are the common dtype. For one-byte
+// integral inputs the widths do line up, though - bool is stored as a byte
+// holding 0 or 1, which is exactly what the Vectorized predicate methods
+// (eq/ne/lt/...) leave in each lane - so byte tensors (tokenization masks
+// and the like) get an explicit vector loop over the contiguous case
+// instead of the scalar fallback. All other dtypes keep the scalar kernel.
+template <typename scalar_t, typename scalar_op_t, typename vec_op_t>
+void compare_bytes_kernel(
+    TensorIteratorBase& iter,
+    scalar_op_t op,
+    vec_op_t vop) {
+  static_assert(
+      sizeof(scalar_t) == sizeof(bool),
+      "compare_bytes_kernel requires one-byte lanes");
+  using Vec = Vectorized<scalar_t>;
+  iter.for_each([&](char** data, const int64_t* strides, int64_t n) {
+    char* out = data[0];
+    const char* a = data[1];
+    const char* b = data[2];
+    if (strides[0] == sizeof(bool) && strides[1] == sizeof(scalar_t) &&
+        strides[2] == sizeof(scalar_t)) {
+      int64_t i = 0;
+      for (; i + Vec::size() <= n; i += Vec::size()) {
+        vop(Vec::loadu(a + i), Vec::loadu(b + i)).store(out + i);
+      }
+      for (; i < n; i++) {
+        reinterpret_cast<bool*>(out)[i] = op(
+            reinterpret_cast<const scalar_t*>(a)[i],
+            reinterpret_cast<const scalar_t*>(b)[i]);
+      }
+    } else {
+      for (const auto i : c10::irange(n)) {
+        *reinterpret_cast<bool*>(out + strides[0] * i) = op(
+            *reinterpret_cast<const scalar_t*>(a + strides[1] * i),
+            *reinterpret_cast<const scalar_t*>(b + strides[2] * i));
+      }
+    }
+  });
+  iter.cast_outputs();
+}
+
 void lt_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a < b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.lt(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "lt_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
@@ -459,6 +535,14 @@ void lt_kernel(TensorIteratorBase& iter) {
 void le_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a <= b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.le(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "le_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
@@ -482,6 +566,14 @@ void le_kernel(TensorIteratorBase& iter) {
 void gt_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a > b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.gt(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "gt_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
@@ -505,6 +597,14 @@ void gt_kernel(TensorIteratorBase& iter) {
 void ge_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a >= b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.ge(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "ge_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
@@ -528,6 +628,14 @@ void ge_kernel(TensorIteratorBase& iter) {
 void eq_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a == b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.eq(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "eq_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
@@ -551,6 +659,14 @@ void eq_kernel(TensorIteratorBase& iter) {
 void ne_kernel(TensorIteratorBase& iter) {
   // See Note [special-case bool outputs]
   if (iter.dtype() == ScalarType::Bool) {
+    // See Note [Vectorized byte comparisons]
+    if (iter.common_dtype() == ScalarType::Byte) {
+      compare_bytes_kernel<uint8_t>(
+          iter,
+          [](uint8_t a, uint8_t b) -> bool { return a != b; },
+          [](Vectorized<uint8_t> a, Vectorized<uint8_t> b) { return a.ne(b); });
+      return;
+    }
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(kBool, kBFloat16, kHalf, iter.common_dtype(), "ne_cpu", [&]() {
       cpu_kernel(iter,
         [](scalar_t a, scalar_t b) -> bool {
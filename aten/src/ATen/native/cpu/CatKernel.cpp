@@ -1,11 +1,15 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace at { namespace native {
 
 namespace {
@@ -60,8 +64,82 @@ void cat_serial_kernel(Tensor& result, TensorList tensors, int64_t dim) {
   });
 }
 
+// Describes one outer row of the result: the contiguous byte span each input
+// contributes, plus their prefix sums.  Recomputing it is cheap, but cat
+// calls in training loops tend to repeat the same shape list every
+// iteration, so the last plan is kept around per thread and reused.
+struct CatPlan {
+  std::vector<int64_t> span_bytes;
+  std::vector<int64_t> span_offsets; // ninputs + 1 entries
+};
+
+void cat_parallel_kernel(Tensor& result, TensorList tensors, int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(), "dim out of range in cat_parallel_kernel");
+  const int64_t itemsize = result.element_size();
+  const int64_t inner = result.strides()[dim];
+  const int64_t outer = result.numel() / (result.sizes()[dim] * inner);
+  const int64_t ninputs = tensors.size();
+
+  std::vector<int64_t> span_bytes(ninputs);
+  for (const auto j : c10::irange(ninputs)) {
+    span_bytes[j] = tensors[j].sizes()[dim] * inner * itemsize;
+  }
+  thread_local CatPlan plan;
+  if (plan.span_bytes != span_bytes) {
+    plan.span_bytes = span_bytes;
+    plan.span_offsets.resize(ninputs + 1);
+    plan.span_offsets[0] = 0;
+    for (const auto j : c10::irange(ninputs)) {
+      plan.span_offsets[j + 1] = plan.span_offsets[j] + span_bytes[j];
+    }
+  }
+  const std::vector<int64_t>& spans = plan.span_bytes;
+  const std::vector<int64_t>& offsets = plan.span_offsets;
+  const int64_t row_bytes = offsets[ninputs];
+
+  std::vector<const char*> input_data(ninputs);
+  for (const auto j : c10::irange(ninputs)) {
+    input_data[j] = static_cast<const char*>(tensors[j].data_ptr());
+  }
+  char* result_data = static_cast<char*>(result.data_ptr());
+
+  // Partition the output by bytes rather than by input tensor, so the work
+  // stays balanced even when the inputs have very different sizes.  Each
+  // worker owns the half-open byte range [begin, end) of the result and
+  // walks the input spans that project into it.
+  at::parallel_for(
+      0, outer * row_bytes, at::internal::GRAIN_SIZE * itemsize,
+      [&](int64_t begin, int64_t end) {
+        int64_t i = begin / row_bytes; // outer row
+        int64_t r = begin - i * row_bytes; // byte position within the row
+        int64_t j = std::upper_bound(offsets.begin(), offsets.end(), r) -
+            offsets.begin() - 1;
+        int64_t pos = begin;
+        while (pos < end) {
+          int64_t chunk = std::min(spans[j] - (r - offsets[j]), end - pos);
+          if (chunk > 0) {
+            std::memcpy(
+                result_data + pos,
+                input_data[j] + i * spans[j] + (r - offsets[j]),
+                chunk);
+            pos += chunk;
+            r += chunk;
+          }
+          if (r == row_bytes) {
+            r = 0;
+            i++;
+            j = 0;
+          } else if (r == offsets[j + 1]) {
+            j++;
+          }
+        }
+      });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_parallel_stub, &cat_parallel_kernel);
 
 }} // at::native
@@ -1,8 +1,12 @@
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
 #include <ATen/ATen.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec/vec.h>
 #include <c10/util/irange.h>
 
+#include <cstring>
+#include <vector>
+
 #ifdef __ARM_NEON__
 #include <arm_neon.h>
 #endif
@@ -301,9 +305,118 @@ Tensor _convolution_depthwise3x3_winograd(
   return output;
 }
 
+/*
+  Direct NHWC depthwise convolution. In channels_last layout the channel
+  dimension is innermost, so every kernel tap reads and accumulates a
+  contiguous channel vector with Vectorized<float>; no im2col buffer or
+  layout conversion is needed. The (C, 1, kH, kW) weight is repacked once
+  per call into (kH, kW, C) so taps address the channel vector contiguously
+  too. Supports arbitrary kernel size, stride, padding and dilation, with
+  channel multiplier 1 (the gate in Convolution.cpp enforces this).
+*/
+Tensor _convolution_depthwise_nhwc(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& bias,
+    const IntArrayRef stride,
+    const IntArrayRef padding,
+    const IntArrayRef dilation) {
+  using Vec = vec::Vectorized<float>;
+
+  const Tensor input_nhwc = input.contiguous(at::MemoryFormat::ChannelsLast);
+  const Tensor weight_contig = weight.contiguous();
+  const Tensor bias_contig = bias.defined() ? bias.contiguous() : bias;
+
+  const int64_t batch = input_nhwc.size(0);
+  const int64_t channels = input_nhwc.size(1);
+  const int64_t in_rows = input_nhwc.size(2);
+  const int64_t in_cols = input_nhwc.size(3);
+  const int64_t kernel_rows = weight_contig.size(2);
+  const int64_t kernel_cols = weight_contig.size(3);
+  const int64_t stride_rows = stride[0];
+  const int64_t stride_cols = stride[1];
+  const int64_t pad_rows = padding[0];
+  const int64_t pad_cols = padding[1];
+  const int64_t dilation_rows = dilation[0];
+  const int64_t dilation_cols = dilation[1];
+
+  const int64_t out_rows = 1 +
+      (in_rows + 2 * pad_rows - dilation_rows * (kernel_rows - 1) - 1) /
+          stride_rows;
+  const int64_t out_cols = 1 +
+      (in_cols + 2 * pad_cols - dilation_cols * (kernel_cols - 1) - 1) /
+          stride_cols;
+
+  Tensor output = at::empty(
+      {batch, channels, out_rows, out_cols},
+      input_nhwc.options(),
+      at::MemoryFormat::ChannelsLast);
+
+  const float* weight_data = weight_contig.data_ptr<float>();
+  std::vector<float> packed_weight(kernel_rows * kernel_cols * channels);
+  for (const auto c : c10::irange(channels)) {
+    for (const auto kh : c10::irange(kernel_rows)) {
+      for (const auto kw : c10::irange(kernel_cols)) {
+        packed_weight[(kh * kernel_cols + kw) * channels + c] =
+            weight_data[(c * kernel_rows + kh) * kernel_cols + kw];
+      }
+    }
+  }
+
+  const float* input_data = input_nhwc.data_ptr<float>();
+  const float* bias_data =
+      bias_contig.defined() ? bias_contig.data_ptr<float>() : nullptr;
+  float* output_data = output.data_ptr<float>();
+
+  at::parallel_for(0, batch * out_rows, 0, [&](int64_t start, int64_t end) {
+    for (const auto index : c10::irange(start, end)) {
+      const int64_t n = index / out_rows;
+      const int64_t oh = index % out_rows;
+      for (const auto ow : c10::irange(out_cols)) {
+        float* out_px = output_data + (index * out_cols + ow) * channels;
+        if (bias_data != nullptr) {
+          std::memcpy(out_px, bias_data, channels * sizeof(float));
+        } else {
+          std::memset(out_px, 0, channels * sizeof(float));
+        }
+        for (const auto kh : c10::irange(kernel_rows)) {
+          const int64_t ih = oh * stride_rows - pad_rows + kh * dilation_rows;
+          if (ih < 0 || ih >= in_rows) {
+            continue;
+          }
+          for (const auto kw : c10::irange(kernel_cols)) {
+            const int64_t iw = ow * stride_cols - pad_cols + kw * dilation_cols;
+            if (iw < 0 || iw >= in_cols) {
+              continue;
+            }
+            const float* in_px =
+                input_data + ((n * in_rows + ih) * in_cols + iw) * channels;
+            const float* w_px =
+                packed_weight.data() + (kh * kernel_cols + kw) * channels;
+            int64_t c = 0;
+            for (; c + Vec::size() <= channels; c += Vec::size()) {
+              vec::fmadd(
+                  Vec::loadu(in_px + c),
+                  Vec::loadu(w_px + c),
+                  Vec::loadu(out_px + c))
+                  .store(out_px + c);
+            }
+            for (; c < channels; c++) {
+              out_px[c] += in_px[c] * w_px[c];
+            }
+          }
+        }
+      }
+    }
+  });
+
+  return output;
+}
+
 }  // namespace
 
 REGISTER_DISPATCH(convolution_depthwise3x3_winograd_stub, &_convolution_depthwise3x3_winograd);
+REGISTER_DISPATCH(convolution_depthwise_nhwc_stub, &_convolution_depthwise_nhwc);
 
 }  // namespace native
 }  // namespace at
@@ -15,5 +15,20 @@ using convolution_depthwise3x3_winograd_fn =
 
 DECLARE_DISPATCH(convolution_depthwise3x3_winograd_fn, convolution_depthwise3x3_winograd_stub);
 
+/*
+  Direct channels_last (NHWC) depthwise convolution operator, supporting
+  arbitrary kernel size, stride, padding and dilation.
+*/
+
+using convolution_depthwise_nhwc_fn = Tensor (*)(
+    const Tensor& /* input */,
+    const Tensor& /* weight */,
+    const Tensor& /* bias */,
+    IntArrayRef /* stride */,
+    IntArrayRef /* padding */,
+    IntArrayRef /* dilation */);
+
+DECLARE_DISPATCH(convolution_depthwise_nhwc_fn, convolution_depthwise_nhwc_stub);
+
 }  // namespace native
 }  // namespace at
@@ -1,16 +1,19 @@
 #pragma once
 
 #include <ATen/Dispatch.h>
-#include <ATen/CPUApplyUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
+#include <c10/util/irange.h>
+#include <cstdint>
+#include <cstdlib>
 #include <limits>
 #include <mutex>
 
 #ifdef CPU_CAPABILITY_AVX2
 #include <ATen/native/cpu/avx_mathfun.h>
-#include <c10/util/irange.h>
 #endif
 
 
@@ -20,6 +23,69 @@ namespace templates {
 namespace cpu {
 namespace {
 
+// ==================================================== Philox ========================================================
+
+// Note [Parallel Philox path for CPU distributions]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The default CPU kernels draw from the generator's mt19937 engine one scalar
+// at a time under the generator mutex, which serializes large fills. When
+// TORCH_CPU_RNG_PHILOX=1 is set, the contiguous fast paths below switch to
+// the counter-based Philox4x32 engine instead (see Note [Philox Engine
+// implementation]): a single seed is drawn from the generator per fill, each
+// 128-bit counter block yields a fixed number of values, and every
+// parallel_for chunk positions a fresh engine at the counter block of its
+// first element. Threads therefore produce exactly the stream a serial walk
+// would, without sharing any state. The bitstream differs from the mt19937
+// path, so this is opt-in rather than the default.
+inline bool philox_cpu_enabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_CPU_RNG_PHILOX");
+    return env != nullptr && env[0] == '1' && env[1] == '\0';
+  }();
+  return enabled;
+}
+
+// [0, 1) from the high 24 bits, matching the resolution of
+// at::uniform_real_distribution<float>.
+inline float philox_uniform_float(at::Philox4_32_10& engine) {
+  constexpr float POW_2_24_INV = 1.0f / (1ULL << 24);
+  return (engine() >> 8) * POW_2_24_INV;
+}
+
+// [0, 1) from the high 53 bits of two 32-bit draws.
+inline double philox_uniform_double(at::Philox4_32_10& engine) {
+  constexpr double POW_2_53_INV = 1.0 / (1ULL << 53);
+  const uint64_t hi = engine();
+  const uint64_t lo = engine();
+  return (((hi << 32) | lo) >> 11) * POW_2_53_INV;
+}
+
+// Fills `data` with `transform` applied to a per-element Philox stream.
+// `u32s_per_value` is how many 32-bit draws one value consumes; a chunk that
+// starts mid-block discards the leading draws so that every element sees the
+// same draws regardless of how the range was partitioned.
+template <typename scalar_t, typename transform_t>
+void philox_fill(
+    scalar_t* data,
+    int64_t size,
+    uint64_t seed,
+    int64_t u32s_per_value,
+    const transform_t& transform) {
+  const int64_t values_per_block = 4 / u32s_per_value;
+  at::parallel_for(0, size, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    at::Philox4_32_10 engine(seed, 0, begin / values_per_block);
+    const int64_t discard = (begin % values_per_block) * u32s_per_value;
+    for (const auto i : c10::irange(discard)) {
+      (void)i; // Suppress unused variable warning
+      engine();
+    }
+    for (const auto i : c10::irange(begin, end)) {
+      data[i] = transform(engine);
+    }
+  });
+}
+
 // ==================================================== Random ========================================================
 
 template<typename RNG>
@@ -171,9 +237,63 @@ void normal_fill(Tensor& self, const scalar_t mean, const scalar_t std, RNG gene
   }
 }
 
+// See Note [Parallel Philox path for CPU distributions]. Fills the tensor
+// with Philox uniforms, then Box-Muller transforms 16-value blocks in
+// parallel. The trailing window regenerates its uniforms from the same
+// counter positions, since part of it may already have been transformed by
+// the preceding full block.
+template <typename scalar_t>
+void philox_normal_fill(Tensor& self, const scalar_t mean, const scalar_t std, uint64_t seed) {
+  scalar_t* data = self.data_ptr<scalar_t>();
+  const auto size = self.numel();
+  const int64_t u32s_per_value = std::is_same<scalar_t, double>::value ? 2 : 1;
+  const int64_t values_per_block = 4 / u32s_per_value;
+  auto uniform = [u32s_per_value](at::Philox4_32_10& engine) -> scalar_t {
+    return u32s_per_value == 2
+        ? static_cast<scalar_t>(philox_uniform_double(engine))
+        : static_cast<scalar_t>(philox_uniform_float(engine));
+  };
+  philox_fill(data, size, seed, u32s_per_value, uniform);
+
+  const int64_t num_blocks = size / 16;
+  at::parallel_for(0, num_blocks, at::internal::GRAIN_SIZE / 16,
+      [&](int64_t begin, int64_t end) {
+    for (const auto b : c10::irange(begin, end)) {
+      normal_fill_16<scalar_t>(data + b * 16, mean, std);
+    }
+  });
+  if (size % 16 != 0) {
+    // Recompute the last 16 values.
+    scalar_t* tail = data + size - 16;
+    at::Philox4_32_10 engine(seed, 0, (size - 16) / values_per_block);
+    const int64_t discard = ((size - 16) % values_per_block) * u32s_per_value;
+    for (const auto i : c10::irange(discard)) {
+      (void)i; // Suppress unused variable warning
+      engine();
+    }
+    for (const auto i : c10::irange(16)) {
+      tail[i] = uniform(engine);
+    }
+    normal_fill_16<scalar_t>(tail, mean, std);
+  }
+}
+
 template<typename RNG>
 void normal_kernel(Tensor& self, double mean, double std, RNG generator) {
   auto size = self.numel();
+  if (philox_cpu_enabled() && size >= 16 && self.is_contiguous() &&
+      (self.scalar_type() == ScalarType::Float || self.scalar_type() == ScalarType::Double)) {
+    uint64_t seed;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(generator->mutex_);
+      seed = generator->random64();
+    }
+    AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "normal_kernel_philox_cpu", [&] {
+      philox_normal_fill<scalar_t>(self, static_cast<scalar_t>(mean), static_cast<scalar_t>(std), seed);
+    });
+    return;
+  }
   if (self.scalar_type() == ScalarType::Float && size >= 16 && self.is_contiguous()) {
 #ifdef CPU_CAPABILITY_AVX2
     normal_fill_AVX2(self, static_cast<float>(mean), static_cast<float>(std), generator);
@@ -207,6 +327,31 @@ struct NormalKernel {
 
 template<typename RNG>
 void uniform_kernel(TensorIteratorBase& iter, double from_, double to_, RNG generator) {
+  // See Note [Parallel Philox path for CPU distributions]
+  if (philox_cpu_enabled() && iter.is_contiguous() &&
+      (iter.dtype() == ScalarType::Float || iter.dtype() == ScalarType::Double)) {
+    uint64_t seed;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(generator->mutex_);
+      seed = generator->random64();
+    }
+    if (iter.dtype() == ScalarType::Float) {
+      const auto from = static_cast<float>(from_);
+      const auto range = static_cast<float>(to_ - from_);
+      philox_fill(static_cast<float*>(iter.data_ptr(0)), iter.numel(), seed, 1,
+          [from, range](at::Philox4_32_10& engine) -> float {
+        return from + range * philox_uniform_float(engine);
+      });
+    } else {
+      const auto range = to_ - from_;
+      philox_fill(static_cast<double*>(iter.data_ptr(0)), iter.numel(), seed, 2,
+          [from_, range](at::Philox4_32_10& engine) -> double {
+        return from_ + range * philox_uniform_double(engine);
+      });
+    }
+    return;
+  }
   AT_DISPATCH_FLOATING_TYPES_AND2(kHalf, kBFloat16, iter.dtype(), "uniform_kernel_cpu", [&]() {
     std::lock_guard<std::mutex> lock(generator->mutex_);
     auto from = static_cast<scalar_t>(from_);
@@ -339,6 +484,22 @@ void bernoulli_kernel(Tensor& self, const Tensor& p_, RNG generator) {
 
 template<typename RNG>
 void bernoulli_kernel(Tensor& self, double p, RNG generator) {
+  // See Note [Parallel Philox path for CPU distributions]
+  if (philox_cpu_enabled() && self.is_contiguous()) {
+    uint64_t seed;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(generator->mutex_);
+      seed = generator->random64();
+    }
+    AT_DISPATCH_ALL_TYPES_AND2(at::ScalarType::Bool, at::ScalarType::BFloat16, self.scalar_type(), "bernoulli_scalar_philox_cpu_", [&] {
+      philox_fill(self.data_ptr<scalar_t>(), self.numel(), seed, 2,
+          [p](at::Philox4_32_10& engine) -> scalar_t {
+        return static_cast<scalar_t>(philox_uniform_double(engine) < p);
+      });
+    });
+    return;
+  }
   AT_DISPATCH_ALL_TYPES_AND2(at::ScalarType::Bool, at::ScalarType::BFloat16, self.scalar_type(), "bernoulli_scalar_cpu_", [&] {
     // See Note [Acquire lock when using random generators]
     std::lock_guard<std::mutex> lock(generator->mutex_);
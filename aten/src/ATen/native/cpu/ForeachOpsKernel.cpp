@@ -0,0 +1,313 @@
+#include <ATen/ATen.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec/functional.h>
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#include <cstring>
+
+namespace at {
+namespace native {
+namespace {
+
+// The CPU analogue of multi_tensor_apply (see cuda/MultiTensorApply.cuh):
+// the tensor lists are flattened into a queue of fixed-size chunks and one
+// parallel_for spreads the queue over threads, so an optimizer step over
+// thousands of small parameters parallelizes as well as one large tensor
+// and pays for a single dispatch instead of one per tensor.
+constexpr int64_t kChunkSize = 32768;
+
+struct Chunk {
+  size_t tensor; // index into the tensor lists
+  int64_t offset; // element offset into the tensor
+  int64_t size; // number of elements in this chunk
+};
+
+std::vector<Chunk> build_chunks(TensorList tensors) {
+  std::vector<Chunk> chunks;
+  for (const auto t : c10::irange(tensors.size())) {
+    const int64_t numel = tensors[t].numel();
+    for (int64_t offset = 0; offset < numel; offset += kChunkSize) {
+      chunks.push_back({t, offset, std::min(kChunkSize, numel - offset)});
+    }
+  }
+  return chunks;
+}
+
+template <typename scalar_t>
+std::vector<scalar_t*> data_ptrs(TensorList tensors) {
+  std::vector<scalar_t*> ptrs(tensors.size());
+  for (const auto t : c10::irange(tensors.size())) {
+    ptrs[t] = tensors[t].data_ptr<scalar_t>();
+  }
+  return ptrs;
+}
+
+template <typename F>
+void for_each_chunk(const std::vector<Chunk>& chunks, const F& f) {
+  at::parallel_for(
+      0, chunks.size(), /*grain_size=*/1, [&](int64_t begin, int64_t end) {
+        for (const auto i : c10::irange(begin, end)) {
+          f(chunks[i]);
+        }
+      });
+}
+
+// Arithmetic functors applicable to both scalar_t and Vectorized<scalar_t>.
+struct Add {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return a + b;
+  }
+};
+struct Sub {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return a - b;
+  }
+};
+struct Mul {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return a * b;
+  }
+};
+struct Div {
+  template <typename T>
+  T operator()(const T& a, const T& b) const {
+    return a / b;
+  }
+};
+
+template <typename scalar_t, typename Op>
+void binary_scalar_impl(TensorList tensors, const Scalar& scalar, Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const Vec scalar_vec(scalar.to<scalar_t>());
+  const auto chunks = build_chunks(tensors);
+  const auto data = data_ptrs<scalar_t>(tensors);
+  for_each_chunk(chunks, [&](const Chunk& chunk) {
+    scalar_t* ptr = data[chunk.tensor] + chunk.offset;
+    vec::map<scalar_t>(
+        [&](Vec x) { return op(x, scalar_vec); }, ptr, ptr, chunk.size);
+  });
+}
+
+template <typename scalar_t, typename Op>
+void binary_scalarlist_impl(
+    TensorList tensors,
+    ArrayRef<Scalar> scalars,
+    Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  std::vector<scalar_t> vals(scalars.size());
+  for (const auto i : c10::irange(scalars.size())) {
+    vals[i] = scalars[i].to<scalar_t>();
+  }
+  const auto chunks = build_chunks(tensors);
+  const auto data = data_ptrs<scalar_t>(tensors);
+  for_each_chunk(chunks, [&](const Chunk& chunk) {
+    scalar_t* ptr = data[chunk.tensor] + chunk.offset;
+    const Vec scalar_vec(vals[chunk.tensor]);
+    vec::map<scalar_t>(
+        [&](Vec x) { return op(x, scalar_vec); }, ptr, ptr, chunk.size);
+  });
+}
+
+// tensors1[i] = op(tensors1[i], alpha * tensors2[i]); alpha is 1 for the
+// ops that don't take one.
+template <typename scalar_t, typename Op>
+void binary_list_impl(
+    TensorList tensors1,
+    TensorList tensors2,
+    const Scalar& alpha,
+    Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const scalar_t alpha_val = alpha.to<scalar_t>();
+  const Vec alpha_vec(alpha_val);
+  const auto chunks = build_chunks(tensors1);
+  const auto data1 = data_ptrs<scalar_t>(tensors1);
+  const auto data2 = data_ptrs<scalar_t>(tensors2);
+  if (alpha_val == scalar_t(1)) {
+    for_each_chunk(chunks, [&](const Chunk& chunk) {
+      scalar_t* ptr1 = data1[chunk.tensor] + chunk.offset;
+      const scalar_t* ptr2 = data2[chunk.tensor] + chunk.offset;
+      vec::map2<scalar_t>(
+          [&](Vec x, Vec y) { return op(x, y); }, ptr1, ptr1, ptr2, chunk.size);
+    });
+  } else {
+    for_each_chunk(chunks, [&](const Chunk& chunk) {
+      scalar_t* ptr1 = data1[chunk.tensor] + chunk.offset;
+      const scalar_t* ptr2 = data2[chunk.tensor] + chunk.offset;
+      vec::map2<scalar_t>(
+          [&](Vec x, Vec y) { return op(x, y * alpha_vec); },
+          ptr1,
+          ptr1,
+          ptr2,
+          chunk.size);
+    });
+  }
+}
+
+// input[i] += scalar * op(tensors1[i], tensors2[i]) (addcmul/addcdiv)
+template <typename scalar_t, typename Op>
+void pointwise_impl(
+    TensorList input,
+    TensorList tensors1,
+    TensorList tensors2,
+    const std::vector<scalar_t>& vals,
+    Op op) {
+  using Vec = vec::Vectorized<scalar_t>;
+  const auto chunks = build_chunks(input);
+  const auto data = data_ptrs<scalar_t>(input);
+  const auto data1 = data_ptrs<scalar_t>(tensors1);
+  const auto data2 = data_ptrs<scalar_t>(tensors2);
+  for_each_chunk(chunks, [&](const Chunk& chunk) {
+    scalar_t* ptr = data[chunk.tensor] + chunk.offset;
+    const scalar_t* ptr1 = data1[chunk.tensor] + chunk.offset;
+    const scalar_t* ptr2 = data2[chunk.tensor] + chunk.offset;
+    const Vec scalar_vec(
+        vals.size() == 1 ? vals[0] : vals[chunk.tensor]);
+    vec::map3<scalar_t>(
+        [&](Vec x, Vec y, Vec z) { return x + scalar_vec * op(y, z); },
+        ptr,
+        ptr,
+        ptr1,
+        ptr2,
+        chunk.size);
+  });
+}
+
+void foreach_binary_scalar_kernel(
+    ForeachBinaryOpType op_type,
+    TensorList tensors,
+    const Scalar& scalar) {
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors[0].scalar_type(), "foreach_binary_scalar_cpu", [&] {
+        switch (op_type) {
+          case ForeachBinaryOpType::ADD:
+            return binary_scalar_impl<scalar_t>(tensors, scalar, Add{});
+          case ForeachBinaryOpType::SUB:
+            return binary_scalar_impl<scalar_t>(tensors, scalar, Sub{});
+          case ForeachBinaryOpType::MUL:
+            return binary_scalar_impl<scalar_t>(tensors, scalar, Mul{});
+          case ForeachBinaryOpType::DIV:
+            return binary_scalar_impl<scalar_t>(tensors, scalar, Div{});
+        }
+      });
+}
+
+void foreach_binary_scalarlist_kernel(
+    ForeachBinaryOpType op_type,
+    TensorList tensors,
+    ArrayRef<Scalar> scalars) {
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors[0].scalar_type(), "foreach_binary_scalarlist_cpu", [&] {
+        switch (op_type) {
+          case ForeachBinaryOpType::ADD:
+            return binary_scalarlist_impl<scalar_t>(tensors, scalars, Add{});
+          case ForeachBinaryOpType::SUB:
+            return binary_scalarlist_impl<scalar_t>(tensors, scalars, Sub{});
+          case ForeachBinaryOpType::MUL:
+            return binary_scalarlist_impl<scalar_t>(tensors, scalars, Mul{});
+          case ForeachBinaryOpType::DIV:
+            return binary_scalarlist_impl<scalar_t>(tensors, scalars, Div{});
+        }
+      });
+}
+
+void foreach_binary_list_kernel(
+    ForeachBinaryOpType op_type,
+    TensorList tensors1,
+    TensorList tensors2,
+    const Scalar& alpha) {
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors1[0].scalar_type(), "foreach_binary_list_cpu", [&] {
+        switch (op_type) {
+          case ForeachBinaryOpType::ADD:
+            return binary_list_impl<scalar_t>(tensors1, tensors2, alpha, Add{});
+          case ForeachBinaryOpType::SUB:
+            return binary_list_impl<scalar_t>(tensors1, tensors2, alpha, Sub{});
+          case ForeachBinaryOpType::MUL:
+            return binary_list_impl<scalar_t>(tensors1, tensors2, alpha, Mul{});
+          case ForeachBinaryOpType::DIV:
+            return binary_list_impl<scalar_t>(tensors1, tensors2, alpha, Div{});
+        }
+      });
+}
+
+void foreach_pointwise_scalar_kernel(
+    ForeachPointwiseOpType op_type,
+    TensorList input,
+    TensorList tensors1,
+    TensorList tensors2,
+    const Scalar& scalar) {
+  AT_DISPATCH_FLOATING_TYPES(
+      input[0].scalar_type(), "foreach_pointwise_scalar_cpu", [&] {
+        const std::vector<scalar_t> vals = {scalar.to<scalar_t>()};
+        switch (op_type) {
+          case ForeachPointwiseOpType::ADDCMUL:
+            return pointwise_impl<scalar_t>(
+                input, tensors1, tensors2, vals, Mul{});
+          case ForeachPointwiseOpType::ADDCDIV:
+            return pointwise_impl<scalar_t>(
+                input, tensors1, tensors2, vals, Div{});
+        }
+      });
+}
+
+void foreach_pointwise_scalarlist_kernel(
+    ForeachPointwiseOpType op_type,
+    TensorList input,
+    TensorList tensors1,
+    TensorList tensors2,
+    ArrayRef<Scalar> scalars) {
+  AT_DISPATCH_FLOATING_TYPES(
+      input[0].scalar_type(), "foreach_pointwise_scalarlist_cpu", [&] {
+        std::vector<scalar_t> vals(scalars.size());
+        for (const auto i : c10::irange(scalars.size())) {
+          vals[i] = scalars[i].to<scalar_t>();
+        }
+        switch (op_type) {
+          case ForeachPointwiseOpType::ADDCMUL:
+            return pointwise_impl<scalar_t>(
+                input, tensors1, tensors2, vals, Mul{});
+          case ForeachPointwiseOpType::ADDCDIV:
+            return pointwise_impl<scalar_t>(
+                input, tensors1, tensors2, vals, Div{});
+        }
+      });
+}
+
+void foreach_zero_kernel(TensorList tensors) {
+  AT_DISPATCH_FLOATING_TYPES(
+      tensors[0].scalar_type(), "foreach_zero_cpu", [&] {
+        const auto chunks = build_chunks(tensors);
+        const auto data = data_ptrs<scalar_t>(tensors);
+        for_each_chunk(chunks, [&](const Chunk& chunk) {
+          std::memset(
+              data[chunk.tensor] + chunk.offset,
+              0,
+              chunk.size * sizeof(scalar_t));
+        });
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(foreach_binary_scalar_stub, &foreach_binary_scalar_kernel);
+REGISTER_DISPATCH(
+    foreach_binary_scalarlist_stub,
+    &foreach_binary_scalarlist_kernel);
+REGISTER_DISPATCH(foreach_binary_list_stub, &foreach_binary_list_kernel);
+REGISTER_DISPATCH(
+    foreach_pointwise_scalar_stub,
+    &foreach_pointwise_scalar_kernel);
+REGISTER_DISPATCH(
+    foreach_pointwise_scalarlist_stub,
+    &foreach_pointwise_scalarlist_kernel);
+REGISTER_DISPATCH(foreach_zero_stub, &foreach_zero_kernel);
+
+} // namespace native
+} // namespace at
@@ -2,6 +2,7 @@
 #include <ATen/native/TensorTransformations.h> // flip
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 
 #include <ATen/Dispatch.h>
@@ -49,8 +50,32 @@ struct Indexer {
     }
     return offset;
   }
+
+  // Like get(), but without the bounds check. Only used to compute software
+  // prefetch addresses a few iterations ahead of the loop body; get() still
+  // validates every index before it is consumed, and prefetching a bogus
+  // address never faults.
+  int64_t get_unchecked(int64_t idx) {
+    int64_t offset = 0;
+    for (const auto j : c10::irange(num_indexers)) {
+      int64_t value = *(int64_t*)&indexers[j][idx * indexer_strides[j]];
+      if (value < 0) {
+        value += original_sizes[j];
+      }
+      offset += value * original_strides[j];
+    }
+    return offset;
+  }
 };
 
+inline void prefetch(const void* ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(ptr);
+#else
+  (void)ptr;
+#endif
+}
+
 static bool is_constant_index(int ntensor, const int64_t* strides) {
   AT_ASSERT(ntensor >= 3);
   for (const auto arg : c10::irange(2, ntensor)) {
@@ -63,13 +88,16 @@ static bool is_constant_index(int ntensor, const int64_t* strides) {
 
 template <typename scalar_t, typename func_t>
 void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
-                      const func_t& f, bool serial_execution=false)
+                      const func_t& f, bool serial_execution=false, bool is_gather_like=false)
 {
   int ntensor = iter.ntensors();
   // When launch the index parallel version, set a relative samll grain size less than the INTERNAL::GRAIN_SIZE
   // to make the whole available thread numbers get more balanced work load and a better cache location.
   // The grain size here is chosen by the op benchmark to overcome the thread launch overhead
   const int index_parallel_grain_size = 3000;
+  // How far ahead of the loop body gathered source elements are prefetched.
+  // Far enough to cover the index arithmetic, close enough to stay in L1.
+  constexpr int64_t kPrefetchDistance = 8;
   auto loop = [&](char** data, const int64_t* strides, int64_t n) {
     auto indexer = Indexer(ntensor - 2, &data[2], &strides[2], index_size, index_stride);
     char* dst = data[0];
@@ -77,15 +105,26 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
     if (is_constant_index(ntensor, strides)) {
       // specialization for when every element uses the same index
       int64_t offset = indexer.get(0);
-      if (strides[0] == sizeof(scalar_t) && strides[1] == sizeof(scalar_t)) {
-        for (const auto i : c10::irange(n)) {
-          f(dst + strides[0] * i, src + strides[1] * i, offset);
-        }
+      if (is_gather_like && strides[0] == sizeof(scalar_t) &&
+          strides[1] == sizeof(scalar_t)) {
+        // Both buffers advance element-contiguously and the gather offset is
+        // fixed across the span (the inner extent is not indexed), so the
+        // whole row collapses into one bulk copy.
+        memcpy(dst, src + offset, n * sizeof(scalar_t));
       } else {
         for (const auto i : c10::irange(n)) {
           f(dst + strides[0] * i, src + strides[1] * i, offset);
         }
       }
+    } else if (is_gather_like) {
+      for (const auto i : c10::irange(n)) {
+        if (i + kPrefetchDistance < n) {
+          prefetch(src + strides[1] * (i + kPrefetchDistance) +
+                   indexer.get_unchecked(i + kPrefetchDistance));
+        }
+        int64_t offset = indexer.get(i);
+        f(dst + strides[0] * i, src + strides[1] * i, offset);
+      }
     } else {
       for (const auto i : c10::irange(n)) {
         int64_t offset = indexer.get(i);
@@ -105,7 +144,7 @@ void index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef inde
     iter.dtype(), "index_cpu", [&] {
     cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
       *(scalar_t*)dst = *(scalar_t*)(src + offset);
-    });
+    }, /*serial_execution=*/false, /*is_gather_like=*/true);
   });
 }
 
@@ -419,6 +458,42 @@ void masked_fill_kernel(TensorIterator& iter, const Scalar& value) {
     });
 }
 
+// The iterator carries (self as output, self as input, mask); the kernel
+// accumulates into self in place wherever the mask is set, so no index
+// tensors are ever materialized (see the scalar accumulate fast path in
+// _index_put_impl_).
+template <typename scalar_t, typename mask_t>
+void cpu_masked_add_kernel(TensorIterator& iter, scalar_t value) {
+  auto is_mask_bool = std::is_same<mask_t, bool>::value;
+  auto loop = [&](char** data, const int64_t* strides, int64_t n) {
+    char* dst = data[0];
+    char* mask = data[2];
+    for (const auto i : c10::irange(n)) {
+      mask_t mask_value = *(mask_t*)(mask + strides[2] * i);
+      if (!is_mask_bool) {
+        TORCH_CHECK(mask_value == 0 || mask_value == 1, "Mask tensor can take 0 and 1 values only");
+      }
+      if (mask_value) {
+        *(scalar_t*)(dst + strides[0] * i) += value;
+      }
+    }
+  };
+  iter.for_each(loop);
+}
+
+void masked_add_kernel(TensorIterator& iter, const Scalar& value) {
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Bool, ScalarType::BFloat16, ScalarType::Half,
+    iter.dtype(), "masked_add", [&] {
+      scalar_t scalar_val = value.to<scalar_t>();
+      auto mask_dtype = iter.input_dtype(1);
+      if (mask_dtype == ScalarType::Bool) {
+        cpu_masked_add_kernel<scalar_t, bool>(iter, scalar_val);
+      } else {
+        cpu_masked_add_kernel<scalar_t, unsigned char>(iter, scalar_val);
+      }
+    });
+}
+
 template <typename scalar_t, typename mask_t>
 void cpu_masked_scatter_kernel(TensorIterator& iter, const Tensor& source) {
   auto is_mask_bool = std::is_same<mask_t, bool>::value;
@@ -572,6 +647,7 @@ REGISTER_DISPATCH(index_put_stub, &index_put_kernel);
 REGISTER_DISPATCH(put_stub, &put_kernel);
 REGISTER_DISPATCH(take_stub, &take_kernel);
 REGISTER_DISPATCH(masked_fill_stub, &masked_fill_kernel);
+REGISTER_DISPATCH(masked_add_stub, &masked_add_kernel);
 REGISTER_DISPATCH(masked_select_serial_stub, &masked_select_serial_kernel);
 REGISTER_DISPATCH(masked_select_stub, &masked_select_kernel);
 REGISTER_DISPATCH(masked_scatter_stub, &masked_scatter_kernel);
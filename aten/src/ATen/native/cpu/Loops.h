@@ -27,6 +27,8 @@
 //
 
 #include <stdint.h>
+#include <algorithm>
+#include <array>
 #include <c10/util/C++17.h>
 #include <c10/util/irange.h>
 #include <ATen/detail/FunctionTraits.h>
@@ -192,6 +194,35 @@ multiple_outputs_loop(char* C10_RESTRICT data[], const int64_t* strides_, int64_
   }
 }
 
+// Note [Alignment-tolerant vectorized loops]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The vectorized loops below use unaligned loads and stores throughout, so
+// they are correct for any element-aligned buffer - including zero-copy
+// tensors ingested through DLPack or numpy, whose data pointers carry no
+// particular alignment guarantee. Correct is not free, though: a vector
+// store that straddles a cache line costs roughly twice as much as an
+// aligned one, and with the output written every iteration the penalty is
+// paid on the whole loop. To keep arbitrarily-aligned zero-copy inputs at
+// full vector speed we peel a scalar prologue up to the output's vector
+// alignment boundary, run the vector body aligned on the store side, and
+// let the existing scalar epilogue handle the tail. Inputs that share the
+// output's misalignment (the common same-dtype elementwise case) become
+// aligned as well; ones that don't are no worse than before.
+//
+// Returns the number of leading elements to process with the scalar loop so
+// that `ptr + result` is `align`-byte aligned, or 0 if the pointer is
+// already aligned or misaligned by a sub-element amount (only possible for
+// buffers not produced by this library; peeling cannot help those).
+template <typename scalar_t>
+static inline int64_t align_peel_count(const char* ptr, int64_t n, int64_t align) {
+  const int64_t misalign =
+      static_cast<int64_t>(reinterpret_cast<uintptr_t>(ptr) & (align - 1));
+  if (misalign == 0 || misalign % sizeof(scalar_t) != 0) {
+    return 0;
+  }
+  return std::min(n, (align - misalign) / static_cast<int64_t>(sizeof(scalar_t)));
+}
+
 // Explicitly vectorized loop implementation. All inputs and outputs must be
 // the same type and contiguous with one exception: a single input may be
 // a scalar (stride 0). It's position is indicated by the argument `S`. If `S`
@@ -210,7 +241,17 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
   }
 
   Vec opt_scalar = Vec(S > 0 ? *(scalar_t*)data[S] : scalar_t(0));
-  int64_t i = 0;
+  int64_t i = align_peel_count<scalar_t>(
+      data[0], n, Vec::size() * sizeof(scalar_t));
+  if (i > 0) {
+    // Scalar prologue up to the output's vector alignment boundary; see
+    // Note [Alignment-tolerant vectorized loops].
+    int64_t strides[ntensors];
+    for (const auto arg : c10::irange(ntensors)) {
+      strides[arg] = (S > 0 && arg == S) ? 0 : sizeof(scalar_t);
+    }
+    basic_loop(data, strides, 0, i, std::forward<func_t>(op));
+  }
   for (; i <= n - 2 * Vec::size(); i += 2 * Vec::size()) {
     auto args1 = dereference_vec<traits>(&data[1], opt_scalar, S, i);
     auto args2 = dereference_vec<traits>(&data[1], opt_scalar, S, i + Vec::size());
@@ -229,6 +270,70 @@ vectorized_loop(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, ve
 }
 
 
+template <typename traits, std::size_t... INDEX>
+typename traits::ArgsTuple
+make_float_vec_args(const std::array<Vectorized<float>, traits::arity>& args,
+                    std::index_sequence<INDEX...>) {
+  return std::make_tuple(args[INDEX]...);
+}
+
+// BFloat16 variant of vectorized_loop: each input vector is loaded as
+// Vectorized<BFloat16>, widened into two Vectorized<float> halves, evaluated
+// with the Vectorized<float> functor, and narrowed back on store. This gives
+// any kernel written against float vectors a vectorized BFloat16 path with
+// fp32 accumulation, matching the semantics of vec/functional_bfloat16.h,
+// instead of falling back to per-element conversion.
+template <typename func_t, typename vec_func_t>
+static inline void
+vectorized_loop_bfloat16(char** C10_RESTRICT data_, int64_t n, int64_t S, func_t&& op, vec_func_t&& vop) {
+  using traits = function_traits<vec_func_t>;
+  using bVec = Vectorized<BFloat16>;
+  using fVec = Vectorized<float>;
+  constexpr int ntensors = traits::arity + 1;
+
+  char* C10_RESTRICT data[ntensors];
+  for (const auto arg : c10::irange(ntensors)) {
+    data[arg] = data_[arg];
+  }
+
+  fVec opt_scalar = fVec(S > 0 ? float(*(BFloat16*)data[S]) : 0.f);
+  std::array<fVec, traits::arity> args0;
+  std::array<fVec, traits::arity> args1;
+  using Indices = std::make_index_sequence<traits::arity>;
+  int64_t i = align_peel_count<BFloat16>(
+      data[0], n, bVec::size() * sizeof(BFloat16));
+  if (i > 0) {
+    // Scalar prologue up to the output's vector alignment boundary; see
+    // Note [Alignment-tolerant vectorized loops].
+    int64_t strides[ntensors];
+    for (const auto arg : c10::irange(ntensors)) {
+      strides[arg] = (S > 0 && arg == S) ? 0 : sizeof(BFloat16);
+    }
+    basic_loop(data, strides, 0, i, std::forward<func_t>(op));
+  }
+  for (; i <= n - bVec::size(); i += bVec::size()) {
+    for (const auto arg : c10::irange(traits::arity)) {
+      if (S > 0 && arg == S - 1) {
+        args0[arg] = opt_scalar;
+        args1[arg] = opt_scalar;
+      } else {
+        auto bvec = bVec::loadu(data[arg + 1] + i * sizeof(BFloat16));
+        std::tie(args0[arg], args1[arg]) = convert_bfloat16_float(bvec);
+      }
+    }
+    auto out0 = c10::guts::apply(vop, make_float_vec_args<traits>(args0, Indices{}));
+    auto out1 = c10::guts::apply(vop, make_float_vec_args<traits>(args1, Indices{}));
+    convert_float_bfloat16(out0, out1).store(data[0] + i * sizeof(BFloat16));
+  }
+  if (i < n) {
+    int64_t strides[ntensors];
+    for (const auto arg : c10::irange(ntensors)) {
+      strides[arg] = (S > 0 && arg == S) ? 0 : sizeof(BFloat16);
+    }
+    basic_loop(data, strides, i, n, std::forward<func_t>(op));
+  }
+}
+
 template <typename traits, typename cb_t>
 static inline void unroll_contiguous_scalar_checks(
     const int64_t* strides,
@@ -315,6 +420,36 @@ void cpu_kernel_vec(TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int
   iter.cast_outputs();
 }
 
+// Variant of cpu_kernel_vec for BFloat16 iterators: `op` is the scalar
+// BFloat16 functor used for non-contiguous slices and tails, while `vop` is
+// written against Vectorized<float> and runs on widened fp32 lanes (see
+// vectorized_loop_bfloat16 above).
+template <typename func_t, typename vec_func_t>
+void cpu_kernel_vec_bfloat16(TensorIteratorBase& iter, func_t&& op, vec_func_t&& vop, int64_t grain_size = at::internal::GRAIN_SIZE) {
+  using traits = function_traits<func_t>;
+  TORCH_INTERNAL_ASSERT(iter.ninputs() == traits::arity);
+  TORCH_INTERNAL_ASSERT(iter.noutputs() == 1);
+  TORCH_INTERNAL_ASSERT(iter.dtype() == ScalarType::BFloat16);
+  // dynamic casting not currently supported on CPU
+  TORCH_INTERNAL_ASSERT(!needs_dynamic_casting<func_t>::check(iter));
+
+  iter.for_each([&](char** data, const int64_t* strides, int64_t n) {
+    if (is_contiguous<traits>(strides)) {
+      vectorized_loop_bfloat16(data, n, 0, std::forward<func_t>(op), std::forward<vec_func_t>(vop));
+    } else {
+      using Indices = std::make_index_sequence<traits::arity>;
+      unroll_contiguous_scalar_checks<traits>(strides, Indices{}, [&](size_t idx) {
+        if (idx) {
+          vectorized_loop_bfloat16(data, n, idx, std::forward<func_t>(op), std::forward<vec_func_t>(vop));
+        } else {
+          basic_loop(data, strides, 0, n, std::forward<func_t>(op));
+        }
+      });
+    }
+  }, grain_size);
+  iter.cast_outputs();
+}
+
 template <typename func_t>
 void cpu_serial_kernel(TensorIteratorBase& iter, func_t&& op, const Range& range) {
   using traits = function_traits<func_t>;
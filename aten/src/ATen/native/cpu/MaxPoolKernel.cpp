@@ -86,6 +86,67 @@ void cpu_max_pool(
   }
 }
 
+// Walks one pooling window for all channel lanes, keeping the running max
+// value and its index in vector registers across the whole window instead of
+// round-tripping them through the output buffer on every window element.
+// KH/KW are compile-time window extents so that common 2x2/3x3 windows get
+// fully unrolled; KH == 0 selects the runtime-bound fallback used for border
+// windows and uncommon kernel sizes.
+template <typename scalar_t, int64_t KH = 0, int64_t KW = 0>
+inline void cpu_max_pool_window_channels_last(
+    scalar_t* out,
+    vec::int_same_size_t<scalar_t>* index_buffer,
+    int64_t* ind,
+    const scalar_t* in,
+    int64_t index0,
+    int64_t kh, int64_t kw,
+    int64_t dilationW, int64_t dilationH,
+    int64_t input_width, int64_t channels,
+    int64_t len, int64_t size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  using integer_t = vec::int_same_size_t<scalar_t>;
+  using iVec = vec::Vectorized<integer_t>;
+
+  const int64_t rows = KH > 0 ? KH : kh;
+  const int64_t cols = KW > 0 ? KW : kw;
+
+  int64_t d1 = 0;
+  for (; d1 < len; d1 += Vec::size()) {
+    Vec maxval_vec = Vec(-std::numeric_limits<scalar_t>::infinity());
+    iVec maxindex_vec = iVec(index0);
+    for (int64_t h = 0; h < rows; h++) {
+      for (int64_t w = 0; w < cols; w++) {
+        int64_t offset = h * dilationH * input_width + w * dilationW;
+        Vec val_vec = Vec::loadu(in + offset * channels + d1);
+
+        // true = all ones, false = all zeros
+        Vec mask = (val_vec > maxval_vec) | val_vec.isnan();
+        iVec imask = vec::cast<integer_t>(mask);
+        maxval_vec = Vec::blendv(maxval_vec, val_vec, mask);
+        maxindex_vec = iVec::blendv(maxindex_vec, iVec(index0 + offset), imask);
+      }
+    }
+    maxval_vec.store(out + d1);
+    maxindex_vec.store(index_buffer + d1);
+  }
+  for (; d1 < size; d1++) {
+    scalar_t maxval = -std::numeric_limits<scalar_t>::infinity();
+    int64_t maxindex = index0;
+    for (int64_t h = 0; h < rows; h++) {
+      for (int64_t w = 0; w < cols; w++) {
+        int64_t offset = h * dilationH * input_width + w * dilationW;
+        scalar_t val = in[offset * channels + d1];
+        if ((val > maxval) || std::isnan(val)) {
+          maxval = val;
+          maxindex = index0 + offset;
+        }
+      }
+    }
+    out[d1] = maxval;
+    ind[d1] = maxindex;
+  }
+}
+
 template <typename scalar_t>
 void cpu_max_pool_channels_last(
     const Tensor& output_,
@@ -144,52 +205,28 @@ void cpu_max_pool_channels_last(
 
       scalar_t* out = output_data + i * channels;
       int64_t* ind = indices_data + i * channels;
-
-      // Pass I: init out lane
-      iVec index0_vec = iVec(ih0 * input_width + iw0);
-      Vec out_vec = Vec(-std::numeric_limits<scalar_t>::infinity());
-      int64_t d1 = 0;
-      for (; d1 < len; d1 += Vec::size()) {
-        index0_vec.store(index_buffer.get() + d1);
-        out_vec.store(out + d1);
-      }
-      for (; d1 < size; d1++) {
-        ind[d1] = ih0 * input_width + iw0;
-        out[d1] = -std::numeric_limits<scalar_t>::infinity();
-      }
-      // Pass II: compute local max
-      for (int64_t ih = ih0; ih < ih1; ih += dilationH) {
-        for (int64_t iw = iw0; iw < iw1; iw += dilationW) {
-          scalar_t* in = input_data + n * input_height * input_width * channels +
-              ih * input_width * channels + iw * channels;
-
-          int64_t d2 = 0;
-          for (; d2 < len; d2 += Vec::size()) {
-            iVec index_vec = iVec(ih * input_width + iw);
-            Vec val_vec = Vec::loadu(in + d2);
-            iVec maxindex_vec = iVec::loadu(index_buffer.get() + d2);
-            Vec maxval_vec = Vec::loadu(out + d2);
-
-            // true = all ones, false = all zeros
-            Vec mask = (val_vec > maxval_vec) | val_vec.isnan();
-            iVec imask = vec::cast<integer_t>(mask);
-            Vec out_vec = Vec::blendv(maxval_vec, val_vec, mask);
-            iVec ind_vec = iVec::blendv(maxindex_vec, index_vec, imask);
-
-            out_vec.store(out + d2);
-            ind_vec.store(index_buffer.get() + d2);
-          }
-          for (; d2 < size; d2++) {
-            int64_t index = ih * input_width + iw;
-            scalar_t val = in[d2];
-            int64_t maxindex = ind[d2];
-            scalar_t maxval = out[d2];
-
-            bool mask = (val > maxval) || std::isnan(val);
-            out[d2] = mask ? val : maxval;
-            ind[d2] = mask ? index : maxindex;
-          }
-        }
+      const scalar_t* in = input_data + n * input_height * input_width * channels +
+          ih0 * input_width * channels + iw0 * channels;
+      int64_t index0 = ih0 * input_width + iw0;
+
+      // number of window elements actually visited after border clipping
+      int64_t kh_eff = (ih1 - ih0 + dilationH - 1) / dilationH;
+      int64_t kw_eff = (iw1 - iw0 + dilationW - 1) / dilationW;
+
+      // dispatch to a compile-time unrolled window walk for the common
+      // 2x2/3x3 interior windows
+      if (kh_eff == 2 && kw_eff == 2) {
+        cpu_max_pool_window_channels_last<scalar_t, 2, 2>(
+            out, index_buffer.get(), ind, in, index0, kh_eff, kw_eff,
+            dilationW, dilationH, input_width, channels, len, size);
+      } else if (kh_eff == 3 && kw_eff == 3) {
+        cpu_max_pool_window_channels_last<scalar_t, 3, 3>(
+            out, index_buffer.get(), ind, in, index0, kh_eff, kw_eff,
+            dilationW, dilationH, input_width, channels, len, size);
+      } else {
+        cpu_max_pool_window_channels_last<scalar_t>(
+            out, index_buffer.get(), ind, in, index0, kh_eff, kw_eff,
+            dilationW, dilationH, input_width, channels, len, size);
       }
       // convert indice data type
       vec::convert<integer_t, int64_t>(index_buffer.get(), ind, len);
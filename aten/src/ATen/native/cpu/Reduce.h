@@ -6,6 +6,7 @@
 #include <c10/core/Scalar.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <sstream>
 
 namespace at { namespace native { namespace {
@@ -33,6 +34,20 @@ static inline bool is_outer_reduction(const int64_t* strides) {
          strides[3] == sizeof(typename traits::arg2_t);
 }
 
+// reduction over dim 0 whose input stride is larger than the dim 1 strides,
+// so the two loops are worth interchanging. This is what a reduction over
+// multiple non-adjacent dims looks like after TensorIterator sorts and
+// coalesces dimensions: e.g. for sum(dim=(0, 2)) over a channels-last
+// tensor, the reduced N and H dims coalesce into a single reduced dim of
+// stride H*W*C elements, which by the reduction invariant sits in front of
+// the kept dims with their much smaller strides.
+template <typename traits>
+static inline bool is_interchanged_reduction(const int64_t* strides) {
+  return strides[0] == 0 &&
+         strides[3] > 0 &&
+         strides[1] > strides[3];
+}
+
 template <typename func_t, typename vec_func_t>
 static inline void vectorized_reduction(char** data, int64_t n, int64_t stride,
                                         func_t op, vec_func_t vop, bool reduce) {
@@ -116,6 +131,30 @@ static inline void vectorized_outer_reduction(char** data, int64_t inner_stride,
   });
 }
 
+// Cache-blocked variant of vectorized_outer_reduction for reductions where
+// the reduced dimension has a large stride (e.g. sum over dim 0 of a
+// row-major activation map). vectorized_outer_reduction walks the full
+// height of the input once per 128/256-byte column block; when a column's
+// footprint exceeds the cache, every one of those passes misses on every
+// row and defeats the prefetcher. Here the input is tiled into row blocks
+// whose per-pass working set is L1-resident, each tile is reduced with the
+// existing vectorized kernel, and partial results accumulate into the
+// output row (which the caller has initialized to the identity).
+template <typename func_t, typename vec_func_t>
+static inline void blocked_outer_reduction(char** data, int64_t inner_stride, int64_t size0, int64_t size1, func_t op, vec_func_t vop) {
+  VEC_LOOP_HEADER(func_t, data)
+  // Each column pass touches 4 * Vec::size() elements per row; size tiles
+  // so a pass stays within ~32KB.
+  constexpr int64_t kTileBytes = 32 * 1024;
+  const int64_t row_bytes = 4 * Vec::size() * sizeof(scalar_t);
+  const int64_t tile_rows = std::max<int64_t>(1, kTileBytes / row_bytes);
+  for (int64_t row = 0; row < size0; row += tile_rows) {
+    const int64_t rows = std::min(tile_rows, size0 - row);
+    char* tile_data[2] = {data[0], data[1] + row * inner_stride};
+    vectorized_outer_reduction(tile_data, inner_stride, rows, size1, op, vop);
+  }
+}
+
 template<typename traits, typename res_t>
 static void set_result(const int index, const res_t result, const TensorIteratorBase &iter, const int num_outputs) {
   // static_assert(std::is_same<res_t, typename traits::arg2_t>::value, "data types must match");
@@ -251,6 +290,74 @@ void binary_kernel_reduce(TensorIteratorBase& iter, ops_t ops, init_t init) {
   });
 }
 
+// MultiOps composes several independent reduction ops (see the ops_t
+// contract above) into a single ops struct whose accumulator is a tuple of
+// the component accumulators. One traversal of the input then feeds every
+// accumulator, which is what you want when the input is memory-bound and
+// several statistics (e.g. sum + sumsq, or min + max) are needed over the
+// same data. project() returns a tuple, so each component's result is
+// written to the corresponding output of the iterator:
+//
+//   binary_kernel_reduce(
+//       iter,
+//       multi_ops<scalar_t>(SumOps<scalar_t>{}, MinOps<scalar_t>{}),
+//       std::make_tuple(scalar_t(0), min_init));
+//
+// All component ops must consume the same data_t.
+template <typename data_t, typename... component_ops_t>
+struct MultiOps {
+  using acc_t = std::tuple<
+      typename binary_function_traits<decltype(&component_ops_t::reduce)>::arg1_t...>;
+  using out_t = std::tuple<
+      typename unary_function_traits<decltype(&component_ops_t::project)>::result_type...>;
+
+  std::tuple<component_ops_t...> ops;
+
+  acc_t reduce(acc_t acc, data_t data, int64_t idx) const {
+    return reduce_impl(acc, data, idx, Indices{});
+  }
+
+  acc_t combine(acc_t a, acc_t b) const {
+    return combine_impl(a, b, Indices{});
+  }
+
+  out_t project(acc_t acc) const {
+    return project_impl(acc, Indices{});
+  }
+
+  acc_t translate_idx(acc_t acc, int64_t base_idx) const {
+    return translate_idx_impl(acc, base_idx, Indices{});
+  }
+
+ private:
+  using Indices = std::make_index_sequence<sizeof...(component_ops_t)>;
+
+  template <std::size_t... I>
+  acc_t reduce_impl(acc_t acc, data_t data, int64_t idx, std::index_sequence<I...>) const {
+    return std::make_tuple(std::get<I>(ops).reduce(std::get<I>(acc), data, idx)...);
+  }
+
+  template <std::size_t... I>
+  acc_t combine_impl(acc_t a, acc_t b, std::index_sequence<I...>) const {
+    return std::make_tuple(std::get<I>(ops).combine(std::get<I>(a), std::get<I>(b))...);
+  }
+
+  template <std::size_t... I>
+  out_t project_impl(acc_t acc, std::index_sequence<I...>) const {
+    return std::make_tuple(std::get<I>(ops).project(std::get<I>(acc))...);
+  }
+
+  template <std::size_t... I>
+  acc_t translate_idx_impl(acc_t acc, int64_t base_idx, std::index_sequence<I...>) const {
+    return std::make_tuple(std::get<I>(ops).translate_idx(std::get<I>(acc), base_idx)...);
+  }
+};
+
+template <typename data_t, typename... component_ops_t>
+MultiOps<data_t, component_ops_t...> multi_ops(component_ops_t... ops) {
+  return {std::make_tuple(ops...)};
+}
+
 template <typename func_t, typename vec_func_t>
 void binary_kernel_reduce_vec(TensorIteratorBase& iter, func_t op, vec_func_t vop, double ident = 0) {
   using traits = binary_function_traits<func_t>;
@@ -272,7 +379,26 @@ void binary_kernel_reduce_vec(TensorIteratorBase& iter, func_t op, vec_func_t vo
     } else if (is_outer_reduction<traits>(strides)) {
       // input and output are contiguous in dim 1
       int64_t inner_stride = strides[1]; // stride of input in dim 0
-      vectorized_outer_reduction(data, inner_stride, size0, size1, op, vop);
+      // Once a full column walk no longer fits in cache, switch to the
+      // row-tiled strategy; see blocked_outer_reduction.
+      constexpr int64_t kBlockingThresholdBytes = 256 * 1024;
+      if (size0 * inner_stride > kBlockingThresholdBytes) {
+        blocked_outer_reduction(data, inner_stride, size0, size1, op, vop);
+      } else {
+        vectorized_outer_reduction(data, inner_stride, size0, size1, op, vop);
+      }
+    } else if (is_interchanged_reduction<traits>(strides)) {
+      // Walking the large-stride reduced dim innermost touches one element
+      // per H*W*C-sized block; iterating the kept dim innermost instead
+      // sweeps each block with the smaller stride before moving on. Each
+      // output element still sees its terms in the same order as the plain
+      // nest below, so results are bitwise identical.
+      int64_t reduced_strides[] = { strides[0], strides[1] };
+      UNARY_OUTER_LOOP(data, reduced_strides, size0, [&] {
+        char* ptrs[3] = { data[0], data[0], data[1] };
+        int64_t inner_strides[3] = { strides[2], strides[2], strides[3] };
+        basic_loop(ptrs, inner_strides, 0, size1, op);
+      });
     } else {
       UNARY_OUTER_LOOP(data, outer_strides, size1, [&] {
         char* ptrs[3] = { data[0], data[0], data[1] };
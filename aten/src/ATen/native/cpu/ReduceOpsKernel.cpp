@@ -73,6 +73,61 @@ static void cumsum_cpu_kernel(const Tensor& result, const Tensor& self, int64_t
   auto wrap_dim = maybe_wrap_dim(dim, self.dim());
   int64_t self_dim_size = ensure_nonempty_size(self, wrap_dim);
 
+  // Blocked parallel scan for long contiguous integer vectors (byte-level
+  // preprocessing runs cumsum over 1-D token masks). Integer addition is
+  // associative even under wraparound, so the scan splits into per-block
+  // sums, a serial exclusive scan over the few block sums, and a
+  // carry-adjusted second pass; both passes are parallel and the inner
+  // loops auto-vectorize. Results are bitwise identical to the serial
+  // kernel. Floating types stay serial: reassociating their sums would
+  // change rounding.
+  if (self.dim() == 1 && self.is_contiguous() && result.is_contiguous() &&
+      result.sizes().equals(self.sizes()) &&
+      result.scalar_type() == self.scalar_type() &&
+      isIntegralType(self.scalar_type(), /*includeBool=*/false) &&
+      self_dim_size >= at::internal::GRAIN_SIZE && at::get_num_threads() > 1 &&
+      !at::in_parallel_region()) {
+    AT_DISPATCH_INTEGRAL_TYPES(self.scalar_type(), "cumsum_out_cpu", [&] {
+      const auto* self_data = self.data_ptr<scalar_t>();
+      auto* result_data = result.data_ptr<scalar_t>();
+      const int64_t n = self_dim_size;
+      const int64_t num_blocks = std::min(
+          static_cast<int64_t>(at::get_num_threads()),
+          divup(n, at::internal::GRAIN_SIZE));
+      const int64_t block_size = divup(n, num_blocks);
+      std::vector<scalar_t> block_sums(num_blocks);
+      at::parallel_for(0, num_blocks, 1, [&](int64_t block_begin, int64_t block_end) {
+        for (const auto block : c10::irange(block_begin, block_end)) {
+          const int64_t start = block * block_size;
+          const int64_t end = std::min(n, start + block_size);
+          scalar_t sum = 0;
+          for (const auto i : c10::irange(start, end)) {
+            sum += self_data[i];
+          }
+          block_sums[block] = sum;
+        }
+      });
+      scalar_t carry = 0;
+      for (const auto block : c10::irange(num_blocks)) {
+        scalar_t sum = block_sums[block];
+        block_sums[block] = carry;
+        carry += sum;
+      }
+      at::parallel_for(0, num_blocks, 1, [&](int64_t block_begin, int64_t block_end) {
+        for (const auto block : c10::irange(block_begin, block_end)) {
+          const int64_t start = block * block_size;
+          const int64_t end = std::min(n, start + block_size);
+          scalar_t sum = block_sums[block];
+          for (const auto i : c10::irange(start, end)) {
+            sum += self_data[i];
+            result_data[i] = sum;
+          }
+        }
+      });
+    });
+    return;
+  }
+
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX(self.scalar_type(), "cumsum_out_cpu", [&] {
     cpu_cum_base_kernel<scalar_t>(result, self, wrap_dim, [&] (
       scalar_t* result_data, auto result_dim_stride,
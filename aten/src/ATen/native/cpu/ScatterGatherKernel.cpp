@@ -2,9 +2,12 @@
 #include <ATen/native/DispatchStub.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/TensorAdvancedIndexing.h>
+#include <ATen/Context.h>
 #include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
+#include <vector>
+
 namespace at { namespace native {
 
 namespace {
@@ -295,7 +298,69 @@ void scatter_fill_cpu_kernel(const Tensor& self, int64_t dim, const Tensor& inde
     self, dim, index, value, "scatter_fill_cpu_", tensor_assign);
 }
 
+// Accumulates a 1-d scatter_add into per-thread buffers and combines them
+// afterwards. The generic kernel only parallelizes over the non-scattered
+// dimensions, so a histogram-style `zeros(k).scatter_add_(0, idx, src)` runs
+// entirely serial; per-thread buffers restore parallelism without any
+// synchronization on the (freely colliding) destination slots.
+template <typename scalar_t>
+void cpu_scatter_add_1d_buffered(const Tensor& self, const Tensor& index, const Tensor& src) {
+  const auto index_numel = index.numel();
+  const auto self_numel = self.numel();
+  auto* self_data = self.data_ptr<scalar_t>();
+  const auto* index_data = index.data_ptr<int64_t>();
+  const auto* src_data = src.data_ptr<scalar_t>();
+
+  const auto num_threads = at::get_num_threads();
+  std::vector<scalar_t> buffers(
+      static_cast<size_t>(num_threads) * self_numel, scalar_t(0));
+
+  at::parallel_for(0, index_numel, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    scalar_t* buffer = buffers.data() + at::get_thread_num() * self_numel;
+    for (const auto i : c10::irange(begin, end)) {
+      int64_t idx_dim = index_data[i];
+      // we are not putting idx_dim in the error message because it disables
+      // loop optimization in clang-7
+      TORCH_CHECK(idx_dim >= 0 && idx_dim < self_numel,
+        "index ", index_data[i],
+        " is out of bounds for dimension ", 0,
+        " with size ", self_numel);
+      buffer[idx_dim] += src_data[i];
+    }
+  });
+
+  at::parallel_for(0, self_numel, at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+    for (const auto t : c10::irange(num_threads)) {
+      const scalar_t* buffer = buffers.data() + t * self_numel;
+      for (const auto i : c10::irange(begin, end)) {
+        self_data[i] += buffer[i];
+      }
+    }
+  });
+}
+
 void scatter_add_cpu_kernel(const Tensor& self, int64_t dim, const Tensor& index, const Tensor& src) {
+  // Keep each per-thread buffer small enough to stay cache resident.
+  constexpr int64_t kMaxBufferedSelfNumel = 1 << 15;
+  // The buffered reduction changes the floating-point accumulation order,
+  // so it is skipped under deterministic algorithms.
+  if (dim == 0 && self.dim() == 1 && index.dim() == 1 && src.dim() == 1 &&
+      self.is_contiguous() && index.is_contiguous() && src.is_contiguous() &&
+      index.scalar_type() == ScalarType::Long &&
+      index.numel() >= at::internal::GRAIN_SIZE &&
+      self.numel() > 0 && self.numel() <= kMaxBufferedSelfNumel &&
+      at::get_num_threads() > 1 &&
+      !at::globalContext().deterministicAlgorithms()) {
+    AT_DISPATCH_ALL_TYPES_AND2(
+      ScalarType::Half, ScalarType::BFloat16, self.scalar_type(),
+      "scatter_add_1d_", [&] {
+        cpu_scatter_add_1d_buffered<scalar_t>(self, index, src);
+      }
+    );
+    return;
+  }
   cpu_scatter_gather_base_kernel<>()(
     self, dim, index, src,
     "scatter_add_", reduce_add);
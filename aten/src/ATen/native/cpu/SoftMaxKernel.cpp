@@ -96,6 +96,68 @@ inline void _vec_log_softmax_lastdim(
       });
 }
 
+// Above this row size (in bytes) _vec_softmax_lastdim switches to the online
+// single-pass normalization below: a row and its output no longer stay
+// resident in a typical 32K L1, so the separate max and sum traversals of the
+// classic formulation become pure memory traffic.
+constexpr int64_t ONLINE_SOFTMAX_MIN_BYTES = 16384;
+
+// Computes one softmax row with the online algorithm of Milakov and
+// Gimelshein: a single traversal carries a running max together with a
+// running sum of exponentials kept relative to that max; whenever the max
+// grows, the sum is rescaled by exp(old_max - new_max). Each vector lane
+// carries its own (max, sum) pair and the lanes are combined at the end by
+// rescaling every lane sum to the global max. Compared to the classic
+// three-pass formulation this reads the input twice and writes the output
+// once, instead of five row traversals in total.
+//
+// The running max is seeded with lowest() rather than -infinity so that fully
+// masked lanes (all -inf inputs, as produced by attention masks) rescale by
+// exp(-inf) == 0 instead of exp(-inf - -inf) == NaN.
+template <typename scalar_t>
+inline void _vec_softmax_lastdim_online(
+    const scalar_t* input_data,
+    scalar_t* output_data,
+    int64_t dim_size) {
+  using Vec = vec::Vectorized<scalar_t>;
+  Vec max_vec = Vec(std::numeric_limits<scalar_t>::lowest());
+  Vec sum_vec = Vec(scalar_t(0));
+  int64_t d = 0;
+  for (; d < dim_size - (dim_size % Vec::size()); d += Vec::size()) {
+    Vec x_vec = Vec::loadu(input_data + d);
+    Vec new_max_vec = vec::maximum(max_vec, x_vec);
+    sum_vec = sum_vec * (max_vec - new_max_vec).exp() + (x_vec - new_max_vec).exp();
+    max_vec = new_max_vec;
+  }
+  if (dim_size - d > 0) {
+    Vec x_vec = Vec::loadu(input_data + d, dim_size - d);
+    Vec new_max_vec = Vec::set(max_vec, vec::maximum(max_vec, x_vec), dim_size - d);
+    Vec new_sum_vec =
+        sum_vec * (max_vec - new_max_vec).exp() + (x_vec - new_max_vec).exp();
+    sum_vec = Vec::set(sum_vec, new_sum_vec, dim_size - d);
+    max_vec = new_max_vec;
+  }
+  scalar_t max_input = vec::vec_reduce_all<scalar_t>(
+      [](Vec& x, Vec& y) { return vec::maximum(x, y); }, max_vec, Vec::size());
+  sum_vec = sum_vec * (max_vec - Vec(max_input)).exp();
+  scalar_t tmp_sum = vec::vec_reduce_all<scalar_t>(
+      [](Vec x, Vec y) { return x + y; }, sum_vec, Vec::size());
+  scalar_t inv_sum = 1 / tmp_sum;
+
+  Vec max_input_vec = Vec(max_input);
+  Vec inv_sum_vec = Vec(inv_sum);
+  d = 0;
+  for (; d < dim_size - (dim_size % Vec::size()); d += Vec::size()) {
+    Vec out_vec = (Vec::loadu(input_data + d) - max_input_vec).exp() * inv_sum_vec;
+    out_vec.store(output_data + d);
+  }
+  if (dim_size - d > 0) {
+    Vec x_vec = Vec::loadu(input_data + d, dim_size - d);
+    Vec out_vec = (x_vec - max_input_vec).exp() * inv_sum_vec;
+    out_vec.store(output_data + d, dim_size - d);
+  }
+}
+
 template <typename scalar_t>
 inline void _vec_softmax_lastdim(
     scalar_t* input_data_base,
@@ -107,6 +169,13 @@ inline void _vec_softmax_lastdim(
   if (grain_size < 1)
     grain_size = 1;
 
+  // The online path accumulates in the row's own scalar type, so restrict it
+  // to types whose Vectorized math runs natively; BFloat16 keeps the
+  // float-accumulated passes below.
+  bool use_online_softmax =
+      std::is_same<scalar_t, vec::vec_scalar_t<scalar_t>>::value &&
+      dim_size * (int64_t)sizeof(scalar_t) >= ONLINE_SOFTMAX_MIN_BYTES;
+
   parallel_for(
       0,
       outer_size,
@@ -115,6 +184,10 @@ inline void _vec_softmax_lastdim(
         for (const auto i : c10::irange(begin, end)) {
           scalar_t* input_data = input_data_base + i * dim_size;
           scalar_t* output_data = output_data_base + i * dim_size;
+          if (use_online_softmax) {
+            _vec_softmax_lastdim_online(input_data, output_data, dim_size);
+            continue;
+          }
           scalar_t max_input = vec::reduce_all<scalar_t>(
               [](Vec& x, Vec& y) { return vec::maximum(x, y); },
               input_data,
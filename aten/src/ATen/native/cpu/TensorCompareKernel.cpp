@@ -408,6 +408,68 @@ static void clamp_min_scalar_kernel_impl(TensorIterator& iter, Scalar min_) {
   });
 }
 
+// Runs where(a cmp threshold, clamp(a, min, max), b) in one sweep.
+// See Note [Fused clip/where chains] in TensorCompare.cpp. The comparison
+// yields an all-ones lane mask, so blendv selects between the clamped value
+// and `b` without a bool tensor ever being materialized.
+static void fused_clip_where_kernel_impl(
+    TensorIteratorBase& iter,
+    const Scalar& threshold,
+    FusedCmpOp cmp,
+    const c10::optional<Scalar>& min_,
+    const c10::optional<Scalar>& max_) {
+  AT_DISPATCH_ALL_TYPES_AND(kBFloat16, iter.common_dtype(), "fused_clip_where_cpu", [&]() {
+    using Vec = Vectorized<scalar_t>;
+    const auto thr = threshold.to<scalar_t>();
+    const bool has_min = min_.has_value();
+    const bool has_max = max_.has_value();
+    const auto min = has_min ? min_->to<scalar_t>() : scalar_t(0);
+    const auto max = has_max ? max_->to<scalar_t>() : scalar_t(0);
+    const Vec thr_vec(thr);
+    const Vec min_vec(min);
+    const Vec max_vec(max);
+    cpu_kernel_vec(iter,
+      [=](scalar_t a, scalar_t b) -> scalar_t {
+        scalar_t v = a;
+        if (has_min) {
+          v = std::max(v, min);
+        }
+        if (has_max) {
+          v = std::min(v, max);
+        }
+        bool keep = false;
+        switch (cmp) {
+          case FusedCmpOp::Gt: keep = a > thr; break;
+          case FusedCmpOp::Ge: keep = a >= thr; break;
+          case FusedCmpOp::Lt: keep = a < thr; break;
+          case FusedCmpOp::Le: keep = a <= thr; break;
+          case FusedCmpOp::Eq: keep = a == thr; break;
+          case FusedCmpOp::Ne: keep = a != thr; break;
+        }
+        return keep ? v : b;
+      },
+      [=](Vec a, Vec b) {
+        Vec v = a;
+        if (has_min) {
+          v = vec::clamp_min(v, min_vec);
+        }
+        if (has_max) {
+          v = vec::clamp_max(v, max_vec);
+        }
+        Vec mask;
+        switch (cmp) {
+          case FusedCmpOp::Gt: mask = a > thr_vec; break;
+          case FusedCmpOp::Ge: mask = a >= thr_vec; break;
+          case FusedCmpOp::Lt: mask = a < thr_vec; break;
+          case FusedCmpOp::Le: mask = a <= thr_vec; break;
+          case FusedCmpOp::Eq: mask = a == thr_vec; break;
+          case FusedCmpOp::Ne: mask = a != thr_vec; break;
+        }
+        return Vec::blendv(b, v, mask);
+      });
+  });
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(max_stub, &max_kernel_impl);
@@ -424,5 +486,6 @@ REGISTER_DISPATCH(clamp_scalar_stub, &clamp_scalar_kernel_impl);
 REGISTER_DISPATCH(clamp_min_scalar_stub, &clamp_min_scalar_kernel_impl);
 REGISTER_DISPATCH(clamp_max_scalar_stub, &clamp_max_scalar_kernel_impl);
 REGISTER_DISPATCH(isin_default_stub, &isin_default_kernel_cpu);
+REGISTER_DISPATCH(fused_clip_where_stub, &fused_clip_where_kernel_impl);
 
 }} // namespace at::native
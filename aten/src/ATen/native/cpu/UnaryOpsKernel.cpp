@@ -356,25 +356,28 @@ static void cosh_kernel(TensorIteratorBase& iter) {
 
 static void acosh_kernel(TensorIteratorBase& iter) {
     AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND1(kBFloat16, iter.dtype(), "acosh_cpu", [&]() {
-      cpu_kernel(
+      cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::acosh(a); });
+        [=](scalar_t a) -> scalar_t { return std::acosh(a); },
+        [=](Vectorized<scalar_t> self_vec){return self_vec.acosh();});
     });
 }
 
 static void asinh_kernel(TensorIteratorBase& iter) {
     AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND1(kBFloat16, iter.dtype(), "asinh_cpu", [&]() {
-      cpu_kernel(
+      cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::asinh(a); });
+        [=](scalar_t a) -> scalar_t { return std::asinh(a); },
+        [=](Vectorized<scalar_t> self_vec){return self_vec.asinh();});
     });
 }
 
 static void atanh_kernel(TensorIteratorBase& iter) {
     AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES_AND1(kBFloat16, iter.dtype(), "atanh_cpu", [&]() {
-      cpu_kernel(
+      cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::atanh(a); });
+        [=](scalar_t a) -> scalar_t { return std::atanh(a); },
+        [=](Vectorized<scalar_t> self_vec){return self_vec.atanh();});
     });
 }
 
@@ -396,12 +399,20 @@ static void trigamma_kernel(TensorIteratorBase& iter) {
 
 static void exp2_kernel(TensorIteratorBase& iter) {
   // Supports only floating types as std::exp2 doesn't have
-  // complex overloads.
-  AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, iter.dtype(), "exp2", [&]() {
+  // complex overloads. Half has no Vectorized specialization, so it
+  // stays on the scalar path.
+  if (iter.dtype() == kHalf) {
     cpu_kernel(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::exp2(a); });
-  });
+        [=](Half a) -> Half { return std::exp2(a); });
+  } else {
+    AT_DISPATCH_FLOATING_TYPES_AND(kBFloat16, iter.dtype(), "exp2", [&]() {
+      cpu_kernel_vec(
+          iter,
+          [=](scalar_t a) -> scalar_t { return std::exp2(a); },
+          [=](Vectorized<scalar_t> a) { return a.exp2(); });
+    });
+  }
 }
 
 static void polygamma_kernel(TensorIteratorBase& iter, int64_t n) {
@@ -537,6 +548,126 @@ static void erfcx_kernel(TensorIteratorBase& iter){
   });
 }
 
+// Applies a whole chain of unary ops to each element in a single sweep.
+// See Note [Fused unary chains] in UnaryOps.cpp. The per-element walk over
+// `ops` costs a few branches, but these chains are memory bound, so saving
+// all but one pass over the data dominates.
+static void fused_unary_kernel(
+    TensorIteratorBase& iter,
+    c10::ArrayRef<FusedUnaryOp> ops) {
+  AT_DISPATCH_FLOATING_TYPES(iter.common_dtype(), "fused_unary_cpu", [&]() {
+    cpu_kernel_vec(
+        iter,
+        [ops](scalar_t a) -> scalar_t {
+          for (const auto op : ops) {
+            switch (op) {
+              case FusedUnaryOp::Abs:
+                a = std::abs(a);
+                break;
+              case FusedUnaryOp::Ceil:
+                a = std::ceil(a);
+                break;
+              case FusedUnaryOp::Erf:
+                a = std::erf(a);
+                break;
+              case FusedUnaryOp::Exp:
+                a = std::exp(a);
+                break;
+              case FusedUnaryOp::Floor:
+                a = std::floor(a);
+                break;
+              case FusedUnaryOp::Frac:
+                a = a - std::trunc(a);
+                break;
+              case FusedUnaryOp::Log:
+                a = std::log(a);
+                break;
+              case FusedUnaryOp::Neg:
+                a = -a;
+                break;
+              case FusedUnaryOp::Reciprocal:
+                a = static_cast<scalar_t>(1) / a;
+                break;
+              case FusedUnaryOp::Round:
+                a = std::nearbyint(a);
+                break;
+              case FusedUnaryOp::Rsqrt:
+                a = static_cast<scalar_t>(1) / std::sqrt(a);
+                break;
+              case FusedUnaryOp::Sigmoid:
+                a = static_cast<scalar_t>(1) /
+                    (static_cast<scalar_t>(1) + std::exp(-a));
+                break;
+              case FusedUnaryOp::Sqrt:
+                a = std::sqrt(a);
+                break;
+              case FusedUnaryOp::Tanh:
+                a = std::tanh(a);
+                break;
+              case FusedUnaryOp::Trunc:
+                a = std::trunc(a);
+                break;
+            }
+          }
+          return a;
+        },
+        [ops](Vectorized<scalar_t> a) {
+          for (const auto op : ops) {
+            switch (op) {
+              case FusedUnaryOp::Abs:
+                a = a.abs();
+                break;
+              case FusedUnaryOp::Ceil:
+                a = a.ceil();
+                break;
+              case FusedUnaryOp::Erf:
+                a = a.erf();
+                break;
+              case FusedUnaryOp::Exp:
+                a = a.exp();
+                break;
+              case FusedUnaryOp::Floor:
+                a = a.floor();
+                break;
+              case FusedUnaryOp::Frac:
+                a = a.frac();
+                break;
+              case FusedUnaryOp::Log:
+                a = a.log();
+                break;
+              case FusedUnaryOp::Neg:
+                a = a.neg();
+                break;
+              case FusedUnaryOp::Reciprocal:
+                a = a.reciprocal();
+                break;
+              case FusedUnaryOp::Round:
+                a = a.round();
+                break;
+              case FusedUnaryOp::Rsqrt:
+                a = a.rsqrt();
+                break;
+              case FusedUnaryOp::Sigmoid:
+                a = (Vectorized<scalar_t>(static_cast<scalar_t>(1)) +
+                     a.neg().exp())
+                        .reciprocal();
+                break;
+              case FusedUnaryOp::Sqrt:
+                a = a.sqrt();
+                break;
+              case FusedUnaryOp::Tanh:
+                a = a.tanh();
+                break;
+              case FusedUnaryOp::Trunc:
+                a = a.trunc();
+                break;
+            }
+          }
+          return a;
+        });
+  });
+}
+
 // TODO: Disable cont. branch to test more risky code
 
 #define IMPLEMENT_ITERATOR_LAMBDA(op)                                         \
@@ -604,6 +735,7 @@ REGISTER_DISPATCH(exp2_stub, &CPU_CAPABILITY::exp2_kernel);
 REGISTER_DISPATCH(bitwise_not_stub, &CPU_CAPABILITY::bitwise_not_kernel);
 REGISTER_DISPATCH(logical_not_stub, &CPU_CAPABILITY::logical_not_kernel);
 REGISTER_DISPATCH(frac_stub, &CPU_CAPABILITY::frac_kernel);
+REGISTER_DISPATCH(fused_unary_stub, &CPU_CAPABILITY::fused_unary_kernel);
 REGISTER_DISPATCH(reciprocal_stub, &CPU_CAPABILITY::reciprocal_kernel);
 REGISTER_DISPATCH(nan_to_num_stub, &CPU_CAPABILITY::nan_to_num_kernel);
 REGISTER_DISPATCH(neg_stub, &CPU_CAPABILITY::neg_kernel);
@@ -5,8 +5,11 @@
 #include <ATen/Parallel.h>
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/native/cpu/utils.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
 
+#include <unordered_map>
+
 namespace at {
 namespace native {
 namespace {
@@ -706,6 +709,82 @@ struct HelperInterpCubic : public HelperInterpBase {
   }
 };
 
+// Note [Caching upsample index/weight tables]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The index/weight tables produced by F::compute_indices_weights depend only
+// on the interpolation mode, the dtype and the geometry of the call:
+// (input_size, output_size, input byte stride, ndims, reshape_dim,
+// align_corners, scale). Inference workloads typically call interpolate many
+// times with the same handful of geometries, so we memoize the tables and pay
+// the O(output_size) recomputation only on the first call per geometry. The
+// tables are never written after construction, so returning the same Tensors
+// to every call is safe. The cache is thread local to avoid locking; it is
+// cleared wholesale when it grows past a fixed bound so pathological callers
+// (e.g. a different output size every call) cannot accumulate tables forever.
+struct InterpTableKey {
+  int interp_size;
+  at::ScalarType scalar_type;
+  int64_t input_size;
+  int64_t output_size;
+  int64_t stride;
+  int64_t ndims;
+  int64_t reshape_dim;
+  bool align_corners;
+  // -1.0 encodes an absent optional scale; user-provided scales are positive.
+  double scale;
+
+  bool operator==(const InterpTableKey& other) const {
+    return interp_size == other.interp_size &&
+        scalar_type == other.scalar_type &&
+        input_size == other.input_size &&
+        output_size == other.output_size &&
+        stride == other.stride &&
+        ndims == other.ndims &&
+        reshape_dim == other.reshape_dim &&
+        align_corners == other.align_corners &&
+        scale == other.scale;
+  }
+};
+
+struct InterpTableKeyHash {
+  size_t operator()(const InterpTableKey& key) const {
+    size_t seed = std::hash<int>()(key.interp_size);
+    seed = c10::hash_combine(seed, static_cast<size_t>(key.scalar_type));
+    seed = c10::hash_combine(seed, std::hash<int64_t>()(key.input_size));
+    seed = c10::hash_combine(seed, std::hash<int64_t>()(key.output_size));
+    seed = c10::hash_combine(seed, std::hash<int64_t>()(key.stride));
+    seed = c10::hash_combine(seed, std::hash<int64_t>()(key.ndims));
+    seed = c10::hash_combine(seed, std::hash<int64_t>()(key.reshape_dim));
+    seed = c10::hash_combine(seed, static_cast<size_t>(key.align_corners));
+    seed = c10::hash_combine(seed, std::hash<double>()(key.scale));
+    return seed;
+  }
+};
+
+template <class F>
+std::vector<Tensor> get_indices_weights(
+    at::ScalarType scalar_type,
+    int64_t input_size, int64_t output_size, int64_t stride, int64_t ndims,
+    int64_t reshape_dim, bool align_corners, const c10::optional<double> opt_scale) {
+  constexpr int kMaxCachedTables = 64;
+  thread_local std::unordered_map<InterpTableKey, std::vector<Tensor>, InterpTableKeyHash> cache;
+
+  InterpTableKey key{F::interp_size, scalar_type, input_size, output_size,
+      stride, ndims, reshape_dim, align_corners, opt_scale.value_or(-1.0)};
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  auto tables = F::compute_indices_weights(
+      scalar_type, input_size, output_size, stride, ndims, reshape_dim,
+      align_corners, opt_scale);
+  if (cache.size() >= kMaxCachedTables) {
+    cache.clear();
+  }
+  cache.emplace(key, tables);
+  return tables;
+}
+
 // Generic upsampling interpolation kernel for N-d case.
 // Input is assumed to be like NCHW, NCL, NCKHW - interpolated spatial dimension
 // are those from the end up to batch size N and number of channels C.
@@ -749,8 +828,9 @@ void upsample_generic_Nd_kernel_impl(
 
   for (const auto i : c10::irange(out_ndims)) {
     // NOLINTNEXTLINE(performance-inefficient-vector-operation)
+    // See Note [Caching upsample index/weight tables]
     indices_weights.emplace_back(
-      F::compute_indices_weights(
+      get_indices_weights<F>(
         input_scalar_type, input.size(i + 2), oshape[i + 2],
         input.stride(i + 2) * input.element_size(),
         input.dim(), i + 2, align_corners, scales[i]
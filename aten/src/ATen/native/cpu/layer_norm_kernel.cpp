@@ -4,7 +4,7 @@
 #include <tuple>
 
 #include <ATen/ATen.h>
-#include <ATen/CPUApplyUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/Dispatch.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
@@ -50,12 +50,30 @@ void LayerNormKernelImplInternal(
       rstd_val = T(1) / std::sqrt(rstd_val + eps);
       const T_ACC scale = rstd_val;
       const T_ACC bias = -rstd_val * mean_val;
-      if (gamma_null || beta_null) {
-        for (const auto j : c10::irange(N)) {
-          const T gamma_v = gamma_null ? T(1) : gamma_data[j];
-          const T beta_v = beta_null ? T(0) : beta_data[j];
-          Y_ptr[j] = (X_ptr[j] * scale + bias) * gamma_v + beta_v;
-        }
+      if (gamma_null && beta_null) {
+        vec::map<T>(
+            [scale, bias](Vec x) { return x * Vec(scale) + Vec(bias); },
+            Y_ptr,
+            X_ptr,
+            N);
+      } else if (gamma_null) {
+        vec::map2<T>(
+            [scale, bias](Vec x, Vec beta) {
+              return x * Vec(scale) + Vec(bias) + beta;
+            },
+            Y_ptr,
+            X_ptr,
+            beta_data,
+            N);
+      } else if (beta_null) {
+        vec::map2<T>(
+            [scale, bias](Vec x, Vec gamma) {
+              return (x * Vec(scale) + Vec(bias)) * gamma;
+            },
+            Y_ptr,
+            X_ptr,
+            gamma_data,
+            N);
       } else {
         vec::map3<T>(
             [scale, bias](Vec x, Vec gamma, Vec beta) {
@@ -2972,7 +2972,7 @@ void linalg_lstsq_gels(const Tensor& A, const Tensor& B, const Tensor& /*infos*/
   // TODO: revisit this later to use batch_iterator_with_broadcasting in triangular_solve
   IntArrayRef A_batch_sizes(A.sizes().data(), A.dim() - 2);
   IntArrayRef B_batch_sizes(B.sizes().data(), B.dim() - 2);
-  std::vector<int64_t> expand_batch_portion = at::infer_size(A_batch_sizes, B_batch_sizes);
+  DimVector expand_batch_portion = at::infer_size_dimvector(A_batch_sizes, B_batch_sizes);
 
   auto tau_shape = A.sizes().vec();
   tau_shape.pop_back();
@@ -2987,12 +2987,12 @@ void linalg_lstsq_gels(const Tensor& A, const Tensor& B, const Tensor& /*infos*/
     // we do it after geqrf so that we don't do redundant computations for the same input
     auto A_expand_batch = expand_batch_portion;
     A_expand_batch.insert(A_expand_batch.end(), {A.size(-2), A.size(-1)});
-    Tensor A_expanded = A.expand({A_expand_batch});
+    Tensor A_expanded = A.expand(A_expand_batch);
     bool is_fortran_contiguous = A_expanded.mT().is_contiguous();
     Tensor A_broadcasted = is_fortran_contiguous ? A_expanded : cloneBatchedColumnMajor(A_expanded);
     auto tau_expand_batch = expand_batch_portion;
     tau_expand_batch.push_back(tau.size(-1));
-    Tensor tau_broadcasted = tau.expand({tau_expand_batch}).contiguous();
+    Tensor tau_broadcasted = tau.expand(tau_expand_batch).contiguous();
 
     // Step 2: B <- Q^H B
     ormqr_kernel(A_broadcasted, tau_broadcasted, B, /*left=*/true, /*transpose=*/true);
@@ -3015,7 +3015,7 @@ void linalg_lstsq_gels(const Tensor& A, const Tensor& B, const Tensor& /*infos*/
     // we do it after geqrf so that we don't do redundant computations for the same input
     auto A_expand_batch = expand_batch_portion;
     A_expand_batch.insert(A_expand_batch.end(), {Ah.size(-2), Ah.size(-1)});
-    Tensor Ah_expanded = Ah.expand({A_expand_batch});
+    Tensor Ah_expanded = Ah.expand(A_expand_batch);
     bool is_fortran_contiguous = Ah_expanded.mT().is_contiguous();
     Tensor Ah_broadcasted = is_fortran_contiguous ? Ah_expanded : cloneBatchedColumnMajor(Ah_expanded);
 
@@ -3037,7 +3037,7 @@ void linalg_lstsq_gels(const Tensor& A, const Tensor& B, const Tensor& /*infos*/
 
     auto tau_expand_batch = expand_batch_portion;
     tau_expand_batch.push_back(tau.size(-1));
-    Tensor tau_broadcasted = tau.expand({tau_expand_batch}).contiguous();
+    Tensor tau_broadcasted = tau.expand(tau_expand_batch).contiguous();
 
     // Step 3: X <- Q Z
     ormqr_kernel(Ah_broadcasted, tau_broadcasted, B, /*left=*/true, /*transpose=*/false);
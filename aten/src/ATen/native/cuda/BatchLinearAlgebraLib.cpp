@@ -209,9 +209,9 @@ inline void apply_gels_batched(const Tensor& A, Tensor& B, Tensor& infos) {
   // explicitly broadcast the batch dimensions of A
   IntArrayRef A_batch_sizes(A.sizes().data(), A.dim() - 2);
   IntArrayRef B_batch_sizes(B.sizes().data(), B.dim() - 2);
-  std::vector<int64_t> expand_batch_portion = at::infer_size(A_batch_sizes, B_batch_sizes);
+  DimVector expand_batch_portion = at::infer_size_dimvector(A_batch_sizes, B_batch_sizes);
   expand_batch_portion.insert(expand_batch_portion.end(), {A.size(-2), A.size(-1)});
-  Tensor A_expanded = A.expand({expand_batch_portion});
+  Tensor A_expanded = A.expand(expand_batch_portion);
   Tensor A_broadcasted = cloneBatchedColumnMajor(A_expanded);
 
   // cuBLAS batched gels requires input to be the device array of pointers to device single matrices
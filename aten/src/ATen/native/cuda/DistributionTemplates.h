@@ -100,6 +100,20 @@ __global__ void distribution_elementwise_grid_stride_kernel(int numel,
  *     (i.e. if (!iter.can_use_32bit_indexing())) and hence, the philox
  *     offset calculation is done in this function.
  *
+ * Note [Distribution transform epilogues]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * transform_func is the fusion point of this machinery: it runs in-register
+ * on each raw Philox sample, between generation and the (single) global
+ * memory store. Comparisons, affine transforms and dtype casts all compose
+ * inside it, which is how every distribution below is implemented - e.g.
+ * uniform_kernel folds its [from, to) rescale into the functor, and
+ * bernoulli_kernel folds the threshold compare plus the cast to the output
+ * dtype. In particular `x.bernoulli_(p)` on a bool tensor is the fully fused
+ * form of the `torch.rand_like(x) < p` idiom: one kernel, no intermediate
+ * uniform tensor. New sample-and-transform patterns should be expressed as a
+ * transform_func passed to uniform_and_transform/normal_and_transform rather
+ * than as separate elementwise kernels over a materialized sample.
+ *
  * FIXME: Can we specialize elementwise_kernel and launch_kernel in Loops.cuh
  * to have grid-stride loop kernel and then use that to launch our distribution
  * kernels? Note that we need a grid-stride loop kernel because, we found by testing
@@ -0,0 +1,142 @@
+#include <ATen/ATen.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace at { namespace native {
+
+namespace {
+
+// Descriptor for one destination tensor of a coalesced host-to-device copy.
+// `offset` is the byte offset of the tensor's payload in the staging buffer.
+struct CopyChunk {
+  char* dst;
+  int64_t offset;
+  int64_t nbytes;
+};
+
+constexpr int64_t kStagingAlignment = 16;
+constexpr int kScatterBlockSize = 256;
+constexpr int kScatterMaxBlocks = 320;
+
+inline int64_t align_staging(int64_t nbytes) {
+  return (nbytes + kStagingAlignment - 1) / kStagingAlignment *
+      kStagingAlignment;
+}
+
+// Scatters the payload of the staging buffer into the destination tensors.
+// One block handles one chunk at a time; chunks are copied in 8-byte words
+// with a bytewise tail.  The chunk descriptors live at the head of the
+// staging buffer so a single cudaMemcpyAsync transfers both the metadata and
+// the payload.
+__global__ void scatter_copy_kernel(const char* staging, int n_chunks) {
+  const CopyChunk* chunks = reinterpret_cast<const CopyChunk*>(staging);
+  for (int chunk_idx = blockIdx.x; chunk_idx < n_chunks;
+       chunk_idx += gridDim.x) {
+    const CopyChunk chunk = chunks[chunk_idx];
+    const char* src = staging + chunk.offset;
+    const int64_t n_words = chunk.nbytes / static_cast<int64_t>(sizeof(uint64_t));
+    const uint64_t* src_words = reinterpret_cast<const uint64_t*>(src);
+    uint64_t* dst_words = reinterpret_cast<uint64_t*>(chunk.dst);
+    for (int64_t i = threadIdx.x; i < n_words; i += blockDim.x) {
+      dst_words[i] = src_words[i];
+    }
+    for (int64_t i = n_words * static_cast<int64_t>(sizeof(uint64_t)) +
+             threadIdx.x;
+         i < chunk.nbytes;
+         i += blockDim.x) {
+      chunk.dst[i] = src[i];
+    }
+  }
+}
+
+// The coalesced path packs all sources into one pinned staging buffer and
+// issues a single cudaMemcpyAsync followed by one scatter kernel, instead of
+// one cudaMemcpyAsync per tensor.  It requires contiguous CPU sources and
+// contiguous CUDA destinations on a single device; the sources do not have
+// to be pinned since they are staged through pinned memory anyway.
+bool can_use_coalesced_h2d(TensorList self, TensorList src) {
+  const auto device = self[0].device();
+  for (const auto i : c10::irange(self.size())) {
+    if (!self[i].is_cuda() || self[i].device() != device ||
+        !self[i].is_contiguous()) {
+      return false;
+    }
+    if (!src[i].device().is_cpu() || !src[i].is_contiguous()) {
+      return false;
+    }
+    if (self[i].scalar_type() != src[i].scalar_type() ||
+        self[i].numel() != src[i].numel()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+void foreach_tensor_copy_list_kernel_cuda_(
+    TensorList self,
+    TensorList src,
+    bool non_blocking) {
+  check_foreach_api_restrictions(self, src);
+
+  if (!can_use_coalesced_h2d(self, src)) {
+    return at::native::foreach_tensor_copy_list_kernel_slow_(
+        self, src, non_blocking);
+  }
+
+  const auto n_chunks = static_cast<int>(self.size());
+
+  // Staging layout: [chunk descriptors | payload0 | payload1 | ...], with
+  // every payload aligned so the scatter kernel can copy whole words.
+  std::vector<int64_t> offsets;
+  offsets.reserve(self.size());
+  int64_t total_bytes = align_staging(n_chunks * sizeof(CopyChunk));
+  for (const auto i : c10::irange(self.size())) {
+    offsets.push_back(total_bytes);
+    total_bytes += align_staging(src[i].nbytes());
+  }
+
+  cuda::CUDAGuard device_guard(self[0].device());
+  at::cuda::CUDAStream stream = at::cuda::getCurrentCUDAStream();
+
+  auto host_staging = at::empty(
+      {total_bytes}, at::TensorOptions().dtype(kByte).pinned_memory(true));
+  auto device_staging = at::empty({total_bytes}, self[0].options().dtype(kByte));
+
+  auto* staging = static_cast<char*>(host_staging.data_ptr());
+  auto* chunks = reinterpret_cast<CopyChunk*>(staging);
+  for (const auto i : c10::irange(self.size())) {
+    chunks[i] = CopyChunk{
+        static_cast<char*>(self[i].data_ptr()),
+        offsets[i],
+        static_cast<int64_t>(src[i].nbytes())};
+    std::memcpy(staging + offsets[i], src[i].data_ptr(), src[i].nbytes());
+  }
+
+  AT_CUDA_CHECK(cudaMemcpyAsync(
+      device_staging.data_ptr(),
+      host_staging.data_ptr(),
+      total_bytes,
+      cudaMemcpyHostToDevice,
+      stream));
+  AT_CUDA_CHECK(
+      CachingHostAllocator_recordEvent(host_staging.data_ptr(), stream));
+
+  const int num_blocks = std::min(n_chunks, kScatterMaxBlocks);
+  scatter_copy_kernel<<<num_blocks, kScatterBlockSize, 0, stream>>>(
+      static_cast<const char*>(device_staging.data_ptr()), n_chunks);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+  if (!non_blocking) {
+    c10::cuda::stream_synchronize(stream);
+  }
+}
+
+}} // namespace at::native
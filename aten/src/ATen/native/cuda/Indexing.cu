@@ -938,6 +938,36 @@ void masked_fill_kernel(TensorIterator& iter, const Scalar& value) {
       });
 }
 
+// Accumulating counterpart of masked_fill_kernel, used by the scalar
+// accumulate fast path of _index_put_impl_ so that x[mask] += scalar never
+// materializes index tensors.  Each output element is written by exactly
+// one thread, so unlike the sort-based index_put path this needs no
+// atomics and is deterministic.
+template <typename mask_t>
+void masked_add_kernel(TensorIterator& iter, const Scalar& value) {
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
+      kBool, kHalf, kBFloat16, iter.common_dtype(), "masked_add_", [&]() {
+        const auto value_ = value.to<scalar_t>();
+        gpu_kernel(
+            iter, [value_] GPU_LAMBDA(scalar_t self, mask_t mask) -> scalar_t {
+              if (mask) {
+                return self + value_;
+              }
+              return self;
+            });
+      });
+}
+
+void masked_add_kernel_cuda(TensorIterator& iter, const Scalar& value) {
+  if (iter.input_dtype(1) == at::ScalarType::Byte) {
+    masked_add_kernel<uint8_t>(iter, value);
+  } else {
+    masked_add_kernel<bool>(iter, value);
+  }
+}
+
+REGISTER_CUDA_DISPATCH(masked_add_stub, &masked_add_kernel_cuda);
+
 } // anonymous namespace
 
 Tensor & masked_fill__cuda(Tensor& self, const Tensor & mask, const Scalar& value) {
@@ -0,0 +1,621 @@
+#include <ATen/ATen.h>
+#include <ATen/OpMathType.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <torch/library.h>
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace at {
+namespace native {
+namespace {
+
+// Note [Persistent micro-op worker]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Iterative decode loops launch thousands of elementwise kernels whose
+// device time is a few microseconds each; at that scale the host-side
+// launch latency is comparable to the kernel itself and dominates the step
+// time. The cuda_persistent ops below trade generality for launch count:
+// cuda_persistent::start launches one resident, occupancy-sized kernel
+// that spins on a work queue in mapped pinned memory, and the enqueue ops
+// (binary / binary_scalar / unary) append fixed-format micro-op records
+// that the resident kernel interprets without ever returning to the host.
+//
+// The templated functors behind the regular elementwise and _foreach CUDA
+// paths (CUDALoops.cuh, ForeachFunctors.cuh) are instantiated at compile
+// time and cannot be selected from a device-side queue, so the worker
+// interprets a small fixed opcode set instead: the contiguous, same-dtype
+// binary/unary ops that make up a steady-state decode step. Anything
+// outside that set keeps going through the normal launch path.
+//
+// Synchronization contract: the queue is NOT stream-ordered. The host must
+// make sure producers of the input tensors have finished (for example via
+// torch.cuda.synchronize) before the first enqueue, and must call
+// cuda_persistent::synchronize before reading the outputs from ordinary
+// streams. Between enqueues no synchronization is needed; the worker
+// executes records strictly in queue order, with a grid-wide barrier
+// between records so every op sees the previous op's writes. Enqueued
+// tensors are retained until synchronize/stop so the caching allocator
+// cannot recycle their storage while the worker may still touch it.
+//
+// The grid-wide barrier is a software sense-reversing barrier rather than
+// cooperative groups: the grid is sized with the occupancy calculator so
+// every block is co-resident, which is the only property a cooperative
+// launch would add, and a plain launch keeps the file in line with the
+// rest of native/cuda (and with hipify).
+
+constexpr int kBlockThreads = 256;
+
+enum class MicroOp : int32_t {
+  Add,
+  Sub,
+  Mul,
+  Div,
+  AddScalar,
+  SubScalar,
+  MulScalar,
+  DivScalar,
+  Copy,
+  Neg,
+  Relu,
+  Exp,
+  Sigmoid,
+  Tanh,
+};
+
+// One queue record. All pointers are device-visible; `b` is null for
+// unary and scalar ops.
+struct PersistentOp {
+  int32_t opcode;
+  int32_t scalar_type;
+  int64_t numel;
+  void* out;
+  const void* a;
+  const void* b;
+  double scalar;
+};
+
+// Lives at the front of the mapped allocation, followed by the record
+// ring. `head` is written by the host, `tail` by the device; both only
+// ever increase while the worker is running.
+struct PersistentQueueHeader {
+  volatile long long head;
+  volatile long long tail;
+  volatile int stop;
+};
+
+__device__ unsigned int g_barrier_count;
+__device__ unsigned int g_barrier_sense;
+__device__ int g_run_state;
+__device__ PersistentOp g_current_op;
+
+// Sense-reversing grid barrier. Correct only because start() sizes the
+// grid so all blocks are resident at once; a non-resident block would
+// never arrive and the resident ones would spin forever.
+__device__ void grid_sync(unsigned int num_blocks, unsigned int* local_sense) {
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    const unsigned int sense = 1u - *local_sense;
+    *local_sense = sense;
+    __threadfence();
+    if (atomicInc(&g_barrier_count, num_blocks - 1) == num_blocks - 1) {
+      *reinterpret_cast<volatile unsigned int*>(&g_barrier_sense) = sense;
+    } else {
+      while (*reinterpret_cast<volatile unsigned int*>(&g_barrier_sense) !=
+             sense) {
+      }
+    }
+  }
+  __syncthreads();
+}
+
+// Reads a record through a volatile view so no lane sees a stale L1 copy
+// after the barrier.
+__device__ PersistentOp load_op_volatile(const PersistentOp* p) {
+  const volatile PersistentOp* v =
+      reinterpret_cast<const volatile PersistentOp*>(p);
+  PersistentOp op;
+  op.opcode = v->opcode;
+  op.scalar_type = v->scalar_type;
+  op.numel = v->numel;
+  op.out = v->out;
+  op.a = v->a;
+  op.b = v->b;
+  op.scalar = v->scalar;
+  return op;
+}
+
+template <typename scalar_t>
+__device__ void apply_op(const PersistentOp& op, int64_t tid, int64_t nthreads) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  auto* out = static_cast<scalar_t*>(op.out);
+  const auto* a = static_cast<const scalar_t*>(op.a);
+  const auto* b = static_cast<const scalar_t*>(op.b);
+  const opmath_t s = static_cast<opmath_t>(op.scalar);
+  for (int64_t i = tid; i < op.numel; i += nthreads) {
+    const opmath_t x = static_cast<opmath_t>(a[i]);
+    opmath_t r = x;
+    switch (static_cast<MicroOp>(op.opcode)) {
+      case MicroOp::Add:
+        r = x + static_cast<opmath_t>(b[i]);
+        break;
+      case MicroOp::Sub:
+        r = x - static_cast<opmath_t>(b[i]);
+        break;
+      case MicroOp::Mul:
+        r = x * static_cast<opmath_t>(b[i]);
+        break;
+      case MicroOp::Div:
+        r = x / static_cast<opmath_t>(b[i]);
+        break;
+      case MicroOp::AddScalar:
+        r = x + s;
+        break;
+      case MicroOp::SubScalar:
+        r = x - s;
+        break;
+      case MicroOp::MulScalar:
+        r = x * s;
+        break;
+      case MicroOp::DivScalar:
+        r = x / s;
+        break;
+      case MicroOp::Copy:
+        break;
+      case MicroOp::Neg:
+        r = -x;
+        break;
+      case MicroOp::Relu:
+        r = x > opmath_t(0) ? x : opmath_t(0);
+        break;
+      case MicroOp::Exp:
+        r = ::exp(x);
+        break;
+      case MicroOp::Sigmoid:
+        r = opmath_t(1) / (opmath_t(1) + ::exp(-x));
+        break;
+      case MicroOp::Tanh:
+        r = ::tanh(x);
+        break;
+    }
+    out[i] = static_cast<scalar_t>(r);
+  }
+}
+
+__device__ void run_op(const PersistentOp& op, int64_t tid, int64_t nthreads) {
+  // The host validates the dtype at enqueue time, so the default case is
+  // unreachable.
+  switch (static_cast<ScalarType>(op.scalar_type)) {
+    case ScalarType::Float:
+      apply_op<float>(op, tid, nthreads);
+      break;
+    case ScalarType::Double:
+      apply_op<double>(op, tid, nthreads);
+      break;
+    case ScalarType::Half:
+      apply_op<at::Half>(op, tid, nthreads);
+      break;
+    case ScalarType::BFloat16:
+      apply_op<at::BFloat16>(op, tid, nthreads);
+      break;
+    default:
+      break;
+  }
+}
+
+__global__ void persistent_worker_kernel(
+    PersistentQueueHeader* header,
+    const PersistentOp* ops,
+    int64_t capacity,
+    unsigned int num_blocks) {
+  __shared__ unsigned int local_sense;
+  if (threadIdx.x == 0) {
+    local_sense = 0;
+  }
+  const int64_t tid =
+      static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int64_t nthreads = static_cast<int64_t>(num_blocks) * blockDim.x;
+  long long completed = 0;
+  while (true) {
+    if (tid == 0) {
+      // Only one lane polls the bus; everyone else parks in the barrier.
+      while (header->head == completed && header->stop == 0) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+        __nanosleep(100);
+#endif
+      }
+      if (header->head != completed) {
+        g_current_op = load_op_volatile(&ops[completed % capacity]);
+        g_run_state = 1;
+      } else {
+        g_run_state = 0;
+      }
+      __threadfence();
+    }
+    grid_sync(num_blocks, &local_sense);
+    if (*reinterpret_cast<volatile int*>(&g_run_state) == 0) {
+      break;
+    }
+    const PersistentOp op = load_op_volatile(&g_current_op);
+    run_op(op, tid, nthreads);
+    // Make this op's writes visible (to the next op and to the host)
+    // before the tail moves past it.
+    __threadfence_system();
+    grid_sync(num_blocks, &local_sense);
+    ++completed;
+    if (tid == 0) {
+      header->tail = completed;
+    }
+  }
+}
+
+struct PersistentKernelState {
+  std::mutex mutex;
+  bool running = false;
+  int device = -1;
+  int64_t capacity = 0;
+  int64_t submitted = 0;
+  void* host_base = nullptr;
+  PersistentQueueHeader* header = nullptr;
+  PersistentOp* ops = nullptr;
+  cudaStream_t stream = nullptr;
+  // Storages the worker may still touch; see Note [Persistent micro-op
+  // worker].
+  std::vector<Tensor> retained;
+};
+
+PersistentKernelState& state() {
+  static PersistentKernelState s;
+  return s;
+}
+
+// The worker never returns while running, so cudaStreamQuery should stay
+// cudaErrorNotReady; anything else means it asserted or exited.
+void check_worker_alive(PersistentKernelState& s) {
+  const cudaError_t err = cudaStreamQuery(s.stream);
+  if (err == cudaErrorNotReady) {
+    return;
+  }
+  TORCH_CHECK(
+      err != cudaSuccess,
+      "cuda_persistent: the worker kernel exited unexpectedly");
+  C10_CUDA_CHECK(err);
+}
+
+void spin_until_tail_reaches(PersistentKernelState& s, int64_t target) {
+  int64_t spins = 0;
+  while (static_cast<int64_t>(s.header->tail) < target) {
+    if ((++spins & 0x3fff) == 0) {
+      check_worker_alive(s);
+      std::this_thread::yield();
+    }
+  }
+}
+
+MicroOp parse_binary_op(const std::string& op) {
+  if (op == "add") {
+    return MicroOp::Add;
+  } else if (op == "sub") {
+    return MicroOp::Sub;
+  } else if (op == "mul") {
+    return MicroOp::Mul;
+  } else if (op == "div") {
+    return MicroOp::Div;
+  }
+  TORCH_CHECK(
+      false,
+      "cuda_persistent: unsupported binary op '",
+      op,
+      "'; expected one of add, sub, mul, div");
+}
+
+MicroOp parse_binary_scalar_op(const std::string& op) {
+  if (op == "add") {
+    return MicroOp::AddScalar;
+  } else if (op == "sub") {
+    return MicroOp::SubScalar;
+  } else if (op == "mul") {
+    return MicroOp::MulScalar;
+  } else if (op == "div") {
+    return MicroOp::DivScalar;
+  }
+  TORCH_CHECK(
+      false,
+      "cuda_persistent: unsupported scalar op '",
+      op,
+      "'; expected one of add, sub, mul, div");
+}
+
+MicroOp parse_unary_op(const std::string& op) {
+  if (op == "copy") {
+    return MicroOp::Copy;
+  } else if (op == "neg") {
+    return MicroOp::Neg;
+  } else if (op == "relu") {
+    return MicroOp::Relu;
+  } else if (op == "exp") {
+    return MicroOp::Exp;
+  } else if (op == "sigmoid") {
+    return MicroOp::Sigmoid;
+  } else if (op == "tanh") {
+    return MicroOp::Tanh;
+  }
+  TORCH_CHECK(
+      false,
+      "cuda_persistent: unsupported unary op '",
+      op,
+      "'; expected one of copy, neg, relu, exp, sigmoid, tanh");
+}
+
+bool is_supported_dtype(ScalarType t) {
+  return t == ScalarType::Float || t == ScalarType::Double ||
+      t == ScalarType::Half || t == ScalarType::BFloat16;
+}
+
+void check_operand(
+    const PersistentKernelState& s,
+    const Tensor& t,
+    const Tensor& out,
+    const char* name) {
+  TORCH_CHECK(
+      t.is_cuda() && t.get_device() == s.device,
+      "cuda_persistent: ",
+      name,
+      " must live on the device the worker was started on (cuda:",
+      s.device,
+      "), got ",
+      t.device());
+  TORCH_CHECK(
+      t.is_contiguous(),
+      "cuda_persistent: ",
+      name,
+      " must be contiguous");
+  TORCH_CHECK(
+      t.scalar_type() == out.scalar_type(),
+      "cuda_persistent: ",
+      name,
+      " dtype (",
+      t.scalar_type(),
+      ") must match out dtype (",
+      out.scalar_type(),
+      ")");
+  TORCH_CHECK(
+      t.numel() == out.numel(),
+      "cuda_persistent: ",
+      name,
+      " numel (",
+      t.numel(),
+      ") must match out numel (",
+      out.numel(),
+      "); broadcasting is not supported");
+}
+
+void check_out(const PersistentKernelState& s, const Tensor& out) {
+  TORCH_CHECK(
+      out.is_cuda() && out.get_device() == s.device,
+      "cuda_persistent: out must live on the device the worker was started "
+      "on (cuda:",
+      s.device,
+      "), got ",
+      out.device());
+  TORCH_CHECK(out.is_contiguous(), "cuda_persistent: out must be contiguous");
+  TORCH_CHECK(
+      is_supported_dtype(out.scalar_type()),
+      "cuda_persistent: unsupported dtype ",
+      out.scalar_type(),
+      "; expected float, double, half or bfloat16");
+}
+
+void enqueue_record(PersistentKernelState& s, const PersistentOp& record) {
+  // Backpressure: wait for the worker to free a ring slot.
+  int64_t spins = 0;
+  while (s.submitted - static_cast<int64_t>(s.header->tail) >= s.capacity) {
+    if ((++spins & 0x3fff) == 0) {
+      check_worker_alive(s);
+      std::this_thread::yield();
+    }
+  }
+  s.ops[s.submitted % s.capacity] = record;
+  // The record must be globally visible before head publishes it.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  s.header->head = static_cast<long long>(++s.submitted);
+}
+
+void persistent_start(int64_t capacity) {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  TORCH_CHECK(!s.running, "cuda_persistent: the worker is already running");
+  TORCH_CHECK(
+      capacity >= 2 && capacity <= (1 << 20),
+      "cuda_persistent: capacity must be in [2, 2**20], got ",
+      capacity);
+  const int device = static_cast<int>(c10::cuda::current_device());
+  const cudaDeviceProp* prop = at::cuda::getCurrentDeviceProperties();
+  TORCH_CHECK(
+      prop->canMapHostMemory,
+      "cuda_persistent: device cuda:",
+      device,
+      " cannot map host memory");
+
+  const size_t bytes =
+      sizeof(PersistentQueueHeader) + capacity * sizeof(PersistentOp);
+  void* host = nullptr;
+  C10_CUDA_CHECK(cudaHostAlloc(&host, bytes, cudaHostAllocMapped));
+  std::memset(host, 0, bytes);
+  void* dev = nullptr;
+  C10_CUDA_CHECK(cudaHostGetDevicePointer(&dev, host, 0));
+
+  const unsigned int zero = 0;
+  C10_CUDA_CHECK(cudaMemcpyToSymbol(g_barrier_count, &zero, sizeof(zero)));
+  C10_CUDA_CHECK(cudaMemcpyToSymbol(g_barrier_sense, &zero, sizeof(zero)));
+
+  int blocks_per_sm = 0;
+  C10_CUDA_CHECK(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &blocks_per_sm, persistent_worker_kernel, kBlockThreads, 0));
+  TORCH_CHECK(
+      blocks_per_sm > 0,
+      "cuda_persistent: could not fit the worker kernel on the device");
+  const unsigned int num_blocks =
+      static_cast<unsigned int>(blocks_per_sm) * prop->multiProcessorCount;
+
+  // The worker occupies its stream until stop(); a dedicated stream keeps
+  // it from blocking work queued behind it on a shared pool stream.
+  cudaStream_t stream = nullptr;
+  C10_CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  auto* dev_header = static_cast<PersistentQueueHeader*>(dev);
+  auto* dev_ops = reinterpret_cast<PersistentOp*>(
+      static_cast<char*>(dev) + sizeof(PersistentQueueHeader));
+  persistent_worker_kernel<<<num_blocks, kBlockThreads, 0, stream>>>(
+      dev_header, dev_ops, capacity, num_blocks);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+
+  s.running = true;
+  s.device = device;
+  s.capacity = capacity;
+  s.submitted = 0;
+  s.host_base = host;
+  s.header = static_cast<PersistentQueueHeader*>(host);
+  s.ops = reinterpret_cast<PersistentOp*>(
+      static_cast<char*>(host) + sizeof(PersistentQueueHeader));
+  s.stream = stream;
+}
+
+void persistent_stop() {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (!s.running) {
+    return;
+  }
+  // The worker drains the queue before honoring stop, so pending records
+  // still execute.
+  s.header->stop = 1;
+  C10_CUDA_CHECK(cudaStreamSynchronize(s.stream));
+  C10_CUDA_CHECK(cudaStreamDestroy(s.stream));
+  C10_CUDA_CHECK(cudaFreeHost(s.host_base));
+  s.running = false;
+  s.device = -1;
+  s.capacity = 0;
+  s.submitted = 0;
+  s.host_base = nullptr;
+  s.header = nullptr;
+  s.ops = nullptr;
+  s.stream = nullptr;
+  s.retained.clear();
+}
+
+void persistent_synchronize() {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  TORCH_CHECK(s.running, "cuda_persistent: start() has not been called");
+  spin_until_tail_reaches(s, s.submitted);
+  s.retained.clear();
+}
+
+bool persistent_is_running() {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return s.running;
+}
+
+void persistent_binary(
+    std::string op,
+    Tensor out,
+    const Tensor& self,
+    const Tensor& other) {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  TORCH_CHECK(s.running, "cuda_persistent: start() has not been called");
+  const MicroOp opcode = parse_binary_op(op);
+  check_out(s, out);
+  check_operand(s, self, out, "self");
+  check_operand(s, other, out, "other");
+  PersistentOp record{};
+  record.opcode = static_cast<int32_t>(opcode);
+  record.scalar_type = static_cast<int32_t>(out.scalar_type());
+  record.numel = out.numel();
+  record.out = out.data_ptr();
+  record.a = self.data_ptr();
+  record.b = other.data_ptr();
+  s.retained.push_back(out);
+  s.retained.push_back(self);
+  s.retained.push_back(other);
+  enqueue_record(s, record);
+}
+
+void persistent_binary_scalar(
+    std::string op,
+    Tensor out,
+    const Tensor& self,
+    const Scalar& other) {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  TORCH_CHECK(s.running, "cuda_persistent: start() has not been called");
+  const MicroOp opcode = parse_binary_scalar_op(op);
+  check_out(s, out);
+  check_operand(s, self, out, "self");
+  PersistentOp record{};
+  record.opcode = static_cast<int32_t>(opcode);
+  record.scalar_type = static_cast<int32_t>(out.scalar_type());
+  record.numel = out.numel();
+  record.out = out.data_ptr();
+  record.a = self.data_ptr();
+  record.scalar = other.to<double>();
+  s.retained.push_back(out);
+  s.retained.push_back(self);
+  enqueue_record(s, record);
+}
+
+void persistent_unary(std::string op, Tensor out, const Tensor& self) {
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  TORCH_CHECK(s.running, "cuda_persistent: start() has not been called");
+  const MicroOp opcode = parse_unary_op(op);
+  check_out(s, out);
+  check_operand(s, self, out, "self");
+  PersistentOp record{};
+  record.opcode = static_cast<int32_t>(opcode);
+  record.scalar_type = static_cast<int32_t>(out.scalar_type());
+  record.numel = out.numel();
+  record.out = out.data_ptr();
+  record.a = self.data_ptr();
+  s.retained.push_back(out);
+  s.retained.push_back(self);
+  enqueue_record(s, record);
+}
+
+} // namespace
+
+TORCH_LIBRARY(cuda_persistent, m) {
+  m.def("start(int capacity=1024) -> ()", TORCH_FN(persistent_start));
+  m.def("stop() -> ()", TORCH_FN(persistent_stop));
+  m.def("synchronize() -> ()", TORCH_FN(persistent_synchronize));
+  m.def("is_running() -> bool", TORCH_FN(persistent_is_running));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "cuda_persistent::binary(str op, Tensor(a!) out, Tensor self, Tensor other) -> ()"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "cuda_persistent::binary_scalar(str op, Tensor(a!) out, Tensor self, Scalar other) -> ()"));
+  m.def(TORCH_SELECTIVE_SCHEMA(
+      "cuda_persistent::unary(str op, Tensor(a!) out, Tensor self) -> ()"));
+}
+
+TORCH_LIBRARY_IMPL(cuda_persistent, CUDA, m) {
+  m.impl(
+      TORCH_SELECTIVE_NAME("cuda_persistent::binary"),
+      TORCH_FN(persistent_binary));
+  m.impl(
+      TORCH_SELECTIVE_NAME("cuda_persistent::binary_scalar"),
+      TORCH_FN(persistent_binary_scalar));
+  m.impl(
+      TORCH_SELECTIVE_NAME("cuda_persistent::unary"),
+      TORCH_FN(persistent_unary));
+}
+
+} // namespace native
+} // namespace at
@@ -6,14 +6,18 @@
 
 #include <ATen/ATen.h>
 #include <ATen/AccumulateType.h>
+#include <ATen/CUDAGeneratorImpl.h>
 #include <ATen/Dispatch.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/cuda/detail/IndexUtils.cuh>
 #include <ATen/native/cuda/block_reduce.cuh>
 
 #include <c10/cuda/CUDAMathCompat.h>
 
+#include <curand_kernel.h>
+
 namespace at {
 namespace native {
 
@@ -83,6 +87,72 @@ __global__ void LayerNormForwardCUDAKernel(
   }
 }
 
+// First stage of the fused dropout + add + layer_norm forward: applies
+// dropout to X, adds the residual R and computes the rowwise moments of the
+// sum in a single pass, writing out the sum A (needed for the layer norm
+// backward anyway) and the dropout mask. The second stage is the regular
+// LayerNormForwardCUDAKernel on A. See Note [Fused dropout add layer_norm].
+template <typename T, typename T_ACC>
+__global__ void DropoutAddRowwiseMomentsCUDAKernel(
+    int64_t N,
+    T_ACC eps,
+    T_ACC keep_prob,
+    T_ACC dropout_scale,
+    bool train,
+    PhiloxCudaState philox_args,
+    const T* X,
+    const T* R,
+    T* A,
+    uint8_t* mask,
+    T_ACC* mean,
+    T_ACC* rstd) {
+  __shared__ T_ACC m1_shared[C10_WARP_SIZE];
+  __shared__ T_ACC m2_shared[C10_WARP_SIZE];
+  const int64_t i = blockIdx.x;
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      i * blockDim.x + threadIdx.x,
+      std::get<1>(seeds),
+      &state);
+  T_ACC sum1 = 0;
+  T_ACC sum2 = 0;
+  // Philox produces 128 random bits at a time; each curand_uniform4 call
+  // feeds four strided elements, like in Dropout.cu.
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x * 4) {
+    const float4 rand = curand_uniform4(&state);
+    const float rand4[4] = {rand.x, rand.y, rand.z, rand.w};
+#pragma unroll
+    for (int k = 0; k < 4; ++k) {
+      const int64_t jj = j + k * static_cast<int64_t>(blockDim.x);
+      if (jj < N) {
+        const int64_t index = i * N + jj;
+        const uint8_t keep =
+            !train || static_cast<T_ACC>(rand4[k]) < keep_prob;
+        T_ACC a = static_cast<T_ACC>(X[index]);
+        if (train) {
+          a *= keep * dropout_scale;
+        }
+        a += static_cast<T_ACC>(R[index]);
+        A[index] = static_cast<T>(a);
+        mask[index] = keep;
+        sum1 += a;
+        sum2 += a * a;
+      }
+    }
+  }
+  sum1 = cuda_utils::BlockReduceSum<T_ACC>(sum1, m1_shared);
+  sum2 = cuda_utils::BlockReduceSum<T_ACC>(sum2, m2_shared);
+  if (threadIdx.x == 0) {
+    const T_ACC scale = T_ACC(1) / static_cast<T_ACC>(N);
+    const T_ACC m1 = sum1 * scale;
+    const T_ACC m2 = c10::cuda::compat::max(sum2 * scale - m1 * m1, T_ACC(0));
+    mean[i] = m1;
+    rstd[i] = c10::cuda::compat::rsqrt(m2 + eps);
+  }
+}
+
 template <typename T>
 __global__ void ComputeInternalGradientsCUDAKernel(
     int64_t N,
@@ -568,6 +638,195 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cuda(
   return std::make_tuple(std::move(dX), std::move(dgamma), std::move(dbeta));
 }
 
+// Note [Fused dropout add layer_norm]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Transformer residual connections compute
+//   layer_norm(dropout(x) + residual)
+// which, run as three ops, materializes the dropout output and the sum as
+// separate intermediates and reads the sum twice more for the layer norm
+// stats and normalization. The fused forward writes only the sum A (which
+// the layer norm backward needs saved regardless) and computes the rowwise
+// moments in the same pass, saving two full activation read/writes per
+// block. The backward reuses the tuned layer_norm backward kernels on A and
+// then undoes the dropout with a single masked scale; the sum's gradient is
+// also the residual's gradient, so nothing else is recomputed.
+std::tuple<Tensor, Tensor, Tensor, Tensor, Tensor> dropout_add_layer_norm_cuda(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    double eps,
+    bool train,
+    c10::optional<Generator> gen_) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned =
+      at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned =
+      at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  TORCH_CHECK(
+      p >= 0 && p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      p);
+  TORCH_CHECK(
+      input.sizes().equals(residual.sizes()),
+      "_dropout_add_layer_norm: input and residual must have the same shape, "
+      "but got ",
+      input.sizes(),
+      " and ",
+      residual.sizes());
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto R = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor Y = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor A = at::native::empty_like(
+      *X,
+      c10::nullopt /* dtype */,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  Tensor mask = at::native::empty_like(
+      *X,
+      kByte,
+      c10::nullopt /* layout */,
+      c10::nullopt /* device */,
+      c10::nullopt /* pin_memory */,
+      LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  const auto kAccType = at::toAccumulateType(input.scalar_type(), /*is_cuda=*/true);
+  Tensor mean = at::empty({M}, X->options().dtype(kAccType));
+  Tensor rstd = at::empty({M}, X->options().dtype(kAccType));
+
+  if (M > 0) {
+    auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+        gen_, cuda::detail::getDefaultCUDAGenerator());
+    // Each thread draws 4 random numbers per curand_uniform4 call.
+    const int64_t counter_offset =
+        ((N - 1) / (cuda_utils::kCUDABlockReduceNumThreads * 4) + 1) * 4;
+    PhiloxCudaState rng_engine_inputs;
+    {
+      // See Note [Acquire lock when using random generators]
+      std::lock_guard<std::mutex> lock(gen->mutex_);
+      rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    }
+    cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::ScalarType::Half,
+        at::ScalarType::BFloat16,
+        X->scalar_type(),
+        "dropout_add_layer_norm_cuda",
+        [&]() {
+          using acc_t = acc_type<scalar_t, true>;
+          const acc_t keep_prob = static_cast<acc_t>(1) - static_cast<acc_t>(p);
+          const acc_t dropout_scale =
+              p < 1 ? static_cast<acc_t>(1) / keep_prob : acc_t(0);
+          DropoutAddRowwiseMomentsCUDAKernel<scalar_t, acc_t>
+              <<<M, cuda_utils::kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+                  N,
+                  static_cast<acc_t>(eps),
+                  keep_prob,
+                  dropout_scale,
+                  train,
+                  rng_engine_inputs,
+                  X->data_ptr<scalar_t>(),
+                  R->data_ptr<scalar_t>(),
+                  A.data_ptr<scalar_t>(),
+                  mask.data_ptr<uint8_t>(),
+                  mean.data_ptr<acc_t>(),
+                  rstd.data_ptr<acc_t>());
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+          LayerNormForwardCUDAKernel<scalar_t, acc_t>
+              <<<M, kCUDANumThreads, 0, cuda_stream>>>(
+                  N,
+                  A.data_ptr<scalar_t>(),
+                  mean.data_ptr<acc_t>(),
+                  rstd.data_ptr<acc_t>(),
+                  gamma->defined() ? gamma->data_ptr<scalar_t>() : nullptr,
+                  beta->defined() ? beta->data_ptr<scalar_t>() : nullptr,
+                  Y.data_ptr<scalar_t>());
+          C10_CUDA_KERNEL_LAUNCH_CHECK();
+        });
+
+    const auto input_shape = input.sizes();
+    const size_t axis = input.dim() - normalized_shape.size();
+
+    std::vector<int64_t> stat_shape;
+    for (size_t idx = 0; idx < axis; ++idx) {
+      stat_shape.push_back(input_shape[idx]);
+    }
+    for (size_t idx = axis; idx < input.dim(); ++idx) {
+      stat_shape.push_back(1);
+    }
+
+    mean = mean.view(stat_shape);
+    rstd = rstd.view(stat_shape);
+  }
+  return std::make_tuple(
+      std::move(Y),
+      std::move(mask),
+      std::move(A),
+      std::move(mean),
+      std::move(rstd));
+}
+
+std::tuple<Tensor, Tensor, Tensor, Tensor> dropout_add_layer_norm_backward_cuda(
+    const Tensor& grad_out,
+    const Tensor& mask,
+    const Tensor& add_out,
+    IntArrayRef normalized_shape,
+    const Tensor& mean,
+    const Tensor& rstd,
+    const c10::optional<Tensor>& weight_opt /* optional */,
+    const c10::optional<Tensor>& bias_opt /* optional */,
+    double p,
+    bool train,
+    std::array<bool, 4> grad_input_mask) {
+  // The layer norm sees add_out as its input, so its input gradient is the
+  // residual's gradient; the input's gradient additionally undoes the
+  // dropout via the saved mask. See Note [Fused dropout add layer_norm].
+  const bool needs_add_grad = grad_input_mask[0] || grad_input_mask[1];
+  auto ln_grads = at::native_layer_norm_backward(
+      grad_out,
+      add_out,
+      normalized_shape,
+      mean,
+      rstd,
+      weight_opt,
+      bias_opt,
+      {needs_add_grad, grad_input_mask[2], grad_input_mask[3]});
+  Tensor dA = std::move(std::get<0>(ln_grads));
+  Tensor dX;
+  Tensor dR;
+  if (grad_input_mask[0]) {
+    const double dropout_scale = (train && p < 1) ? 1.0 / (1.0 - p) : 0.0;
+    dX = (train && p > 0) ? at::_masked_scale(dA, mask, dropout_scale)
+                          : dA.clone();
+  }
+  if (grad_input_mask[1]) {
+    dR = std::move(dA);
+  }
+  return std::make_tuple(
+      std::move(dX),
+      std::move(dR),
+      std::move(std::get<1>(ln_grads)),
+      std::move(std::get<2>(ln_grads)));
+}
+
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
 
@@ -11,6 +11,7 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Config.h>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/native/cudnn/ConvShared.h>
@@ -22,8 +23,12 @@
 #include <ATen/TensorUtils.h>
 #include <c10/util/irange.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <functional>
 #include <iterator>
+#include <random>
 #include <sstream>
 #include <algorithm>
 #include <memory>
@@ -118,12 +123,212 @@ struct BenchmarkCache {
     std::lock_guard<std::mutex> guard(mutex);
     map[params] = results;
   }
+
+  // Bulk accessors used by the on-disk persistence path, see
+  // Note [cuDNN benchmark cache persistence]
+  void insertIfAbsent(const ConvolutionParams& params, const T& results) {
+    std::lock_guard<std::mutex> guard(mutex);
+    map.emplace(params, results);
+  }
+
+  std::vector<std::pair<ConvolutionParams, T>> snapshot() {
+    std::lock_guard<std::mutex> guard(mutex);
+    return {map.begin(), map.end()};
+  }
 };
 
 BenchmarkCache<cudnnConvolutionFwdAlgoPerf_t> fwd_algos;
 BenchmarkCache<cudnnConvolutionBwdDataAlgoPerf_t> bwd_data_algos;
 BenchmarkCache<cudnnConvolutionBwdFilterAlgoPerf_t> bwd_filter_algos;
 
+// Note [cuDNN benchmark cache persistence]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With torch.backends.cudnn.benchmark enabled, every process pays for the
+// cudnnFind sweeps above from scratch, which can add tens of seconds of GPU
+// time to startup for models with many distinct conv configs. If
+// TORCH_CUDNN_BENCHMARK_CACHE names a file, the benchmark caches are loaded
+// from it the first time an algorithm is looked up in benchmark mode, and
+// flushed back after each newly benchmarked config, so restarted replicas
+// (and other processes sharing the file, e.g. on a network filesystem) skip
+// cudnnFind for any config some process has already measured.
+//
+// The file header records the cuDNN version, the GPU architecture
+// (sm major/minor) and the record sizes; a file whose header does not match
+// the current process is silently ignored (and eventually overwritten), so
+// a driver or hardware upgrade just re-benchmarks. ConvolutionParams and
+// the cuDNN perf structs are PODs that are fully initialized (including
+// padding bytes, via memset / cudnnFind) before use, so records are stored
+// as raw bytes. device_id is an ordinal that is not portable across
+// processes: it is normalized to 0 on disk and records are replayed onto
+// every visible device of the matching architecture on load. Writers
+// produce a temporary file next to the target and rename() it into place so
+// readers never observe a partially written cache, and a flush first merges
+// the current file contents so concurrent writers only ever add entries.
+namespace {
+
+constexpr uint64_t kBenchmarkCacheMagic = 0x3176636e6e647543ULL; // "Cudnncv1"
+
+struct BenchmarkCacheFileHeader {
+  uint64_t magic;
+  uint64_t cudnn_version;
+  int32_t device_major;
+  int32_t device_minor;
+  uint32_t params_bytes;
+  uint32_t perf_bytes[3];
+  uint64_t counts[3];
+};
+
+const char* benchmarkCacheFile() {
+  static const char* path = std::getenv("TORCH_CUDNN_BENCHMARK_CACHE");
+  return path;
+}
+
+template <typename perf_t>
+bool readCacheSection(
+    std::istream& in,
+    uint64_t count,
+    const std::vector<c10::DeviceIndex>& devices,
+    BenchmarkCache<perf_t>& cache) {
+  for (const auto i : c10::irange(count)) {
+    (void)i;
+    ConvolutionParams params;
+    perf_t perf;
+    if (!in.read(reinterpret_cast<char*>(&params), sizeof(params)) ||
+        !in.read(reinterpret_cast<char*>(&perf), sizeof(perf))) {
+      return false;
+    }
+    for (const auto device : devices) {
+      params.device_id = device;
+      cache.insertIfAbsent(params, perf);
+    }
+  }
+  return true;
+}
+
+void loadBenchmarkCacheFromDisk() {
+  const char* path = benchmarkCacheFile();
+  if (path == nullptr) {
+    return;
+  }
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return;
+  }
+  BenchmarkCacheFileHeader header;
+  if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+    return;
+  }
+  if (header.magic != kBenchmarkCacheMagic ||
+      header.cudnn_version != cudnnGetVersion() ||
+      header.params_bytes != sizeof(ConvolutionParams) ||
+      header.perf_bytes[0] != sizeof(cudnnConvolutionFwdAlgoPerf_t) ||
+      header.perf_bytes[1] != sizeof(cudnnConvolutionBwdDataAlgoPerf_t) ||
+      header.perf_bytes[2] != sizeof(cudnnConvolutionBwdFilterAlgoPerf_t)) {
+    return;
+  }
+  std::vector<c10::DeviceIndex> devices;
+  for (const auto i : c10::irange(at::cuda::device_count())) {
+    auto* prop = at::cuda::getDeviceProperties(i);
+    if (prop->major == header.device_major &&
+        prop->minor == header.device_minor) {
+      devices.push_back(static_cast<c10::DeviceIndex>(i));
+    }
+  }
+  if (devices.empty()) {
+    return;
+  }
+  if (!readCacheSection(in, header.counts[0], devices, fwd_algos)) {
+    return;
+  }
+  if (!readCacheSection(in, header.counts[1], devices, bwd_data_algos)) {
+    return;
+  }
+  readCacheSection(in, header.counts[2], devices, bwd_filter_algos);
+}
+
+// Entries restricted to devices of the given architecture, deduped with
+// device_id normalized to 0 so they are portable across processes.
+template <typename perf_t>
+std::unordered_map<ConvolutionParams, perf_t, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>>
+collectPortableEntries(
+    BenchmarkCache<perf_t>& cache,
+    int device_major,
+    int device_minor) {
+  std::unordered_map<ConvolutionParams, perf_t, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>> result;
+  for (auto& entry : cache.snapshot()) {
+    auto* prop = at::cuda::getDeviceProperties(entry.first.device_id);
+    if (prop->major != device_major || prop->minor != device_minor) {
+      continue;
+    }
+    ConvolutionParams params = entry.first;
+    params.device_id = 0;
+    result.emplace(params, entry.second);
+  }
+  return result;
+}
+
+template <typename perf_t>
+void writeCacheSection(
+    std::ostream& out,
+    const std::unordered_map<ConvolutionParams, perf_t, ParamsHash<ConvolutionParams>, ParamsEqual<ConvolutionParams>>& entries) {
+  for (const auto& entry : entries) {
+    out.write(reinterpret_cast<const char*>(&entry.first), sizeof(entry.first));
+    out.write(reinterpret_cast<const char*>(&entry.second), sizeof(entry.second));
+  }
+}
+
+void flushBenchmarkCacheToDisk() {
+  const char* path = benchmarkCacheFile();
+  if (path == nullptr) {
+    return;
+  }
+  static std::mutex file_mutex;
+  std::lock_guard<std::mutex> guard(file_mutex);
+  // Merge what is already on disk first so entries recorded by a concurrent
+  // writer are carried forward rather than overwritten.
+  loadBenchmarkCacheFromDisk();
+  auto* prop = at::cuda::getCurrentDeviceProperties();
+  auto fwd = collectPortableEntries(fwd_algos, prop->major, prop->minor);
+  auto bwd_data = collectPortableEntries(bwd_data_algos, prop->major, prop->minor);
+  auto bwd_filter = collectPortableEntries(bwd_filter_algos, prop->major, prop->minor);
+  BenchmarkCacheFileHeader header;
+  header.magic = kBenchmarkCacheMagic;
+  header.cudnn_version = cudnnGetVersion();
+  header.device_major = prop->major;
+  header.device_minor = prop->minor;
+  header.params_bytes = sizeof(ConvolutionParams);
+  header.perf_bytes[0] = sizeof(cudnnConvolutionFwdAlgoPerf_t);
+  header.perf_bytes[1] = sizeof(cudnnConvolutionBwdDataAlgoPerf_t);
+  header.perf_bytes[2] = sizeof(cudnnConvolutionBwdFilterAlgoPerf_t);
+  header.counts[0] = fwd.size();
+  header.counts[1] = bwd_data.size();
+  header.counts[2] = bwd_filter.size();
+  // The suffix keeps concurrent processes from clobbering each other's
+  // temporary file; the rename itself is atomic.
+  static const std::string tmp_path =
+      std::string(path) + ".tmp-" + std::to_string(std::random_device{}());
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+      return;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeCacheSection(out, fwd);
+    writeCacheSection(out, bwd_data);
+    writeCacheSection(out, bwd_filter);
+    if (!out) {
+      out.close();
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+} // anonymous namespace
+
 // TODO: Stop manually allocating CUDA memory; allocate an ATen byte
 // tensor instead.
 struct Workspace {
@@ -499,6 +704,12 @@ public:
   void try_all(std::function<void (const perf_t &perf)> f) {
     bool only_use_default = args.params.deterministic && !benchmark;
 
+    if (benchmark) {
+      // See Note [cuDNN benchmark cache persistence]
+      static std::once_flag load_once;
+      std::call_once(load_once, loadBenchmarkCacheFromDisk);
+    }
+
     auto& cache = search::cache();
     perf_t algoPerf;
     if (!only_use_default && cache.find(args.params, &algoPerf)) {
@@ -515,6 +726,10 @@ public:
       try {
         f(algoPerf);
         cache.insert(args.params, algoPerf);
+        if (benchmark) {
+          // See Note [cuDNN benchmark cache persistence]
+          flushBenchmarkCacheToDisk();
+        }
         return;
       } catch (c10::CUDAOutOfMemoryError &e) {
         cudaGetLastError(); // clear CUDA error
@@ -3,7 +3,6 @@
 #include <ATen/AccumulateType.h>
 #include <ATen/ATen.h>
 #include <ATen/Config.h>
-#include <ATen/CPUApplyUtils.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Parallel.h>
 #include <c10/util/irange.h>
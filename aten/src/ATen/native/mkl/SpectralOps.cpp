@@ -191,6 +191,8 @@ Tensor& _fft_c2c_mkl_out(const Tensor& self, IntArrayRef dim, int64_t normalizat
 #if AT_POCKETFFT_ENABLED()
 #include <pocketfft_hdronly.h>
 
+#include <algorithm>
+
 namespace at { namespace native {
 
 namespace {
@@ -208,16 +210,6 @@ inline shape_t shape_from_tensor(const Tensor& t) {
   return shape_t(t.sizes().begin(), t.sizes().end());
 }
 
-template<typename T>
-inline std::complex<T> *tensor_cdata(Tensor& t) {
-  return reinterpret_cast<std::complex<T>*>(t.data<c10::complex<T>>());
-}
-
-template<typename T>
-inline const std::complex<T> *tensor_cdata(const Tensor& t) {
-  return reinterpret_cast<const std::complex<T>*>(t.data<c10::complex<T>>());
-}
-
 template<typename T>
 T compute_fct(int64_t size, int64_t normalization) {
   constexpr auto one = static_cast<T>(1);
@@ -242,6 +234,47 @@ T compute_fct(const Tensor& t, IntArrayRef dim, int64_t normalization) {
   return compute_fct<T>(n, normalization);
 }
 
+// pocketfft runs single-threaded as called here, so batched transforms are
+// sharded over the intra-op pool instead: each worker runs the transform on
+// a contiguous span of the largest non-transformed dimension, with the data
+// pointers offset by that dimension's (byte) stride. If every dimension is
+// being transformed there is nothing to shard and the call runs inline.
+// `run` is invoked as run(shape, in_ptr, out_ptr) with pointers into the
+// original buffers.
+template <typename Fn>
+void pocketfft_sharded(
+    const shape_t& shape, const stride_t& in_stride, const stride_t& out_stride,
+    const shape_t& axes, const void* in_data, void* out_data, const Fn& run) {
+  int64_t bdim = -1;
+  for (const auto i : c10::irange(shape.size())) {
+    if (std::find(axes.begin(), axes.end(), i) != axes.end()) {
+      continue;
+    }
+    if (bdim < 0 || shape[i] > shape[bdim]) {
+      bdim = static_cast<int64_t>(i);
+    }
+  }
+  if (bdim < 0 || shape[bdim] <= 1) {
+    run(shape, static_cast<const char*>(in_data), static_cast<char*>(out_data));
+    return;
+  }
+
+  const auto batch_size = static_cast<int64_t>(shape[bdim]);
+  int64_t numel = 1;
+  for (const auto s : shape) {
+    numel *= static_cast<int64_t>(s);
+  }
+  const auto per_batch = std::max<int64_t>(numel / batch_size, 1);
+  const auto grain = std::max<int64_t>(at::internal::GRAIN_SIZE / per_batch, 1);
+  at::parallel_for(0, batch_size, grain, [&](int64_t begin, int64_t end) {
+    shape_t chunk = shape;
+    chunk[bdim] = end - begin;
+    run(chunk,
+        static_cast<const char*>(in_data) + begin * in_stride[bdim],
+        static_cast<char*>(out_data) + begin * out_stride[bdim]);
+  });
+}
+
 } // anonymous namespace
 
 Tensor _fft_c2r_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization, int64_t last_dim_size) {
@@ -250,15 +283,26 @@ Tensor _fft_c2r_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
   out_sizes[dim.back()] = last_dim_size;
   auto out = at::empty(out_sizes, self.options().dtype(c10::toValueType(self.scalar_type())));
   pocketfft::shape_t axes(dim.begin(), dim.end());
+  const auto shape = shape_from_tensor(out);
+  const auto in_stride = stride_from_tensor(self);
+  const auto out_stride = stride_from_tensor(out);
   if (self.scalar_type() == kComplexFloat) {
-    pocketfft::c2r(shape_from_tensor(out), stride_from_tensor(self), stride_from_tensor(out), axes, false,
-                   tensor_cdata<float>(self),
-                   out.data<float>(), compute_fct<float>(out, dim, normalization));
+    const auto fct = compute_fct<float>(out, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::c2r(chunk, in_stride, out_stride, axes, false,
+                         reinterpret_cast<const std::complex<float>*>(in),
+                         reinterpret_cast<float*>(out_p), fct);
+        });
   } else {
-    pocketfft::c2r(shape_from_tensor(out), stride_from_tensor(self), stride_from_tensor(out), axes, false,
-                   tensor_cdata<double>(self),
-                   out.data<double>(), compute_fct<double>(out, dim, normalization));
-    }
+    const auto fct = compute_fct<double>(out, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::c2r(chunk, in_stride, out_stride, axes, false,
+                         reinterpret_cast<const std::complex<double>*>(in),
+                         reinterpret_cast<double*>(out_p), fct);
+        });
+  }
   return out;
 }
 
@@ -275,14 +319,25 @@ Tensor _fft_r2c_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
 
   auto out = at::empty(out_sizes, self.options().dtype(c10::toComplexType(self.scalar_type())));
   pocketfft::shape_t axes(dim.begin(), dim.end());
+  const auto shape = shape_from_tensor(self);
+  const auto in_stride = stride_from_tensor(self);
+  const auto out_stride = stride_from_tensor(out);
   if (self.scalar_type() == kFloat) {
-    pocketfft::r2c(shape_from_tensor(self), stride_from_tensor(self), stride_from_tensor(out), axes, true,
-                   self.data<float>(),
-                   tensor_cdata<float>(out), compute_fct<float>(self, dim, normalization));
+    const auto fct = compute_fct<float>(self, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::r2c(chunk, in_stride, out_stride, axes, true,
+                         reinterpret_cast<const float*>(in),
+                         reinterpret_cast<std::complex<float>*>(out_p), fct);
+        });
   } else {
-    pocketfft::r2c(shape_from_tensor(self), stride_from_tensor(self), stride_from_tensor(out), axes, true,
-                   self.data<double>(),
-                   tensor_cdata<double>(out), compute_fct<double>(self, dim, normalization));
+    const auto fct = compute_fct<double>(self, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::r2c(chunk, in_stride, out_stride, axes, true,
+                         reinterpret_cast<const double*>(in),
+                         reinterpret_cast<std::complex<double>*>(out_p), fct);
+        });
   }
 
   if (!onesided) {
@@ -295,14 +350,25 @@ Tensor _fft_c2c_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
   TORCH_CHECK(self.is_complex());
   auto out = at::empty(self.sizes(), self.options());
   pocketfft::shape_t axes(dim.begin(), dim.end());
+  const auto shape = shape_from_tensor(self);
+  const auto in_stride = stride_from_tensor(self);
+  const auto out_stride = stride_from_tensor(out);
   if (self.scalar_type() == kComplexFloat) {
-    pocketfft::c2c(shape_from_tensor(self), stride_from_tensor(self), stride_from_tensor(out), axes, forward,
-                   tensor_cdata<float>(self),
-                   tensor_cdata<float>(out), compute_fct<float>(self, dim, normalization));
+    const auto fct = compute_fct<float>(self, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::c2c(chunk, in_stride, out_stride, axes, forward,
+                         reinterpret_cast<const std::complex<float>*>(in),
+                         reinterpret_cast<std::complex<float>*>(out_p), fct);
+        });
   } else {
-    pocketfft::c2c(shape_from_tensor(self), stride_from_tensor(self), stride_from_tensor(out), axes, forward,
-                   tensor_cdata<double>(self),
-                   tensor_cdata<double>(out), compute_fct<double>(self, dim, normalization));
+    const auto fct = compute_fct<double>(self, dim, normalization);
+    pocketfft_sharded(shape, in_stride, out_stride, axes, self.data_ptr(), out.data_ptr(),
+        [&](const pocketfft::shape_t& chunk, const char* in, char* out_p) {
+          pocketfft::c2c(chunk, in_stride, out_stride, axes, forward,
+                         reinterpret_cast<const std::complex<double>*>(in),
+                         reinterpret_cast<std::complex<double>*>(out_p), fct);
+        });
   }
 
   return out;
@@ -320,10 +386,16 @@ Tensor _fft_c2c_mkl(const Tensor& self, IntArrayRef dim, int64_t normalization,
 #include <ATen/native/TensorIterator.h>
 
 #include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <numeric>
 #include <cmath>
 
+#include <c10/util/hash.h>
+
 #include <mkl_dfti.h>
 #include <ATen/mkl/Exceptions.h>
 #include <ATen/mkl/Descriptors.h>
@@ -415,6 +487,99 @@ static DftiDescriptor _plan_mkl_fft(
   return descriptor;
 }
 
+namespace {
+
+// Note [MKL DFTI plan cache]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Creating and committing a DFTI descriptor involves twiddle-factor and
+// work-area setup that is easily as expensive as a small transform itself.
+// Workloads like STFT frontends run the same transform geometry over
+// thousands of batches, so committed descriptors are kept in a small LRU
+// pool keyed on everything _plan_mkl_fft reads: the collapsed signal sizes,
+// input/output strides, domain (real/complex on either side), normalization,
+// direction and precision.
+//
+// MKL only allows one descriptor to be shared between threads if the number
+// of user threads is fixed up front (DFTI_NUMBER_OF_USER_THREADS), so
+// instead of sharing, take() hands the descriptor out by move - a plan that
+// is executing is checked out of the pool entirely (and thereby pinned:
+// eviction can only ever drop idle plans). Concurrent calls with the same
+// geometry simply build a second descriptor, and the duplicate is dropped
+// when it comes back to a pool that already holds that key.
+class DftiPlanCache {
+ public:
+  using Key = std::vector<int64_t>;
+
+  c10::optional<DftiDescriptor> take(const Key& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return c10::nullopt;
+    }
+    DftiDescriptor descriptor = std::move(it->second->second);
+    entries_.erase(it->second);
+    index_.erase(it);
+    return descriptor;
+  }
+
+  void put(Key key, DftiDescriptor descriptor) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (index_.count(key) > 0) {
+      return;
+    }
+    entries_.emplace_front(std::move(key), std::move(descriptor));
+    index_.emplace(entries_.front().first, entries_.begin());
+    if (entries_.size() > kCapacity) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  static constexpr size_t kCapacity = 64;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t seed = key.size();
+      for (const auto v : key) {
+        seed = c10::hash_combine(seed, std::hash<int64_t>()(v));
+      }
+      return seed;
+    }
+  };
+
+  std::mutex mutex_;
+  // Most recently returned plans live at the front; take() removes the
+  // entry outright, so iterators stored in the index stay valid.
+  std::list<std::pair<Key, DftiDescriptor>> entries_;
+  std::unordered_map<Key, std::list<std::pair<Key, DftiDescriptor>>::iterator, KeyHash>
+      index_;
+};
+
+DftiPlanCache& dfti_plan_cache() {
+  static DftiPlanCache cache;
+  return cache;
+}
+
+DftiPlanCache::Key make_dfti_plan_key(
+    IntArrayRef in_strides, IntArrayRef out_strides, IntArrayRef sizes,
+    bool complex_input, bool complex_output,
+    int64_t normalization, bool forward, ScalarType dtype) {
+  DftiPlanCache::Key key;
+  key.reserve(in_strides.size() + out_strides.size() + sizes.size() + 5);
+  key.insert(key.end(), sizes.begin(), sizes.end());
+  key.insert(key.end(), in_strides.begin(), in_strides.end());
+  key.insert(key.end(), out_strides.begin(), out_strides.end());
+  key.push_back(static_cast<int64_t>(complex_input));
+  key.push_back(static_cast<int64_t>(complex_output));
+  key.push_back(normalization);
+  key.push_back(static_cast<int64_t>(forward));
+  key.push_back(static_cast<int64_t>(dtype));
+  return key;
+}
+
+} // namespace
+
 // Execute a general fft operation (can be c2c, onesided r2c or onesided c2r)
 static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
                          IntArrayRef dim, int64_t normalization, bool forward) {
@@ -467,9 +632,17 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   const auto value_type = c10::toValueType(input.scalar_type());
   out.resize_(batched_out_sizes, MemoryFormat::Contiguous);
 
-  auto descriptor = _plan_mkl_fft(
+  // Reuse a committed descriptor when one exists for this geometry; see
+  // Note [MKL DFTI plan cache].
+  auto key = make_dfti_plan_key(
       input.strides(), out.strides(), signal_size, input.is_complex(),
       out.is_complex(), normalization, forward, value_type);
+  auto cached = dfti_plan_cache().take(key);
+  auto descriptor = cached.has_value()
+      ? std::move(*cached)
+      : _plan_mkl_fft(
+            input.strides(), out.strides(), signal_size, input.is_complex(),
+            out.is_complex(), normalization, forward, value_type);
 
   // run the FFT
   if (forward) {
@@ -477,6 +650,7 @@ static Tensor& _exec_fft(Tensor& out, const Tensor& self, IntArrayRef out_sizes,
   } else {
     MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), out.data_ptr()));
   }
+  dfti_plan_cache().put(std::move(key), std::move(descriptor));
 
   // Inplace reshaping to original batch shape and inverting the dimension permutation
   DimVector out_strides(ndim);
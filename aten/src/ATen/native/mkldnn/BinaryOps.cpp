@@ -49,7 +49,7 @@ namespace native {
 
 Tensor emptyBinaryOp(const Tensor& self, const Tensor& other) {
   if (!self.requires_grad() && !other.requires_grad()) {
-    auto out_size = infer_size(self.sizes(), other.sizes());
+    auto out_size = infer_size_dimvector(self.sizes(), other.sizes());
     auto out_dtype = promoteTypes(
         c10::typeMetaToScalarType(self.dtype()),
         c10::typeMetaToScalarType(other.dtype()));
@@ -117,6 +117,14 @@ ideep::tensor itensor_from_tensor(const Tensor& tensor) {
   }
 }
 
+int mkldnn_get_primitive_cache_capacity() {
+  return dnnl::get_primitive_cache_capacity();
+}
+
+void mkldnn_set_primitive_cache_capacity(int capacity) {
+  dnnl::set_primitive_cache_capacity(capacity);
+}
+
 }}
 
 #endif // AT_MKLDNN_ENABLED()
@@ -24,6 +24,13 @@ TORCH_API ideep::tensor itensor_view_from_dense(const Tensor& tensor);
 // Helper function for getting an ideep tensor out of an aten Tensor or MKL-DNN tensor.
 TORCH_API ideep::tensor itensor_from_tensor(const Tensor& tensor);
 
+// Query / bound the oneDNN primitive cache. Cached primitives are keyed on
+// the full primitive descriptor (op kind, shapes, strides, attributes), so
+// steady-state calls with a previously seen signature skip primitive
+// creation entirely. A capacity of 0 disables the cache.
+TORCH_API int mkldnn_get_primitive_cache_capacity();
+TORCH_API void mkldnn_set_primitive_cache_capacity(int capacity);
+
 }}
 
 #endif // AT_MKLDNN_ENABLED
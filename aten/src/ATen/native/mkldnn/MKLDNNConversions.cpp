@@ -141,6 +141,43 @@ Tensor mkldnn_reorder_conv3d_weight(
   return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()), self.options().device_opt());
 }
 
+// Just like conv weights, inner product (linear) weights have a
+// non-public blocked format that the ideep kernel otherwise reorders
+// into on every call. Packing once ahead of time removes that reorder
+// from the hot path. When the batch size is known it can be passed in
+// so the pack matches the exact primitive that will run; otherwise
+// oneDNN picks its batch-agnostic format.
+Tensor mkldnn_reorder_linear_weight(
+    const Tensor& self,
+    c10::optional<int64_t> batch_size_opt) {
+  if (self.scalar_type() == ScalarType::BFloat16) {
+    TORCH_CHECK(mkldnn_bf16_device_check(),
+        "mkldnn_reorder_linear_weight: bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
+  }
+
+  auto out_features = self.size(0);
+  auto in_features = self.size(1);
+  auto w = itensor_from_mkldnn(self);
+
+  ideep::dims input_size;
+  auto dtype = w.get_data_type();
+  if (batch_size_opt.has_value()) {
+    input_size = {batch_size_opt.value(), in_features};
+  }
+  auto desc =
+      ideep::inner_product_forward::expected_weights_desc(
+          {out_features, in_features},
+          input_size,
+          /* weight dtype */ dtype,
+          /* src dtype */ dtype);
+  ideep::tensor result;
+  result.init(desc);
+  result.feed_from(w);
+
+  return new_with_itensor_mkldnn(std::move(result), optTypeMetaToScalarType(self.options().dtype_opt()),
+                                 self.options().device_opt());
+}
+
 #else
 
 Tensor mkldnn_to_dense(const Tensor& mkldnn_tensor, c10::optional<ScalarType> dtype) {
@@ -169,6 +206,12 @@ Tensor mkldnn_reorder_conv3d_weight(
   TORCH_CHECK(false, "mkldnn_reorder_conv3d_weight: MKL-DNN build is disabled");
 }
 
+Tensor mkldnn_reorder_linear_weight(
+    const Tensor& self,
+    c10::optional<int64_t> batch_size_opt) {
+  TORCH_CHECK(false, "mkldnn_reorder_linear_weight: MKL-DNN build is disabled");
+}
+
 #endif // AT_MKLDNN_ENABLED()
 
 }}
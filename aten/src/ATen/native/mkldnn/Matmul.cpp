@@ -34,6 +34,15 @@ bool use_mkldnn_bf16_matmul(
 namespace at {
 namespace native {
 
+// Note [BF16 reduced precision CPU matmul]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With Context::setAllowBF16MatmulCPU(true) - the CPU analogue of TF32 on
+// cuBLAS - float32 matmuls are also routed here and executed with oneDNN's
+// bf16 fpmath mode: tiles of the inputs are down-converted to bfloat16
+// inside the kernel's packing stage, products are accumulated in float32,
+// and float32 is written out. No separate cast pass over the inputs or the
+// output ever materializes. The mode is opt-in and off by default since
+// the down-conversion drops 16 bits of input mantissa.
 void mkldnn_matmul(
     const Tensor &mat1,
     const Tensor &mat2,
@@ -45,9 +54,14 @@ void mkldnn_matmul(
               (mat1.dim() == 2 && mat2.dim() == 1) || // aten::mv
               (mat1.dim() == 1 && mat2.dim() == 1),  // aten::dot
               "mkldnn_matmul:  unsupported dims for mat and mat2");
-  TORCH_CHECK(mat1.scalar_type() == at::kBFloat16 &&
-   mat2.scalar_type() == at::kBFloat16 &&
-   result.scalar_type() == at::kBFloat16, "mkldnn_matmul:  only enabled for bf16 path");
+  const bool bf16_path = mat1.scalar_type() == at::kBFloat16 &&
+      mat2.scalar_type() == at::kBFloat16 &&
+      result.scalar_type() == at::kBFloat16;
+  const bool reduced_f32_path = mat1.scalar_type() == at::kFloat &&
+      mat2.scalar_type() == at::kFloat &&
+      result.scalar_type() == at::kFloat;
+  TORCH_CHECK(bf16_path || reduced_f32_path,
+    "mkldnn_matmul:  only enabled for bf16 and reduced precision fp32 paths");
   TORCH_CHECK(mkldnn_bf16_device_check(),
     "mkldnn_matmul: mkldnn_matmul bf16 path needs the cpu support avx512bw, avx512vl and avx512dq");
 
@@ -60,6 +74,11 @@ void mkldnn_matmul(
   // but mkldnn matmul primitive only support bias be 1-D tensors
   // to address their differences, we use mkldnn post ops to perform a fused "add" after matrix multiplication is over
   if (beta != 0.0f) op_attr = ideep::attr_t::fuse_sum();
+  if (reduced_f32_path) {
+    // f32 in, f32 out, bf16 tiles with f32 accumulation inside the kernel.
+    // See Note [BF16 reduced precision CPU matmul].
+    op_attr.set_fpmath_mode(dnnl::fpmath_mode::bf16);
+  }
   // If alpha = 0, dose not need actually do gemm computation
   if (alpha == 0)
     return;
@@ -129,11 +148,18 @@ bool use_mkldnn_bf16_matmul(
     const c10::optional<Tensor>& result_opt) {
   c10::MaybeOwned<Tensor> result_maybe_owned = at::borrow_from_optional_tensor(result_opt);
   const Tensor& result = *result_maybe_owned;
+  const bool bf16_path = mat1.scalar_type() == kBFloat16 &&
+      mat2.scalar_type() == kBFloat16 &&
+      (!result.defined() || result.scalar_type() == kBFloat16);
+  // See Note [BF16 reduced precision CPU matmul]: float32 matmuls take this
+  // path too when the global flag is set.
+  const bool reduced_f32_path = at::globalContext().allowBF16MatmulCPU() &&
+      mat1.scalar_type() == kFloat &&
+      mat2.scalar_type() == kFloat &&
+      (!result.defined() || result.scalar_type() == kFloat);
   return (
     at::globalContext().userEnabledMkldnn() &&
-    mat1.scalar_type() == kBFloat16 &&
-    mat2.scalar_type() == kBFloat16 &&
-    (!result.defined() || result.scalar_type() == kBFloat16) &&
+    (bf16_path || reduced_f32_path) &&
     mat1.numel() != 0 &&
     mat2.numel() != 0 &&
     mkldnn_bf16_device_check() &&
@@ -1178,6 +1178,51 @@ void qadd_kernel(Tensor& out, const Tensor& self, const Tensor& other) {
 
   auto iter = TensorIterator::borrowing_binary_op(out, self, other);
 
+  // When both inputs share one scale, the sum can stay in the integer domain:
+  //   s * (a - z_a) + s * (b - z_b) = s * ((a - z_a) + (b - z_b)),
+  // so we widen to int32, add, and requantize with the single fused
+  // multiplier s / out_scale, exactly like qmul_kernel below. This skips both
+  // dequantize passes and the fp32 add of the general path. Elementwise
+  // chains in quantized models commonly propagate one scale through
+  // residual connections, making this the hot case.
+  if (self_scale == other_scale) {
+    float multiplier = self_scale * inv_scale;
+    AT_DISPATCH_QINT_TYPES(out.scalar_type(), "qadd", [&]() {
+      using Vec = Vectorized<scalar_t>;
+      cpu_kernel_vec(
+          iter,
+          [&](scalar_t a, scalar_t b) -> scalar_t {
+            int32_t a_sub_z = static_cast<int32_t>(a.val_) -
+                static_cast<int32_t>(self_zero_point);
+            int32_t b_sub_z = static_cast<int32_t>(b.val_) -
+                static_cast<int32_t>(other_zero_point);
+            int32_t c = a_sub_z + b_sub_z;
+            scalar_t res = at::native::requantize_from_int<scalar_t>(
+                multiplier, zero_point, c);
+            if (ReLUFused) {
+              res.val_ = std::max<scalar_t::underlying>(res.val_, zero_point);
+            }
+            return res;
+          },
+          [&](Vec a, Vec b) -> Vec {
+            Vec::int_vec_return_type a_sub_zp =
+                a.widening_subtract(Vec(static_cast<scalar_t>(self_zero_point)));
+            Vec::int_vec_return_type b_sub_zp =
+                b.widening_subtract(Vec(static_cast<scalar_t>(other_zero_point)));
+            Vec::int_vec_return_type c;
+            for (const auto i : c10::irange(Vec::int_num_vecs())) {
+              c[i] = a_sub_zp[i] + b_sub_zp[i];
+            }
+            Vec rv = Vec::requantize_from_int(c, multiplier, zero_point);
+            if (ReLUFused) {
+              rv = rv.maximum(Vec(static_cast<scalar_t>(zero_point)));
+            }
+            return rv;
+          });
+    });
+    return;
+  }
+
   AT_DISPATCH_QINT_TYPES(out.scalar_type(), "qadd", [&]() {
     using Vec = Vectorized<scalar_t>;
     cpu_kernel_vec(
@@ -2795,14 +2840,29 @@ void quantize_tensor_per_tensor_affine_cpu(
             rdata, qtensor, rtensor.numel(), scale, zero_point);
       });
 #else
-  // Fallback path
+  // Fallback path. This kernel is compiled once per CPU capability tier, so
+  // going through Vectorized<scalar_t>::quantize picks up the full-width
+  // AVX512 (or AVX2) implementation instead of a scalar loop.
   AT_DISPATCH_QINT_TYPES(
       qtensor.scalar_type(), "quantize_tensor_per_tensor_affine_cpu", [&]() {
         check_tensor_memory_format(rtensor, qtensor);
         const float* const rdata = rtensor.data_ptr<float>();
         auto qdata = qtensor.data_ptr<scalar_t>();
         auto numel = rtensor.numel();
-        for (const auto i : c10::irange(numel)) {
+        using Vec = Vectorized<scalar_t>;
+        using fVec = Vectorized<float>;
+        float float_scale = static_cast<float>(scale);
+        float inv_scale = 1.0f / float_scale;
+        int64_t i = 0;
+        for (; i + Vec::size() <= numel; i += Vec::size()) {
+          typename Vec::float_vec_return_type float_vals;
+          for (const auto j : c10::irange(Vec::float_num_vecs())) {
+            float_vals[j] = fVec::loadu(rdata + i + j * fVec::size());
+          }
+          Vec::quantize(float_vals, float_scale, zero_point, inv_scale)
+              .store(qdata + i);
+        }
+        for (; i < numel; ++i) {
           qdata[i] = quantize_val<scalar_t>(scale, zero_point, rdata[i]);
         }
       });
@@ -2820,7 +2880,22 @@ void dequantize_tensor_per_tensor_affine_cpu(
         const auto* qd = qtensor.data_ptr<scalar_t>();
         float* rd = rtensor.data_ptr<float>();
         auto numel = qtensor.numel();
-        for (const auto i : c10::irange(numel)) {
+        // See the quantize fallback above: Vectorized<scalar_t>::dequantize
+        // is full-width for the capability tier this kernel is built for.
+        using Vec = Vectorized<scalar_t>;
+        using fVec = Vectorized<float>;
+        fVec scale_vec(static_cast<float>(scale));
+        fVec zero_point_vec(static_cast<float>(zero_point));
+        fVec scale_neg_zp_premul_vec = scale_vec * zero_point_vec.neg();
+        int64_t i = 0;
+        for (; i + Vec::size() <= numel; i += Vec::size()) {
+          const auto vals = Vec::loadu(qd + i).dequantize(
+              scale_vec, zero_point_vec, scale_neg_zp_premul_vec);
+          for (const auto j : c10::irange(Vec::float_num_vecs())) {
+            vals[j].store(rd + i + j * fVec::size());
+          }
+        }
+        for (; i < numel; ++i) {
           rd[i] = dequantize_val<scalar_t>(scale, zero_point, qd[i]);
         }
       });
@@ -2828,7 +2903,9 @@ void dequantize_tensor_per_tensor_affine_cpu(
 #endif // USE_FBGEMM
 
 // TODO: add fbgemm for per channel
-// Generic template defaults to naive quantize implementation
+// Generic template: like the per-tensor fallback above, this file is
+// compiled once per CPU capability tier, so the Vectorized operations
+// below are full-width for the tier being built.
 template <typename T>
 void quantize_tensor_per_channel_impl(
     const Tensor& rtensor,
@@ -2850,6 +2927,17 @@ void quantize_tensor_per_channel_impl(
   auto zero_points_data = zero_points.data_ptr<int64_t>();
   const float* in = rtensor.data_ptr<float>();
   auto out = qtensor.data_ptr<T>();
+  using Vec = Vectorized<T>;
+  using fVec = Vectorized<float>;
+  // Broadcast the double scales and int64 zero points through float lanes,
+  // and precompute inverse scales so the inner loops multiply instead of
+  // divide (same trade-off as the NEON kernels below and Vec::quantize).
+  std::vector<float> inv_scales(channels);
+  std::vector<float> zero_points_float(channels);
+  for (const auto i : c10::irange(channels)) {
+    inv_scales[i] = 1.0f / static_cast<float>(scales_data[i]);
+    zero_points_float[i] = static_cast<float>(zero_points_data[i]);
+  }
   if (axis == 1 &&
       (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
        rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
@@ -2857,23 +2945,66 @@ void quantize_tensor_per_channel_impl(
     // channels_last contig.
     // If axis = 0 and channels_last contig, implementation for channels
     // first (NCHW) works.
+    // Scale and zero point vary per lane here, so quantize a float vector
+    // of channels at a time and narrow through a small buffer. The clamp is
+    // done in float, which is only exact for the 8-bit range; qint32 keeps
+    // the scalar loop.
+    const fVec min_vec(static_cast<float>(
+        std::numeric_limits<typename T::underlying>::min()));
+    const fVec max_vec(static_cast<float>(
+        std::numeric_limits<typename T::underlying>::max()));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    float qvals[fVec::size()];
     for (const auto b : c10::irange(batches)) {
       for (const auto e : c10::irange(elements_per_channel)) {
-        for (const auto c : c10::irange(channels)) {
-          auto i = b * channels * elements_per_channel + e * channels + c;
-          out[i] = at::native::quantize_val<T>(
-              scales_data[c], zero_points_data[c], in[i]);
+        const float* in_ptr =
+            in + (b * elements_per_channel + e) * channels;
+        T* out_ptr = out + (b * elements_per_channel + e) * channels;
+        int64_t c = 0;
+        if (sizeof(typename T::underlying) == 1) {
+          for (; c + static_cast<int64_t>(fVec::size()) <= channels;
+               c += fVec::size()) {
+            fVec q = fVec::loadu(in_ptr + c) *
+                fVec::loadu(inv_scales.data() + c);
+            q = q.round() + fVec::loadu(zero_points_float.data() + c);
+            q = vec::minimum(vec::maximum(q, min_vec), max_vec);
+            q.store(qvals);
+            for (const auto j : c10::irange(static_cast<int>(fVec::size()))) {
+              out_ptr[c + j] =
+                  T(static_cast<typename T::underlying>(qvals[j]));
+            }
+          }
+        }
+        for (; c < channels; ++c) {
+          out_ptr[c] = at::native::quantize_val<T>(
+              scales_data[c], zero_points_data[c], in_ptr[c]);
         }
       }
     }
   } else {
+    // Scale and zero point are constant along the innermost loop, so the
+    // full-width Vec::quantize path applies as in the per-tensor fallback.
     for (const auto b : c10::irange(batches)) {
       for (const auto c : c10::irange(channels)) {
-        for (const auto e : c10::irange(elements_per_channel)) {
-          auto i = b * channels * elements_per_channel +
-              c * elements_per_channel + e;
-          out[i] = at::native::quantize_val<T>(
-              scales_data[c], zero_points_data[c], in[i]);
+        const float scale = static_cast<float>(scales_data[c]);
+        const float inv_scale = inv_scales[c];
+        const int32_t zero_point = static_cast<int32_t>(zero_points_data[c]);
+        const float* in_ptr =
+            in + (b * channels + c) * elements_per_channel;
+        T* out_ptr = out + (b * channels + c) * elements_per_channel;
+        int64_t e = 0;
+        for (; e + static_cast<int64_t>(Vec::size()) <= elements_per_channel;
+             e += Vec::size()) {
+          typename Vec::float_vec_return_type float_vals;
+          for (const auto j : c10::irange(Vec::float_num_vecs())) {
+            float_vals[j] = fVec::loadu(in_ptr + e + j * fVec::size());
+          }
+          Vec::quantize(float_vals, scale, zero_point, inv_scale)
+              .store(out_ptr + e);
+        }
+        for (; e < elements_per_channel; ++e) {
+          out_ptr[e] = at::native::quantize_val<T>(
+              scales_data[c], zero_points_data[c], in_ptr[e]);
         }
       }
     }
@@ -3159,15 +3290,75 @@ void dequantize_per_channel_affine_kernel(
   }
 }
 
+// Vectorized counterpart of dequantize_per_channel_affine_kernel for the
+// 8-bit channel-contiguous layouts: scale and zero point are constant along
+// the innermost loop, so Vec::dequantize applies with broadcast qparams as
+// in the per-tensor path. The channels_last (axis == 1) layout would need a
+// narrow quantized load with per-lane qparams, which Vectorized does not
+// provide, so that case stays on the scalar kernel.
+template <typename Q>
+void dequantize_per_channel_contig_vec_kernel(
+    const Tensor& qtensor,
+    Tensor& rtensor,
+    const Tensor& scales,
+    const Tensor& zero_points,
+    int64_t axis) {
+  int64_t batches = size_to_dim_(axis, rtensor.sizes());
+  int64_t elements_per_channel =
+      // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+      size_from_dim_(axis + 1, rtensor.sizes());
+  int64_t channel = rtensor.size(axis);
+  auto scales_data = scales.data_ptr<double>();
+  auto zero_points_data = zero_points.data_ptr<int64_t>();
+  check_tensor_memory_format(qtensor, rtensor);
+  const auto* qd = qtensor.data_ptr<Q>();
+  float* rd = rtensor.data_ptr<float>();
+  using Vec = Vectorized<Q>;
+  using fVec = Vectorized<float>;
+  for (const auto b : c10::irange(batches)) {
+    for (const auto c : c10::irange(channel)) {
+      const fVec scale_vec(static_cast<float>(scales_data[c]));
+      const fVec zero_point_vec(static_cast<float>(zero_points_data[c]));
+      const fVec scale_neg_zp_premul_vec = scale_vec * zero_point_vec.neg();
+      const Q* q_ptr = qd + (b * channel + c) * elements_per_channel;
+      float* r_ptr = rd + (b * channel + c) * elements_per_channel;
+      int64_t e = 0;
+      for (; e + static_cast<int64_t>(Vec::size()) <= elements_per_channel;
+           e += Vec::size()) {
+        const auto vals = Vec::loadu(q_ptr + e).dequantize(
+            scale_vec, zero_point_vec, scale_neg_zp_premul_vec);
+        for (const auto j : c10::irange(Vec::float_num_vecs())) {
+          vals[j].store(r_ptr + e + j * fVec::size());
+        }
+      }
+      for (; e < elements_per_channel; ++e) {
+        // Same expression as the scalar kernel: convert to float first so
+        // the subtraction subexpression returns a float
+        r_ptr[e] = (static_cast<float>(q_ptr[e].val_) - zero_points_data[c]) *
+            scales_data[c];
+      }
+    }
+  }
+}
+
 void dequantize_tensor_per_channel_affine_cpu(
     const Tensor& qtensor,
     Tensor& rtensor,
     const Tensor& scales,
     const Tensor& zero_points,
     int64_t axis) {
+  TORCH_CHECK(rtensor.is_contiguous() || (axis <=1),
+      "If tensor is channels_last contig then per channel quantization "
+      "is supported only for axis = 0 or 1.");
   AT_DISPATCH_QINT_TYPES(
       qtensor.scalar_type(), "dequantize_tensor_per_channel_affine_cpu", [&]() {
-        dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(qtensor, rtensor, scales, zero_points, axis);
+        if (axis == 1 &&
+            (rtensor.is_contiguous(MemoryFormat::ChannelsLast) ||
+             rtensor.is_contiguous(MemoryFormat::ChannelsLast3d))) {
+          dequantize_per_channel_affine_kernel<double, int64_t, scalar_t>(qtensor, rtensor, scales, zero_points, axis);
+        } else {
+          dequantize_per_channel_contig_vec_kernel<scalar_t>(qtensor, rtensor, scales, zero_points, axis);
+        }
       });
 }
 
@@ -12,6 +12,11 @@
 #include <c10/util/irange.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 torch::class_<LinearPackedParamsBase> register_linear_params();
@@ -41,6 +46,140 @@ void calc_col_offsets_transpose(
     }
   }
 }
+
+// Note [Prepacked weight sharing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Serving deployments commonly load the same quantized model once per worker
+// thread within a single process, and each load prepacks its own copy of
+// identical weights. When TORCH_SHARE_QUANTIZED_PREPACKED_WEIGHTS=1 is set,
+// linear_prepack (fbgemm) consults a process-wide content-addressed cache
+// keyed by the weight bytes, quantization parameters and bias, so all loads
+// of the same weights share one PackedLinearWeight. The cache holds weak
+// references: entries die together with the last module using them, and
+// expired entries are pruned on the next lookup of the same hash bucket.
+// Sharing is sound for the fbgemm int8 path because PackedLinearWeight is
+// immutable after prepack. The qnnpack path packs lazily per input scale and
+// PackedLinearWeightFp16 supports set_bias(), so those are never shared.
+bool sharePrepackedWeightsEnabled() {
+  static const bool enabled = []() {
+    const auto* env = std::getenv("TORCH_SHARE_QUANTIZED_PREPACKED_WEIGHTS");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+  // FNV-1a; collisions are tolerable because lookup falls back to a full
+  // content comparison.
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  uint64_t h = seed ^ 0xcbf29ce484222325ULL;
+  for (const auto i : c10::irange(size)) {
+    h = (h ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+class PrepackedLinearWeightCache {
+ public:
+  static PrepackedLinearWeightCache& instance() {
+    static PrepackedLinearWeightCache cache;
+    return cache;
+  }
+
+  // `weight` must be a contiguous per-tensor or per-channel qint8 tensor.
+  c10::intrusive_ptr<LinearPackedParamsBase> lookup(
+      const at::Tensor& weight,
+      const c10::optional<at::Tensor>& bias) {
+    auto hash = content_hash(weight);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      auto packed = it->second.packed.lock();
+      if (!packed) {
+        it = entries_.erase(it);
+        continue;
+      }
+      if (matches(it->second, weight, bias)) {
+        return packed;
+      }
+      ++it;
+    }
+    return nullptr;
+  }
+
+  void insert(
+      at::Tensor weight,
+      c10::optional<at::Tensor> bias,
+      const c10::intrusive_ptr<LinearPackedParamsBase>& packed) {
+    auto hash = content_hash(weight);
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.emplace(
+        hash,
+        Entry{std::move(weight),
+              std::move(bias),
+              c10::weak_intrusive_ptr<LinearPackedParamsBase>(packed)});
+  }
+
+ private:
+  struct Entry {
+    at::Tensor weight;
+    c10::optional<at::Tensor> bias;
+    c10::weak_intrusive_ptr<LinearPackedParamsBase> packed;
+  };
+
+  static uint64_t content_hash(const at::Tensor& weight) {
+    uint64_t hash = hash_bytes(
+        weight.data_ptr(), weight.numel() * weight.element_size(), 0);
+    if (weight.qscheme() == c10::kPerTensorAffine) {
+      double scale = weight.q_scale();
+      int64_t zero_point = weight.q_zero_point();
+      hash = hash_bytes(&scale, sizeof(scale), hash);
+      hash = hash_bytes(&zero_point, sizeof(zero_point), hash);
+    }
+    return hash;
+  }
+
+  static bool matches(
+      const Entry& entry,
+      const at::Tensor& weight,
+      const c10::optional<at::Tensor>& bias) {
+    if (entry.weight.sizes() != weight.sizes() ||
+        entry.weight.qscheme() != weight.qscheme()) {
+      return false;
+    }
+    if (weight.qscheme() == c10::kPerTensorAffine) {
+      if (entry.weight.q_scale() != weight.q_scale() ||
+          entry.weight.q_zero_point() != weight.q_zero_point()) {
+        return false;
+      }
+    } else {
+      if (!at::equal(
+              entry.weight.q_per_channel_scales(),
+              weight.q_per_channel_scales()) ||
+          !at::equal(
+              entry.weight.q_per_channel_zero_points(),
+              weight.q_per_channel_zero_points())) {
+        return false;
+      }
+    }
+    if (std::memcmp(
+            entry.weight.data_ptr(),
+            weight.data_ptr(),
+            weight.numel() * weight.element_size()) != 0) {
+      return false;
+    }
+    if (entry.bias.has_value() != bias.has_value()) {
+      return false;
+    }
+    return !bias.has_value() ||
+        (entry.bias->sizes() == bias->sizes() &&
+         entry.bias->scalar_type() == bias->scalar_type() &&
+         at::equal(*entry.bias, *bias));
+  }
+
+  std::mutex mutex_;
+  std::unordered_multimap<uint64_t, Entry> entries_;
+};
 } // namespace
 
 c10::intrusive_ptr<LinearPackedParamsBase> PackedLinearWeight::prepack(
@@ -57,6 +196,17 @@ c10::intrusive_ptr<LinearPackedParamsBase> PackedLinearWeight::prepack(
   // TODO: contiguous is called for further JIT optimizations.
   auto weight_contig = weight.contiguous();
   const auto qtype = weight.qscheme();
+
+  // See Note [Prepacked weight sharing]
+  const bool use_prepack_cache = sharePrepackedWeightsEnabled() &&
+      (qtype == c10::kPerTensorAffine || qtype == c10::kPerChannelAffine);
+  if (use_prepack_cache) {
+    if (auto cached =
+            PrepackedLinearWeightCache::instance().lookup(weight_contig, bias)) {
+      return cached;
+    }
+  }
+
   std::vector<int32_t> weight_zero_points_int32(1, 0);
   if (qtype == c10::kPerTensorAffine) {
     weight_zero_points_int32[0] = weight.q_zero_point();
@@ -112,6 +262,10 @@ c10::intrusive_ptr<LinearPackedParamsBase> PackedLinearWeight::prepack(
       weight_scales_float,
       weight_zero_points_int32,
       qtype);
+  if (use_prepack_cache) {
+    PrepackedLinearWeightCache::instance().insert(
+        std::move(weight_contig), std::move(bias_contig), ret_ptr);
+  }
   return ret_ptr;
 }
 #endif // USE_FBGEMM
@@ -7,6 +7,7 @@
 #include <ATen/SparseCsrTensorUtils.h>
 #include <ATen/SparseTensorUtils.h>
 #include <ATen/WrapDimUtilsMulti.h>
+#include <ATen/cpu/vec/vec.h>
 #include <ATen/native/BinaryOps.h>
 #include <ATen/native/CPUBlas.h>
 #include <ATen/native/Resize.h>
@@ -99,7 +100,7 @@ void s_addmm_out_sparse_dense_worker(int64_t nnz, int64_t dim_i, int64_t dim_j,
     at::mul_out(r, t, scalar_to_tensor(beta));
   }
   AT_DISPATCH_INDEX_TYPES(col_indices.scalar_type(), "csr_mm_crow_indices", [&]() {
-    auto csr_accessor = csr.accessor<index_t, 1>();
+    const index_t* crow = csr.data_ptr<index_t>();
     auto col_indices_accessor = col_indices.accessor<index_t, 1>();
 
     auto values_accessor = values.accessor<scalar_t, 1>();
@@ -111,23 +112,66 @@ void s_addmm_out_sparse_dense_worker(int64_t nnz, int64_t dim_i, int64_t dim_j,
     int64_t r_stride0 = r.stride(0);
     int64_t r_stride1 = r.stride(1);
 
-    at::parallel_for(
-        0,
-        dim_i,
-        internal::GRAIN_SIZE,
-        [&](int64_t irow_start, int64_t irow_end) {
-            for (index_t h = irow_start; h < irow_end; ++h) {
-              index_t i_start = csr_accessor[h];
-              index_t i_end = csr_accessor[h+1];
-              for (index_t i = i_start; i < i_end; i++) {
-                scalar_t val = values_accessor[i];
-                index_t col = col_indices_accessor[i];
-                at::native::cpublas::axpy<scalar_t>(dim_k,
-                    cast_alpha * val,
-                    dense_ptr + col * dense_stride0, dense_stride1,
-                    r_ptr + h * r_stride0, r_stride1);
+    // Rows are distributed so that every task owns roughly the same number
+    // of non-zeros rather than the same number of rows; matrices with
+    // skewed row lengths (graph adjacency in particular) otherwise leave
+    // most threads idle behind the one that drew the heavy rows. A row
+    // belongs to the task owning its first non-zero, and the task
+    // boundaries are found by binary search in crow_indices, which is
+    // cheap enough to redo on every call.
+    int64_t num_parts =
+        std::max<int64_t>(std::min<int64_t>(at::get_num_threads(), nnz), 1);
+    at::parallel_for(0, num_parts, 1, [&](int64_t part_begin, int64_t part_end) {
+      for (int64_t p = part_begin; p < part_end; ++p) {
+        const auto nnz_begin = static_cast<index_t>(nnz * p / num_parts);
+        const auto nnz_end = static_cast<index_t>(nnz * (p + 1) / num_parts);
+        const int64_t row_begin =
+            std::lower_bound(crow, crow + dim_i, nnz_begin) - crow;
+        const int64_t row_end =
+            std::lower_bound(crow, crow + dim_i, nnz_end) - crow;
+        if (dense_stride1 == 1 && r_stride1 == 1) {
+          // Contiguous rows: accumulate with explicit vector FMAs. The
+          // dense column dimension is processed in blocks small enough
+          // that the output row segment under accumulation stays
+          // cache-resident across all of a row's non-zeros.
+          using Vec = at::vec::Vectorized<scalar_t>;
+          constexpr int64_t kColBlockSize = 256;
+          for (int64_t k_begin = 0; k_begin < dim_k;
+               k_begin += kColBlockSize) {
+            const int64_t block = std::min(kColBlockSize, dim_k - k_begin);
+            for (int64_t h = row_begin; h < row_end; ++h) {
+              scalar_t* r_row = r_ptr + h * r_stride0 + k_begin;
+              for (index_t i = crow[h]; i < crow[h + 1]; i++) {
+                const Vec val_vec(cast_alpha * values_accessor[i]);
+                const scalar_t* dense_row = dense_ptr +
+                    col_indices_accessor[i] * dense_stride0 + k_begin;
+                int64_t d = 0;
+                for (; d + Vec::size() <= block; d += Vec::size()) {
+                  auto out_vec = at::vec::fmadd(
+                      Vec::loadu(dense_row + d),
+                      val_vec,
+                      Vec::loadu(r_row + d));
+                  out_vec.store(r_row + d);
+                }
+                for (; d < block; ++d) {
+                  r_row[d] += cast_alpha * values_accessor[i] * dense_row[d];
+                }
               }
             }
+          }
+        } else {
+          for (int64_t h = row_begin; h < row_end; ++h) {
+            for (index_t i = crow[h]; i < crow[h + 1]; i++) {
+              scalar_t val = values_accessor[i];
+              index_t col = col_indices_accessor[i];
+              at::native::cpublas::axpy<scalar_t>(dim_k,
+                  cast_alpha * val,
+                  dense_ptr + col * dense_stride0, dense_stride1,
+                  r_ptr + h * r_stride0, r_stride1);
+            }
+          }
+        }
+      }
     });
   });
 }
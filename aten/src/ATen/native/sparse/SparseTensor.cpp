@@ -13,6 +13,8 @@
 #include <ATen/native/Copy.h>
 #include <ATen/native/CPUBlas.h>
 
+#include <atomic>
+
 namespace at {
 namespace native {
 
@@ -570,6 +572,32 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
 
   Tensor indices_scalar = flatten_indices(indices, self.sizes());
 
+  // Embedding-style gradients frequently arrive with their indices already in
+  // sorted order. Detecting this costs a single parallel scan and lets us skip
+  // the sort below; if the indices are additionally unique, the tensor already
+  // satisfies the coalesce invariant and a copy can be returned directly.
+  const int64_t* indices_scalar_ptr = indices_scalar.data_ptr<int64_t>();
+  std::atomic<bool> sorted{true};
+  std::atomic<bool> unique{true};
+  at::parallel_for(
+      0, nnz - 1, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        for (int64_t j = begin; j < end; j++) {
+          if (indices_scalar_ptr[j] > indices_scalar_ptr[j + 1]) {
+            sorted.store(false, std::memory_order_relaxed);
+            return;
+          }
+          if (indices_scalar_ptr[j] == indices_scalar_ptr[j + 1]) {
+            unique.store(false, std::memory_order_relaxed);
+          }
+        }
+      });
+  const bool already_sorted = sorted.load();
+  if (already_sorted && unique.load()) {
+    SparseTensor dst = self.clone();
+    dst._coalesced_(true);
+    return dst;
+  }
+
   SparseTensor dst = new_sparse(
       optTypeMetaToScalarType(self.options().dtype_opt()),
       self.options().layout_opt(),
@@ -583,12 +611,19 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
 
   Tensor indicesBuffer;
   Tensor indicesPermutation;
-  std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
+  if (already_sorted) {
+    // Skip the sort entirely; the fused duplicate accumulation below walks
+    // the input in its original (sorted) order.
+    indicesBuffer = indices_scalar;
+  } else {
+    std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
+  }
   // NB: The accessor accesses here rely on self._nnz() > 0 (tested earlier in
   // this function)
   auto newIndicesAccessor = newIndices.accessor<int64_t, 2>();
   auto indicesAccessor = indices.accessor<int64_t, 2>();
-  auto indicesPermutationAccessor = indicesPermutation.accessor<int64_t, 1>();
+  const int64_t* indicesPermutationPtr =
+      already_sorted ? nullptr : indicesPermutation.data_ptr<int64_t>();
   auto indicesBufferAccessor = indicesBuffer.accessor<int64_t, 1>();
 
   int64_t i = -1;
@@ -598,7 +633,7 @@ SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
     scalar_t* values_ptr = values.data_ptr<scalar_t>();
     scalar_t* newValues_ptr = newValues.data_ptr<scalar_t>();
     for (int64_t j = 0; j < nnz; j++) {
-      int64_t pos = indicesPermutationAccessor[j];
+      int64_t pos = already_sorted ? j : indicesPermutationPtr[j];
       int64_t curr = indicesBufferAccessor[j];
       if (curr == prev) {
         if (values.numel() >
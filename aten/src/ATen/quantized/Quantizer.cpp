@@ -247,8 +247,8 @@ Tensor from_blob_quantized_per_tensor_affine(
   }
   const std::size_t datasize = size * itemsize;
 
-  DataPtr data_ptr = InefficientStdFunctionContext::makeDataPtr(
-      data, deleter, options.device());
+  DataPtr data_ptr = PooledStdFunctionContext::makeDataPtr(
+      data, std::move(deleter), options.device());
 
   Storage storage{Storage::use_byte_size_t{}, datasize, std::move(data_ptr)};
 
@@ -294,8 +294,8 @@ Tensor from_blob_quantized_per_channel_affine(
   }
   const std::size_t datasize = size * itemsize;
 
-  DataPtr data_ptr = InefficientStdFunctionContext::makeDataPtr(
-      data, deleter, options.device());
+  DataPtr data_ptr = PooledStdFunctionContext::makeDataPtr(
+      data, std::move(deleter), options.device());
 
   Storage storage{Storage::use_byte_size_t{}, datasize, std::move(data_ptr)};
 
@@ -72,6 +72,38 @@ double sample_zero_one() {
   return coinflip_tls().distZeroOne_(coinflip_tls().genZeroOne_);
 }
 
+// Note [Scope bitsets for RecordFunction]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Every op invocation constructs a RecordFunction, and previously decided
+// whether any observer cares by walking the thread-local and global callback
+// lists, checking enabled state and scope membership per entry. That scan is
+// pure overhead in the common case where callbacks exist but none accept the
+// current scope. Instead, each list's interest is folded into a 64-bit scope
+// bitset at registration/toggle time (all of which are cold paths), so the
+// hot path reduces to one relaxed load and a single predicted-not-taken
+// branch on the scope bit. The thread-local mask lives in RecordFunctionTLS
+// and travels with it across thread boundaries. Callbacks declare interest
+// only per RecordScope; there is no per-OperatorName registration in this
+// API, so operator-level filtering remains inside the callback bodies.
+template <typename RecordFunctionCallbacks>
+uint64_t computeScopeMask(const RecordFunctionCallbacks& cbs) {
+  static_assert(
+      static_cast<size_t>(RecordScope::NUM_SCOPES) <= 64,
+      "RecordScope must fit into a 64-bit mask");
+  uint64_t mask = 0;
+  for (const auto& cb : cbs) {
+    if (!cb.isEnabled()) {
+      continue;
+    }
+    for (size_t s = 0; s < static_cast<size_t>(RecordScope::NUM_SCOPES); ++s) {
+      if (cb.callback.checkScope(static_cast<RecordScope>(s))) {
+        mask |= uint64_t(1) << s;
+      }
+    }
+  }
+  return mask;
+}
+
 } // namespace
 
 const RecordFunctionTLS& get_record_function_tls_() {
@@ -149,6 +181,7 @@ class CallbackManager {
     // sorted_tls_callbacks_ sorted
     auto handle = next_unique_callback_handle();
     rf_tls().sorted_tls_callbacks_.emplace_back(std::move(cb), handle);
+    updateTLSScopeMask();
     return handle;
   }
 
@@ -161,6 +194,7 @@ class CallbackManager {
     // NOLINTNEXTLINE(performance-move-const-arg)
     sorted_global_callbacks_.emplace_back(std::move(cb), handle);
     num_enabled_global_callbacks_.fetch_add(1, std::memory_order_relaxed);
+    updateGlobalScopeMask();
     return handle;
   }
 
@@ -177,18 +211,25 @@ class CallbackManager {
     if (!found) {
       LOG(WARNING) << "Requested callback is not found";
     }
+    updateTLSScopeMask();
+    updateGlobalScopeMask();
   }
 
   void disableCallback(CallbackHandle handle) {
     auto found = findAndToggleCallback(
         rf_tls().sorted_tls_callbacks_, handle, false);
-    if (found == ToggledCallbackResult::NotFound) {
+    if (found != ToggledCallbackResult::NotFound) {
+      updateTLSScopeMask();
+    } else {
       found = findAndToggleCallback(
           sorted_global_callbacks_, handle, false);
       if (found == ToggledCallbackResult::FoundAndToggled) {
         const auto previousCount = num_enabled_global_callbacks_.fetch_sub(1, std::memory_order_relaxed);
         TORCH_CHECK(previousCount > 0, previousCount);
       }
+      if (found != ToggledCallbackResult::NotFound) {
+        updateGlobalScopeMask();
+      }
     }
     if (found == ToggledCallbackResult::NotFound) {
       LOG(WARNING) << "Requested callback is not found";
@@ -198,12 +239,17 @@ class CallbackManager {
   void reenableCallback(CallbackHandle handle) {
     auto found = findAndToggleCallback(
         rf_tls().sorted_tls_callbacks_, handle, true);
-    if (found == ToggledCallbackResult::NotFound) {
+    if (found != ToggledCallbackResult::NotFound) {
+      updateTLSScopeMask();
+    } else {
       found = findAndToggleCallback(
           sorted_global_callbacks_, handle, true);
       if (found == ToggledCallbackResult::FoundAndToggled) {
         num_enabled_global_callbacks_.fetch_add(1, std::memory_order_relaxed);
       }
+      if (found != ToggledCallbackResult::NotFound) {
+        updateGlobalScopeMask();
+      }
     }
     if (found == ToggledCallbackResult::NotFound) {
       LOG(WARNING) << "Requested callback is not found";
@@ -213,10 +259,12 @@ class CallbackManager {
   void clearGlobalCallbacks() {
     sorted_global_callbacks_.clear();
     num_enabled_global_callbacks_ = 0;
+    updateGlobalScopeMask();
   }
 
   void clearThreadLocalCallbacks() {
     rf_tls().sorted_tls_callbacks_.clear();
+    updateTLSScopeMask();
   }
 
   inline bool hasGlobalCallbacks() const {
@@ -282,39 +330,47 @@ class CallbackManager {
     bool found_needs_outputs = false;
     bool found_needs_ids = false;
 
-    for (const auto& cb: rf_tls().sorted_tls_callbacks_) {
-      if (cb.isEnabled() && callbackShouldRun(cb.callback, scope, pre_sampled)) {
-        if (cb.callback.needsInputs()) {
-          found_needs_inputs = true;
+    // See Note [Scope bitsets for RecordFunction]: skip whole lists whose
+    // mask does not cover this scope.
+    const uint64_t scope_bit = uint64_t(1) << static_cast<size_t>(scope);
+    auto& tls = rf_tls();
+    if (tls.tls_scope_mask_ & scope_bit) {
+      for (const auto& cb: tls.sorted_tls_callbacks_) {
+        if (cb.isEnabled() && callbackShouldRun(cb.callback, scope, pre_sampled)) {
+          if (cb.callback.needsInputs()) {
+            found_needs_inputs = true;
+          }
+          if (cb.callback.needsOutputs()) {
+            found_needs_outputs = true;
+          }
+          if (cb.callback.needsIds()) {
+            found_needs_ids = true;
+          }
+          if (!rec_fn.state_) {
+            rec_fn.state_ = std::make_unique<RecordFunction::State>(scope);
+          }
+          rec_fn.state_->sorted_active_tls_handles_.push_back(cb.handle);
         }
-        if (cb.callback.needsOutputs()) {
-          found_needs_outputs = true;
-        }
-        if (cb.callback.needsIds()) {
-          found_needs_ids = true;
-        }
-        if (!rec_fn.state_) {
-          rec_fn.state_ = std::make_unique<RecordFunction::State>(scope);
-        }
-        rec_fn.state_->sorted_active_tls_handles_.push_back(cb.handle);
       }
     }
 
-    for (const auto& cb: sorted_global_callbacks_) {
-      if (cb.isEnabled() && callbackShouldRun(cb.callback, scope, pre_sampled)) {
-        if (cb.callback.needsInputs()) {
-          found_needs_inputs = true;
-        }
-        if (cb.callback.needsOutputs()) {
-          found_needs_outputs = true;
-        }
-        if (cb.callback.needsIds()) {
-          found_needs_ids = true;
+    if (global_scope_mask_.load(std::memory_order_relaxed) & scope_bit) {
+      for (const auto& cb: sorted_global_callbacks_) {
+        if (cb.isEnabled() && callbackShouldRun(cb.callback, scope, pre_sampled)) {
+          if (cb.callback.needsInputs()) {
+            found_needs_inputs = true;
+          }
+          if (cb.callback.needsOutputs()) {
+            found_needs_outputs = true;
+          }
+          if (cb.callback.needsIds()) {
+            found_needs_ids = true;
+          }
+          if (!rec_fn.state_) {
+            rec_fn.state_ = std::make_unique<RecordFunction::State>(scope);
+          }
+          rec_fn.state_->sorted_active_global_handles_.push_back(cb.handle);
         }
-        if (!rec_fn.state_) {
-          rec_fn.state_ = std::make_unique<RecordFunction::State>(scope);
-        }
-        rec_fn.state_->sorted_active_global_handles_.push_back(cb.handle);
       }
     }
 
@@ -367,6 +423,18 @@ class CallbackManager {
   // Global callbacks; must be sorted in increasing handle order
   GlobalRecordFunctionCallbacks sorted_global_callbacks_;
   std::atomic<uint_fast32_t> num_enabled_global_callbacks_;
+  // See Note [Scope bitsets for RecordFunction]
+  std::atomic<uint64_t> global_scope_mask_{0};
+
+  void updateGlobalScopeMask() {
+    global_scope_mask_.store(
+        computeScopeMask(sorted_global_callbacks_), std::memory_order_relaxed);
+  }
+
+  static void updateTLSScopeMask() {
+    auto& tls = rf_tls();
+    tls.tls_scope_mask_ = computeScopeMask(tls.sorted_tls_callbacks_);
+  }
 
  private:
   bool tryRunCallback(
@@ -498,7 +566,10 @@ RecordFunction::RecordFunction(RecordScope scope, bool pre_sampled) {
   auto* rf_tls_ptr = &rf_tls();
   if (rf_tls_ptr->tls_record_function_enabled_) {
     auto& m = manager();
-    if (!m.sorted_global_callbacks_.empty() || !rf_tls_ptr->sorted_tls_callbacks_.empty()) {
+    // See Note [Scope bitsets for RecordFunction]
+    const uint64_t scope_bit = uint64_t(1) << static_cast<size_t>(scope);
+    if ((m.global_scope_mask_.load(std::memory_order_relaxed) |
+         rf_tls_ptr->tls_scope_mask_) & scope_bit) {
       m.init(*this, scope, pre_sampled);
     }
   }
@@ -609,7 +680,11 @@ bool checkRecordAllFunctions() {
 
 bool shouldRunRecordFunction(bool* pre_sampled) {
   auto* rf_tls_ptr = &rf_tls();
-  if (rf_tls_ptr->sorted_tls_callbacks_.empty() && !manager().hasGlobalCallbacks()) {
+  // See Note [Scope bitsets for RecordFunction]: a zero combined mask means
+  // no enabled callback accepts any scope, which also covers the previous
+  // "no callbacks registered" check.
+  if ((manager().global_scope_mask_.load(std::memory_order_relaxed) |
+       rf_tls_ptr->tls_scope_mask_) == 0) {
     *pre_sampled = false;
     return false;
   }
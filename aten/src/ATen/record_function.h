@@ -734,6 +734,12 @@ struct TORCH_API RecordFunctionTLS {
 
   // Stores the number of coin flips before the next successful coin flip
   int tries_left_ = 0;
+
+  // Bit i is set iff some enabled entry of sorted_tls_callbacks_ accepts
+  // RecordScope(i); derived from the list by CallbackManager on every
+  // mutation so the RecordFunction hot path tests a single word instead of
+  // scanning the list. See Note [Scope bitsets for RecordFunction].
+  uint64_t tls_scope_mask_ = 0;
 };
 
 TORCH_API const RecordFunctionTLS& get_record_function_tls_();
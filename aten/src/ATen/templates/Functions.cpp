@@ -69,7 +69,7 @@ Tensor TensorMaker::make_tensor() {
  }
 
  inline DataPtr TensorMaker::makeDataPtrFromDeleter() const {
-   return InefficientStdFunctionContext::makeDataPtr(data_, deleter_, *device_);
+   return PooledStdFunctionContext::makeDataPtr(data_, deleter_, *device_);
  }
 
  inline DataPtr TensorMaker::makeDataPtrFromContext() noexcept {
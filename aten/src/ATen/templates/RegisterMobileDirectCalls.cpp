@@ -0,0 +1,32 @@
+// ${generated_comment}
+
+// Unboxed call stubs for the mobile interpreter, generated by
+// tools/codegen/gen_mobile_direct_calls.py from the selective build
+// operator list. Each stub pops its operator's arguments off the
+// interpreter stack, calls the unboxed at:: C++ API and pushes the
+// result back, so a steady-state op call is a single direct function
+// call with no IValue boxing of intermediates and no boxed dispatcher
+// round trip. Function::append_operator binds these into mobile Code at
+// load time via the direct call registry.
+
+#include <ATen/Functions.h>
+#include <ATen/core/stack.h>
+#include <torch/csrc/jit/mobile/direct_call_registry.h>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+namespace {
+
+using torch::jit::drop;
+using torch::jit::pack;
+using torch::jit::peek;
+
+${direct_call_definitions}
+
+${direct_call_registrations}
+
+} // namespace
+} // namespace mobile
+} // namespace jit
+} // namespace torch
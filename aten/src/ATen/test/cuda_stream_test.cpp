@@ -30,6 +30,50 @@
 /*
    Tests related to ATen streams.
    */
+// Verifies named lanes hand out dedicated streams with the right priority.
+// This test must come first in the file: lanes can only be registered before
+// any other test requests a stream and freezes the pool topology.
+TEST(TestStream, StreamLaneTest) {
+  if (!at::cuda::is_available()) return;
+  try {
+    at::cuda::registerStreamPoolLane("latency", 2, -1);
+    at::cuda::registerStreamPoolLane("prefetch", 4, 0);
+  } catch (const c10::Error&) {
+    // Another test already froze the pool topology (e.g. shuffled ordering);
+    // there is nothing left to verify.
+    return;
+  }
+  // Duplicate names are rejected
+  ASSERT_THROW(at::cuda::registerStreamPoolLane("latency", 2, -1), c10::Error);
+
+  // Streams in a lane are handed out round-robin over the lane's own set
+  std::unordered_set<cudaStream_t> latency_streams;
+  for (const auto i : c10::irange(4)) {
+    (void)i;
+    auto s = at::cuda::getStreamFromPool("latency");
+    ASSERT_EQ_CUDA(s.priority(), -1);
+    latency_streams.insert(s.stream());
+  }
+  ASSERT_EQ_CUDA(latency_streams.size(), 2);
+
+  std::unordered_set<cudaStream_t> prefetch_streams;
+  for (const auto i : c10::irange(4)) {
+    (void)i;
+    auto s = at::cuda::getStreamFromPool("prefetch");
+    ASSERT_EQ_CUDA(s.priority(), 0);
+    prefetch_streams.insert(s.stream());
+  }
+  ASSERT_EQ_CUDA(prefetch_streams.size(), 4);
+  for (const auto s : prefetch_streams) {
+    ASSERT_EQ_CUDA(latency_streams.count(s), 0);
+  }
+
+  // Registration is rejected once the pools exist
+  ASSERT_THROW(at::cuda::registerStreamPoolLane("late", 1, 0), c10::Error);
+  // Unknown lanes are rejected
+  ASSERT_THROW(at::cuda::getStreamFromPool("nonexistent"), c10::Error);
+}
+
 // Verifies streams are live through copying and moving
 TEST(TestStream, CopyAndMoveTest) {
   if (!at::cuda::is_available()) return;
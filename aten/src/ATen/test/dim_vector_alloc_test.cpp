@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/ExpandUtils.h>
+#include <ATen/InferSize.h>
+#include <ATen/TensorUtils.h>
+#include <c10/util/irange.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// This test counts heap allocations by overriding the global operator
+// new/delete for this binary. The DimVector protocol (IntArrayRef in,
+// DimVector out) must not touch the heap for ndim <= 5, and shape-heavy
+// tensor ops (view/reshape/expand) must not allocate more for 5-d shapes
+// than they do for 1-d shapes.
+
+namespace {
+
+std::atomic<uint64_t> allocation_count{0};
+
+struct AllocationCountGuard {
+  AllocationCountGuard() : start_(allocation_count.load()) {}
+
+  uint64_t allocations() const {
+    return allocation_count.load() - start_;
+  }
+
+  uint64_t start_;
+};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = std::malloc(size);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+using namespace at;
+
+TEST(DimVectorAllocTest, InferSizeDimVectorDoesNotAllocate) {
+  // clang-format off
+  const std::array<std::array<int64_t, 5>, 5> shapes = {{
+    {5, 0, 0, 0, 0},
+    {5, 3, 0, 0, 0},
+    {5, 3, 2, 0, 0},
+    {5, 3, 2, 4, 0},
+    {5, 3, 2, 4, 6},
+  }};
+  // clang-format on
+  for (const auto ndim : c10::irange(1, 6)) {
+    IntArrayRef shape(shapes[ndim - 1].data(), ndim);
+    AllocationCountGuard guard;
+    auto result = at::infer_size_dimvector(shape, shape);
+    ASSERT_EQ(guard.allocations(), 0) << "ndim " << ndim;
+    ASSERT_TRUE(result.size() == static_cast<size_t>(ndim));
+  }
+}
+
+TEST(DimVectorAllocTest, InferSizeDvDoesNotAllocate) {
+  const std::array<int64_t, 5> shape = {2, 3, -1, 4, 5};
+  for (const auto ndim : c10::irange(1, 6)) {
+    IntArrayRef sizes(shape.data(), ndim);
+    int64_t numel = 1;
+    for (const auto d : c10::irange(ndim)) {
+      numel *= std::abs(shape[d]);
+    }
+    AllocationCountGuard guard;
+    auto result = at::infer_size_dv(sizes, numel);
+    ASSERT_EQ(guard.allocations(), 0) << "ndim " << ndim;
+    ASSERT_TRUE(result.size() == static_cast<size_t>(ndim));
+  }
+}
+
+TEST(DimVectorAllocTest, ComputeStrideDimVectorDoesNotAllocate) {
+  const std::array<int64_t, 5> shape = {2, 3, 4, 5, 6};
+  for (const auto ndim : c10::irange(1, 6)) {
+    IntArrayRef sizes(shape.data(), ndim);
+    // Contiguous strides, computed outside the counted region.
+    DimVector strides(ndim);
+    int64_t stride = 1;
+    for (int64_t d = ndim - 1; d >= 0; d--) {
+      strides[d] = stride;
+      stride *= shape[d];
+    }
+    DimVector newshape(sizes);
+    AllocationCountGuard guard;
+    auto result = at::detail::computeStride(sizes, strides, newshape);
+    ASSERT_EQ(guard.allocations(), 0) << "ndim " << ndim;
+    ASSERT_TRUE(result.has_value());
+  }
+}
+
+// view/reshape/expand create a new TensorImpl, so they do allocate; but with
+// inline sizes/strides storage the number of allocations must not grow with
+// the number of dimensions (for ndim <= 5).
+TEST(DimVectorAllocTest, ViewReshapeExpandAllocationsAreDimIndependent) {
+  auto t1 = at::randn({720});
+  auto t5 = at::randn({2, 3, 4, 5, 6});
+  auto count_1d = [&]() {
+    AllocationCountGuard guard;
+    auto viewed = t1.view({720});
+    auto reshaped = t1.reshape({720});
+    auto expanded = t1.expand({720});
+    return guard.allocations();
+  };
+  auto count_5d = [&]() {
+    AllocationCountGuard guard;
+    auto viewed = t5.view({2, 3, 4, 5, 6});
+    auto reshaped = t5.reshape({6, 120});
+    auto expanded = t5.expand({2, 3, 4, 5, 6});
+    return guard.allocations();
+  };
+  // Warm up any lazily-initialized dispatcher state before counting.
+  count_1d();
+  count_5d();
+  ASSERT_EQ(count_5d(), count_1d());
+}
+
+TEST(DimVectorAllocTest, BroadcastAllocationsAreDimIndependent) {
+  auto a1 = at::randn({1});
+  auto b1 = at::randn({7});
+  auto a5 = at::randn({2, 1, 4, 1, 6});
+  auto b5 = at::randn({1, 3, 1, 5, 1});
+  auto count_1d = [&]() {
+    AllocationCountGuard guard;
+    auto result = at::infer_size_dimvector(a1.sizes(), b1.sizes());
+    auto expanded = a1.expand(result);
+    return guard.allocations();
+  };
+  auto count_5d = [&]() {
+    AllocationCountGuard guard;
+    auto result = at::infer_size_dimvector(a5.sizes(), b5.sizes());
+    auto expanded = a5.expand(result);
+    return guard.allocations();
+  };
+  count_1d();
+  count_5d();
+  ASSERT_EQ(count_5d(), count_1d());
+}
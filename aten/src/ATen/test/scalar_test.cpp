@@ -11,6 +11,7 @@
 #endif
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/ScalarOps.h>
 
 using std::cout;
 using namespace at;
@@ -180,3 +181,30 @@ TEST(TestScalar, TestFormatting) {
   ASSERT_EQ("(2,3.1)", format(Scalar(c10::complex<double>(2.0, 3.1))));
   ASSERT_EQ("(2,3.1)", format(Scalar(c10::complex<float>(2.0, 3.1))));
 }
+
+TEST(TestScalar, TestWrappedScalarCache) {
+  // Repeated wraps of the same value must hand out the same cached tensor;
+  // see Note [Wrapped scalar cache].
+  auto a = at::detail::wrapped_scalar_tensor_cached(Scalar(2.5));
+  auto b = at::detail::wrapped_scalar_tensor_cached(Scalar(2.5));
+  ASSERT_EQ(a.unsafeGetTensorImpl(), b.unsafeGetTensorImpl());
+  ASSERT_TRUE(a.unsafeGetTensorImpl()->is_wrapped_number());
+  ASSERT_EQ(a.item<double>(), 2.5);
+
+  auto c = at::detail::wrapped_scalar_tensor_cached(Scalar(3.5));
+  ASSERT_NE(a.unsafeGetTensorImpl(), c.unsafeGetTensorImpl());
+  ASSERT_EQ(c.item<double>(), 3.5);
+
+  // Equal bit patterns with different dtypes must stay distinct.
+  auto l = at::detail::wrapped_scalar_tensor_cached(Scalar(int64_t(1)));
+  auto t = at::detail::wrapped_scalar_tensor_cached(Scalar(true));
+  ASSERT_NE(l.unsafeGetTensorImpl(), t.unsafeGetTensorImpl());
+  ASSERT_EQ(l.scalar_type(), kLong);
+  ASSERT_EQ(t.scalar_type(), kBool);
+
+  // The cached tensors feed type promotion as ordinary wrapped numbers.
+  auto x = ones({2, 2}, kFloat);
+  auto y = x + 2;
+  ASSERT_EQ(y.scalar_type(), kFloat);
+  ASSERT_TRUE(y.equal(x + x + x));
+}
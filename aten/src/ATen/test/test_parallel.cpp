@@ -124,3 +124,20 @@ TEST(TestParallel, IntraOpLaunchFuture) {
 
   ASSERT_TRUE(v1 == 1 && v2 == 2);
 }
+
+TEST(TestParallel, InterOpLaunchFuture) {
+  auto fut = at::launch_future([]() {
+    return c10::IValue(at::ones({5}) * 2);
+  });
+
+  fut->wait();
+  auto result = fut->value().toTensor();
+  ASSERT_TRUE(result.equal(at::ones({5}) * 2));
+
+  auto err_fut = at::launch_future([]() -> c10::IValue {
+    throw std::runtime_error("exception");
+  });
+
+  err_fut->wait();
+  ASSERT_TRUE(err_fut->hasError());
+}
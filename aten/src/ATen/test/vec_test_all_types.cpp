@@ -322,6 +322,48 @@ namespace {
             [](vec v) { return v.cosh(); },
             test_case);
     }
+    TYPED_TEST(Hyperbolic, ACosh) {
+        using vec = TypeParam;
+        using UVT = UvalueType<TypeParam>;
+        auto test_case =
+            TestingCase<vec>::getBuilder()
+            .addDomain(CheckWithinDomains<UVT>{ { {1, 1000}}, true, getDefaultTolerance<UVT>()})
+            .setTrialCount(65536)
+            .setTestSeed(TestSeed());
+        test_unary<vec>(
+            NAME_INFO(acosh),
+            RESOLVE_OVERLOAD(std::acosh),
+            [](vec v) { return v.acosh(); },
+            test_case);
+    }
+    TYPED_TEST(Hyperbolic, ASinh) {
+        using vec = TypeParam;
+        using UVT = UvalueType<TypeParam>;
+        auto test_case =
+            TestingCase<vec>::getBuilder()
+            .addDomain(CheckWithinDomains<UVT>{ { {-88, 88}}, true, getDefaultTolerance<UVT>()})
+            .setTrialCount(65536)
+            .setTestSeed(TestSeed());
+        test_unary<vec>(
+            NAME_INFO(asinh),
+            RESOLVE_OVERLOAD(std::asinh),
+            [](vec v) { return v.asinh(); },
+            test_case);
+    }
+    TYPED_TEST(Hyperbolic, ATanh) {
+        using vec = TypeParam;
+        using UVT = UvalueType<TypeParam>;
+        auto test_case =
+            TestingCase<vec>::getBuilder()
+            .addDomain(CheckWithinDomains<UVT>{ { {-1, 1}}, true, getDefaultTolerance<UVT>()})
+            .setTrialCount(65536)
+            .setTestSeed(TestSeed());
+        test_unary<vec>(
+            NAME_INFO(atanh),
+            RESOLVE_OVERLOAD(std::atanh),
+            [](vec v) { return v.atanh(); },
+            test_case);
+    }
     TYPED_TEST(InverseTrigonometric, Asin) {
         using vec = TypeParam;
         using UVT = UvalueType<TypeParam>;
@@ -423,6 +465,14 @@ namespace {
             [](const vec& v) { return v.expm1(); },
             createDefaultUnaryTestCase<vec>(TestSeed(), false, true));
     }
+    TYPED_TEST(Exponents, Exp2) {
+        using vec = TypeParam;
+        test_unary<vec>(
+            NAME_INFO(exp2),
+            RESOLVE_OVERLOAD(std::exp2),
+            [](const vec& v) { return v.exp2(); },
+            createDefaultUnaryTestCase<vec>(TestSeed(), false, true));
+    }
     TYPED_TEST(ErrorFunctions, Erf) {
         using vec = TypeParam;
         test_unary<vec>(
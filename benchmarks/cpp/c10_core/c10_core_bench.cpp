@@ -0,0 +1,127 @@
+// Instruction-count microbenchmarks for c10 core abstractions.
+//
+// Every benchmark registers a fixed iteration count so that a run under
+// callgrind executes a deterministic number of iterations: total Ir for a
+// filtered run, minus the Ir of the same binary running only BM_Baseline,
+// divided by kIterations, gives an instruction-exact per-iteration cost.
+// See check_instruction_counts.py next to this file for the automation and
+// the baseline diff gate.
+
+#include <ATen/ATen.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/DispatchKeySet.h>
+#include <c10/core/TensorImpl.h>
+#include <c10/util/intrusive_ptr.h>
+
+namespace {
+
+// Large enough to drown out callgrind's per-run noise (a few hundred
+// instructions of setup), small enough that a full sweep stays fast.
+constexpr int64_t kIterations = 8192;
+
+// An empty loop with the same shape as the real benchmarks; its filtered
+// callgrind run measures binary startup + harness cost, which the collection
+// script subtracts from every other benchmark.
+void BM_Baseline(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_Baseline)->Iterations(kIterations);
+
+struct Target : c10::intrusive_ptr_target {
+  int64_t payload = 0;
+};
+
+void BM_IntrusivePtrCopy(benchmark::State& state) {
+  auto ptr = c10::make_intrusive<Target>();
+  for (auto _ : state) {
+    c10::intrusive_ptr<Target> copy = ptr;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_IntrusivePtrCopy)->Iterations(kIterations);
+
+void BM_IntrusivePtrMove(benchmark::State& state) {
+  auto ptr = c10::make_intrusive<Target>();
+  for (auto _ : state) {
+    c10::intrusive_ptr<Target> moved = std::move(ptr);
+    benchmark::DoNotOptimize(moved);
+    ptr = std::move(moved);
+  }
+}
+BENCHMARK(BM_IntrusivePtrMove)->Iterations(kIterations);
+
+void BM_TensorImplCreation(benchmark::State& state) {
+  const auto key_set = c10::DispatchKeySet(c10::DispatchKey::CPU);
+  const auto dtype = caffe2::TypeMeta::Make<float>();
+  for (auto _ : state) {
+    auto impl = c10::make_intrusive<c10::TensorImpl>(
+        key_set, dtype, c10::Device(c10::kCPU));
+    benchmark::DoNotOptimize(impl);
+  }
+}
+BENCHMARK(BM_TensorImplCreation)->Iterations(kIterations);
+
+void BM_TensorCreationEmpty(benchmark::State& state) {
+  // The full at::empty path: dispatch, allocator, TensorImpl. This is the
+  // number that silently grew +30 instructions in past dispatch refactors.
+  auto options = at::TensorOptions().dtype(at::kFloat);
+  for (auto _ : state) {
+    auto tensor = at::empty({0}, options);
+    benchmark::DoNotOptimize(tensor);
+  }
+}
+BENCHMARK(BM_TensorCreationEmpty)->Iterations(kIterations);
+
+void BM_DispatchKeySetMath(benchmark::State& state) {
+  auto ks = c10::DispatchKeySet(c10::DispatchKey::CPU) |
+      c10::DispatchKeySet(c10::DispatchKey::AutogradCPU);
+  for (auto _ : state) {
+    auto with_added = ks.add(c10::DispatchKey::BackendSelect);
+    auto removed = with_added.remove(c10::DispatchKey::AutogradCPU);
+    auto has = removed.has(c10::DispatchKey::CPU);
+    auto highest = with_added.highestPriorityTypeId();
+    benchmark::DoNotOptimize(with_added);
+    benchmark::DoNotOptimize(removed);
+    benchmark::DoNotOptimize(has);
+    benchmark::DoNotOptimize(highest);
+  }
+}
+BENCHMARK(BM_DispatchKeySetMath)->Iterations(kIterations);
+
+void BM_IValueBoxInt(benchmark::State& state) {
+  for (auto _ : state) {
+    c10::IValue boxed(static_cast<int64_t>(42));
+    auto unboxed = boxed.toInt();
+    benchmark::DoNotOptimize(boxed);
+    benchmark::DoNotOptimize(unboxed);
+  }
+}
+BENCHMARK(BM_IValueBoxInt)->Iterations(kIterations);
+
+void BM_IValueBoxTensor(benchmark::State& state) {
+  auto tensor = at::empty({0}, at::TensorOptions().dtype(at::kFloat));
+  for (auto _ : state) {
+    c10::IValue boxed(tensor);
+    auto unboxed = boxed.toTensor();
+    benchmark::DoNotOptimize(boxed);
+    benchmark::DoNotOptimize(unboxed);
+  }
+}
+BENCHMARK(BM_IValueBoxTensor)->Iterations(kIterations);
+
+void BM_IValueBoxIntList(benchmark::State& state) {
+  std::vector<int64_t> sizes = {1, 2, 3, 4};
+  for (auto _ : state) {
+    c10::IValue boxed(sizes);
+    auto unboxed = boxed.toIntVector();
+    benchmark::DoNotOptimize(boxed);
+    benchmark::DoNotOptimize(unboxed);
+  }
+}
+BENCHMARK(BM_IValueBoxIntList)->Iterations(kIterations);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""Callgrind automation for the c10 core instruction-count benchmarks.
+
+Runs each benchmark in c10_core_bench under `valgrind --tool=callgrind`,
+one filtered run per benchmark, and converts the totals into deterministic
+per-iteration instruction counts:
+
+    count(BM_Foo) = (Ir(run filtered to BM_Foo) - Ir(run filtered to
+                     BM_Baseline)) / iterations
+
+Every benchmark registers a fixed iteration count (see c10_core_bench.cpp),
+so repeated runs on the same binary produce the same numbers and a diff
+against a checked-in baseline is instruction-exact.
+
+Usage:
+
+  # Print counts for all benchmarks:
+  check_instruction_counts.py collect --binary build/bin/c10_core_bench
+
+  # Record counts as the new baseline for this toolchain:
+  check_instruction_counts.py collect --binary ... --update-baseline
+
+  # Gate a refactor (non-zero exit on any count above baseline):
+  check_instruction_counts.py compare --binary ...
+
+Counts depend on compiler, flags, and libc, so baselines live in
+baselines/<name>.json keyed by a name you pass with --baseline-name
+(default: "default"); regenerate them on the pinned CI toolchain rather
+than sharing them across machines.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+BASELINE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "baselines")
+ITERATIONS = 8192  # Must match kIterations in c10_core_bench.cpp.
+
+
+def list_benchmarks(binary):
+    output = subprocess.check_output(
+        [binary, "--benchmark_list_tests=true"], encoding="utf-8"
+    )
+    # Registered names look like "BM_Foo/iterations:8192".
+    names = []
+    for line in output.splitlines():
+        name = line.split("/")[0].strip()
+        if name and name not in names:
+            names.append(name)
+    return names
+
+
+def measure_total_instructions(binary, benchmark_name):
+    """Total Ir of the binary while running only `benchmark_name`."""
+    with tempfile.TemporaryDirectory() as tmp:
+        out_file = os.path.join(tmp, "callgrind.out")
+        subprocess.check_call(
+            [
+                "valgrind",
+                "--tool=callgrind",
+                "--callgrind-out-file={}".format(out_file),
+                binary,
+                "--benchmark_filter=^{}$".format(re.escape(benchmark_name)),
+            ],
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+        )
+        with open(out_file) as f:
+            for line in f:
+                if line.startswith("summary:"):
+                    return int(line.split()[1])
+    raise RuntimeError(
+        "no callgrind summary found for benchmark {}".format(benchmark_name)
+    )
+
+
+def collect(binary):
+    benchmarks = list_benchmarks(binary)
+    if "BM_Baseline" not in benchmarks:
+        raise RuntimeError("binary does not register BM_Baseline")
+    baseline_ir = measure_total_instructions(binary, "BM_Baseline")
+    counts = {}
+    for name in benchmarks:
+        if name == "BM_Baseline":
+            continue
+        total_ir = measure_total_instructions(binary, name)
+        counts[name] = (total_ir - baseline_ir) // ITERATIONS
+    return counts
+
+
+def baseline_path(name):
+    return os.path.join(BASELINE_DIR, "{}.json".format(name))
+
+
+def load_baseline(name):
+    path = baseline_path(name)
+    if not os.path.exists(path):
+        raise RuntimeError(
+            "no baseline at {}; record one with `collect --update-baseline` "
+            "on the pinned toolchain".format(path)
+        )
+    with open(path) as f:
+        return json.load(f)
+
+
+def save_baseline(name, counts):
+    os.makedirs(BASELINE_DIR, exist_ok=True)
+    path = baseline_path(name)
+    with open(path, "w") as f:
+        json.dump(counts, f, indent=2, sort_keys=True)
+        f.write("\n")
+    return path
+
+
+def compare(counts, baseline, tolerance):
+    """Returns a list of (name, count, baseline_count) regressions."""
+    regressions = []
+    for name, baseline_count in sorted(baseline.items()):
+        count = counts.get(name)
+        if count is None:
+            print("warning: benchmark {} is in the baseline but not the "
+                  "binary".format(name))
+            continue
+        delta = count - baseline_count
+        marker = ""
+        if delta > tolerance:
+            marker = "  <-- REGRESSION"
+            regressions.append((name, count, baseline_count))
+        print("{:<28} {:>10} instructions  ({:+d} vs baseline){}".format(
+            name, count, delta, marker))
+    for name in sorted(set(counts) - set(baseline)):
+        print("{:<28} {:>10} instructions  (no baseline)".format(
+            name, counts[name]))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("mode", choices=("collect", "compare"))
+    parser.add_argument(
+        "--binary", required=True, help="path to the c10_core_bench binary"
+    )
+    parser.add_argument(
+        "--baseline-name", default="default",
+        help="baseline file name under baselines/ (default: default)",
+    )
+    parser.add_argument(
+        "--tolerance", type=int, default=0,
+        help="allowed per-benchmark instruction growth before failing "
+             "(default: 0, i.e. instruction-exact)",
+    )
+    parser.add_argument(
+        "--update-baseline", action="store_true",
+        help="with `collect`, write the measured counts as the baseline",
+    )
+    args = parser.parse_args()
+
+    counts = collect(args.binary)
+
+    if args.mode == "collect":
+        for name in sorted(counts):
+            print("{:<28} {:>10} instructions".format(name, counts[name]))
+        if args.update_baseline:
+            path = save_baseline(args.baseline_name, counts)
+            print("baseline written to {}".format(path))
+        return 0
+
+    baseline = load_baseline(args.baseline_name)
+    regressions = compare(counts, baseline, args.tolerance)
+    if regressions:
+        print("\n{} benchmark(s) regressed past the {}-instruction "
+              "tolerance".format(len(regressions), args.tolerance))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
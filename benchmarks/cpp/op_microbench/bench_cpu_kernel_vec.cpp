@@ -0,0 +1,112 @@
+#include <ATen/ATen.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+
+#include <array>
+
+#include "perf_counters.h"
+
+using op_microbench::PerfCounters;
+
+// dtype/size grids over ops whose CPU kernels go through cpu_kernel_vec.
+// Out-variants are used so allocation stays out of the measured region;
+// small sizes expose per-call overhead, large sizes expose bandwidth and
+// vectorization quality.
+
+namespace {
+
+const std::array<at::ScalarType, 4> kBinaryDtypes = {
+    at::kFloat, at::kDouble, at::kBFloat16, at::kLong};
+
+const std::array<at::ScalarType, 3> kUnaryDtypes = {
+    at::kFloat, at::kDouble, at::kBFloat16};
+
+void BinaryGrid(benchmark::internal::Benchmark* b) {
+  for (size_t dt = 0; dt < kBinaryDtypes.size(); ++dt) {
+    for (int64_t size : {64, 1024, 16384, 262144, 4194304}) {
+      b->Args({size, static_cast<int64_t>(dt)});
+    }
+  }
+}
+
+void UnaryGrid(benchmark::internal::Benchmark* b) {
+  for (size_t dt = 0; dt < kUnaryDtypes.size(); ++dt) {
+    for (int64_t size : {64, 1024, 16384, 262144, 4194304}) {
+      b->Args({size, static_cast<int64_t>(dt)});
+    }
+  }
+}
+
+} // namespace
+
+static void BM_AddOut(benchmark::State& state) {
+  c10::InferenceMode guard;
+  const auto size = state.range(0);
+  const auto opts = at::TensorOptions().dtype(kBinaryDtypes[state.range(1)]);
+  auto a = at::ones({size}, opts);
+  auto b = at::ones({size}, opts);
+  auto out = at::empty({size}, opts);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    at::add_out(out, a, b);
+    counters.stop();
+  }
+  counters.report(state);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_AddOut)->Apply(BinaryGrid);
+
+static void BM_MulOut(benchmark::State& state) {
+  c10::InferenceMode guard;
+  const auto size = state.range(0);
+  const auto opts = at::TensorOptions().dtype(kBinaryDtypes[state.range(1)]);
+  auto a = at::ones({size}, opts);
+  auto b = at::ones({size}, opts);
+  auto out = at::empty({size}, opts);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    at::mul_out(out, a, b);
+    counters.stop();
+  }
+  counters.report(state);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_MulOut)->Apply(BinaryGrid);
+
+static void BM_ExpOut(benchmark::State& state) {
+  c10::InferenceMode guard;
+  const auto size = state.range(0);
+  const auto opts = at::TensorOptions().dtype(kUnaryDtypes[state.range(1)]);
+  auto a = at::rand({size}, at::kFloat).to(opts.dtype());
+  auto out = at::empty({size}, opts);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    at::exp_out(out, a);
+    counters.stop();
+  }
+  counters.report(state);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_ExpOut)->Apply(UnaryGrid);
+
+// Strided (every-other-element) variant: exercises the non-contiguous
+// fallback inside cpu_kernel_vec rather than the vectorized fast path.
+static void BM_AddOutStrided(benchmark::State& state) {
+  c10::InferenceMode guard;
+  const auto size = state.range(0);
+  auto a = at::ones({size * 2}).slice(0, 0, size * 2, 2);
+  auto b = at::ones({size * 2}).slice(0, 0, size * 2, 2);
+  auto out = at::empty({size * 2}).slice(0, 0, size * 2, 2);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    at::add_out(out, a, b);
+    counters.stop();
+  }
+  counters.report(state);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_AddOutStrided)->Arg(1024)->Arg(262144);
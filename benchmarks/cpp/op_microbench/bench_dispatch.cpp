@@ -0,0 +1,62 @@
+#include <ATen/ATen.h>
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/ivalue.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+
+#include "perf_counters.h"
+
+using op_microbench::PerfCounters;
+
+// End-to-end unboxed dispatch: everything between the C++ API entry point
+// and the kernel, dominated by dispatcher and TensorIterator overhead at
+// this tensor size.
+static void BM_DispatchUnboxedAdd(benchmark::State& state) {
+  c10::InferenceMode guard;
+  auto a = at::ones({1});
+  auto b = at::ones({1});
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    auto out = at::add(a, b);
+    benchmark::DoNotOptimize(out);
+    counters.stop();
+  }
+  counters.report(state);
+}
+BENCHMARK(BM_DispatchUnboxedAdd);
+
+// Boxed dispatch through Dispatcher::callBoxed, including IValue stack
+// construction; the delta against the unboxed variant is the boxing cost.
+static void BM_DispatchBoxedAdd(benchmark::State& state) {
+  c10::InferenceMode guard;
+  auto op =
+      c10::Dispatcher::singleton().findSchemaOrThrow("aten::add", "Tensor");
+  auto a = at::ones({1});
+  auto b = at::ones({1});
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    std::vector<c10::IValue> stack{a, b, at::Scalar(1)};
+    op.callBoxed(&stack);
+    benchmark::DoNotOptimize(stack);
+    counters.stop();
+  }
+  counters.report(state);
+}
+BENCHMARK(BM_DispatchBoxedAdd);
+
+// IValue boxing/unboxing of a Tensor in isolation.
+static void BM_IValueTensorRoundTrip(benchmark::State& state) {
+  auto a = at::ones({1});
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    c10::IValue boxed(a);
+    auto unboxed = boxed.toTensor();
+    benchmark::DoNotOptimize(unboxed);
+    counters.stop();
+  }
+  counters.report(state);
+}
+BENCHMARK(BM_IValueTensorRoundTrip);
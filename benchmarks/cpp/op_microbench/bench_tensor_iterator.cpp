@@ -0,0 +1,53 @@
+#include <ATen/ATen.h>
+#include <ATen/native/TensorIterator.h>
+#include <benchmark/benchmark.h>
+#include <c10/core/InferenceMode.h>
+
+#include "perf_counters.h"
+
+using op_microbench::PerfCounters;
+
+// Cost of configuring and building a binary-op TensorIterator (shape
+// computation, dtype promotion, dim coalescing), without running a kernel.
+static void BM_TensorIteratorBinarySetup(benchmark::State& state) {
+  c10::InferenceMode guard;
+  auto a = at::rand({state.range(0)});
+  auto b = at::rand({state.range(0)});
+  auto out = at::empty_like(a);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    auto iter = at::TensorIteratorConfig()
+                    .add_output(out)
+                    .add_input(a)
+                    .add_input(b)
+                    .build();
+    benchmark::DoNotOptimize(iter);
+    counters.stop();
+  }
+  counters.report(state);
+}
+BENCHMARK(BM_TensorIteratorBinarySetup)->Arg(1)->Arg(64)->Arg(4096);
+
+// Same setup but with broadcasting and type promotion in play, the
+// expensive configuration path.
+static void BM_TensorIteratorBroadcastPromoteSetup(benchmark::State& state) {
+  c10::InferenceMode guard;
+  auto a = at::rand({state.range(0), state.range(0)});
+  auto b = at::rand({state.range(0)}).to(at::kDouble);
+  auto out = at::empty({state.range(0), state.range(0)}, at::kDouble);
+  PerfCounters counters;
+  for (auto _ : state) {
+    counters.start();
+    auto iter = at::TensorIteratorConfig()
+                    .add_output(out)
+                    .add_input(a)
+                    .add_input(b)
+                    .promote_inputs_to_common_dtype(true)
+                    .build();
+    benchmark::DoNotOptimize(iter);
+    counters.stop();
+  }
+  counters.report(state);
+}
+BENCHMARK(BM_TensorIteratorBroadcastPromoteSetup)->Arg(8)->Arg(64);
@@ -0,0 +1,100 @@
+#include "perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace op_microbench {
+
+#ifdef __linux__
+
+namespace {
+
+int open_counter(uint32_t type, uint64_t config) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(syscall(
+      __NR_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1,
+      /*group_fd=*/-1, /*flags=*/0));
+}
+
+constexpr uint64_t kL1DReadMiss = PERF_COUNT_HW_CACHE_L1D |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+} // namespace
+
+PerfCounters::PerfCounters() : totals_{} {
+  fds_[0] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  fds_[1] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  fds_[2] = open_counter(PERF_TYPE_HW_CACHE, kL1DReadMiss);
+  fds_[3] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+}
+
+PerfCounters::~PerfCounters() {
+  for (int fd : fds_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+void PerfCounters::start() {
+  for (int fd : fds_) {
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+void PerfCounters::stop() {
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    if (fds_[i] < 0) {
+      continue;
+    }
+    ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(fds_[i], &value, sizeof(value)) == sizeof(value)) {
+      totals_[i] += value;
+    }
+  }
+}
+
+void PerfCounters::report(benchmark::State& state) {
+  static const char* const kNames[kNumEvents] = {
+      "cycles", "instructions", "L1D_misses", "LLC_misses"};
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    if (fds_[i] >= 0) {
+      state.counters[kNames[i]] = benchmark::Counter(
+          static_cast<double>(totals_[i]), benchmark::Counter::kAvgIterations);
+    }
+  }
+}
+
+#else // __linux__
+
+PerfCounters::PerfCounters() : totals_{} {
+  fds_.fill(-1);
+}
+PerfCounters::~PerfCounters() = default;
+void PerfCounters::start() {}
+void PerfCounters::stop() {}
+void PerfCounters::report(benchmark::State& state) {
+  (void)state;
+}
+
+#endif // __linux__
+
+} // namespace op_microbench
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+namespace op_microbench {
+
+// Thin wrapper over perf_event_open for the hardware counters that matter on
+// the op hot path: cycles, instructions, L1D misses and LLC misses. On
+// non-Linux platforms, or when the kernel denies access (see
+// /proc/sys/kernel/perf_event_paranoid), the wrapper degrades to reporting
+// nothing and the benchmarks still run with wall time only.
+class PerfCounters {
+ public:
+  PerfCounters();
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters& operator=(const PerfCounters&) = delete;
+
+  // Bracket the measured region; start/stop may be called once per
+  // benchmark iteration.
+  void start();
+  void stop();
+
+  // Adds per-iteration cycles/instructions/L1D-miss/LLC-miss columns to the
+  // benchmark's counters.
+  void report(benchmark::State& state);
+
+ private:
+  static constexpr size_t kNumEvents = 4;
+  std::array<int, kNumEvents> fds_;
+  std::array<uint64_t, kNumEvents> totals_;
+};
+
+} // namespace op_microbench
@@ -132,3 +132,33 @@ TEST(StaticModule, RValueInputs) {
   EXPECT_TRUE(actual.isTensor());
   EXPECT_TRUE(expected.toTensor().equal(actual.toTensor()));
 }
+
+TEST(StaticRuntimePool, AcquireReleaseReuse) {
+  const std::string src = R"JIT(
+    def forward(self, x):
+        y = torch.relu(x)
+        return y.clone()
+  )JIT";
+  Module m("module");
+  m.define(src);
+  auto sm = std::make_shared<StaticModule>(m);
+  StaticRuntimePool pool(sm);
+
+  std::vector<IValue> input{at::randn({1})};
+  StaticRuntime* first = nullptr;
+  {
+    // Two outstanding handles must be distinct, independently usable
+    // runtimes backed by the same StaticModule.
+    auto runtime_a = pool.acquire();
+    auto runtime_b = pool.acquire();
+    first = runtime_a.get();
+    EXPECT_NE(runtime_a.get(), runtime_b.get());
+    auto out_a = (*runtime_a)(input, {});
+    auto out_b = (*runtime_b)(input, {});
+    EXPECT_TRUE(out_a.toTensor().equal(out_b.toTensor()));
+  }
+  // Released runtimes go back to the pool; the most recently released one
+  // (the head of the free list) is handed out again.
+  auto runtime = pool.acquire();
+  EXPECT_EQ(runtime.get(), first);
+}
@@ -202,14 +202,19 @@ void testStaticRuntime(
 
   for (bool enable_out_variant : {true, false}) {
     for (bool manage_output_tensors : {true, false}) {
+     for (bool optimize_memory_offsets : {false, true}) {
       if (!enable_out_variant && manage_output_tensors) {
         continue;
       }
+      if (!enable_out_variant && optimize_memory_offsets) {
+        continue;
+      }
       StaticModuleOptions opts{
         .cleanup_activations = true,
         .enable_out_variant = enable_out_variant,
         .optimize_memory = enable_out_variant,
-        .manage_output_tensors = manage_output_tensors
+        .manage_output_tensors = manage_output_tensors,
+        .optimize_memory_offsets = optimize_memory_offsets
       };
       auto smodule = test_context->makeStaticModule(opts);
       StaticRuntime runtime(smodule);
@@ -270,6 +275,7 @@ void testStaticRuntime(
           runtime.checkOutputTensorMemoryLeaks();
         }
       }
+     }
     }
   }
 
@@ -1,7 +1,11 @@
 #include <c10/core/Allocator.h>
 
+#include <c10/util/RequestTracer.h>
 #include <c10/util/ThreadLocalDebugInfo.h>
 
+#include <mutex>
+#include <new>
+
 namespace c10 {
 
 static void deleteInefficientStdFunctionContext(void* ptr) {
@@ -19,6 +23,92 @@ at::DataPtr InefficientStdFunctionContext::makeDataPtr(
       device};
 }
 
+namespace {
+
+// Note [Pooled deleter contexts]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Wrapping an external buffer in a tensor needs a heap-allocated context
+// to carry the type-erased deleter, and workloads that ingest buffers
+// zero-copy (e.g. from_blob on every incoming frame) pay that allocation
+// once per tensor.  The contexts are all the same size, so instead of
+// round-tripping each one through operator new we recycle them through a
+// global free list of fixed-size blocks.  A context is freed from
+// whatever thread drops the last reference to the storage, so the list
+// is guarded by a mutex; the critical section is a pointer swap, and the
+// list is capped so that a burst of wrapped tensors cannot pin memory
+// indefinitely.
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+static_assert(
+    sizeof(PooledStdFunctionContext) >= sizeof(FreeBlock),
+    "pooled context blocks must be able to hold a free list pointer");
+
+constexpr size_t kPooledContextCap = 1024;
+
+std::mutex pooled_context_mutex;
+FreeBlock* pooled_context_list = nullptr;
+size_t pooled_context_count = 0;
+
+void* allocPooledContextBlock() {
+  {
+    std::lock_guard<std::mutex> guard(pooled_context_mutex);
+    if (pooled_context_list != nullptr) {
+      FreeBlock* block = pooled_context_list;
+      pooled_context_list = block->next;
+      --pooled_context_count;
+      return block;
+    }
+  }
+  return ::operator new(sizeof(PooledStdFunctionContext));
+}
+
+void freePooledContextBlock(void* ptr) {
+  {
+    std::lock_guard<std::mutex> guard(pooled_context_mutex);
+    if (pooled_context_count < kPooledContextCap) {
+      auto* block = static_cast<FreeBlock*>(ptr);
+      block->next = pooled_context_list;
+      pooled_context_list = block;
+      ++pooled_context_count;
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+void deletePooledStdFunctionContext(void* ptr) {
+  auto* ctx = static_cast<PooledStdFunctionContext*>(ptr);
+  // Match InefficientStdFunctionContext (and std::unique_ptr): the
+  // deleter is not invoked for a null data pointer.
+  if (ctx->data_ != nullptr) {
+    ctx->deleter_(ctx->data_);
+  }
+  ctx->~PooledStdFunctionContext();
+  freePooledContextBlock(ctx);
+}
+
+} // namespace
+
+at::DataPtr PooledStdFunctionContext::makeDataPtr(
+    void* ptr,
+    std::function<void(void*)> deleter,
+    Device device) {
+#ifdef __GXX_RTTI
+  // A deleter that just wraps a plain function pointer needs no context
+  // at all: the data pointer doubles as the context, exactly as in the
+  // raw DataPtr constructor.
+  if (DeleterFnPtr* fnptr = deleter.target<DeleterFnPtr>()) {
+    return {ptr, ptr, *fnptr, device};
+  }
+#endif // __GXX_RTTI
+  void* block = allocPooledContextBlock();
+  auto* ctx = new (block) PooledStdFunctionContext(ptr, std::move(deleter));
+  return {ptr, ctx, &deletePooledStdFunctionContext, device};
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
 C10_API at::Allocator* allocator_array[at::COMPILE_TIME_MAX_DEVICE_TYPES];
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
@@ -55,6 +145,17 @@ void reportMemoryUsageToProfiler(
     reporter_ptr->reportMemoryUsage(
         ptr, alloc_size, total_allocated, total_reserved, device);
   }
+  // Every allocator that reports to the profiler funnels through here,
+  // so this is also where allocations land on the request timeline.
+  // See Note [Request trace].
+  if (C10_UNLIKELY(RequestTracer::active())) {
+    RequestTracer::record(
+        alloc_size >= 0 ? RequestTraceEventKind::ALLOC
+                        : RequestTraceEventKind::FREE,
+        reinterpret_cast<uint64_t>(ptr),
+        alloc_size,
+        device);
+  }
 }
 
 MemoryReportingInfoBase::MemoryReportingInfoBase() = default;
@@ -181,7 +181,8 @@ struct C10_API Allocator {
 //
 // This context is inefficient because we have to do a dynamic
 // allocation InefficientStdFunctionContext, on top of the dynamic
-// allocation which is implied by std::function itself.
+// allocation which is implied by std::function itself.  New code
+// should prefer PooledStdFunctionContext below, which avoids both.
 struct C10_API InefficientStdFunctionContext {
   std::unique_ptr<void, std::function<void(void*)>> ptr_;
   InefficientStdFunctionContext(
@@ -193,6 +194,25 @@ struct C10_API InefficientStdFunctionContext {
       Device device);
 };
 
+// An allocation-free replacement for InefficientStdFunctionContext.
+// The deleter is stored in place in the context node (via std::function's
+// small-object storage, for any capture that fits it), and the nodes
+// themselves are recycled through a global free list instead of being
+// round-tripped through operator new; see Note [Pooled deleter contexts]
+// in Allocator.cpp.  When the deleter is a plain function pointer, no
+// context node is materialized at all: the data pointer doubles as the
+// context and the function pointer is attached to the DataPtr directly.
+struct C10_API PooledStdFunctionContext {
+  void* data_;
+  std::function<void(void*)> deleter_;
+  PooledStdFunctionContext(void* data, std::function<void(void*)> deleter)
+      : data_(data), deleter_(std::move(deleter)) {}
+  static DataPtr makeDataPtr(
+      void* ptr,
+      std::function<void(void*)> deleter,
+      Device device);
+};
+
 /** Set the allocator for DeviceType `t`. The passed in allocator pointer is
  *  expected to have static lifetime; this function does NOT take ownership
  *  of the raw pointer. (The reason for this is to prevent existing pointers
@@ -1,8 +1,16 @@
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/DeviceType.h>
+#include <c10/util/RequestTracer.h>
 #include <c10/mobile/CPUCachingAllocator.h>
 #include <c10/mobile/CPUProfilingAllocator.h>
 
+#include <atomic>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 // TODO: rename flags to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -19,8 +27,53 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+C10_DEFINE_bool(
+    caffe2_cpu_allocator_use_hugepages,
+    false,
+    "If set, advise transparent huge pages for CPU allocations of at least "
+    "one huge page, reducing dTLB misses on large-tensor scans");
+
+// Android also defines __linux__, but alloc_cpu goes through memalign
+// rather than posix_memalign there, so keep it on the plain path.
+#if defined(__linux__) && !defined(__ANDROID__) && defined(MADV_HUGEPAGE)
+#define C10_CPU_ALLOCATOR_HAS_THP 1
+#endif
+
 namespace c10 {
 
+#ifdef C10_CPU_ALLOCATOR_HAS_THP
+namespace {
+// Transparent huge pages on Linux are 2MB.
+constexpr size_t gHugePageSize = 2 * 1024 * 1024;
+
+std::atomic<size_t> g_hugepages_alloc_count(0);
+std::atomic<size_t> g_hugepages_alloc_bytes(0);
+
+bool use_hugepages_for(size_t nbytes) {
+  static const bool env_enabled =
+      std::getenv("PYTORCH_CPU_ALLOC_USE_HUGEPAGES") != nullptr;
+  return (FLAGS_caffe2_cpu_allocator_use_hugepages || env_enabled) &&
+      nbytes >= gHugePageSize;
+}
+} // namespace
+
+size_t GetHugePagesAllocCount() {
+  return g_hugepages_alloc_count.load(std::memory_order_relaxed);
+}
+
+size_t GetHugePagesAllocBytes() {
+  return g_hugepages_alloc_bytes.load(std::memory_order_relaxed);
+}
+#else
+size_t GetHugePagesAllocCount() {
+  return 0;
+}
+
+size_t GetHugePagesAllocBytes() {
+  return 0;
+}
+#endif
+
 void memset_junk(void* data, size_t num) {
   // This garbage pattern is NaN when interpreted as floating point values,
   // or as very large integer values.
@@ -56,7 +109,16 @@ void* alloc_cpu(size_t nbytes) {
 #elif defined(_MSC_VER)
   data = _aligned_malloc(nbytes, gAlignment);
 #else
-  int err = posix_memalign(&data, gAlignment, nbytes);
+  size_t alignment = gAlignment;
+#ifdef C10_CPU_ALLOCATOR_HAS_THP
+  const bool use_hugepages = use_hugepages_for(nbytes);
+  if (use_hugepages) {
+    // Align the allocation to the huge page size so the kernel can back
+    // the whole region with 2MB pages, not just its interior.
+    alignment = gHugePageSize;
+  }
+#endif
+  int err = posix_memalign(&data, alignment, nbytes);
   if (err != 0) {
     CAFFE_THROW(
         "DefaultCPUAllocator: can't allocate memory: you tried to allocate ",
@@ -75,6 +137,17 @@ void* alloc_cpu(size_t nbytes) {
       nbytes,
       " bytes.");
 
+#ifdef C10_CPU_ALLOCATOR_HAS_THP
+  if (use_hugepages) {
+    // Best effort: the allocation stays usable with 4K pages if the
+    // kernel declines the hint.
+    if (madvise(data, nbytes, MADV_HUGEPAGE) == 0) {
+      g_hugepages_alloc_count.fetch_add(1, std::memory_order_relaxed);
+      g_hugepages_alloc_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+    }
+  }
+#endif
+
   // move data to a thread's NUMA node
   NUMAMove(data, nbytes, GetCurrentNUMANode());
   CHECK(
@@ -268,7 +341,9 @@ void ProfiledCPUMemoryReporter::New(void* ptr, size_t nbytes) {
   if (nbytes == 0) {
     return;
   }
-  auto profile_memory = memoryProfilingEnabled();
+  // Request tracing consumes the same reporting path as the memory
+  // profiler; see Note [Request trace].
+  auto profile_memory = memoryProfilingEnabled() || RequestTracer::active();
   size_t allocated = 0;
   if (FLAGS_caffe2_report_cpu_memory_usage || profile_memory) {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -288,7 +363,9 @@ void ProfiledCPUMemoryReporter::New(void* ptr, size_t nbytes) {
 
 void ProfiledCPUMemoryReporter::Delete(void* ptr) {
   size_t nbytes = 0;
-  auto profile_memory = memoryProfilingEnabled();
+  // Request tracing consumes the same reporting path as the memory
+  // profiler; see Note [Request trace].
+  auto profile_memory = memoryProfilingEnabled() || RequestTracer::active();
   size_t allocated = 0;
   if (FLAGS_caffe2_report_cpu_memory_usage || profile_memory) {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -11,6 +11,7 @@
 C10_DECLARE_bool(caffe2_report_cpu_memory_usage);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_zero_fill);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_junk_fill);
+C10_DECLARE_bool(caffe2_cpu_allocator_use_hugepages);
 
 namespace c10 {
 
@@ -37,6 +38,14 @@ C10_API void memset_junk(void* data, size_t num);
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
 
+// Counters for transparent-huge-page adoption by alloc_cpu (see the flag
+// caffe2_cpu_allocator_use_hugepages). madvise(MADV_HUGEPAGE) is only a
+// hint, so these count successfully advised allocations; the actual backing
+// depends on the kernel (see AnonHugePages in /proc/meminfo). Both return 0
+// on platforms without transparent huge page support.
+C10_API size_t GetHugePagesAllocCount();
+C10_API size_t GetHugePagesAllocBytes();
+
 // A simple struct that is used to report C10's memory allocation and
 // deallocation status to the profiler
 class C10_API ProfiledCPUMemoryReporter {
@@ -122,6 +122,9 @@ const char* toString(DispatchKey t) {
     case DispatchKey::Autocast:
       return "Autocast";
 
+    case DispatchKey::Memoize:
+      return "Memoize";
+
     case DispatchKey::Batched:
       return "Batched";
 
@@ -261,6 +264,7 @@ c10::DispatchKey parseDispatchKey(const std::string& k) {
       {"Tracer", c10::DispatchKey::Tracer},
       {"AutocastCPU", c10::DispatchKey::AutocastCPU},
       {"AutocastCUDA", c10::DispatchKey::AutocastCUDA},
+      {"Memoize", c10::DispatchKey::Memoize},
       {"FuncTorchBatched", c10::DispatchKey::FuncTorchBatched},
       {"FuncTorchVmapMode", c10::DispatchKey::FuncTorchVmapMode},
       {"Batched", c10::DispatchKey::Batched},
@@ -262,6 +262,11 @@ enum class DispatchKey : uint8_t {
   // autograd; for example, error checking, tracing, profiling or vmap.  They
   // go here.
 
+  // Memoization of allowlisted pure ops on provably-unmutated inputs.
+  // Toggled per-thread via at::memoize::set_enabled; see
+  // Note [Memoize mode] in aten/src/ATen/memoize_mode.cpp.
+  Memoize,
+
   FuncTorchBatched, // See Note [Out-of-tree vmap+grad prototype]
   FuncTorchVmapMode, // See Note [Out-of-tree vmap+grad prototype]
 
@@ -2,7 +2,9 @@
 
 #include <c10/core/Allocator.h>
 #include <c10/core/ScalarType.h>
+#include <c10/core/impl/COW.h>
 
+#include <c10/util/SmallObjectCache.h>
 #include <c10/util/intrusive_ptr.h>
 
 namespace c10 {
@@ -70,6 +72,21 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
   StorageImpl(const StorageImpl&) = delete;
   ~StorageImpl() override = default;
 
+  // Like TensorImpl, StorageImpl is a small control block allocated for
+  // every temporary tensor; route it through the thread-local
+  // small-object cache instead of the global heap.
+  static void* operator new(std::size_t nbytes) {
+    return c10::detail::alloc_small_object(nbytes);
+  }
+  static void operator delete(void* ptr, std::size_t nbytes) {
+    c10::detail::free_small_object(ptr, nbytes);
+  }
+  // Class-specific operator new hides global placement new; restore it.
+  static void* operator new(std::size_t, void* ptr) noexcept {
+    return ptr;
+  }
+  static void operator delete(void*, void*) noexcept {}
+
   void reset() {
     data_ptr_.clear();
     size_bytes_ = 0;
@@ -77,7 +94,7 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
 
   template <typename T>
   inline T* data() const {
-    return unsafe_data<T>();
+    return static_cast<T*>(data());
   }
 
   template <typename T>
@@ -103,10 +120,12 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
   };
 
   at::DataPtr& data_ptr() {
+    maybe_materialize_cow();
     return data_ptr_;
   };
 
   const at::DataPtr& data_ptr() const {
+    maybe_materialize_cow();
     return data_ptr_;
   };
 
@@ -122,13 +141,22 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
 
   // TODO: Return const ptr eventually if possible
   void* data() {
+    maybe_materialize_cow();
     return data_ptr_.get();
   }
 
   void* data() const {
+    maybe_materialize_cow();
     return data_ptr_.get();
   }
 
+  // True if this storage shares its buffer with other storages and will
+  // materialize a private copy on the next data access.  See
+  // Note [Copy-on-write storages].
+  bool is_cow() const {
+    return data_ptr_.get_deleter() == impl::cow::cow_deleter;
+  }
+
   at::DeviceType device_type() const {
     return data_ptr_.device().type();
   }
@@ -195,7 +223,20 @@ struct C10_API StorageImpl final : public c10::intrusive_ptr_target {
   }
 
  private:
-  DataPtr data_ptr_;
+  friend intrusive_ptr<StorageImpl> impl::cow::lazy_clone_storage(
+      StorageImpl& storage);
+
+  // See Note [Copy-on-write storages]: any data access first gives a
+  // copy-on-write storage its own buffer.
+  void maybe_materialize_cow() const {
+    if (C10_UNLIKELY(is_cow())) {
+      materialize_cow();
+    }
+  }
+  void materialize_cow() const;
+
+  // Mutable so that materialization can happen behind the const accessors.
+  mutable DataPtr data_ptr_;
   size_t size_bytes_;
   bool resizable_;
   // Identifies that Storage was received from another process and doesn't have
@@ -5,6 +5,7 @@
 #include <c10/core/WrapDimMinimal.h>
 #include <c10/core/impl/LocalDispatchKeySet.h>
 #include <c10/util/Optional.h>
+#include <c10/util/irange.h>
 
 C10_DEFINE_bool(
     caffe2_keep_on_shrink,
@@ -153,6 +154,27 @@ TensorImpl::TensorImpl(
   }
 }
 
+c10::intrusive_ptr<TensorImpl> TensorImpl::shallow_copy_with_strides(
+    IntArrayRef sizes,
+    IntArrayRef strides,
+    int64_t storage_offset) const {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(sizes.size() == strides.size());
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(storage_offset >= 0);
+  auto impl = c10::make_intrusive<TensorImpl>(
+      ImplType::VIEW, Storage(storage_), key_set_, data_type_);
+  // Write the geometry directly instead of going through the virtual
+  // set_sizes_and_strides: the impl is freshly created, so none of the
+  // customization or metadata-change checks can apply to it.
+  impl->sizes_and_strides_.set_sizes(sizes);
+  for (const auto d : c10::irange(sizes.size())) {
+    impl->sizes_and_strides_.stride_at_unchecked(d) = strides[d];
+  }
+  impl->storage_offset_ = storage_offset;
+  impl->refresh_numel();
+  impl->refresh_contiguous();
+  return impl;
+}
+
 TensorImpl::TensorImpl(
     DispatchKeySet key_set,
     const caffe2::TypeMeta data_type,
@@ -564,16 +586,8 @@ void TensorImpl::copy_tensor_metadata_except_version_counter(
   dest_impl->data_type_ = src_impl->data_type_;
   dest_impl->device_opt_ = src_impl->device_opt_;
   dest_impl->key_set_ = src_impl->key_set_.remove(DispatchKey::Python);
-  dest_impl->is_contiguous_ = src_impl->is_contiguous_;
+  dest_impl->contiguity_flags_ = src_impl->contiguity_flags_;
   dest_impl->has_contiguity_ = src_impl->has_contiguity_;
-  dest_impl->is_channels_last_contiguous_ =
-      src_impl->is_channels_last_contiguous_;
-  dest_impl->is_channels_last_3d_contiguous_ =
-      src_impl->is_channels_last_3d_contiguous_;
-  dest_impl->is_channels_last_ = src_impl->is_channels_last_;
-  dest_impl->is_channels_last_3d_ = src_impl->is_channels_last_3d_;
-  dest_impl->is_non_overlapping_and_dense_ =
-      src_impl->is_non_overlapping_and_dense_;
   dest_impl->is_wrapped_number_ = src_impl->is_wrapped_number_;
   dest_impl->reserved_ = src_impl->reserved_;
   dest_impl->set_allow_tensor_metadata_change(allow_tensor_metadata_change);
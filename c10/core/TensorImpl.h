@@ -18,6 +18,7 @@
 #include <c10/util/Flags.h>
 #include <c10/util/Logging.h>
 #include <c10/util/Optional.h>
+#include <c10/util/SmallObjectCache.h>
 #include <c10/util/accumulate.h>
 #include <c10/util/python_stub.h>
 
@@ -655,6 +656,24 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   TensorImpl(TensorImpl&&) = delete;
   TensorImpl& operator=(TensorImpl&&) = delete;
 
+  // TensorImpl (and its subclasses, which inherit these operators) is a
+  // small control block that temporaries create and destroy at very high
+  // rates, so it is allocated from the thread-local small-object cache
+  // rather than the global heap. The sized delete receives the
+  // most-derived size via the deleting destructor, so subclass blocks
+  // land in the right size class.
+  static void* operator new(std::size_t nbytes) {
+    return c10::detail::alloc_small_object(nbytes);
+  }
+  static void operator delete(void* ptr, std::size_t nbytes) {
+    c10::detail::free_small_object(ptr, nbytes);
+  }
+  // Class-specific operator new hides global placement new; restore it.
+  static void* operator new(std::size_t, void* ptr) noexcept {
+    return ptr;
+  }
+  static void operator delete(void*, void*) noexcept {}
+
   /**
    * Release (decref) storage, and any other external allocations.  This
    * override is for `intrusive_ptr_target` and is used to implement weak
@@ -789,13 +808,17 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
             static_cast<uint8_t>(HasContiguityPolicy::Default))) {
       return is_contiguous_nondefault_policy_impl(memory_format);
     }
-    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(compute_contiguous() == is_contiguous_);
-    if (memory_format == at::MemoryFormat::ChannelsLast) {
-      return is_channels_last_contiguous_;
-    } else if (memory_format == at::MemoryFormat::ChannelsLast3d) {
-      return is_channels_last_3d_contiguous_;
-    }
-    return is_contiguous_;
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        compute_contiguous() ==
+        static_cast<bool>(contiguity_flags_ & kFlagContiguous));
+    // See Note [Packed contiguity flags]: the shift table maps each memory
+    // format to its contiguity bit, replacing a branch chain over formats
+    // with a shift-and-mask. Preserve maps to bit 0, matching the previous
+    // fallthrough to the default-contiguity answer.
+    constexpr uint8_t kShiftForMemoryFormat[] = {0, 0, 1, 2};
+    return (contiguity_flags_ >>
+            kShiftForMemoryFormat[static_cast<uint8_t>(memory_format)]) &
+        1;
   }
 
  private:
@@ -921,6 +944,19 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     key_set_ = key_set_ - autograd_dispatch_keyset;
   }
 
+  // Converts this tensor into an inference tensor in place: strips the
+  // Autograd and ADInplaceOrView dispatch keys and disables the version
+  // counter, so that subsequent ops skip the autograd and view/version
+  // bookkeeping layers entirely, exactly as if the tensor had been created
+  // inside InferenceMode. The caller asserts that no autograd or view
+  // tracking involving this tensor is reachable anymore; use the checked
+  // torch::autograd::seal_inference_tensor() wrapper instead of calling
+  // this directly.
+  void seal_as_inference_tensor() {
+    key_set_ = key_set_ - autograd_dispatch_keyset_with_ADInplaceOrView;
+    version_counter_ = VariableVersion(VariableVersion::DISABLED);
+  }
+
   // Inference tensor doesn't have autograd or ADInplaceOrView key.
   // Invariant:
   //   Inference tensor has version_counter_.enabled() == false
@@ -1535,6 +1571,25 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
       c10::VariableVersion&& version_counter,
       bool allow_tensor_metadata_change) const;
 
+  /**
+   * Fast path for view creation: return a new TensorImpl that shares this
+   * one's storage, dtype and dispatch key set, but views it with the given
+   * sizes, strides and storage offset.
+   *
+   * This is reserved for backend view kernels: the key set is taken
+   * verbatim (as in the ImplType::VIEW constructor, so no dispatch key
+   * recomputation happens) and the geometry is written directly, so the
+   * caller must have validated that (sizes, strides, storage_offset) is in
+   * bounds for the storage.  The version counter is freshly created (or
+   * absent, for inference tensors) exactly as for any other view; the
+   * autograd layer replaces it with the base's counter when it sets up the
+   * view relationship.
+   */
+  c10::intrusive_ptr<TensorImpl> shallow_copy_with_strides(
+      IntArrayRef sizes,
+      IntArrayRef strides,
+      int64_t storage_offset) const;
+
   /**
    * Shallow-copies data from another TensorImpl into this TensorImpl.
    *
@@ -1710,7 +1765,7 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     TORCH_CHECK(sizes_and_strides_.size() >= 1u);
     TORCH_CHECK(num >= 0, "`num` must be non-negative for Extend");
     TORCH_CHECK(
-        is_contiguous_,
+        contiguity_flags_ & kFlagContiguous,
         "Right now Extend is only supported for contiguous Tensor.");
     using SizesVector = SmallVector<int64_t, 5>;
     SizesVector newDims(
@@ -1773,7 +1828,7 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   template <class T>
   void ReserveSpace(const T& outer_dim) {
     TORCH_CHECK(
-        is_contiguous_,
+        contiguity_flags_ & kFlagContiguous,
         "Right now ReserveSpace is only supported for contiguous Tensor.");
     TORCH_CHECK(
         storage_.unique(), "Can't call ReserveSpace on shared storage.");
@@ -1833,7 +1888,7 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
    */
   inline void Reshape(const std::vector<int64_t>& dims) {
     TORCH_CHECK(
-        is_contiguous_,
+        contiguity_flags_ & kFlagContiguous,
         "Right now Reshape is only supported for contiguous Tensor.");
     int64_t new_size = 1;
     for (auto d : dims) {
@@ -2113,15 +2168,15 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   }
 
   bool is_strides_like_channels_last() const {
-    return is_channels_last_;
+    return contiguity_flags_ & kFlagChannelsLast;
   }
 
   bool is_strides_like_channels_last_3d() const {
-    return is_channels_last_3d_;
+    return contiguity_flags_ & kFlagChannelsLast3d;
   }
 
   bool is_non_overlapping_and_dense() const {
-    return is_non_overlapping_and_dense_;
+    return contiguity_flags_ & kFlagNonOverlappingAndDense;
   }
 
  private:
@@ -2259,7 +2314,9 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
    * or strides.
    */
   void refresh_contiguous() {
-    is_contiguous_ = compute_contiguous();
+    // All predicates are assembled into a local byte and published with a
+    // single store; see Note [Packed contiguity flags].
+    uint8_t flags = compute_contiguous() ? kFlagContiguous : 0;
     // Note:
     // Dim 0, 1, 2 will never be a channels last 2d/3d format
     // Dim 3+ is possibly be a channels last 2d format (Dim 4 only at this
@@ -2267,38 +2324,50 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     // this point)
     switch (dim()) {
       case 4:
-        is_channels_last_contiguous_ = compute_channels_last_contiguous_2d();
-        is_channels_last_3d_contiguous_ = false;
-        is_channels_last_ = compute_strides_like_channels_last_2d();
-        is_channels_last_3d_ = false;
-        is_non_overlapping_and_dense_ = is_contiguous_ ||
-            is_channels_last_contiguous_ || compute_non_overlapping_and_dense();
+        if (compute_channels_last_contiguous_2d()) {
+          flags |= kFlagChannelsLastContiguous;
+        }
+        if (compute_strides_like_channels_last_2d()) {
+          flags |= kFlagChannelsLast;
+        }
+        if ((flags & (kFlagContiguous | kFlagChannelsLastContiguous)) ||
+            compute_non_overlapping_and_dense()) {
+          flags |= kFlagNonOverlappingAndDense;
+        }
         break;
       case 5:
-        is_channels_last_contiguous_ = compute_channels_last_contiguous_2d();
-        is_channels_last_3d_contiguous_ = !is_channels_last_contiguous_ &&
-            compute_channels_last_contiguous_3d();
-        is_channels_last_ = !is_channels_last_3d_contiguous_ &&
-            compute_strides_like_channels_last_2d();
-        is_channels_last_3d_ =
-            !is_channels_last_ && compute_strides_like_channels_last_3d();
-        is_non_overlapping_and_dense_ = is_contiguous_ ||
-            is_channels_last_contiguous_ || is_channels_last_3d_contiguous_ ||
-            compute_non_overlapping_and_dense();
+        if (compute_channels_last_contiguous_2d()) {
+          flags |= kFlagChannelsLastContiguous;
+        } else if (compute_channels_last_contiguous_3d()) {
+          flags |= kFlagChannelsLast3dContiguous;
+        }
+        if (!(flags & kFlagChannelsLast3dContiguous) &&
+            compute_strides_like_channels_last_2d()) {
+          flags |= kFlagChannelsLast;
+        }
+        if (!(flags & kFlagChannelsLast) &&
+            compute_strides_like_channels_last_3d()) {
+          flags |= kFlagChannelsLast3d;
+        }
+        if ((flags &
+             (kFlagContiguous | kFlagChannelsLastContiguous |
+              kFlagChannelsLast3dContiguous)) ||
+            compute_non_overlapping_and_dense()) {
+          flags |= kFlagNonOverlappingAndDense;
+        }
         break;
       default:
-        is_channels_last_contiguous_ = false;
-        is_channels_last_3d_contiguous_ = false;
-        // is_channels_last_ and is_channels_last_3d_ are suggested
+        // kFlagChannelsLast and kFlagChannelsLast3d are suggested
         // memory_format. Being channels_last_contiguous doesn't necessarily
         // mean the tensor is strided like channels_last: for strides on channel
         // dimension could suggest desired memory_layout, but it doesn't affect
         // memory storage
-        is_channels_last_ = false;
-        is_channels_last_3d_ = false;
-        is_non_overlapping_and_dense_ =
-            is_contiguous_ || compute_non_overlapping_and_dense();
+        if ((flags & kFlagContiguous) ||
+            compute_non_overlapping_and_dense()) {
+          flags |= kFlagNonOverlappingAndDense;
+        }
     }
+    contiguity_flags_ = flags;
   }
 
   /**
@@ -2358,7 +2427,8 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   // subclass customization while still being able to inline
   // is_contiguous() in the common case.
   enum class HasContiguityPolicy : uint8_t {
-    // Default behavior: check is_contiguous_ and similar bitflags.
+    // Default behavior: check contiguity_flags_; see
+    // Note [Packed contiguity flags].
     Default,
     // Throw a generic error message that this tensor type does not
     // support is_contiguous.
@@ -2469,8 +2539,42 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   // (which do not have a device.)
   c10::optional<c10::Device> device_opt_;
 
-  // Tensor is contiguous
-  bool is_contiguous_ : 1;
+  // Note [Packed contiguity flags]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // All cached layout predicates live in a single flags byte, assembled
+  // and published as a unit by refresh_contiguous() and copied as a unit
+  // by copy_tensor_metadata(). The low three bits are laid out so that
+  // is_contiguous(memory_format) is a shift-and-mask instead of a branch
+  // chain: MemoryFormat::Contiguous/ChannelsLast/ChannelsLast3d map to
+  // bits 0/1/2 via the shift table in is_contiguous().
+  enum : uint8_t {
+    // Tensor is laid out in contiguous memory; see compute_contiguous()
+    // for the exact definition.
+    kFlagContiguous = 1 << 0,
+    // Channels last contiguous tensor is channel last tensor which occupies
+    // contiguous memory block.
+    kFlagChannelsLastContiguous = 1 << 1,
+    // Channels last 3d contiguous tensor is channel last 3d tensor which
+    // occupies contiguous memory block.
+    kFlagChannelsLast3dContiguous = 1 << 2,
+    // Tensor is stored in the channels last 2d memory format, when
+    // dimensions order is (N)CHW and C-strides < W-strides < H-strides
+    // (< N-strides) (If size of any dimension is equal to 1, this
+    // dimension strides value is not taken into account).
+    kFlagChannelsLast = 1 << 3,
+    // Tensor is stored in the channels last 3d memory format, when
+    // dimensions order is (N)CDHW and C-strides < W-strides < H-strides
+    // < D-strides (< N-strides) (If size of any dimension is equal to 1,
+    // this dimension strides value is not taken into account).
+    kFlagChannelsLast3d = 1 << 4,
+    // Dense tensor is the tensor that store values in a contiguous block
+    // of memory. Non-overlapping tensor is the tensor in which elements
+    // occupy individual non-repetitive memory.
+    kFlagNonOverlappingAndDense = 1 << 5,
+  };
+
+  // Cached layout predicates; see Note [Packed contiguity flags].
+  uint8_t contiguity_flags_ : 6;
   // gcc doesn't like enum class bitfields; see
   // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=61414
   /* HasContiguityPolicy */ uint8_t has_contiguity_ : 2;
@@ -2481,14 +2585,9 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   // default member initializers for bit-fields only available with -std=c++2a
   // or -std=gnu++2a
   inline void init_bitfields() {
-    is_contiguous_ = true;
+    contiguity_flags_ = kFlagContiguous | kFlagNonOverlappingAndDense;
     has_contiguity_ = static_cast<uint8_t>(HasContiguityPolicy::Default);
 
-    is_channels_last_ = false;
-    is_channels_last_contiguous_ = false;
-    is_channels_last_3d_ = false;
-    is_channels_last_3d_contiguous_ = false;
-    is_non_overlapping_and_dense_ = true;
     is_wrapped_number_ = false;
     allow_tensor_metadata_change_ = true;
     reserved_ = false;
@@ -2496,31 +2595,6 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     storage_access_should_throw_ = false;
   }
 
-  // Tensor is stored in the channels last 2d memory format, when dimensions
-  // order is (N)CHW and C-strides < W-strides < H-strides (< N-strides)
-  // (If size of any dimension is equal to 1, this dimension strides value
-  // is not taken into account).
-  bool is_channels_last_ : 1;
-
-  // Channels last contiguous tensor is channel last tensor which occupies
-  // contiguous memory block.
-  bool is_channels_last_contiguous_ : 1;
-
-  // Tensor is stored in the channels last 3d memory format, when dimensions
-  // order is (N)CDHW and C-strides < W-strides < H-strides < D - strides (<
-  // N-strides) (If size of any dimension is equal to 1, this dimension strides
-  // value is not taken into account).
-  bool is_channels_last_3d_ : 1;
-
-  // Channels last 3d contiguous tensor is channel last 3d tensor which occupies
-  // contiguous memory block.
-  bool is_channels_last_3d_contiguous_ : 1;
-
-  // Dense tensor is the tensor that store values in a contiguous block of
-  // memory. Non-overlapping tensor is the tensor in which elements occupy
-  // individual non-repetitive memory.
-  bool is_non_overlapping_and_dense_ : 1;
-
   bool is_wrapped_number_ : 1;
 
   // NOTE [ Metadata Change for a Detached Tensor ]
@@ -0,0 +1,152 @@
+#include <c10/core/WorkStealingThreadPool.h>
+#include <c10/util/Logging.h>
+
+#include <chrono>
+
+namespace c10 {
+
+namespace {
+
+// Identifies the worker a pool thread belongs to, so run() can push to
+// the local deque when called from inside the pool.
+thread_local WorkStealingThreadPool* tls_pool = nullptr;
+thread_local std::size_t tls_worker_index = 0;
+
+// Idle workers re-scan all deques at this interval. Pushes notify their
+// target worker directly, so this only bounds how long a sleeping worker
+// can miss a steal opportunity from a queue backed up behind a long task.
+constexpr auto kIdleRescanInterval = std::chrono::milliseconds(1);
+
+} // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    int pool_size,
+    int numa_node_id,
+    std::function<void()> init_thread)
+    : threads_(pool_size < 0 ? defaultNumThreads() : pool_size),
+      running_(true),
+      next_queue_(0),
+      available_(0),
+      numa_node_id_(numa_node_id) {
+  workers_.reserve(threads_.size());
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    workers_.emplace_back(std::make_unique<Worker>());
+  }
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    threads_[i] = std::thread([this, i, init_thread]() {
+      if (init_thread) {
+        init_thread();
+      }
+      this->main_loop(i);
+    });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  running_ = false;
+  for (auto& worker : workers_) {
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    worker->cv.notify_all();
+  }
+  for (auto& t : threads_) {
+    try {
+      t.join();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
+size_t WorkStealingThreadPool::size() const {
+  return threads_.size();
+}
+
+size_t WorkStealingThreadPool::numAvailable() const {
+  return available_.load();
+}
+
+bool WorkStealingThreadPool::inThreadPool() const {
+  return tls_pool == this;
+}
+
+void WorkStealingThreadPool::run(std::function<void()> func) {
+  if (threads_.size() == 0) {
+    throw std::runtime_error("No threads to run a task");
+  }
+  std::size_t target;
+  if (tls_pool == this) {
+    // Submissions from a worker stay on its own deque and run LIFO, so
+    // recursively spawned subtasks execute while their data is cache-hot.
+    target = tls_worker_index;
+  } else {
+    target = next_queue_.fetch_add(1) % workers_.size();
+  }
+  auto& worker = *workers_[target];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(func));
+  }
+  worker.cv.notify_one();
+}
+
+bool WorkStealingThreadPool::try_pop_local(
+    std::size_t index,
+    std::function<void()>& task) {
+  auto& worker = *workers_[index];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.tasks.empty()) {
+    return false;
+  }
+  task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  return true;
+}
+
+bool WorkStealingThreadPool::try_steal(
+    std::size_t index,
+    std::function<void()>& task) {
+  const auto num_workers = workers_.size();
+  for (std::size_t offset = 1; offset < num_workers; ++offset) {
+    auto& victim = *workers_[(index + offset) % num_workers];
+    // try_lock so a steal attempt never blocks behind a busy victim; the
+    // next scan will get another chance.
+    std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || victim.tasks.empty()) {
+      continue;
+    }
+    // Steal the oldest task: it is the least likely to be cache-hot on
+    // the victim and the most likely to represent a large chunk of work.
+    task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+void WorkStealingThreadPool::main_loop(std::size_t index) {
+  tls_pool = this;
+  tls_worker_index = index;
+  auto& self = *workers_[index];
+  while (running_) {
+    std::function<void()> task;
+    if (try_pop_local(index, task) || try_steal(index, task)) {
+      try {
+        task();
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Exception in thread pool task: " << e.what();
+      } catch (...) {
+        LOG(ERROR) << "Exception in thread pool task: unknown";
+      }
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(self.mutex);
+    if (!self.tasks.empty() || !running_) {
+      continue;
+    }
+    ++available_;
+    self.cv.wait_for(lock, kIdleRescanInterval);
+    --available_;
+  }
+  tls_pool = nullptr;
+}
+
+} // namespace c10
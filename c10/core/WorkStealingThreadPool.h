@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <c10/core/thread_pool.h>
+
+namespace c10 {
+
+// A task pool with one deque per worker instead of ThreadPool's single
+// mutex-protected queue. Tasks submitted from outside the pool are
+// distributed round-robin; tasks submitted from a worker are pushed onto
+// that worker's own deque and popped LIFO (cache-hot). Idle workers steal
+// FIFO from the other deques, so irregular workloads (e.g. skewed
+// EmbeddingBag bag sizes) load-balance without every push/pop serializing
+// on one lock. Intended for fine-grained intra-op sections where the
+// central queue's wakeup latency and contention dominate; selectable as
+// the at::parallel_for backend via AT_PARALLEL_WORK_STEALING=1.
+class C10_API WorkStealingThreadPool : public TaskThreadPoolBase {
+ public:
+  WorkStealingThreadPool() = delete;
+
+  explicit WorkStealingThreadPool(
+      int pool_size,
+      int numa_node_id = -1,
+      std::function<void()> init_thread = nullptr);
+
+  ~WorkStealingThreadPool() override;
+
+  void run(std::function<void()> func) override;
+
+  size_t size() const override;
+
+  size_t numAvailable() const override;
+
+  bool inThreadPool() const override;
+
+ private:
+  struct Worker {
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+
+  void main_loop(std::size_t index);
+  bool try_pop_local(std::size_t index, std::function<void()>& task);
+  bool try_steal(std::size_t index, std::function<void()>& task);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::atomic_bool running_;
+  std::atomic<std::size_t> next_queue_;
+  std::atomic<std::size_t> available_;
+  int numa_node_id_;
+};
+
+} // namespace c10
@@ -0,0 +1,111 @@
+#include <c10/core/impl/COW.h>
+
+#include <c10/core/StorageImpl.h>
+#include <c10/util/Exception.h>
+
+#include <cstring>
+
+namespace c10 {
+namespace impl {
+namespace cow {
+
+Context::Context(DataPtr data) : data_(std::move(data)) {}
+
+void* Context::data() const {
+  return data_.get();
+}
+
+int64_t Context::refcount() const {
+  return refcount_.load(std::memory_order_acquire);
+}
+
+void Context::incref() {
+  refcount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Context::decref() {
+  if (refcount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+std::mutex& Context::mutex() {
+  return mutex_;
+}
+
+DataPtr Context::steal_data() {
+  return std::move(data_);
+}
+
+void cow_deleter(void* ctx) {
+  static_cast<Context*>(ctx)->decref();
+}
+
+intrusive_ptr<StorageImpl> lazy_clone_storage(StorageImpl& storage) {
+  // Materialization copies with memcpy, so only CPU storages qualify; an
+  // allocator is required to perform that copy later on.
+  if (storage.device_type() != DeviceType::CPU ||
+      storage.allocator() == nullptr) {
+    return intrusive_ptr<StorageImpl>();
+  }
+
+  DataPtr& data_ptr = storage.data_ptr_;
+  Context* ctx = nullptr;
+  if (storage.is_cow()) {
+    // Already sharing: just add an alias.
+    ctx = static_cast<Context*>(data_ptr.get_context());
+    ctx->incref();
+  } else {
+    // Only conventionally owned DataPtrs (context == data) can be wrapped;
+    // anything fancier (e.g. from_blob with a custom deleter context) would
+    // lose information in the round trip through the cow context.
+    if (data_ptr.get_context() != data_ptr.get()) {
+      return intrusive_ptr<StorageImpl>();
+    }
+    void* data = data_ptr.get();
+    Device device = data_ptr.device();
+    ctx = new Context(std::move(data_ptr));
+    ctx->incref(); // one reference for `storage`, one for the new alias
+    storage.data_ptr_ = DataPtr(data, ctx, cow_deleter, device);
+  }
+
+  return make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      storage.nbytes(),
+      DataPtr(ctx->data(), ctx, cow_deleter, storage.device()),
+      storage.allocator(),
+      storage.resizable());
+}
+
+} // namespace cow
+} // namespace impl
+
+void StorageImpl::materialize_cow() const {
+  auto* ctx = static_cast<impl::cow::Context*>(data_ptr_.get_context());
+  DataPtr old_ptr;
+  {
+    std::lock_guard<std::mutex> lock(ctx->mutex());
+    // Another thread may have materialized this storage while we waited.
+    if (data_ptr_.get_deleter() != impl::cow::cow_deleter) {
+      return;
+    }
+    DataPtr new_ptr;
+    if (ctx->refcount() == 1) {
+      // Sole remaining alias: take the buffer back without copying.
+      new_ptr = ctx->steal_data();
+    } else {
+      TORCH_INTERNAL_ASSERT(
+          allocator_ != nullptr,
+          "Cannot materialize a copy-on-write storage without an allocator");
+      new_ptr = allocator_->allocate(size_bytes_);
+      std::memcpy(new_ptr.get(), ctx->data(), size_bytes_);
+    }
+    old_ptr = std::move(data_ptr_);
+    data_ptr_ = std::move(new_ptr);
+  }
+  // Dropped outside the lock: releasing the last reference deletes the
+  // context, and with it the mutex.
+  old_ptr.clear();
+}
+
+} // namespace c10
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <c10/core/Allocator.h>
+#include <c10/macros/Macros.h>
+#include <c10/util/intrusive_ptr.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace c10 {
+
+struct StorageImpl;
+
+namespace impl {
+namespace cow {
+
+// Note [Copy-on-write storages]
+//
+// A copy-on-write storage is a StorageImpl whose DataPtr shares its buffer
+// with other storages instead of owning it.  The shared buffer lives in a
+// refcounted cow::Context; the DataPtr's context points at it and its deleter
+// is cow::cow_deleter, which is also how such storages are recognized.
+//
+// Because every data access in this codebase funnels through the StorageImpl
+// accessors without distinguishing reads from writes, a copy-on-write
+// storage materializes (obtains its own buffer) on the *first data access*,
+// not on the first mutation.  Materialization copies the shared buffer,
+// except when the accessing storage is the last remaining alias, in which
+// case it simply takes the buffer back without copying.  A lazy clone
+// therefore never performs more copies than an eager one, and performs none
+// at all when every alias but one is released untouched.
+//
+// Materialization of *different* aliases may race freely; the context's
+// refcount and mutex make that safe.  Accessing a *single* storage from
+// multiple threads while it materializes requires external synchronization,
+// the same as any other concurrent mutation of a tensor.
+
+// Shared state between all copy-on-write aliases of one buffer.  Keeps the
+// original DataPtr alive until the last alias either materializes or is
+// released.
+class C10_API Context {
+ public:
+  explicit Context(DataPtr data);
+
+  Context(const Context&) = delete;
+  Context& operator=(const Context&) = delete;
+
+  void* data() const;
+
+  // Number of aliases currently sharing the buffer.
+  int64_t refcount() const;
+
+  void incref();
+  // Drops one alias; deletes the context (and the buffer, unless it was
+  // stolen) when the last alias goes away.
+  void decref();
+
+  // Serializes materialization across aliases.
+  std::mutex& mutex();
+
+  // May only be called while this context is uniquely held: takes the
+  // original buffer back out of the context instead of copying it.
+  DataPtr steal_data();
+
+ private:
+  ~Context() = default;
+
+  DataPtr data_;
+  std::atomic<int64_t> refcount_{1};
+  std::mutex mutex_;
+};
+
+// The deleter installed on every copy-on-write DataPtr; its identity is how
+// such DataPtrs are recognized.
+C10_API void cow_deleter(void* ctx);
+
+// Returns a new storage aliasing `storage`'s buffer with copy-on-write
+// semantics, converting `storage` itself into a copy-on-write alias in the
+// process.  Returns nullptr if the storage cannot be lazily cloned: only CPU
+// storages with an allocator and a conventionally owned DataPtr qualify.
+C10_API intrusive_ptr<StorageImpl> lazy_clone_storage(StorageImpl& storage);
+
+} // namespace cow
+} // namespace impl
+} // namespace c10
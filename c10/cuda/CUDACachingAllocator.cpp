@@ -1,6 +1,7 @@
 
 #include <c10/cuda/CUDACachingAllocator.h>
 
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/cuda/CUDAGuard.h>
@@ -8,15 +9,28 @@
 #include <c10/util/irange.h>
 
 #include <cuda_runtime_api.h>
+
+#if !defined(USE_ROCM) && !defined(_WIN32) && defined(CUDA_VERSION) && \
+    CUDA_VERSION >= 11000
+#define PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+#include <cuda.h>
+#include <dlfcn.h>
+#endif
+
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <regex>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -108,6 +122,21 @@ constexpr size_t kRoundLarge = 2097152; // round up large allocations to 2 MiB
 
 typedef std::bitset<static_cast<size_t>(StatType::NUM_TYPES)> StatTypes;
 
+// Note [Allocator attribution]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// DeviceStats answer "how much is allocated" but not "who allocated it",
+// which is what actually matters when chasing an OOM. When a tagger is
+// installed (by a layer that can see the active RecordFunction or autograd
+// node; c10 cannot depend on those), each allocation evaluates it outside
+// the allocator lock and stamps the resulting tag onto the Block. Tag names
+// are interned per device allocator, blocks carry only an index plus the
+// correlation id, and per-tag byte/block counters (current and peak) are
+// maintained on the existing malloc/free paths under the device mutex.
+// snapshot() exposes per-block ownership and getTagStats() the aggregate
+// watermarks. With no tagger installed the cost is a single relaxed load
+// per allocation.
+std::atomic<AllocationTagger> allocation_tagger{nullptr};
+
 void update_stat(Stat& stat, int64_t amount) {
   stat.current += amount;
 
@@ -170,6 +199,12 @@ struct Block {
   Block* prev; // prev block if split from a larger allocation
   Block* next; // next block if split from a larger allocation
   int event_count; // number of outstanding CUDA events
+  // when the block last entered its pool; see Note [Oversize block trimming]
+  std::chrono::steady_clock::time_point cold_since;
+  // See Note [Allocator attribution]: index into the owning device
+  // allocator's tag table, -1 if the allocation was not tagged.
+  int64_t tag_index = -1;
+  uint64_t tag_correlation_id = 0;
 
   Block(
       int device,
@@ -267,6 +302,31 @@ struct AllocParams {
   cudaError_t err;
 };
 
+// Note [User memory pools]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The graph-private pools below are also useful outside of capture: when
+// several models share one device, one model's allocation bursts fragment
+// the common pools and evict the cached blocks its neighbors rely on.
+// createUserPool makes a named PrivatePool with an optional byte quota, and
+// bindPoolToStream routes every allocation made on a stream to that pool, so
+// each tenant caches and fragments only its own segments. get_pool prefers a
+// capture's pool over a stream binding, so CUDA graphs keep their guarantees
+// even on bound streams.
+//
+// The quota bounds cudaMalloc'ed bytes, not outstanding allocations: a pool
+// that reaches its quota reuses and frees its own cached segments before
+// reporting OOM, and never spills into the device-wide pools. emptyUserPool
+// returns one pool's cached segments to the driver without flushing the rest
+// of the device. releaseUserPool retires the pool the same way destroyed
+// graphs retire theirs: its memory is cudaFreed lazily once its blocks are
+// no longer referenced.
+//
+// User pool ids share the MempoolId_t space with CUDA graph pools. Captures
+// use {capture id, 0} and graph_pool_handle counts {0, uid} up from 1, so
+// user pools count {0, uid} down from the top to stay clear of both.
+std::atomic<CaptureId_t> user_pool_uid{
+    std::numeric_limits<CaptureId_t>::max()};
+
 // CUDA graphs helper
 struct PrivatePool {
   PrivatePool()
@@ -283,6 +343,13 @@ struct PrivatePool {
   // cudaMalloc_count drop to zero, we can delete this PrivatePool from
   // graph_pools.
   int cudaMalloc_count;
+  // See Note [User memory pools]. Set for pools made by createUserPool,
+  // empty for CUDA graph pools.
+  std::string name;
+  // Byte quota for user pools, bounding cudaMalloc_bytes. 0 means unlimited.
+  size_t quota = 0;
+  // Unfreed cudaMalloc'ed bytes held by this pool.
+  size_t cudaMalloc_bytes = 0;
   // Instead of maintaining private BlockPools here, I could stuff all blocks
   // (private or no) into the top-level large_blocks and small_blocks, and
   // distinguish private blocks by adding a "pool id" check above the stream
@@ -316,6 +383,184 @@ cudaError_t cudaMallocMaybeCapturing(void** p, size_t size) {
 #endif
 }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
+// The CUDA virtual memory management entry points live in libcuda (the
+// driver), which we deliberately don't link against: it's loaded at runtime
+// by the CUDA runtime whenever a GPU is present. Look the symbols up lazily
+// instead; if the driver is too old to have them, expandable segments just
+// stay disabled.
+struct DriverAPI {
+  // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PYTORCH_FORALL_DRIVER_API(_) \
+  _(cuMemAddressReserve)             \
+  _(cuMemAddressFree)                \
+  _(cuMemCreate)                     \
+  _(cuMemRelease)                    \
+  _(cuMemMap)                        \
+  _(cuMemUnmap)                      \
+  _(cuMemSetAccess)                  \
+  _(cuMemGetAllocationGranularity)
+
+#define PYTORCH_DECLARE_DRIVER_API(name) decltype(&name) name##_ = nullptr;
+  PYTORCH_FORALL_DRIVER_API(PYTORCH_DECLARE_DRIVER_API)
+#undef PYTORCH_DECLARE_DRIVER_API
+
+  bool available() const {
+    bool ok = true;
+#define PYTORCH_CHECK_DRIVER_API(name) ok = ok && name##_ != nullptr;
+    PYTORCH_FORALL_DRIVER_API(PYTORCH_CHECK_DRIVER_API)
+#undef PYTORCH_CHECK_DRIVER_API
+    return ok;
+  }
+
+  static DriverAPI* get() {
+    static DriverAPI api = []() {
+      DriverAPI a;
+      // RTLD_NOLOAD: if the driver isn't already loaded there is no GPU to
+      // allocate on anyway.
+      void* handle = dlopen("libcuda.so.1", RTLD_LAZY | RTLD_NOLOAD);
+      if (handle == nullptr) {
+        return a;
+      }
+#define PYTORCH_LOOKUP_DRIVER_API(name) \
+  a.name##_ = reinterpret_cast<decltype(&name)>(dlsym(handle, #name));
+      PYTORCH_FORALL_DRIVER_API(PYTORCH_LOOKUP_DRIVER_API)
+#undef PYTORCH_LOOKUP_DRIVER_API
+      return a;
+    }();
+    return &api;
+  }
+#undef PYTORCH_FORALL_DRIVER_API
+};
+
+// Note [Expandable segments]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With PYTORCH_CUDA_ALLOC_CONF=expandable_segments:True, large-pool
+// segments are carved out of one big virtual address range per stream,
+// reserved up front with cuMemAddressReserve and backed by physical pages
+// (cuMemCreate/cuMemMap) only as the segment grows. Each grow produces a
+// Block that is prev/next-linked to the previous tail, so once neighboring
+// extents are free they coalesce exactly like splits of a single cudaMalloc
+// segment. The effect is that a stream's large allocations share one
+// segment that grows in place instead of accumulating many differently
+// sized segments that can never merge, which is where the long-running
+// fragmentation ("20% free but unusable") comes from.
+//
+// The segment is returned to the driver (unmap + release + free the VA
+// range) when it has coalesced back into a single free block and the
+// allocator decides to release it (emptyCache, or OOM pressure).
+// Expandable memory cannot be exported over CUDA IPC, and the path is
+// skipped while a graph capture is underway, which is another reason the
+// knob is opt-in.
+struct ExpandableSegment {
+  ExpandableSegment(int device, size_t va_size) : device_(device) {
+    auto* api = DriverAPI::get();
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device_;
+    if (api->cuMemGetAllocationGranularity_(
+            &granularity_, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM) !=
+        CUDA_SUCCESS) {
+      return;
+    }
+    reserved_ = granularity_ * ((va_size + granularity_ - 1) / granularity_);
+    if (api->cuMemAddressReserve_(&ptr_, reserved_, 0ULL, 0, 0ULL) !=
+        CUDA_SUCCESS) {
+      ptr_ = 0;
+    }
+  }
+
+  ExpandableSegment(const ExpandableSegment&) = delete;
+  ExpandableSegment& operator=(const ExpandableSegment&) = delete;
+
+  bool valid() const {
+    return ptr_ != 0;
+  }
+
+  // Maps `size` more bytes (rounded up to the mapping granularity) at the
+  // end of the segment. On success *out_ptr/*out_size describe the new
+  // extent; on failure (range exhausted, or the driver is out of physical
+  // memory) the segment is left unchanged and the caller falls back to
+  // cudaMalloc.
+  bool grow(size_t size, void** out_ptr, size_t* out_size) {
+    auto* api = DriverAPI::get();
+    const size_t rounded =
+        granularity_ * ((size + granularity_ - 1) / granularity_);
+    if (mapped_ + rounded > reserved_) {
+      return false;
+    }
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = device_;
+    CUmemGenericAllocationHandle handle = 0;
+    if (api->cuMemCreate_(&handle, rounded, &prop, 0ULL) != CUDA_SUCCESS) {
+      return false;
+    }
+    const CUdeviceptr extent = ptr_ + mapped_;
+    if (api->cuMemMap_(extent, rounded, 0, handle, 0ULL) != CUDA_SUCCESS) {
+      api->cuMemRelease_(handle);
+      return false;
+    }
+    CUmemAccessDesc access = {};
+    access.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    access.location.id = device_;
+    access.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+    if (api->cuMemSetAccess_(extent, rounded, &access, 1) != CUDA_SUCCESS) {
+      api->cuMemUnmap_(extent, rounded);
+      api->cuMemRelease_(handle);
+      return false;
+    }
+    handles_.emplace_back(handle, rounded);
+    mapped_ += rounded;
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    *out_ptr = reinterpret_cast<void*>(extent);
+    *out_size = rounded;
+    return true;
+  }
+
+  ~ExpandableSegment() {
+    if (ptr_ == 0) {
+      return;
+    }
+    auto* api = DriverAPI::get();
+    if (mapped_ != 0) {
+      api->cuMemUnmap_(ptr_, mapped_);
+    }
+    for (const auto& handle : handles_) {
+      api->cuMemRelease_(handle.first);
+    }
+    api->cuMemAddressFree_(ptr_, reserved_);
+  }
+
+  static bool supported() {
+    return DriverAPI::get()->available();
+  }
+
+  // Number of separately mapped extents; each one was counted as a segment
+  // in the allocator stats when it was mapped.
+  size_t num_extents() const {
+    return handles_.size();
+  }
+
+  // Tail of the prev/next chain of Blocks carved out of this segment; the
+  // next grow links its Block after this one so free extents coalesce.
+  // Maintained by DeviceCachingAllocator (see try_merge_blocks).
+  Block* last_block = nullptr;
+
+ private:
+  int device_;
+  size_t granularity_ = 0;
+  CUdeviceptr ptr_ = 0;
+  size_t reserved_ = 0;
+  size_t mapped_ = 0;
+  std::vector<std::pair<CUmemGenericAllocationHandle, size_t>> handles_;
+};
+
+#endif // PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+
 } // namespace
 
 class CachingAllocatorConfig {
@@ -324,6 +569,26 @@ class CachingAllocatorConfig {
     return instance().m_max_split_size;
   }
 
+  static bool expandable_segments() {
+    return instance().m_expandable_segments;
+  }
+
+  static bool record_stream_epochs() {
+    return instance().m_record_stream_epochs;
+  }
+
+  static size_t trim_threshold() {
+    return instance().m_trim_threshold;
+  }
+
+  static int64_t trim_interval_ms() {
+    return instance().m_trim_interval_ms;
+  }
+
+  static bool trimming_enabled() {
+    return instance().m_trim_threshold != std::numeric_limits<size_t>::max();
+  }
+
  private:
   static std::once_flag s_flag;
   static CachingAllocatorConfig* s_instance;
@@ -337,8 +602,16 @@ class CachingAllocatorConfig {
   }
 
   CachingAllocatorConfig()
-      : m_max_split_size(std::numeric_limits<size_t>::max()) {}
+      : m_max_split_size(std::numeric_limits<size_t>::max()),
+        m_expandable_segments(false),
+        m_record_stream_epochs(false),
+        m_trim_threshold(std::numeric_limits<size_t>::max()),
+        m_trim_interval_ms(2000) {}
   size_t m_max_split_size;
+  bool m_expandable_segments;
+  bool m_record_stream_epochs;
+  size_t m_trim_threshold;
+  int64_t m_trim_interval_ms;
 
   void parseArgs() {
     const char* val = getenv("PYTORCH_CUDA_ALLOC_CONF");
@@ -368,6 +641,42 @@ class CachingAllocatorConfig {
             val2 = std::min(
                 val2, (std::numeric_limits<size_t>::max() / (1024 * 1024)));
             m_max_split_size = val2 * 1024 * 1024;
+          } else if (kv[0].compare("expandable_segments") == 0) {
+            /* See Note [Expandable segments]. Ignored (with a warning) when
+             * the build or the driver doesn't support the CUDA VMM APIs. */
+            m_expandable_segments = (kv[1].compare("True") == 0);
+#ifndef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+            if (m_expandable_segments) {
+              TORCH_WARN(
+                  "expandable_segments not supported in this build, ignoring");
+              m_expandable_segments = false;
+            }
+#endif
+          } else if (kv[0].compare("record_stream_epochs") == 0) {
+            /* See Note [Epoch-based cross-stream reclamation] */
+            m_record_stream_epochs = (kv[1].compare("True") == 0);
+          } else if (kv[0].compare("trim_threshold_mb") == 0) {
+            /* See Note [Oversize block trimming]. Cached blocks at least
+             * this large are released in the background once cold. */
+            size_t val2 = stoi(kv[1]);
+            TORCH_CHECK(
+                val2 > kLargeBuffer / (1024 * 1024),
+                "CachingAllocator option trim_threshold_mb too small, must be >= ",
+                kLargeBuffer / (1024 * 1024),
+                "");
+            val2 = std::max(val2, kLargeBuffer / (1024 * 1024));
+            val2 = std::min(
+                val2, (std::numeric_limits<size_t>::max() / (1024 * 1024)));
+            m_trim_threshold = val2 * 1024 * 1024;
+          } else if (kv[0].compare("trim_interval_ms") == 0) {
+            /* See Note [Oversize block trimming]. How long a block must sit
+             * unused before it is released, and how often the trimming
+             * thread wakes up. */
+            int64_t val2 = stoi(kv[1]);
+            TORCH_CHECK(
+                val2 > 0,
+                "CachingAllocator option trim_interval_ms must be positive");
+            m_trim_interval_ms = val2;
           } else {
             TORCH_CHECK(false, "Unrecognized CachingAllocator option: ", kv[0]);
           }
@@ -393,18 +702,67 @@ class DeviceCachingAllocator {
   // unallocated cached blocks 1 MB or smaller
   BlockPool small_blocks;
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // one growable large-pool segment per stream; see Note [Expandable
+  // segments]
+  std::unordered_map<cudaStream_t, std::unique_ptr<ExpandableSegment>>
+      expandable_segments_;
+#endif
+
   // allocated or in use by a stream. Holds all active allocations,
   // whether they came from graph_pools or one of the BlockPools above.
   std::unordered_set<Block*> active_blocks;
 
+  // See Note [Allocator attribution]: interned tag names and their
+  // per-tag aggregates, guarded by mutex. Entries are never removed, so
+  // Block::tag_index stays valid for the block's lifetime.
+  std::unordered_map<std::string, size_t> tag_indices;
+  std::vector<TagStats> tag_stats;
+
   // captures_underway tracks if a capture might be underway on any stream.
   // Most of the time it's zero, in which case malloc can avoid calling
   // cudaStreamGetCaptureInfo in the hot path.
   int captures_underway = 0;
   // See free() for this thing's purpose
   std::vector<Block*> needs_events_deferred_until_no_capture;
-  // outstanding cuda events
-  std::deque<std::pair<cudaEvent_t, Block*>> cuda_events;
+  // outstanding cuda events, tagged with the device each was recorded on
+  // (and must be returned to the event pool on)
+  struct OutstandingEvent {
+    cudaEvent_t event;
+    Block* block;
+    DeviceIndex device;
+  };
+  std::deque<OutstandingEvent> cuda_events;
+
+  // Note [Epoch-based cross-stream reclamation]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // By default every cross-stream block gets its own end-of-life event per
+  // stream it was used on (insert_events). Workloads with thousands of small
+  // cross-stream tensors per step (e.g. pipeline parallelism) then spend
+  // measurable time creating, querying and destroying events.
+  //
+  // With PYTORCH_CUDA_ALLOC_CONF=record_stream_epochs:True, freed
+  // cross-stream blocks are instead parked in a per-stream FIFO and a single
+  // event per stream is recorded at the next process_events() call, covering
+  // every block parked since the previous event -- one "epoch". When the
+  // epoch event completes, all blocks it covers are released at once, so
+  // event traffic scales with the number of streams rather than the number
+  // of blocks. The trade-off is reuse latency: a block waits for all work
+  // queued on the stream up to the epoch boundary, not just the work that
+  // used it.
+  struct StreamEpoch {
+    // blocks waiting on this stream's progress, oldest first
+    std::deque<Block*> waiting;
+    // number of blocks at the tail of `waiting` not yet covered by an event
+    size_t uncovered = 0;
+    // one event per epoch, with the number of waiting blocks it covers
+    std::deque<std::pair<cudaEvent_t, size_t>> events;
+  };
+  std::unordered_map<cuda::CUDAStream, StreamEpoch> stream_epochs;
+
+  // bumped by every malloc/free; the trimming thread uses it to tell idle
+  // devices from active ones. See Note [Oversize block trimming].
+  std::atomic<uint64_t> activity_epoch{0};
 
   // record used memory.
   size_t total_allocated_memory = 0;
@@ -429,6 +787,10 @@ class DeviceCachingAllocator {
   // in case we want multiple captures to share the same pool
   std::unordered_map<CaptureId_t, MempoolId_t> capture_to_pool_map;
 
+  // Maps a stream to the user pool serving its allocations.
+  // See Note [User memory pools].
+  std::unordered_map<cudaStream_t, MempoolId_t> stream_to_pool_map;
+
  public:
   DeviceCachingAllocator()
       : large_blocks(BlockComparator, /*is_small=*/false),
@@ -440,6 +802,16 @@ class DeviceCachingAllocator {
   // Thus, do not call a public method from another public method.
 
   Block* malloc(int device, size_t size, cudaStream_t stream) {
+    // Evaluate the tagger before taking the allocator lock; it may inspect
+    // arbitrary thread-local profiler state.
+    // See Note [Allocator attribution].
+    AllocationTag tag;
+    const AllocationTagger tagger =
+        allocation_tagger.load(std::memory_order_relaxed);
+    if (tagger) {
+      tag = tagger();
+    }
+    activity_epoch.fetch_add(1, std::memory_order_relaxed);
     std::unique_lock<std::recursive_mutex> lock(mutex);
 
     if (C10_LIKELY(captures_underway == 0)) {
@@ -455,7 +827,86 @@ class DeviceCachingAllocator {
       //    effect on memory use during capture should be small.
       process_events();
     }
+    return malloc_locked(device, size, stream, tagger ? &tag : nullptr);
+  }
+
+  // Allocates blocks for several sizes on the same stream while holding
+  // the allocator mutex only once. Callers that need several buffers at
+  // the same time (e.g. a fused kernel grabbing all of its scratch space
+  // up front) pay for a single lock acquisition and a single pass over
+  // outstanding events instead of contending on the mutex per buffer.
+  std::vector<Block*> malloc_batch(
+      int device,
+      const std::vector<size_t>& sizes,
+      cudaStream_t stream) {
+    // See Note [Allocator attribution]: one tag covers the whole batch.
+    AllocationTag tag;
+    const AllocationTagger tagger =
+        allocation_tagger.load(std::memory_order_relaxed);
+    if (tagger) {
+      tag = tagger();
+    }
+    activity_epoch.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::recursive_mutex> lock(mutex);
+
+    if (C10_LIKELY(captures_underway == 0)) {
+      process_events();
+    }
+
+    std::vector<Block*> blocks;
+    blocks.reserve(sizes.size());
+    try {
+      for (const auto size : sizes) {
+        blocks.push_back(
+            malloc_locked(device, size, stream, tagger ? &tag : nullptr));
+      }
+    } catch (...) {
+      // Don't leak the blocks allocated before the failure. free()
+      // re-acquires the mutex, so release it first.
+      lock.unlock();
+      for (Block* block : blocks) {
+        free(block);
+      }
+      throw;
+    }
+    return blocks;
+  }
+
+ private:
+  // See Note [Allocator attribution]. Both run under the device mutex.
+  void tag_block(Block& block, const AllocationTag& tag) {
+    size_t index = 0;
+    auto it = tag_indices.find(tag.name);
+    if (it == tag_indices.end()) {
+      index = tag_stats.size();
+      tag_indices.emplace(tag.name, index);
+      tag_stats.emplace_back();
+      tag_stats.back().name = tag.name;
+    } else {
+      index = it->second;
+    }
+    block.tag_index = static_cast<int64_t>(index);
+    block.tag_correlation_id = tag.correlation_id;
+    update_stat(tag_stats[index].bytes, static_cast<int64_t>(block.size));
+    update_stat(tag_stats[index].blocks, 1);
+  }
+
+  void untag_block(Block& block, size_t orig_size) {
+    auto& entry = tag_stats[block.tag_index];
+    update_stat(entry.bytes, -static_cast<int64_t>(orig_size));
+    update_stat(entry.blocks, -1);
+    block.tag_index = -1;
+    block.tag_correlation_id = 0;
+  }
 
+  // Body of malloc, split out so malloc_batch can allocate several blocks
+  // under one lock acquisition. The caller must hold the allocator mutex
+  // and have already processed outstanding events.
+  Block* malloc_locked(
+      int device,
+      size_t size,
+      cudaStream_t stream,
+      const AllocationTag* tag = nullptr) {
     size = round_size(size);
     auto& pool = get_pool(size, stream);
     const size_t alloc_size = get_allocation_size(size);
@@ -473,6 +924,12 @@ class DeviceCachingAllocator {
         // Free enough available cached blocks to satisfy alloc and retry alloc.
         ||
         (release_available_cached_blocks(params) && alloc_block(params, false))
+        // For user pools, free the pool's own cached blocks and retry alloc.
+        // A device-wide flush can't lower the pool's quota usage, this can.
+        // See Note [User memory pools].
+        || (pool.owner_PrivatePool && !pool.owner_PrivatePool->name.empty() &&
+            release_user_pool_cached_blocks(pool.owner_PrivatePool) &&
+            alloc_block(params, true))
         // Free all non-split cached blocks and retry alloc.
         || (release_cached_blocks() && alloc_block(params, true));
 
@@ -490,6 +947,14 @@ class DeviceCachingAllocator {
         allowed_info = format_size(allowed_memory_maximum) + " allowed; ";
       }
 
+      // See Note [User memory pools]
+      std::string pool_info;
+      if (pool.owner_PrivatePool && pool.owner_PrivatePool->quota != 0) {
+        pool_info = format_size(pool.owner_PrivatePool->cudaMalloc_bytes) +
+            " reserved of " + format_size(pool.owner_PrivatePool->quota) +
+            " quota in pool \"" + pool.owner_PrivatePool->name + "\"; ";
+      }
+
       stats.num_ooms += 1;
 
       // "total capacity": total global memory on GPU
@@ -527,6 +992,7 @@ class DeviceCachingAllocator {
           format_size(device_free),
           " free; ",
           allowed_info,
+          pool_info,
           format_size(
               stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)]
                   .current),
@@ -587,6 +1053,9 @@ class DeviceCachingAllocator {
     update_stat_array(stats.active_bytes, block->size, params.stat_types);
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, 1);
+    if (tag != nullptr) {
+      tag_block(*block, *tag);
+    }
 
     c10::reportMemoryUsageToProfiler(
         block->ptr,
@@ -598,7 +1067,9 @@ class DeviceCachingAllocator {
     return block;
   }
 
+ public:
   void free(Block* block) {
+    activity_epoch.fetch_add(1, std::memory_order_relaxed);
     std::lock_guard<std::recursive_mutex> lock(mutex);
 
     block->allocated = false;
@@ -616,6 +1087,11 @@ class DeviceCachingAllocator {
     update_stat_array(stats.allocated_bytes, -block->size, {stat_types});
     if (block->size >= CachingAllocatorConfig::max_split_size())
       update_stat(stats.oversize_allocations, -1);
+    // Release the attribution before the block can be merged with neighbors.
+    // See Note [Allocator attribution].
+    if (block->tag_index >= 0) {
+      untag_block(*block, orig_block_size);
+    }
 
     if (!block->stream_uses.empty()) {
       if (C10_UNLIKELY(captures_underway)) {
@@ -681,6 +1157,61 @@ class DeviceCachingAllocator {
     release_cached_blocks();
   }
 
+  // Note [Oversize block trimming]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // A single outlier allocation (say, the attention score matrix of one
+  // unusually long request) leaves behind a cached block far larger than
+  // the steady-state working set. The block pins device memory until
+  // someone calls emptyCache(), which synchronizes outstanding events and
+  // flushes the whole cache - a periodic cliff in both latency and
+  // footprint.
+  //
+  // With PYTORCH_CUDA_ALLOC_CONF=trim_threshold_mb:<n>, a background
+  // thread (see THCCachingAllocator) instead releases such blocks
+  // incrementally: every trim_interval_ms it sweeps each device and
+  // cudaFrees cached, non-split large-pool blocks of at least
+  // trim_threshold_mb that have sat unused past an age deadline. The age
+  // requirement is the hysteresis: a block that keeps getting reused never
+  // ages past the deadline, so steady-state blocks stay cached and only
+  // truly cold outliers are returned. On a device whose allocator was
+  // quiescent for the whole interval the deadline is a single interval;
+  // on an active device it is stretched several-fold, so trimming yields
+  // to foreground traffic but a cold outlier is still released eventually.
+  //
+  // No stream synchronization is needed: a block is only ever inserted
+  // into its pool after its end-of-life events completed (free_block
+  // asserts event_count == 0), so everything the trim thread frees is
+  // already quiescent on the device.
+
+  // Returns how many bytes were trimmed. `now` is passed in so one
+  // timestamp covers all devices in a sweep.
+  size_t trimCachedBlocks(
+      std::chrono::steady_clock::time_point now,
+      std::chrono::milliseconds min_age) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (captures_underway) {
+      // cudaFree is illegal during CUDA graph capture; skip this sweep.
+      return 0;
+    }
+    size_t trimmed = 0;
+    auto it = large_blocks.blocks.begin();
+    while (it != large_blocks.blocks.end()) {
+      Block* block = *it;
+      ++it;
+      if (!block->is_split() &&
+          block->size >= CachingAllocatorConfig::trim_threshold() &&
+          now - block->cold_since >= min_age) {
+        trimmed += block->size;
+        release_block(block);
+      }
+    }
+    return trimmed;
+  }
+
+  uint64_t activityEpoch() const {
+    return activity_epoch.load(std::memory_order_relaxed);
+  }
+
   /** Retrieves info (total size + largest block) of the memory cache **/
   void cacheInfo(size_t* total, size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -705,6 +1236,13 @@ class DeviceCachingAllocator {
     return stats;
   }
 
+  /** Returns a copy of the per-tag attribution aggregates.
+   *  See Note [Allocator attribution]. **/
+  std::vector<TagStats> getTagStats() const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return tag_stats;
+  }
+
   /** Resets the historical accumulation stats for the device **/
   void resetAccumulatedStats() {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -773,6 +1311,12 @@ class DeviceCachingAllocator {
         block_info.allocated = block->allocated;
         block_info.active = block->allocated || (block->event_count > 0) ||
             !block->stream_uses.empty();
+        // See Note [Allocator attribution]
+        if (block->tag_index >= 0 &&
+            static_cast<size_t>(block->tag_index) < tag_stats.size()) {
+          block_info.tag = tag_stats[block->tag_index].name;
+          block_info.correlation_id = block->tag_correlation_id;
+        }
 
         segment_info.total_size += block_info.size;
         if (block_info.allocated) {
@@ -863,6 +1407,78 @@ class DeviceCachingAllocator {
     }
   }
 
+  // See Note [User memory pools]
+
+  MempoolId_t createUserPool(const std::string& name, size_t quota) {
+    TORCH_CHECK(!name.empty(), "CUDA memory pool name must be non-empty");
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    MempoolId_t mempool_id{0, user_pool_uid--};
+    auto pool = std::make_unique<PrivatePool>();
+    pool->name = name;
+    pool->quota = quota;
+    graph_pools.emplace(mempool_id, std::move(pool));
+    return mempool_id;
+  }
+
+  void bindPoolToStream(MempoolId_t mempool_id, cudaStream_t stream) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(
+        it != graph_pools.end() && !it->second->name.empty(),
+        "mempool_id does not name a pool created by createUserPool");
+    TORCH_CHECK(
+        it->second->use_count > 0,
+        "cannot bind a stream to released CUDA memory pool \"",
+        it->second->name,
+        "\"");
+    // Rebinding is allowed; the last binding wins. Blocks already cached in
+    // the previous pool stay there.
+    stream_to_pool_map[stream] = mempool_id;
+  }
+
+  void releaseUserPool(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(
+        it != graph_pools.end() && !it->second->name.empty(),
+        "mempool_id does not name a pool created by createUserPool");
+    TORCH_CHECK(
+        it->second->use_count > 0,
+        "CUDA memory pool \"",
+        it->second->name,
+        "\" was already released");
+    for (auto it0 = stream_to_pool_map.begin();
+         it0 != stream_to_pool_map.end();) {
+      if (it0->second == mempool_id) {
+        it0 = stream_to_pool_map.erase(it0);
+      } else {
+        ++it0;
+      }
+    }
+    // Mirrors notifyCaptureDestroy: the pool's memory is cudaFreed lazily by
+    // free_cached_blocks once its blocks fall out of use.
+    if (--(it->second->use_count) == 0) {
+      bool inserted =
+          graph_pools_freeable.insert({mempool_id, it->second.get()}).second;
+      TORCH_INTERNAL_ASSERT(inserted);
+    }
+  }
+
+  /** returns one pool's cached blocks to the system allocator without
+   *  flushing the rest of the device **/
+  void emptyUserPool(MempoolId_t mempool_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = graph_pools.find(mempool_id);
+    TORCH_CHECK(
+        it != graph_pools.end() && !it->second->name.empty(),
+        "mempool_id does not name a pool created by createUserPool");
+    release_user_pool_cached_blocks(it->second.get());
+    if (it->second->use_count == 0 && it->second->cudaMalloc_count == 0) {
+      graph_pools_freeable.erase(mempool_id);
+      graph_pools.erase(it);
+    }
+  }
+
  private:
   // All private methods do not acquire the allocator mutex.
 
@@ -913,6 +1529,8 @@ class DeviceCachingAllocator {
     // back into.
     bool inserted = pool.blocks.insert(block).second;
     TORCH_INTERNAL_ASSERT(inserted);
+    // See Note [Oversize block trimming]
+    block->cold_since = std::chrono::steady_clock::now();
 
     if (block->is_split()) {
       net_change_inactive_split_blocks += 1;
@@ -957,6 +1575,17 @@ class DeviceCachingAllocator {
     dst->size += subsumed_size;
     auto erased = pool.blocks.erase(src);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(erased == 1);
+
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    // If src was the tail extent of an expandable segment, dst is now the
+    // tail; see Note [Expandable segments].
+    auto it = expandable_segments_.find(src->stream);
+    if (it != expandable_segments_.end() && it->second &&
+        it->second->last_block == src) {
+      it->second->last_block = dst;
+    }
+#endif
+
     delete src;
 
     return subsumed_size;
@@ -989,6 +1618,21 @@ class DeviceCachingAllocator {
       }
     }
 #endif
+    // See Note [User memory pools]. A capture's pool takes precedence over
+    // the stream binding; the empty() check keeps the common case to a
+    // single branch.
+    if (C10_UNLIKELY(!stream_to_pool_map.empty())) {
+      auto it0 = stream_to_pool_map.find(stream);
+      if (it0 != stream_to_pool_map.end()) {
+        auto it1 = graph_pools.find(it0->second);
+        TORCH_INTERNAL_ASSERT(it1 != graph_pools.end());
+        if (size <= kSmallSize) {
+          return it1->second->small_blocks;
+        } else {
+          return it1->second->large_blocks;
+        }
+      }
+    }
     if (size <= kSmallSize) {
       return small_blocks;
     } else {
@@ -1047,6 +1691,57 @@ class DeviceCachingAllocator {
     return freed_memory;
   }
 
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+  // Grows (or lazily creates) this stream's expandable segment by `size`
+  // bytes and produces the new extent as p.block, linked behind the
+  // previous tail extent. See Note [Expandable segments]. Returns false if
+  // the segment can't grow, in which case alloc_block falls back to a
+  // plain cudaMalloc'ed segment.
+  bool expandable_alloc_block(AllocParams& p, size_t size) {
+    auto& segment = expandable_segments_[p.stream()];
+    if (!segment) {
+      if (!ExpandableSegment::supported()) {
+        return false;
+      }
+      size_t device_free = 0;
+      size_t device_total = 0;
+      if (cudaMemGetInfo(&device_free, &device_total) != cudaSuccess) {
+        cudaGetLastError();
+        return false;
+      }
+      // Reserving address space costs no memory; size the range so the
+      // segment can grow to the whole device.
+      segment = std::make_unique<ExpandableSegment>(p.device(), device_total);
+      if (!segment->valid()) {
+        segment.reset();
+        return false;
+      }
+    }
+
+    void* ptr = nullptr;
+    size_t mapped = 0;
+    if (!segment->grow(size, &ptr, &mapped)) {
+      return false;
+    }
+
+    total_allocated_memory += mapped;
+    Block* block = new Block(p.device(), p.stream(), mapped, p.pool, ptr);
+    // Chain the new extent to the previous tail so that, once both are
+    // free, try_merge_blocks coalesces them and the segment behaves as one
+    // growing allocation instead of many fragmenting ones.
+    if (segment->last_block != nullptr) {
+      block->prev = segment->last_block;
+      segment->last_block->next = block;
+    }
+    segment->last_block = block;
+    p.block = block;
+    p.err = cudaSuccess;
+    update_stat_array(stats.segment, 1, p.stat_types);
+    update_stat_array(stats.reserved_bytes, mapped, p.stat_types);
+    return true;
+  }
+#endif
+
   bool alloc_block(AllocParams& p, bool isRetry) {
     // Defensively checks for preexisting CUDA error state.
     C10_CUDA_CHECK(cudaGetLastError());
@@ -1062,7 +1757,27 @@ class DeviceCachingAllocator {
         total_allocated_memory + size > allowed_memory_maximum) {
       p.err = cudaErrorMemoryAllocation;
       return false;
-    } else {
+    }
+
+    // See Note [User memory pools]
+    auto* private_pool = p.pool->owner_PrivatePool;
+    if (private_pool && private_pool->quota != 0 &&
+        private_pool->cudaMalloc_bytes + size > private_pool->quota) {
+      p.err = cudaErrorMemoryAllocation;
+      return false;
+    }
+
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    // See Note [Expandable segments]. Graph captures use their private
+    // pools and must record plain cudaMallocs, so they bypass this path.
+    if (CachingAllocatorConfig::expandable_segments() &&
+        p.pool == &large_blocks && captures_underway == 0 &&
+        expandable_alloc_block(p, size)) {
+      return true;
+    }
+#endif
+
+    {
       p.err = cudaMallocMaybeCapturing(&ptr, size);
       if (p.err != cudaSuccess) {
         if (p.err == cudaErrorMemoryAllocation) {
@@ -1086,8 +1801,9 @@ class DeviceCachingAllocator {
     }
 
     if (p.pool->owner_PrivatePool) {
-      // The block is for a CUDA graph's PrivatePool.
+      // The block is for a CUDA graph's or a user's PrivatePool.
       p.pool->owner_PrivatePool->cudaMalloc_count++;
+      p.pool->owner_PrivatePool->cudaMalloc_bytes += size;
     }
 
     total_allocated_memory += size;
@@ -1171,15 +1887,61 @@ class DeviceCachingAllocator {
     return true;
   }
 
+  // See Note [User memory pools]. Returns one pool's unsplit cached blocks
+  // to the system allocator. This is safe for live user pools, unlike the
+  // graph pools release_cached_blocks must skip: captures are never served
+  // from a user pool (get_pool prefers the capture's pool), so no graph has
+  // baked in these addresses.
+  bool release_user_pool_cached_blocks(PrivatePool* pool) {
+    // Blocks with outstanding events can't be released; settle them first.
+    synchronize_and_free_events();
+    release_blocks(pool->small_blocks);
+    release_blocks(pool->large_blocks);
+    return true;
+  }
+
   void release_block(Block* block) {
+#ifdef PYTORCH_EXPANDABLE_SEGMENTS_SUPPORTED
+    {
+      // A non-split block that is the tail of an expandable segment is the
+      // whole, fully coalesced segment; return it through the VMM APIs
+      // instead of cudaFree. See Note [Expandable segments].
+      auto it = expandable_segments_.find(block->stream);
+      if (it != expandable_segments_.end() && it->second &&
+          it->second->last_block == block) {
+        TORCH_INTERNAL_ASSERT(!block->is_split());
+        total_allocated_memory -= block->size;
+
+        StatTypes stat_types;
+        stat_types[static_cast<size_t>(StatType::AGGREGATE)] = true;
+        stat_types[static_cast<size_t>(get_stat_type_for_pool(*block->pool))] =
+            true;
+        update_stat_array(
+            stats.segment,
+            -static_cast<int64_t>(it->second->num_extents()),
+            stat_types);
+        update_stat_array(stats.reserved_bytes, -block->size, stat_types);
+
+        block->pool->blocks.erase(block);
+        delete block;
+        // unmaps, releases the handles and frees the reserved range
+        expandable_segments_.erase(it);
+        return;
+      }
+    }
+#endif
     C10_CUDA_CHECK(cudaFree((void*)block->ptr));
     total_allocated_memory -= block->size;
 
     auto* pool = block->pool;
     if (pool->owner_PrivatePool) {
-      // The cudaFreed block belonged to a CUDA graph's PrivatePool.
+      // The cudaFreed block belonged to a CUDA graph's or a user's
+      // PrivatePool.
       TORCH_INTERNAL_ASSERT(pool->owner_PrivatePool->cudaMalloc_count > 0);
       pool->owner_PrivatePool->cudaMalloc_count--;
+      TORCH_INTERNAL_ASSERT(
+          pool->owner_PrivatePool->cudaMalloc_bytes >= block->size);
+      pool->owner_PrivatePool->cudaMalloc_bytes -= block->size;
     }
 
     StatTypes stat_types;
@@ -1206,14 +1968,17 @@ class DeviceCachingAllocator {
     }
   }
 
-  cudaEvent_t create_event_internal() {
-    cudaEvent_t event;
-    C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
-    return event;
+  // End-of-life events cycle through the global per-device event pool
+  // instead of cudaEventCreate/cudaEventDestroy per use; see Note [CUDA
+  // event pool]. The caller must have `device` active when acquiring
+  // (true at every call site, which records on a stream of that device
+  // right after).
+  cudaEvent_t create_event_internal(DeviceIndex device) {
+    return getEventFromPool(device);
   }
 
-  void free_event_internal(cudaEvent_t event) {
-    C10_CUDA_CHECK(cudaEventDestroy(event));
+  void free_event_internal(DeviceIndex device, cudaEvent_t event) {
+    returnEventToPool(device, event);
   }
 
   void synchronize_and_free_events() {
@@ -1225,11 +1990,11 @@ class DeviceCachingAllocator {
     insert_events_deferred_until_no_capture();
 
     for (auto& e : cuda_events) {
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
+      cudaEvent_t event = e.event;
+      Block* block = e.block;
 
       C10_CUDA_CHECK(cudaEventSynchronize(event));
-      free_event_internal(event);
+      free_event_internal(e.device, event);
 
       block->event_count--;
       if (block->event_count == 0) {
@@ -1238,9 +2003,53 @@ class DeviceCachingAllocator {
     }
 
     cuda_events.clear();
+
+    // Drain the epoch queues as well: seal outstanding epochs, then wait on
+    // each epoch event instead of polling it.
+    if (C10_UNLIKELY(CachingAllocatorConfig::record_stream_epochs())) {
+      int prev_device = -1;
+      for (auto& entry : stream_epochs) {
+        const auto& stream = entry.first;
+        auto& epoch = entry.second;
+        if (epoch.uncovered > 0) {
+          if (prev_device == -1) {
+            C10_CUDA_CHECK(cudaGetDevice(&prev_device));
+          }
+          C10_CUDA_CHECK(cudaSetDevice(stream.device_index()));
+          cudaEvent_t event = create_event_internal(stream.device_index());
+          C10_CUDA_CHECK(cudaEventRecord(event, stream.stream()));
+          epoch.events.emplace_back(event, epoch.uncovered);
+          epoch.uncovered = 0;
+        }
+        for (auto& e : epoch.events) {
+          C10_CUDA_CHECK(cudaEventSynchronize(e.first));
+          free_event_internal(stream.device_index(), e.first);
+          retire_epoch_blocks(epoch, e.second);
+        }
+        epoch.events.clear();
+      }
+      if (prev_device != -1) {
+        C10_CUDA_CHECK(cudaSetDevice(prev_device));
+      }
+    }
   }
 
   void insert_events(Block* block) {
+    if (C10_UNLIKELY(CachingAllocatorConfig::record_stream_epochs())) {
+      // Park the block; the next process_events() records one event per
+      // stream for everything parked since the last one. See Note
+      // [Epoch-based cross-stream reclamation].
+      stream_set streams(std::move(block->stream_uses));
+      AT_ASSERT(block->stream_uses.empty());
+      for (auto& stream : streams) {
+        block->event_count++;
+        auto& epoch = stream_epochs[stream];
+        epoch.waiting.push_back(block);
+        epoch.uncovered++;
+      }
+      return;
+    }
+
     int prev_device;
     C10_CUDA_CHECK(cudaGetDevice(&prev_device));
 
@@ -1249,11 +2058,11 @@ class DeviceCachingAllocator {
     for (auto& stream : streams) {
       C10_CUDA_CHECK(cudaSetDevice(stream.device_index()));
 
-      cudaEvent_t event = create_event_internal();
+      cudaEvent_t event = create_event_internal(stream.device_index());
       C10_CUDA_CHECK(cudaEventRecord(event, stream.stream()));
 
       block->event_count++;
-      cuda_events.emplace_back(event, block);
+      cuda_events.push_back({event, block, stream.device_index()});
     }
 
     C10_CUDA_CHECK(cudaSetDevice(prev_device));
@@ -1269,9 +2078,66 @@ class DeviceCachingAllocator {
     }
   }
 
+  // Retires the `count` oldest blocks waiting on a stream's progress.
+  void retire_epoch_blocks(StreamEpoch& epoch, size_t count) {
+    for (C10_UNUSED const auto i : c10::irange(count)) {
+      Block* block = epoch.waiting.front();
+      epoch.waiting.pop_front();
+      block->event_count--;
+      if (block->event_count == 0) {
+        free_block(block);
+      }
+    }
+  }
+
+  // Seals the current epoch on every stream with newly parked blocks by
+  // recording a single covering event, then retires epochs whose events
+  // have completed. See Note [Epoch-based cross-stream reclamation].
+  void process_epoch_events() {
+    int prev_device = -1;
+    for (auto& entry : stream_epochs) {
+      const auto& stream = entry.first;
+      auto& epoch = entry.second;
+      if (epoch.uncovered > 0) {
+        if (prev_device == -1) {
+          C10_CUDA_CHECK(cudaGetDevice(&prev_device));
+        }
+        C10_CUDA_CHECK(cudaSetDevice(stream.device_index()));
+        cudaEvent_t event = create_event_internal(stream.device_index());
+        C10_CUDA_CHECK(cudaEventRecord(event, stream.stream()));
+        epoch.events.emplace_back(event, epoch.uncovered);
+        epoch.uncovered = 0;
+      }
+      while (!epoch.events.empty()) {
+        cudaEvent_t event = epoch.events.front().first;
+        size_t covered = epoch.events.front().second;
+
+        cudaError_t err = cudaEventQuery(event);
+        if (err == cudaErrorNotReady) {
+          // ignore and clear the error if not ready
+          cudaGetLastError();
+          break;
+        } else if (err != cudaSuccess) {
+          C10_CUDA_CHECK(err);
+        }
+
+        free_event_internal(stream.device_index(), event);
+        epoch.events.pop_front();
+        retire_epoch_blocks(epoch, covered);
+      }
+    }
+    if (prev_device != -1) {
+      C10_CUDA_CHECK(cudaSetDevice(prev_device));
+    }
+  }
+
   void process_events() {
     insert_events_deferred_until_no_capture();
 
+    if (C10_UNLIKELY(CachingAllocatorConfig::record_stream_epochs())) {
+      process_epoch_events();
+    }
+
     // Process outstanding cudaEvents. Events that are completed are removed
     // from the queue, and the 'event_count' for the corresponding allocation
     // is decremented. Stops at the first event which has not been completed.
@@ -1279,8 +2145,8 @@ class DeviceCachingAllocator {
     // the processing of some events may be delayed.
     while (!cuda_events.empty()) {
       auto& e = cuda_events.front();
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
+      cudaEvent_t event = e.event;
+      Block* block = e.block;
 
       cudaError_t err = cudaEventQuery(event);
       if (err == cudaErrorNotReady) {
@@ -1291,7 +2157,7 @@ class DeviceCachingAllocator {
         C10_CUDA_CHECK(err);
       }
 
-      free_event_internal(event);
+      free_event_internal(e.device, event);
 
       block->event_count--;
       if (block->event_count == 0) {
@@ -1328,7 +2194,80 @@ class THCCachingAllocator {
     allocated_blocks[block->ptr] = block;
   }
 
+  // See Note [Oversize block trimming]. The thread is started lazily by
+  // init() (only when trim_threshold_mb is configured) and joined by the
+  // destructor; trim_cv lets the destructor interrupt the sleep.
+  std::once_flag trim_thread_flag;
+  std::thread trim_thread;
+  std::mutex trim_mutex;
+  std::condition_variable trim_cv;
+  bool trim_stop = false;
+
+  void start_trim_thread() {
+    std::call_once(trim_thread_flag, [&] {
+      trim_thread = std::thread([this] { trim_loop(); });
+    });
+  }
+
+  void trim_loop() {
+    // Age deadline multiplier applied when the device allocator saw
+    // malloc/free traffic during the last interval; see Note [Oversize
+    // block trimming].
+    constexpr int64_t kActiveDeviceTrimIntervals = 5;
+    // Last observed activity epoch per device, to tell idle devices
+    // (trimmed after one interval) from active ones.
+    std::vector<uint64_t> last_epochs;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(trim_mutex);
+        trim_cv.wait_for(
+            lock,
+            std::chrono::milliseconds(
+                CachingAllocatorConfig::trim_interval_ms()),
+            [&] { return trim_stop; });
+        if (trim_stop) {
+          return;
+        }
+      }
+      // The thread is started at the end of init(), after device_allocator
+      // was sized to the (fixed) device count, so reading the vector here
+      // without the map mutex is safe.
+      const size_t device_count = device_allocator.size();
+      if (last_epochs.size() < device_count) {
+        last_epochs.resize(device_count, 0);
+      }
+      const auto now = std::chrono::steady_clock::now();
+      for (const auto i : c10::irange(device_count)) {
+        DeviceCachingAllocator* da = device_allocator[i].get();
+        if (!da) {
+          continue;
+        }
+        const uint64_t epoch = da->activityEpoch();
+        const bool idle = epoch == last_epochs[i];
+        last_epochs[i] = epoch;
+        const auto min_age = std::chrono::milliseconds(
+            CachingAllocatorConfig::trim_interval_ms() *
+            (idle ? 1 : kActiveDeviceTrimIntervals));
+        // Match emptyCache callers (e.g. torch.cuda.empty_cache), which
+        // hold the free mutex around cudaFree to avoid deadlocking NCCL.
+        std::lock_guard<std::mutex> lock(cuda_free_mutex);
+        da->trimCachedBlocks(now, min_age);
+      }
+    }
+  }
+
  public:
+  ~THCCachingAllocator() {
+    if (trim_thread.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(trim_mutex);
+        trim_stop = true;
+      }
+      trim_cv.notify_one();
+      trim_thread.join();
+    }
+  }
+
   std::vector<std::unique_ptr<DeviceCachingAllocator>> device_allocator;
 
   std::mutex* getCudaFreeMutex() const {
@@ -1356,6 +2295,10 @@ class THCCachingAllocator {
         device_allocator[i] = std::make_unique<DeviceCachingAllocator>();
       }
     }
+    if (CachingAllocatorConfig::trimming_enabled()) {
+      // See Note [Oversize block trimming]
+      start_trim_thread();
+    }
   }
 
   /** allocates a block which is safe to use from the provided stream */
@@ -1370,6 +2313,34 @@ class THCCachingAllocator {
     *devPtr = (void*)block->ptr;
   }
 
+  /** allocates one block per entry of sizes, all safe to use from the
+   *  provided stream, taking the device allocator lock only once */
+  void mallocBatch(
+      std::vector<void*>& devPtrs,
+      int device,
+      const std::vector<size_t>& sizes,
+      cudaStream_t stream) {
+    TORCH_INTERNAL_ASSERT(
+        0 <= device && static_cast<size_t>(device) < device_allocator.size(),
+        "Allocator not initialized for device ",
+        device,
+        ": did you call init?");
+    std::vector<Block*> blocks =
+        device_allocator[device]->malloc_batch(device, sizes, stream);
+    {
+      // register the whole batch under a single pass over the map lock
+      std::lock_guard<std::mutex> lock(mutex);
+      for (Block* block : blocks) {
+        allocated_blocks[block->ptr] = block;
+      }
+    }
+    devPtrs.clear();
+    devPtrs.reserve(blocks.size());
+    for (Block* block : blocks) {
+      devPtrs.push_back(block->ptr);
+    }
+  }
+
   void free(void* ptr) {
     if (!ptr) {
       return;
@@ -1541,6 +2512,15 @@ DeviceStats getDeviceStats(int device) {
   return caching_allocator.device_allocator[device]->getStats();
 }
 
+void setAllocationTagger(AllocationTagger tagger) {
+  allocation_tagger.store(tagger, std::memory_order_relaxed);
+}
+
+std::vector<TagStats> getTagStats(int device) {
+  assertValidDevice(device);
+  return caching_allocator.device_allocator[device]->getTagStats();
+}
+
 void resetAccumulatedStats(int device) {
   assertValidDevice(device);
   caching_allocator.device_allocator[device]->resetAccumulatedStats();
@@ -1575,6 +2555,33 @@ void notifyCaptureDestroy(int device, MempoolId_t mempool_id) {
   caching_allocator.device_allocator[device]->notifyCaptureDestroy(mempool_id);
 }
 
+// User memory pools, see Note [User memory pools]
+MempoolId_t createUserPool(
+    int device,
+    const std::string& name,
+    size_t quota_bytes) {
+  assertValidDevice(device);
+  return caching_allocator.device_allocator[device]->createUserPool(
+      name, quota_bytes);
+}
+
+void bindPoolToStream(MempoolId_t mempool_id, cuda::CUDAStream stream) {
+  const auto device = static_cast<int>(stream.device_index());
+  assertValidDevice(device);
+  caching_allocator.device_allocator[device]->bindPoolToStream(
+      mempool_id, stream.stream());
+}
+
+void releaseUserPool(int device, MempoolId_t mempool_id) {
+  assertValidDevice(device);
+  caching_allocator.device_allocator[device]->releaseUserPool(mempool_id);
+}
+
+void emptyUserPool(int device, MempoolId_t mempool_id) {
+  assertValidDevice(device);
+  caching_allocator.device_allocator[device]->emptyUserPool(mempool_id);
+}
+
 //
 // In CUDA IPC, sender sends a tensor to receiver, getIpcDevPtr
 // is called by the receiving process to map the CUDA memory from the sending
@@ -1653,6 +2660,35 @@ void* raw_alloc_with_stream(size_t nbytes, cudaStream_t stream) {
   return r;
 }
 
+std::vector<void*> raw_alloc_batch(
+    const std::vector<size_t>& nbytes,
+    cudaStream_t stream) {
+  std::vector<size_t> sizes;
+  sizes.reserve(nbytes.size());
+  for (const auto n : nbytes) {
+    if (n != 0) {
+      sizes.push_back(n);
+    }
+  }
+  std::vector<void*> ptrs;
+  if (!sizes.empty()) {
+    int device;
+    C10_CUDA_CHECK(cudaGetDevice(&device));
+    caching_allocator.mallocBatch(ptrs, device, sizes, stream);
+  }
+  if (sizes.size() == nbytes.size()) {
+    return ptrs;
+  }
+  // Zero-byte requests come back as nullptr, matching raw_alloc.
+  std::vector<void*> result;
+  result.reserve(nbytes.size());
+  auto it = ptrs.begin();
+  for (const auto n : nbytes) {
+    result.push_back(n == 0 ? nullptr : *it++);
+  }
+  return result;
+}
+
 void raw_delete(void* ptr) {
   caching_allocator.free(ptr);
 }
@@ -8,6 +8,7 @@
 
 #include <array>
 #include <mutex>
+#include <string>
 
 namespace c10 {
 
@@ -98,12 +99,40 @@ struct DeviceStats {
   int64_t max_split_size = 0;
 };
 
+// Attribution of an allocation to the op or module that made it.
+// See Note [Allocator attribution]. The tag is produced by a process-wide
+// tagger callback installed by higher layers that know about RecordFunction
+// and autograd nodes; c10 cannot depend on those directly. The tagger is
+// called on every allocation while installed and must not allocate device
+// memory itself.
+struct AllocationTag {
+  uint64_t correlation_id = 0;
+  std::string name;
+};
+
+using AllocationTagger = AllocationTag (*)();
+C10_CUDA_API void setAllocationTagger(AllocationTagger tagger);
+
+// Per-tag aggregates over allocations made while a tagger was installed;
+// `bytes.current`/`bytes.peak` give the live footprint and watermark of
+// each tag.
+struct TagStats {
+  std::string name;
+  Stat bytes;
+  Stat blocks;
+};
+C10_CUDA_API std::vector<TagStats> getTagStats(int device);
+
 // Struct containing info of an allocation block (i.e. a fractional part of a
 // cudaMalloc)..
 struct BlockInfo {
   int64_t size = 0;
   bool allocated = false;
   bool active = false;
+  // Attribution of the block's live allocation, if any.
+  // See Note [Allocator attribution].
+  uint64_t correlation_id = 0;
+  std::string tag;
 };
 
 // Struct containing info of a memory segment (i.e. one contiguous cudaMalloc).
@@ -119,6 +148,13 @@ struct SegmentInfo {
 
 C10_CUDA_API void* raw_alloc(size_t nbytes);
 C10_CUDA_API void* raw_alloc_with_stream(size_t nbytes, cudaStream_t stream);
+// Allocates one buffer per entry of nbytes, all safe to use from the given
+// stream, taking the allocator locks only once for the whole batch.
+// Zero-byte entries come back as nullptr. Each returned pointer is freed
+// individually with raw_delete.
+C10_CUDA_API std::vector<void*> raw_alloc_batch(
+    const std::vector<size_t>& nbytes,
+    cudaStream_t stream);
 C10_CUDA_API void raw_delete(void* ptr);
 
 C10_CUDA_API Allocator* get();
@@ -144,6 +180,24 @@ C10_CUDA_API void notifyCaptureBegin(
 C10_CUDA_API void notifyCaptureEnd(int device, CaptureId_t graph_id);
 C10_CUDA_API void notifyCaptureDestroy(int device, MempoolId_t mempool_id);
 
+// Named user memory pools, built on the same private-pool machinery CUDA
+// graphs use. A pool caches and fragments only its own segments, so
+// co-located workloads bound to different pools can't evict each other's
+// cached blocks. quota_bytes bounds the bytes cudaMalloc'ed for the pool
+// (0 = unlimited); allocations beyond it fail with CUDAOutOfMemoryError
+// after the pool's own cache has been flushed. releaseUserPool retires the
+// pool like a destroyed graph's: its memory is returned to the system
+// lazily once no longer referenced.
+C10_CUDA_API MempoolId_t
+createUserPool(int device, const std::string& name, size_t quota_bytes);
+// Routes all future allocations made on `stream` to the pool. A stream's
+// binding can be replaced by binding it again; the last binding wins.
+C10_CUDA_API void bindPoolToStream(MempoolId_t mempool_id, CUDAStream stream);
+C10_CUDA_API void releaseUserPool(int device, MempoolId_t mempool_id);
+// Returns the pool's cached segments to the system allocator without
+// flushing the rest of the device.
+C10_CUDA_API void emptyUserPool(int device, MempoolId_t mempool_id);
+
 C10_CUDA_API std::mutex* getFreeMutex();
 
 C10_CUDA_API std::shared_ptr<void> getIpcDevPtr(std::string handle);
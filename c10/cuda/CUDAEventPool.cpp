@@ -0,0 +1,58 @@
+#include <c10/cuda/CUDAEventPool.h>
+
+#include <c10/cuda/CUDAException.h>
+#include <c10/util/Exception.h>
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace c10 {
+namespace cuda {
+
+namespace {
+
+// One free list per device. The mutex guards a single vector push/pop;
+// event creation and destruction, which take a driver lock, only happen
+// while a list is dry (and never for destruction - see the note in the
+// header about teardown).
+struct PerDevicePool {
+  std::mutex mutex;
+  std::vector<cudaEvent_t> events;
+};
+
+PerDevicePool& pool_for(DeviceIndex device_index) {
+  // Intentionally leaked; see Note [CUDA event pool].
+  static auto* pools =
+      new std::array<PerDevicePool, C10_COMPILE_TIME_MAX_GPUS>();
+  TORCH_INTERNAL_ASSERT(
+      device_index >= 0 && device_index < C10_COMPILE_TIME_MAX_GPUS);
+  return (*pools)[device_index];
+}
+
+} // namespace
+
+cudaEvent_t getEventFromPool(DeviceIndex device_index) {
+  auto& pool = pool_for(device_index);
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (!pool.events.empty()) {
+      cudaEvent_t event = pool.events.back();
+      pool.events.pop_back();
+      return event;
+    }
+  }
+  // Lazily grow the pool outside the lock.
+  cudaEvent_t event;
+  C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  return event;
+}
+
+void returnEventToPool(DeviceIndex device_index, cudaEvent_t event) {
+  auto& pool = pool_for(device_index);
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  pool.events.push_back(event);
+}
+
+} // namespace cuda
+} // namespace c10
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/cuda/CUDAMacros.h>
+
+#include <cuda_runtime_api.h>
+
+namespace c10 {
+namespace cuda {
+
+// Note [CUDA event pool]
+// ~~~~~~~~~~~~~~~~~~~~~~
+// cudaEventCreateWithFlags / cudaEventDestroy take a driver-level lock, and
+// several hot paths (cross-device copy synchronization in at::cuda::CUDAEvent,
+// the caching allocator's end-of-life events) used to create and destroy an
+// event per use. At high op rates the create/destroy churn is visible in
+// driver traces. The global pool below keeps completed events on per-device
+// free lists, so steady-state event lifecycle is a list push/pop; the driver
+// is only involved when a free list runs dry and the pool lazily grows.
+//
+// All pooled events are created with cudaEventDisableTiming - callers that
+// need timing (or IPC-shared) events must create their own and must not
+// return them here. A returned event may still have a pending recording;
+// acquirers are expected to re-record before relying on its state, which
+// every current call site does. The pool is intentionally never torn down:
+// handing events back to the driver at process exit would race CUDA context
+// teardown.
+
+// Returns an event for `device_index`, reusing a pooled one when available.
+// When the pool has to create an event the caller must have `device_index`
+// active (recording on that device requires this anyway).
+C10_CUDA_API cudaEvent_t getEventFromPool(DeviceIndex device_index);
+
+// Returns `event` - which must have come from getEventFromPool for the same
+// device - to the free list.
+C10_CUDA_API void returnEventToPool(DeviceIndex device_index, cudaEvent_t event);
+
+} // namespace cuda
+} // namespace c10
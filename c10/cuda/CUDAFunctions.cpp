@@ -135,6 +135,18 @@ void set_device(DeviceIndex device) {
 }
 
 void device_synchronize() {
+  if (C10_UNLIKELY(RequestTracer::active())) {
+    const auto begin = std::chrono::steady_clock::now();
+    C10_CUDA_CHECK(cudaDeviceSynchronize());
+    RequestTracer::record(
+        RequestTraceEventKind::STREAM_SYNC,
+        /* arg0 */ 0, // whole-device sync, no particular stream
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count(),
+        Device(DeviceType::CUDA, current_device()));
+    return;
+  }
   C10_CUDA_CHECK(cudaDeviceSynchronize());
 }
 
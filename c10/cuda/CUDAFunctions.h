@@ -10,7 +10,10 @@
 #include <c10/core/Device.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAMacros.h>
+#include <c10/util/RequestTracer.h>
 #include <cuda_runtime_api.h>
+
+#include <chrono>
 namespace c10 {
 namespace cuda {
 
@@ -82,6 +85,20 @@ C10_CUDA_API void __inline__ stream_synchronize(cudaStream_t stream) {
           warning_state().get_sync_debug_mode() != SyncDebugMode::L_DISABLED)) {
     warn_or_error_on_sync();
   }
+  if (C10_UNLIKELY(RequestTracer::active())) {
+    // Stream waits are where host latency hides; put the wait (and how
+    // long it took) on the request timeline. See Note [Request trace].
+    const auto begin = std::chrono::steady_clock::now();
+    C10_CUDA_CHECK(cudaStreamSynchronize(stream));
+    RequestTracer::record(
+        RequestTraceEventKind::STREAM_SYNC,
+        reinterpret_cast<uint64_t>(stream),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count(),
+        Device(DeviceType::CUDA, current_device()));
+    return;
+  }
   C10_CUDA_CHECK(cudaStreamSynchronize(stream));
 }
 
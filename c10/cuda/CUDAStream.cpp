@@ -4,9 +4,12 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <iostream>
@@ -48,6 +51,30 @@ static cudaStream_t low_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
 static cudaStream_t high_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
                                          [kStreamsPerPool];
 
+// Note [Stream lanes]
+// ~~~~~~~~~~~~~~~~~~~
+// In addition to the two fixed pools above, users may register named "lanes":
+// extra stream pools with a caller-chosen size and priority (e.g. a small
+// high-priority lane for latency-critical work next to a large lane for
+// background prefetch).  Lanes must be registered before the first stream is
+// requested from the pool on any device; after that the topology is frozen,
+// so every device's pools are created from the same spec and lane streams can
+// be looked up without locking.  Like the fixed pools, lane streams are
+// created once per device and leaked, and are handed out round-robin.
+struct LaneSpec {
+  std::string name;
+  uint32_t num_streams;
+  int priority;
+};
+static std::mutex lane_mutex;
+static std::vector<LaneSpec> lane_specs;
+static bool lane_specs_frozen = false;
+static std::vector<std::vector<cudaStream_t>>
+    lane_streams[C10_COMPILE_TIME_MAX_GPUS];
+// deque: atomics are not movable, so they cannot live in a vector.
+static std::deque<std::atomic<uint32_t>>
+    lane_counters[C10_COMPILE_TIME_MAX_GPUS];
+
 // Note [StreamId assignment]
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // How do we assign stream IDs?
@@ -59,6 +86,8 @@ static cudaStream_t high_priority_streams[C10_COMPILE_TIME_MAX_GPUS]
 //  000 = default stream or externally allocated if id[63:3] != 0
 //  001 = low priority stream
 //  010 = high priority stream
+//  100 = lane stream; bits [3:10] index the stream within the lane and
+//        bits [11:18] identify the lane (see Note [Stream lanes])
 //
 // This is not really for efficiency; it's just easier to write the code
 // to extract the index if we do this with bitmasks :)
@@ -84,6 +113,7 @@ enum class StreamIdType : uint8_t {
   LOW = 0x1,
   HIGH = 0x2,
   EXT = 0x3,
+  LANE = 0x4,
 };
 
 std::ostream& operator<<(std::ostream& stream, StreamIdType s) {
@@ -100,6 +130,9 @@ std::ostream& operator<<(std::ostream& stream, StreamIdType s) {
     case StreamIdType::EXT:
       stream << "EXT";
       break;
+    case StreamIdType::LANE:
+      stream << "LANE";
+      break;
     default:
       stream << static_cast<uint8_t>(s);
       break;
@@ -132,6 +165,28 @@ StreamId makeStreamId(StreamIdType st, size_t si) {
       static_cast<StreamId>(st);
 }
 
+// Lane stream id layout, see Note [StreamId assignment]
+static constexpr int kLaneIndexBits = 8;
+static constexpr int kLaneIdBits = 8;
+static constexpr uint32_t kMaxStreamsPerLane = 1 << kLaneIndexBits;
+static constexpr size_t kMaxLanes = 1 << kLaneIdBits;
+
+StreamId makeLaneStreamId(size_t lane_id, size_t si) {
+  return (static_cast<StreamId>(lane_id) << (kStreamTypeBits + kLaneIndexBits)) |
+      (static_cast<StreamId>(si) << kStreamTypeBits) |
+      static_cast<StreamId>(StreamIdType::LANE);
+}
+
+static inline size_t laneIdOfStream(StreamId s) {
+  return static_cast<size_t>(
+      (s >> (kStreamTypeBits + kLaneIndexBits)) & ((1 << kLaneIdBits) - 1));
+}
+
+static inline size_t laneIndexOfStream(StreamId s) {
+  return static_cast<size_t>(
+      (s >> kStreamTypeBits) & ((1 << kLaneIndexBits) - 1));
+}
+
 // Thread-local current streams
 static thread_local std::unique_ptr<StreamId[]> current_streams = nullptr;
 
@@ -168,6 +223,30 @@ static void initDeviceStreamState(DeviceIndex device_index) {
 
   low_priority_counters[device_index] = 0;
   high_priority_counters[device_index] = 0;
+
+  // Creates the registered lane pools and freezes the lane topology so that
+  // later-initialized devices see the same spec.  See Note [Stream lanes].
+  std::lock_guard<std::mutex> guard(lane_mutex);
+  lane_specs_frozen = true;
+  int least_priority = 0;
+  int greatest_priority = 0;
+  C10_CUDA_CHECK(cudaDeviceGetStreamPriorityRange(
+      &least_priority, &greatest_priority));
+  lane_streams[device_index].resize(lane_specs.size());
+  for (const auto lane : c10::irange(lane_specs.size())) {
+    const auto& spec = lane_specs[lane];
+    // Note: lower numbers are higher priorities; clamp to what the device
+    // supports.
+    const auto priority =
+        std::max(greatest_priority, std::min(least_priority, spec.priority));
+    auto& streams = lane_streams[device_index][lane];
+    streams.resize(spec.num_streams);
+    for (const auto i : c10::irange(spec.num_streams)) {
+      C10_CUDA_CHECK(cudaStreamCreateWithPriority(
+          &streams[i], kDefaultFlags, priority));
+    }
+    lane_counters[device_index].emplace_back(0);
+  }
 }
 
 // Init front-end to ensure initialization only occurs once
@@ -233,6 +312,18 @@ cudaStream_t CUDAStream::stream() const {
       return high_priority_streams[device_index][si];
     case StreamIdType::EXT:
       return reinterpret_cast<cudaStream_t>(stream_id);
+    case StreamIdType::LANE: {
+      const auto lane_id = laneIdOfStream(stream_id);
+      const auto& lanes = lane_streams[device_index];
+      TORCH_INTERNAL_ASSERT(
+          lane_id < lanes.size(),
+          "Unrecognized stream ",
+          stream_,
+          " (the lane it refers to does not exist).",
+          " Did you manufacture the StreamId yourself?  Don't do that; use the",
+          " official API like c10::cuda::getStreamFromPool() to get a new stream.");
+      return lanes[lane_id][laneIndexOfStream(stream_id)];
+    }
     default:
       TORCH_INTERNAL_ASSERT(
           0,
@@ -268,6 +359,65 @@ CUDAStream getStreamFromPool(
   return CUDAStreamForId(device_index, makeStreamId(StreamIdType::LOW, idx));
 }
 
+void registerStreamPoolLane(
+    const std::string& lane,
+    int num_streams,
+    int priority) {
+  std::lock_guard<std::mutex> guard(lane_mutex);
+  TORCH_CHECK(
+      !lane_specs_frozen,
+      "Stream lanes must be registered before the first stream is requested "
+      "from the pool");
+  TORCH_CHECK(!lane.empty(), "Stream lane name must not be empty");
+  TORCH_CHECK(
+      num_streams > 0 &&
+          static_cast<uint32_t>(num_streams) <= kMaxStreamsPerLane,
+      "Stream lane size must be between 1 and ",
+      kMaxStreamsPerLane,
+      ", but got ",
+      num_streams);
+  TORCH_CHECK(
+      lane_specs.size() < kMaxLanes,
+      "Cannot register more than ",
+      kMaxLanes,
+      " stream lanes");
+  for (const auto& spec : lane_specs) {
+    TORCH_CHECK(
+        spec.name != lane, "Stream lane '", lane, "' is already registered");
+  }
+  lane_specs.push_back(
+      {lane, static_cast<uint32_t>(num_streams), priority});
+}
+
+CUDAStream getStreamFromPool(
+    const std::string& lane,
+    DeviceIndex device_index) {
+  initCUDAStreamsOnce();
+  if (device_index == -1) {
+    device_index = current_device();
+  }
+  check_gpu(device_index);
+
+  // Initializes the stream pools (once); this also freezes the lane specs,
+  // so they can be read below without taking lane_mutex.
+  std::call_once(
+      device_flags[device_index], initDeviceStreamState, device_index);
+
+  for (const auto lane_id : c10::irange(lane_specs.size())) {
+    if (lane_specs[lane_id].name == lane) {
+      const auto idx = lane_counters[device_index][lane_id]++ %
+          lane_specs[lane_id].num_streams;
+      return CUDAStreamForId(device_index, makeLaneStreamId(lane_id, idx));
+    }
+  }
+  TORCH_CHECK(
+      false,
+      "Unknown stream lane '",
+      lane,
+      "'; register it with c10::cuda::registerStreamPoolLane() before "
+      "requesting streams");
+}
+
 CUDAStream getStreamFromExternal(
     cudaStream_t ext_stream,
     DeviceIndex device_index) {
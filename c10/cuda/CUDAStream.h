@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 
 #include <cuda_runtime_api.h>
@@ -36,6 +37,13 @@
  * The third pool is the "high priority" streams. The third pool acts like
  * the second pool except the streams are created with a higher priority.
  *
+ * Beyond these fixed pools, named "lanes" may be registered at init time
+ * with registerStreamPoolLane: each lane is an extra pool with a
+ * caller-chosen size and priority, and streams are requested from it by
+ * name with getStreamFromPool(lane). Lanes let latency-critical work and
+ * background work draw from dedicated sets of streams instead of competing
+ * for the shared round-robin pools above.
+ *
  * These pools suggest that stream users should prefer many short-lived streams,
  * as the cost of acquiring and releasing streams is effectively zero. If
  * many longer-lived streams are required in performance critical scenarios
@@ -197,6 +205,36 @@ class C10_CUDA_API CUDAStream {
 TORCH_API CUDAStream
 getStreamFromPool(const bool isHighPriority = false, DeviceIndex device = -1);
 
+/**
+ * Register a named stream lane: an extra pool of num_streams streams created
+ * with the given CUDA priority (lower numbers are higher priorities; the
+ * value is clamped to the range the device supports).  Lanes must be
+ * registered before the first stream is requested from the pool on any
+ * device; the pool topology is frozen after that.
+ */
+TORCH_API void registerStreamPoolLane(
+    const std::string& lane,
+    int num_streams,
+    int priority);
+
+/**
+ * Get a new stream from the named lane, round-robin, creating the device's
+ * stream pools if this is the first stream requested for the device.  The
+ * lane must have been registered with registerStreamPoolLane.
+ */
+TORCH_API CUDAStream
+getStreamFromPool(const std::string& lane, DeviceIndex device = -1);
+
+/**
+ * Overload for string literals; without it, a const char* argument would
+ * convert to bool and silently select the priority-based overload above.
+ */
+inline CUDAStream getStreamFromPool(
+    const char* lane,
+    DeviceIndex device = -1) {
+  return getStreamFromPool(std::string(lane), device);
+}
+
 /**
  * Get a CUDAStream from a externally allocated one.
  *
@@ -0,0 +1,96 @@
+#include <c10/core/impl/COW.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/core/StorageImpl.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+namespace {
+
+using c10::StorageImpl;
+using c10::impl::cow::lazy_clone_storage;
+
+c10::intrusive_ptr<StorageImpl> make_storage(size_t nbytes) {
+  return c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      nbytes,
+      c10::GetCPUAllocator(),
+      /*resizable=*/true);
+}
+
+TEST(COWTest, LazyCloneAliasesUntilAccess) {
+  auto storage = make_storage(16);
+  void* data = storage->data();
+  std::memset(data, 1, 16);
+  ASSERT_FALSE(storage->is_cow());
+
+  auto alias = lazy_clone_storage(*storage);
+  ASSERT_TRUE(alias);
+  ASSERT_TRUE(storage->is_cow());
+  ASSERT_TRUE(alias->is_cow());
+
+  // The first data access of an alias materializes a private copy with the
+  // same contents.
+  void* alias_data = alias->data();
+  ASSERT_FALSE(alias->is_cow());
+  ASSERT_NE(alias_data, data);
+  ASSERT_TRUE(storage->is_cow());
+  EXPECT_EQ(std::memcmp(alias_data, data, 16), 0);
+
+  // Once materialized, the copies are independent.
+  std::memset(alias_data, 2, 16);
+
+  // The last remaining alias takes the original buffer back without copying.
+  void* storage_data = storage->data();
+  ASSERT_FALSE(storage->is_cow());
+  EXPECT_EQ(storage_data, data);
+  EXPECT_EQ(static_cast<char*>(storage_data)[0], 1);
+}
+
+TEST(COWTest, DroppedAliasNeverCopies) {
+  auto storage = make_storage(32);
+  void* data = storage->data();
+
+  auto alias = lazy_clone_storage(*storage);
+  ASSERT_TRUE(alias);
+  alias.reset();
+
+  // The alias was released untouched, so the original storage takes its
+  // buffer back without any copy.
+  EXPECT_EQ(storage->data(), data);
+  ASSERT_FALSE(storage->is_cow());
+}
+
+TEST(COWTest, RepeatedClonesAllAlias) {
+  auto storage = make_storage(8);
+  std::memset(storage->data(), 3, 8);
+
+  auto alias1 = lazy_clone_storage(*storage);
+  auto alias2 = lazy_clone_storage(*storage);
+  ASSERT_TRUE(alias1);
+  ASSERT_TRUE(alias2);
+
+  // Materializing one alias leaves the others sharing the original buffer.
+  void* data1 = alias1->data();
+  ASSERT_FALSE(alias1->is_cow());
+  ASSERT_TRUE(alias2->is_cow());
+  ASSERT_TRUE(storage->is_cow());
+  EXPECT_EQ(std::memcmp(data1, alias2->data(), 8), 0);
+}
+
+TEST(COWTest, IneligibleStoragesAreRejected) {
+  // A storage wrapping external memory (no allocator, custom deleter
+  // context) cannot be lazily cloned.
+  char buffer[8];
+  auto storage = c10::make_intrusive<StorageImpl>(
+      StorageImpl::use_byte_size_t(),
+      sizeof(buffer),
+      c10::DataPtr(buffer, c10::Device(c10::DeviceType::CPU)),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+  EXPECT_FALSE(lazy_clone_storage(*storage));
+}
+
+} // namespace
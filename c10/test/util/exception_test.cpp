@@ -103,3 +103,15 @@ TEST(ExceptionTest, DontCallArgumentFunctionsTwiceOnFailure) {
   EXPECT_EQ(assertionArgumentCounter, 2)
       << "TORCH_INTERNAL_ASSERT called argument twice";
 }
+
+// See Note [Lazy check messages]: when the condition holds, the message
+// arguments must not be evaluated at all.
+TEST(ExceptionTest, DontEvaluateArgumentsOnSuccess) {
+  assertionArgumentCounter = 0;
+  TORCH_CHECK(true, "message ", getAssertionArgument());
+  TORCH_INTERNAL_ASSERT(true, "message ", getAssertionArgument());
+  TORCH_CHECK_INDEX(true, "message ", getAssertionArgument());
+  TORCH_CHECK_VALUE(true, "message ", getAssertionArgument());
+  EXPECT_EQ(assertionArgumentCounter, 0)
+      << "check macro evaluated message arguments on success";
+}
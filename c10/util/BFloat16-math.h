@@ -15,6 +15,15 @@ inline c10::BFloat16 asin(c10::BFloat16 a) {
 inline c10::BFloat16 atan(c10::BFloat16 a) {
   return std::atan(float(a));
 }
+inline c10::BFloat16 acosh(c10::BFloat16 a) {
+  return std::acosh(float(a));
+}
+inline c10::BFloat16 asinh(c10::BFloat16 a) {
+  return std::asinh(float(a));
+}
+inline c10::BFloat16 atanh(c10::BFloat16 a) {
+  return std::atanh(float(a));
+}
 inline c10::BFloat16 erf(c10::BFloat16 a) {
   return std::erf(float(a));
 }
@@ -27,6 +36,9 @@ inline c10::BFloat16 exp(c10::BFloat16 a) {
 inline c10::BFloat16 expm1(c10::BFloat16 a) {
   return std::expm1(float(a));
 }
+inline c10::BFloat16 exp2(c10::BFloat16 a) {
+  return std::exp2(float(a));
+}
 inline c10::BFloat16 log(c10::BFloat16 a) {
   return std::log(float(a));
 }
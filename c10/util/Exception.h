@@ -368,6 +368,19 @@ C10_API std::string GetExceptionString(const std::exception& e);
 #else
 namespace c10 {
 namespace detail {
+// Note [Lazy check messages]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// TORCH_CHECK / TORCH_INTERNAL_ASSERT sites sit in hot code
+// (TensorIterator::build, Dispatcher::call), so on success they must be
+// branch-only: the message expression may only be evaluated inside the
+// C10_UNLIKELY failure branch.  The torchCheckMsgImpl overloads below keep
+// the common cases free of even cold-path string machinery: with no user
+// arguments the default message is a string literal passed through as
+// const char*, a single C-string argument is likewise passed through
+// unconverted, and only the general variadic case materializes a
+// std::string via c10::str (still only on failure).  If you touch these
+// macros, keep every argument evaluation behind the condition check; see
+// ExceptionTest.DontEvaluateArgumentsOnSuccess.
 template <typename... Args>
 decltype(auto) torchCheckMsgImpl(const char* msg, const Args&... args) {
   return ::c10::str(args...);
@@ -25,6 +25,28 @@ struct IncrementRAII final {
   C10_DISABLE_COPY_AND_ASSIGN(IncrementRAII);
 };
 
+// Reader counters are sharded so that concurrent readers on different
+// cores don't all bounce a single cache line on every read. This matters
+// for the dispatcher's operator lookup table, which is read from many
+// threads on every op call in steady state. Each thread is assigned a
+// shard round-robin; writers wait for *all* shards to drain, which keeps
+// the LeftRight algorithm unchanged.
+constexpr size_t kLeftRightNumReaderShards = 8;
+
+struct alignas(64) LeftRightReaderShard {
+  std::atomic<int32_t> counter{0};
+};
+
+using LeftRightReaderCounters =
+    std::array<LeftRightReaderShard, kLeftRightNumReaderShards>;
+
+inline size_t leftRightReaderShard() {
+  static std::atomic<size_t> nextShard{0};
+  static thread_local size_t shard =
+      nextShard.fetch_add(1) % kLeftRightNumReaderShards;
+  return shard;
+}
+
 } // namespace detail
 
 // LeftRight wait-free readers synchronization primitive
@@ -52,7 +74,7 @@ class LeftRight final {
  public:
   template <class... Args>
   explicit LeftRight(const Args&... args)
-      : _counters{{{0}, {0}}},
+      : _counters{},
         _foregroundCounterIndex(0),
         _foregroundDataIndex(0),
         _data{{T{args...}, T{args...}}},
@@ -70,7 +92,7 @@ class LeftRight final {
     { std::unique_lock<std::mutex> lock(_writeMutex); }
 
     // wait until any potentially running readers are finished
-    while (_counters[0].load() != 0 || _counters[1].load() != 0) {
+    while (_anyReaderActive(0) || _anyReaderActive(1)) {
       std::this_thread::yield();
     }
   }
@@ -78,7 +100,8 @@ class LeftRight final {
   template <typename F>
   auto read(F&& readFunc) const -> typename std::result_of<F(const T&)>::type {
     detail::IncrementRAII _increment_counter(
-        &_counters[_foregroundCounterIndex.load()]);
+        &_counters[_foregroundCounterIndex.load()][detail::leftRightReaderShard()]
+             .counter);
 
     return readFunc(_data[_foregroundDataIndex.load()]);
   }
@@ -174,13 +197,22 @@ class LeftRight final {
     }
   }
 
+  bool _anyReaderActive(uint8_t counterIndex) const {
+    for (const auto& shard : _counters[counterIndex]) {
+      if (shard.counter.load() != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   void _waitForBackgroundCounterToBeZero(uint8_t counterIndex) {
-    while (_counters[counterIndex ^ 1].load() != 0) {
+    while (_anyReaderActive(counterIndex ^ 1)) {
       std::this_thread::yield();
     }
   }
 
-  mutable std::array<std::atomic<int32_t>, 2> _counters;
+  mutable std::array<detail::LeftRightReaderCounters, 2> _counters;
   std::atomic<uint8_t> _foregroundCounterIndex;
   std::atomic<uint8_t> _foregroundDataIndex;
   std::array<T, 2> _data;
@@ -0,0 +1,232 @@
+#include <c10/util/RequestTracer.h>
+
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace c10 {
+
+// Note [Request trace]
+// ~~~~~~~~~~~~~~~~~~~~
+// Diagnosing a tail-latency spike requires correlating events that live
+// in different subsystems: dispatcher entry, caching-allocator traffic,
+// stream synchronization and c10d control traffic. Each of these has
+// its own log, and nothing ties "this allocation" to "that request".
+// The request tracer gives them a single, cheap meeting point:
+//
+//  - a RequestTraceGuard tags the current scope with a correlation id;
+//    the token rides in ThreadLocalDebugInfo, which ThreadLocalState
+//    already carries across async task launches, the autograd engine,
+//    JIT interpreter continuations and c10d work registration, so no
+//    subsystem needs its own plumbing to inherit it;
+//  - instrumented subsystems append fixed-size RequestTraceEvent
+//    records to a per-thread buffer. The hot path is one relaxed
+//    atomic load, one TLS lookup and one vector push under an
+//    uncontended per-thread mutex (the mutex is only ever contended by
+//    dump() and clear());
+//  - dump() merges the per-thread buffers into one timeline sorted by
+//    timestamp and writes it in a simple binary format:
+//
+//      8 bytes   magic "PTREQTRC"
+//      uint32    version (currently 1)
+//      uint32    sizeof(RequestTraceEvent)
+//      uint64    event count
+//      ...       raw RequestTraceEvent records
+//      uint64    string table entry count
+//      ...       entries: uint64 id, uint64 length, raw name bytes
+//                (names referenced by OP_BEGIN/OP_END/USER_MARK)
+//
+// Timestamps come from the steady clock, so records from different
+// threads of one process order correctly in the merged timeline.
+
+namespace {
+
+struct RequestTraceInfo : public DebugInfoBase {
+  explicit RequestTraceInfo(uint64_t correlation_id)
+      : correlation_id_(correlation_id) {}
+  uint64_t correlation_id_;
+};
+
+struct TraceBuffer {
+  explicit TraceBuffer(uint32_t thread_id) : thread_id(thread_id) {}
+  std::mutex mutex;
+  std::vector<RequestTraceEvent> events;
+  const uint32_t thread_id;
+};
+
+struct TraceState {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<TraceBuffer>> buffers;
+  uint32_t next_thread_id = 1;
+
+  std::mutex string_mutex;
+  std::unordered_map<std::string, uint64_t> string_ids;
+  uint64_t next_string_id = 1;
+};
+
+TraceState& traceState() {
+  // Leaky singleton: worker threads may still record during shutdown.
+  static TraceState* state = new TraceState();
+  return *state;
+}
+
+TraceBuffer& localTraceBuffer() {
+  thread_local std::shared_ptr<TraceBuffer> buffer = [] {
+    auto& state = traceState();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    auto b = std::make_shared<TraceBuffer>(state.next_thread_id++);
+    state.buffers.push_back(b);
+    return b;
+  }();
+  return *buffer;
+}
+
+int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void appendEvent(
+    uint64_t correlation_id,
+    RequestTraceEventKind kind,
+    uint64_t arg0,
+    int64_t arg1,
+    Device device) {
+  auto& buffer = localTraceBuffer();
+  RequestTraceEvent event;
+  event.time_ns = nowNs();
+  event.correlation_id = correlation_id;
+  event.arg0 = arg0;
+  event.arg1 = arg1;
+  event.thread_id = buffer.thread_id;
+  event.kind = static_cast<uint16_t>(kind);
+  event.device_type = static_cast<int8_t>(device.type());
+  event.device_index = device.index();
+  std::lock_guard<std::mutex> guard(buffer.mutex);
+  buffer.events.push_back(event);
+}
+
+} // namespace
+
+std::atomic<bool> RequestTracer::enabled_{false};
+
+void RequestTracer::setEnabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t RequestTracer::currentId() {
+  auto* info = static_cast<RequestTraceInfo*>(
+      ThreadLocalDebugInfo::get(DebugInfoKind::REQUEST_TRACE_INFO));
+  return info != nullptr ? info->correlation_id_ : 0;
+}
+
+void RequestTracer::record(
+    RequestTraceEventKind kind,
+    uint64_t arg0,
+    int64_t arg1,
+    Device device) {
+  if (!enabled()) {
+    return;
+  }
+  const uint64_t correlation_id = currentId();
+  if (correlation_id == 0) {
+    return;
+  }
+  appendEvent(correlation_id, kind, arg0, arg1, device);
+}
+
+void RequestTracer::recordForId(
+    uint64_t correlation_id,
+    RequestTraceEventKind kind,
+    uint64_t arg0,
+    int64_t arg1,
+    Device device) {
+  if (!enabled() || correlation_id == 0) {
+    return;
+  }
+  appendEvent(correlation_id, kind, arg0, arg1, device);
+}
+
+uint64_t RequestTracer::internString(const char* str) {
+  auto& state = traceState();
+  std::lock_guard<std::mutex> guard(state.string_mutex);
+  auto result = state.string_ids.emplace(str, state.next_string_id);
+  if (result.second) {
+    ++state.next_string_id;
+  }
+  return result.first->second;
+}
+
+void RequestTracer::dump(const std::string& path, uint64_t correlation_id) {
+  std::vector<RequestTraceEvent> events;
+  auto& state = traceState();
+  {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    for (const auto& buffer : state.buffers) {
+      std::lock_guard<std::mutex> buffer_guard(buffer->mutex);
+      for (const auto& event : buffer->events) {
+        if (correlation_id == 0 || event.correlation_id == correlation_id) {
+          events.push_back(event);
+        }
+      }
+    }
+  }
+  std::sort(
+      events.begin(),
+      events.end(),
+      [](const RequestTraceEvent& a, const RequestTraceEvent& b) {
+        return a.time_ns < b.time_ns;
+      });
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  TORCH_CHECK(out, "Could not open request trace file: ", path);
+  const char magic[8] = {'P', 'T', 'R', 'E', 'Q', 'T', 'R', 'C'};
+  out.write(magic, sizeof(magic));
+  const uint32_t version = 1;
+  const uint32_t record_size = sizeof(RequestTraceEvent);
+  out.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  out.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+  const uint64_t event_count = events.size();
+  out.write(reinterpret_cast<const char*>(&event_count), sizeof(event_count));
+  if (event_count > 0) {
+    out.write(
+        reinterpret_cast<const char*>(events.data()),
+        static_cast<std::streamsize>(event_count * sizeof(RequestTraceEvent)));
+  }
+  {
+    std::lock_guard<std::mutex> guard(state.string_mutex);
+    const uint64_t entry_count = state.string_ids.size();
+    out.write(reinterpret_cast<const char*>(&entry_count), sizeof(entry_count));
+    for (const auto& entry : state.string_ids) {
+      const uint64_t id = entry.second;
+      const uint64_t length = entry.first.size();
+      out.write(reinterpret_cast<const char*>(&id), sizeof(id));
+      out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      out.write(entry.first.data(), static_cast<std::streamsize>(length));
+    }
+  }
+  TORCH_CHECK(out.good(), "Failed to write request trace file: ", path);
+}
+
+void RequestTracer::clear() {
+  auto& state = traceState();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  for (const auto& buffer : state.buffers) {
+    std::lock_guard<std::mutex> buffer_guard(buffer->mutex);
+    buffer->events.clear();
+  }
+}
+
+RequestTraceGuard::RequestTraceGuard(uint64_t correlation_id)
+    : guard_(
+          DebugInfoKind::REQUEST_TRACE_INFO,
+          std::make_shared<RequestTraceInfo>(correlation_id)) {}
+
+} // namespace c10
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/macros/Macros.h>
+#include <c10/util/ThreadLocalDebugInfo.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace c10 {
+
+// A cross-subsystem, per-request event timeline; see Note [Request trace]
+// in RequestTracer.cpp for the motivation and the dump file layout.
+
+enum class C10_API_ENUM RequestTraceEventKind : uint16_t {
+  OP_BEGIN = 0, // arg0: interned name id, arg1: RecordFunction handle
+  OP_END, // arg0: interned name id, arg1: RecordFunction handle
+  ALLOC, // arg0: data pointer, arg1: allocation size in bytes
+  FREE, // arg0: data pointer, arg1: allocation size in bytes
+  STREAM_SYNC, // arg0: stream handle, arg1: wait time in ns
+  COLLECTIVE_ENQUEUE, // arg0: work object, arg1: c10d OpType
+  COLLECTIVE_COMPLETE, // arg0: work object, arg1: c10d OpType
+  USER_MARK, // arg0: interned name id
+};
+
+// A single fixed-size timeline record. Records are written to the dump
+// file verbatim, so this layout is part of the (versioned) file format.
+struct RequestTraceEvent {
+  int64_t time_ns; // steady clock
+  uint64_t correlation_id;
+  uint64_t arg0; // see RequestTraceEventKind
+  int64_t arg1; // see RequestTraceEventKind
+  uint32_t thread_id;
+  uint16_t kind;
+  int8_t device_type;
+  int8_t device_index;
+};
+
+static_assert(
+    sizeof(RequestTraceEvent) == 40,
+    "RequestTraceEvent is serialized verbatim and must stay packed");
+
+// Scoped token that tags everything recorded in this scope with a
+// caller-chosen correlation id. The token rides in ThreadLocalDebugInfo,
+// so ThreadLocalState propagation carries it across async task
+// launches, the autograd engine, JIT interpreter continuations and c10d
+// work registration without any additional plumbing.
+struct C10_API RequestTraceGuard {
+  explicit RequestTraceGuard(uint64_t correlation_id);
+
+ private:
+  DebugInfoGuard guard_;
+};
+
+class C10_API RequestTracer final {
+ public:
+  RequestTracer() = delete;
+
+  // Cheap global switch, checked before touching thread local state.
+  static bool enabled() {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  static void setEnabled(bool enabled);
+
+  // Correlation id set by the innermost RequestTraceGuard, 0 if none.
+  static uint64_t currentId();
+
+  static bool active() {
+    return enabled() && currentId() != 0;
+  }
+
+  // Records one event tagged with the calling thread's correlation id;
+  // no-op when tracing is disabled or no guard is in scope.
+  static void record(
+      RequestTraceEventKind kind,
+      uint64_t arg0,
+      int64_t arg1,
+      Device device);
+
+  // Same, for completion paths that captured the id earlier and run on
+  // threads that do not carry the token (e.g. c10d watchdog threads).
+  static void recordForId(
+      uint64_t correlation_id,
+      RequestTraceEventKind kind,
+      uint64_t arg0,
+      int64_t arg1,
+      Device device);
+
+  // Maps a name to a stable nonzero id for use as an event argument;
+  // the mapping is written out with the dump as a string table.
+  static uint64_t internString(const char* str);
+
+  // Writes all buffered events (only the given request's events if
+  // correlation_id is nonzero), merged across threads and sorted by
+  // timestamp, followed by the string table.
+  static void dump(const std::string& path, uint64_t correlation_id = 0);
+
+  // Drops all buffered events; the string table is retained.
+  static void clear();
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+} // namespace c10
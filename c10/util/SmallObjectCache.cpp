@@ -0,0 +1,98 @@
+#include <c10/util/SmallObjectCache.h>
+
+#include <array>
+#include <cstdlib>
+#include <new>
+
+namespace c10 {
+namespace detail {
+
+namespace {
+
+// Size classes are 64-byte granular; requests larger than kMaxCachedBytes
+// go straight to the heap.
+constexpr std::size_t kBucketGranularity = 64;
+constexpr std::size_t kMaxCachedBytes = 1024;
+constexpr std::size_t kNumBuckets = kMaxCachedBytes / kBucketGranularity;
+constexpr std::size_t kMaxBlocksPerBucket = 256;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+inline std::size_t bucket_index(std::size_t nbytes) {
+  return (nbytes - 1) / kBucketGranularity;
+}
+
+inline std::size_t bucket_bytes(std::size_t index) {
+  return (index + 1) * kBucketGranularity;
+}
+
+struct BucketedFreeList {
+  std::array<FreeBlock*, kNumBuckets> heads{};
+  std::array<std::size_t, kNumBuckets> counts{};
+  // Set to false when this thread's cache is being torn down, so frees
+  // that happen during thread exit (e.g. from other thread_local
+  // destructors releasing tensors) fall back to the heap instead of
+  // touching a dead cache.
+  bool alive = true;
+
+  ~BucketedFreeList() {
+    alive = false;
+    for (auto*& head : heads) {
+      while (head != nullptr) {
+        auto* next = head->next;
+        std::free(head);
+        head = next;
+      }
+    }
+  }
+};
+
+BucketedFreeList& free_list() {
+  static thread_local BucketedFreeList list;
+  return list;
+}
+
+} // namespace
+
+void* alloc_small_object(std::size_t nbytes) {
+  if (nbytes == 0 || nbytes > kMaxCachedBytes) {
+    return ::operator new(nbytes);
+  }
+  const auto bucket = bucket_index(nbytes);
+  auto& list = free_list();
+  if (list.alive && list.heads[bucket] != nullptr) {
+    auto* block = list.heads[bucket];
+    list.heads[bucket] = block->next;
+    list.counts[bucket]--;
+    return block;
+  }
+  // Allocate the rounded-up size class so the block can be recycled for
+  // any request in the same bucket.
+  void* ptr = std::malloc(bucket_bytes(bucket));
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void free_small_object(void* ptr, std::size_t nbytes) {
+  if (nbytes == 0 || nbytes > kMaxCachedBytes) {
+    ::operator delete(ptr);
+    return;
+  }
+  const auto bucket = bucket_index(nbytes);
+  auto& list = free_list();
+  if (!list.alive || list.counts[bucket] >= kMaxBlocksPerBucket) {
+    std::free(ptr);
+    return;
+  }
+  auto* block = static_cast<FreeBlock*>(ptr);
+  block->next = list.heads[bucket];
+  list.heads[bucket] = block;
+  list.counts[bucket]++;
+}
+
+} // namespace detail
+} // namespace c10
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+#include <cstddef>
+
+namespace c10 {
+namespace detail {
+
+// Thread-local free-list cache for small, frequently recycled control
+// blocks (TensorImpl, StorageImpl and their subclasses). Dynamic models
+// create and destroy these ~200 byte objects at very high rates, and the
+// global heap shows up prominently in profiles. Blocks are carved into
+// 64-byte size classes and cached per thread on free, so the steady-state
+// cost of creating a temporary tensor's metadata is a pointer pop/push.
+//
+// Blocks may be freed on a different thread than the one that allocated
+// them; they are simply recycled into the freeing thread's cache. Each
+// per-thread bucket is capped so producer/consumer allocation patterns
+// cannot grow a cache without bound.
+//
+// Hook these up via class-specific operator new/delete; see TensorImpl.
+
+C10_API void* alloc_small_object(std::size_t nbytes);
+C10_API void free_small_object(void* ptr, std::size_t nbytes);
+
+} // namespace detail
+} // namespace c10
@@ -15,6 +15,7 @@ enum class C10_API_ENUM DebugInfoKind : uint8_t {
   PROFILER_STATE,
   INFERENCE_CONTEXT, // for inference usage
   PARAM_COMMS_INFO,
+  REQUEST_TRACE_INFO, // see Note [Request trace] in c10/util/RequestTracer.cpp
 
   TEST_INFO, // used only in tests
   TEST_INFO_2, // used only in tests
@@ -5,6 +5,14 @@
 #include <ostream>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include <c10/core/Allocator.h>
 #include <c10/core/CPUAllocator.h>
@@ -54,10 +62,45 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 }
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
-PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
+PyTorchStreamReader::PyTorchStreamReader(
+    const std::string& file_name,
+    bool use_mmap)
     : ar_(std::make_unique<mz_zip_archive>()),
       in_(std::make_unique<FileAdapter>(file_name)) {
   init();
+  if (use_mmap) {
+    initMmap(file_name);
+  }
+}
+
+// See Note [Memory-mapped reads] in inline_container.h. On failure (or on
+// platforms without mmap) this silently leaves mmap_region_ empty and
+// getRecord keeps using the copying path.
+void PyTorchStreamReader::initMmap(const std::string& file_name) {
+#ifndef _WIN32
+  const size_t size = in_->size();
+  if (size == 0) {
+    return;
+  }
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return;
+  }
+  // PROT_WRITE + MAP_PRIVATE: records are handed out as ordinary mutable
+  // tensor storage, and writes stay in copy-on-write pages private to
+  // this process.
+  void* addr =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED) {
+    return;
+  }
+  mmap_region_ = std::shared_ptr<void>(
+      addr, [size](void* ptr) { munmap(ptr, size); });
+  mmap_size_ = size;
+#else
+  (void)file_name;
+#endif
 }
 
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
@@ -248,6 +291,12 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+namespace {
+void delete_mmap_record_context(void* ctx) {
+  delete static_cast<std::shared_ptr<void>*>(ctx);
+}
+} // namespace
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
   std::lock_guard<std::mutex> guard(reader_lock_);
@@ -255,6 +304,20 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+  // See Note [Memory-mapped reads]: stored (uncompressed) records are
+  // returned as views into the mapping instead of being copied out.
+  if (mmap_region_ != nullptr && stat.m_method == 0) {
+    size_t offset = getRecordOffsetUnlocked(stat.m_local_header_ofs);
+    if (offset + stat.m_uncomp_size <= mmap_size_) {
+      void* data = static_cast<char*>(mmap_region_.get()) + offset;
+      at::DataPtr retval(
+          data,
+          new std::shared_ptr<void>(mmap_region_),
+          delete_mmap_record_context,
+          c10::DeviceType::CPU);
+      return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+    }
+  }
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -266,21 +329,26 @@ static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(
+    uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+}
+
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordOffsetUnlocked(stat.m_local_header_ofs);
 }
 
 
@@ -351,6 +419,102 @@ void PyTorchStreamWriter::setMinVersion(const uint64_t version) {
   version_ = std::max(version, version_);
 }
 
+namespace {
+// Note [Parallel record compression]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// writeRecord(compress=true) used to hand the whole buffer to miniz, whose
+// deflate is single-threaded, so compressing a multi-gigabyte checkpoint
+// record serialized the writer. Large records are instead split into
+// fixed-size chunks that are deflated independently on worker threads.
+// Every chunk but the last ends with a sync flush, which terminates its
+// blocks on a byte boundary without marking the stream final, so the
+// concatenation of the per-chunk outputs is a single spec-valid DEFLATE
+// stream. The result is added with MZ_ZIP_FLAG_COMPRESSED_DATA and is
+// indistinguishable from a conventionally deflated entry: any zip reader,
+// including our own getRecord path, inflates it as usual, and no side-car
+// index or format change is needed. Chunks use independent dictionaries,
+// which costs a little ratio but makes them parallelizable.
+constexpr size_t kCompressionChunkSize = 8 * 1024 * 1024;
+
+// Deflates [data, data + size) as one raw-deflate fragment. `last` selects
+// whether the fragment ends the stream or is sync-flushed so another
+// fragment can follow it.
+bool deflateChunk(const char* data, size_t size, bool last, std::string& out) {
+  // tdefl_compressor is a few hundred KB, keep it off the stack.
+  auto comp = std::make_unique<tdefl_compressor>();
+  const int flags = tdefl_create_comp_flags_from_zlib_params(
+      MZ_BEST_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+  if (tdefl_init(comp.get(), nullptr, nullptr, flags) != TDEFL_STATUS_OKAY) {
+    return false;
+  }
+  // mz_compressBound covers the worst-case deflate expansion; a few extra
+  // bytes cover the sync-flush trailer so one tdefl_compress call suffices.
+  out.resize(mz_compressBound(size) + 16);
+  size_t in_size = size;
+  size_t out_size = out.size();
+  tdefl_status status = tdefl_compress(
+      comp.get(),
+      data,
+      &in_size,
+      &out[0],
+      &out_size,
+      last ? TDEFL_FINISH : TDEFL_SYNC_FLUSH);
+  if (in_size != size ||
+      status != (last ? TDEFL_STATUS_DONE : TDEFL_STATUS_OKAY)) {
+    return false;
+  }
+  out.resize(out_size);
+  return true;
+}
+
+// See Note [Parallel record compression]. Returns false if any chunk fails,
+// in which case the caller falls back to miniz's own deflate.
+bool parallelDeflate(const char* data, size_t size, std::string& out) {
+  const size_t num_chunks =
+      (size + kCompressionChunkSize - 1) / kCompressionChunkSize;
+  size_t num_threads = std::thread::hardware_concurrency();
+  num_threads = std::min(num_chunks, std::max<size_t>(num_threads, 1));
+  std::vector<std::string> chunks(num_chunks);
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<bool> ok{true};
+  auto work = [&]() {
+    while (ok) {
+      const size_t i = next_chunk.fetch_add(1);
+      if (i >= num_chunks) {
+        break;
+      }
+      const size_t offset = i * kCompressionChunkSize;
+      const size_t chunk_size = std::min(kCompressionChunkSize, size - offset);
+      if (!deflateChunk(
+              data + offset, chunk_size, i + 1 == num_chunks, chunks[i])) {
+        ok = false;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; ++t) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (!ok) {
+    return false;
+  }
+  size_t total = 0;
+  for (const auto& chunk : chunks) {
+    total += chunk.size();
+  }
+  out.reserve(total);
+  for (const auto& chunk : chunks) {
+    out.append(chunk);
+  }
+  return true;
+}
+} // namespace
+
 void PyTorchStreamWriter::writeRecord(
     const std::string& name,
     const void* data,
@@ -361,9 +525,41 @@ void PyTorchStreamWriter::writeRecord(
   TORCH_INTERNAL_ASSERT(
       files_written_.count(name) == 0, "Tried to serialize file twice: ", name);
   std::string full_name = archive_name_plus_slash_ + name;
+  uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
+  if (compress && size > kCompressionChunkSize) {
+    // See Note [Parallel record compression].
+    std::string compressed;
+    if (parallelDeflate(static_cast<const char*>(data), size, compressed)) {
+      if (compressed.size() < size) {
+        size_t padding_size = detail::getPadding(
+            ar_->m_archive_size, full_name.size(), compressed.size(), padding_);
+        mz_uint32 crc = static_cast<mz_uint32>(mz_crc32(
+            MZ_CRC32_INIT, static_cast<const unsigned char*>(data), size));
+        mz_zip_writer_add_mem_ex_v2(
+            ar_.get(),
+            full_name.c_str(),
+            compressed.data(),
+            compressed.size(),
+            nullptr,
+            0,
+            MZ_ZIP_FLAG_COMPRESSED_DATA,
+            size,
+            crc,
+            nullptr,
+            padding_.c_str(),
+            padding_size,
+            nullptr,
+            0);
+        valid("writing file ", name.c_str());
+        files_written_.insert(name);
+        return;
+      }
+      // The data did not shrink; store it instead of deflating it again.
+      flags = 0;
+    }
+  }
   size_t padding_size =
       detail::getPadding(ar_->m_archive_size, full_name.size(), size, padding_);
-  uint32_t flags = compress ? MZ_BEST_COMPRESSION : 0;
   mz_zip_writer_add_mem_ex_v2(
       ar_.get(),
       full_name.c_str(),
@@ -95,7 +95,20 @@ namespace serialize {
 
 class TORCH_API PyTorchStreamReader final {
  public:
-  explicit PyTorchStreamReader(const std::string& file_name);
+  // Note [Memory-mapped reads]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // When `use_mmap` is true (file-backed archives only), the whole archive
+  // is mapped copy-on-write and getRecord returns DataPtrs that point
+  // directly into the mapping for records stored uncompressed; the
+  // PyTorchStreamWriter 64-byte record padding guarantees their alignment.
+  // Each DataPtr shares ownership of the mapping, so load cost is
+  // proportional to pages actually touched and the data is not copied.
+  // Tensors stay writable because the mapping is private (copy-on-write).
+  // Compressed records, or platforms without mmap, fall back to the
+  // copying path.
+  explicit PyTorchStreamReader(
+      const std::string& file_name,
+      bool use_mmap = false);
   explicit PyTorchStreamReader(std::istream* in);
   explicit PyTorchStreamReader(std::shared_ptr<ReadAdapterInterface> in);
 
@@ -115,6 +128,8 @@ class TORCH_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordOffsetUnlocked(uint64_t local_header_ofs);
+  void initMmap(const std::string& file_name);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -124,6 +139,10 @@ class TORCH_API PyTorchStreamReader final {
   std::shared_ptr<ReadAdapterInterface> in_;
   int64_t version_;
   std::mutex reader_lock_;
+  // See Note [Memory-mapped reads]. The deleter unmaps the region; each
+  // record DataPtr handed out shares ownership of it.
+  std::shared_ptr<void> mmap_region_;
+  size_t mmap_size_ = 0;
 };
 
 class TORCH_API PyTorchStreamWriter final {
@@ -119,6 +119,48 @@ TEST(PytorchStreamWriterAndReader, GetNonexistentRecordThrows) {
   EXPECT_TRUE(reader.hasRecord("key1"));
 }
 
+#ifndef _WIN32
+TEST(PytorchStreamWriterAndReader, MmapReadsMatchCopyingReads) {
+  std::ostringstream oss;
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,cppcoreguidelines-avoid-magic-numbers)
+  std::array<char, 127> data1;
+  for (int i = 0; i < data1.size(); ++i) {
+    data1[i] = data1.size() - i;
+  }
+  writer.writeRecord("key1", data1.data(), data1.size());
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  std::string file_name = "output_mmap.zip";
+  std::ofstream foo(file_name, std::ios::binary);
+  foo.write(the_file.c_str(), the_file.size());
+  foo.close();
+
+  PyTorchStreamReader reader(file_name, /*use_mmap=*/true);
+  at::DataPtr data_ptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("key1");
+  ASSERT_EQ(size, data1.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data1.data(), data1.size()), 0);
+  // Records come out of the mapping 64-byte aligned, and the mapping is
+  // copy-on-write: scribbling on the record must not affect the file.
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(data_ptr.get()) % 64, 0);
+  static_cast<char*>(data_ptr.get())[0] = 42;
+
+  at::DataPtr data_ptr2;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size2;
+  std::tie(data_ptr2, size2) = reader.getRecord("key1");
+  ASSERT_EQ(size2, data1.size());
+  remove(file_name.c_str());
+}
+#endif
+
 } // namespace
 } // namespace serialize
 } // namespace caffe2
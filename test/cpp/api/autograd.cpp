@@ -619,6 +619,39 @@ TEST(CustomAutogradTest, DepNoGrad) {
   ASSERT_VARIABLE_EQ(x.grad(), torch::ones(x.sizes()));
 }
 
+TEST(CustomAutogradTest, DeferredPostHook) {
+  // See Note [Deferred post hooks] in engine.cpp: hooks that opt in via
+  // is_deferrable() run off the engine worker thread, but backward() still
+  // waits for them before returning.
+  struct DeferredHook : public FunctionPostHook {
+    explicit DeferredHook(std::atomic<int>& calls) : calls_(calls) {}
+    variable_list operator()(
+        const variable_list& outputs,
+        const variable_list& /* inputs */) override {
+      calls_++;
+      return outputs;
+    }
+    bool is_deferrable() const override {
+      return true;
+    }
+    std::atomic<int>& calls_;
+  };
+
+  std::atomic<int> calls(0);
+  Variable x = torch::randn({2, 2}, torch::requires_grad());
+  auto accumulator = torch::autograd::impl::grad_accumulator(x);
+  accumulator->add_post_hook(std::make_unique<DeferredHook>(calls));
+
+  backward({(x * 2).sum()}, {});
+  ASSERT_EQ(calls.load(), 1);
+  ASSERT_VARIABLE_EQ(x.grad(), torch::ones({2, 2}) * 2);
+
+  // The hook runs once per backward and gradients keep accumulating.
+  backward({(x * 2).sum()}, {});
+  ASSERT_EQ(calls.load(), 2);
+  ASSERT_VARIABLE_EQ(x.grad(), torch::ones({2, 2}) * 4);
+}
+
 TEST(CustomAutogradTest, Reentrant) {
   static Variable y_data = torch::randn({2, 2});
   struct Reenter : public Function<Reenter> {
@@ -101,7 +101,8 @@ TEST(DataTest, ChunkDataSetWithInvalidInitParameter) {
   auto initialization_function = [&](size_t preloader_count,
                                      size_t batch_size,
                                      size_t cache_size,
-                                     size_t cross_chunk_shuffle_count = 1) {
+                                     size_t cross_chunk_shuffle_count = 1,
+                                     size_t shuffle_buffer_size = 0) {
     datasets::SharedBatchDataset<datasets::ChunkDataset<
         DummyChunkDataReader,
         samplers::SequentialSampler,
@@ -117,7 +118,8 @@ TEST(DataTest, ChunkDataSetWithInvalidInitParameter) {
                 preloader_count,
                 batch_size,
                 cache_size,
-                cross_chunk_shuffle_count));
+                cross_chunk_shuffle_count,
+                shuffle_buffer_size));
   };
 
   ASSERT_THROWS_WITH(
@@ -139,6 +141,11 @@ TEST(DataTest, ChunkDataSetWithInvalidInitParameter) {
   ASSERT_THROWS_WITH(
       initialization_function(1, 10, 20, 0),
       "cross_chunk_shuffle_count needs to be greater than 0.");
+
+  ASSERT_THROWS_WITH(
+      initialization_function(1, 10, 20, 1, 5),
+      "shuffle_buffer_size needs to be either 0 (disabled) or at least as "
+      "large as the batch size.");
 }
 
 struct InfiniteStreamDataset
@@ -1035,6 +1042,7 @@ TEST(DataLoaderTest, DataLoaderOptionsDefaultAsExpected) {
   ASSERT_EQ(full_options.max_jobs, 0);
   ASSERT_FALSE(full_options.timeout.has_value());
   ASSERT_TRUE(full_options.enforce_ordering);
+  ASSERT_FALSE(full_options.pin_memory);
 }
 
 TEST(DataLoaderTest, DataLoaderOptionsCoalesceOptionalValues) {
@@ -1705,6 +1713,74 @@ TEST(DataLoaderTest, ChunkDataSetGetBatch) {
   }
 }
 
+// Tests the streaming shuffle mode of the chunk dataset. With a shuffle
+// buffer enabled the example sampler is bypassed and examples are shuffled
+// through a bounded reservoir instead, so the batch content is not
+// deterministic; we verify that every example is still returned exactly once
+// per epoch and that batches have the expected size.
+TEST(DataLoaderTest, ChunkDataSetGetBatchWithShuffleBuffer) {
+  // buffer sizes below and above the total example count, to exercise both
+  // the displacement path and the end-of-epoch drain.
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  const size_t shuffle_buffer_sizes[] = {10, 40};
+
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays)
+  const size_t prefetch_counts[] = {1, 3};
+
+  const size_t batch_size = 5;
+  const size_t total_example_count = 35;
+  DummyChunkDataReader data_reader;
+  samplers::SequentialSampler sampler(0);
+
+  // test functionality across epoch boundary; the shuffle buffer is recreated
+  // with the rest of the batch buffer on reset.
+  const int epoch_count = 2;
+
+  for (auto shuffle_buffer_size : shuffle_buffer_sizes) {
+    for (auto prefetch_count : prefetch_counts) {
+      datasets::SharedBatchDataset<datasets::ChunkDataset<
+          DummyChunkDataReader,
+          samplers::SequentialSampler,
+          samplers::SequentialSampler>>
+          dataset = datasets::make_shared_dataset<datasets::ChunkDataset<
+              DummyChunkDataReader,
+              samplers::SequentialSampler,
+              samplers::SequentialSampler>>(
+              data_reader,
+              sampler,
+              sampler,
+              datasets::ChunkDatasetOptions(
+                  prefetch_count,
+                  batch_size,
+                  /*cache_size=*/2048,
+                  /*cross_chunk_shuffle_count=*/1,
+                  shuffle_buffer_size));
+
+      auto data_loader = torch::data::make_data_loader(
+          dataset, DataLoaderOptions(batch_size));
+
+      for (int epoch_index = 0; epoch_index < epoch_count; ++epoch_index) {
+        std::vector<bool> result(total_example_count, false);
+        for (auto iterator = data_loader->begin();
+             iterator != data_loader->end();
+             ++iterator) {
+          DummyChunkDataReader::BatchType& batch = *iterator;
+          // total_example_count is a multiple of batch_size, so even the
+          // drained remainder comes out in full batches.
+          ASSERT_EQ(batch.size(), batch_size);
+          for (size_t j = 0; j < batch.size(); ++j) {
+            ASSERT_FALSE(result[batch[j]]);
+            result[batch[j]] = true;
+          }
+        }
+        for (auto data : result) {
+          ASSERT_EQ(data, true);
+        }
+      }
+    }
+  }
+}
+
 TEST(DataLoaderTest, ChunkDataSetWithBatchSizeMismatch) {
   const size_t prefetch_count = 1;
   const size_t batch_size = 5;
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <torch/torch.h>
+
+#include <test/cpp/api/support.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace torch::batching;
+
+namespace {
+// A long deadline, so that tests only observe deadline-driven flushes when
+// they mean to.
+const auto kNeverFlush = std::chrono::seconds(60);
+} // namespace
+
+TEST(DynamicBatcherTest, CoalescesRequestsIntoOneBatch) {
+  std::mutex mutex;
+  std::vector<int64_t> batch_sizes;
+  DynamicBatcher batcher(
+      [&](torch::Tensor input) {
+        std::lock_guard<std::mutex> lock(mutex);
+        batch_sizes.push_back(input.size(0));
+        return input * 2;
+      },
+      DynamicBatcherOptions(/*max_batch_size=*/4).flush_deadline(kNeverFlush));
+
+  std::vector<std::future<torch::Tensor>> futures;
+  std::vector<torch::Tensor> inputs;
+  for (size_t i = 0; i < 4; ++i) {
+    inputs.push_back(torch::randn({1, 3}));
+    futures.push_back(batcher.enqueue(inputs.back()));
+  }
+  for (size_t i = 0; i < futures.size(); ++i) {
+    ASSERT_TRUE(futures[i].get().allclose(inputs[i] * 2));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  ASSERT_EQ(batch_sizes, std::vector<int64_t>{4});
+}
+
+TEST(DynamicBatcherTest, FlushesOnDeadline) {
+  DynamicBatcher batcher(
+      [](torch::Tensor input) { return input + 1; },
+      DynamicBatcherOptions(/*max_batch_size=*/64)
+          .flush_deadline(std::chrono::milliseconds(2)));
+
+  auto input = torch::zeros({1, 2});
+  ASSERT_TRUE(batcher.forward(input).allclose(input + 1));
+}
+
+TEST(DynamicBatcherTest, SplitsOutputsPerRequest) {
+  DynamicBatcher batcher(
+      [](torch::Tensor input) { return input * 3; },
+      DynamicBatcherOptions(/*max_batch_size=*/5).flush_deadline(kNeverFlush));
+
+  auto first = torch::randn({2, 4});
+  auto second = torch::randn({3, 4});
+  auto first_future = batcher.enqueue(first);
+  auto second_future = batcher.enqueue(second);
+  ASSERT_TRUE(first_future.get().allclose(first * 3));
+  ASSERT_TRUE(second_future.get().allclose(second * 3));
+}
+
+TEST(DynamicBatcherTest, PropagatesForwardExceptionsToEveryRequest) {
+  DynamicBatcher batcher(
+      [](torch::Tensor) -> torch::Tensor {
+        throw std::runtime_error("model exploded");
+      },
+      DynamicBatcherOptions(/*max_batch_size=*/2).flush_deadline(kNeverFlush));
+
+  auto first = batcher.enqueue(torch::ones({1}));
+  auto second = batcher.enqueue(torch::ones({1}));
+  ASSERT_THROWS_WITH(first.get(), "model exploded");
+  ASSERT_THROWS_WITH(second.get(), "model exploded");
+}
+
+TEST(DynamicBatcherTest, RejectsInputsWithoutBatchDimension) {
+  DynamicBatcher batcher([](torch::Tensor input) { return input; });
+  ASSERT_THROWS_WITH(
+      batcher.enqueue(torch::ones({})), "leading batch dimension");
+}
+
+TEST(DynamicBatcherTest, StopDispatchesPendingRequests) {
+  DynamicBatcher batcher(
+      [](torch::Tensor input) { return input - 1; },
+      DynamicBatcherOptions(/*max_batch_size=*/64).flush_deadline(kNeverFlush));
+
+  auto input = torch::randn({2, 2});
+  auto future = batcher.enqueue(input);
+  batcher.stop();
+  ASSERT_TRUE(future.get().allclose(input - 1));
+  ASSERT_THROWS_WITH(batcher.enqueue(torch::ones({1})), "has been stopped");
+}
+
+TEST(DynamicBatcherTest, ManyThreadsManyBatches) {
+  DynamicBatcher batcher(
+      [](torch::Tensor input) { return input * input; },
+      DynamicBatcherOptions(/*max_batch_size=*/8)
+          .flush_deadline(std::chrono::milliseconds(1))
+          .max_concurrency(2));
+
+  std::vector<std::thread> threads;
+  std::vector<int> failures(4, 0);
+  for (size_t t = 0; t < failures.size(); ++t) {
+    threads.emplace_back([&batcher, &failures, t] {
+      for (size_t i = 0; i < 25; ++i) {
+        auto input = torch::randn({1, 5});
+        if (!batcher.forward(input).allclose(input * input)) {
+          ++failures[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto failure_count : failures) {
+    ASSERT_EQ(failure_count, 0);
+  }
+}
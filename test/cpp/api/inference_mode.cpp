@@ -581,6 +581,40 @@ TEST(InferenceModeTest, TestCustomFunction) {
   }
 }
 
+TEST(InferenceModeTest, TestSealInferenceTensor) {
+  // See Note [Sealing tensors for inference]
+  torch::Tensor weight = torch::ones({2, 3});
+  ASSERT_FALSE(weight.is_inference());
+  torch::autograd::seal_inference_tensor(weight);
+  ASSERT_TRUE(weight.is_inference());
+  // Sealing is idempotent.
+  torch::autograd::seal_inference_tensor(weight);
+  ASSERT_TRUE(weight.is_inference());
+
+  {
+    InferenceMode guard;
+    torch::Tensor out = functional_op(weight);
+    ASSERT_TRUE(out.is_inference());
+  }
+
+  // Outside InferenceMode a sealed tensor behaves like any inference
+  // tensor: functional ops produce normal tensors, inplace updates are
+  // rejected.
+  torch::Tensor out = functional_op(weight);
+  ASSERT_FALSE(out.is_inference());
+  ASSERT_THROWS_WITH(inplace_op(weight),
+    "Inplace update to inference tensor outside InferenceMode is not allowed");
+
+  // Tensors that still participate in autograd cannot be sealed.
+  torch::Tensor leaf = torch::ones({2, 3}).set_requires_grad(true);
+  ASSERT_THROWS_WITH(torch::autograd::seal_inference_tensor(leaf),
+    "Cannot seal a tensor that requires grad");
+  torch::Tensor base = torch::ones({2, 3});
+  torch::Tensor view = base.view({3, 2});
+  ASSERT_THROWS_WITH(torch::autograd::seal_inference_tensor(view),
+    "Cannot seal a view");
+}
+
 TEST(InferenceModeTest, TestLegacyAutoNonVariableTypeModeWarning) {
   c10::Warning::WarnAlways warn_always(true);
   WarningCapture warnings;
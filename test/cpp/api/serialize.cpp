@@ -889,6 +889,34 @@ TEST(SerializeTest, VectorOfTensors) {
   }
 }
 
+TEST(SerializeTest, SaveAsyncVectorOfTensors) {
+  torch::manual_seed(0);
+
+  std::vector<torch::Tensor> x_vec = { torch::randn({1, 2}), torch::randn({3, 4}) };
+
+  auto tempfile = c10::make_tempfile();
+  auto future = torch::save_async(x_vec, tempfile.name);
+  // The snapshot taken by save_async must be immune to subsequent mutation
+  // of the source tensors.
+  auto x_expected = std::vector<torch::Tensor>{ x_vec[0].clone(), x_vec[1].clone() };
+  for (auto& x : x_vec) {
+    x.zero_();
+  }
+  future.get();
+
+  std::vector<torch::Tensor> y_vec;
+  torch::load(y_vec, tempfile.name);
+
+  ASSERT_EQ(x_expected.size(), y_vec.size());
+  for (const auto i : c10::irange(x_expected.size())) {
+    auto& x = x_expected[i];
+    auto& y = y_vec[i];
+    ASSERT_TRUE(y.defined());
+    ASSERT_EQ(x.sizes().vec(), y.sizes().vec());
+    ASSERT_TRUE(x.allclose(y));
+  }
+}
+
 TEST(SerializeTest, IValue) {
   c10::IValue ivalue(1);
   auto tempfile = c10::make_tempfile();
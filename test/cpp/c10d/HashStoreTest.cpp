@@ -3,8 +3,10 @@
 
 #include <unistd.h>
 
+#include <atomic>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include <c10d/HashStore.hpp>
 #include <c10d/PrefixStore.hpp>
@@ -82,6 +84,47 @@ void stressTestStore(std::string prefix = "") {
   c10d::test::check(store, "counter", expected);
 }
 
+void testTreeCollectives(int numRanks) {
+  auto store = c10::make_intrusive<c10d::HashStore>();
+
+  std::atomic<int> arrivals{0};
+  std::vector<int> arrivalsSeen(numRanks);
+  std::vector<std::vector<uint8_t>> broadcasted(numRanks);
+  std::vector<std::vector<std::vector<uint8_t>>> gathered(numRanks);
+  const std::vector<uint8_t> rootValue = {'r', 'o', 'o', 't'};
+
+  std::vector<std::thread> threads;
+  for (const auto rank : c10::irange(numRanks)) {
+    threads.push_back(std::thread([&, rank] {
+      arrivals++;
+      store->barrier("barrier", rank, numRanks);
+      arrivalsSeen[rank] = arrivals.load();
+      broadcasted[rank] = store->broadcast(
+          "bcast",
+          rank,
+          numRanks,
+          rank == 0 ? rootValue : std::vector<uint8_t>());
+      gathered[rank] = store->allGather(
+          "gather", rank, numRanks, {static_cast<uint8_t>(rank)});
+    }));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto rank : c10::irange(numRanks)) {
+    // Nobody left the barrier before everybody entered it.
+    EXPECT_EQ(arrivalsSeen[rank], numRanks);
+    EXPECT_EQ(broadcasted[rank], rootValue);
+    EXPECT_EQ(gathered[rank].size(), static_cast<size_t>(numRanks));
+    for (const auto other : c10::irange(numRanks)) {
+      EXPECT_EQ(
+          gathered[rank][other],
+          std::vector<uint8_t>{static_cast<uint8_t>(other)});
+    }
+  }
+}
+
 TEST(HashStoreTest, testGetAndSet) {
   testGetSet();
 }
@@ -97,3 +140,11 @@ TEST(HashStoreTest, testStressStore) {
 TEST(HashStoreTest, testStressStoreWithPrefix) {
   stressTestStore("testPrefix");
 }
+
+TEST(HashStoreTest, testTreeCollectivesSingleRank) {
+  testTreeCollectives(1);
+}
+
+TEST(HashStoreTest, testTreeCollectives) {
+  testTreeCollectives(8);
+}
@@ -351,6 +351,24 @@ TEST(TCPStoreTest, testKeyDelete) {
   testKeyChangeHelper(*store, key, "1", c10::nullopt);
 }
 
+TEST(TCPStoreTest, testMultiGet) {
+  auto store = _createServer();
+
+  std::vector<std::string> keys;
+  for (const auto i : c10::irange(4)) {
+    keys.push_back("multiGetKey" + std::to_string(i));
+    c10d::test::set(*store, keys.back(), "value" + std::to_string(i));
+  }
+
+  auto values = store->multiGet(keys);
+  EXPECT_EQ(values.size(), keys.size());
+  for (const auto i : c10::irange(keys.size())) {
+    std::string expected = "value" + std::to_string(i);
+    EXPECT_EQ(
+        values[i], std::vector<uint8_t>(expected.begin(), expected.end()));
+  }
+}
+
 TEST(TCPStoreTest, testCleanShutdown) {
   int numWorkers = 2;
 
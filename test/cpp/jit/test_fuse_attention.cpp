@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/passes/fuse_attention.h>
+#include <torch/csrc/jit/testing/file_check.h>
+
+#include <limits>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Builds the unfused attention idiom: matmul -> div -> [masked_fill ->]
+// softmax -> matmul. The graph takes query, key, value (and the mask if
+// `fill_value` is given) as inputs.
+std::shared_ptr<Graph> buildAttentionIdiom(
+    c10::optional<double> fill_value = c10::nullopt) {
+  auto graph = std::make_shared<Graph>();
+  Value* query = graph->addInput()->setType(TensorType::get());
+  Value* key = graph->addInput()->setType(TensorType::get());
+  Value* value = graph->addInput()->setType(TensorType::get());
+  Value* mask = nullptr;
+  if (fill_value.has_value()) {
+    mask = graph->addInput()->setType(TensorType::get());
+  }
+
+  Value* neg1 = graph->insertConstant(-1);
+  Value* neg2 = graph->insertConstant(-2);
+  Value* none = graph->insertConstant(IValue());
+  Value* scale = graph->insertConstant(8.0);
+
+  Value* key_t = graph->insert(aten::transpose, {key, neg2, neg1});
+  Value* scores = graph->insert(aten::matmul, {query, key_t});
+  Value* scaled = graph->insert(aten::div, {scores, scale});
+  if (fill_value.has_value()) {
+    Value* fill = graph->insertConstant(*fill_value);
+    scaled = graph->insert(aten::masked_fill, {scaled, mask, fill});
+  }
+  Value* weights = graph->insert(aten::softmax, {scaled, neg1, none});
+  Value* out = graph->insert(aten::matmul, {weights, value});
+  graph->registerOutput(out);
+  return graph;
+}
+
+} // namespace
+
+TEST(FuseAttentionTest, FusesAttentionIdiom) {
+  auto graph = buildAttentionIdiom();
+  std::vector<at::Tensor> inputs = {
+      at::randn({2, 3, 4, 8}),
+      at::randn({2, 3, 5, 8}),
+      at::randn({2, 3, 5, 8})};
+  auto orig_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(FuseAttention(graph));
+  graph->lint();
+  auto opt_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(almostEqual(orig_outputs[0], opt_outputs[0]));
+  testing::FileCheck()
+      .check_count("= aten::_scaled_dot_product_attention(", 1, /*exactly*/ true)
+      ->check_not("= aten::softmax(")
+      ->run(*graph);
+}
+
+TEST(FuseAttentionTest, FusesMaskedAttentionIdiom) {
+  auto graph =
+      buildAttentionIdiom(-std::numeric_limits<double>::infinity());
+  std::vector<at::Tensor> inputs = {
+      at::randn({2, 4, 8}),
+      at::randn({2, 5, 8}),
+      at::randn({2, 5, 8}),
+      // Mask out the last key for every query row.
+      at::tensor({false, false, false, false, true}, at::kBool)
+          .expand({4, 5})};
+  auto orig_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(FuseAttention(graph));
+  graph->lint();
+  auto opt_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(almostEqual(orig_outputs[0], opt_outputs[0]));
+  testing::FileCheck()
+      .check_count("= aten::_scaled_dot_product_attention(", 1, /*exactly*/ true)
+      ->check_not("= aten::masked_fill(")
+      ->run(*graph);
+}
+
+TEST(FuseAttentionTest, NoFusionForFiniteFillValue) {
+  // A finite fill value is not equivalent to masking under softmax, so the
+  // graph must stay unfused.
+  auto graph = buildAttentionIdiom(-2.5);
+  ASSERT_FALSE(FuseAttention(graph));
+  testing::FileCheck()
+      .check_count("= aten::masked_fill(", 1, /*exactly*/ true)
+      ->run(*graph);
+}
+
+} // namespace jit
+} // namespace torch
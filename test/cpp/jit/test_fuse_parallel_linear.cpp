@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <test/cpp/jit/test_utils.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/passes/fuse_parallel_linear.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+#include <torch/csrc/jit/testing/file_check.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Builds a graph that applies one linear layer per entry of
+// `out_features` to the same input, with constant parameters, and
+// returns each result as a graph output.
+std::shared_ptr<Graph> buildSiblingLinears(
+    const std::vector<int64_t>& out_features,
+    int64_t in_features,
+    bool with_bias) {
+  auto graph = std::make_shared<Graph>();
+  Value* input = graph->addInput()->setType(TensorType::get());
+  for (int64_t out : out_features) {
+    Value* weight = graph->insertConstant(at::randn({out, in_features}));
+    Value* bias = with_bias ? graph->insertConstant(at::randn({out}))
+                            : graph->insertConstant(IValue());
+    Value* result = graph->insert(aten::linear, {input, weight, bias});
+    graph->registerOutput(result);
+  }
+  return graph;
+}
+
+} // namespace
+
+TEST(FuseParallelLinearTest, FusesSiblingLinears) {
+  auto graph = buildSiblingLinears({4, 6, 8}, 16, /*with_bias=*/true);
+  std::vector<at::Tensor> inputs = {at::randn({2, 16})};
+  auto orig_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(FuseParallelLinear(graph));
+  graph->lint();
+  auto opt_outputs = runGraph(graph, inputs);
+
+  ASSERT_EQ(orig_outputs.size(), opt_outputs.size());
+  for (size_t i = 0; i < orig_outputs.size(); ++i) {
+    // The fused GEMM may differ from the per-head ones in the low-order
+    // bits, so compare approximately.
+    ASSERT_TRUE(almostEqual(orig_outputs[i], opt_outputs[i]));
+  }
+
+  testing::FileCheck()
+      .check_count("= aten::linear(", 1, /*exactly*/ true)
+      ->check_count("= aten::split_with_sizes(", 1, /*exactly*/ true)
+      ->check_count("= prim::ListUnpack(", 1, /*exactly*/ true)
+      ->run(*graph);
+}
+
+TEST(FuseParallelLinearTest, FusesBiaslessLinears) {
+  auto graph = buildSiblingLinears({3, 5}, 8, /*with_bias=*/false);
+  std::vector<at::Tensor> inputs = {at::randn({4, 8})};
+  auto orig_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(FuseParallelLinear(graph));
+  graph->lint();
+  auto opt_outputs = runGraph(graph, inputs);
+
+  ASSERT_EQ(orig_outputs.size(), opt_outputs.size());
+  for (size_t i = 0; i < orig_outputs.size(); ++i) {
+    ASSERT_TRUE(almostEqual(orig_outputs[i], opt_outputs[i]));
+  }
+
+  testing::FileCheck()
+      .check_count("= aten::linear(", 1, /*exactly*/ true)
+      ->check_count("= aten::split_with_sizes(", 1, /*exactly*/ true)
+      ->run(*graph);
+}
+
+TEST(FuseParallelLinearTest, NoFusionForSingleLinear) {
+  auto graph = buildSiblingLinears({4}, 16, /*with_bias=*/true);
+  ASSERT_FALSE(FuseParallelLinear(graph));
+}
+
+TEST(FuseParallelLinearTest, NoFusionForNonConstantWeight) {
+  auto graph = std::make_shared<Graph>();
+  Value* input = graph->addInput()->setType(TensorType::get());
+  Value* weight = graph->addInput()->setType(TensorType::get());
+  Value* bias = graph->insertConstant(IValue());
+  for (int i = 0; i < 2; ++i) {
+    graph->registerOutput(
+        graph->insert(aten::linear, {input, weight, bias}));
+  }
+  ASSERT_FALSE(FuseParallelLinear(graph));
+}
+
+TEST(FuseParallelLinearTest, NoFusionAcrossDifferentInputs) {
+  auto graph = std::make_shared<Graph>();
+  Value* input1 = graph->addInput()->setType(TensorType::get());
+  Value* input2 = graph->addInput()->setType(TensorType::get());
+  for (Value* input : {input1, input2}) {
+    Value* weight = graph->insertConstant(at::randn({4, 16}));
+    Value* bias = graph->insertConstant(at::randn({4}));
+    graph->registerOutput(graph->insert(aten::linear, {input, weight, bias}));
+  }
+  ASSERT_FALSE(FuseParallelLinear(graph));
+}
+
+TEST(FuseParallelLinearTest, MixedBiasPresenceSplitsGroups) {
+  auto graph = std::make_shared<Graph>();
+  Value* input = graph->addInput()->setType(TensorType::get());
+  // Two linears with bias and two without: each pair fuses, but the
+  // pairs stay separate.
+  for (int i = 0; i < 4; ++i) {
+    Value* weight = graph->insertConstant(at::randn({4, 16}));
+    Value* bias = (i < 2) ? graph->insertConstant(at::randn({4}))
+                          : graph->insertConstant(IValue());
+    graph->registerOutput(graph->insert(aten::linear, {input, weight, bias}));
+  }
+  std::vector<at::Tensor> inputs = {at::randn({2, 16})};
+  auto orig_outputs = runGraph(graph, inputs);
+
+  ASSERT_TRUE(FuseParallelLinear(graph));
+  graph->lint();
+  auto opt_outputs = runGraph(graph, inputs);
+
+  ASSERT_EQ(orig_outputs.size(), opt_outputs.size());
+  for (size_t i = 0; i < orig_outputs.size(); ++i) {
+    ASSERT_TRUE(almostEqual(orig_outputs[i], opt_outputs[i]));
+  }
+
+  testing::FileCheck()
+      .check_count("= aten::linear(", 2, /*exactly*/ true)
+      ->check_count("= aten::split_with_sizes(", 2, /*exactly*/ true)
+      ->run(*graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -37,6 +37,17 @@ TEST(JitLoggingTest, CheckAfterChangingLevel) {
       ::torch::jit::is_enabled("f1.cpp", JitLoggingLevels::GRAPH_UPDATE));
 }
 
+TEST(JitLoggingTest, DontEvaluateArgumentsWhenDisabled) {
+  ::torch::jit::set_jit_logging_levels("");
+  size_t calls = 0;
+  auto expensive = [&calls]() {
+    ++calls;
+    return std::string("expensive");
+  };
+  GRAPH_DEBUG("message ", expensive());
+  ASSERT_EQ(calls, 0);
+}
+
 TEST(JitLoggingTest, CheckOutputStreamSetting) {
   ::torch::jit::set_jit_logging_levels("test_jit_logging_levels");
   std::ostringstream test_stream;
@@ -27,6 +27,15 @@ TEST(MobileTypeParserTest, NestedContainersAnnotationStr) {
   ASSERT_EQ(tuple_ps, tuple_tps);
 }
 
+TEST(MobileTypeParserTest, RepeatedParsesShareTypes) {
+  // Parses are memoized process-wide, so identical strings return the same
+  // TypePtr instance.
+  std::string tuple_ps("Tuple[str, Optional[float], List[Tensor]]");
+  auto first = c10::parseType(tuple_ps);
+  auto second = c10::parseType(tuple_ps);
+  ASSERT_EQ(first.get(), second.get());
+}
+
 TEST(MobileTypeParserTest, TorchBindClass) {
   std::string tuple_ps("__torch__.torch.classes.rnn.CellParamsBase");
   auto tuple_tp = c10::parseType(tuple_ps);
@@ -83,6 +83,29 @@ TEST(ModuleAPITest, MethodRunAsync) {
   ASSERT_GE(counter, 2);
 }
 
+TEST(ModuleAPITest, BoundMethod) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, x: Tensor, y: Tensor) -> Tensor:
+      return x * y + x
+  )");
+  auto bound = m.get_bound_method("forward");
+
+  auto x = torch::rand({3, 4});
+  auto y = torch::rand({3, 4});
+  auto expected = m.forward({x, y}).toTensor();
+
+  // Run enough times for the profiling executor to settle on its optimized
+  // plan; every call must agree with Module::forward.
+  for (int i = 0; i < 5; i++) {
+    auto out = bound({x, y}).toTensor();
+    ASSERT_TRUE(at::allclose(out, expected));
+  }
+
+  // Arity is still checked, even though schema normalization is skipped.
+  ASSERT_ANY_THROW(bound({x}));
+}
+
 TEST(ModuleAPITest, Clone) {
   auto cu = std::make_shared<CompilationUnit>();
   // creating child module
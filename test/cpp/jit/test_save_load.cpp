@@ -6,6 +6,7 @@
 #include <torch/csrc/jit/serialization/export.h>
 #include <torch/csrc/jit/serialization/import.h>
 #include <torch/csrc/jit/serialization/import_source.h>
+#include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/torch.h>
 
 #include "caffe2/serialize/istream_adapter.h"
@@ -121,6 +122,20 @@ TEST(SerializationTest, TypeTags) {
   }
 }
 
+TEST(SerializationTest, PickleGatherBorrowsCpuTensorData) {
+  auto tensor = torch::ones({17, 5});
+  auto gathered = pickle_gather(tensor);
+  ASSERT_EQ(gathered.tensor_segments.size(), 1);
+  const auto& segment = gathered.tensor_segments[0];
+  // CPU payloads are borrowed from the source storage, not copied.
+  ASSERT_EQ(
+      segment.payload.data(),
+      static_cast<const char*>(tensor.storage().data()));
+  ASSERT_EQ(segment.payload.sizeInBytes(), tensor.storage().nbytes());
+  // The header pads the payload to a 64 byte boundary of the stream.
+  ASSERT_EQ((gathered.pickle_data.size() + segment.header.size()) % 64, 0);
+}
+
 TEST(SerializationTest, TestJitStream_CUDA) {
   torch::jit::Module model;
   std::vector<torch::jit::IValue> inputs;
@@ -124,6 +124,35 @@ graph(%a.1 : Float(8, 8, strides=[8, 1], requires_grad=0, device=cpu),
   ASSERT_TRUE(at::allclose(o, ref));
 }
 
+TEST_F(Kernel, DynamicBatchDimension) {
+  bool old_dynamic_batch = getTEAllowDynamicBatch();
+  getTEAllowDynamicBatch() = true;
+  const auto graph_string = R"IR(
+      graph(%0 : Float(8, 3, strides=[3, 1], device=cpu),
+            %1 : Float(8, 3, strides=[3, 1], device=cpu)):
+        %2 : Float(8, 3, strides=[3, 1]) = aten::mul(%0, %1)
+        %3 : Float(8, 3, strides=[3, 1]) = aten::mul(%0, %2)
+        return (%3))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(graph_string, &*graph);
+  TensorExprKernel k(graph);
+
+  // The kernel was compiled against the profiled batch size of 8, but with a
+  // symbolic batch dimension it must serve the whole shape family.
+  for (int64_t batch : {8, 3, 16}) {
+    auto a = at::rand({batch, 3}, TensorOptions(kCPU).dtype(at::kFloat));
+    auto b = at::rand({batch, 3}, TensorOptions(kCPU).dtype(at::kFloat));
+    auto ref = a * (a * b);
+    std::vector<at::Tensor> inputs = {a, b};
+    std::vector<IValue> stack = fmap<IValue>(inputs);
+    k.run(stack);
+    auto o = stack[0].toTensor();
+    ASSERT_EQ(o.sizes(), ref.sizes());
+    ASSERT_TRUE(at::allclose(o, ref));
+  }
+  getTEAllowDynamicBatch() = old_dynamic_batch;
+}
+
 TEST_F(Kernel, _1) {
   const auto graph_string = R"IR(
       graph(%0 : Float(5, 3, strides=[3, 1], device=cpu),
@@ -1901,6 +1901,85 @@ TEST(Reductions, ReductionVectorizeRfactor) {
   ASSERT_EQ(out_before[0], out_after[0]);
 }
 
+TEST(Reductions, ReductionVectorizeReduction) {
+  constexpr int M = 4;
+  constexpr int N = 20;
+  std::vector<float> in_(M * N);
+  for (const auto i : c10::irange(M)) {
+    for (const auto j : c10::irange(N)) {
+      in_[i * N + j] = j + 1;
+    }
+  }
+  std::vector<float> out_before(M, -1.f);
+  std::vector<float> out_after(M, -1.f);
+
+  BufHandle in("in", {M, N}, kFloat);
+
+  Tensor tensor = Reduce("sum", {{M, "m"}}, Sum(), in, {{N, "j"}});
+
+  LoopNest l_before({tensor});
+  LoopNest l(l_before);
+  l_before.prepareForCodegen();
+  SimpleIREvaluator cg_before(l_before.root_stmt(), {in, tensor});
+  cg_before.call({in_, out_before});
+
+  // vectorizeReduction automates the rfactor recipe above: the reduce axis
+  // is split by the number of lanes, the lane axis is rfactored into a
+  // normal axis of a temporary accumulator, and the accumulation is
+  // vectorized. The iterations that don't fill a whole vector are handled
+  // by a scalar tail loop.
+  ASSERT_TRUE(l.vectorizeReduction(l.getLoopStmtsFor(tensor)[1], 8));
+  l.simplify();
+
+  StmtPtr s = l.root_stmt();
+
+  std::ostringstream oss;
+  oss << *s;
+  const std::string& expected_ir =
+      R"IR(
+#CHECK: for (int m = 0; m < 4; m++) {
+#CHECK:   sum[m] = 0.f;
+#CHECK:   for (int j_inner = 0; j_inner < 8; j_inner++) {
+#CHECK:     sum_rfac[
+#CHECK:   }
+#CHECK:   for (int j_outer = 0; j_outer < 2; j_outer++) {
+#CHECK:     sum_rfac[Ramp(8 * m, 1, 8)] = ReduceOp((sum_rfac[Ramp(8 * m, 1, 8)]) + (in[Ramp(
+#CHECK:   }
+#CHECK:   for (int j_inner = 0; j_inner < 8; j_inner++) {
+#CHECK:     sum[m] = ReduceOp((sum[m]) + (sum_rfac[
+#CHECK:   }
+#CHECK:   for (int j_tail = 0; j_tail < 4; j_tail++) {
+#CHECK:     sum[m] = ReduceOp((sum[m]) + (in[
+#CHECK:   }
+#CHECK: }
+      )IR";
+  torch::jit::testing::FileCheck().run(expected_ir, oss.str());
+
+  // Vectorizing should not change result.
+  l.prepareForCodegen();
+  s = IRSimplifier::simplify(l.root_stmt());
+  SimpleIREvaluator cg_after(s, {in, tensor});
+  cg_after.call({in_, out_after});
+  for (const auto i : c10::irange(M)) {
+    ASSERT_EQ(out_before[i], out_after[i]);
+  }
+}
+
+TEST(Reductions, ReductionVectorizeExpandedStore) {
+  BufHandle in("in", {8, 8}, kFloat);
+
+  Tensor tensor = Reduce("sum", {{8, "m"}}, Sum(), in, {{8, "n"}});
+  LoopNest l({tensor});
+
+  // After prepareForCodegen expands the ReduceOp into an accumulating store,
+  // every iteration of the inner loop writes through the same scalar index.
+  // Vectorizing it would make the lanes clobber each other, so it must fail.
+  l.prepareForCodegen();
+  auto loops = NodeFinder<For>::find(l.root_stmt());
+  ASSERT_EQ(loops.size(), 2);
+  ASSERT_FALSE(LoopNest::vectorize(loops[1]));
+}
+
 TEST(Reductions, InitFunction) {
   constexpr int M = 32;
   constexpr int N = 16;
@@ -181,6 +181,15 @@ class TCPStoreTest(TestCase, StoreTestBase):
         store1 = dist.TCPStore(addr, port, 1, True, multi_tenant=True)  # type: ignore[call-arg] # noqa: F841
         store2 = dist.TCPStore(addr, port, 1, True, multi_tenant=True)  # type: ignore[call-arg] # noqa: F841
 
+    def test_multi_get(self):
+        store = self._create_store()
+        store.set("first_key", "first_value")
+        store.set("second_key", "second_value")
+        self.assertEqual(
+            store.multi_get(["first_key", "second_key"]),
+            [b"first_value", b"second_value"],
+        )
+
     @skip_if_win32()
     def test_init_pg_and_rpc_with_same_socket(self):
         addr = DEFAULT_HOSTNAME
@@ -6,6 +6,7 @@ import io
 import os
 import pathlib
 import random
+import subprocess
 import sys
 
 from torch import Tensor
@@ -1022,3 +1023,32 @@ class TestSaveLoad(JitTestCase):
             loaded_name, loaded_buffer = loaded_b
             self.assertEqual(m_name, loaded_name)
             self.assertEqual(m_buffer, loaded_buffer)
+
+    def test_dedup_tensor_storages_on_load(self):
+        """
+        Check that TORCH_DEDUP_TENSOR_STORAGES makes identical weights loaded
+        from separate archives share one storage. The flag is read once per
+        process, so the check runs in a subprocess.
+        """
+        script = """
+import io
+
+import torch
+
+m = torch.jit.script(torch.nn.Linear(8, 8))
+buf = io.BytesIO()
+torch.jit.save(m, buf)
+
+a = torch.jit.load(io.BytesIO(buf.getvalue()))
+b = torch.jit.load(io.BytesIO(buf.getvalue()))
+assert a.weight.data_ptr() == b.weight.data_ptr(), "identical weights should share storage"
+
+other = torch.jit.script(torch.nn.Linear(8, 8))  # different random weights
+buf = io.BytesIO()
+torch.jit.save(other, buf)
+c = torch.jit.load(io.BytesIO(buf.getvalue()))
+assert c.weight.data_ptr() != a.weight.data_ptr(), "distinct weights must not share storage"
+"""
+        env = os.environ.copy()
+        env["TORCH_DEDUP_TENSOR_STORAGES"] = "1"
+        subprocess.check_call([sys.executable, "-c", script], env=env)
@@ -119,6 +119,56 @@ class TestAutocastCPU(TestCase):
         for op, args in self.autocast_lists.torch_need_autocast_promote:
             self._run_autocast_outofplace(op, args, torch.float32)
 
+    def test_autocast_cache_hits_and_version_invalidation(self):
+        weight = torch.randn(8, 8, requires_grad=True)
+        x = torch.randn(8, 8)
+        torch.clear_autocast_cache()
+        torch.reset_autocast_cache_stats()
+        with torch.cpu.amp.autocast():
+            torch.mm(x, weight)
+            # x doesn't require grad, so only the weight cast is cacheable
+            self.assertEqual(torch.autocast_cache_miss_count(), 1)
+            self.assertEqual(torch.autocast_cache_hit_count(), 0)
+            torch.mm(x, weight)
+            self.assertEqual(torch.autocast_cache_hit_count(), 1)
+        # Casts of unmutated leaf weights survive region exit, so the next
+        # forward pass hits instead of re-casting.
+        with torch.cpu.amp.autocast():
+            torch.mm(x, weight)
+            self.assertEqual(torch.autocast_cache_hit_count(), 2)
+        # An in-place update bumps the version counter and invalidates the
+        # cached cast; the recast must see the new values.
+        with torch.no_grad():
+            weight.add_(1.)
+        with torch.cpu.amp.autocast():
+            out = torch.mm(x, weight)
+            self.assertEqual(torch.autocast_cache_miss_count(), 2)
+        self.assertEqual(out, torch.mm(x.bfloat16(), weight.bfloat16()), atol=0., rtol=0.)
+        # clear_autocast_cache still drops everything
+        torch.clear_autocast_cache()
+        with torch.cpu.amp.autocast():
+            torch.mm(x, weight)
+            self.assertEqual(torch.autocast_cache_miss_count(), 3)
+
+    def test_autocast_cache_views(self):
+        base = torch.randn(8, 8, requires_grad=True)
+        view = base[:4]
+        x = torch.randn(8, 4)
+        torch.clear_autocast_cache()
+        torch.reset_autocast_cache_stats()
+        with torch.cpu.amp.autocast():
+            torch.mm(x, view)
+            torch.mm(x, view)
+            self.assertEqual(torch.autocast_cache_hit_count(), 1)
+            # Mutating the base through another alias invalidates the view's
+            # cached cast because views share the base's version counter.
+            with torch.no_grad():
+                base.mul_(2.)
+            out = torch.mm(x, view)
+            self.assertEqual(torch.autocast_cache_miss_count(), 2)
+        self.assertEqual(out, torch.mm(x.bfloat16(), view.bfloat16()), atol=0., rtol=0.)
+
+
 class TestTorchAutocast(TestCase):
     def test_autocast_fast_dtype(self):
         gpu_fast_dtype = torch.get_autocast_gpu_dtype()
@@ -306,6 +306,14 @@ class TestCuda(TestCase):
                 torch.cuda.caching_allocator_delete(mem)
                 self.assertEqual(torch.cuda.memory_allocated(), prev)
 
+    def test_warmup(self):
+        # Assert these calls don't raise; warmup is idempotent.
+        prev = torch.cuda.memory_allocated()
+        torch.cuda.warmup()
+        torch.cuda.warmup(devices=[torch.cuda.current_device()], alloc_bytes=1024)
+        # The warmed-up allocation was freed back into the cache, not leaked.
+        self.assertEqual(torch.cuda.memory_allocated(), prev)
+
     def test_check_error(self):
         # Assert this call doesn't raise.
         torch.cuda.check_error(0)
@@ -3109,6 +3117,52 @@ torch.cuda.synchronize()
     def test_to_numpy(self):
         self.assertRaises(TypeError, lambda: torch.empty(1, device="cuda").numpy())
 
+    @unittest.skipIf(TEST_WITH_ROCM, "persistent worker not validated on ROCm")
+    def test_persistent_kernel_queue(self):
+        ops = torch.ops.cuda_persistent
+
+        # Enqueueing before start and after stop must fail.
+        x = torch.randn(1024, device='cuda')
+        h = torch.randn(1024, device='cuda')
+        out = torch.empty_like(x)
+        tmp = torch.empty_like(x)
+        self.assertFalse(ops.is_running())
+        with self.assertRaisesRegex(RuntimeError, "start"):
+            ops.unary("relu", out, x)
+
+        expected = torch.tanh(x * 0.5 + h).relu()
+        torch.cuda.synchronize()
+
+        ops.start(64)
+        try:
+            self.assertTrue(ops.is_running())
+            ops.binary_scalar("mul", tmp, x, 0.5)
+            ops.binary("add", tmp, tmp, h)
+            ops.unary("tanh", tmp, tmp)
+            ops.unary("relu", out, tmp)
+            ops.synchronize()
+
+            with self.assertRaisesRegex(RuntimeError, "unsupported binary op"):
+                ops.binary("pow", out, x, h)
+            with self.assertRaisesRegex(RuntimeError, "broadcasting is not supported"):
+                ops.binary("add", out, x, torch.randn(8, device='cuda'))
+            with self.assertRaisesRegex(RuntimeError, "must be contiguous"):
+                ops.unary("copy", out, torch.randn(64, 32, device='cuda').t())
+        finally:
+            ops.stop()
+
+        self.assertFalse(ops.is_running())
+        self.assertEqual(out, expected)
+
+        # The worker can be restarted after a stop.
+        ops.start(16)
+        try:
+            ops.unary("neg", out, x)
+            ops.synchronize()
+        finally:
+            ops.stop()
+        self.assertEqual(out, -x)
+
     @unittest.skipIf((not TEST_CUDA) or
                      TEST_WITH_ROCM or
                      int(torch.version.cuda.split(".")[0]) < 11, "CUDA >= 11.0 required for graphs")
@@ -638,6 +638,32 @@ class TestForeach(TestCase):
         self.assertEqual(expected, tensors1)
 
 
+    @onlyCUDA
+    def test_foreach_copy_coalesced_h2d(self, device):
+        # Many small contiguous CPU sources take the coalesced staging path:
+        # a single H2D transfer followed by a device-side scatter.
+        sizes = [(3, 5), (7,), (4, 4), (1,), (0,), (2, 3, 4)]
+        srcs = [torch.randn(size) for size in sizes]
+        dsts = [torch.empty(size, device=device) for size in sizes]
+        torch._foreach_copy_(dsts, srcs)
+        self.assertEqual([d.cpu() for d in dsts], srcs)
+
+        # Pinned sources with a non-blocking transfer.
+        srcs = [torch.randn(size).pin_memory() for size in sizes]
+        dsts = [torch.empty(size, device=device) for size in sizes]
+        torch._foreach_copy_(dsts, srcs, non_blocking=True)
+        torch.cuda.synchronize()
+        self.assertEqual([d.cpu() for d in dsts], srcs)
+
+    def test_foreach_copy_slow_path(self, device):
+        # Dtype conversion is handled by the per-tensor fallback.
+        srcs = [torch.randn(5), torch.arange(3, dtype=torch.long)]
+        dsts = [torch.empty(5, dtype=torch.double, device=device),
+                torch.empty(3, dtype=torch.float, device=device)]
+        torch._foreach_copy_(dsts, srcs)
+        for dst, src in zip(dsts, srcs):
+            self.assertEqual(dst, src.to(dst))
+
 instantiate_device_type_tests(TestForeach, globals())
 
 if __name__ == '__main__':
@@ -700,6 +700,34 @@ class TestIndexing(TestCase):
         y.index_put_((mask, ), y[mask], accumulate=True)
         self.assertEqual(y, torch.ones(size=(10, 10), device=device))
 
+    def test_index_put_accumulate_bool_mask_scalar(self, device):
+        # index_put_ with a boolean mask and a scalar value (what
+        # `x[mask] += c` compiles to in TorchScript) takes a fused path that
+        # never materializes index tensors; check it against the reference
+        # computed through explicit advanced indexing
+        for dtype in (torch.float, torch.double, torch.long):
+            x = torch.arange(24, device=device).to(dtype).view(2, 3, 4)
+            masks = [
+                torch.tensor([True, False], device=device),
+                torch.tensor([[True, False, True], [False, True, True]], device=device),
+                x % 2 == 0,
+            ]
+            value = torch.tensor(5, dtype=dtype)
+            for mask in masks:
+                ref = x.clone()
+                ref[mask] = ref[mask] + value
+                out = x.clone()
+                out.index_put_((mask,), value, accumulate=True)
+                self.assertEqual(out, ref)
+
+        # non-contiguous destination
+        x = torch.randn(4, 6, device=device).t()
+        mask = x > 0
+        ref = x.clone()
+        ref[mask] = ref[mask] + 2.5
+        x.index_put_((mask,), torch.tensor(2.5), accumulate=True)
+        self.assertEqual(x, ref)
+
     def test_multiple_bool_indices(self, device):
         v = torch.randn(5, 7, 3, device=device)
         # note: these broadcast together and are transposed to the first dim
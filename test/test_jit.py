@@ -590,6 +590,60 @@ class TestJit(JitTestCase):
         # a_copy is modified
         torch.testing.assert_close(orig_res, a_copy)
 
+    @unittest.skipIf(not RUN_CUDA, "fused dropout+add+layer_norm requires CUDA")
+    def test_dropout_add_layer_norm_fusion(self):
+        class M(torch.nn.Module):
+            def __init__(self):
+                super(M, self).__init__()
+                self.ln = nn.LayerNorm(16)
+                self.dropout = nn.Dropout(0.5)
+
+            def forward(self, x, residual):
+                return self.ln(self.dropout(x) + residual)
+
+        x = torch.rand((4, 16), device='cuda')
+        residual = torch.rand((4, 16), device='cuda')
+        m = torch.jit.script(M())
+        m.eval()
+        with torch.no_grad():
+            orig_res = m(x, residual)
+        torch._C._jit_pass_inline(m.graph)
+        torch._C._jit_pass_fuse_dropout_add_layer_norm(m.graph)
+        FileCheck().check_not("aten::layer_norm(") \
+            .check("aten::_dropout_add_layer_norm(") \
+            .run(m.graph)
+        with torch.no_grad():
+            new_res = m(x, residual)
+        torch.testing.assert_close(orig_res, new_res)
+
+        # The fused op's gradients must match the unfused composition. With
+        # p=0 dropout is the identity, so train mode is deterministic too.
+        x = torch.rand((4, 16), device='cuda', requires_grad=True)
+        residual = torch.rand((4, 16), device='cuda', requires_grad=True)
+        weight = torch.rand(16, device='cuda', requires_grad=True)
+        bias = torch.rand(16, device='cuda', requires_grad=True)
+        ref = F.layer_norm(x + residual, [16], weight, bias)
+        ref.sum().backward()
+        ref_grads = [t.grad.clone() for t in (x, residual, weight, bias)]
+        for t in (x, residual, weight, bias):
+            t.grad = None
+        out = torch._dropout_add_layer_norm(
+            x, residual, [16], weight, bias, 0.0, 1e-5, True)[0]
+        torch.testing.assert_close(ref, out)
+        out.sum().backward()
+        for ref_grad, t in zip(ref_grads, (x, residual, weight, bias)):
+            torch.testing.assert_close(ref_grad, t.grad)
+
+        # With p>0 the kept elements are scaled by 1/(1-p) before the add;
+        # check against the unfused ops replayed with the returned mask.
+        x = torch.rand((64, 16), device='cuda')
+        residual = torch.rand((64, 16), device='cuda')
+        out, mask, add_out, _, _ = torch._dropout_add_layer_norm(
+            x, residual, [16], weight.detach(), bias.detach(), 0.5, 1e-5, True)
+        torch.testing.assert_close(x * mask * 2.0 + residual, add_out)
+        torch.testing.assert_close(
+            F.layer_norm(add_out, [16], weight.detach(), bias.detach()), out)
+
     @unittest.skipIf(GRAPH_EXECUTOR != ProfilingMode.LEGACY, "Simple executor doesn't have shape information")
     def test_peephole_optimize_shape_ops(self):
         def test_input(func, input, result):
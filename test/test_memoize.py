@@ -0,0 +1,108 @@
+import torch
+import torch.nn.functional as F
+from torch.testing._internal.common_utils import TestCase, run_tests
+
+
+class TestMemoize(TestCase):
+    def setUp(self):
+        super(TestMemoize, self).setUp()
+        torch._C._clear_memoize_cache()
+        torch._C._set_memoize_cache_max_entries(1024)
+        torch._C._add_memoized_op('aten::mul.Tensor')
+        torch._C._add_memoized_op('aten::layer_norm')
+        torch._C._set_memoize_enabled(True)
+
+    def tearDown(self):
+        torch._C._set_memoize_enabled(False)
+        torch._C._remove_memoized_op('aten::mul.Tensor')
+        torch._C._remove_memoized_op('aten::layer_norm')
+        torch._C._clear_memoize_cache()
+        super(TestMemoize, self).tearDown()
+
+    def _reference(self, fn):
+        # Compute an uncached reference value for comparison.
+        torch._C._set_memoize_enabled(False)
+        try:
+            return fn()
+        finally:
+            torch._C._set_memoize_enabled(True)
+
+    def test_enabled_flag(self):
+        self.assertTrue(torch._C._is_memoize_enabled())
+        torch._C._set_memoize_enabled(False)
+        self.assertFalse(torch._C._is_memoize_enabled())
+        torch._C._set_memoize_enabled(True)
+
+    def test_hit_returns_same_tensor(self):
+        a = torch.randn(8)
+        b = torch.randn(8)
+        out1 = torch.mul(a, b)
+        out2 = torch.mul(a, b)
+        self.assertEqual(out1.data_ptr(), out2.data_ptr())
+        self.assertEqual(out2, self._reference(lambda: torch.mul(a, b)))
+
+    def test_non_allowlisted_not_cached(self):
+        a = torch.randn(8)
+        b = torch.randn(8)
+        out1 = torch.add(a, b)
+        out2 = torch.add(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+
+    def test_inplace_input_invalidates(self):
+        a = torch.randn(8)
+        b = torch.randn(8)
+        out1 = torch.mul(a, b)
+        a.add_(1)
+        out2 = torch.mul(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+        self.assertEqual(out2, self._reference(lambda: torch.mul(a, b)))
+
+    def test_mutation_through_view_invalidates(self):
+        a = torch.randn(8)
+        b = torch.randn(8)
+        out1 = torch.mul(a, b)
+        a.view(2, 4).add_(1)
+        out2 = torch.mul(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+        self.assertEqual(out2, self._reference(lambda: torch.mul(a, b)))
+
+    def test_output_mutation_drops_entry(self):
+        a = torch.randn(8)
+        b = torch.randn(8)
+        out1 = torch.mul(a, b)
+        out1.add_(1)
+        out2 = torch.mul(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+        self.assertEqual(out2, self._reference(lambda: torch.mul(a, b)))
+
+    def test_scalar_args_distinguish_entries(self):
+        x = torch.randn(4, 8)
+        out1 = F.layer_norm(x, (8,))
+        out2 = F.layer_norm(x, (8,))
+        self.assertEqual(out1.data_ptr(), out2.data_ptr())
+        out3 = F.layer_norm(x, (8,), eps=1e-3)
+        self.assertNotEqual(out1.data_ptr(), out3.data_ptr())
+        self.assertEqual(out3, self._reference(lambda: F.layer_norm(x, (8,), eps=1e-3)))
+
+    def test_requires_grad_not_cached(self):
+        a = torch.randn(8, requires_grad=True)
+        b = torch.randn(8)
+        out1 = torch.mul(a, b)
+        out2 = torch.mul(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+        out2.sum().backward()
+        self.assertEqual(a.grad, b)
+
+    def test_cache_bound(self):
+        torch._C._set_memoize_cache_max_entries(1)
+        a = torch.randn(8)
+        b = torch.randn(8)
+        c = torch.randn(8)
+        out1 = torch.mul(a, b)
+        torch.mul(a, c)  # evicts the (a, b) entry
+        out2 = torch.mul(a, b)
+        self.assertNotEqual(out1.data_ptr(), out2.data_ptr())
+
+
+if __name__ == '__main__':
+    run_tests()
@@ -1062,6 +1062,25 @@ class TestMkldnn(TestCase):
         self.assertFalse(x.is_mkldnn)
         self.assertTrue(x.to_mkldnn().is_mkldnn)
 
+    def test_allow_bf16_matmul(self):
+        # The flag must round-trip, and fp32 matmuls under the reduced
+        # precision mode must stay fp32 in and out while agreeing with the
+        # full precision result up to bf16 input rounding.
+        a = torch.randn(64, 64, dtype=torch.float32)
+        b = torch.randn(64, 64, dtype=torch.float32)
+        c = torch.randn(64, 64, dtype=torch.float32)
+        mm_ref = torch.mm(a, b)
+        addmm_ref = torch.addmm(c, a, b)
+        bmm_ref = torch.bmm(a.unsqueeze(0), b.unsqueeze(0))
+        with torch.backends.mkldnn.flags(enabled=True, allow_bf16_matmul=True):
+            self.assertTrue(torch.backends.mkldnn.allow_bf16_matmul)
+            for res, ref in [(torch.mm(a, b), mm_ref),
+                             (torch.addmm(c, a, b), addmm_ref),
+                             (torch.bmm(a.unsqueeze(0), b.unsqueeze(0)), bmm_ref)]:
+                self.assertEqual(res.dtype, torch.float32)
+                self.assertEqual(res, ref, atol=1e-1, rtol=1e-2)
+        self.assertFalse(torch.backends.mkldnn.allow_bf16_matmul)
+
     # legacy constructor/new doesn't support mkldnn tensors
     def test_legacy_new_failure(self):
         x = torch.randn(1, dtype=torch.float32)
@@ -6874,6 +6874,20 @@ class TestNN(NNTestCase):
                 if l < 10:
                     self.assertEqual(padded.grad.data[l:, i].abs().sum(), 0)
 
+        # trailing padding steps beyond the longest length must not leak into
+        # the packed data
+        for batch_first in (True, False):
+            base = torch.randn(5, 3, 4)
+            padded_longer = torch.cat([base, torch.zeros(2, 3, 4)])
+            lengths = [5, 3, 1]
+            if batch_first:
+                base = base.transpose(0, 1)
+                padded_longer = padded_longer.transpose(0, 1)
+            expected = rnn_utils.pack_padded_sequence(base, lengths, batch_first=batch_first)
+            actual = rnn_utils.pack_padded_sequence(padded_longer, lengths, batch_first=batch_first)
+            self.assertEqual(actual.data, expected.data)
+            self.assertEqual(actual.batch_sizes, expected.batch_sizes)
+
         # test error messages
         with self.assertRaisesRegex(RuntimeError, 'You can pass `enforce_sorted=False`'):
             packed = rnn_utils.pack_padded_sequence(torch.randn(3, 3), [1, 3, 2])
@@ -14664,6 +14678,22 @@ class TestNNDeviceType(NNTestCase):
 
                             self.assertEqual(a_cuda.grad, a_cpu.grad)
 
+    @onlyCPU
+    def test_upsampling_repeated_geometry(self, device):
+        # CPU interpolation caches its index/weight tables per call geometry;
+        # a cache hit must reproduce the fresh computation bit-for-bit, also
+        # after calls with other geometries have run in between.
+        for mode in ['nearest', 'bilinear', 'bicubic']:
+            kwargs = dict(mode=mode)
+            if mode != 'nearest':
+                kwargs['align_corners'] = False
+            in_t = torch.randn(2, 3, 6, 6, device=device)
+            fresh = F.interpolate(in_t, size=(9, 9), **kwargs)
+            F.interpolate(in_t, size=(5, 5), **kwargs)
+            F.interpolate(torch.randn(1, 1, 4, 4, device=device), size=(7, 7), **kwargs)
+            cached = F.interpolate(in_t, size=(9, 9), **kwargs)
+            self.assertEqual(fresh, cached, atol=0, rtol=0)
+
     @onlyCPU
     @dtypes(torch.float, torch.double)
     def test_adaptive_pooling_max_nhwc(self, device, dtype):
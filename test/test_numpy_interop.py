@@ -228,6 +228,25 @@ class TestNumPyInterop(TestCase):
         x.strides = (3,)
         self.assertRaises(ValueError, lambda: torch.from_numpy(x))
 
+    @onlyCPU
+    def test_from_numpy_unaligned(self, device) -> None:
+        # Zero-copy ingested buffers may be element-aligned but misaligned
+        # relative to the vector width; elementwise kernels handle this with
+        # a scalar peel loop, so results must match the aligned case exactly.
+        # See Note [Alignment-tolerant vectorized loops].
+        for offset in [4, 8, 12, 20]:
+            buf = bytearray(4 * 1000 + offset)
+            x = torch.from_numpy(np.frombuffer(buf, dtype=np.float32, offset=offset))
+            x.uniform_()
+            aligned = x.clone()
+            self.assertEqual(torch.sigmoid(x), torch.sigmoid(aligned))
+            self.assertEqual(x + x, aligned + aligned)
+            self.assertEqual(x * 2.0, aligned * 2.0)
+            # unaligned output of an in-place op
+            x.add_(1.0)
+            aligned.add_(1.0)
+            self.assertEqual(x, aligned)
+
     def test_from_list_of_ndarray_warning(self, device):
         warning_msg = r"Creating a tensor from a list of numpy.ndarrays is extremely slow"
         with self.assertWarnsOnceRegex(UserWarning, warning_msg):
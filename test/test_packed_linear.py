@@ -0,0 +1,70 @@
+import io
+
+import torch
+import torch.nn.functional as F
+from torch.testing._internal.common_utils import TestCase, run_tests
+
+
+class TestPackedLinear(TestCase):
+    def test_linear_run_matches_linear(self):
+        x = torch.randn(4, 16)
+        w = torch.randn(8, 16)
+        b = torch.randn(8)
+        packed = torch.ops.cpublas.linear_prepack(w, b)
+        self.assertEqual(torch.ops.cpublas.linear_run(x, packed), F.linear(x, w, b))
+
+    def test_linear_run_no_bias(self):
+        x = torch.randn(4, 16)
+        w = torch.randn(8, 16)
+        packed = torch.ops.cpublas.linear_prepack(w)
+        self.assertEqual(torch.ops.cpublas.linear_run(x, packed), F.linear(x, w))
+
+    def test_linear_run_multidim_input(self):
+        x = torch.randn(2, 3, 16)
+        w = torch.randn(8, 16)
+        b = torch.randn(8)
+        packed = torch.ops.cpublas.linear_prepack(w, b)
+        self.assertEqual(torch.ops.cpublas.linear_run(x, packed), F.linear(x, w, b))
+
+    def test_linear_run_bfloat16(self):
+        x = torch.randn(4, 16).bfloat16()
+        w = torch.randn(8, 16).bfloat16()
+        b = torch.randn(8).bfloat16()
+        packed = torch.ops.cpublas.linear_prepack(w, b)
+        self.assertEqual(torch.ops.cpublas.linear_run(x, packed), F.linear(x, w, b))
+
+    def test_prepack_errors(self):
+        with self.assertRaisesRegex(RuntimeError, "expected a 2-D weight"):
+            torch.ops.cpublas.linear_prepack(torch.randn(8))
+        with self.assertRaisesRegex(RuntimeError, "only float and bfloat16"):
+            torch.ops.cpublas.linear_prepack(torch.randn(8, 16).double())
+        with self.assertRaisesRegex(RuntimeError, "1-D bias of size 8"):
+            torch.ops.cpublas.linear_prepack(torch.randn(8, 16), torch.randn(4))
+
+    def test_run_dtype_mismatch(self):
+        packed = torch.ops.cpublas.linear_prepack(torch.randn(8, 16))
+        with self.assertRaisesRegex(RuntimeError, "doesn't match the packed weight"):
+            torch.ops.cpublas.linear_run(torch.randn(4, 16).bfloat16(), packed)
+
+    def test_scripted_save_load(self):
+        class M(torch.nn.Module):
+            def __init__(self, w, b):
+                super(M, self).__init__()
+                self.packed = torch.ops.cpublas.linear_prepack(w, b)
+
+            def forward(self, x):
+                return torch.ops.cpublas.linear_run(x, self.packed)
+
+        w = torch.randn(8, 16)
+        b = torch.randn(8)
+        scripted = torch.jit.script(M(w, b))
+        buffer = io.BytesIO()
+        torch.jit.save(scripted, buffer)
+        buffer.seek(0)
+        loaded = torch.jit.load(buffer)
+        x = torch.randn(4, 16)
+        self.assertEqual(loaded(x), F.linear(x, w, b))
+
+
+if __name__ == '__main__':
+    run_tests()
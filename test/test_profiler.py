@@ -528,6 +528,50 @@ class TestProfiler(TestCase):
             sort_by="self_cuda_time_total", row_limit=-1)
         self.assertIn("Total MFLOPs", profiler_output)
 
+    def test_roofline_analysis(self):
+        model = torch.nn.Sequential(
+            nn.Linear(64, 64),
+            nn.ReLU(),
+            nn.Sigmoid(),
+        )
+        inputs = torch.randn(32, 64)
+        with _profile(record_shapes=True, with_flops=True, use_kineto=kineto_available()) as prof:
+            model(inputs)
+        events = prof.function_events
+
+        flops_by_name = {}
+        bytes_by_name = {}
+        for evt in events:
+            if evt.flops:
+                flops_by_name.setdefault(evt.name, evt.flops)
+            if evt.input_bytes:
+                bytes_by_name.setdefault(evt.name, evt.input_bytes)
+        for name in ["aten::linear", "aten::relu", "aten::sigmoid"]:
+            self.assertGreater(flops_by_name.get(name, 0), 0, name)
+            self.assertGreater(bytes_by_name.get(name, 0), 0, name)
+        # 2 * batch * in_features * out_features
+        self.assertEqual(flops_by_name["aten::linear"], 2 * 32 * 64 * 64)
+        # input + weight + bias, fp32
+        self.assertEqual(bytes_by_name["aten::linear"], (32 * 64 + 64 * 64 + 64) * 4)
+
+        annotated = events.roofline_analysis(peak_flops=1e12, peak_bandwidth=1e11)
+        self.assertGreater(len(annotated), 0)
+        for evt, ratio in annotated:
+            self.assertEqual(ratio, evt.roofline_ratio)
+            self.assertGreater(evt.arithmetic_intensity, 0)
+        # 1 flop/byte elementwise ops sit far below a balance of 10 flops/byte
+        relu = next(evt for evt, _ in annotated if evt.name == "aten::relu")
+        self.assertTrue(relu.is_memory_bound)
+
+        runs = events.fusion_opportunities(peak_flops=1e12, peak_bandwidth=1e11)
+        # the adjacent relu/sigmoid on the same activation form a run
+        self.assertTrue(any(
+            "aten::relu" in names and "aten::sigmoid" in names
+            for names in ([e.name for e in run["events"]] for run in runs)))
+        for run in runs:
+            self.assertGreaterEqual(len(run["events"]), 2)
+            self.assertGreater(run["total_bytes"], 0)
+
     def test_kineto_profiler_api(self):
         called_num = [0]
 
@@ -772,5 +816,33 @@ class TestProfiler(TestCase):
                 self.assertTrue(ts_to_name[s_ts_1] == "aten::binary_cross_entropy_with_logits")
                 self.assertTrue(ts_to_name[s_ts_2] == "aten::add")
 
+    def test_op_histograms(self):
+        autograd = torch._C._autograd
+        self.assertFalse(autograd._op_histograms_enabled())
+        autograd._enable_op_histograms(record_bytes=True)
+        try:
+            autograd._reset_op_histograms()
+            x = torch.randn(16, 16)
+            for _ in range(4):
+                torch.add(x, x)
+            hists = {h.name: h for h in autograd._export_op_histograms()}
+            self.assertIn("aten::add", hists)
+            hist = hists["aten::add"]
+            self.assertGreaterEqual(hist.count, 4)
+            self.assertGreater(hist.total_ns, 0)
+            self.assertEqual(len(hist.latency_ns_buckets), 64)
+            self.assertEqual(sum(hist.latency_ns_buckets), hist.count)
+            # 16 * 16 floats per input, two inputs: bucket log2(2048) == 11.
+            self.assertEqual(len(hist.bytes_buckets), 64)
+            self.assertEqual(hist.bytes_buckets[11], hist.count)
+
+            autograd._reset_op_histograms()
+            hists = {h.name: h for h in autograd._export_op_histograms()}
+            self.assertNotIn("aten::add", hists)
+        finally:
+            autograd._disable_op_histograms()
+        self.assertFalse(autograd._op_histograms_enabled())
+
+
 if __name__ == '__main__':
     run_tests()
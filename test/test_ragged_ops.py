@@ -0,0 +1,124 @@
+import torch
+from torch.testing._internal.common_device_type import (
+    instantiate_device_type_tests,
+    dtypes,
+)
+from torch.testing._internal.common_utils import (
+    TestCase,
+    run_tests,
+)
+
+
+def make_ragged(lengths, trailing_dims, device, dtype, requires_grad=False):
+    offsets = torch.tensor([0] + lengths, dtype=torch.int64).cumsum(0)
+    values = torch.randn(
+        (sum(lengths),) + trailing_dims,
+        device=device,
+        dtype=dtype,
+        requires_grad=requires_grad,
+    )
+    return values, offsets
+
+
+class TestRaggedOps(TestCase):
+    @dtypes(torch.float, torch.double)
+    def test_roundtrip(self, device, dtype):
+        lengths = [3, 0, 5, 1]
+        values, offsets = make_ragged(lengths, (4,), device, dtype)
+        padded = torch._padded_from_ragged(values, offsets)
+        self.assertEqual(padded.shape, (4, 5, 4))
+        for i, length in enumerate(lengths):
+            start, end = offsets[i].item(), offsets[i + 1].item()
+            self.assertEqual(padded[i, :length], values[start:end])
+            self.assertEqual(
+                padded[i, length:], torch.zeros_like(padded[i, length:]))
+        self.assertEqual(torch._ragged_from_padded(padded, offsets), values)
+
+    @dtypes(torch.float)
+    def test_padded_from_ragged_max_len(self, device, dtype):
+        values, offsets = make_ragged([2, 3], (2,), device, dtype)
+        padded = torch._padded_from_ragged(values, offsets, 7, -1.0)
+        self.assertEqual(padded.shape, (2, 7, 2))
+        self.assertEqual(padded[0, 2:], torch.full_like(padded[0, 2:], -1.0))
+        with self.assertRaisesRegex(RuntimeError, "max_len"):
+            torch._padded_from_ragged(values, offsets, 2)
+
+    @dtypes(torch.float, torch.double)
+    def test_ragged_bmm(self, device, dtype):
+        lengths = [4, 1, 0, 6]
+        values, offsets = make_ragged(lengths, (3,), device, dtype)
+        mat2 = torch.randn(4, 3, 5, device=device, dtype=dtype)
+        result = torch._ragged_bmm(values, offsets, mat2)
+        self.assertEqual(result.shape, (sum(lengths), 5))
+        for i in range(len(lengths)):
+            start, end = offsets[i].item(), offsets[i + 1].item()
+            self.assertEqual(result[start:end], values[start:end].mm(mat2[i]))
+
+    @dtypes(torch.float, torch.double)
+    def test_ragged_bmm_matches_padded(self, device, dtype):
+        # The ragged path must agree with bmm on the padded layout (padding
+        # rows only ever multiply into padding rows of the output).
+        lengths = [2, 5, 3]
+        values, offsets = make_ragged(lengths, (3,), device, dtype)
+        mat2 = torch.randn(3, 3, 4, device=device, dtype=dtype)
+        padded = torch._padded_from_ragged(values, offsets)
+        expected = torch._ragged_from_padded(padded.bmm(mat2), offsets)
+        self.assertEqual(torch._ragged_bmm(values, offsets, mat2), expected)
+
+    @dtypes(torch.float, torch.double)
+    def test_ragged_softmax(self, device, dtype):
+        lengths = [3, 1, 4]
+        values, offsets = make_ragged(lengths, (2,), device, dtype)
+        result = torch._ragged_softmax(values, offsets)
+        for i in range(len(lengths)):
+            start, end = offsets[i].item(), offsets[i + 1].item()
+            self.assertEqual(
+                result[start:end], values[start:end].softmax(0))
+        # each segment normalizes independently of its neighbours
+        self.assertEqual(
+            result.split(lengths)[1].sum(0),
+            torch.ones(2, device=device, dtype=dtype))
+
+    @dtypes(torch.double)
+    def test_autograd(self, device, dtype):
+        # All ragged ops are composites over differentiable view ops; check
+        # the gradients match the padded reference computation.
+        lengths = [2, 4]
+        values, offsets = make_ragged(
+            lengths, (3,), device, dtype, requires_grad=True)
+        mat2 = torch.randn(
+            2, 3, 3, device=device, dtype=dtype, requires_grad=True)
+
+        out = torch._ragged_softmax(
+            torch._ragged_bmm(values, offsets, mat2), offsets)
+        out.sum().backward()
+        values_grad, mat2_grad = values.grad.clone(), mat2.grad.clone()
+        values.grad = None
+        mat2.grad = None
+
+        padded = torch._padded_from_ragged(values, offsets)
+        ref = torch._ragged_from_padded(padded.bmm(mat2), offsets)
+        torch._ragged_softmax(ref, offsets).sum().backward()
+        self.assertEqual(values_grad, values.grad)
+        self.assertEqual(mat2_grad, mat2.grad)
+
+    def test_invalid_offsets(self, device):
+        values = torch.randn(5, 2, device=device)
+        with self.assertRaisesRegex(RuntimeError, "non-decreasing"):
+            torch._padded_from_ragged(
+                values, torch.tensor([0, 3, 2, 5], dtype=torch.int64))
+        with self.assertRaisesRegex(RuntimeError, "start at 0"):
+            torch._padded_from_ragged(
+                values, torch.tensor([1, 5], dtype=torch.int64))
+        with self.assertRaisesRegex(RuntimeError, "total number of rows"):
+            torch._padded_from_ragged(
+                values, torch.tensor([0, 4], dtype=torch.int64))
+        with self.assertRaisesRegex(RuntimeError, "CPU int64"):
+            torch._padded_from_ragged(
+                values, torch.tensor([0, 5], dtype=torch.int32))
+
+
+instantiate_device_type_tests(TestRaggedOps, globals())
+
+if __name__ == "__main__":
+    run_tests()
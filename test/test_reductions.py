@@ -1334,6 +1334,28 @@ class TestReductions(TestCase):
         expected_result = torch.tensor([2, 4, 3, 4], device=device)
         self.assertEqual(torch.searchsorted(boundaries, values_nan, right=True), expected_result)
 
+        # large 1d boundary, and more values than boundaries (CPU takes an Eytzinger-order path here)
+        boundaries = torch.arange(64, device=device, dtype=torch.float64)
+        values_large = torch.cat([
+            boundaries,
+            boundaries + 0.5,
+            torch.tensor([-1.0, 64.0, float('-inf'), float('inf'), float('nan')], device=device, dtype=torch.float64),
+        ])
+        expected_result = torch.cat([
+            torch.arange(64, device=device),
+            torch.arange(1, 65, device=device),
+            torch.tensor([0, 64, 0, 64, 64], device=device),
+        ])
+        self.assertEqual(torch.searchsorted(boundaries, values_large), expected_result)
+        self.assertEqual(torch.bucketize(values_large, boundaries), expected_result)
+        expected_result = torch.cat([
+            torch.arange(1, 65, device=device),
+            torch.arange(1, 65, device=device),
+            torch.tensor([0, 64, 0, 64, 64], device=device),
+        ])
+        self.assertEqual(torch.searchsorted(boundaries, values_large, right=True), expected_result)
+        self.assertEqual(torch.bucketize(values_large, boundaries, right=True), expected_result)
+
         # type promotion and non contiguous tensors
         values_3d_permute = values_3d.permute(2, 1, 0).to(torch.int32)
         boundaries_permute = values_3d.permute(2, 1, 0).to(torch.float64)
@@ -2344,6 +2366,57 @@ class TestReductions(TestCase):
                 torch_op(a, q, dim=dim, keepdim=keepdim, interpolation=interpolation, out=out)
                 self.assertEqual(out.cpu(), result.cpu())
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_approx_quantile(self, device, dtype):
+        # _approx_quantile is a bounded-rank-error sketch; validate against
+        # the empirical CDF rather than expecting exact agreement
+        n = 100000
+        for a in [torch.randn(n, dtype=dtype, device=device),
+                  torch.rand(n, dtype=dtype, device=device).pow(8)]:
+            q = torch.tensor([0., 0.25, 0.5, 0.9, 0.99, 1.], device=device)
+            result = torch._approx_quantile(a, q)
+            self.assertEqual(result.shape, q.shape)
+            for i in range(q.numel()):
+                # rank of the returned value should be within 1% of target
+                cdf = (a <= result[i]).to(torch.double).mean().item()
+                self.assertLessEqual(abs(cdf - q[i].item()), 0.01)
+            # larger sketches should not be less accurate at the median
+            coarse = torch._approx_quantile(a, torch.tensor(0.5), 64).item()
+            fine = torch._approx_quantile(a, torch.tensor(0.5), 8192).item()
+            cdf_coarse = (a <= coarse).to(torch.double).mean().item()
+            cdf_fine = (a <= fine).to(torch.double).mean().item()
+            self.assertLessEqual(abs(cdf_fine - 0.5), abs(cdf_coarse - 0.5) + 1e-3)
+            self.assertLessEqual(abs(cdf_fine - 0.5), 0.005)
+
+        # scalar q produces a 0-dim result of the input dtype
+        a = torch.randn(1000, dtype=dtype, device=device)
+        result = torch._approx_quantile(a, torch.tensor(0.5))
+        self.assertEqual(result.shape, torch.Size([]))
+        self.assertEqual(result.dtype, dtype)
+
+        # small inputs are held entirely in the sketch; only the
+        # interpolation between adjacent order statistics differs from
+        # torch.quantile, so ranks must agree to within one sample
+        a = torch.randn(100, dtype=dtype, device=device)
+        q = torch.rand(5, dtype=torch.double)
+        result = torch._approx_quantile(a, q)
+        for i in range(q.numel()):
+            cdf = (a <= result[i]).to(torch.double).mean().item()
+            self.assertLessEqual(abs(cdf - q[i].item()), 2. / a.numel())
+
+        def check(a, q, kwargs, message):
+            with self.assertRaisesRegex(RuntimeError, r'_approx_quantile\(\) ' + message):
+                torch._approx_quantile(
+                    torch.tensor(a, device=device),
+                    torch.tensor(q, device=device), **kwargs)
+
+        check([], 0.5, {}, r'input tensor must be non-empty')
+        check([1.], [[1.]], {}, r'q must be a scalar or 1D tensor')
+        check([1], 0.5, {}, r'input tensor must be either float or double dtype')
+        check([1.], [0.5, 1.1], {}, r'q values must be in the range \[0, 1\]')
+        check([1.], 0.5, {'sketch_size': 4}, r'sketch_size must be at least 8')
+
     def test_quantile_backward(self, device):
         def check(a, q, dim, expected_grad, ops=(torch.quantile, torch.nanquantile)):
             for op in ops:
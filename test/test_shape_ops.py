@@ -62,6 +62,33 @@ class TestShapeOps(TestCase):
                 self.assertEqual(x.select(dim, i), res[i])
                 self.assertEqual(x.select(dim, i), res2[i])
 
+    def test_append_inplace(self, device):
+        # dim 0 of a contiguous tensor is outermost in memory
+        x = torch.rand(2, 3, device=device)
+        steps = [torch.rand(1, 3, device=device) for _ in range(5)]
+        expected = torch.cat([x] + steps, 0)
+        for step in steps:
+            torch._append_(x, step, 0)
+        self.assertEqual(x, expected)
+
+        # appending along an inner dim requires it to be outermost in memory,
+        # as for a KV cache laid out [seq, batch, dim] and viewed transposed
+        cache = torch.rand(4, 2, 5, device=device).transpose(0, 1)
+        step = torch.rand(2, 1, 5, device=device)
+        expected = torch.cat([cache, step], 1)
+        torch._append_(cache, step, 1)
+        self.assertEqual(cache, expected)
+
+        # growing from empty, and dtype/shape validation
+        x = torch.empty(0, 3, device=device)
+        torch._append_(x, torch.ones(2, 3, device=device), 0)
+        self.assertEqual(x, torch.ones(2, 3, device=device))
+        self.assertRaises(RuntimeError, lambda: torch._append_(x, torch.ones(2, 4, device=device), 0))
+        self.assertRaises(RuntimeError, lambda: torch._append_(x, torch.ones(2, 3, device=device).long(), 0))
+        # inner dims of a contiguous tensor cannot be appended in place
+        self.assertRaises(RuntimeError, lambda: torch._append_(torch.rand(2, 3, device=device),
+                                                               torch.rand(2, 1, device=device), 1))
+
     # TODO: update to work on CUDA, too?
     @onlyCPU
     def test_tolist(self, device):
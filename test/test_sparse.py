@@ -232,6 +232,15 @@ class TestSparse(TestCase):
             t, _, _ = self._gen_sparse(len(sparse_size), nnz, sparse_size + dense_size, dtype, device, coalesced)
             _test_coalesce(t)  # this tests correctness
 
+        # inputs with pre-sorted indices take a CPU fast path that skips the
+        # sort; test both sorted-with-duplicates and sorted-and-unique inputs
+        i = torch.tensor([[0, 1, 1, 2, 4]], device=device)
+        v = torch.randn(5, 2, dtype=dtype, device=device)
+        _test_coalesce(torch.sparse_coo_tensor(i, v, (5, 2)))
+        i = torch.tensor([[0, 1, 3, 4]], device=device)
+        v = torch.randn(4, dtype=dtype, device=device)
+        _test_coalesce(torch.sparse_coo_tensor(i, v, (5,)))
+
     @dtypes(torch.double)
     def test_coalesce_reference_cycle(self, device, dtype):
         # Test coalesce doesn't create autograd graph cycles (gh-52253)
@@ -29,6 +29,9 @@ class StaticModule:
             args, kwargs, warmup_runs, main_runs
         )
 
+    def benchmark_allocations(self, args, kwargs, warmup_runs):
+        return self.static_module.benchmark_allocations(args, kwargs, warmup_runs)
+
 
 def linear_shim(
     input: torch.Tensor, weight: torch.Tensor, bias: Optional[torch.Tensor] = None
@@ -299,6 +302,29 @@ class TestStaticModule(TestCase):
         sm.benchmark([], {"x": input}, 2, 2)
         sm.benchmark_individual_ops([], {"x": input}, 2, 2)
 
+    def test_benchmark_allocations(self):
+        m = TestModule()
+        m.eval()
+        input = torch.randn(2, 2)
+        ms = torch.jit.script(m)
+        sm = StaticModule(ms)
+        metrics = sm.benchmark_allocations([input], {}, 2)
+        # Each node kind with a byte total must also have an allocation count,
+        # and the per-type numbers must add up to the iteration totals.
+        self.assertEqual(
+            set(metrics.bytes_per_node_type.keys()),
+            set(metrics.allocations_per_node_type.keys()),
+        )
+        self.assertGreaterEqual(
+            metrics.total_allocations,
+            sum(metrics.allocations_per_node_type.values()),
+        )
+        self.assertGreaterEqual(
+            metrics.total_allocated_bytes, sum(metrics.bytes_per_node_type.values())
+        )
+        # The advisor must leave the runtime reusable.
+        torch.testing.assert_close(m.forward(input), sm(input))
+
     @unittest.skip("Temporarily disabled")
     def test_fusion_trivial_graph(self):
         s = torch.full((2, 2), 2)
@@ -1159,6 +1159,24 @@ class TestTensorCreation(TestCase):
         result = torch.cat(concat_list)
         self.assertEqual(result.size(0), SIZE1 + SIZE2)
 
+    @onlyCPU
+    def test_cat_parallel(self, device):
+        # Large contiguous concatenations take a multi-threaded byte-copy
+        # path; exercise it across dtypes and cat dimensions, including an
+        # empty input, and check each slice of the result.
+        for dtype in (torch.uint8, torch.float, torch.complex64):
+            for dim in range(3):
+                tensors = []
+                for n in (3, 1, 7, 0, 5):
+                    size = [4, 60, 200]
+                    size[dim] = n
+                    tensors.append(make_tensor(size, device=device, dtype=dtype))
+                result = torch.cat(tensors, dim)
+                offset = 0
+                for t in tensors:
+                    self.assertEqual(result.narrow(dim, offset, t.size(dim)), t, atol=0, rtol=0)
+                    offset += t.size(dim)
+
     @onlyCPU
     def test_cat_bad_input_sizes(self, device):
         x = torch.randn(2, 1, device=device)
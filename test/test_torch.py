@@ -1948,6 +1948,41 @@ class AbstractTestCases:
                 with TemporaryDirectoryName(suffix='中文') as dname, TemporaryFileName(dir=dname) as fname:
                     assert_with_filename(fname)
 
+        @unittest.skipIf(IS_WINDOWS, "readonly mappings are not supported on Windows")
+        def test_torch_from_file_region(self):
+            def assert_with_filename(filename):
+                size = 100
+                data = torch.randn(3 * size)
+                with open(filename, 'wb') as f:
+                    f.write(data.numpy().tobytes())
+                itemsize = data.element_size()
+
+                # a read-only view of the middle chunk of the file
+                t = torch.from_file(filename, True, size, size * itemsize,
+                                    True, dtype=torch.float)
+                self.assertEqual(t, data[size:2 * size], atol=0, rtol=0)
+                self.assertEqual(t.storage_offset(), size)
+
+                # paging hints are advisory and must not change the contents
+                for advice in ('sequential', 'random', 'willneed', 'dontneed', 'normal'):
+                    t._mmap_advise(advice)
+                self.assertEqual(t, data[size:2 * size], atol=0, rtol=0)
+
+                # error cases
+                with self.assertRaisesRegex(RuntimeError, "unknown advice"):
+                    t._mmap_advise('bogus')
+                with self.assertRaisesRegex(RuntimeError, "not backed by a memory-mapped file"):
+                    torch.randn(3)._mmap_advise('willneed')
+                with self.assertRaisesRegex(RuntimeError, "readonly=True requires shared=True"):
+                    torch.from_file(filename, False, size, 0, True, dtype=torch.float)
+                with self.assertRaisesRegex(RuntimeError, "multiple of the element size"):
+                    torch.from_file(filename, True, size, 2, dtype=torch.float)
+
+                del t
+
+            with TemporaryFileName() as fname:
+                assert_with_filename(fname)
+
         def test_print(self):
             default_type = torch.tensor([]).type()
             for t in torch._tensor_classes:
@@ -8203,6 +8238,44 @@ class TestDevicePrecision(TestCase):
             actual = x[..., :1].clamp(lb, ub)
             self.assertEqual(expect, actual)
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double, torch.int64)
+    def test_fused_clip_where(self, device, dtype):
+        cmps = {
+            "gt": torch.gt,
+            "ge": torch.ge,
+            "lt": torch.lt,
+            "le": torch.le,
+            "eq": torch.eq,
+            "ne": torch.ne,
+        }
+        for noncontig in (False, True):
+            x = make_tensor((5, 1000), device=device, dtype=dtype,
+                            noncontiguous=noncontig)
+            other = make_tensor((5, 1000), device=device, dtype=dtype,
+                                noncontiguous=noncontig)
+            for name, cmp in cmps.items():
+                expect = torch.where(cmp(x, 0), x.clamp(-2, 3), other)
+                actual = torch._fused_clip_where(x, other, 0, name, min=-2, max=3)
+                self.assertEqual(expect, actual)
+
+            # both bounds are optional
+            self.assertEqual(torch.where(x > 0, x.clamp(min=-2), other),
+                             torch._fused_clip_where(x, other, 0, "gt", min=-2))
+            self.assertEqual(torch.where(x > 0, x.clamp(max=3), other),
+                             torch._fused_clip_where(x, other, 0, "gt", max=3))
+            self.assertEqual(torch.where(x > 0, x, other),
+                             torch._fused_clip_where(x, other, 0, "gt"))
+
+        # `other` broadcasts like any binary op
+        x = make_tensor((4, 8), device=device, dtype=dtype)
+        other = make_tensor((8,), device=device, dtype=dtype)
+        self.assertEqual(torch.where(x > 0, x.clamp(-2, 3), other.expand_as(x)),
+                         torch._fused_clip_where(x, other, 0, "gt", min=-2, max=3))
+
+        with self.assertRaisesRegex(RuntimeError, "unsupported comparison 'gte'"):
+            torch._fused_clip_where(x, other, 0, "gte")
+
 
 # we implemented custom deallocation for subclasses, so it behooves
 # us to make sure all of these bits work.  We'll use __del__ to
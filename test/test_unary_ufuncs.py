@@ -656,6 +656,29 @@ class TestUnaryUfuncs(TestCase):
                                             r"torch\.frexp\(\) expects exponent to have int dtype but got .+"):
                     torch.frexp(input, out=(mantissa, exponent))
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_fused_unary(self, device, dtype):
+        t = make_tensor((5, 1000), device, dtype, low=-5, high=5)
+        chains = [
+            ("neg", lambda x: x.neg()),
+            ("neg,exp", lambda x: x.neg().exp()),
+            ("abs,sqrt,reciprocal", lambda x: x.abs().sqrt().reciprocal()),
+            ("neg,exp,sigmoid", lambda x: x.neg().exp().sigmoid()),
+            ("tanh,frac", lambda x: x.tanh().frac()),
+        ]
+        for ops, ref in chains:
+            self.assertEqual(torch._fused_unary(t, ops), ref(t))
+
+        # integral inputs promote to float, like the individual ops
+        i = make_tensor((100,), device, torch.int, low=1, high=10)
+        self.assertEqual(torch._fused_unary(i, "neg,exp"), i.neg().exp())
+
+        with self.assertRaisesRegex(RuntimeError, "unsupported op 'clamp'"):
+            torch._fused_unary(t, "neg,clamp")
+        with self.assertRaisesRegex(RuntimeError, "expected at least one op"):
+            torch._fused_unary(t, "")
+
     def test_mvlgamma_argcheck(self, device):
         def run_test(d):
             input = torch.linspace((d - 2) / 2, 10, 10, device=device)
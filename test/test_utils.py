@@ -17,6 +17,7 @@ from torch.utils.data import DataLoader
 import torch.cuda
 from torch.utils.checkpoint import checkpoint, checkpoint_sequential
 import torch.utils.cpp_extension
+import torch.utils.op_queue
 import torch.hub as hub
 from torch.autograd._functions.utils import check_onnx_broadcast
 from torch.onnx.symbolic_opset9 import _prepare_onnx_paddings
@@ -837,6 +838,83 @@ class TestStandaloneCPPJIT(TestCase):
             shutil.rmtree(build_dir)
 
 
+class TestOpQueue(TestCase):
+    def test_defers_and_matches_eager(self):
+        queue = torch.utils.op_queue.OpQueue()
+        features = [torch.randn(8) for _ in range(10)]
+        scales = [random.uniform(0.5, 2.0) for _ in range(10)]
+        shifts = [random.uniform(-1.0, 1.0) for _ in range(10)]
+
+        outs = []
+        for feature, scale, shift in zip(features, scales, shifts):
+            x = queue.defer(feature)
+            outs.append(torch.tanh(x * scale + shift))
+        # Nothing has executed yet: three descriptors per feature.
+        self.assertEqual(queue.pending_ops(), 30)
+
+        for out, feature, scale, shift in zip(outs, features, scales, shifts):
+            self.assertEqual(out.materialize(), torch.tanh(feature * scale + shift))
+        self.assertEqual(queue.pending_ops(), 0)
+
+    def test_groups_like_ops_into_foreach_calls(self):
+        queue = torch.utils.op_queue.OpQueue()
+        features = [torch.randn(4) for _ in range(16)]
+        outs = [queue.defer(f) * 3.0 for f in features]
+
+        calls = []
+        original = torch._foreach_mul
+
+        def counting_foreach_mul(*args):
+            calls.append(len(args[0]))
+            return original(*args)
+
+        try:
+            torch._foreach_mul = counting_foreach_mul
+            queue.flush()
+        finally:
+            torch._foreach_mul = original
+
+        # All sixteen muls execute as a single grouped call.
+        self.assertEqual(calls, [16])
+        for out, feature in zip(outs, features):
+            self.assertEqual(out.materialize(), feature * 3.0)
+
+    def test_reads_and_unsupported_ops_flush(self):
+        queue = torch.utils.op_queue.OpQueue()
+        x = queue.defer(torch.ones(3)) + 1.0
+        self.assertEqual(queue.pending_ops(), 1)
+        # An op with no _foreach analogue runs eagerly on the flushed value.
+        self.assertEqual(torch.clamp(x, max=1.5), torch.full((3,), 1.5))
+        self.assertEqual(queue.pending_ops(), 0)
+
+        y = queue.defer(torch.ones(3)) * 2.0
+        self.assertEqual(y.sum().item(), 6.0)  # attribute read flushes
+
+    def test_mixed_operand_kinds_and_chains(self):
+        queue = torch.utils.op_queue.OpQueue()
+        a = torch.randn(5)
+        b = torch.randn(5)
+        x = queue.defer(a)
+        y = queue.defer(b)
+        out = -((x + y) / 2.0)
+        self.assertEqual(out.materialize(), -((a + b) / 2.0))
+        # Right-operand tensors on non-commutative ops fall back to eager.
+        z = a - (queue.defer(b) * 1.0)
+        self.assertEqual(z, a - b)
+
+    def test_large_tensors_execute_eagerly(self):
+        queue = torch.utils.op_queue.OpQueue(max_defer_numel=4)
+        big = torch.randn(10)
+        out = queue.defer(big) * 2.0
+        self.assertEqual(queue.pending_ops(), 0)
+        self.assertEqual(out.materialize(), big * 2.0)
+
+    def test_rejects_tensors_requiring_grad(self):
+        queue = torch.utils.op_queue.OpQueue()
+        with self.assertRaisesRegex(RuntimeError, "require grad"):
+            queue.defer(torch.randn(2, requires_grad=True))
+
+
 class DummyXPUModule(object):
     @staticmethod
     def is_available():
@@ -1324,6 +1324,62 @@ class TestVmapOperators(Namespace.TestVmapBase):
         with self.assertRaisesRegex(RuntimeError, msg):
             vmap(functools.partial(op, memory_format=torch.channels_last_3d))(tensor)
 
+    def test_conv2d(self):
+        test = self._vmap_test
+        B0 = 5
+        F = torch.nn.functional
+
+        def get_op(conv, **kwargs):
+            def op(inp, weight, bias):
+                return conv(inp, weight, bias, **kwargs)
+            return op
+
+        op = get_op(F.conv2d, padding=1)
+        inp = torch.rand(B0, 2, 4, 6, 6)
+        weight = torch.rand(B0, 3, 4, 3, 3)
+        bias = torch.rand(B0, 3)
+        test(op, (inp, weight[0], bias[0]), in_dims=(0, None, None))
+        test(op, (inp[0], weight, bias[0]), in_dims=(None, 0, None))
+        test(op, (inp[0], weight[0], bias), in_dims=(None, None, 0))
+        test(op, (inp, weight, bias))
+
+        # grouped convolution
+        op = get_op(F.conv2d, groups=2)
+        weight = torch.rand(B0, 6, 2, 3, 3)
+        bias = torch.rand(B0, 6)
+        test(op, (inp, weight[0], bias[0]), in_dims=(0, None, None))
+        test(op, (inp[0], weight, bias[0]), in_dims=(None, 0, None))
+        test(op, (inp, weight, bias))
+
+        # grouped transposed convolution
+        op = get_op(F.conv_transpose2d, groups=2)
+        weight = torch.rand(B0, 4, 3, 3, 3)
+        bias = torch.rand(B0, 6)
+        test(op, (inp, weight[0], bias[0]), in_dims=(0, None, None))
+        test(op, (inp[0], weight, bias[0]), in_dims=(None, 0, None))
+        test(op, (inp, weight, bias))
+
+    def test_group_norm(self):
+        test = self._vmap_test
+        B0, B1 = 5, 7
+
+        def op(inp, weight, bias):
+            return torch.nn.functional.group_norm(inp, 2, weight, bias)
+
+        inp = torch.rand(B0, 3, 4, 6, 6)
+        weight = torch.rand(B0, 4)
+        bias = torch.rand(B0, 4)
+        test(op, (inp, weight[0], bias[0]), in_dims=(0, None, None))
+        test(op, (inp[0], weight, bias[0]), in_dims=(None, 0, None))
+        test(op, (inp[0], weight[0], bias), in_dims=(None, None, 0))
+        test(op, (inp, weight, bias))
+
+        # doubly nested vmap
+        inp = torch.rand(B1, B0, 3, 4, 6, 6)
+        weight = torch.rand(4)
+        bias = torch.rand(4)
+        test(vmap(lambda t: op(t, weight, bias)), (inp,), in_dims=1, out_dims=1)
+
     def test_stride(self):
         B0 = 3
 
@@ -27,6 +27,10 @@ struct TORCH_API ${op} : public ${superclass} {
     ${thread_lock}
     ${release_variables}
   }
+  void prefetch_saved_variables() override {
+    ${thread_lock}
+    ${prefetch_variables}
+  }
   ${will_release_variables}
   ${saved_variables}
   ${saved_list_sizes}
@@ -357,6 +361,7 @@ def gen_autograd_functions_python(
 def process_function(info: DifferentiabilityInfo, template: CodeTemplate) -> str:
     saved_variables: List[str] = []
     release_variables: List[str] = []
+    prefetch_variables: List[str] = []
     saved_list_sizes: List[str] = []
     unpack: List[str] = []
     asserts: List[str] = []
@@ -383,6 +388,7 @@ def process_function(info: DifferentiabilityInfo, template: CodeTemplate) -> str
                 (type == BaseCType(scalarT) and is_output):
             saved_variables.append(f'SavedVariable {name}_;')
             release_variables.append(f'{name}_.reset_data();')
+            prefetch_variables.append(f'{name}_.prefetch();')
             ptr = 'shared_from_this()' if is_output else ''
             unpack.append(f'auto {name} = {name}_.unpack({ptr});')
             getter_definitions.append(GETTER_DEFINITION_SAVEDVAR.substitute(
@@ -397,6 +403,7 @@ def process_function(info: DifferentiabilityInfo, template: CodeTemplate) -> str
             # Because the SavedVariable owns a tensor and a grad_fn, removing the SavedVariable makes them go away as well.
             release_variables.append(f'{name}_.clear();')
             release_variables.append(f'{name}_released_ = true;')
+            prefetch_variables.append(f'for (auto& v : {name}_) v.prefetch();')
             unpack.append(f'auto {name} = unpack_list({name}_);')
             asserts.append(f'TORCH_CHECK(!{name}_released_, ERR_BACKWARD_TWICE);')
             getter_definitions.append(GETTER_DEFINITION_VEC_SAVEDVAR.substitute(
@@ -411,6 +418,7 @@ def process_function(info: DifferentiabilityInfo, template: CodeTemplate) -> str
             # Because the SavedVariable owns a tensor and a grad_fn, removing the SavedVariable makes them go away as well.
             release_variables.append(f'{name}_.clear();')
             release_variables.append(f'{name}_released_ = true;')
+            prefetch_variables.append(f'for (auto& v : {name}_) v.prefetch();')
             unpack.append(f'auto {name} = unpack_opt_list({name}_);')
             asserts.append(f'TORCH_CHECK(!{name}_released_, ERR_BACKWARD_TWICE);')
             getter_definitions.append(GETTER_DEFINITION_VEC_SAVEDVAR.substitute(
@@ -546,6 +554,7 @@ def process_function(info: DifferentiabilityInfo, template: CodeTemplate) -> str
         compute_index_ranges=compute_index_ranges,
         saved_variables=saved_variables,
         release_variables=release_variables,
+        prefetch_variables=prefetch_variables,
         saved_list_sizes=saved_list_sizes,
         asserts=asserts,
         thread_lock=thread_lock,
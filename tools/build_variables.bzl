@@ -114,6 +114,7 @@ core_sources_common = [
     "torch/csrc/jit/runtime/vararg_functions.cpp",
     "torch/csrc/jit/mobile/promoted_prim_ops.cpp",
     "torch/csrc/jit/mobile/prim_ops_registery.cpp",
+    "torch/csrc/jit/mobile/direct_call_registry.cpp",
     "torch/csrc/jit/serialization/import_read.cpp",
     "torch/csrc/jit/serialization/unpickler.cpp",
 ]
@@ -124,6 +125,8 @@ libtorch_sources_common = core_sources_common
 libtorch_profiler_sources = [
     "torch/csrc/autograd/profiler_legacy.cpp",
     "torch/csrc/autograd/profiler_kineto.cpp",
+    "torch/csrc/autograd/profiler_sampling.cpp",
+    "torch/csrc/autograd/profiler_histogram.cpp",
 ]
 
 libtorch_edge_profiler_sources = libtorch_profiler_sources + [
@@ -145,7 +148,9 @@ core_trainer_sources = [
     "torch/csrc/autograd/functions/utils.cpp",
     "torch/csrc/autograd/input_buffer.cpp",
     "torch/csrc/autograd/record_function_ops.cpp",
+    "torch/csrc/autograd/request_trace.cpp",
     "torch/csrc/autograd/saved_variable.cpp",
+    "torch/csrc/autograd/saved_variable_offload_hooks.cpp",
     "torch/csrc/autograd/variable.cpp",
     "torch/csrc/autograd/utils/warnings.cpp",
     "torch/csrc/jit/frontend/name_mangler.cpp",
@@ -189,6 +194,7 @@ core_sources_full_mobile_no_backend_interface = [
     "torch/csrc/jit/ir/subgraph_matcher.cpp",
     "torch/csrc/jit/jit_log.cpp",
     "torch/csrc/jit/jit_opt_limit.cpp",
+    "torch/csrc/jit/jit_pass_timing.cpp",
     "torch/csrc/jit/mobile/nnc/aot_compiler.cpp",
     "torch/csrc/jit/mobile/nnc/backend.cpp",
     "torch/csrc/jit/mobile/nnc/context.cpp",
@@ -213,7 +219,10 @@ core_sources_full_mobile_no_backend_interface = [
     "torch/csrc/jit/passes/erase_number_types.cpp",
     "torch/csrc/jit/passes/fixup_trace_scope_blocks.cpp",
     "torch/csrc/jit/passes/freeze_module.cpp",
+    "torch/csrc/jit/passes/fuse_attention.cpp",
+    "torch/csrc/jit/passes/fuse_dropout_add_layer_norm.cpp",
     "torch/csrc/jit/passes/fuse_linear.cpp",
+    "torch/csrc/jit/passes/fuse_parallel_linear.cpp",
     "torch/csrc/jit/passes/fuse_relu.cpp",
     "torch/csrc/jit/passes/graph_fuser.cpp",
     "torch/csrc/jit/passes/graph_rewrite_helper.cpp",
@@ -231,6 +240,7 @@ core_sources_full_mobile_no_backend_interface = [
     "torch/csrc/jit/passes/lower_grad_of.cpp",
     "torch/csrc/jit/passes/lower_tuples.cpp",
     "torch/csrc/jit/passes/normalize_ops.cpp",
+    "torch/csrc/jit/passes/parallelize_branches.cpp",
     "torch/csrc/jit/passes/peephole_dict_idioms.cpp",
     "torch/csrc/jit/passes/peephole_list_idioms.cpp",
     "torch/csrc/jit/passes/value_refinement_utils.cpp",
@@ -275,11 +285,13 @@ core_sources_full_mobile_no_backend_interface = [
     "torch/csrc/jit/python/update_graph_executor_opt.cpp",
     "torch/csrc/jit/runtime/argument_spec.cpp",
     "torch/csrc/jit/runtime/autodiff.cpp",
+    "torch/csrc/jit/runtime/cuda_graph_executor.cpp",
     "torch/csrc/jit/runtime/graph_executor.cpp",
     "torch/csrc/jit/runtime/interpreter/frame.cpp",
     "torch/csrc/jit/runtime/interpreter/preprocess_graph.cpp",
     "torch/csrc/jit/runtime/interpreter.cpp",
     "torch/csrc/jit/runtime/logging.cpp",
+    "torch/csrc/jit/runtime/pipeline.cpp",
     "torch/csrc/jit/runtime/profiling_graph_executor_impl.cpp",
     "torch/csrc/jit/runtime/profiling_record.cpp",
     "torch/csrc/jit/runtime/script_profile.cpp",
@@ -396,9 +408,11 @@ libtorch_distributed_extra_sources = [
     "torch/csrc/distributed/autograd/context/container.cpp",
     "torch/csrc/distributed/autograd/context/context.cpp",
     "torch/csrc/distributed/autograd/engine/dist_engine.cpp",
+    "torch/csrc/distributed/autograd/engine/gradient_coalescer.cpp",
     "torch/csrc/distributed/autograd/functions/recvrpc_backward.cpp",
     "torch/csrc/distributed/autograd/functions/sendrpc_backward.cpp",
     "torch/csrc/distributed/autograd/rpc_messages/autograd_metadata.cpp",
+    "torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_batch_req.cpp",
     "torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_req.cpp",
     "torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_resp.cpp",
     "torch/csrc/distributed/autograd/rpc_messages/cleanup_autograd_context_req.cpp",
@@ -605,6 +619,7 @@ libtorch_cuda_core_sources = [
     "torch/csrc/jit/codegen/cuda/type.cpp",
     "torch/csrc/jit/codegen/cuda/utils.cpp",
     "torch/csrc/jit/tensorexpr/cuda_codegen.cpp",
+    "torch/csrc/jit/runtime/cuda_graph_executor_impl.cpp",
     "torch/csrc/jit/runtime/register_cuda_ops.cpp",
 ]
 
@@ -629,6 +644,7 @@ libtorch_cuda_sources = libtorch_cuda_core_sources + libtorch_cuda_distributed_s
 ]
 
 torch_cpp_srcs = [
+    "torch/csrc/api/src/batching.cpp",
     "torch/csrc/api/src/cuda.cpp",  # this just forwards stuff, no real CUDA
     "torch/csrc/api/src/data/datasets/mnist.cpp",
     "torch/csrc/api/src/data/samplers/distributed.cpp",
@@ -969,6 +985,7 @@ aten_native_source_codegen_list = [
     "aten/src/ATen/native/cpu/DistanceOpsKernel.cpp",
     "aten/src/ATen/native/cpu/DistributionKernels.cpp",
     "aten/src/ATen/native/cpu/FillKernel.cpp",
+    "aten/src/ATen/native/cpu/ForeachOpsKernel.cpp",
     "aten/src/ATen/native/cpu/FunctionOfAMatrixUtilsKernel.cpp",
     "aten/src/ATen/native/cpu/GridSamplerKernel.cpp",
     "aten/src/ATen/native/cpu/HistogramKernel.cpp",
@@ -1065,6 +1082,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/AdaptiveMaxPooling2d.cpp",
     "aten/src/ATen/native/AdaptiveMaxPooling3d.cpp",
     "aten/src/ATen/native/AffineGridGenerator.cpp",
+    "aten/src/ATen/native/Attention.cpp",
     "aten/src/ATen/native/AveragePool2d.cpp",
     "aten/src/ATen/native/AveragePool3d.cpp",
     "aten/src/ATen/native/BatchLinearAlgebra.cpp",
@@ -1110,6 +1128,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/LegacyBridge.cpp",
     "aten/src/ATen/native/Lerp.cpp",
     "aten/src/ATen/native/Linear.cpp",
+    "aten/src/ATen/native/PackedLinear.cpp",
     "aten/src/ATen/native/LinearAlgebra.cpp",
     "aten/src/ATen/native/Loss.cpp",
     "aten/src/ATen/native/LossCTC.cpp",
@@ -1135,6 +1154,7 @@ aten_native_source_non_codegen_list = [
     "aten/src/ATen/native/Pow.cpp",
     "aten/src/ATen/native/QuantizedLinear.cpp",
     "aten/src/ATen/native/RNN.cpp",
+    "aten/src/ATen/native/RaggedOps.cpp",
     "aten/src/ATen/native/RangeFactories.cpp",
     "aten/src/ATen/native/ReduceAllOps.cpp",
     "aten/src/ATen/native/ReduceOps.cpp",
@@ -0,0 +1,169 @@
+"""Generates RegisterMobileDirectCalls.cpp, a table of unboxed call stubs
+for the mobile (lite) interpreter.
+
+The mobile interpreter normally resolves each operator to a boxed kernel:
+every call boxes its arguments into IValues, walks the dispatcher, and
+unboxes on the other side. For models dominated by tiny ops the boxing
+round trip is a large fraction of the per-op cost. This generator emits,
+for every selected operator with a directly representable signature, a
+stub that pops the operator's arguments off the interpreter stack, calls
+the unboxed at:: C++ API and pushes the result back - one plain function
+call per op, with no IValue boxing of intermediates.
+
+The stubs register themselves into the table in
+torch/csrc/jit/mobile/direct_call_registry.h; Function::append_operator
+consults that table at load time, so the per-call fast path needs no
+lookup at all.
+
+Only functional operators whose arguments and returns all have direct
+IValue accessors get a stub; everything else (mutating/out variants,
+operators taking e.g. strings, generators or tensor lists) keeps going
+through the regular resolution path, which stays fully supported.
+
+Intended to be driven by the same selective-build configuration as the
+rest of the mobile codegen, e.g.:
+
+  python -m tools.codegen.gen_mobile_direct_calls \\
+      --op_selection_yaml_path <SELECTED_OP_LIST>    \\
+      --install_dir build/aten/src/ATen
+"""
+
+import argparse
+import os
+from typing import List, Optional, Tuple
+
+from tools.codegen.api.types import CppSignatureGroup
+from tools.codegen.context import with_native_function
+from tools.codegen.gen import FileManager, parse_native_yaml
+from tools.codegen.model import NativeFunction, SchemaKind, Variant
+from tools.codegen.selective_build.selector import SelectiveBuilder
+from tools.codegen.utils import mapMaybe
+
+# C++ argument type (as rendered by the faithful cpp signature) to the
+# IValue accessor producing it. Types without an entry disqualify the
+# operator from getting a stub.
+IVALUE_ACCESSORS = {
+    'const at::Tensor &': 'toTensor()',
+    'const c10::optional<at::Tensor> &': 'toOptional<at::Tensor>()',
+    'const at::Scalar &': 'toScalar()',
+    'const c10::optional<at::Scalar> &': 'toOptional<at::Scalar>()',
+    'int64_t': 'toInt()',
+    'c10::optional<int64_t>': 'toOptional<int64_t>()',
+    'double': 'toDouble()',
+    'c10::optional<double>': 'toOptional<double>()',
+    'bool': 'toBool()',
+    'c10::optional<bool>': 'toOptional<bool>()',
+    'at::IntArrayRef': 'toIntVector()',
+    'at::ScalarType': 'toScalarType()',
+    'c10::optional<at::ScalarType>': 'toOptional<at::ScalarType>()',
+    'c10::optional<at::Layout>': 'toOptional<at::Layout>()',
+    'c10::optional<at::Device>': 'toOptional<at::Device>()',
+    'c10::optional<at::MemoryFormat>': 'toOptional<at::MemoryFormat>()',
+}
+
+
+def stub_name(f: NativeFunction) -> str:
+    # aten::add.Tensor -> direct_call_aten_add_Tensor
+    return 'direct_call_aten_{}'.format(str(f.func.name).replace('.', '_'))
+
+
+def qualified_name(f: NativeFunction) -> str:
+    # Must match c10::toString(c10::OperatorName), the key used by
+    # Function::append_operator.
+    return 'aten::{}'.format(f.func.name)
+
+
+@with_native_function
+def compute_direct_call(f: NativeFunction) -> Optional[Tuple[str, str]]:
+    """Returns (stub definition, registration) or None if ineligible."""
+    # Mutating and out= variants return references into their arguments;
+    # keep them on the regular path.
+    if f.func.kind() is not SchemaKind.functional:
+        return None
+    if Variant.function not in f.variants:
+        return None
+    if f.manual_cpp_binding:
+        return None
+    sig = CppSignatureGroup.from_native_function(
+        f, method=False).most_faithful_signature()
+    args = sig.arguments()
+    # The faithful signature mirrors the schema's flat argument list, which
+    # is exactly the boxed stack layout; anything gathered would not.
+    num_schema_args = len(f.func.arguments.flat_positional) + \
+        len(f.func.arguments.flat_kwarg_only) + len(f.func.arguments.out)
+    if len(args) != num_schema_args:
+        return None
+    n = len(args)
+    conversions: List[str] = []
+    for i, binding in enumerate(args):
+        accessor = IVALUE_ACCESSORS.get(binding.type)
+        if accessor is None:
+            return None
+        conversions.append(
+            f'  auto {binding.name} = (std::move(peek(stack, {i}, {n}))).{accessor};')
+    arg_names = ', '.join(binding.name for binding in args)
+    body = '\n'.join(conversions)
+    if len(f.func.returns) == 0:
+        call = f'  at::{sig.name()}({arg_names});\n  drop(stack, {n});'
+    else:
+        call = (f'  auto result = at::{sig.name()}({arg_names});\n'
+                f'  drop(stack, {n});\n'
+                f'  pack(stack, std::move(result));')
+    definition = (f'void {stub_name(f)}(Stack& stack) {{\n'
+                  f'{body}\n'
+                  f'{call}\n'
+                  f'}}\n')
+    registration = (f'static const direct_call_fn_register {stub_name(f)}_reg(\n'
+                    f'    "{qualified_name(f)}", {stub_name(f)});')
+    return definition, registration
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description='Generate unboxed direct call stubs for the mobile interpreter')
+    parser.add_argument(
+        '-s', '--source-path',
+        default='aten/src/ATen',
+        help='path to source directory for ATen')
+    parser.add_argument(
+        '--install_dir',
+        default='build/aten/src/ATen',
+        help='output directory')
+    parser.add_argument(
+        '--op_selection_yaml_path',
+        default=None,
+        help='path to the selective build yaml; all eligible operators get '
+             'stubs when omitted')
+    parser.add_argument(
+        '--dry-run', action='store_true',
+        help='run without writing any files')
+    options = parser.parse_args()
+
+    if options.op_selection_yaml_path is not None:
+        selector = SelectiveBuilder.from_yaml_path(options.op_selection_yaml_path)
+    else:
+        selector = SelectiveBuilder.get_nop_selector()
+
+    native_yaml_path = f'{options.source_path}/native/native_functions.yaml'
+    native_functions = parse_native_yaml(native_yaml_path).native_functions
+    selected = [
+        f for f in native_functions
+        if selector.is_native_function_selected(f)
+    ]
+
+    direct_calls = list(mapMaybe(compute_direct_call, selected))
+
+    if not options.dry_run:
+        os.makedirs(options.install_dir, exist_ok=True)
+    fm = FileManager(
+        install_dir=options.install_dir,
+        template_dir=f'{options.source_path}/templates',
+        dry_run=options.dry_run)
+    fm.write('RegisterMobileDirectCalls.cpp', lambda: {
+        'direct_call_definitions': [definition for definition, _ in direct_calls],
+        'direct_call_registrations': [registration for _, registration in direct_calls],
+    })
+
+
+if __name__ == '__main__':
+    main()
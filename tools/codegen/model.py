@@ -585,6 +585,7 @@ def is_foreach_op(name: str) -> bool:
         '_foreach_addcdiv_.Scalar',
         '_foreach_addcmul_.ScalarList',
         '_foreach_addcdiv_.ScalarList',
+        '_foreach_copy_',
         '_foreach_zero_'])
 
 @dataclass(frozen=True)
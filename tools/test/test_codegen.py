@@ -4,6 +4,7 @@ import unittest
 
 from tools.autograd import gen_autograd_functions
 from tools.autograd import load_derivatives
+from tools.codegen import gen_mobile_direct_calls
 import tools.codegen.model
 
 class TestCreateDerivative(unittest.TestCase):
@@ -126,6 +127,37 @@ class TestGenAutogradFunctions(unittest.TestCase):
         assert 'grad_z = grads[1]' in definition
 
 
+class TestMobileDirectCalls(unittest.TestCase):
+
+    def _native_function(self, specification: str) -> 'tools.codegen.model.NativeFunction':
+        schema = tools.codegen.model.FunctionSchema.parse(specification)
+        return dataclasses.replace(DEFAULT_NATIVE_FUNCTION, func=schema)
+
+    def test_functional_op_gets_stub(self) -> None:
+        f = self._native_function(
+            'func(Tensor self, Scalar alpha, int dim) -> Tensor')
+        result = gen_mobile_direct_calls.compute_direct_call(f)
+        assert result is not None
+        definition, registration = result
+        self.assertIn('void direct_call_aten_func(Stack& stack)', definition)
+        self.assertIn(
+            'auto self = (std::move(peek(stack, 0, 3))).toTensor();', definition)
+        self.assertIn(
+            'auto alpha = (std::move(peek(stack, 1, 3))).toScalar();', definition)
+        self.assertIn('auto result = at::func(self, alpha, dim);', definition)
+        self.assertIn('drop(stack, 3);', definition)
+        self.assertIn('pack(stack, std::move(result));', definition)
+        self.assertIn('"aten::func"', registration)
+
+    def test_inplace_op_gets_no_stub(self) -> None:
+        f = self._native_function('func_(Tensor(a!) self) -> Tensor(a!)')
+        self.assertIsNone(gen_mobile_direct_calls.compute_direct_call(f))
+
+    def test_unsupported_argument_type_gets_no_stub(self) -> None:
+        f = self._native_function('func(Tensor self, str mode) -> Tensor')
+        self.assertIsNone(gen_mobile_direct_calls.compute_direct_call(f))
+
+
 # Represents the most basic NativeFunction. Use dataclasses.replace()
 # to edit for use.
 DEFAULT_NATIVE_FUNCTION, _ = tools.codegen.model.NativeFunction.from_yaml(
@@ -63,6 +63,7 @@ class ProfilerEvent:
     def shapes(self) -> List[List[int]]: ...
     def thread_id(self) -> int: ...
     def flops(self) -> float: ...
+    def input_bytes(self) -> int: ...
     def is_async(self) -> bool: ...
     ...
 
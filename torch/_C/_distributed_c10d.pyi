@@ -120,6 +120,12 @@ class Store:
     def wait(self, keys: List[str]): ...
     @overload
     def wait(self, keys: List[str], timeout: timedelta): ...
+    @overload
+    def barrier(self, prefix: str, rank: int, world_size: int): ...
+    @overload
+    def barrier(self, prefix: str, rank: int, world_size: int, timeout: timedelta): ...
+    def broadcast(self, prefix: str, rank: int, world_size: int, value: str = ...) -> bytes: ...
+    def all_gather(self, prefix: str, rank: int, world_size: int, value: str) -> List[bytes]: ...
 
 class FileStore(Store):
     def __init__(self, path: str, numWorkers: int = ...): ...
@@ -365,6 +371,14 @@ class ProcessGroupNCCL(ProcessGroup):
     def _group_start() -> None: ...
     @staticmethod
     def _group_end() -> None: ...
+    def alltoall_permute(
+        self,
+        output: Tensor,
+        input: Tensor,
+        permutation: Tensor,
+        output_split_sizes: List[int] = ...,
+        input_split_sizes: List[int] = ...,
+    ) -> Work: ...
     ...
 
 class ProcessGroupMPI(ProcessGroup):
@@ -276,3 +276,35 @@ def _vmap(func: Callable, in_dims: in_dims_t = 0, out_dims: out_dims_t = 0, allo
         finally:
             torch._C._vmapmode_decrement_nesting()
     return wrapped
+
+def _ops_with_batching_rules() -> List[str]:
+    # Names of all operators with a real batching rule; everything else hits
+    # the (slow) per-example fallback under vmap.
+    return sorted(torch._C._debug_vmap_ops_with_batching_rules())
+
+def _check_vmap_fallback_ops(fn) -> List[str]:
+    """
+    Given a scripted function or module, returns the names of the aten
+    operators in its graph that do not have a batching rule and would
+    therefore run through the sequential vmap fallback. This is a debugging
+    aid for finding the source of vmap performance cliffs; it is a static
+    overapproximation (an op may appear in the graph but never run under
+    vmap, and overloads are not distinguished).
+    """
+    covered = set()
+    for name in torch._C._debug_vmap_ops_with_batching_rules():
+        # OperatorNames print as "aten::foo" or "aten::foo.overload".
+        covered.add(name.split('.')[0])
+
+    fallback_ops = set()
+
+    def visit(nodes):
+        for node in nodes:
+            kind = node.kind()
+            if kind.startswith('aten::') and kind not in covered:
+                fallback_ops.add(kind)
+            for block in node.blocks():
+                visit(block.nodes())
+
+    visit(fn.graph.nodes())
+    return sorted(fallback_ops)
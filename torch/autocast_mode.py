@@ -177,15 +177,17 @@ class autocast(object):
         torch.set_autocast_cache_enabled(self._cache_enabled)
 
     def __exit__(self, *args):
-        # Drop the cache when we exit to a nesting level that's outside any instance of autocast.
+        # Prune the cache when we exit to a nesting level that's outside any instance of autocast.
+        # Pruning keeps casted copies of unmutated leaf weights for the next forward pass, but
+        # drops anything that would retain an autograd graph or whose source was mutated in place.
         if self.device == 'cpu':
             if torch.autocast_decrement_nesting() == 0:
-                torch.clear_autocast_cache()
+                torch.prune_autocast_cache()
             torch.set_autocast_cpu_enabled(self.prev)
             torch.set_autocast_cpu_dtype(self.prev_fastdtype)
         else:
             if torch.autocast_decrement_nesting() == 0:
-                torch.clear_autocast_cache()
+                torch.prune_autocast_cache()
             torch.set_autocast_enabled(self.prev)
             torch.set_autocast_gpu_dtype(self.prev_fastdtype)
         torch.set_autocast_cache_enabled(self.prev_cache_enabled)
@@ -212,6 +212,7 @@ def _parse_legacy_records(thread_records):
                 )
                 is_remote_event = record.is_remote()
                 start_flops = start.flops()
+                start_input_bytes = start.input_bytes()
 
                 fe = FunctionEvent(
                     id=record.handle(),
@@ -233,6 +234,7 @@ def _parse_legacy_records(thread_records):
                     device_type=DeviceType.CPU,
                     is_legacy=True,
                     flops=start_flops,
+                    input_bytes=start_input_bytes,
                 )
                 # note: async events have only cpu total time
                 if not is_async and start.has_cuda():
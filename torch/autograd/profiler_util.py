@@ -300,6 +300,122 @@ class EventList(list):
         total_stat.key = 'Total'
         return total_stat
 
+    def roofline_analysis(self, peak_flops, peak_bandwidth):
+        """Annotates events with a simple roofline model.
+
+        Requires the profiler to have been run with ``with_flops=True`` so
+        that events carry estimated flops and input bytes. The recorded bytes
+        only count tensor inputs, so arithmetic intensities are upper bounds
+        and achieved ratios may slightly exceed reality for ops with large
+        outputs.
+
+        Every event with both flops and input bytes recorded gains three
+        attributes:
+
+        - ``arithmetic_intensity``: flops per byte moved;
+        - ``is_memory_bound``: True if the intensity is below the machine
+          balance point ``peak_flops / peak_bandwidth``;
+        - ``roofline_ratio``: achieved flop rate relative to the roofline
+          ceiling at that intensity, i.e. how much measured headroom is left.
+
+        Args:
+            peak_flops (float): peak compute rate of the device, in
+                floating point operations per second.
+            peak_bandwidth (float): peak memory bandwidth of the device, in
+                bytes per second.
+
+        Returns:
+            A list of ``(event, roofline_ratio)`` pairs for the annotated
+            events, sorted by total time spent, descending.
+        """
+        assert peak_flops > 0 and peak_bandwidth > 0, \
+            "peak_flops and peak_bandwidth must be positive"
+        balance = peak_flops / peak_bandwidth
+        annotated = []
+        for evt in self:
+            flops = evt.flops or 0
+            nbytes = getattr(evt, "input_bytes", 0) or 0
+            time_us = evt.cuda_time_total if evt.cuda_time_total > 0 else evt.cpu_time_total
+            if flops <= 0 or nbytes <= 0 or time_us <= 0:
+                continue
+            intensity = flops / nbytes
+            attainable = min(peak_flops, intensity * peak_bandwidth)
+            evt.arithmetic_intensity = intensity
+            evt.is_memory_bound = intensity < balance
+            evt.roofline_ratio = (flops / (time_us / 1e6)) / attainable
+            annotated.append((evt, evt.roofline_ratio))
+        annotated.sort(
+            key=lambda pair: max(pair[0].cuda_time_total, pair[0].cpu_time_total),
+            reverse=True)
+        return annotated
+
+    def fusion_opportunities(self, peak_flops, peak_bandwidth, min_run_length=2):
+        """Finds runs of adjacent memory-bound ops that are fusion candidates.
+
+        Runs a :meth:`roofline_analysis` pass, then scans top-level events on
+        each thread in execution order. Consecutive memory-bound ops whose
+        first input shape matches the previous op's first input shape are
+        grouped: elementwise ops produce outputs shaped like their inputs, so
+        matching shapes are a heuristic for a producer/consumer chain on the
+        same tensor (the profiler does not record tensor identities). Fusing
+        such a run eliminates the intermediate writes and re-reads, so the
+        run's total recorded bytes bound the achievable bandwidth saving.
+
+        Intended for the raw event list; averaged events carry no timeline
+        ordering to scan.
+
+        Args:
+            peak_flops (float): as in :meth:`roofline_analysis`.
+            peak_bandwidth (float): as in :meth:`roofline_analysis`.
+            min_run_length (int): minimum number of chained memory-bound ops
+                for a run to be reported. Default: 2.
+
+        Returns:
+            A list of dicts with keys ``events``, ``total_bytes`` and
+            ``total_time_us``, sorted by ``total_bytes``, descending.
+        """
+        self.roofline_analysis(peak_flops, peak_bandwidth)
+        events_by_thread: Dict[int, List[FunctionEvent]] = defaultdict(list)
+        for evt in self:
+            if getattr(evt, "cpu_parent", None) is not None:
+                continue
+            thread = getattr(evt, "thread", None)
+            if thread is None or not hasattr(evt, "time_range"):
+                continue
+            events_by_thread[thread].append(evt)
+
+        def chains(prev, evt):
+            return (prev.input_shapes and evt.input_shapes
+                    and prev.input_shapes[0]
+                    and prev.input_shapes[0] == evt.input_shapes[0])
+
+        runs = []
+
+        def flush(run):
+            if len(run) >= min_run_length:
+                runs.append({
+                    "events": run,
+                    "total_bytes": sum(e.input_bytes or 0 for e in run),
+                    "total_time_us": sum(
+                        max(e.cuda_time_total, e.cpu_time_total) for e in run),
+                })
+
+        for thread_events in events_by_thread.values():
+            thread_events.sort(key=lambda evt: evt.time_range.start)
+            run: List[FunctionEvent] = []
+            for evt in thread_events:
+                if getattr(evt, "is_memory_bound", False):
+                    if run and not chains(run[-1], evt):
+                        flush(run)
+                        run = []
+                    run.append(evt)
+                else:
+                    flush(run)
+                    run = []
+            flush(run)
+        runs.sort(key=lambda r: r["total_bytes"], reverse=True)
+        return runs
+
 
 def _format_time(time_us):
     """Defines how to format time in FunctionEvent"""
@@ -375,7 +491,7 @@ class FunctionEvent(FormattedTimesMixin):
             self, id, name, thread, start_us, end_us, fwd_thread=None, input_shapes=None,
             stack=None, scope=0, cpu_memory_usage=0, cuda_memory_usage=0, is_async=False,
             is_remote=False, sequence_nr=-1, node_id=-1, device_type=DeviceType.CPU, device_index=0,
-            is_legacy=False, flops=None, trace_name=None):
+            is_legacy=False, flops=None, input_bytes=None, trace_name=None):
         self.id: int = id
         self.node_id: int = node_id
         self.name: str = name
@@ -399,6 +515,7 @@ class FunctionEvent(FormattedTimesMixin):
         self.device_index: int = device_index
         self.is_legacy: bool = is_legacy
         self.flops: Optional[int] = flops
+        self.input_bytes: Optional[int] = input_bytes
 
     def append_kernel(self, name, device, duration):
         assert self.device_type == DeviceType.CPU
@@ -542,6 +659,7 @@ class FunctionEventAvg(FormattedTimesMixin):
         self.device_type: DeviceType = DeviceType.CPU
         self.is_legacy: bool = False
         self.flops: int = 0
+        self.input_bytes: int = 0
 
     def add(self, other):
         if self.key is None:
@@ -575,6 +693,10 @@ class FunctionEventAvg(FormattedTimesMixin):
             self.flops = other.flops
         elif other.flops is not None:
             self.flops += other.flops
+        if self.input_bytes is None:
+            self.input_bytes = other.input_bytes
+        elif other.input_bytes is not None:
+            self.input_bytes += other.input_bytes
         return self
 
     def __iadd__(self, other):
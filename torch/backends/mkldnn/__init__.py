@@ -7,26 +7,47 @@ def is_available():
     r"""Returns whether PyTorch is built with MKL-DNN support."""
     return torch._C.has_mkldnn
 
-def set_flags(_enabled):
-    orig_flags = (torch._C._get_mkldnn_enabled(),)
+def set_flags(_enabled, _allow_bf16_matmul=None):
+    orig_flags = (torch._C._get_mkldnn_enabled(),
+                  torch._C._get_cpu_allow_bf16_matmul())
     torch._C._set_mkldnn_enabled(_enabled)
+    if _allow_bf16_matmul is not None:
+        torch._C._set_cpu_allow_bf16_matmul(_allow_bf16_matmul)
     return orig_flags
 
 @contextmanager
-def flags(enabled=False):
+def flags(enabled=False, allow_bf16_matmul=False):
     with __allow_nonbracketed_mutation():
-        orig_flags = set_flags(enabled)
+        orig_flags = set_flags(enabled, allow_bf16_matmul)
     try:
         yield
     finally:
         with __allow_nonbracketed_mutation():
-            set_flags(orig_flags[0])
+            set_flags(*orig_flags)
+
+def get_primitive_cache_capacity():
+    r"""Returns the capacity of the oneDNN primitive cache. Compiled
+    primitives are cached keyed on their full descriptor (op, shapes,
+    strides, attributes), so repeated calls with previously seen signatures
+    skip primitive creation. Returns 0 if PyTorch was built without MKL-DNN
+    support."""
+    return torch._C._get_mkldnn_primitive_cache_capacity()
+
+def set_primitive_cache_capacity(capacity):
+    r"""Sets the capacity of the oneDNN primitive cache. A capacity of 0
+    disables caching; larger values trade memory for fewer primitive
+    recompilations when shapes vary."""
+    torch._C._set_mkldnn_primitive_cache_capacity(capacity)
 
 class MkldnnModule(PropModule):
     def __init__(self, m, name):
         super(MkldnnModule, self).__init__(m, name)
 
     enabled = ContextProp(torch._C._get_mkldnn_enabled, torch._C._set_mkldnn_enabled)
+    # When True, float32 matmuls on CPU may use bfloat16 tiles with float32
+    # accumulation (the CPU analogue of torch.backends.cuda.matmul.allow_tf32).
+    allow_bf16_matmul = ContextProp(torch._C._get_cpu_allow_bf16_matmul,
+                                    torch._C._set_cpu_allow_bf16_matmul)
 
 # Cool stuff from torch/backends/cudnn/__init__.py and
 # https://stackoverflow.com/questions/2447353/getattr-on-a-module/7668273#7668273
@@ -13,6 +13,7 @@
 #include <ATen/VmapMode.h>
 #include <ATen/dlpack.h>
 #include <ATen/core/Vitals.h>
+#include <ATen/core/dispatch/Dispatcher.h>
 #include <TH/TH.h>
 #include <c10/util/Logging.h>
 #include <c10/util/irange.h>
@@ -422,6 +423,23 @@ PyObject *THPModule_userEnabledMkldnn(PyObject *_unused, PyObject *noargs)
   else Py_RETURN_FALSE;
 }
 
+PyObject *THPModule_mkldnnPrimitiveCacheCapacity(PyObject *_unused, PyObject *noargs)
+{
+  HANDLE_TH_ERRORS
+  return THPUtils_packInt64(at::globalContext().mkldnnPrimitiveCacheCapacity());
+  END_HANDLE_TH_ERRORS
+}
+
+PyObject *THPModule_setMkldnnPrimitiveCacheCapacity(PyObject *_unused, PyObject *arg)
+{
+  HANDLE_TH_ERRORS
+  THPUtils_assert(THPUtils_checkLong(arg), "_set_mkldnn_primitive_cache_capacity "
+          "expects an int, but got %s", THPUtils_typename(arg));
+  at::globalContext().setMkldnnPrimitiveCacheCapacity((int)THPUtils_unpackLong(arg));
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 PyObject *THPModule_setDeterministicCuDNN(PyObject *_unused, PyObject *arg)
 {
   HANDLE_TH_ERRORS
@@ -522,6 +540,22 @@ PyObject *THPModule_allowTF32CuBLAS(PyObject *_unused, PyObject *noargs)
   Py_RETURN_FALSE;
 }
 
+PyObject *THPModule_setAllowBF16MatmulCPU(PyObject *_unused, PyObject *arg)
+{
+  THPUtils_assert(PyBool_Check(arg), "set_allow_bf16_matmul_cpu expects a bool, "
+          "but got %s", THPUtils_typename(arg));
+  at::globalContext().setAllowBF16MatmulCPU(arg == Py_True);
+  Py_RETURN_NONE;
+}
+
+PyObject *THPModule_allowBF16MatmulCPU(PyObject *_unused, PyObject *noargs)
+{
+  if (at::globalContext().allowBF16MatmulCPU()) {
+    Py_RETURN_TRUE;
+  }
+  Py_RETURN_FALSE;
+}
+
 PyObject *THPModule_setFlushDenormal(PyObject *_unused, PyObject *arg) {
   THPUtils_assert(PyBool_Check(arg), "flush_denormal expects a bool, "
           "but got %s", THPUtils_typename(arg));
@@ -635,6 +669,24 @@ static PyObject * THPModule_are_vmap_fallback_warnings_enabled(PyObject* _unused
   END_HANDLE_TH_ERRORS
 }
 
+// Returns the names of all operators with a batching rule registered, i.e.
+// the ops that vmap handles without falling back to the per-example loop.
+// Used by torch._vmap_internals to report fallback coverage.
+static PyObject * THPModule_debug_vmap_ops_with_batching_rules(PyObject* _unused, PyObject *noargs) {
+  HANDLE_TH_ERRORS
+  auto op_names = c10::Dispatcher::singleton().getRegistrationsForDispatchKey(
+      c10::DispatchKey::Batched);
+  auto result = THPObjectPtr(PyList_New(op_names.size()));
+  if (!result) throw python_error();
+  for (const auto i : c10::irange(op_names.size())) {
+    auto name = THPUtils_packString(c10::toString(op_names[i]));
+    if (!name) throw python_error();
+    PyList_SET_ITEM(result.get(), i, name);
+  }
+  return result.release();
+  END_HANDLE_TH_ERRORS
+}
+
 //NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, cppcoreguidelines-avoid-non-const-global-variables, modernize-avoid-c-arrays)
 static PyMethodDef TorchMethods[] = {
   {"_initExtension",  THPModule_initExtension,   METH_O,       nullptr},
@@ -663,6 +715,8 @@ static PyMethodDef TorchMethods[] = {
   {"_set_cudnn_enabled", THPModule_setUserEnabledCuDNN, METH_O,  nullptr},
   {"_get_mkldnn_enabled", THPModule_userEnabledMkldnn, METH_NOARGS,     nullptr},
   {"_set_mkldnn_enabled", THPModule_setUserEnabledMkldnn, METH_O,  nullptr},
+  {"_get_mkldnn_primitive_cache_capacity", THPModule_mkldnnPrimitiveCacheCapacity, METH_NOARGS, nullptr},
+  {"_set_mkldnn_primitive_cache_capacity", THPModule_setMkldnnPrimitiveCacheCapacity, METH_O, nullptr},
   {"_get_cudnn_allow_tf32", THPModule_allowTF32CuDNN, METH_NOARGS,     nullptr},
   {"_set_cudnn_allow_tf32", THPModule_setAllowTF32CuDNN, METH_O,  nullptr},
   {"_get_cudnn_benchmark", THPModule_benchmarkCuDNN, METH_NOARGS,     nullptr},
@@ -676,10 +730,13 @@ static PyMethodDef TorchMethods[] = {
   {"_set_warnAlways", THPModule_setWarnAlways, METH_O,  nullptr},
   {"_get_cublas_allow_tf32", THPModule_allowTF32CuBLAS, METH_NOARGS,     nullptr},
   {"_set_cublas_allow_tf32", THPModule_setAllowTF32CuBLAS, METH_O,  nullptr},
+  {"_get_cpu_allow_bf16_matmul", THPModule_allowBF16MatmulCPU, METH_NOARGS,     nullptr},
+  {"_set_cpu_allow_bf16_matmul", THPModule_setAllowBF16MatmulCPU, METH_O,  nullptr},
   {"_vmapmode_increment_nesting", THPModule_vmapmode_increment_nesting, METH_NOARGS, nullptr},
   {"_vmapmode_decrement_nesting", THPModule_vmapmode_decrement_nesting, METH_NOARGS, nullptr},
   {"_debug_only_display_vmap_fallback_warnings", THPModule_set_display_vmap_fallback_warnings_mode, METH_O, nullptr},
   {"_debug_only_are_vmap_fallback_warnings_enabled", THPModule_are_vmap_fallback_warnings_enabled, METH_NOARGS, nullptr},
+  {"_debug_vmap_ops_with_batching_rules", THPModule_debug_vmap_ops_with_batching_rules, METH_NOARGS, nullptr},
   {"_to_dlpack",      THPModule_toDLPack,          METH_O,       nullptr},
   {"_from_dlpack",    THPModule_fromDLPack,        METH_O,       nullptr},
   {"set_flush_denormal", THPModule_setFlushDenormal, METH_O,     nullptr},
@@ -4,6 +4,7 @@
 #error C++14 or later compatible compiler is required to use PyTorch.
 #endif
 
+#include <torch/batching.h>
 #include <torch/cuda.h>
 #include <torch/data.h>
 #include <torch/enum.h>
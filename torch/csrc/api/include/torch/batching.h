@@ -0,0 +1,129 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/types.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace torch {
+namespace batching {
+
+/// Options to configure a `DynamicBatcher`.
+struct DynamicBatcherOptions {
+  DynamicBatcherOptions() = default;
+  /* implicit */ DynamicBatcherOptions(size_t max_batch_size)
+      : max_batch_size_(max_batch_size) {}
+
+  /// The number of rows (along dimension 0) at which a pending batch is
+  /// dispatched immediately, without waiting for the flush deadline.
+  TORCH_ARG(size_t, max_batch_size) = 32;
+
+  /// How long the oldest pending request may wait before its batch is
+  /// dispatched, even if fewer than `max_batch_size` rows have accumulated.
+  TORCH_ARG(std::chrono::milliseconds, flush_deadline) =
+      std::chrono::milliseconds(5);
+
+  /// The maximum number of batches that may execute concurrently. Batches are
+  /// run on the inter-op thread pool (see `at::launch`), so this also bounds
+  /// how many pool threads the batcher can occupy at once.
+  TORCH_ARG(size_t, max_concurrency) = 1;
+};
+
+/// Coalesces individual forward calls into batched executions.
+///
+/// Serving code typically receives requests one sample at a time, but models
+/// run far more efficiently on well-shaped batches -- N batch-size-1 GEMMs
+/// cost much more than one batch-size-N GEMM. A `DynamicBatcher` wraps a
+/// batched computation (e.g. a `torch::jit::Module` or `nn::Module` forward)
+/// and exposes a per-request interface: callers `enqueue()` sub-batches along
+/// dimension 0 and receive a future for the matching rows of the batched
+/// output. Pending requests are concatenated with `torch::cat` and dispatched
+/// either when `max_batch_size` rows have accumulated or when the oldest
+/// request has waited for `flush_deadline`, whichever comes first; the result
+/// is split back per request with `Tensor::narrow`.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::batching::DynamicBatcher batcher(
+///       [&module](torch::Tensor input) { return module.forward(input); },
+///       torch::batching::DynamicBatcherOptions(/*max_batch_size=*/64)
+///           .flush_deadline(std::chrono::milliseconds(2)));
+///
+///   // From any number of request threads:
+///   torch::Tensor output = batcher.forward(sample.unsqueeze(0));
+/// \endrst
+///
+/// `enqueue()` is safe to call from multiple threads concurrently.
+class TORCH_API DynamicBatcher {
+ public:
+  /// The batched computation. Receives the concatenated input and must return
+  /// a tensor whose size along dimension 0 matches the input's.
+  using BatchedForward = std::function<Tensor(Tensor)>;
+
+  explicit DynamicBatcher(
+      BatchedForward forward,
+      DynamicBatcherOptions options = DynamicBatcherOptions());
+
+  DynamicBatcher(const DynamicBatcher&) = delete;
+  DynamicBatcher& operator=(const DynamicBatcher&) = delete;
+
+  /// Stops the batcher (see `stop()`).
+  ~DynamicBatcher();
+
+  /// Submits `input`, a sub-batch along dimension 0, and returns a future for
+  /// the corresponding rows of the batched output. If the batched computation
+  /// throws, the exception is rethrown from the future of every request in
+  /// the failed batch.
+  std::future<Tensor> enqueue(Tensor input);
+
+  /// Submits `input` and blocks until its result is available.
+  Tensor forward(Tensor input);
+
+  /// Dispatches any still-pending requests, waits for in-flight batches to
+  /// finish and joins the background thread. Called from the destructor;
+  /// calling it again is a no-op. Requests enqueued after `stop()` are
+  /// rejected.
+  void stop();
+
+  /// The number of requests currently waiting to be batched.
+  size_t pending_requests() const;
+
+ private:
+  struct Request {
+    Tensor input;
+    std::promise<Tensor> promise;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  /// Body of the background thread that groups requests into batches.
+  void run();
+
+  /// Runs one batch on the thread pool and fulfills its promises.
+  void execute_batch(std::vector<Request> batch);
+
+  BatchedForward forward_;
+  DynamicBatcherOptions options_;
+
+  mutable std::mutex mutex_;
+  /// Signalled when a request arrives or the batcher is stopped.
+  std::condition_variable request_cv_;
+  /// Signalled when an in-flight batch finishes.
+  std::condition_variable batch_done_cv_;
+  std::deque<Request> pending_;
+  size_t pending_rows_ = 0;
+  size_t in_flight_ = 0;
+  bool stop_ = false;
+  std::thread flusher_;
+};
+
+} // namespace batching
+} // namespace torch
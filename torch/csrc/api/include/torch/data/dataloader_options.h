@@ -37,6 +37,13 @@ struct DataLoaderOptions {
   /// Whether to omit the last batch if it contains less than `batch_size`
   /// examples.
   TORCH_ARG(bool, drop_last) = false;
+
+  /// Whether worker threads should copy the tensors of each batch into
+  /// pinned (page-locked) memory before handing the batch to the main
+  /// thread. Copies from pinned memory to a CUDA device can be asynchronous,
+  /// so this pairs with `Tensor::to(device, /*non_blocking=*/true)`.
+  /// Requires a CUDA-enabled build.
+  TORCH_ARG(bool, pin_memory) = false;
 };
 
 /// Like `DataLoaderOptions`, but without any unconfigured state.
@@ -52,7 +59,8 @@ struct FullDataLoaderOptions {
         max_jobs(options.max_jobs().value_or(2 * workers)),
         timeout(options.timeout()),
         enforce_ordering(options.enforce_ordering()),
-        drop_last(options.drop_last()) {}
+        drop_last(options.drop_last()),
+        pin_memory(options.pin_memory()) {}
 
   size_t batch_size;
   size_t workers;
@@ -60,6 +68,7 @@ struct FullDataLoaderOptions {
   optional<std::chrono::milliseconds> timeout;
   bool enforce_ordering;
   bool drop_last;
+  bool pin_memory;
 };
 } // namespace data
 } // namespace torch
@@ -5,7 +5,9 @@
 #include <torch/csrc/utils/memory.h>
 #include <torch/data/datasets/stateful.h>
 #include <torch/data/samplers.h>
+#include <algorithm>
 #include <queue>
+#include <random>
 #include <thread>
 
 #include <torch/serialize.h>
@@ -56,10 +58,13 @@ class BatchDataBuffer {
   BatchDataBuffer(
       size_t batch_size,
       ExampleSampler& example_sampler,
-      size_t queue_capacity)
+      size_t queue_capacity,
+      size_t shuffle_buffer_size = 0)
       : batch_size_(batch_size),
         example_sampler_(example_sampler),
-        queue_capacity_(queue_capacity) {}
+        queue_capacity_(queue_capacity),
+        shuffle_buffer_size_(shuffle_buffer_size),
+        shuffle_rng_(std::random_device{}()) {}
 
   /// Return batch data from the queue. Called from the ChunkDataset main
   /// thread.
@@ -94,6 +99,10 @@ class BatchDataBuffer {
   /// Push preloaded chunks to batch queue. Called from the ChunkDataset worker
   /// threads.
   void add_chunk_data(UnwrappedBatchType data) {
+    if (shuffle_buffer_size_ > 0) {
+      add_shuffled_chunk_data(std::move(data));
+      return;
+    }
     std::unique_lock<std::mutex> lock(queue_mutex_);
     cv_write_.wait(lock, [this] {
       // stop loading if we have preloaded enough data.
@@ -175,6 +184,70 @@ class BatchDataBuffer {
     cv_read_.notify_all();
   }
 
+  /// Streaming shuffle variant of add_chunk_data. Instead of permuting each
+  /// loaded chunk with the example sampler, incoming examples are swapped
+  /// through a fixed-size reservoir: once the reservoir is full, every new
+  /// example displaces (and thereby emits) a uniformly random buffered one.
+  /// This shuffles across chunk boundaries without materializing any index
+  /// permutation. Batch assembly happens under shuffle_mutex_, outside of
+  /// queue_mutex_, so readers are only blocked for the queue push itself.
+  void add_shuffled_chunk_data(UnwrappedBatchType data) {
+    std::vector<UnwrappedBatchType> ready_batches;
+    {
+      std::lock_guard<std::mutex> lock(shuffle_mutex_);
+      for (auto& example : data) {
+        if (shuffle_buffer_.size() < shuffle_buffer_size_) {
+          // Warm-up phase: nothing is emitted until the reservoir is full,
+          // so the first emitted example is already drawn from a full window.
+          shuffle_buffer_.emplace_back(std::move(example));
+          continue;
+        }
+        std::uniform_int_distribution<size_t> slot_dist(
+            0, shuffle_buffer_size_ - 1);
+        size_t slot = slot_dist(shuffle_rng_);
+        partial_batch_.emplace_back(std::move(shuffle_buffer_[slot]));
+        shuffle_buffer_[slot] = std::move(example);
+        if (partial_batch_.size() == batch_size_) {
+          ready_batches.emplace_back(std::move(partial_batch_));
+          partial_batch_ = UnwrappedBatchType();
+          partial_batch_.reserve(batch_size_);
+        }
+      }
+    }
+    enqueue_batches(std::move(ready_batches));
+  }
+
+  /// Drain the shuffle buffer once all chunks are loaded. Called by the last
+  /// running preloader right before it signals stop, so the remaining
+  /// examples still reach the reader. A mid-epoch stop (e.g. from
+  /// ChunkDataset::reset) discards the buffer with the rest of the cache
+  /// instead.
+  void flush_shuffle_buffer() {
+    if (shuffle_buffer_size_ == 0) {
+      return;
+    }
+    std::vector<UnwrappedBatchType> ready_batches;
+    {
+      std::lock_guard<std::mutex> lock(shuffle_mutex_);
+      std::shuffle(shuffle_buffer_.begin(), shuffle_buffer_.end(), shuffle_rng_);
+      for (auto& example : shuffle_buffer_) {
+        partial_batch_.emplace_back(std::move(example));
+        if (partial_batch_.size() == batch_size_) {
+          ready_batches.emplace_back(std::move(partial_batch_));
+          partial_batch_ = UnwrappedBatchType();
+          partial_batch_.reserve(batch_size_);
+        }
+      }
+      shuffle_buffer_.clear();
+      if (!partial_batch_.empty()) {
+        // The final batch of the epoch may be smaller than batch_size_.
+        ready_batches.emplace_back(std::move(partial_batch_));
+        partial_batch_ = UnwrappedBatchType();
+      }
+    }
+    enqueue_batches(std::move(ready_batches));
+  }
+
   void stop(){
     {
       // Hold the lock before changing stop_ to prevent a race condition which can
@@ -197,6 +270,30 @@ class BatchDataBuffer {
     // notify all readers too.
     cv_read_.notify_all();
   }
+
+  /// Push fully assembled batches into the queue. Only used by the streaming
+  /// shuffle path; the critical section is limited to the queue operation
+  /// itself as the batches are assembled before this call.
+  void enqueue_batches(std::vector<UnwrappedBatchType> batches) {
+    for (auto& batch : batches) {
+      std::unique_lock<std::mutex> lock(queue_mutex_);
+      cv_write_.wait(lock, [this] {
+        // stop loading if we have preloaded enough data.
+        return this->total_example_count_in_queue_ < this->queue_capacity_ ||
+            this->stop_;
+      });
+      if (stop_) {
+        // When stop_ is true, the batch buffer is being discarded, so the
+        // remaining batches can be dropped along with it.
+        return;
+      }
+      total_example_count_in_queue_ += batch.size();
+      batch_queue_.emplace(std::move(batch));
+      lock.unlock();
+      cv_read_.notify_all();
+    }
+  }
+
   /// The batch size is needed to create batches from the chunk data. Similar to
   /// regular dataloader where the batches are created with prefetches,
   /// BatchDataBuffer perform the batch creation using the provided batch size.
@@ -243,6 +340,18 @@ class BatchDataBuffer {
   // preloader could be still waiting for the conditional variable, thus cause
   // the program to hang. This boolean is used to break this waiting condition.
   bool stop_ = false;
+
+  // size of the streaming shuffle reservoir. 0 disables the streaming shuffle
+  // path and examples are shuffled per chunk by example_sampler_ instead.
+  size_t shuffle_buffer_size_ = 0;
+
+  // reservoir for the streaming shuffle, together with the batch currently
+  // being assembled from displaced examples. Guarded by shuffle_mutex_ rather
+  // than queue_mutex_, so example shuffling never blocks readers.
+  std::vector<typename UnwrappedBatchType::value_type> shuffle_buffer_;
+  UnwrappedBatchType partial_batch_;
+  std::mt19937 shuffle_rng_;
+  std::mutex shuffle_mutex_;
 };
 } // namespace detail
 
@@ -253,11 +362,13 @@ struct ChunkDatasetOptions {
       size_t preloader_count,
       size_t batch_size,
       size_t cache_size = 2048,
-      size_t cross_chunk_shuffle_count = 1)
+      size_t cross_chunk_shuffle_count = 1,
+      size_t shuffle_buffer_size = 0)
       : preloader_count_(preloader_count),
         batch_size_(batch_size),
         cache_size_(cache_size),
-        cross_chunk_shuffle_count_(cross_chunk_shuffle_count) {
+        cross_chunk_shuffle_count_(cross_chunk_shuffle_count),
+        shuffle_buffer_size_(shuffle_buffer_size) {
     TORCH_CHECK(
         preloader_count_ > 0,
         "Preloader count is 0. At least one preloader needs to be specified.");
@@ -274,6 +385,10 @@ struct ChunkDatasetOptions {
     TORCH_CHECK(
         cross_chunk_shuffle_count_ > 0,
         "cross_chunk_shuffle_count needs to be greater than 0.");
+    TORCH_CHECK(
+        shuffle_buffer_size_ == 0 || shuffle_buffer_size_ >= batch_size_,
+        "shuffle_buffer_size needs to be either 0 (disabled) or at least as "
+        "large as the batch size.");
   }
 
   /// The number of worker thread to preload chunk data.
@@ -295,6 +410,20 @@ struct ChunkDatasetOptions {
   // penalty when this value is greater than 1, as we need to do extra merge
   // between multiple chunks before performing example sampling.
   TORCH_ARG(size_t, cross_chunk_shuffle_count) = 1;
+
+  // The number of examples held in the streaming shuffle buffer. Default to 0
+  // meaning no streaming shuffle; examples are shuffled within each loaded
+  // chunk by the example sampler as before. When it is greater than 0, the
+  // example sampler is bypassed: preloaded examples are pushed through a
+  // fixed-size reservoir and each incoming example displaces (and thereby
+  // emits) a uniformly random buffered one. This shuffles across chunk
+  // boundaries without ever materializing an index permutation, which is
+  // useful for very large chunks where permutation tensors and the locking
+  // around per-chunk sampling become a bottleneck. The shuffle quality is
+  // bounded by the buffer size, so pick a value several times the chunk size
+  // for good mixing. The buffer is drained at the end of the epoch, so the
+  // final batch may be smaller than batch_size.
+  TORCH_ARG(size_t, shuffle_buffer_size) = 0;
 };
 
 /// A stateful dataset that support hierarchical sampling and prefetching of
@@ -392,7 +521,8 @@ class ChunkDataset final
         detail::BatchDataBuffer<UnwrappedBatchType, ExampleSamplerType>>(
         options_.batch_size(),
         example_sampler_,
-        options_.cache_size());
+        options_.cache_size(),
+        options_.shuffle_buffer_size());
 
     // create new workers for this new epoch.
     quit_worker_ = false;
@@ -459,7 +589,9 @@ class ChunkDataset final
     AT_ASSERT(running_preloaders_.load() > 0);
     --running_preloaders_;
     if (running_preloaders_.load() == 0) {
-      // all preloaders are completed, so we can notify the batch_buffer.
+      // all preloaders are completed; drain the streaming shuffle buffer (a
+      // no-op when it is disabled) and notify the batch_buffer.
+      batch_buffer_->flush_shuffle_buffer();
       batch_buffer_->stop();
     }
   }
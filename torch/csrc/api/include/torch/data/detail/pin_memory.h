@@ -0,0 +1,66 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// Moves the tensors contained in a batch into pinned (page-locked) memory,
+/// from which asynchronous host-to-device copies are possible. Applied by
+/// worker threads when the `pin_memory` option of the `DataLoader` is set,
+/// so that the copy into pinned buffers happens off the main thread,
+/// alongside the fetch itself. Batch types that are not built from tensors,
+/// `Example`s, `std::vector`s or `optional`s thereof pass through unchanged.
+template <typename T>
+void pin_batch_memory(T& value);
+inline void pin_batch_memory(Tensor& tensor);
+template <typename Data, typename Target>
+void pin_batch_memory(Example<Data, Target>& example);
+template <typename Data>
+void pin_batch_memory(Example<Data, example::NoTarget>& example);
+template <typename T>
+void pin_batch_memory(std::vector<T>& batch);
+template <typename T>
+void pin_batch_memory(optional<T>& value);
+
+template <typename T>
+void pin_batch_memory(T& /*value*/) {}
+
+inline void pin_batch_memory(Tensor& tensor) {
+  if (tensor.defined() && !tensor.is_cuda() && !tensor.is_pinned()) {
+    tensor = tensor.pin_memory();
+  }
+}
+
+template <typename Data, typename Target>
+void pin_batch_memory(Example<Data, Target>& example) {
+  pin_batch_memory(example.data);
+  pin_batch_memory(example.target);
+}
+
+template <typename Data>
+void pin_batch_memory(Example<Data, example::NoTarget>& example) {
+  pin_batch_memory(example.data);
+}
+
+template <typename T>
+void pin_batch_memory(std::vector<T>& batch) {
+  for (auto& value : batch) {
+    pin_batch_memory(value);
+  }
+}
+
+template <typename T>
+void pin_batch_memory(optional<T>& value) {
+  if (value.has_value()) {
+    pin_batch_memory(*value);
+  }
+}
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -5,7 +5,10 @@
 #include <torch/serialize/tensor.h>
 #include <torch/csrc/WindowsTorchApiMacro.h>
 
+#include <future>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace torch {
 
@@ -74,6 +77,29 @@ void save(const std::vector<torch::Tensor>& tensor_vec, SaveToArgs&&... args) {
   archive.save_to(std::forward<SaveToArgs>(args)...);
 }
 
+/// Asynchronously serializes the given `tensor_vec` to the file at `path`.
+///
+/// The tensors are first snapshotted to host memory: GPU tensors are staged
+/// through pinned buffers so the device-to-host copies run at full link
+/// speed, and CPU tensors are cloned. Only this snapshot phase blocks the
+/// caller; serialization and disk I/O happen on a background thread, so the
+/// snapshot is immune to subsequent mutation of the source tensors (e.g. by
+/// continued training). The returned future completes once the checkpoint
+/// has been fully written and rethrows any serialization error from `get()`.
+/// Note that the future's destructor blocks until completion, so it must be
+/// kept alive while the write should proceed in the background.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto future = torch::save_async(tensor_vec, "checkpoint.pt");
+///   // ... continue training, the checkpoint contents are already fixed ...
+///   future.get(); // wait for persistence and surface any write error
+/// \endrst
+TORCH_API std::future<void> save_async(
+    std::vector<torch::Tensor> tensor_vec,
+    std::string path);
+
 TORCH_API std::vector<char> pickle_save(const torch::IValue& ivalue);
 TORCH_API torch::IValue pickle_load(const std::vector<char>& data);
 
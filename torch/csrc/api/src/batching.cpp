@@ -0,0 +1,169 @@
+#include <torch/batching.h>
+
+#include <ATen/Parallel.h>
+#include <c10/util/Exception.h>
+
+#include <memory>
+#include <utility>
+
+namespace torch {
+namespace batching {
+
+DynamicBatcher::DynamicBatcher(
+    BatchedForward forward,
+    DynamicBatcherOptions options)
+    : forward_(std::move(forward)), options_(options) {
+  TORCH_CHECK(
+      forward_ != nullptr, "DynamicBatcher requires a forward function");
+  TORCH_CHECK(
+      options_.max_batch_size() > 0,
+      "DynamicBatcher max_batch_size must be positive");
+  TORCH_CHECK(
+      options_.max_concurrency() > 0,
+      "DynamicBatcher max_concurrency must be positive");
+  flusher_ = std::thread([this] { run(); });
+}
+
+DynamicBatcher::~DynamicBatcher() {
+  stop();
+}
+
+std::future<Tensor> DynamicBatcher::enqueue(Tensor input) {
+  TORCH_CHECK(
+      input.defined() && input.dim() >= 1,
+      "DynamicBatcher inputs must have a leading batch dimension");
+  Request request;
+  request.input = std::move(input);
+  request.enqueue_time = std::chrono::steady_clock::now();
+  auto future = request.promise.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TORCH_CHECK(!stop_, "DynamicBatcher has been stopped");
+    pending_rows_ += static_cast<size_t>(request.input.size(0));
+    pending_.push_back(std::move(request));
+  }
+  request_cv_.notify_one();
+  return future;
+}
+
+Tensor DynamicBatcher::forward(Tensor input) {
+  return enqueue(std::move(input)).get();
+}
+
+size_t DynamicBatcher::pending_requests() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_.size();
+}
+
+void DynamicBatcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  request_cv_.notify_all();
+  if (flusher_.joinable()) {
+    flusher_.join();
+  }
+}
+
+void DynamicBatcher::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    request_cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+    if (pending_.empty()) {
+      // Stopped with nothing left to dispatch. Wait for in-flight batches so
+      // that pool tasks never touch a destroyed batcher.
+      batch_done_cv_.wait(lock, [this] { return in_flight_ == 0; });
+      return;
+    }
+    if (!stop_ && pending_rows_ < options_.max_batch_size()) {
+      const auto deadline =
+          pending_.front().enqueue_time + options_.flush_deadline();
+      request_cv_.wait_until(lock, deadline, [this, deadline] {
+        return stop_ || pending_rows_ >= options_.max_batch_size() ||
+            std::chrono::steady_clock::now() >= deadline;
+      });
+    }
+
+    // Take whole requests from the front until the batch is full. A single
+    // request larger than max_batch_size is still dispatched (alone): it
+    // cannot be split without also splitting its reply.
+    std::vector<Request> batch;
+    size_t rows = 0;
+    while (!pending_.empty()) {
+      const auto request_rows =
+          static_cast<size_t>(pending_.front().input.size(0));
+      if (!batch.empty() && rows + request_rows > options_.max_batch_size()) {
+        break;
+      }
+      rows += request_rows;
+      batch.push_back(std::move(pending_.front()));
+      pending_.pop_front();
+    }
+    pending_rows_ -= rows;
+
+    batch_done_cv_.wait(
+        lock, [this] { return in_flight_ < options_.max_concurrency(); });
+    ++in_flight_;
+    lock.unlock();
+
+    // `std::function` requires a copyable callable, and promises are
+    // move-only, so hand the batch to the pool through a shared_ptr.
+    auto shared_batch = std::make_shared<std::vector<Request>>(std::move(batch));
+    at::launch([this, shared_batch] {
+      execute_batch(std::move(*shared_batch));
+      {
+        std::lock_guard<std::mutex> inner_lock(mutex_);
+        --in_flight_;
+      }
+      batch_done_cv_.notify_all();
+    });
+
+    lock.lock();
+  }
+}
+
+void DynamicBatcher::execute_batch(std::vector<Request> batch) {
+  // Compute every output slice before fulfilling any promise, so that a
+  // failure never leaves a batch with a mix of values and exceptions.
+  std::vector<Tensor> outputs;
+  try {
+    Tensor input;
+    if (batch.size() == 1) {
+      input = batch.front().input;
+    } else {
+      std::vector<Tensor> inputs;
+      inputs.reserve(batch.size());
+      for (const auto& request : batch) {
+        inputs.push_back(request.input);
+      }
+      input = torch::cat(inputs, /*dim=*/0);
+    }
+    Tensor output = forward_(input);
+    TORCH_CHECK(
+        output.defined() && output.dim() >= 1 &&
+            output.size(0) == input.size(0),
+        "DynamicBatcher forward must return a tensor with the same size ",
+        "along dimension 0 as its input (expected ",
+        input.size(0),
+        " rows)");
+    outputs.reserve(batch.size());
+    int64_t offset = 0;
+    for (const auto& request : batch) {
+      const int64_t request_rows = request.input.size(0);
+      outputs.push_back(output.narrow(0, offset, request_rows));
+      offset += request_rows;
+    }
+  } catch (...) {
+    for (auto& request : batch) {
+      request.promise.set_exception(std::current_exception());
+    }
+    return;
+  }
+  for (size_t i = 0; i < batch.size(); ++i) {
+    batch[i].promise.set_value(std::move(outputs[i]));
+  }
+}
+
+} // namespace batching
+} // namespace torch
@@ -1,7 +1,11 @@
 #include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/csrc/jit/serialization/pickler.h>
+#include <torch/cuda.h>
 #include <torch/serialize.h>
 
+#include <future>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace torch {
@@ -14,5 +18,40 @@ torch::IValue pickle_load(const std::vector<char>& data) {
   return jit::pickle_load(data);
 }
 
+std::future<void> save_async(
+    std::vector<torch::Tensor> tensor_vec,
+    std::string path) {
+  // Snapshot phase: decouple the checkpoint contents from ongoing training.
+  // Dense GPU tensors are staged through pinned host buffers with
+  // non-blocking copies so the device-to-host transfers pipeline across
+  // tensors; everything else is materialized on the CPU with a copy.
+  bool any_non_blocking_copy = false;
+  for (auto& entry : tensor_vec) {
+    auto tensor = entry.detach();
+    if (tensor.is_cuda() && tensor.layout() == c10::kStrided) {
+      auto staged = at::empty(
+          tensor.sizes(),
+          tensor.options().device(at::kCPU).pinned_memory(true));
+      staged.copy_(tensor, /*non_blocking=*/true);
+      entry = std::move(staged);
+      any_non_blocking_copy = true;
+    } else if (tensor.device().is_cpu()) {
+      entry = tensor.clone();
+    } else {
+      entry = tensor.to(at::kCPU);
+    }
+  }
+  // The staging buffers must be fully populated before the background
+  // thread starts reading them.
+  if (any_non_blocking_copy) {
+    torch::cuda::synchronize();
+  }
+
+  return std::async(
+      std::launch::async,
+      [tensor_vec = std::move(tensor_vec), path = std::move(path)] {
+        save(tensor_vec, path);
+      });
+}
 
 } // namespace torch
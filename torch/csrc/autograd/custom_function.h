@@ -170,6 +170,7 @@ struct CppNode : public Node {
   std::vector<VariableInfo> output_info_;
 
   void release_variables() override;
+  void prefetch_saved_variables() override;
 
   void set_ctx_grad_fn(const std::shared_ptr<Node> &node);
   void save_variables_to_ctx();
@@ -374,6 +375,15 @@ void CppNode<T>::release_variables() {
   ctx_.has_freed_buffers_ = true;
 }
 
+template <class T>
+void CppNode<T>::prefetch_saved_variables() {
+  // lock to ensure thread safety, see [Thread Safety on Autograd Node]
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& saved_variable : ctx_.saved_variables_) {
+    saved_variable.prefetch();
+  }
+}
+
 template<class T>
 void CppNode<T>::save_variables_to_ctx() {
   ctx_.save_variables();
@@ -5,6 +5,7 @@
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/anomaly_mode.h>
+#include <torch/csrc/autograd/saved_variable_offload_hooks.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/utils/memory.h>
 
@@ -21,6 +22,7 @@
 #include <c10/util/Optional.h>
 #include <c10/util/ThreadLocal.h>
 #include <c10/core/StreamGuard.h>
+#include <c10/core/thread_pool.h>
 
 #include <atomic>
 #include <chrono>
@@ -146,9 +148,17 @@ C10_DEFINE_TLS_static(std::shared_ptr<ReadyQueue>, tls_local_ready_queue);
 // recording their streams from forward, and during backward this
 // data is used to sync the producer's stream with the consumer's.
 //
-// When a CUDA function is run either all its inputs were accumulated on the
-// stream used to run the function OR the inputs are on different devices
-// and the function is responsible for properly acquiring them.
+// The sync is per edge: each input buffer slot belongs to exactly one
+// consumer input, whose metadata records the stream (on that input's own
+// device) its forward counterpart ran on, and the producer's stream for an
+// output is the stream the producing function used on that output's device.
+// A wait event is inserted only when those two streams differ, so
+// independent gradient branches running on different streams never
+// serialize against each other or against the default stream.
+//
+// When a CUDA function is run, evaluate_function guards onto the recorded
+// input streams of all devices the function's inputs live on, so all its
+// inputs were accumulated on the stream(s) used to run the function.
 //
 // User-facing stream semantics of a backward() (or torch.autograd.grad())
 // call with respect to surrounding ops are the same as for any other call.
@@ -186,18 +196,52 @@ CheckpointValidGuard::~CheckpointValidGuard() {
   checkpoint_valid = prev_checkpoint_valid_state;
 }
 
+// Note [Lock-free ReadyQueue inbox]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With thousands of small grad nodes firing at once, the worker threads
+// used to serialize on the queue mutex in push(). Producers now publish
+// tasks onto an atomic intrusive stack with a single compare-exchange and
+// only touch the mutex to deliver a wakeup when a consumer is actually
+// asleep. Consumers move the published tasks into the priority heap under
+// the mutex they already hold in pop(), so the scheduling order (shutdown
+// tasks first, then by reentrant depth / sequence number) is unchanged.
+void ReadyQueue::drain_inbox() {
+  auto* node = inbox_.exchange(nullptr);
+  while (node != nullptr) {
+    heap_.push(std::move(node->task));
+    auto* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+ReadyQueue::~ReadyQueue() {
+  auto* node = inbox_.exchange(nullptr);
+  while (node != nullptr) {
+    auto* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
 auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
-  {
-    // Lock mutex for writing to heap_
+  if (incrementOutstandingTasks) {
+    std::shared_ptr<GraphTask> graph_task = item.base_.lock();
+    TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
+    ++graph_task->outstanding_tasks_;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  auto* node = new InboxNode{std::move(item), nullptr};
+  node->next = inbox_.load(std::memory_order_relaxed);
+  while (!inbox_.compare_exchange_weak(node->next, node)) {
+  }
+  // Either this (seq_cst) load sees the waiter, or the waiter's predicate,
+  // which runs after it incremented waiters_, sees the task we published
+  // above; one of the two must hold, so no wakeup is lost.
+  if (waiters_.load() > 0) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (incrementOutstandingTasks) {
-      std::shared_ptr<GraphTask> graph_task = item.base_.lock();
-      TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
-      ++graph_task->outstanding_tasks_;
-    }
-    heap_.push(std::move(item));
+    not_empty_.notify_one();
   }
-  not_empty_.notify_one();
 }
 
 auto ReadyQueue::pushShutdownTask() -> void {
@@ -209,15 +253,29 @@ auto ReadyQueue::pushShutdownTask() -> void {
 }
 
 size_t ReadyQueue::size() const {
-  // Lock mutex for accesses to heap_
+  // Lock mutex for accesses to heap_. Walking the inbox is safe while the
+  // mutex is held: nodes are only freed by drain_inbox(), which also needs
+  // the mutex; concurrent pushes can only prepend in front of our snapshot.
   std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.size();
+  size_t size = heap_.size();
+  for (auto* node = inbox_.load(); node != nullptr; node = node->next) {
+    size++;
+  }
+  return size;
 }
 
 auto ReadyQueue::pop() -> NodeTask {
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
-  not_empty_.wait(lock, [this]{ return !heap_.empty(); });
+  drain_inbox();
+  if (heap_.empty()) {
+    waiters_.fetch_add(1);
+    not_empty_.wait(lock, [this] {
+      drain_inbox();
+      return !heap_.empty();
+    });
+    waiters_.fetch_sub(1);
+  }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   auto task = std::move(const_cast<NodeTask&>(heap_.top())); heap_.pop();
   return task;
@@ -226,7 +284,7 @@ auto ReadyQueue::pop() -> NodeTask {
 bool ReadyQueue::empty() const {
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.empty();
+  return heap_.empty() && inbox_.load() == nullptr;
 }
 
 Engine::Engine() : max_recursion_depth_(MAX_DEPTH), non_reentrant_device_thread_count_(0) {}
@@ -516,6 +574,11 @@ void GraphTask::mark_as_completed_and_run_post_processing() {
   }
 
   try {
+    // Deferred post hooks must have finished before final callbacks run and
+    // the future completes; see Note [Deferred post hooks]. Wait before
+    // taking mutex_ so hooks are not blocked against it.
+    wait_for_deferred_hooks();
+
     // Run post processing, before marking the future as complete.
     // Drop lock prior to completing, to avoid holding across callbacks.
     std::unique_lock<std::mutex> lock(mutex_);
@@ -534,8 +597,11 @@ void GraphTask::mark_as_completed_and_run_post_processing() {
 }
 
 void GraphTask::exec_post_processing() {
-  if (!not_ready_.empty()) {
-    throw std::runtime_error("could not compute gradients for some functions");
+  for (auto& shard : not_ready_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.map.empty()) {
+      throw std::runtime_error("could not compute gradients for some functions");
+    }
   }
 
   // set the thread_local current_graph_task_ as more callbacks can be installed
@@ -603,6 +669,18 @@ void GraphTask::exec_post_processing() {
   }
 }
 
+void GraphTask::wait_for_deferred_hooks() {
+  // Every deferred batch is enqueued while its node executes, i.e. before
+  // the node's outstanding task is retired, so by the time this task is
+  // considered complete the counter can only go down.
+  std::unique_lock<std::mutex> lock(deferred_hooks_mutex_);
+  deferred_hooks_cv_.wait(
+      lock, [this] { return outstanding_deferred_hooks_.load() == 0; });
+  if (deferred_hooks_error_) {
+    std::rethrow_exception(deferred_hooks_error_);
+  }
+}
+
 void GraphTask::set_exception_without_signal(const std::shared_ptr<Node>& fn) {
   if (!has_error_.exchange(true)) {
     if (AnomalyMode::is_enabled() && fn) {
@@ -628,10 +706,88 @@ static variable_list call_pre_hooks(Node& fn, variable_list inputs) {
   return inputs;
 }
 
-static variable_list call_post_hooks(Node& fn, variable_list outputs, const variable_list& inputs) {
+// Note [Deferred post hooks]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Post hooks normally run inline on the engine worker thread, and their
+// return value replaces the node's outputs. Some hooks - most notably
+// communication hooks installed on leaf accumulators by distributed data
+// parallel wrappers - are heavyweight, do not care about the node's outputs
+// (a leaf accumulator has no next edges to feed), and exist only to launch
+// work such as an allreduce once a gradient is ready. Running them inline
+// stalls a worker thread that could be executing the next ready node.
+//
+// A hook can opt into the deferred lane by overriding
+// FunctionPostHook::is_deferrable(). Deferred hooks run on a dedicated
+// single-threaded pool with the node's forward stream made current and the
+// graph task's ThreadLocalState applied; their return value is ignored, as
+// the engine has already consumed the node's outputs by the time they run.
+// The single pool thread guarantees that hooks execute in the order they
+// were enqueued, which matters for collectives that must be issued in the
+// same order on every rank. Before the graph task's future completes we
+// wait for all of its deferred hooks, so backward() never returns with a
+// hook still pending; an error raised by a deferred hook fails the future
+// just like an inline hook error would.
+static c10::TaskThreadPool& deferred_hooks_pool() {
+  // Leaked on purpose, like the engine's worker threads.
+  static c10::TaskThreadPool* pool = new c10::TaskThreadPool(1);
+  return *pool;
+}
+
+static void defer_post_hooks(
+    const std::shared_ptr<GraphTask>& graph_task,
+    Node& fn,
+    const variable_list& outputs,
+    const variable_list& inputs) {
+  // Keep the node (and with it the hooks) alive until the batch has run.
+  auto fn_ptr = fn.shared_from_this();
+  auto opt_stream = fn.stream(c10::DeviceType::CUDA);
+  graph_task->outstanding_deferred_hooks_.fetch_add(1);
+  deferred_hooks_pool().run(
+      [graph_task, fn_ptr, opt_stream, outputs, inputs]() {
+        try {
+          c10::OptionalStreamGuard stream_guard(opt_stream);
+          at::ThreadLocalStateGuard tls_guard(graph_task->thread_locals_);
+          for (const auto& hook : fn_ptr->post_hooks()) {
+            if (hook->is_deferrable()) {
+              (*hook)(outputs, inputs);
+            }
+          }
+        } catch (...) {
+          {
+            std::lock_guard<std::mutex> lock(graph_task->deferred_hooks_mutex_);
+            if (!graph_task->deferred_hooks_error_) {
+              graph_task->deferred_hooks_error_ = std::current_exception();
+            }
+          }
+          graph_task->set_exception_without_signal(fn_ptr);
+        }
+        if (graph_task->outstanding_deferred_hooks_.fetch_sub(1) == 1) {
+          // Lock before notifying so the wakeup cannot slip in between the
+          // waiter's predicate check and its wait.
+          std::lock_guard<std::mutex> lock(graph_task->deferred_hooks_mutex_);
+          graph_task->deferred_hooks_cv_.notify_all();
+        }
+      });
+}
+
+static variable_list call_post_hooks(
+    const std::shared_ptr<GraphTask>& graph_task,
+    Node& fn,
+    variable_list outputs,
+    const variable_list& inputs) {
+  bool has_deferred = false;
   for (const auto& hook : fn.post_hooks()) {
+    if (hook->is_deferrable()) {
+      has_deferred = true;
+      continue;
+    }
     outputs = (*hook)(outputs, inputs);
   }
+  if (has_deferred) {
+    // Deferred hooks observe the outputs as left by the inline hooks; their
+    // return value is discarded. See Note [Deferred post hooks].
+    defer_post_hooks(graph_task, fn, outputs, inputs);
+  }
   return outputs;
 }
 
@@ -779,11 +935,54 @@ static variable_list call_function(
 
   if(has_post_hooks){
     // NOLINTNEXTLINE(bugprone-use-after-move)
-    return call_post_hooks(fn, std::move(outputs), inputs);
+    return call_post_hooks(graph_task, fn, std::move(outputs), inputs);
   }
   return outputs;
 }
 
+// The stream the consumer will use for the gradient flowing into slot
+// `input_nr`: the stream recorded for exactly that input's device in forward.
+// Falls back to the function-level stream when the slot carries no device
+// information (e.g. an undefined input). See Note [Streaming backwards].
+static c10::optional<c10::Stream> consumer_stream_for_input(
+    Node& consumer,
+    uint32_t input_nr) {
+  if (input_nr < consumer.num_inputs()) {
+    const auto& metadata = consumer.input_metadata(input_nr);
+    if (metadata.device().is_cuda()) {
+      return metadata.stream();
+    }
+  }
+  return consumer.stream(c10::DeviceType::CUDA);
+}
+
+// Walks up to `distance` levels of consumers below `func` and asks each to
+// start fetching spilled saved activations back to their device. Every node
+// reached here is a (transitive) consumer of `func`, so it cannot start
+// executing (or release its variables) before `func` finishes; the walk is
+// therefore race-free. See Note [Saved tensor CPU offloading]
+static void prefetch_spilled_saved_variables(Node* func, int distance) {
+  std::vector<Node*> frontier{func};
+  std::unordered_set<Node*> seen{func};
+  for (const auto level : c10::irange(distance)) {
+    (void)level; // Suppress unused variable warning
+    std::vector<Node*> next_frontier;
+    for (auto* node : frontier) {
+      for (const auto& edge : node->next_edges()) {
+        if (!edge.function) {
+          continue;
+        }
+        auto* next = edge.function.get();
+        if (seen.insert(next).second) {
+          next->prefetch_saved_variables();
+          next_frontier.push_back(next);
+        }
+      }
+    }
+    frontier = std::move(next_frontier);
+  }
+}
+
 void Engine::evaluate_function(
     std::shared_ptr<GraphTask>& graph_task,
     Node* func,
@@ -791,11 +990,35 @@ void Engine::evaluate_function(
     const std::shared_ptr<ReadyQueue>& cpu_ready_queue) {
   // The InputBuffer::adds that supplied incoming grads took pains to
   // ensure they're safe to consume in the context of the present
-  // func's stream (if applicable). So we guard onto that stream
-  // before working with the grads in any capacity.
-  const auto opt_parent_stream = (*func).stream(c10::DeviceType::CUDA);
+  // func's stream(s) (if applicable). So we guard onto those streams
+  // before working with the grads in any capacity. Guarding every
+  // recorded input stream (not just the first) keeps a function whose
+  // inputs span several devices consuming each gradient on the stream
+  // its forward counterpart used.
+  const auto parent_streams = (*func).streams(c10::DeviceType::CUDA);
+  c10::MultiStreamGuard parent_streams_guard{parent_streams};
+  c10::optional<c10::Stream> opt_parent_stream;
+  if (!parent_streams.empty()) {
+    opt_parent_stream = parent_streams.front();
+  }
+  // Also sets the current device to the (first) parent stream's device.
   c10::OptionalStreamGuard parent_stream_guard{opt_parent_stream};
 
+  // The stream `func` ran on for a given device, i.e. the stream its
+  // outputs on that device were produced on. Outputs on a device `func`
+  // holds no inputs on were produced on that device's ambient stream and
+  // are reported as nullopt, so consumers fall back to syncing with that
+  // device's default stream.
+  const auto producer_stream_for =
+      [&parent_streams](const at::Device& device) -> c10::optional<c10::Stream> {
+    for (const auto& stream : parent_streams) {
+      if (stream.device() == device) {
+        return stream;
+      }
+    }
+    return c10::nullopt;
+  };
+
   // If exec_info_ is not empty, we have to instrument the execution
   auto& exec_info_ = graph_task->exec_info_;
   if (!exec_info_.empty()) {
@@ -809,9 +1032,9 @@ void Engine::evaluate_function(
         for (auto& hook : capture.hooks_) {
           captured_grad = (*hook)(captured_grad);
         }
-        if (opt_parent_stream) {
-          // No need to take graph_task->mutex_ here, we already hold it
-          graph_task->leaf_streams.emplace(*opt_parent_stream);
+        // No need to take graph_task->mutex_ here, we already hold it
+        for (const auto& parent_stream : parent_streams) {
+          graph_task->leaf_streams.emplace(parent_stream);
         }
       }
     }
@@ -821,6 +1044,13 @@ void Engine::evaluate_function(
     }
   }
 
+  // See Note [Saved tensor CPU offloading]: start restoring spilled
+  // activations of functions a few nodes downstream, so the copies overlap
+  // with the present function's compute.
+  if (const auto prefetch_distance = CpuOffloadHooks::prefetch_distance()) {
+    prefetch_spilled_saved_variables(func, prefetch_distance);
+  }
+
   auto outputs = call_function(graph_task, func, inputs);
 
   auto& fn = *func;
@@ -830,11 +1060,13 @@ void Engine::evaluate_function(
 
   int num_outputs = outputs.size();
   if (num_outputs == 0) { // Note: doesn't acquire the mutex
-    // Records leaf stream (if applicable)
+    // Records leaf streams (if applicable)
     // See Note [Streaming backwards]
-    if (opt_parent_stream) {
+    if (!parent_streams.empty()) {
       std::lock_guard<std::mutex> lock(graph_task->mutex_);
-      graph_task->leaf_streams.emplace(*opt_parent_stream);
+      for (const auto& parent_stream : parent_streams) {
+        graph_task->leaf_streams.emplace(parent_stream);
+      }
     }
     return;
   }
@@ -852,70 +1084,97 @@ void Engine::evaluate_function(
     }
   }
 
-  // Lock mutex for the accesses to GraphTask dependencies_, not_ready_ and cpu_ready_queue_ below
-  std::lock_guard<std::mutex> lock(graph_task->mutex_);
+  // Note [Sharded graph task bookkeeping]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // The loop below used to hold GraphTask::mutex_ for the accesses to
+  // dependencies_ and not_ready_, which became the bottleneck when many
+  // small grad nodes finish at once across device threads. Dependency
+  // counts are plain atomics now and the not-ready buffers are sharded by
+  // node, so no global lock is taken here. Ordering is what makes this
+  // sound: a producer first merges its gradient into the target node's
+  // input buffer under the shard lock and only then decrements the
+  // dependency count (acq_rel). Whichever thread takes the count to zero
+  // therefore observes every other producer's merge once it reacquires the
+  // shard lock, and is the unique thread that schedules the node.
   for (const auto i : c10::irange(num_outputs)) {
     auto& output = outputs[i];
     const auto& next = fn.next_edge(i);
 
     if (!next.is_valid()) continue;
 
-    // Check if the next function is ready to be computed
-    bool is_ready = false;
     auto& dependencies = graph_task->dependencies_;
     auto it = dependencies.find(next.function.get());
-
     if (it == dependencies.end()) {
       auto name = next.function->name();
       throw std::runtime_error(std::string("dependency not found for ") + name);
-    } else if (--it->second == 0) {
-      dependencies.erase(it);
-      is_ready = true;
     }
 
-    auto& not_ready = graph_task->not_ready_;
-    auto not_ready_it = not_ready.find(next.function.get());
-    if (not_ready_it == not_ready.end()) {
-      // Skip functions that aren't supposed to be executed
-      if (!exec_info_.empty()) {
-        auto it = exec_info_.find(next.function.get());
-        if (it == exec_info_.end() || !it->second.should_execute()) {
-          continue;
-        }
+    // Functions that aren't supposed to be executed get their dependency
+    // count decremented, but no buffer.
+    bool should_execute = true;
+    if (!exec_info_.empty()) {
+      auto exec_it = exec_info_.find(next.function.get());
+      should_execute =
+          exec_it != exec_info_.end() && exec_it->second.should_execute();
+    }
+
+    if (should_execute) {
+      // Per-edge streams: the producer stream is the stream `func` ran on
+      // for this output's device, and the consumer stream is the one
+      // recorded for exactly the slot being fed. An event wait is inserted
+      // only when the two differ. See Note [Streaming backwards]
+      auto opt_producer_stream = opt_parent_stream;
+      if (output.defined() && output.device().is_cuda()) {
+        opt_producer_stream = producer_stream_for(output.device());
       }
-      // No buffers have been allocated for the function
-      InputBuffer input_buffer(next.function->num_inputs());
-
-      // Accumulates into buffer
-      const auto opt_next_stream = next.function->stream(c10::DeviceType::CUDA);
-      input_buffer.add(next.input_nr,
-                       std::move(output),
-                       opt_parent_stream,
-                       opt_next_stream);
-
-      if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
+      const auto opt_next_stream =
+          consumer_stream_for_input(*next.function, next.input_nr);
+      // Accumulates into the node's buffer, before the decrement below
+      // makes the contribution count.
+      auto& shard = graph_task->not_ready_shard(next.function.get());
+      std::lock_guard<std::mutex> shard_lock(shard.mutex);
+      auto not_ready_it = shard.map.find(next.function.get());
+      if (not_ready_it == shard.map.end()) {
+        // No buffers have been allocated for the function
+        InputBuffer input_buffer(next.function->num_inputs());
+        input_buffer.add(next.input_nr,
+                         std::move(output),
+                         opt_producer_stream,
+                         opt_next_stream);
+        shard.map.emplace(next.function.get(), std::move(input_buffer));
       } else {
-        not_ready.emplace(next.function.get(), std::move(input_buffer));
+        // The function already has a buffer
+        auto& input_buffer = not_ready_it->second;
+        input_buffer.add(next.input_nr,
+                         std::move(output),
+                         opt_producer_stream,
+                         opt_next_stream);
       }
-    } else {
-      // The function already has a buffer
-      auto &input_buffer = not_ready_it->second;
-
-      // Accumulates into buffer
-      const auto opt_next_stream = next.function->stream(c10::DeviceType::CUDA);
-      input_buffer.add(next.input_nr,
-                       std::move(output),
-                       opt_parent_stream,
-                       opt_next_stream);
-      if (is_ready) {
-        auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
-        queue->push(
-            NodeTask(graph_task, next.function, std::move(input_buffer)));
-        not_ready.erase(not_ready_it);
+    }
+
+    const auto prev_dependencies =
+        it->second.fetch_sub(1, std::memory_order_acq_rel);
+    TORCH_INTERNAL_ASSERT(
+        prev_dependencies > 0,
+        "dependency count underflow for ",
+        next.function->name());
+    if (prev_dependencies == 1) {
+      // The next function is ready to be computed
+      if (!should_execute) {
+        continue;
       }
+      auto& shard = graph_task->not_ready_shard(next.function.get());
+      InputBuffer input_buffer(0);
+      {
+        std::lock_guard<std::mutex> shard_lock(shard.mutex);
+        auto not_ready_it = shard.map.find(next.function.get());
+        TORCH_INTERNAL_ASSERT(not_ready_it != shard.map.end());
+        input_buffer = std::move(not_ready_it->second);
+        shard.map.erase(not_ready_it);
+      }
+      auto queue = ready_queue(cpu_ready_queue, input_buffer.device());
+      queue->push(
+          NodeTask(graph_task, next.function, std::move(input_buffer)));
     }
   }
 }
@@ -1025,7 +1284,8 @@ auto Engine::execute(const edge_list& roots,
     auto input = inputs.at(0);
 
     const auto input_stream = InputMetadata(input).stream();
-    const auto opt_next_stream = roots.at(0).function->stream(c10::DeviceType::CUDA);
+    const auto opt_next_stream =
+        consumer_stream_for_input(*roots.at(0).function, roots.at(0).input_nr);
     input_buffer.add(roots.at(0).input_nr,
                       std::move(input),
                       input_stream,
@@ -1145,6 +1405,14 @@ Engine& Engine::get_default_engine() {
   return engine_stub.load()();
 }
 
+std::unique_ptr<SavedVariableHooks> Engine::get_default_saved_variable_hooks() {
+  // See Note [Saved tensor CPU offloading]
+  if (CpuOffloadHooks::enabled()) {
+    return std::make_unique<CpuOffloadHooks>();
+  }
+  return nullptr;
+}
+
 void Engine::queue_callback(std::function<void()> callback) {
   TORCH_CHECK(
       current_graph_task,
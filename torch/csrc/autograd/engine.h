@@ -14,6 +14,8 @@
 #include <torch/csrc/autograd/saved_variable_hooks.h>
 #include <torch/csrc/autograd/utils/warnings.h>
 
+#include <array>
+#include <atomic>
 #include <deque>
 #include <exception>
 #include <functional>
@@ -57,11 +59,28 @@ struct GraphTask: std::enable_shared_from_this<GraphTask> {
   // It is safe to read keep_graph_ without synchronization
   bool keep_graph_;
 
-  // To protect reads/writes to not_ready_, dependencies_, captured_vars_,
-  // has_error_, future_result_, cpu_ready_queue_, and leaf_streams.
+  // To protect reads/writes to captured_vars_, has_error_, future_result_,
+  // cpu_ready_queue_, and leaf_streams.
   std::mutex mutex_;
-  std::unordered_map<Node*, InputBuffer> not_ready_;
-  std::unordered_map<Node*, int> dependencies_;
+
+  // Dependency counts and the buffers of partially accumulated gradients
+  // are deliberately not guarded by mutex_; see Note [Sharded graph task
+  // bookkeeping] in engine.cpp. The dependencies_ map is populated while
+  // the graph is walked single-threaded and only looked up during
+  // execution; the counts themselves are decremented atomically.
+  std::unordered_map<Node*, std::atomic<int>> dependencies_;
+
+  // Not-ready input buffers, sharded by node so concurrent producer
+  // threads only contend when their target nodes land in the same shard.
+  static constexpr size_t kNotReadyShards = 16;
+  struct NotReadyShard {
+    std::mutex mutex;
+    std::unordered_map<Node*, InputBuffer> map;
+  };
+  std::array<NotReadyShard, kNotReadyShards> not_ready_;
+  NotReadyShard& not_ready_shard(Node* fn) {
+    return not_ready_[std::hash<Node*>()(fn) % kNotReadyShards];
+  }
 
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   struct ExecInfo {
@@ -175,6 +194,22 @@ struct GraphTask: std::enable_shared_from_this<GraphTask> {
 
   utils::DelayWarningHandler warning_handler_;
 
+  // Bookkeeping for post hooks that run on the deferred hook lane instead of
+  // the engine worker thread; see Note [Deferred post hooks] in engine.cpp.
+  // The counter is incremented before a hook batch is enqueued and
+  // decremented when it finishes; exec_post_processing waits for it to reach
+  // zero before completing the future.
+  std::atomic<uint64_t> outstanding_deferred_hooks_{0};
+  std::mutex deferred_hooks_mutex_;
+  std::condition_variable deferred_hooks_cv_;
+  // First exception raised by a deferred hook, rethrown from
+  // wait_for_deferred_hooks(). Guarded by deferred_hooks_mutex_.
+  std::exception_ptr deferred_hooks_error_;
+
+  // Blocks until all deferred post hooks enqueued by this task have run,
+  // then rethrows the first error one of them raised (if any).
+  void wait_for_deferred_hooks();
+
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   GraphTask(
       bool keep_graph,
@@ -270,7 +305,24 @@ struct ReadyQueue {
 
   std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime> heap_;
 
+  // Producers publish tasks onto this lock-free intrusive stack; consumers
+  // move them into heap_ under mutex_, so pushes from many worker threads
+  // don't serialize on the mutex. See Note [Lock-free ReadyQueue inbox].
+  struct InboxNode {
+    NodeTask task;
+    InboxNode* next;
+  };
+  std::atomic<InboxNode*> inbox_{nullptr};
+  // Number of threads blocked in pop(); producers only take mutex_ to
+  // deliver a wakeup when this is nonzero.
+  std::atomic<int64_t> waiters_{0};
+
+  // Moves everything from inbox_ into heap_. Must be called with mutex_
+  // held.
+  void drain_inbox();
+
  public:
+  ~ReadyQueue();
   // incrementOutstandingTasks indicates whether or not we should increment
   // 'outstanding_tasks_' for the associated GraphTask. This should mostly
   // always be true and is only set false in certain cases (see docs for
@@ -318,9 +370,9 @@ struct TORCH_API Engine {
     return std::make_unique<AnomalyMetadata>();
   }
 
-  virtual std::unique_ptr<SavedVariableHooks> get_default_saved_variable_hooks() {
-    return nullptr;
-  }
+  // Returns the CPU offload hooks when TORCH_SAVED_TENSORS_OFFLOAD is set.
+  // See Note [Saved tensor CPU offloading]
+  virtual std::unique_ptr<SavedVariableHooks> get_default_saved_variable_hooks();
 
   // We pass cpu_ready_queue to evaluate_function, so that it knows
   // the correct ready queue to push to after a NodeTask is ready
@@ -30,7 +30,11 @@ struct FunctionPreHook;
 
 using tensor_list = std::vector<at::Tensor>;
 using variable_list = std::vector<Variable>;
-using edge_list = std::vector<Edge>;
+// Almost all nodes in real graphs have at most two next edges, so keeping
+// them inline avoids a separate heap allocation per Node during graph
+// construction and the pointer chase when the graph is torn down. This
+// mirrors the inline storage used for input_metadata_ below.
+using edge_list = at::SmallVector<Edge, 2>;
 using saved_variable_list = std::vector<SavedVariable>;
 using IndexRange = std::pair<size_t, size_t>;
 
@@ -230,6 +234,31 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
     return c10::nullopt;
   }
 
+  /**
+   * The streams recorded for this function's inputs, one per distinct
+   * device of the given type (same-device inputs MUST share a stream, see
+   * above). Backward execution guards onto all of them so that a function
+   * whose inputs span several devices consumes each gradient on the stream
+   * its forward counterpart used, rather than on the secondary devices'
+   * default streams. See Note [Streaming backwards].
+   */
+  std::vector<c10::Stream> streams(const c10::DeviceType device_type) {
+    std::vector<c10::Stream> streams;
+    for (const auto& metadata : input_metadata_) {
+      if (metadata.device().type() != device_type) {
+        continue;
+      }
+      const auto device_already_seen = std::any_of(
+          streams.begin(), streams.end(), [&](const c10::Stream& stream) {
+            return stream.device() == metadata.device();
+          });
+      if (!device_already_seen) {
+        streams.push_back(metadata.stream());
+      }
+    }
+    return streams;
+  }
+
   void clear_input_metadata() {
     input_metadata_.clear();
   }
@@ -433,6 +462,11 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   /// Releases saved variables if the operation won't be reused.
   virtual void release_variables() {}
 
+  /// Asks any spilled saved variables of this function to start migrating
+  /// back to their home device ahead of apply().
+  /// See Note [Saved tensor CPU offloading]
+  virtual void prefetch_saved_variables() {}
+
   /// Called before an apply if `release_variables()` is going to be called.
   /// Allows larger ops like `InterpreterAutogradFunction` to incrementally
   /// release variables as they run.
@@ -21,6 +21,14 @@ struct TORCH_API FunctionPostHook {
   virtual variable_list operator()(
     const variable_list& outputs /* grad_inputs */,
     const variable_list& inputs /* grad_outputs */) = 0;
+  // Heavyweight hooks whose return value the engine may ignore (e.g.
+  // communication hooks on leaf accumulators that only launch collectives)
+  // can return true here to run on the deferred hook lane instead of
+  // inline on the engine worker thread; see Note [Deferred post hooks] in
+  // engine.cpp.
+  virtual bool is_deferrable() const {
+    return false;
+  }
 };
 
 }} // namespace torch::autograd
@@ -9,8 +9,10 @@
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <ATen/autocast_mode.h>
 #include <ATen/cpp_custom_type_hack.h>
+#include <ATen/memoize_mode.h>
 #include <ATen/record_function.h>
 #include <torch/csrc/autograd/profiler.h>
+#include <torch/csrc/autograd/profiler_histogram.h>
 #include <torch/csrc/autograd/python_function.h>
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/saved_variable.h>
@@ -20,6 +22,7 @@
 #include <torch/csrc/autograd/python_mode.h>
 #include <torch/csrc/autograd/python_variable.h>
 #include <torch/csrc/utils/pycfunction_helpers.h>
+#include <torch/csrc/utils/python_strings.h>
 #include <c10/core/ScalarType.h>
 
 #include <set>
@@ -108,6 +111,7 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
       .def("correlation_id", &LegacyEvent::correlationId)
       .def("start_us", &LegacyEvent::cpuUs)
       .def("flops", &LegacyEvent::flops)
+      .def("input_bytes", &LegacyEvent::inputBytes)
       .def("is_async", &LegacyEvent::isAsync);
 
   py::enum_<c10::DeviceType>(m, "DeviceType")
@@ -212,6 +216,10 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
       .def("flops", [](const KinetoEvent& e) {
         return e.flops();
       })
+      // bytes read from tensor inputs
+      .def("input_bytes", [](const KinetoEvent& e) {
+        return e.inputBytes();
+      })
       // Whether this is async event or not
       .def("is_async", [](const KinetoEvent& e) {
         return e.isAsync();
@@ -301,6 +309,24 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
       disableProfilerLegacy,
       py::arg("profiler_disable_options") = ProfilerDisableOptions());
   m.def("_profiler_enabled", profilerEnabled);
+
+  // Operator histogram registry, see Note [Operator histograms].
+  py::class_<OpHistogramSnapshot>(m, "_OpHistogram")
+      .def_readonly("name", &OpHistogramSnapshot::name)
+      .def_readonly("count", &OpHistogramSnapshot::count)
+      .def_readonly("total_ns", &OpHistogramSnapshot::total_ns)
+      .def_readonly(
+          "latency_ns_buckets", &OpHistogramSnapshot::latency_ns_buckets)
+      .def_readonly("bytes_buckets", &OpHistogramSnapshot::bytes_buckets);
+  m.def(
+      "_enable_op_histograms",
+      enableOpHistograms,
+      py::arg("record_bytes") = false);
+  m.def("_disable_op_histograms", disableOpHistograms);
+  m.def("_op_histograms_enabled", opHistogramsEnabled);
+  m.def("_export_op_histograms", exportOpHistograms);
+  m.def("_reset_op_histograms", resetOpHistograms);
+
   m.def("_enable_record_function", [](bool enable) {
     at::enableRecordFunction(enable);
   });
@@ -327,6 +353,11 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
   py::class_<c10::InferenceMode>(_C_m, "_InferenceMode")
       .def(py::init<bool>());
 
+  // See Note [Sealing tensors for inference]
+  _C_m.def("_seal_inference_tensor", [](const at::Tensor& tensor) {
+    torch::autograd::seal_inference_tensor(tensor);
+  });
+
   _C_m.def("_register_py_class_for_device", [](const std::string& device, py::object python_type_class) {
     auto cls = python_type_class.ptr();
     registerPythonTensorClass(device, cls);
@@ -450,6 +481,32 @@ static PyObject * clear_autocast_cache(PyObject* _unused, PyObject *arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject * prune_autocast_cache(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  at::autocast::prune_cache();
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * autocast_cache_hit_count(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  return THPUtils_packInt64(at::autocast::get_autocast_cache_hit_count());
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * autocast_cache_miss_count(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  return THPUtils_packInt64(at::autocast::get_autocast_cache_miss_count());
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * reset_autocast_cache_stats(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  at::autocast::reset_autocast_cache_stats();
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject * autocast_increment_nesting(PyObject* _unused, PyObject *arg) {
   HANDLE_TH_ERRORS
   return THPUtils_packInt64(at::autocast::increment_nesting());
@@ -482,6 +539,63 @@ static PyObject * set_autocast_cache_enabled(PyObject* _unused, PyObject *arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject * set_memoize_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!PyBool_Check(arg)) {
+    throw TypeError("enabled must be a bool (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  at::memoize::set_enabled(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * is_memoize_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (at::memoize::is_enabled()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * add_memoized_op(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!THPUtils_checkString(arg)) {
+    throw TypeError("op_name must be a str (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  at::memoize::add_memoized_op(THPUtils_unpackString(arg));
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * remove_memoized_op(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!THPUtils_checkString(arg)) {
+    throw TypeError("op_name must be a str (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  at::memoize::remove_memoized_op(THPUtils_unpackString(arg));
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * clear_memoize_cache(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  at::memoize::clear_cache();
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * set_memoize_cache_max_entries(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!THPUtils_checkLong(arg)) {
+    throw TypeError("max_entries must be an int (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  at::memoize::set_cache_max_entries(THPUtils_unpackUInt64(arg));
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 static PyObject * set_grad_enabled(PyObject* _unused, PyObject *arg) {
   HANDLE_TH_ERRORS
   if (!PyBool_Check(arg)) {
@@ -579,6 +693,10 @@ static PyMethodDef methods[] = { // NOLINT
   {"set_autocast_enabled", set_autocast_enabled, METH_O, nullptr},
   {"is_autocast_enabled", is_autocast_enabled, METH_NOARGS, nullptr},
   {"clear_autocast_cache", clear_autocast_cache, METH_NOARGS, nullptr},
+  {"prune_autocast_cache", prune_autocast_cache, METH_NOARGS, nullptr},
+  {"autocast_cache_hit_count", autocast_cache_hit_count, METH_NOARGS, nullptr},
+  {"autocast_cache_miss_count", autocast_cache_miss_count, METH_NOARGS, nullptr},
+  {"reset_autocast_cache_stats", reset_autocast_cache_stats, METH_NOARGS, nullptr},
   {"set_autocast_cpu_enabled", set_autocast_cpu_enabled, METH_O, nullptr},
   {"is_autocast_cpu_enabled", is_autocast_cpu_enabled, METH_NOARGS, nullptr},
   {"set_autocast_cpu_dtype", set_autocast_cpu_dtype, METH_O, nullptr},
@@ -589,6 +707,12 @@ static PyMethodDef methods[] = { // NOLINT
   {"autocast_decrement_nesting", autocast_decrement_nesting, METH_NOARGS, nullptr},
   {"is_autocast_cache_enabled", is_autocast_cache_enabled, METH_NOARGS, nullptr},
   {"set_autocast_cache_enabled", set_autocast_cache_enabled, METH_O, nullptr},
+  {"_set_memoize_enabled", set_memoize_enabled, METH_O, nullptr},
+  {"_is_memoize_enabled", is_memoize_enabled, METH_NOARGS, nullptr},
+  {"_add_memoized_op", add_memoized_op, METH_O, nullptr},
+  {"_remove_memoized_op", remove_memoized_op, METH_O, nullptr},
+  {"_clear_memoize_cache", clear_memoize_cache, METH_NOARGS, nullptr},
+  {"_set_memoize_cache_max_entries", set_memoize_cache_max_entries, METH_O, nullptr},
   {"set_anomaly_enabled", set_anomaly_mode_enabled, METH_O, nullptr},
   {"is_anomaly_enabled", is_anomaly_mode_enabled, METH_NOARGS, nullptr},
   {"_enter_dual_level", python_enter_dual_level, METH_NOARGS, nullptr},
@@ -58,6 +58,18 @@ namespace {
   }
 }  // anonymous namespace
 
+  // It is safe to mutate v in place if it is a plain strided or sparse
+  // tensor with no autograd metadata (no requires_grad, hooks, or view
+  // info) and this buffer holds the only reference to it and its storage:
+  // such a tensor can only be an intermediate produced during this engine
+  // pass (or the gradient passed by the user), so the mutation is
+  // unobservable.
+  static bool can_accumulate_inplace(const Variable& v) {
+    return !at::isBatchedTensor(v) &&
+        !torch::autograd::impl::get_autograd_meta(v) && v.use_count() == 1 &&
+        (v.is_sparse() || v.storage().use_count() == 1);
+  }
+
   static void accumulate(std::vector<Variable>& buffer,
                          const size_t pos,
                          Variable&& var) {
@@ -66,18 +78,35 @@ namespace {
     // ATen doesn't route sparse additions correctly...
     // do dense + sparse in-place if possible
     if (old_var.is_sparse()) {
-      // It is safe to change the Tensor inplace if the Tensor is only used in this buffer (this could be the gradient passed by the
-      // user) and that no other Tensor is using the same storage.
-      if (!var.is_sparse() && var.is_contiguous() && var.use_count() == 1 && var.storage().use_count() == 1) {
-          buffer[pos] = var.add_(old_var);
-      } else {
+      if (var.is_sparse()) {
+        // Sparse += sparse appends the nnz without coalescing, deferring
+        // the coalesce (and any densification) until the grad is read.
+        if (can_accumulate_inplace(old_var)) {
+          buffer[pos] = old_var.add_(var);
+        } else {
           buffer[pos] = var + old_var;
+        }
+      } else if (var.layout() == c10::kStrided && var.is_contiguous() &&
+                 can_accumulate_inplace(var)) {
+        buffer[pos] = var.add_(old_var);
+      } else {
+        buffer[pos] = var + old_var;
       }
     } else {
-      if (var.is_sparse() && !old_var.is_sparse() && old_var.is_contiguous() && old_var.use_count() == 1 && old_var.storage().use_count() == 1) {
-          buffer[pos] = old_var.add_(var);
+      if (var.is_sparse() && old_var.layout() == c10::kStrided &&
+          old_var.is_contiguous() && can_accumulate_inplace(old_var)) {
+        buffer[pos] = old_var.add_(var);
+      } else if (
+          old_var.layout() == c10::kStrided &&
+          var.layout() == c10::kStrided && can_accumulate_inplace(old_var) &&
+          at::inplaceIsVmapCompatible(old_var, var)) {
+        // Repeated contributions to the same edge (e.g. a tied parameter
+        // used in many places) land here once per producer; accumulating
+        // into the buffer in place avoids allocating and writing out a
+        // fresh sum for every contribution.
+        buffer[pos] = old_var.add_(var);
       } else {
-          buffer[pos] = old_var + var;
+        buffer[pos] = old_var + var;
       }
     }
   }
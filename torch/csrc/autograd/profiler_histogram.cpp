@@ -0,0 +1,214 @@
+#include <torch/csrc/autograd/profiler_histogram.h>
+#include <torch/csrc/autograd/profiler_legacy.h>
+
+#include <ATen/record_function.h>
+#include <c10/util/llvmMathExtras.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace torch { namespace autograd { namespace profiler {
+
+namespace {
+
+// Merging happens once per kHistogramEpoch records per thread; large enough
+// to keep the registry mutex off the hot path, small enough that exports are
+// at most a few hundred records stale per thread.
+constexpr uint64_t kHistogramEpoch = 256;
+
+inline size_t bucketOf(uint64_t value) {
+  return value == 0 ? 0 : c10::llvm::Log2_64(value);
+}
+
+struct Histogram {
+  uint64_t count = 0;
+  uint64_t total_ns = 0;
+  // How many records carried a bytes measurement; bytes buckets are only
+  // exported for ops that have any.
+  uint64_t bytes_count = 0;
+  std::array<uint64_t, kHistogramBuckets> latency_ns{};
+  std::array<uint64_t, kHistogramBuckets> bytes{};
+
+  void add(const Histogram& other) {
+    count += other.count;
+    total_ns += other.total_ns;
+    bytes_count += other.bytes_count;
+    for (size_t i = 0; i < kHistogramBuckets; ++i) {
+      latency_ns[i] += other.latency_ns[i];
+      bytes[i] += other.bytes[i];
+    }
+  }
+};
+
+struct HistogramState {
+  std::mutex mutex;
+  std::unordered_map<std::string, Histogram> merged;
+  at::CallbackHandle handle = 0;
+  std::atomic<bool> enabled{false};
+};
+
+// Leaked so that thread-local destructors running during process shutdown
+// can still merge their tails safely.
+HistogramState& histogramState() {
+  static HistogramState* state = new HistogramState();
+  return *state;
+}
+
+// Per-thread accumulation; merged into the registry every kHistogramEpoch
+// records and when the thread exits. See Note [Operator histograms].
+struct ThreadHistograms {
+  std::unordered_map<std::string, Histogram> hists;
+  uint64_t pending = 0;
+
+  void merge() {
+    auto& state = histogramState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto& kv : hists) {
+      state.merged[kv.first].add(kv.second);
+    }
+    hists.clear();
+    pending = 0;
+  }
+
+  ~ThreadHistograms() {
+    if (pending > 0) {
+      merge();
+    }
+  }
+};
+
+ThreadHistograms& threadHistograms() {
+  thread_local ThreadHistograms hists;
+  return hists;
+}
+
+struct HistogramObserverContext : public at::ObserverContext {
+  std::string name;
+  int64_t start_ns = 0;
+  uint64_t input_bytes = 0;
+  bool has_bytes = false;
+};
+
+std::unique_ptr<at::ObserverContext> onFunctionEnter(
+    const at::RecordFunction& fn) {
+  auto ctx = std::make_unique<HistogramObserverContext>();
+  ctx->name = fn.name().str();
+  if (fn.needsInputs()) {
+    uint64_t bytes = 0;
+    for (const auto& input : fn.inputs()) {
+      if (input.isTensor()) {
+        const auto& tensor = input.toTensor();
+        if (tensor.defined()) {
+          bytes += tensor.nbytes();
+        }
+      } else if (input.isTensorList()) {
+        for (const auto& tensor : input.toTensorVector()) {
+          if (tensor.defined()) {
+            bytes += tensor.nbytes();
+          }
+        }
+      }
+    }
+    ctx->input_bytes = bytes;
+    ctx->has_bytes = true;
+  }
+  ctx->start_ns = getTime();
+  return ctx;
+}
+
+void onFunctionExit(const at::RecordFunction& fn, at::ObserverContext* ctx_ptr) {
+  auto* ctx = static_cast<HistogramObserverContext*>(ctx_ptr);
+  if (!ctx) {
+    return;
+  }
+  const auto duration_ns = static_cast<uint64_t>(
+      std::max<int64_t>(getTime() - ctx->start_ns, 0));
+
+  auto& thread_hists = threadHistograms();
+  auto& hist = thread_hists.hists[ctx->name];
+  hist.count += 1;
+  hist.total_ns += duration_ns;
+  hist.latency_ns[bucketOf(duration_ns)] += 1;
+  if (ctx->has_bytes) {
+    hist.bytes_count += 1;
+    hist.bytes[bucketOf(ctx->input_bytes)] += 1;
+  }
+  if (++thread_hists.pending >= kHistogramEpoch) {
+    thread_hists.merge();
+  }
+}
+
+} // namespace
+
+void enableOpHistograms(bool record_bytes) {
+  auto& state = histogramState();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    TORCH_CHECK(!state.enabled, "Operator histograms are already enabled");
+    state.enabled = true;
+  }
+  state.handle = at::addGlobalCallback(
+      at::RecordFunctionCallback(&onFunctionEnter, &onFunctionExit)
+          .needsInputs(record_bytes)
+          .scopes({at::RecordScope::FUNCTION}));
+}
+
+void disableOpHistograms() {
+  auto& state = histogramState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  TORCH_CHECK(state.enabled, "Operator histograms are not enabled");
+  at::removeCallback(state.handle);
+  state.handle = 0;
+  state.enabled = false;
+}
+
+bool opHistogramsEnabled() {
+  return histogramState().enabled;
+}
+
+std::vector<OpHistogramSnapshot> exportOpHistograms() {
+  auto& state = histogramState();
+  // Merge the calling thread's tail first so single-threaded usage sees its
+  // own records immediately.
+  auto& thread_hists = threadHistograms();
+  if (thread_hists.pending > 0) {
+    thread_hists.merge();
+  }
+
+  std::vector<OpHistogramSnapshot> snapshots;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    snapshots.reserve(state.merged.size());
+    for (const auto& kv : state.merged) {
+      OpHistogramSnapshot snapshot;
+      snapshot.name = kv.first;
+      snapshot.count = kv.second.count;
+      snapshot.total_ns = kv.second.total_ns;
+      snapshot.latency_ns_buckets.assign(
+          kv.second.latency_ns.begin(), kv.second.latency_ns.end());
+      if (kv.second.bytes_count > 0) {
+        snapshot.bytes_buckets.assign(
+            kv.second.bytes.begin(), kv.second.bytes.end());
+      }
+      snapshots.push_back(std::move(snapshot));
+    }
+  }
+  std::sort(
+      snapshots.begin(),
+      snapshots.end(),
+      [](const OpHistogramSnapshot& a, const OpHistogramSnapshot& b) {
+        return a.name < b.name;
+      });
+  return snapshots;
+}
+
+void resetOpHistograms() {
+  auto& state = histogramState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.merged.clear();
+}
+
+}}} // namespace torch::autograd::profiler
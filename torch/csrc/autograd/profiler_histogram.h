@@ -0,0 +1,69 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Note [Operator histograms]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Production monitoring wants op-level latency distributions continuously,
+// without paying for Kineto traces or keeping per-event records around. The
+// histogram registry aggregates every observed op into fixed-size
+// power-of-two histograms: bucket i counts values in [2^i, 2^(i+1)) with
+// value 0 in bucket 0, giving full dynamic range (ns to tens of seconds) in
+// 64 counters per op.
+//
+// Recording is designed to stay enabled indefinitely: each thread
+// accumulates into plain thread-local counters and merges them into the
+// process-wide registry under its mutex only once every kHistogramEpoch
+// records, so the hot path is an interned-id lookup and a couple of
+// increments. The price is bounded staleness: an export can lag a thread's
+// latest records by up to one epoch (threads that stop running ops keep
+// their unmerged tail until they record again).
+//
+// Bytes-touched histograms are optional because they require capturing op
+// inputs (needsInputs), which has its own cost; when enabled, every tensor
+// argument's storage bytes are summed per call.
+
+constexpr size_t kHistogramBuckets = 64;
+
+// Aggregated per-op statistics, produced by exportOpHistograms().
+struct OpHistogramSnapshot {
+  std::string name;
+  uint64_t count = 0;
+  uint64_t total_ns = 0;
+  // latency_ns_buckets[i] counts calls whose latency fell in [2^i, 2^(i+1)) ns.
+  std::vector<uint64_t> latency_ns_buckets;
+  // bytes_buckets[i] counts calls whose summed tensor input bytes fell in
+  // [2^i, 2^(i+1)); empty unless bytes recording is enabled.
+  std::vector<uint64_t> bytes_buckets;
+};
+
+// Enables histogram recording globally (all threads). When record_bytes is
+// true, op inputs are captured and per-call tensor input bytes are
+// histogrammed alongside latency. Coexists with the Kineto and sampling
+// profilers.
+TORCH_API void enableOpHistograms(bool record_bytes = false);
+
+TORCH_API void disableOpHistograms();
+
+TORCH_API bool opHistogramsEnabled();
+
+// Returns a snapshot of the registry, one entry per distinct op name seen.
+// Does not stop collection; see the staleness caveat in
+// Note [Operator histograms].
+TORCH_API std::vector<OpHistogramSnapshot> exportOpHistograms();
+
+// Clears all merged statistics. Thread-local tails that have not been merged
+// yet survive a reset and show up in later exports.
+TORCH_API void resetOpHistograms();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
@@ -122,6 +122,7 @@ struct KinetoThreadLocalState : public ProfilerThreadLocalState {
       }
       if (ctx->extraArgs && !ctx->extraArgs->empty()) {
         kineto_events_.back().flops(computeFlops(std::string(evt_name), *ctx->extraArgs));
+        kineto_events_.back().inputBytes(computeBytes(*ctx->extraArgs));
       }
       kineto_events_.back().cuda_event_start_ = ctx->cuda_event_start_;
       kineto_events_.back().cuda_event_end_ = ctx->cuda_event_end_;
@@ -124,6 +124,15 @@ struct TORCH_API KinetoEvent {
     return *this;
   }
 
+  uint64_t inputBytes() const {
+    return input_bytes_;
+  }
+
+  KinetoEvent& inputBytes(uint64_t input_bytes) {
+    input_bytes_ = input_bytes;
+    return *this;
+  }
+
   int64_t sequenceNr() const {
     return sequence_nr_;
   }
@@ -290,6 +299,7 @@ struct TORCH_API KinetoEvent {
   c10::optional<std::vector<std::string>> module_hierarchy_;
   c10::optional<std::vector<std::string>> dtypes_;
   uint64_t flops_ = 0;
+  uint64_t input_bytes_ = 0;
 
   std::string name_;
   uint8_t device_index_ = 0;
@@ -234,6 +234,7 @@ void ProfilerThreadLocalState::pushRange(
     if (config_.with_flops) {
       evt.setExtraArgs(saveExtraArgs(fn));
       evt.setFlops(computeFlops(std::string(fn.name().str()), evt.extraArgs()));
+      evt.setInputBytes(computeBytes(evt.extraArgs()));
     }
 
 // TODO: will unify the two macros BUILD_LITE_INTERPRETER and C10_MOBILE soon.
@@ -326,6 +326,14 @@ struct TORCH_API LegacyEvent {
     flops_ = flops;
   }
 
+  uint64_t inputBytes() {
+    return input_bytes_;
+  }
+
+  void setInputBytes(uint64_t input_bytes) {
+    input_bytes_ = input_bytes;
+  }
+
  private:
   // signed to allow for negative intervals, initialized for safety.
   int64_t cpu_ns_ = 0;
@@ -351,6 +359,7 @@ struct TORCH_API LegacyEvent {
   // Extra arguments for computing op flops
   std::unordered_map<std::string, c10::IValue> extra_args_;
   uint64_t flops_ = 0;
+  uint64_t input_bytes_ = 0;
 };
 
 // a linked-list of fixed sized vectors, to avoid
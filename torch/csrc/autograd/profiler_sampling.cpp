@@ -0,0 +1,173 @@
+#include <torch/csrc/autograd/profiler_sampling.h>
+
+#include <ATen/record_function.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace torch { namespace autograd { namespace profiler {
+
+namespace {
+
+// See Note [Sampling profiler]. Each buffer has a single writer (the owning
+// thread), which stores the record and then publishes it with a release store
+// of the head index. Export walks the buffers concurrently without stopping
+// collection; a record that is being overwritten while it is read can tear,
+// which export tolerates by dropping records it cannot symbolize.
+struct RingBuffer {
+  explicit RingBuffer(size_t capacity)
+      : records(capacity),
+        thread_id(at::RecordFunction::currentThreadId()) {}
+
+  void push(const SampledRecord& record) {
+    const auto h = head.load(std::memory_order_relaxed);
+    records[h % records.size()] = record;
+    head.store(h + 1, std::memory_order_release);
+  }
+
+  std::vector<SampledRecord> records;
+  std::atomic<uint64_t> head{0};
+  uint64_t thread_id;
+};
+
+struct SamplingState {
+  // Guards buffer registration and the intern table; the record hot path
+  // takes no lock.
+  std::mutex mutex;
+  std::vector<std::shared_ptr<RingBuffer>> buffers;
+  std::unordered_map<std::string, uint32_t> op_ids;
+  std::vector<std::string> op_names;
+  size_t per_thread_capacity = 8192;
+  at::CallbackHandle handle = 0;
+  std::atomic<bool> enabled{false};
+};
+
+SamplingState& samplingState() {
+  static SamplingState state;
+  return state;
+}
+
+// A thread keeps its buffer for its lifetime; re-enabling with a different
+// capacity only affects threads that record for the first time afterwards.
+RingBuffer& threadBuffer() {
+  thread_local std::shared_ptr<RingBuffer> buffer = []() {
+    auto& state = samplingState();
+    auto buf = std::make_shared<RingBuffer>(state.per_thread_capacity);
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.buffers.push_back(buf);
+    return buf;
+  }();
+  return *buffer;
+}
+
+// Called only for sampled ops, so the lock is off the common path; the number
+// of distinct op names is small and each is copied exactly once.
+uint32_t internOpName(const char* name) {
+  auto& state = samplingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  auto it = state.op_ids.find(name);
+  if (it != state.op_ids.end()) {
+    return it->second;
+  }
+  const auto id = static_cast<uint32_t>(state.op_names.size());
+  state.op_ids.emplace(name, id);
+  state.op_names.emplace_back(name);
+  return id;
+}
+
+struct SamplingObserverContext : public at::ObserverContext {
+  SampledRecord record;
+};
+
+std::unique_ptr<at::ObserverContext> onFunctionEnter(
+    const at::RecordFunction& fn) {
+  auto ctx = std::make_unique<SamplingObserverContext>();
+  ctx->record.op_id = internOpName(fn.name().str());
+  ctx->record.correlation_id = fn.handle();
+  ctx->record.scope = static_cast<uint8_t>(fn.scope());
+  ctx->record.start_us = getTime() / 1000;
+  return ctx;
+}
+
+void onFunctionExit(const at::RecordFunction& fn, at::ObserverContext* ctx_ptr) {
+  auto* ctx = static_cast<SamplingObserverContext*>(ctx_ptr);
+  if (!ctx) {
+    return;
+  }
+  const int64_t end_us = getTime() / 1000;
+  auto& record = ctx->record;
+  record.duration_us = static_cast<uint32_t>(std::min<int64_t>(
+      std::max<int64_t>(end_us - record.start_us, 0),
+      std::numeric_limits<uint32_t>::max()));
+  threadBuffer().push(record);
+}
+
+} // namespace
+
+void enableSamplingProfiler(uint32_t sample_every, size_t per_thread_capacity) {
+  TORCH_CHECK(sample_every > 0, "sample_every must be positive");
+  TORCH_CHECK(per_thread_capacity > 0, "per_thread_capacity must be positive");
+  auto& state = samplingState();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    TORCH_CHECK(!state.enabled, "Sampling profiler is already enabled");
+    state.per_thread_capacity = per_thread_capacity;
+    state.enabled = true;
+  }
+  state.handle = at::addGlobalCallback(
+      at::RecordFunctionCallback(&onFunctionEnter, &onFunctionExit)
+          .needsIds(true)
+          .samplingProb(1.0 / sample_every));
+}
+
+void disableSamplingProfiler() {
+  auto& state = samplingState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  TORCH_CHECK(state.enabled, "Sampling profiler is not enabled");
+  at::removeCallback(state.handle);
+  state.handle = 0;
+  state.enabled = false;
+}
+
+bool samplingProfilerEnabled() {
+  return samplingState().enabled;
+}
+
+std::vector<SampledEvent> exportSampledEvents() {
+  auto& state = samplingState();
+  std::vector<std::shared_ptr<RingBuffer>> buffers;
+  std::vector<std::string> op_names;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    buffers = state.buffers;
+    op_names = state.op_names;
+  }
+  std::vector<SampledEvent> events;
+  for (const auto& buffer : buffers) {
+    const auto head = buffer->head.load(std::memory_order_acquire);
+    const auto count =
+        std::min<uint64_t>(head, static_cast<uint64_t>(buffer->records.size()));
+    for (uint64_t i = 0; i < count; ++i) {
+      const auto idx = (head - count + i) % buffer->records.size();
+      const SampledRecord record = buffer->records[idx];
+      // A record overwritten mid-read can carry an id from a torn write.
+      if (record.op_id >= op_names.size()) {
+        continue;
+      }
+      events.push_back(SampledEvent{
+          op_names[record.op_id],
+          record.start_us,
+          record.duration_us,
+          record.correlation_id,
+          buffer->thread_id,
+          record.scope});
+    }
+  }
+  return events;
+}
+
+}}} // namespace torch::autograd::profiler
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <torch/csrc/autograd/profiler_legacy.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Note [Sampling profiler]
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The Kineto profiler materializes a KinetoEvent per observed op, including
+// string copies and shape vectors, which is too expensive to leave enabled
+// continuously on small-op workloads. The sampling tier trades completeness
+// for overhead: ops are observed with probability 1/sample_every (using the
+// sampling support already built into RecordFunctionCallback), and each
+// observation is a fixed-size binary record appended to the calling thread's
+// ring buffer. Op names are interned into a global table once per distinct
+// name, so the record stores a 32-bit id; symbolization is deferred until
+// export. Old records are overwritten once a buffer wraps.
+
+// Fixed-size record stored in the per-thread ring buffers.
+struct SampledRecord {
+  int64_t start_us;
+  uint64_t correlation_id;
+  uint32_t op_id;
+  uint32_t duration_us;
+  uint8_t scope;
+};
+
+// A symbolized record, produced at export time.
+struct SampledEvent {
+  std::string name;
+  int64_t start_us;
+  uint64_t duration_us;
+  uint64_t correlation_id;
+  uint64_t thread_id;
+  uint8_t scope;
+};
+
+// Enables the sampling tier globally (all threads): each started op is
+// recorded with probability 1/sample_every into the calling thread's ring
+// buffer of per_thread_capacity records. Coexists with the full Kineto
+// profiler.
+TORCH_API void enableSamplingProfiler(
+    uint32_t sample_every = 100,
+    size_t per_thread_capacity = 8192);
+
+TORCH_API void disableSamplingProfiler();
+
+TORCH_API bool samplingProfilerEnabled();
+
+// Snapshots all per-thread ring buffers and resolves op ids into names.
+// Records being overwritten while the snapshot is taken may be dropped;
+// this is a best-effort view by design and does not stop collection.
+TORCH_API std::vector<SampledEvent> exportSampledEvents();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
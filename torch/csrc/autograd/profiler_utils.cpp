@@ -1,5 +1,7 @@
 #include <torch/csrc/autograd/profiler_utils.h>
 
+#include <unordered_set>
+
 namespace torch { namespace autograd { namespace profiler {
 
 static constexpr auto kConv2dStride = 3;
@@ -15,6 +17,8 @@ static constexpr auto kMulOp = "aten::mul";
 static constexpr auto kAddOp = "aten::add";
 static constexpr auto kBMMOp = "aten::bmm";
 static constexpr auto kBAddBMMOp = "aten::baddbmm";
+static constexpr auto kLinearOp = "aten::linear";
+static constexpr auto kMatmulOp = "aten::matmul";
 
 static constexpr auto kInputSize = "input_size";
 static constexpr auto kWeightSize = "weight_size";
@@ -25,6 +29,18 @@ static constexpr auto kDilation = "dilation";
 static constexpr auto kMatSize = "mat_size";
 static constexpr auto kMat1Size = "mat1_size";
 static constexpr auto kMat2Size = "mat2_size";
+static constexpr auto kInputBytes = "input_bytes";
+
+// Elementwise ops estimated at one flop per element, matching the treatment
+// of aten::mul and aten::add below. These ops are bandwidth bound, so a
+// precise per-element operation count (e.g. for gelu) isn't worth modeling.
+static bool isElementwiseOp(const std::string &op_name) {
+  static const std::unordered_set<std::string> elementwise_ops = {
+      "aten::sub", "aten::div", "aten::relu", "aten::sigmoid",
+      "aten::tanh", "aten::exp", "aten::log", "aten::sqrt",
+      "aten::rsqrt", "aten::neg", "aten::abs", "aten::gelu"};
+  return elementwise_ops.count(op_name) != 0;
+}
 
 static bool validateInput(const std::string &op_name, size_t min_size,
                        const std::vector<c10::IValue>& inputs,
@@ -62,6 +78,29 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(const at::RecordFunct
     return map;
   }
 
+  // Total bytes read from tensor inputs. Output tensors aren't visible here,
+  // so this is a lower bound on memory traffic; it feeds the roofline
+  // annotation (see EventList.roofline_analysis) rather than exact bandwidth
+  // accounting.
+  int64_t input_bytes = 0;
+  for (const c10::IValue& input : inputs) {
+    if (input.isTensor()) {
+      const at::Tensor& tensor = input.toTensor();
+      if (tensor.defined()) {
+        input_bytes += tensor.numel() * tensor.element_size();
+      }
+    } else if (input.isTensorList()) {
+      for (const at::Tensor& tensor : input.toTensorVector()) {
+        if (tensor.defined()) {
+          input_bytes += tensor.numel() * tensor.element_size();
+        }
+      }
+    }
+  }
+  if (input_bytes > 0) {
+    map[kInputBytes] = at::IValue(input_bytes);
+  }
+
   if (fname == kConv2dOp) {
     std::vector<int> tensors{0, 1};
     bool check = validateInput(fname, kConv2dGroups + 1, inputs, tensors);
@@ -151,6 +190,37 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(const at::RecordFunct
     at::Tensor right = inputs[2].toTensor();
     map[kMat1Size] = at::IValue(left.sizes());
     map[kMat2Size] = at::IValue(right.sizes());
+  } else if (fname == kLinearOp) {
+    std::vector<int> tensors{0, 1};
+    bool check = validateInput(fname, 2, inputs, tensors);
+    if (!check) {
+      return map;
+    }
+
+    at::Tensor input = inputs[0].toTensor();
+    at::Tensor weight = inputs[1].toTensor();
+    map[kInputSize] = at::IValue(input.sizes());
+    map[kWeightSize] = at::IValue(weight.sizes());
+  } else if (fname == kMatmulOp) {
+    std::vector<int> tensors{0, 1};
+    bool check = validateInput(fname, 2, inputs, tensors);
+    if (!check) {
+      return map;
+    }
+
+    at::Tensor left = inputs[0].toTensor();
+    at::Tensor right = inputs[1].toTensor();
+    map[kMat1Size] = at::IValue(left.sizes());
+    map[kMat2Size] = at::IValue(right.sizes());
+  } else if (isElementwiseOp(fname)) {
+    std::vector<int> tensors{0};
+    bool check = validateInput(fname, 1, inputs, tensors);
+    if (!check) {
+      return map;
+    }
+
+    at::Tensor mat = inputs[0].toTensor();
+    map[kMatSize] = at::IValue(mat.sizes());
   }
 
   return map;
@@ -293,31 +363,75 @@ uint64_t computeFlops(const std::string &op_name, const std::unordered_map<std::
     }
     flops *= gemm_multiply_factor;
     return flops;
-  } else if (op_name == kMulOp) {
-    if (extra_args.find(kMatSize) == extra_args.end()) {
-      TORCH_WARN("Calculating flops for aten::mul.Tensor requires mat_size in saved arguments.");
+  } else if (op_name == kLinearOp) {
+    if (extra_args.find(kInputSize) == extra_args.end()
+        || extra_args.find(kWeightSize) == extra_args.end()) {
+      TORCH_WARN("Calculating flops for aten::linear requires input_size and weight_size in saved arguments.");
       return 0;
     }
-    auto mat_sizes = extra_args.at(kMatSize);
-    if (!mat_sizes.isIntList()) {
-      TORCH_WARN("Failed to compute flops for op aten::mul because it requires mat_size to be IntList.");
+    auto input_sizes_ref = extra_args.at(kInputSize);
+    auto weight_sizes_ref = extra_args.at(kWeightSize);
+    if (!input_sizes_ref.isIntList() || !weight_sizes_ref.isIntList()) {
+      TORCH_WARN("Failed to compute flops for op aten::linear because it requires input_size and weight_size to be IntList.");
       return 0;
     }
 
-    std::vector<int64_t> mat_size = mat_sizes.toIntVector();
+    const std::vector<int64_t> input_sizes = input_sizes_ref.toIntVector();
+    const std::vector<int64_t> weight_sizes = weight_sizes_ref.toIntVector();
+    if (input_sizes.size() == 0 || weight_sizes.size() != 2) {
+      TORCH_WARN("Failed to compute flops for op aten::linear because it requires a 2D weight tensor.");
+      return 0;
+    }
+
+    // One multiply-add per (input element, output feature) pair; the
+    // reduction dim is already counted by iterating the full input shape.
+    const uint64_t gemm_multiply_factor = 2;
     uint64_t flops = 1;
-    for(int64_t dim : mat_size) {
+    for(int64_t dim : input_sizes) {
       flops *= dim;
     }
+    flops *= weight_sizes[0];
+    flops *= gemm_multiply_factor;
     return flops;
-  } else if (op_name == kAddOp) {
+  } else if (op_name == kMatmulOp) {
+    if (extra_args.find(kMat1Size) == extra_args.end()
+        || extra_args.find(kMat2Size) == extra_args.end()) {
+      TORCH_WARN("Calculating flops for aten::matmul requires mat1_size and mat2_size in saved arguments.");
+      return 0;
+    }
+    auto mat1_sizes_ref = extra_args.at(kMat1Size);
+    auto mat2_sizes_ref = extra_args.at(kMat2Size);
+    if (!mat1_sizes_ref.isIntList() || !mat2_sizes_ref.isIntList()) {
+      TORCH_WARN("Failed to compute flops for op aten::matmul because it requires mat1_size and mat2_size to be IntList.");
+      return 0;
+    }
+
+    std::vector<int64_t> mat1_size = mat1_sizes_ref.toIntVector();
+    std::vector<int64_t> mat2_size = mat2_sizes_ref.toIntVector();
+    if (mat1_size.size() == 0) {
+      return 0;
+    }
+
+    // Each of prod(mat1_size) input elements participates in one multiply-add
+    // per column of the second operand (one dot product for a vector rhs).
+    // Batch dims broadcast from the second operand are not modeled.
+    int64_t out_columns = mat2_size.size() >= 2 ? mat2_size.back() : 1;
+    const uint64_t gemm_multiply_factor = 2;
+    uint64_t flops = 1;
+    for(int64_t dim : mat1_size) {
+      flops *= dim;
+    }
+    flops *= out_columns;
+    flops *= gemm_multiply_factor;
+    return flops;
+  } else if (op_name == kMulOp || op_name == kAddOp || isElementwiseOp(op_name)) {
     if (extra_args.find(kMatSize) == extra_args.end()) {
-      TORCH_WARN("Calculating flops for aten::add.Tensor requires mat_size in saved arguments.");
+      TORCH_WARN("Calculating flops for ", op_name, " requires mat_size in saved arguments.");
       return 0;
     }
     auto mat_sizes = extra_args.at(kMatSize);
     if (!mat_sizes.isIntList()) {
-      TORCH_WARN("Failed to compute flops for op aten::add because it requires mat_size to be IntList.");
+      TORCH_WARN("Failed to compute flops for op ", op_name, " because it requires mat_size to be IntList.");
       return 0;
     }
 
@@ -331,6 +445,14 @@ uint64_t computeFlops(const std::string &op_name, const std::unordered_map<std::
   return 0;
 }
 
+uint64_t computeBytes(const std::unordered_map<std::string, c10::IValue> &extra_args) {
+  auto it = extra_args.find(kInputBytes);
+  if (it == extra_args.end() || !it->second.isInt()) {
+    return 0;
+  }
+  return it->second.toInt();
+}
+
 } // namespace profiler
 } // namespace autograd
 } // namespace torch
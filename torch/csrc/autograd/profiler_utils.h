@@ -13,4 +13,8 @@ std::unordered_map<std::string, c10::IValue> TORCH_API saveExtraArgs(const at::R
 uint64_t TORCH_API computeFlops(const std::string &op_name,
                                 const std::unordered_map<std::string, c10::IValue> &extra_args);
 
+// Bytes read from tensor inputs as recorded by saveExtraArgs; a lower bound
+// on the memory traffic of the op (output tensors are not counted).
+uint64_t TORCH_API computeBytes(const std::unordered_map<std::string, c10::IValue> &extra_args);
+
 }}}
@@ -107,7 +107,12 @@ std::unique_ptr<AnomalyMetadata> PythonEngine::make_anomaly_metadata() {
 }
 
 std::unique_ptr<SavedVariableHooks> PythonEngine::get_default_saved_variable_hooks() {
-  return PyDefaultSavedVariableHooks::get_hooks();
+  if (auto hooks = PyDefaultSavedVariableHooks::get_hooks()) {
+    return hooks;
+  }
+  // Python hooks take precedence; fall back to the env-gated CPU offload
+  // hooks. See Note [Saved tensor CPU offloading]
+  return Engine::get_default_saved_variable_hooks();
 }
 
 variable_list PythonEngine::execute(
@@ -222,7 +227,7 @@ PyObject *THPEngine_run_backward(PyObject *self, PyObject *args, PyObject *kwarg
     }
   }
 
-  std::vector<Edge> output_edges;
+  edge_list output_edges;
   if (inputs != nullptr) {
     int num_inputs = PyTuple_GET_SIZE(inputs);
     output_edges.reserve(num_inputs);
@@ -0,0 +1,60 @@
+#include <torch/csrc/autograd/request_trace.h>
+
+#include <ATen/record_function.h>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+namespace {
+
+at::CallbackHandle& requestTraceCallbackHandle() {
+  static at::CallbackHandle handle = 0;
+  return handle;
+}
+
+std::unique_ptr<at::ObserverContext> onRequestTraceEnter(
+    const at::RecordFunction& fn) {
+  if (c10::RequestTracer::active()) {
+    c10::RequestTracer::record(
+        c10::RequestTraceEventKind::OP_BEGIN,
+        c10::RequestTracer::internString(fn.name().str()),
+        static_cast<int64_t>(fn.handle()),
+        c10::Device(c10::DeviceType::CPU));
+  }
+  return nullptr;
+}
+
+void onRequestTraceExit(const at::RecordFunction& fn, at::ObserverContext*) {
+  if (c10::RequestTracer::active()) {
+    c10::RequestTracer::record(
+        c10::RequestTraceEventKind::OP_END,
+        c10::RequestTracer::internString(fn.name().str()),
+        static_cast<int64_t>(fn.handle()),
+        c10::Device(c10::DeviceType::CPU));
+  }
+}
+
+} // namespace
+
+void enableRequestTrace() {
+  auto& handle = requestTraceCallbackHandle();
+  if (handle == 0) {
+    handle = at::addGlobalCallback(at::RecordFunctionCallback(
+        &onRequestTraceEnter, &onRequestTraceExit));
+  }
+  c10::RequestTracer::setEnabled(true);
+}
+
+void disableRequestTrace() {
+  c10::RequestTracer::setEnabled(false);
+  auto& handle = requestTraceCallbackHandle();
+  if (handle != 0) {
+    at::removeCallback(handle);
+    handle = 0;
+  }
+}
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
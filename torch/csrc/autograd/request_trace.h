@@ -0,0 +1,24 @@
+#pragma once
+
+#include <c10/util/RequestTracer.h>
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+namespace torch {
+namespace autograd {
+namespace profiler {
+
+// Registers a global RecordFunction observer that places OP_BEGIN/OP_END
+// events on the request timeline for every scope the profiler would see
+// (dispatcher ops, backward nodes, TorchScript functions, user scopes)
+// and flips on event collection. Scope the actual recording with
+// c10::RequestTraceGuard; see Note [Request trace] in
+// c10/util/RequestTracer.cpp.
+TORCH_API void enableRequestTrace();
+
+// Stops event collection and unregisters the observer. Buffered events
+// stay available for c10::RequestTracer::dump().
+TORCH_API void disableRequestTrace();
+
+} // namespace profiler
+} // namespace autograd
+} // namespace torch
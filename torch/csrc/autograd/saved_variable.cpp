@@ -104,6 +104,12 @@ std::unique_ptr<SavedVariableHooks> SavedVariable::get_default_hooks() {
   return Engine::get_default_engine().get_default_saved_variable_hooks();
 }
 
+void SavedVariable::prefetch() {
+  if (hooks_) {
+    hooks_->call_prefetch_hook();
+  }
+}
+
 void SavedVariable::reset_data() {
   hooks_.reset();
   grad_fn_.reset();
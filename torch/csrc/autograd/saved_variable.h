@@ -39,6 +39,11 @@ class TORCH_API SavedVariable {
 
   void register_hooks(std::unique_ptr<SavedVariableHooks>&& hooks);
 
+  /// If hooks are registered and support it, begins restoring the saved data
+  /// ahead of `unpack` (e.g. copying a spilled activation back to its
+  /// device). See Note [Saved tensor CPU offloading]
+  void prefetch();
+
   void reset_data();
 
  private:
@@ -7,6 +7,10 @@ namespace torch { namespace autograd {
 struct TORCH_API SavedVariableHooks {
   virtual void call_pack_hook(const at::Tensor &tensor) = 0;
   virtual at::Tensor call_unpack_hook() = 0;
+  // Optionally begins restoring the packed data ahead of call_unpack_hook,
+  // e.g. copying a spilled activation back to its device.
+  // See Note [Saved tensor CPU offloading]
+  virtual void call_prefetch_hook() {}
   virtual ~SavedVariableHooks() = default;
 };
 
@@ -0,0 +1,173 @@
+#include <torch/csrc/autograd/saved_variable_offload_hooks.h>
+
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/DeviceGuardImplInterface.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace torch { namespace autograd {
+
+namespace {
+
+size_t parse_size_env(const char* name, size_t default_value) {
+  const auto* const value = std::getenv(name);
+  if (value == nullptr) {
+    return default_value;
+  }
+  return static_cast<size_t>(std::strtoull(value, nullptr, 10));
+}
+
+// Bytes of eligible saved activations currently kept resident on device.
+// Activations packed while this is below the watermark stay put, the rest
+// are spilled. See Note [Saved tensor CPU offloading]
+std::atomic<size_t> resident_bytes{0};
+
+size_t offload_min_bytes() {
+  static const size_t min_bytes =
+      parse_size_env("TORCH_SAVED_TENSORS_OFFLOAD_MIN_BYTES", 1 << 20);
+  return min_bytes;
+}
+
+size_t offload_watermark_bytes() {
+  static const size_t watermark =
+      parse_size_env("TORCH_SAVED_TENSORS_OFFLOAD_WATERMARK_BYTES", 0);
+  return watermark;
+}
+
+// One dedicated copy stream per device and direction, so spills (D2H) and
+// prefetches (H2D) each pipeline on their own stream instead of competing
+// with compute or with each other. Only CUDA devices are eligible for
+// offloading, so keying by device index is sufficient.
+c10::Stream copy_stream(const c10::Device& device, bool for_prefetch) {
+  static std::mutex mutex;
+  static std::unordered_map<int, c10::Stream> spill_streams;
+  static std::unordered_map<int, c10::Stream> fetch_streams;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& streams = for_prefetch ? fetch_streams : spill_streams;
+  auto it = streams.find(device.index());
+  if (it == streams.end()) {
+    const c10::impl::VirtualGuardImpl impl(device.type());
+    it = streams
+             .emplace(
+                 device.index(),
+                 impl.getStreamFromGlobalPool(
+                     device, /*isHighPriority=*/false))
+             .first;
+  }
+  return it->second;
+}
+
+} // namespace
+
+bool CpuOffloadHooks::enabled() {
+  static const bool enabled = [] {
+    const auto* const value = std::getenv("TORCH_SAVED_TENSORS_OFFLOAD");
+    return value != nullptr && std::strcmp(value, "1") == 0;
+  }();
+  return enabled;
+}
+
+int CpuOffloadHooks::prefetch_distance() {
+  static const int distance = enabled()
+      ? static_cast<int>(parse_size_env(
+            "TORCH_SAVED_TENSORS_OFFLOAD_PREFETCH_DISTANCE", 2))
+      : 0;
+  return distance;
+}
+
+CpuOffloadHooks::~CpuOffloadHooks() {
+  if (counted_bytes_ > 0) {
+    resident_bytes.fetch_sub(counted_bytes_);
+  }
+}
+
+void CpuOffloadHooks::call_pack_hook(const at::Tensor& tensor) {
+  if (!tensor.defined() || !tensor.is_cuda() ||
+      tensor.layout() != c10::kStrided ||
+      tensor.storage().nbytes() < offload_min_bytes()) {
+    data_ = tensor;
+    return;
+  }
+
+  // Keep activations resident until the watermark is reached, spill beyond.
+  const auto nbytes = tensor.storage().nbytes();
+  const auto prev = resident_bytes.fetch_add(nbytes);
+  if (prev + nbytes <= offload_watermark_bytes()) {
+    data_ = tensor;
+    counted_bytes_ = nbytes;
+    return;
+  }
+  resident_bytes.fetch_sub(nbytes);
+
+  device_ = tensor.device();
+  const c10::impl::VirtualGuardImpl impl(device_.type());
+  const auto spill_stream = copy_stream(device_, /*for_prefetch=*/false);
+
+  // The spill must observe the producer's writes to the activation.
+  c10::Event produced(device_.type());
+  produced.record(impl.getStream(device_));
+  produced.block(spill_stream);
+
+  {
+    c10::StreamGuard stream_guard(spill_stream);
+    data_ = at::empty(
+        tensor.sizes(), tensor.options().device(at::kCPU).pinned_memory(true));
+    data_.copy_(tensor, /*non_blocking=*/true);
+  }
+  // The caller typically drops the activation right after packing; keep the
+  // caching allocator from reusing its block while the copy is in flight.
+  impl.recordDataPtrOnStream(tensor.storage().data_ptr(), spill_stream);
+
+  d2h_event_ = c10::Event(device_.type());
+  d2h_event_->record(spill_stream);
+  offloaded_ = true;
+}
+
+at::Tensor CpuOffloadHooks::call_unpack_hook() {
+  if (!offloaded_) {
+    return data_;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const c10::impl::VirtualGuardImpl impl(device_.type());
+  const auto current_stream = impl.getStream(device_);
+  if (!prefetched_.defined()) {
+    // No prefetch made it in time: restore on the consumer's stream.
+    d2h_event_->block(current_stream);
+    prefetched_ =
+        data_.to(data_.options().device(device_), /*non_blocking=*/true);
+    prefetch_event_ = c10::Event(device_.type());
+    prefetch_event_->record(current_stream);
+    return prefetched_;
+  }
+  // The restore ran on a side stream; order the consumer after it and keep
+  // the restored block alive for the consumer's stream.
+  prefetch_event_->block(current_stream);
+  impl.recordDataPtrOnStream(
+      prefetched_.storage().data_ptr(), current_stream);
+  return prefetched_;
+}
+
+void CpuOffloadHooks::call_prefetch_hook() {
+  if (!offloaded_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (prefetched_.defined()) {
+    return;
+  }
+  const auto fetch_stream = copy_stream(device_, /*for_prefetch=*/true);
+  d2h_event_->block(fetch_stream);
+  {
+    c10::StreamGuard stream_guard(fetch_stream);
+    prefetched_ =
+        data_.to(data_.options().device(device_), /*non_blocking=*/true);
+  }
+  prefetch_event_ = c10::Event(device_.type());
+  prefetch_event_->record(fetch_stream);
+}
+
+}} // namespace torch::autograd
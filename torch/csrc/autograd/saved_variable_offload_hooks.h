@@ -0,0 +1,71 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+
+#include <ATen/ATen.h>
+#include <c10/core/Event.h>
+#include <c10/util/Optional.h>
+
+#include <mutex>
+
+namespace torch { namespace autograd {
+
+// Note [Saved tensor CPU offloading]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Opt-in (TORCH_SAVED_TENSORS_OFFLOAD=1) default saved-variable hooks that
+// spill large saved activations to pinned host memory during forward and
+// restore them for backward, trading PCIe bandwidth for device memory on
+// models whose activations don't fit.
+//
+// - pack: eligible activations (CUDA, strided, at least
+//   TORCH_SAVED_TENSORS_OFFLOAD_MIN_BYTES bytes, default 1MiB) are kept
+//   resident until TORCH_SAVED_TENSORS_OFFLOAD_WATERMARK_BYTES (default 0)
+//   of them are live; beyond the watermark they are copied into pinned host
+//   buffers on a dedicated per-device D2H stream, so the spill overlaps
+//   with forward compute, and the device copy is dropped.
+// - unpack: the activation is copied back on the consumer's stream, unless
+//   a prefetch already restored it.
+// - prefetch: before running a function, the engine walks
+//   TORCH_SAVED_TENSORS_OFFLOAD_PREFETCH_DISTANCE (default 2) levels of its
+//   consumers and asks their spilled activations to start migrating back on
+//   a dedicated H2D stream, hiding the restore latency behind upstream
+//   backward compute (see Engine::evaluate_function and
+//   prefetch_saved_variables() on the generated autograd functions).
+//
+// Like all saved-variable hooks, this trades away in-place-modification
+// version tracking for the packed tensor (same as
+// torch.autograd.graph.save_on_cpu).
+struct TORCH_API CpuOffloadHooks : public SavedVariableHooks {
+  ~CpuOffloadHooks() override;
+
+  void call_pack_hook(const at::Tensor& tensor) override;
+  at::Tensor call_unpack_hook() override;
+  void call_prefetch_hook() override;
+
+  // Whether TORCH_SAVED_TENSORS_OFFLOAD=1 is set. Read once.
+  static bool enabled();
+  // How many levels of consumers the engine prefetches ahead of executing a
+  // function. Zero (always, when offloading is disabled) disables the walk.
+  static int prefetch_distance();
+
+ private:
+  // The pinned host copy when offloaded_ is true, otherwise the tensor
+  // saved as-is.
+  at::Tensor data_;
+  c10::Device device_ = at::kCPU;
+  bool offloaded_ = false;
+  // Resident bytes this hook holds against the watermark (zero if the
+  // tensor was spilled or ineligible).
+  size_t counted_bytes_ = 0;
+  // Completion of the D2H spill; restores are ordered after it.
+  c10::optional<c10::Event> d2h_event_;
+
+  // Guards the restore state below. pack runs before any unpack/prefetch,
+  // but prefetches may race with each other and with unpack.
+  std::mutex mutex_;
+  at::Tensor prefetched_;
+  c10::optional<c10::Event> prefetch_event_;
+};
+
+}} // namespace torch::autograd
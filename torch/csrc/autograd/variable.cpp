@@ -675,6 +675,22 @@ void handle_view_on_rebase(DifferentiableViewMeta* diff_view_meta, bool indirect
   }
 }
 
-
+void seal_inference_tensor(const at::Tensor& tensor) {
+  TORCH_CHECK(tensor.defined(), "Cannot seal an undefined tensor for inference.");
+  if (tensor.is_inference()) {
+    // Sealing is idempotent.
+    return;
+  }
+  TORCH_CHECK(
+      !tensor.requires_grad(),
+      "Cannot seal a tensor that requires grad for inference. Detach it "
+      "first if it has permanently left autograd.");
+  TORCH_CHECK(
+      !tensor.is_view(),
+      "Cannot seal a view for inference as its base relies on the shared "
+      "version counter; seal the base instead, or materialize the view "
+      "with .clone() first.");
+  tensor.unsafeGetTensorImpl()->seal_as_inference_tensor();
+}
 
 }} // namespace torch::autograd
@@ -519,6 +519,25 @@ inline CreationMeta propagate_creation_meta(CreationMeta prev_view_creation_meta
 /// somewhere else.
 TORCH_API void handle_view_on_rebase(DifferentiableViewMeta* diff_view_meta, bool indirect=false);
 
+/// Note [Sealing tensors for inference]
+/// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/// Normal tensors carry the Autograd and ADInplaceOrView dispatch keys and a
+/// version counter even when they are only ever used for inference; under
+/// InferenceMode the autograd keys are masked out of dispatch per call via
+/// TLS, but view and in-place ops on normal tensors still run the
+/// ADInplaceOrView bookkeeping, and the version counter still costs atomic
+/// traffic. Sealing converts such a tensor into an inference tensor once and
+/// for all (e.g. for the weights of a frozen model at load time), so every
+/// subsequent call dispatches straight to the backend kernel with no
+/// tracking layers, with or without an InferenceMode guard.
+///
+/// The caller asserts the tensor has permanently left autograd: it must not
+/// require grad and must not be a view (both are checked), and no live view
+/// of it may rely on its version counter for correctness (not checkable
+/// here). Sealed tensors follow inference tensor semantics from then on; in
+/// particular, in-place updates outside InferenceMode are rejected.
+TORCH_API void seal_inference_tensor(const at::Tensor& tensor);
+
 struct TORCH_API DifferentiableViewMeta : public AutogradMeta {
 private:
   /// Informations about the views
@@ -9,6 +9,10 @@
 #ifdef USE_NCCL
 #include <torch/csrc/cuda/python_nccl.h>
 #endif
+#ifdef USE_CUDNN
+#include <ATen/cudnn/Handle.h>
+#endif
+#include <c10/cuda/CUDAGuard.h>
 #include <c10/util/irange.h>
 
 #include <torch/csrc/cuda/THCP.h>
@@ -500,6 +504,56 @@ static void registerCudaDeviceProperties(PyObject* module) {
     });
 }
 
+static void registerCudaWarmup(PyObject* module) {
+  auto m = py::handle(module).cast<py::module>();
+  // Pre-creates per-device CUDA state concurrently, one thread per device,
+  // so multi-GPU cold start pays the slowest device's init time instead of
+  // the sum: primary context, cuBLAS (and cuDNN) handles, and, when
+  // alloc_bytes > 0, a caching-allocator block of that size which is freed
+  // back into the pool. The worker threads exit before this returns, which
+  // hands their handles back to the per-device handle pools for reuse by
+  // whichever threads serve traffic later.
+  m.def(
+      "_cuda_warmup",
+      [](const std::vector<int64_t>& devices, int64_t alloc_bytes) {
+        py::gil_scoped_release no_gil;
+        std::vector<std::thread> workers;
+        workers.reserve(devices.size());
+        std::mutex eptr_mutex;
+        std::exception_ptr eptr;
+        for (const auto device : devices) {
+          workers.emplace_back([device, alloc_bytes, &eptr_mutex, &eptr]() {
+            try {
+              c10::cuda::CUDAGuard device_guard(
+                  static_cast<c10::DeviceIndex>(device));
+              // Forces creation of the device's primary context.
+              c10::cuda::device_synchronize();
+              at::cuda::getCurrentCUDABlasHandle();
+#ifdef USE_CUDNN
+              at::native::getCudnnHandle();
+#endif
+              if (alloc_bytes > 0) {
+                void* ptr = c10::cuda::CUDACachingAllocator::raw_alloc(
+                    static_cast<size_t>(alloc_bytes));
+                c10::cuda::CUDACachingAllocator::raw_delete(ptr);
+              }
+            } catch (...) {
+              std::lock_guard<std::mutex> guard(eptr_mutex);
+              if (!eptr) {
+                eptr = std::current_exception();
+              }
+            }
+          });
+        }
+        for (auto& worker : workers) {
+          worker.join();
+        }
+        if (eptr) {
+          std::rethrow_exception(eptr);
+        }
+      });
+}
+
 static void bindGetDeviceProperties(PyObject* module) {
   // Add method to torch.cuda
   auto m = py::handle(module).cast<py::module>();
@@ -642,6 +696,7 @@ void initModule(PyObject *module) {
   shared::initCudnnBindings(module);
 #endif
   registerCudaDeviceProperties(module);
+  registerCudaWarmup(module);
 }
 
 }}
@@ -113,6 +113,13 @@ Package InterpreterManager::loadPackage(
   TORCH_DEPLOY_SAFE_CATCH_RETHROW
 }
 
+ReplicatedObj InterpreterManager::createMovable(at::IValue ivalue) {
+  TORCH_DEPLOY_TRY
+  auto I = acquireOne();
+  return I.createMovable(I.fromIValue(std::move(ivalue)));
+  TORCH_DEPLOY_SAFE_CATCH_RETHROW
+}
+
 Obj InterpreterSession::fromMovable(const ReplicatedObj& obj) {
   TORCH_DEPLOY_TRY
   return impl_->unpickleOrGet(obj.pImpl_->objectId_, obj.pImpl_->data_);
@@ -141,6 +141,14 @@ struct TORCH_API InterpreterManager {
   Package loadPackage(
       std::shared_ptr<caffe2::serialize::ReadAdapterInterface> reader);
 
+  // move C++ state (e.g. eager weight tensors built by the embedding server)
+  // into the interpreters: the IValue is pickled once and any tensor storages
+  // are shared across interpreters by StorageImpl rather than copied, so
+  // every interpreter computes against the same weight memory. Note that each
+  // interpreter still builds its own python Tensor object around the shared
+  // storage; live python tensors themselves can never cross interpreters.
+  ReplicatedObj createMovable(at::IValue ivalue);
+
   // convience function for loading some python source code as a module across
   // all interpreters. this can be used for writing tests of deploy that need to
   // execute python code, or for small amounts of application logic that are
@@ -233,6 +233,23 @@ TEST(TorchpyTest, AcquireMultipleSessionsInDifferentPackages) {
   auto I1 = p1.acquireSession();
 }
 
+TEST(TorchpyTest, SharedWeightStorage) {
+  size_t nthreads = 2;
+  torch::deploy::InterpreterManager m(nthreads);
+  // weights constructed by the embedding C++ program, moved into the
+  // interpreters in one step
+  at::Tensor weights = torch::ones({2, 2});
+  auto obj = m.createMovable(weights);
+  for (auto& interp : m.allInstances()) {
+    auto I = obj.acquireSession(&interp);
+    auto t = I.self.toIValue().toTensor();
+    // each interpreter has its own python Tensor object, but they all alias
+    // the original storage rather than owning a copy
+    ASSERT_EQ(t.storage().data(), weights.storage().data());
+    ASSERT_TRUE(t.equal(torch::ones({2, 2})));
+  }
+}
+
 TEST(TorchpyTest, TensorSharingNotAllowed) {
   size_t nthreads = 2;
   torch::deploy::InterpreterManager m(nthreads);
@@ -99,7 +99,15 @@ void DistEngine::globalCpuThread(
                     InputBuffer::variables(std::move(task.inputs_))]() mutable {
       InputBuffer inputs(variables.size());
       for(const auto i : c10::irange(variables.size())) {
-        inputs.add(i, std::move(variables[i]), c10::nullopt, c10::nullopt);
+        // Use the stream recorded for the root's corresponding input (if
+        // any), so the buffered gradient is synced for the stream the root
+        // will consume it on. See Note [Streaming backwards]
+        c10::optional<c10::Stream> opt_consumer_stream;
+        if (i < graphRoot->num_inputs() &&
+            graphRoot->input_metadata(i).device().is_cuda()) {
+          opt_consumer_stream = graphRoot->input_metadata(i).stream();
+        }
+        inputs.add(i, std::move(variables[i]), c10::nullopt, opt_consumer_stream);
       }
       execute_graph_task_until_ready_queue_empty(
           /*node_task*/ NodeTask(graphTask, graphRoot, std::move(inputs)),
@@ -0,0 +1,192 @@
+#include <torch/csrc/distributed/autograd/engine/gradient_coalescer.h>
+
+namespace torch {
+namespace distributed {
+namespace autograd {
+
+namespace {
+constexpr size_t kDefaultMaxBatchBytes = 4 * 1024 * 1024;
+constexpr std::chrono::microseconds kDefaultMaxBatchDelay(1000);
+
+// Two device maps conflict if they disagree on where some source device
+// should land; such entries can't share one message.
+bool deviceMapsConflict(
+    const rpc::DeviceMap& lhs,
+    const rpc::DeviceMap& rhs) {
+  for (const auto& entry : rhs) {
+    auto iter = lhs.find(entry.first);
+    if (iter != lhs.end() && iter->second != entry.second) {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+GradientCoalescer& GradientCoalescer::getInstance() {
+  static GradientCoalescer instance;
+  return instance;
+}
+
+GradientCoalescer::GradientCoalescer()
+    : maxBytes_(kDefaultMaxBatchBytes),
+      maxDelay_(kDefaultMaxBatchDelay),
+      flusher_(&GradientCoalescer::flusherLoop, this) {}
+
+GradientCoalescer::~GradientCoalescer() {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    shutdown_ = true;
+  }
+  cv_.notify_all();
+  flusher_.join();
+}
+
+void GradientCoalescer::setEnabled(bool enabled) {
+  enabled_ = enabled;
+}
+
+bool GradientCoalescer::isEnabled() const {
+  return enabled_;
+}
+
+void GradientCoalescer::setWindow(
+    size_t maxBytes,
+    std::chrono::microseconds maxDelay) {
+  std::lock_guard<std::mutex> guard(lock_);
+  maxBytes_ = maxBytes;
+  maxDelay_ = maxDelay;
+}
+
+void GradientCoalescer::enqueue(
+    rpc::worker_id_t dst,
+    const AutogradMetadata& autogradMetadata,
+    std::vector<torch::autograd::Variable> grads,
+    bool retainGraph,
+    const ContextPtr& autogradContext,
+    const rpc::DeviceMap& deviceMap) {
+  // Record the future before buffering anything so the backward pass can't
+  // be declared finished while this entry sits in the buffer. It completes
+  // with the outcome of the batched RPC.
+  auto future = c10::make_intrusive<rpc::JitFuture>(
+      c10::getCustomClassType<c10::intrusive_ptr<rpc::Message>>());
+  autogradContext->addOutstandingRpc(future);
+
+  size_t bytes = 0;
+  for (const auto& grad : grads) {
+    if (grad.defined() && !grad.is_sparse()) {
+      bytes += grad.numel() * grad.element_size();
+    }
+  }
+
+  std::vector<std::pair<rpc::worker_id_t, PendingBatch>> toSend;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& batch = pending_[dst];
+    if (!batch.entries.empty() &&
+        deviceMapsConflict(batch.deviceMap, deviceMap)) {
+      toSend.emplace_back(dst, std::move(batch));
+      batch = PendingBatch();
+    }
+    if (batch.entries.empty()) {
+      batch.deadline = std::chrono::steady_clock::now() + maxDelay_;
+    }
+    batch.deviceMap.insert(deviceMap.begin(), deviceMap.end());
+    batch.entries.emplace_back(autogradMetadata, std::move(grads), retainGraph);
+    batch.futures.push_back(std::move(future));
+    batch.bytes += bytes;
+    if (batch.bytes >= maxBytes_) {
+      toSend.emplace_back(dst, std::move(batch));
+      pending_.erase(dst);
+    }
+  }
+  // Wake the flusher so it tracks the new batch's deadline.
+  cv_.notify_one();
+
+  for (auto& pair : toSend) {
+    sendBatch(pair.first, std::move(pair.second));
+  }
+}
+
+void GradientCoalescer::flushAll() {
+  std::vector<std::pair<rpc::worker_id_t, PendingBatch>> toSend;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& pair : pending_) {
+      if (!pair.second.entries.empty()) {
+        toSend.emplace_back(pair.first, std::move(pair.second));
+      }
+    }
+    pending_.clear();
+  }
+  for (auto& pair : toSend) {
+    sendBatch(pair.first, std::move(pair.second));
+  }
+}
+
+void GradientCoalescer::flusherLoop() {
+  std::unique_lock<std::mutex> lock(lock_);
+  while (!shutdown_) {
+    if (pending_.empty()) {
+      cv_.wait(lock);
+      continue;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    auto nearest = now + maxDelay_;
+    std::vector<std::pair<rpc::worker_id_t, PendingBatch>> toSend;
+    for (auto iter = pending_.begin(); iter != pending_.end();) {
+      if (iter->second.deadline <= now) {
+        toSend.emplace_back(iter->first, std::move(iter->second));
+        iter = pending_.erase(iter);
+      } else {
+        nearest = std::min(nearest, iter->second.deadline);
+        ++iter;
+      }
+    }
+
+    if (!toSend.empty()) {
+      lock.unlock();
+      for (auto& pair : toSend) {
+        sendBatch(pair.first, std::move(pair.second));
+      }
+      lock.lock();
+      continue;
+    }
+    cv_.wait_until(lock, nearest);
+  }
+}
+
+void GradientCoalescer::sendBatch(rpc::worker_id_t dst, PendingBatch batch) {
+  c10::intrusive_ptr<rpc::JitFuture> rpcFuture;
+  try {
+    auto rpcAgent = rpc::RpcAgent::getCurrentRpcAgent();
+    rpcFuture = rpcAgent->send(
+        rpcAgent->getWorkerInfo(dst),
+        PropagateGradientsBatchReq(std::move(batch.entries)).toMessage(),
+        rpc::kUnsetRpcTimeout,
+        batch.deviceMap);
+  } catch (std::exception&) {
+    for (const auto& future : batch.futures) {
+      future->setError(std::current_exception());
+    }
+    return;
+  }
+
+  rpcFuture->addCallback(
+      [futures = std::move(batch.futures)](rpc::JitFuture& future) {
+        for (const auto& entryFuture : futures) {
+          if (future.hasError()) {
+            entryFuture->setError(future.exception_ptr());
+          } else {
+            // The batch response carries no tensors, so it is safe to
+            // complete the entry futures with it directly.
+            entryFuture->markCompleted(future.value());
+          }
+        }
+      });
+}
+
+} // namespace autograd
+} // namespace distributed
+} // namespace torch
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <torch/csrc/distributed/autograd/context/context.h>
+#include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_batch_req.h>
+#include <torch/csrc/distributed/rpc/rpc_agent.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace distributed {
+namespace autograd {
+
+// Note [Gradient message coalescing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// During a distributed backward pass, every backward edge that crosses a
+// worker boundary sends its own PropagateGradientsReq. Pipeline-parallel
+// workloads routinely produce thousands of small gradient RPCs per step
+// between the same pair of workers, paying per-message serialization and
+// transport syscall overhead for each one.
+//
+// When enabled, the GradientCoalescer intercepts these sends: gradients
+// destined for the same worker are buffered and folded into a single
+// PropagateGradientsBatchReq, which is flushed as soon as either the
+// buffered bytes exceed the byte window or the oldest buffered entry
+// exceeds the time window. Correctness relies on two things:
+// * Each buffered entry immediately records a future in its autograd
+//   context via addOutstandingRpc, so the backward pass can't be declared
+//   finished while gradients are still sitting in the buffer. The future
+//   completes (or errors) with the batched RPC.
+// * The receiver processes every entry of a batch exactly like a standalone
+//   PropagateGradientsReq, so batching only changes message framing, not
+//   engine semantics.
+//
+// Coalescing is opt-in (see _set_gradient_batching in the Python module)
+// because it trades up to one time window of latency per hop for fewer,
+// larger messages.
+class TORCH_API GradientCoalescer {
+ public:
+  static GradientCoalescer& getInstance();
+
+  // Buffers one gradient propagation destined for worker 'dst' and records
+  // a future for the eventual batched RPC in 'autogradContext'.
+  void enqueue(
+      rpc::worker_id_t dst,
+      const AutogradMetadata& autogradMetadata,
+      std::vector<torch::autograd::Variable> grads,
+      bool retainGraph,
+      const ContextPtr& autogradContext,
+      const rpc::DeviceMap& deviceMap);
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const;
+
+  // Flushing happens when either window is exceeded.
+  void setWindow(size_t maxBytes, std::chrono::microseconds maxDelay);
+
+  // Immediately sends everything currently buffered.
+  void flushAll();
+
+  GradientCoalescer(const GradientCoalescer&) = delete;
+  GradientCoalescer& operator=(const GradientCoalescer&) = delete;
+  GradientCoalescer(GradientCoalescer&&) = delete;
+  GradientCoalescer& operator=(GradientCoalescer&&) = delete;
+
+ private:
+  GradientCoalescer();
+  ~GradientCoalescer();
+
+  // Gradients buffered for one destination worker.
+  struct PendingBatch {
+    std::vector<GradientBatchEntry> entries;
+    std::vector<c10::intrusive_ptr<rpc::JitFuture>> futures;
+    rpc::DeviceMap deviceMap;
+    size_t bytes = 0;
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  // Background thread that flushes batches whose time window expired.
+  void flusherLoop();
+
+  // Serializes and sends one batch; completes its entry futures with the
+  // outcome of the batched RPC. Must be called without lock_ held.
+  static void sendBatch(rpc::worker_id_t dst, PendingBatch batch);
+
+  mutable std::mutex lock_;
+  std::condition_variable cv_;
+  std::unordered_map<rpc::worker_id_t, PendingBatch> pending_;
+  std::atomic<bool> enabled_{false};
+  size_t maxBytes_;
+  std::chrono::microseconds maxDelay_;
+  bool shutdown_{false};
+  std::thread flusher_;
+};
+
+} // namespace autograd
+} // namespace distributed
+} // namespace torch
@@ -1,6 +1,7 @@
 #include <torch/csrc/distributed/autograd/functions/recvrpc_backward.h>
 #include <ATen/core/functional.h>
 #include <c10/util/irange.h>
+#include <torch/csrc/distributed/autograd/engine/gradient_coalescer.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_req.h>
 #include <torch/csrc/distributed/rpc/rpc_agent.h>
 
@@ -42,6 +43,22 @@ variable_list RecvRpcBackward::apply(variable_list&& grads) {
           "means the autograd context was cleaned up by a different thread due ",
           "to an error before RecvRcpBackward had a chance to run"));
 
+  // When gradient message coalescing is enabled, hand the gradients to the
+  // coalescer, which folds them into one batched message per destination
+  // within its time/byte window and records the batched RPC's future in the
+  // context itself. See Note [Gradient message coalescing].
+  auto& coalescer = GradientCoalescer::getInstance();
+  if (coalescer.isEnabled()) {
+    coalescer.enqueue(
+        fromWorkerId_,
+        autogradMetadata_,
+        std::move(outputGrads),
+        sharedContext->retrieveGraphTask()->keep_graph_,
+        sharedContext,
+        deviceMap_);
+    return variable_list();
+  }
+
   // Send the gradients over the wire and record the future in the autograd
   // context.
   PropagateGradientsReq gradCall(
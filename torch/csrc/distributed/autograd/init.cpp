@@ -1,5 +1,6 @@
 #include <torch/csrc/autograd/python_cpp_function.h>
 #include <torch/csrc/distributed/autograd/autograd.h>
+#include <torch/csrc/distributed/autograd/engine/gradient_coalescer.h>
 #include <torch/csrc/jit/python/pybind_utils.h>
 #include <torch/csrc/python_headers.h>
 #include <torch/csrc/utils/object_ptr.h>
@@ -132,6 +133,23 @@ PyObject* dist_autograd_init(PyObject* _unused, PyObject* noargs) {
       []() { return DistEngine::getInstance().getDebugInfo(); },
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_set_gradient_batching",
+      [](bool enabled, int64_t max_bytes, int64_t window_micros) {
+        auto& coalescer = GradientCoalescer::getInstance();
+        coalescer.setWindow(
+            max_bytes, std::chrono::microseconds(window_micros));
+        coalescer.setEnabled(enabled);
+        if (!enabled) {
+          // Don't strand gradients buffered before the switch.
+          coalescer.flushAll();
+        }
+      },
+      py::arg("enabled"),
+      py::arg("max_bytes") = 4 * 1024 * 1024,
+      py::arg("window_micros") = 1000,
+      py::call_guard<py::gil_scoped_release>());
+
   py::options options;
   options.disable_function_signatures();
 
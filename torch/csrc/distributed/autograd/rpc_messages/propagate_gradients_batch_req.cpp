@@ -0,0 +1,151 @@
+#include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_batch_req.h>
+#include <torch/csrc/distributed/rpc/rpc_agent.h>
+#include <torch/csrc/jit/serialization/pickle.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/irange.h>
+
+namespace torch {
+namespace distributed {
+namespace autograd {
+
+using rpc::Message;
+using rpc::MessageType;
+using torch::autograd::Variable;
+
+PropagateGradientsBatchReq::PropagateGradientsBatchReq(
+    std::vector<GradientBatchEntry> entries)
+    : entries_(std::move(entries)) {}
+
+const std::vector<GradientBatchEntry>& PropagateGradientsBatchReq::getEntries()
+    const {
+  return entries_;
+}
+
+c10::intrusive_ptr<Message> PropagateGradientsBatchReq::toMessageImpl() && {
+  // Pack dense gradients into one flat buffer per (dtype, device) pair.
+  // Sparse gradients can't be flattened and ride along as-is.
+  struct Group {
+    at::ScalarType dtype;
+    at::Device device;
+    std::vector<torch::Tensor> flats;
+    int64_t numel = 0;
+  };
+  std::vector<Group> groups;
+
+  std::vector<at::IValue> entryTuples;
+  entryTuples.reserve(entries_.size());
+  for (const auto& entry : entries_) {
+    std::vector<at::IValue> gradTuples;
+    gradTuples.reserve(entry.grads.size());
+    for (const auto& grad : entry.grads) {
+      if (grad.is_sparse()) {
+        gradTuples.emplace_back(c10::ivalue::Tuple::create(
+            static_cast<int64_t>(-1), grad, std::vector<int64_t>()));
+        continue;
+      }
+      size_t groupIdx = 0;
+      for (; groupIdx < groups.size(); ++groupIdx) {
+        if (groups[groupIdx].dtype == grad.scalar_type() &&
+            groups[groupIdx].device == grad.device()) {
+          break;
+        }
+      }
+      if (groupIdx == groups.size()) {
+        groups.push_back(Group{grad.scalar_type(), grad.device(), {}, 0});
+      }
+      auto& group = groups[groupIdx];
+      gradTuples.emplace_back(c10::ivalue::Tuple::create(
+          static_cast<int64_t>(groupIdx), group.numel, grad.sizes().vec()));
+      group.flats.push_back(grad.reshape(-1));
+      group.numel += grad.numel();
+    }
+    entryTuples.emplace_back(c10::ivalue::Tuple::create(
+        entry.autogradMetadata.autogradContextId,
+        entry.autogradMetadata.autogradMessageId,
+        entry.retainGraph,
+        c10::ivalue::Tuple::create(std::move(gradTuples))));
+  }
+
+  std::vector<at::IValue> ivalues;
+  ivalues.reserve(groups.size() + 2);
+  for (auto& group : groups) {
+    ivalues.emplace_back(at::cat(group.flats));
+  }
+  ivalues.emplace_back(c10::ivalue::Tuple::create(std::move(entryTuples)));
+  ivalues.emplace_back(static_cast<int64_t>(groups.size()));
+
+  // Now pickle using JIT pickler.
+  std::vector<torch::Tensor> tensorTable;
+  std::vector<char> payload =
+      jit::pickle(c10::ivalue::Tuple::create(std::move(ivalues)), &tensorTable);
+
+  return c10::make_intrusive<Message>(
+      std::move(payload),
+      std::move(tensorTable),
+      MessageType::BACKWARD_AUTOGRAD_BATCH_REQ);
+}
+
+std::unique_ptr<PropagateGradientsBatchReq> PropagateGradientsBatchReq::
+    fromMessage(const Message& message) {
+  // Unpickle the message and retrieve tupleElements.
+  auto payload = static_cast<const char*>(message.payload().data());
+  auto payload_size = message.payload().size();
+  IValue tuple = jit::unpickle(
+      payload,
+      payload_size,
+      *rpc::RpcAgent::getCurrentRpcAgent()->getTypeResolver(),
+      message.tensors());
+  const auto& tupleElements = tuple.toTuple()->elements();
+  TORCH_INTERNAL_ASSERT(tupleElements.size() >= 2);
+
+  // Retrieve the packed gradient buffers.
+  size_t numGroups = tupleElements.back().toInt();
+  std::vector<torch::Tensor> buffers;
+  buffers.reserve(numGroups);
+  for (const auto i : c10::irange(numGroups)) {
+    buffers.emplace_back(tupleElements[i].toTensor());
+  }
+
+  const auto& entryTuples =
+      tupleElements[tupleElements.size() - 2].toTuple()->elements();
+  std::vector<GradientBatchEntry> entries;
+  entries.reserve(entryTuples.size());
+  for (const auto& entryIValue : entryTuples) {
+    const auto& entryElements = entryIValue.toTuple()->elements();
+    TORCH_INTERNAL_ASSERT(entryElements.size() == 4);
+    AutogradMetadata autogradMetadata(
+        entryElements[0].toInt(), entryElements[1].toInt());
+    bool retainGraph = entryElements[2].toBool();
+
+    // Rebuild each gradient as a view into its packed buffer. The slices of
+    // a buffer are disjoint, so downstream in-place accumulation into one
+    // gradient can't corrupt another.
+    const auto& gradTuples = entryElements[3].toTuple()->elements();
+    std::vector<Variable> grads;
+    grads.reserve(gradTuples.size());
+    for (const auto& gradIValue : gradTuples) {
+      const auto& gradElements = gradIValue.toTuple()->elements();
+      int64_t groupIdx = gradElements[0].toInt();
+      if (groupIdx < 0) {
+        // Sparse gradient, serialized directly.
+        grads.emplace_back(gradElements[1].toTensor());
+        continue;
+      }
+      auto sizes = gradElements[2].toIntVector();
+      int64_t numel = 1;
+      for (const auto size : sizes) {
+        numel *= size;
+      }
+      grads.emplace_back(
+          buffers[groupIdx].narrow(0, gradElements[1].toInt(), numel).view(sizes));
+    }
+    entries.emplace_back(autogradMetadata, std::move(grads), retainGraph);
+  }
+
+  return std::make_unique<PropagateGradientsBatchReq>(std::move(entries));
+}
+
+} // namespace autograd
+} // namespace distributed
+} // namespace torch
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <torch/csrc/distributed/autograd/rpc_messages/autograd_metadata.h>
+#include <torch/csrc/distributed/rpc/message.h>
+#include <torch/csrc/distributed/rpc/rpc_command_base.h>
+#include <vector>
+
+namespace torch {
+namespace distributed {
+namespace autograd {
+
+// One gradient propagation folded into a batched message. Each entry carries
+// exactly what a standalone PropagateGradientsReq would have carried.
+struct TORCH_API GradientBatchEntry {
+  GradientBatchEntry(
+      const AutogradMetadata& autogradMetadata,
+      std::vector<torch::autograd::Variable> grads,
+      bool retainGraph)
+      : autogradMetadata(autogradMetadata),
+        grads(std::move(grads)),
+        retainGraph(retainGraph) {}
+
+  AutogradMetadata autogradMetadata;
+  std::vector<torch::autograd::Variable> grads;
+  bool retainGraph;
+};
+
+// Used to propagate several coalesced gradient propagations from one node to
+// another in a single RPC during the distributed backward pass. See
+// Note [Gradient message coalescing] in
+// torch/csrc/distributed/autograd/engine/gradient_coalescer.h. On the wire
+// the gradients are packed into one flat buffer per (dtype, device) pair, so
+// the transport serializes a handful of large tensors instead of one
+// descriptor per gradient; the receiver rebuilds each gradient as a view
+// into its buffer.
+class TORCH_API PropagateGradientsBatchReq : public rpc::RpcCommandBase {
+ public:
+  explicit PropagateGradientsBatchReq(std::vector<GradientBatchEntry> entries);
+
+  const std::vector<GradientBatchEntry>& getEntries() const;
+
+  // Serialization and deserialization methods.
+  c10::intrusive_ptr<rpc::Message> toMessageImpl() && override;
+  static std::unique_ptr<PropagateGradientsBatchReq> fromMessage(
+      const rpc::Message& message);
+
+ private:
+  std::vector<GradientBatchEntry> entries_;
+};
+
+} // namespace autograd
+} // namespace distributed
+} // namespace torch
@@ -2,6 +2,7 @@
 #include <c10d/ProcessGroup.hpp>
 
 #include <c10/util/Logging.h>
+#include <c10/util/RequestTracer.h>
 
 namespace c10d {
 
@@ -83,6 +84,17 @@ ProcessGroup::Work::Work(
       recordFunctionEndCallback_ = at::wrapPropagateTLSState(end_handler);
     }
   }
+  if (C10_UNLIKELY(c10::RequestTracer::enabled())) {
+    traceCorrelationId_ = c10::RequestTracer::currentId();
+    if (traceCorrelationId_ != 0) {
+      c10::RequestTracer::recordForId(
+          traceCorrelationId_,
+          c10::RequestTraceEventKind::COLLECTIVE_ENQUEUE,
+          reinterpret_cast<uint64_t>(this),
+          static_cast<int64_t>(opType_),
+          c10::Device(c10::DeviceType::CPU));
+    }
+  }
 }
 
 OpType ProcessGroup::Work::retrieveOpType() {
@@ -156,6 +168,15 @@ void ProcessGroup::Work::finish(std::exception_ptr exception) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
   }
+  if (C10_UNLIKELY(traceCorrelationId_ != 0)) {
+    c10::RequestTracer::recordForId(
+        traceCorrelationId_,
+        c10::RequestTraceEventKind::COLLECTIVE_COMPLETE,
+        reinterpret_cast<uint64_t>(this),
+        static_cast<int64_t>(opType_),
+        c10::Device(c10::DeviceType::CPU));
+    traceCorrelationId_ = 0;
+  }
   lock.unlock();
   cv_.notify_all();
 }
@@ -168,6 +189,15 @@ void ProcessGroup::Work::finishAndThrow(std::exception_ptr exception) {
     recordFunctionEndCallback_();
     recordFunctionEndCallback_ = nullptr;
   }
+  if (C10_UNLIKELY(traceCorrelationId_ != 0)) {
+    c10::RequestTracer::recordForId(
+        traceCorrelationId_,
+        c10::RequestTraceEventKind::COLLECTIVE_COMPLETE,
+        reinterpret_cast<uint64_t>(this),
+        static_cast<int64_t>(opType_),
+        c10::Device(c10::DeviceType::CPU));
+    traceCorrelationId_ = 0;
+  }
   if (exception_) {
     std::rethrow_exception(exception_);
   }
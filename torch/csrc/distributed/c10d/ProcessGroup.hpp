@@ -171,6 +171,12 @@ class TORCH_API ProcessGroup : public torch::CustomClassHolder {
     // When profiling, the callback to record end of operation event. This
     // callback needs to be called when collective operation is complete.
     std::function<void()> recordFunctionEndCallback_;
+
+    // Request-trace correlation id captured at construction; completion
+    // is often signalled from a watchdog thread that does not carry the
+    // thread local token. See Note [Request trace] in
+    // c10/util/RequestTracer.cpp.
+    uint64_t traceCorrelationId_ = 0;
   };
 
   // ProcessGroup Options is a base struct that defines the basic options
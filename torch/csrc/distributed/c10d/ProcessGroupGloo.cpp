@@ -970,22 +970,32 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupGloo::broadcast(
 
 namespace {
 
+// Payloads up to this size are latency-bound rather than bandwidth-bound,
+// so they use the bcube algorithm, which finishes in log2(n) rounds. Larger
+// payloads use ring, which moves the minimal volume per rank and is
+// pipelined by gloo in segments so that reduction computation overlaps wire
+// transfer.
+constexpr size_t kAllreduceBcubeMaxBytes = 64 * 1024;
+
 class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
  public:
   AsyncAllreduceWork(
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
+      size_t maxSegmentSize,
       uint32_t tag)
       : ProcessGroupGloo::AsyncWork({inputs}, "gloo:all_reduce", inputs),
         context(context),
         inputs(inputs),
         reduceOp(reduceOp),
+        maxSegmentSize(maxSegmentSize),
         tag(tag) {}
 
   std::shared_ptr<gloo::Context> context;
   std::vector<at::Tensor> inputs;
   const ReduceOp reduceOp;
+  const size_t maxSegmentSize;
   const uint32_t tag;
 
   void allreduce(std::vector<at::Tensor>& tensors) {
@@ -993,6 +1003,22 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
     gloo::AllreduceOptions opts(context);
     opts.setReduceFunction(getFunction(scalarType, reduceOp));
     opts.setTag(tag);
+
+    // See kAllreduceBcubeMaxBytes. Bcube requires a power-of-two number of
+    // participants; everything else stays on ring.
+    const size_t totalBytes =
+        tensors[0].numel() * tensors[0].element_size() * tensors.size();
+    const auto contextSize = static_cast<size_t>(context->size);
+    if (totalBytes <= kAllreduceBcubeMaxBytes && contextSize > 1 &&
+        (contextSize & (contextSize - 1)) == 0) {
+      opts.setAlgorithm(gloo::AllreduceOptions::Algorithm::BCUBE);
+    } else {
+      opts.setAlgorithm(gloo::AllreduceOptions::Algorithm::RING);
+      if (maxSegmentSize > 0) {
+        opts.setMaxSegmentSize(maxSegmentSize);
+      }
+    }
+
     GENERATE_ALL_TYPES(scalarType, setOutputs, opts, tensors);
     gloo::allreduce(opts);
   }
@@ -1021,8 +1047,9 @@ class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
+      size_t maxSegmentSize,
       uint32_t tag)
-      : AsyncAllreduceWork(context, inputs, reduceOp, tag) {}
+      : AsyncAllreduceWork(context, inputs, reduceOp, maxSegmentSize, tag) {}
 
   void run() override {
     allreduceCoalesced(inputs);
@@ -1321,8 +1348,9 @@ class AsyncAllreduceCUDAWork : public AsyncAllreduceWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
+      size_t maxSegmentSize,
       uint32_t tag)
-      : AsyncAllreduceWork(context, inputs, reduceOp, tag) {
+      : AsyncAllreduceWork(context, inputs, reduceOp, maxSegmentSize, tag) {
     initializeStreamsEvents(inputs, streams, events);
 
     // Kick off copy from CUDA tensors to pinned CPU tensors.
@@ -1454,7 +1482,11 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
   if (device.type() == at::kCPU) {
     if (layout == c10::kStrided) {
       work = c10::make_intrusive<AsyncAllreduceWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+          std::move(context),
+          inputs,
+          opts.reduceOp,
+          options_->allreduceMaxSegmentSize,
+          tag);
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceWork>(
           std::move(context), inputs, tag);
@@ -1464,7 +1496,11 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
   } else if (device.type() == at::kCUDA) {
     if (layout == c10::kStrided) {
       work = c10::make_intrusive<AsyncAllreduceCUDAWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+          std::move(context),
+          inputs,
+          opts.reduceOp,
+          options_->allreduceMaxSegmentSize,
+          tag);
     } else if (layout == c10::kSparse) {
       work = c10::make_intrusive<AsyncSparseAllreduceCUDAWork>(
           std::move(context), inputs, tag);
@@ -1528,7 +1564,11 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce_coalesced(
   if (device.type() == c10::kCPU) {
     if (layout == c10::kStrided) {
       work = c10::make_intrusive<AsyncAllreduceCoalescedWork>(
-          std::move(context), tensors, opts.reduceOp, tag);
+          std::move(context),
+          tensors,
+          opts.reduceOp,
+          options_->allreduceMaxSegmentSize,
+          tag);
     } else {
       invalidArgument("unsupported layout");
     }
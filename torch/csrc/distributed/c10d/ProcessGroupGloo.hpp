@@ -190,6 +190,12 @@ class TORCH_API ProcessGroupGloo : public ProcessGroup {
 
     std::vector<std::shared_ptr<::gloo::transport::Device>> devices;
     int threads;
+
+    // Upper bound, in bytes, on the segments that the ring allreduce is
+    // split into. Gloo pipelines these segments, so the reduction of one
+    // segment overlaps the wire transfer of the next; smaller segments give
+    // more overlap at the cost of more rounds. 0 keeps Gloo's default.
+    size_t allreduceMaxSegmentSize{0};
   };
 
   const std::string getBackendName() const override {
@@ -1,5 +1,6 @@
 #include <c10d/ProcessGroupNCCL.hpp>
 #include <sstream>
+#include <unistd.h>
 
 #ifdef USE_C10D_NCCL
 
@@ -658,6 +659,12 @@ ProcessGroupNCCL::~ProcessGroupNCCL() {
 void ProcessGroupNCCL::abortTimedOutCollectives(
     std::unordered_set<std::string>& abortedCommIds) {
   std::unique_lock<std::mutex> lock(workMetaListMutex_);
+  // Pick up works that have not been drained by the cleanup thread yet, so
+  // timeout detection does not depend on its poll quantum.
+  {
+    std::lock_guard<std::mutex> enqueueLock(workEnqueueMutex_);
+    workMetaList_.splice(workMetaList_.end(), workEnqueueList_);
+  }
   for (auto& work : workMetaList_) {
     work.checkAndSetException();
     // Aborting NCCL Communicators due to errors is already handled above.
@@ -840,6 +847,32 @@ void ProcessGroupNCCL::ncclCommWatchdogInternal() {
   }
 }
 
+// Note [Batched completion polling]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With async error handling enabled, every collective enqueues a WorkNCCL
+// for the cleanup thread to track. Workloads that launch thousands of small
+// collectives (e.g. MoE all-to-alls) used to pay for that twice: every
+// launch took workMetaListMutex_, which the cleanup thread holds across its
+// entire scan, and every scan issued a CUDA event query per outstanding
+// work.
+//
+// Launches now append to a staging list guarded by its own mutex that is
+// only ever held for O(1) splices, so they never wait behind event queries;
+// the background threads drain the staging list into workMetaList_.
+//
+// The scan itself exploits that all works on one device key run on the same
+// set of NCCL streams and therefore finish in FIFO order: once the oldest
+// still-running work on a key is found, the event queries for every work
+// behind it are skipped. This bounds the number of event queries per poll
+// quantum by the number of device keys rather than the number of
+// outstanding works. Skipping cannot stall cleanup: the oldest work on a
+// key either completes, or eventually has an exception set on it (by
+// checkAndSetException here or by the watchdog on timeout), both of which
+// make isCompleted() true and unblock the works behind it.
+//
+// Latency-critical paths that do not want any background polling can set
+// NCCL_ASYNC_ERROR_HANDLING=0, in which case works are never enqueued here
+// and completion is driven entirely by user wait() calls.
 void ProcessGroupNCCL::workCleanupLoop() {
   bool done = false;
   while (!terminateProcessGroup_.load() || !done) {
@@ -853,10 +886,20 @@ void ProcessGroupNCCL::workCleanupLoop() {
           std::chrono::milliseconds(kWorkCleanupThreadSleepMillis),
           [&]() -> bool { return terminateProcessGroup_.load(); });
 
+      // Drain works enqueued since the last quantum.
+      {
+        std::lock_guard<std::mutex> enqueueLock(workEnqueueMutex_);
+        workMetaList_.splice(workMetaList_.end(), workEnqueueList_);
+      }
+
+      // Device keys whose oldest work is still running; works behind them
+      // cannot have completed, so their event queries are skipped.
+      std::unordered_set<std::string> blockedDeviceKeys;
       for (auto it = workMetaList_.begin(); it != workMetaList_.end();
            /* no increment*/) {
         auto& work = *it;
-        if (work.isCompleted()) {
+        const auto devicesKey = getKeyFromDevices(work.devices_);
+        if (blockedDeviceKeys.count(devicesKey) == 0 && work.isCompleted()) {
           // Handle Exceptions on failed GPU operations and remove completed
           // workNCCL objects from work vector.
           if (!terminateProcessGroup_.load()) {
@@ -867,6 +910,7 @@ void ProcessGroupNCCL::workCleanupLoop() {
         } else {
           // Increment the iterator if the current WorkNCCL object is not
           // completed.
+          blockedDeviceKeys.insert(devicesKey);
           ++it;
         }
       }
@@ -1006,15 +1050,33 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
   // Create the unique NCCL ID and broadcast it
   ncclUniqueId ncclID;
 
-  // For point-to-point communication, lower rank of the two will get unique id.
-  if (rank_ == 0 || (isP2POp(opType) && p2pRank == 0)) {
-    C10D_NCCL_CHECK(ncclGetUniqueId(&ncclID), c10::nullopt);
+  // initComms() may have exchanged the ID for this device group already;
+  // consume it instead of going through the store again. See
+  // Note [Eager NCCL initialization].
+  bool hasEagerID = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = eagerNcclIDs_.find(devicesKey);
+    if (it != eagerNcclIDs_.end()) {
+      ncclID = it->second;
+      eagerNcclIDs_.erase(it);
+      hasEagerID = true;
+    }
   }
 
-  // For point-to-point communication on the same process, don't need broadcast.
-  if (!isSendRecvSelf) {
-    // Broadcast so that each process can have a unique NCCL ID
-    broadcastUniqueNCCLID(&ncclID, opType, devicesKey, p2pRank);
+  if (!hasEagerID) {
+    // For point-to-point communication, lower rank of the two will get unique
+    // id.
+    if (rank_ == 0 || (isP2POp(opType) && p2pRank == 0)) {
+      C10D_NCCL_CHECK(ncclGetUniqueId(&ncclID), c10::nullopt);
+    }
+
+    // For point-to-point communication on the same process, don't need
+    // broadcast.
+    if (!isSendRecvSelf) {
+      // Broadcast so that each process can have a unique NCCL ID
+      broadcastUniqueNCCLID(&ncclID, opType, devicesKey, p2pRank);
+    }
   }
 
   at::cuda::OptionalCUDAGuard gpuGuard;
@@ -1105,6 +1167,253 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
   return devNCCLCommMap_[devicesKey];
 }
 
+// Note [Eager NCCL initialization]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// getNCCLComm creates communicators lazily on the first collective per
+// device set, so at large scale the first training step absorbs the full
+// cost of establishing every NCCL ring. initComms moves that cost into
+// setup: it exchanges the unique IDs for all requested device groups as
+// one batch (rank 0 publishes every ID to the store before any
+// communicator is initialized, and the other ranks observe the whole
+// batch with a single wait()), then creates the communicators, and
+// optionally runs a one-element allreduce per group so NCCL sets up its
+// rings and channels up front as well. Communicator creation itself stays
+// sequential: ncclCommInitRank is a rendezvous over all ranks of the
+// group, and with the IDs pre-published no rank stalls on store traffic
+// between rendezvous. Like a collective, this must be called by every
+// rank with the same deviceGroups so that the sequence-numbered store
+// keys consumed below line up across ranks.
+void ProcessGroupNCCL::initComms(
+    const std::vector<std::vector<at::Device>>& deviceGroups,
+    bool warmup) {
+  // Collect the groups that have neither a cached communicator nor a
+  // pre-exchanged ID yet, preserving order and dropping duplicates.
+  std::vector<std::pair<std::string, std::vector<at::Device>>> pending;
+  {
+    std::unordered_set<std::string> seen;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& devices : deviceGroups) {
+      TORCH_CHECK(!devices.empty(), "initComms: empty device group");
+      auto key = getKeyFromDevices(devices);
+      if (devNCCLCommMap_.find(key) != devNCCLCommMap_.end() ||
+          eagerNcclIDs_.find(key) != eagerNcclIDs_.end() ||
+          !seen.insert(key).second) {
+        continue;
+      }
+      pending.emplace_back(std::move(key), devices);
+    }
+  }
+
+  if (!pending.empty()) {
+    // Exchange the unique IDs for the whole batch before creating any
+    // communicator. This mirrors broadcastUniqueNCCLID, except that rank 0
+    // sets every key up front and the other ranks issue a single wait()
+    // for the batch, instead of interleaving one store round trip per
+    // group with communicator initialization.
+    std::vector<std::string> storeKeys;
+    storeKeys.reserve(pending.size());
+    std::vector<ncclUniqueId> ncclIDs(pending.size());
+    for (const auto i : c10::irange(pending.size())) {
+      storeKeys.push_back(std::to_string(ncclCommCounter_++));
+      if (rank_ == 0) {
+        C10D_NCCL_CHECK(ncclGetUniqueId(&ncclIDs[i]), c10::nullopt);
+        auto vec = std::vector<uint8_t>(
+            reinterpret_cast<uint8_t*>(&ncclIDs[i]),
+            reinterpret_cast<uint8_t*>(&ncclIDs[i]) + NCCL_UNIQUE_ID_BYTES);
+        store_->set(storeKeys[i], vec);
+      }
+    }
+    if (rank_ != 0) {
+      store_->wait(storeKeys);
+      for (const auto i : c10::irange(pending.size())) {
+        auto vec = store_->get(storeKeys[i]);
+        TORCH_CHECK(vec.size() == NCCL_UNIQUE_ID_BYTES);
+        std::memcpy(&ncclIDs[i], vec.data(), vec.size());
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto i : c10::irange(pending.size())) {
+        eagerNcclIDs_.emplace(pending[i].first, ncclIDs[i]);
+      }
+    }
+
+    // Create the communicators; getNCCLComm consumes the pre-exchanged
+    // IDs, so every rank reaches each ncclCommInitRank rendezvous without
+    // further store traffic. OpType only needs to avoid the send/recv
+    // path, as in runHealthCheck.
+    for (auto& entry : pending) {
+      getNCCLComm(entry.first, entry.second, OpType::ALLREDUCE);
+    }
+  }
+
+  if (warmup) {
+    // Run a one-element allreduce over every requested group so NCCL
+    // establishes its rings and channels now rather than in step one.
+    at::cuda::OptionalCUDAGuard gpuGuard;
+    for (const auto& devices : deviceGroups) {
+      std::vector<at::Tensor> warmupTensors;
+      warmupTensors.reserve(devices.size());
+      for (auto& device : devices) {
+        gpuGuard.set_index(device.index());
+        warmupTensors.push_back(at::empty(
+            {1},
+            at::TensorOptions().device(at::DeviceType::CUDA).dtype(at::kByte)));
+      }
+      allreduce(warmupTensors)->wait();
+    }
+  }
+}
+
+// Note [Hierarchical allreduce]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When Options::hierarchical_allreduce is set, allreduce is decomposed
+// into three phases instead of one flat ring across all ranks:
+//
+//   1. reduce-scatter over the ranks of this node, so each local rank
+//      holds the node-local reduction of one 1/localSize_ shard,
+//   2. allreduce of each shard over the ranks that hold the same local
+//      rank on every node, and
+//   3. allgather of the fully reduced shards back over the node.
+//
+// Phases 1 and 3 only traverse the intra-node interconnect (NVLink);
+// phase 2 is the only cross-node traffic and moves 1/localSize_ of the
+// tensor per rank, with the localSize_ shard-allreduces proceeding in
+// parallel over all available NICs. Node membership is discovered by
+// exchanging hostnames through the store the first time the feature is
+// exercised, and the flat algorithm is used whenever the topology has no
+// hierarchy to exploit (single node, single rank per node, or unevenly
+// populated nodes) or the tensor cannot be sharded evenly.
+bool ProcessGroupNCCL::ensureHierarchicalTopology() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (hierarchyChecked_) {
+    return hierarchyUsable_;
+  }
+  hierarchyChecked_ = true;
+
+  // Publish this rank's hostname and collect everyone else's. Store reads
+  // block until the corresponding rank has published, so this acts as a
+  // one-time barrier across the group.
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  char hostname[256];
+  TORCH_CHECK(
+      gethostname(hostname, sizeof(hostname)) == 0,
+      "gethostname failed while detecting node topology");
+  hostname[sizeof(hostname) - 1] = '\0';
+  const std::string selfHost(hostname);
+  store_->set(
+      "hierarchical_host_" + std::to_string(rank_),
+      std::vector<uint8_t>(selfHost.begin(), selfHost.end()));
+
+  // Assign node ids in order of first appearance and place each rank
+  // within its node by global rank order.
+  std::unordered_map<std::string, int> nodeIdOf;
+  std::unordered_map<std::string, int> ranksPerNode;
+  for (const auto r : c10::irange(size_)) {
+    auto vec = store_->get("hierarchical_host_" + std::to_string(r));
+    const std::string host(vec.begin(), vec.end());
+    auto inserted = nodeIdOf.emplace(host, static_cast<int>(nodeIdOf.size()));
+    if (r == rank_) {
+      nodeId_ = inserted.first->second;
+      localRank_ = ranksPerNode[host];
+    }
+    ranksPerNode[host]++;
+  }
+  numNodes_ = static_cast<int>(nodeIdOf.size());
+  localSize_ = ranksPerNode[selfHost];
+
+  // A hierarchy only helps with multiple ranks per node on multiple
+  // nodes, and the cross-node subgroups require every node to contribute
+  // a rank at each local index.
+  hierarchyUsable_ = numNodes_ > 1 && localSize_ > 1;
+  for (const auto& it : ranksPerNode) {
+    hierarchyUsable_ = hierarchyUsable_ && it.second == localSize_;
+  }
+  if (!hierarchyUsable_) {
+    LOG(INFO) << "[Rank " << rank_
+              << "] hierarchical allreduce was requested but the job is not "
+              << "a multi-node job with evenly populated nodes; using flat "
+              << "allreduce.";
+  }
+  return hierarchyUsable_;
+}
+
+std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getSubgroupNCCLComm(
+    const std::string& cacheKey,
+    const std::vector<at::Device>& devices,
+    int numRanks,
+    int subgroupRank,
+    const std::string& idStoreKey) {
+  TORCH_INTERNAL_ASSERT(
+      devices.size() == 1,
+      "Subgroup communicators expect a single GPU per process.");
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = devNCCLCommMap_.find(cacheKey);
+    if (it != devNCCLCommMap_.end()) {
+      // Reuse the cached communicator if there is one.
+      return it->second;
+    }
+  }
+
+  std::vector<std::shared_ptr<NCCLComm>> ncclComms;
+  ncclComms.resize(devices.size());
+
+  // The subgroup's rank 0 creates the unique ID; the other members pick
+  // it up from the store under a key private to the subgroup.
+  ncclUniqueId ncclID;
+  if (subgroupRank == 0) {
+    C10D_NCCL_CHECK(ncclGetUniqueId(&ncclID), c10::nullopt);
+    auto vec = std::vector<uint8_t>(
+        reinterpret_cast<uint8_t*>(&ncclID),
+        reinterpret_cast<uint8_t*>(&ncclID) + NCCL_UNIQUE_ID_BYTES);
+    store_->set(idStoreKey, vec);
+  } else {
+    auto vec = store_->get(idStoreKey);
+    TORCH_CHECK(vec.size() == NCCL_UNIQUE_ID_BYTES);
+    std::memcpy(&ncclID, vec.data(), vec.size());
+  }
+
+  at::cuda::OptionalCUDAGuard gpuGuard;
+
+  std::vector<at::cuda::CUDAStream> streamVal;
+  streamVal.reserve(devices.size());
+
+  // See [Group Start/End Note]
+  for (const auto i : c10::irange(ncclActiveGroupCounter_)) {
+    (void)i;
+    C10D_NCCL_CHECK(ncclGroupEnd(), c10::nullopt);
+  }
+
+  C10D_NCCL_CHECK(ncclGroupStart(), c10::nullopt);
+  for (const auto i : c10::irange(devices.size())) {
+    gpuGuard.set_index(devices[i].index());
+    ncclComms[i] = NCCLComm::create(numRanks, subgroupRank, ncclID);
+    streamVal.push_back(
+        at::cuda::getStreamFromPool(options_->is_high_priority_stream));
+  }
+  C10D_NCCL_CHECK(ncclGroupEnd(), c10::nullopt);
+
+  // See [Group Start/End Note]
+  for (const auto i : c10::irange(ncclActiveGroupCounter_)) {
+    (void)i;
+    C10D_NCCL_CHECK(ncclGroupStart(), c10::nullopt);
+  }
+
+  ncclStreams_.emplace(cacheKey, std::move(streamVal));
+  ncclEvents_.emplace(
+      std::piecewise_construct,
+      std::make_tuple(cacheKey),
+      std::make_tuple(devices.size()));
+
+  // Hold the lock before modifying the cache.
+  std::lock_guard<std::mutex> lock(mutex_);
+  ncclIdToCommMap_.emplace(buildNcclUniqueIdStr(ncclID), ncclComms);
+  devNCCLCommMap_.emplace(cacheKey, std::move(ncclComms));
+  return devNCCLCommMap_[cacheKey];
+}
+
 namespace {
 
 // Check validity of tensor
@@ -1223,12 +1532,16 @@ c10::intrusive_ptr<c10::ivalue::Future> ProcessGroupNCCL::WorkNCCL::
 void ProcessGroupNCCL::workEnqueue(
     c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL> work) {
   if (!terminateProcessGroup_.load()) {
-    std::lock_guard<std::mutex> lock(workMetaListMutex_);
+    // Stage the work on a list of its own instead of appending to
+    // workMetaList_ directly, so launches only contend on a mutex that is
+    // never held across CUDA event queries. See Note [Batched completion
+    // polling].
+    std::lock_guard<std::mutex> lock(workEnqueueMutex_);
     // Avoid view tensors to be processed in cleanup thread.
     // View tensors' destruction invokes autograd_meta, which
     // needs to be destructed in user thread. Otherwise will
     // get deadlock. Here we enqueue work without outputs_.
-    workMetaList_.emplace_back(WorkNCCL(*work));
+    workEnqueueList_.emplace_back(WorkNCCL(*work));
   }
 }
 
@@ -1471,6 +1784,130 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::pointToPoint(
       profilingTitle);
 }
 
+// See Note [Hierarchical allreduce]. This mirrors the structure of
+// collective(), but issues the three data-dependent phases back to back
+// on one stream, so it cannot reuse the single-comm callback interface.
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduceHierarchical(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  errorIfCapturingNonCapturableNCCL();
+
+  // Bump collective counter
+  if (sequenceNum_) {
+    sequenceNum_->increment();
+  }
+
+  const auto devices = getDeviceList(tensors);
+  const auto devicesKey = getKeyFromDevices(devices);
+  // Cache keys carry a suffix so they cannot collide with the flat
+  // communicators, whose keys are plain device lists.
+  const auto key = devicesKey + ":hier_intra";
+  auto& intraComms = getSubgroupNCCLComm(
+      key,
+      devices,
+      localSize_,
+      localRank_,
+      "hierarchical_intra_id_" + std::to_string(nodeId_));
+  auto& crossComms = getSubgroupNCCLComm(
+      devicesKey + ":hier_cross",
+      devices,
+      numNodes_,
+      nodeId_,
+      "hierarchical_cross_id_" + std::to_string(localRank_));
+
+  // All three phases run on the intra communicator's stream; stream order
+  // serializes them without any extra synchronization.
+  syncStreams(devices, ncclEvents_[key], ncclStreams_[key]);
+
+  auto work = initWork(
+      devices,
+      rank_,
+      OpType::ALLREDUCE,
+      "nccl:hierarchical_all_reduce",
+      c10::optional<std::vector<at::Tensor>>(tensors));
+
+  // Store references to outputs to be used by WorkNCCL::result and operator<<.
+  work->outputs_ = std::make_shared<std::vector<at::Tensor>>(tensors);
+
+  at::cuda::OptionalCUDAGuard gpuGuard;
+  gpuGuard.set_index(devices[0].index());
+  at::cuda::CUDAStream& ncclStream = ncclStreams_[key][0];
+
+  auto& tensor = tensors[0];
+  // See [Sync Streams].
+  c10::cuda::CUDACachingAllocator::recordStream(
+      tensor.storage().data_ptr(), ncclStream);
+
+  const size_t shardNumel = tensor.numel() / localSize_;
+  const auto dataType = getNcclDataType(tensor.scalar_type());
+  const auto reduceOp = getNcclReduceOp(opts.reduceOp, tensor);
+  char* base = static_cast<char*>(tensor.data_ptr());
+  char* shard = base + localRank_ * shardNumel * tensor.element_size();
+
+  // Phase 1: each local rank ends up with the node-local reduction of its
+  // shard. The shard pointer satisfies NCCL's in-place requirement
+  // (recvbuff == sendbuff + rank * recvcount), so no scratch buffer is
+  // needed in any phase.
+  C10D_NCCL_CHECK(
+      ncclReduceScatter(
+          base,
+          shard,
+          shardNumel,
+          dataType,
+          reduceOp,
+          intraComms[0]->getNcclComm(),
+          ncclStream.stream()),
+      intraComms[0]->getNcclCommFailureReason());
+  // Phase 2: combine each shard across nodes. This is the only traffic
+  // that leaves the node.
+  C10D_NCCL_CHECK(
+      ncclAllReduce(
+          shard,
+          shard,
+          shardNumel,
+          dataType,
+          reduceOp,
+          crossComms[0]->getNcclComm(),
+          ncclStream.stream()),
+      crossComms[0]->getNcclCommFailureReason());
+  // Phase 3: redistribute the fully reduced shards within the node.
+  C10D_NCCL_CHECK(
+      ncclAllGather(
+          shard,
+          base,
+          shardNumel,
+          dataType,
+          intraComms[0]->getNcclComm(),
+          ncclStream.stream()),
+      intraComms[0]->getNcclCommFailureReason());
+
+  (*work->cudaEvents_)[0].record(ncclStream);
+  work->ncclComms_[0] = intraComms[0];
+
+  {
+    c10::cuda::CUDAMultiStreamGuard streamGuard(ncclStreams_[key]);
+    work->future_ = c10::make_intrusive<at::ivalue::Future>(
+        c10::ListType::create(c10::TensorType::get()), devices);
+    if (work->recordFunctionEndCallback_) {
+      work->future_->addCallback([work](at::ivalue::Future& /* unused */) {
+        work->recordFunctionEndCallback_();
+      });
+    }
+    work->future_->markCompleted(at::IValue(*work->outputs_));
+  }
+
+  // Set appropriate work parameters.
+  work->blockingWait_ = blockingWait_;
+  work->opTimeout_ = options_->timeout;
+  work->store_ = store_;
+
+  if (asyncErrorHandling_) {
+    workEnqueue(work);
+  }
+
+  return work;
+}
+
 c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
@@ -1487,6 +1924,15 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
       std::vector<int64_t>(), // inSplitSizes
       std::vector<int64_t>()); // outSplitSizes
 
+  // See Note [Hierarchical allreduce]. Falls back to the flat algorithm
+  // when there is no node hierarchy to exploit or the tensor cannot be
+  // evenly sharded within a node.
+  if (options_->hierarchical_allreduce && tensors.size() == 1 &&
+      ensureHierarchicalTopology() &&
+      tensors[0].numel() % localSize_ == 0) {
+    return allreduceHierarchical(tensors, opts);
+  }
+
   return collective(
       tensors,
       tensors,
@@ -1943,6 +2389,102 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::alltoall(
       OpType::ALLTOALL);
 }
 
+// Note [Fused MoE alltoall]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+// An expert-parallel (MoE) layer routes each token to the rank hosting its
+// expert: it gathers the tokens into expert order, packs them into a
+// contiguous send buffer and runs an unequal-split alltoall. Through the
+// public API that costs a gather kernel and a pack copy on the compute
+// stream plus the collective - three kernel/collective round trips per
+// layer. alltoall_permute performs all of it inside one collective: the
+// gather runs on the NCCL stream and its contiguous output is the packed
+// send buffer directly, that buffer comes from the caching allocator's pool
+// for the NCCL stream so steady-state iterations reuse one allocation, and
+// the exchange is the usual single ncclGroupStart/ncclGroupEnd block.
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::alltoall_permute(
+    at::Tensor& outputTensor,
+    at::Tensor& inputTensor,
+    const at::Tensor& permutation,
+    std::vector<int64_t>& outputSplitSizes,
+    std::vector<int64_t>& inputSplitSizes) {
+  check_gpu_single_tensor(outputTensor);
+  check_gpu_single_tensor(inputTensor);
+  TORCH_CHECK(
+      permutation.device() == inputTensor.device() && permutation.dim() == 1 &&
+          permutation.scalar_type() == at::kLong,
+      "permutation must be a 1-D Long tensor on the input's device");
+  TORCH_CHECK(
+      permutation.numel() == inputTensor.size(0),
+      "permutation must index every row of the input, got ",
+      permutation.numel(),
+      " indices for ",
+      inputTensor.size(0),
+      " rows");
+  if (inputSplitSizes.size() != 0 || outputSplitSizes.size() != 0) {
+    c10d::checkSplitSizes(inputSplitSizes, inputTensor, size_);
+    c10d::checkSplitSizes(outputSplitSizes, outputTensor, size_);
+  }
+  std::vector<at::Tensor> inputTensors = {inputTensor};
+  std::vector<at::Tensor> outputTensors = {outputTensor};
+
+  RECORD_PARAM_COMMS(
+      rank_,                    // rank
+      "alltoall_permute",       // colName
+      inputTensor.numel(),      // inSize
+      outputTensor.numel(),     // outSize
+      inputTensor.scalar_type(),// dType
+      inputSplitSizes,          // inSplitSizes
+      outputSplitSizes);        // outSplitSizes
+
+  return collective(
+      inputTensors,
+      outputTensors,
+      [&](at::Tensor& input,
+          at::Tensor& output,
+          ncclComm_t comm,
+          at::cuda::CUDAStream& stream) {
+        // Gather the tokens on the NCCL stream. The packed buffer is
+        // allocated from this stream's pool and only ever used on this
+        // stream, so it needs no extra synchronization or recordStream;
+        // permutation comes from the compute stream, so record it like any
+        // other input.
+        at::cuda::CUDAStreamGuard streamGuard(stream);
+        c10::cuda::CUDACachingAllocator::recordStream(
+            permutation.storage().data_ptr(), stream);
+        auto packed = input.index_select(0, permutation);
+        // See [Sync Streams].
+        c10::cuda::CUDACachingAllocator::recordStream(
+            output.storage().data_ptr(), stream);
+        if (outputSplitSizes.size() == 0 && inputSplitSizes.size() == 0) {
+          torch::cuda::nccl::all2all_single_equal_split(
+              packed, output, this->getSize(), comm, stream);
+        } else {
+          std::vector<size_t> send_lengths(size_);
+          std::vector<size_t> recv_lengths(size_);
+          std::vector<size_t> send_offsets(size_);
+          std::vector<size_t> recv_offsets(size_);
+          c10d::computeLengthsAndOffsets(
+              inputSplitSizes, packed, &send_lengths, &send_offsets);
+          c10d::computeLengthsAndOffsets(
+              outputSplitSizes, output, &recv_lengths, &recv_offsets);
+          torch::cuda::nccl::all2all_single_unequal_split(
+              packed.data_ptr(),
+              send_lengths.data(),
+              send_offsets.data(),
+              output.data_ptr(),
+              recv_lengths.data(),
+              recv_offsets.data(),
+              packed.element_size(),
+              packed.scalar_type(),
+              comm,
+              stream);
+        }
+        return ncclSuccess;
+      },
+      OpType::ALLTOALL_BASE,
+      "nccl:alltoall_permute");
+}
+
 c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::send(
     std::vector<at::Tensor>& tensors,
     int dstRank,
@@ -2001,6 +2543,16 @@ c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::alltoall(
       "ProcessGroupNCCL only supports alltoall* for NCCL lib version >= 2.7.0");
 }
 
+c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::alltoall_permute(
+    at::Tensor& /* unused */,
+    at::Tensor& /* unused */,
+    const at::Tensor& /* unused */,
+    std::vector<int64_t>& /* unused */,
+    std::vector<int64_t>& /* unused */) {
+  TORCH_CHECK(false,
+      "ProcessGroupNCCL only supports alltoall* for NCCL lib version >= 2.7.0");
+}
+
 c10::intrusive_ptr<ProcessGroup::Work> ProcessGroupNCCL::send(
     std::vector<at::Tensor>& /* unused */,
     int /* unused */,
@@ -196,6 +196,16 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
 
     // Schedule NCCL operations on high priority CUDA streams
     bool is_high_priority_stream;
+
+    // Perform allreduce as a two-level hierarchy: an intra-node
+    // reduce-scatter (over NVLink), a cross-node allreduce among ranks
+    // with the same local rank on every node, and an intra-node
+    // allgather. With N GPUs per node this cuts the bytes crossing the
+    // inter-node fabric by a factor of N. Node topology is detected
+    // automatically by exchanging hostnames through the store on first
+    // use; if ranks are all on one node, or nodes are unevenly
+    // populated, allreduce silently falls back to the flat algorithm.
+    bool hierarchical_allreduce{false};
   };
 
   // If you wish to create multiple process groups, each with a potentially
@@ -296,6 +306,33 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
       std::vector<at::Tensor>& inputTensors,
       const AllToAllOptions& opts = AllToAllOptions()) override;
 
+  // Fused exchange for expert-parallel (MoE) layers: gathers the rows of
+  // inputTensor given by permutation into a packed send buffer and exchanges
+  // the per-rank splits, with both the gather kernel and the grouped
+  // ncclSend/ncclRecv calls issued on the NCCL stream in a single
+  // collective. Empty split vectors mean an equal split across ranks, as in
+  // alltoall_base. See Note [Fused MoE alltoall]. NCCL-specific, not part of
+  // the ProcessGroup interface.
+  c10::intrusive_ptr<ProcessGroup::Work> alltoall_permute(
+      at::Tensor& outputTensor,
+      at::Tensor& inputTensor,
+      const at::Tensor& permutation,
+      std::vector<int64_t>& outputSplitSizes,
+      std::vector<int64_t>& inputSplitSizes);
+
+  // Eagerly creates and connects the NCCL communicators for the given
+  // device groups instead of leaving it to the first collective per
+  // device set, moving connection setup cost out of the first training
+  // step. The unique-id exchange through the store is batched across
+  // groups. Like a collective, this must be called by all ranks with the
+  // same deviceGroups. When warmup is set, additionally runs a
+  // one-element allreduce over each group so NCCL establishes its rings
+  // and channels up front. See Note [Eager NCCL initialization].
+  // NCCL-specific, not part of the ProcessGroup interface.
+  void initComms(
+      const std::vector<std::vector<at::Device>>& deviceGroups,
+      bool warmup = false);
+
   c10::intrusive_ptr<ProcessGroup::Work> send(
       std::vector<at::Tensor>& tensors,
       int dstRank,
@@ -406,6 +443,30 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
       PostProcess post,
       const char* profilingTitle);
 
+  // Lazily exchanges hostnames through the store to discover which ranks
+  // share a node. Returns true if a useful two-level hierarchy exists
+  // (more than one node, more than one rank per node, and the same number
+  // of ranks on every node). See Note [Hierarchical allreduce].
+  bool ensureHierarchicalTopology();
+
+  // Looks up or creates a cached subgroup communicator whose membership
+  // is defined by (numRanks, subgroupRank), broadcasting the NCCL unique
+  // ID among the subgroup through `idStoreKey`. Used for the intra-node
+  // and cross-node communicators of hierarchical allreduce.
+  std::vector<std::shared_ptr<NCCLComm>>& getSubgroupNCCLComm(
+      const std::string& cacheKey,
+      const std::vector<at::Device>& devices,
+      int numRanks,
+      int subgroupRank,
+      const std::string& idStoreKey);
+
+  // Two-level allreduce implementation used when
+  // Options::hierarchical_allreduce is set and the topology supports it.
+  // See Note [Hierarchical allreduce].
+  c10::intrusive_ptr<ProcessGroup::Work> allreduceHierarchical(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -458,6 +519,17 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
   // used to scope keys used in the store.
   uint64_t ncclCommCounter_{0};
 
+  // Node topology discovered by ensureHierarchicalTopology(). The usable
+  // flag is only meaningful once the checked flag is set; localRank_ and
+  // localSize_ place this rank within its node, nodeId_ and numNodes_
+  // place the node within the job.
+  bool hierarchyChecked_{false};
+  bool hierarchyUsable_{false};
+  int localRank_{-1};
+  int localSize_{-1};
+  int nodeId_{-1};
+  int numNodes_{-1};
+
   // The NCCL communicator that the process group has cached.
   //
   // For collective operations:
@@ -493,6 +565,11 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
   std::unordered_map<std::string, std::vector<std::shared_ptr<NCCLComm>>>
       ncclIdToCommMap_;
 
+  // Unique IDs pre-exchanged by initComms(), keyed like devNCCLCommMap_.
+  // getNCCLComm() consumes an entry from here instead of generating and
+  // broadcasting a fresh ID through the store.
+  std::unordered_map<std::string, ncclUniqueId> eagerNcclIDs_;
+
   // Mutex to guard maps like devNCCLCommMap_ and ncclIdToCommMap_.
   std::mutex mutex_;
 
@@ -520,6 +597,15 @@ class TORCH_API ProcessGroupNCCL : public ProcessGroup {
   // Vector to Store WorkNCCL pointers
   std::list<ProcessGroupNCCL::WorkNCCL> workMetaList_;
 
+  // Mutex to guard workEnqueueList_. Held only for O(1) list operations so
+  // collective launches never contend with the cleanup thread's CUDA event
+  // queries. See Note [Batched completion polling].
+  std::mutex workEnqueueMutex_;
+
+  // Staging list for newly enqueued works; drained into workMetaList_ by the
+  // background threads.
+  std::list<ProcessGroupNCCL::WorkNCCL> workEnqueueList_;
+
   // Add Work Pointer to workVector
   void workEnqueue(c10::intrusive_ptr<ProcessGroupNCCL::WorkNCCL>);
 
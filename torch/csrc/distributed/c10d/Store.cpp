@@ -17,4 +17,129 @@ void Store::setTimeout(const std::chrono::milliseconds& timeout) {
   timeout_ = timeout;
 }
 
+// Note [Store control-plane collectives]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Process group initialization and rendezvous used to synchronize through the
+// store by having every rank increment one counter key and then poll it in a
+// sleep loop until it reached worldSize. That is O(worldSize) round trips per
+// rank - O(worldSize^2) requests hitting the store in total - and at a few
+// thousand ranks the resulting storm of get/add requests dominates startup
+// time.
+//
+// The collectives below instead arrange the ranks in a binary tree rooted at
+// rank 0, where rank r has children 2r+1 and 2r+2. For the barrier, arrival
+// propagates leaf-to-root (each rank publishes its "arrive" key only once its
+// children have published theirs) and the release propagates root-to-leaf,
+// so each rank issues at most two set()s and two wait()s regardless of world
+// size and every key has at most two waiters. wait() blocks server-side in
+// stores that support it (e.g. TCPStore), so there is no client polling at
+// all. Broadcast fans the payload out along the same tree: each rank
+// long-polls its parent's copy and re-publishes it for its own children.
+// Allgather necessarily moves O(worldSize) payloads to every rank; it batches
+// the synchronization into a single wait() on all worldSize keys so only the
+// unavoidable data transfer scales with world size.
+
+namespace {
+
+// Arbitrary nonempty payload for keys that only signal existence.
+const std::vector<uint8_t> kBarrierToken = {1};
+
+inline std::string rankKey(
+    const std::string& prefix,
+    const char* stage,
+    int64_t rank) {
+  return prefix + "/" + stage + "/" + std::to_string(rank);
+}
+
+inline void checkRankAndWorldSize(int64_t rank, int64_t worldSize) {
+  TORCH_CHECK(worldSize >= 1, "worldSize must be positive, got ", worldSize);
+  TORCH_CHECK(
+      rank >= 0 && rank < worldSize,
+      "rank must be in [0, ",
+      worldSize,
+      "), got ",
+      rank);
+}
+
+} // namespace
+
+void Store::barrier(const std::string& prefix, int64_t rank, int64_t worldSize) {
+  barrier(prefix, rank, worldSize, timeout_);
+}
+
+void Store::barrier(
+    const std::string& prefix,
+    int64_t rank,
+    int64_t worldSize,
+    const std::chrono::milliseconds& timeout) {
+  checkRankAndWorldSize(rank, worldSize);
+  if (worldSize == 1) {
+    return;
+  }
+
+  // Fan-in: wait for our children (if any) to arrive, then report our own
+  // subtree as arrived.
+  std::vector<std::string> childArriveKeys;
+  for (int64_t child = 2 * rank + 1;
+       child <= 2 * rank + 2 && child < worldSize;
+       ++child) {
+    childArriveKeys.push_back(rankKey(prefix, "arrive", child));
+  }
+  if (!childArriveKeys.empty()) {
+    wait(childArriveKeys, timeout);
+  }
+  if (rank != 0) {
+    set(rankKey(prefix, "arrive", rank), kBarrierToken);
+    // Fan-out: once the root has seen every subtree arrive, its release
+    // propagates back down the tree.
+    wait({rankKey(prefix, "release", (rank - 1) / 2)}, timeout);
+  }
+  if (!childArriveKeys.empty()) {
+    set(rankKey(prefix, "release", rank), kBarrierToken);
+  }
+}
+
+std::vector<uint8_t> Store::broadcast(
+    const std::string& prefix,
+    int64_t rank,
+    int64_t worldSize,
+    const std::vector<uint8_t>& value) {
+  checkRankAndWorldSize(rank, worldSize);
+  std::vector<uint8_t> result = value;
+  if (rank != 0) {
+    const auto parentKey = rankKey(prefix, "bcast", (rank - 1) / 2);
+    wait({parentKey}, timeout_);
+    result = get(parentKey);
+  }
+  // Re-publish for our children, if we have any.
+  if (2 * rank + 1 < worldSize) {
+    set(rankKey(prefix, "bcast", rank), result);
+  }
+  return result;
+}
+
+std::vector<std::vector<uint8_t>> Store::allGather(
+    const std::string& prefix,
+    int64_t rank,
+    int64_t worldSize,
+    const std::vector<uint8_t>& value) {
+  checkRankAndWorldSize(rank, worldSize);
+  set(rankKey(prefix, "gather", rank), value);
+
+  // One batched wait on all the keys instead of polling them one by one.
+  std::vector<std::string> keys;
+  keys.reserve(worldSize);
+  for (int64_t r = 0; r < worldSize; ++r) {
+    keys.push_back(rankKey(prefix, "gather", r));
+  }
+  wait(keys, timeout_);
+
+  std::vector<std::vector<uint8_t>> result;
+  result.reserve(worldSize);
+  for (int64_t r = 0; r < worldSize; ++r) {
+    result.push_back(r == rank ? value : get(keys[r]));
+  }
+  return result;
+}
+
 } // namespace c10d
@@ -77,6 +77,40 @@ class TORCH_API Store : public torch::CustomClassHolder {
         "watchKey only implemented for TCPStore and PrefixStore that wraps TCPStore.");
   }
 
+  // Control-plane collectives built on the key/value primitives above, for
+  // synchronizing process group initialization and rendezvous. Every rank in
+  // [0, worldSize) must call the same method with the same prefix exactly
+  // once, and a prefix must not be reused for a later invocation. The
+  // default implementations arrange ranks in a binary tree so each rank
+  // issues a constant number of store operations and each key is waited on
+  // by at most two ranks, rather than all ranks polling a single counter
+  // key. See Note [Store control-plane collectives] in Store.cpp.
+  virtual void barrier(
+      const std::string& prefix,
+      int64_t rank,
+      int64_t worldSize);
+
+  virtual void barrier(
+      const std::string& prefix,
+      int64_t rank,
+      int64_t worldSize,
+      const std::chrono::milliseconds& timeout);
+
+  // Returns the root's value on every rank. The value argument is only
+  // inspected on rank 0.
+  virtual std::vector<uint8_t> broadcast(
+      const std::string& prefix,
+      int64_t rank,
+      int64_t worldSize,
+      const std::vector<uint8_t>& value);
+
+  // Returns every rank's value, indexed by rank.
+  virtual std::vector<std::vector<uint8_t>> allGather(
+      const std::string& prefix,
+      int64_t rank,
+      int64_t worldSize,
+      const std::vector<uint8_t>& value);
+
  protected:
   std::chrono::milliseconds timeout_;
 };
@@ -17,6 +17,10 @@
 #include <unistd.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
 #ifdef _WIN32
 #include <c10d/WinSockUtils.hpp>
 #else
@@ -182,6 +186,7 @@ enum class QueryType : uint8_t {
   GETNUMKEYS,
   WATCH_KEY,
   DELETE_KEY,
+  MULTI_GET,
 };
 
 enum class CheckResponseType : uint8_t { READY, NOT_READY };
@@ -218,8 +223,11 @@ class TCPStoreMasterDaemon : public BackgroundThread {
   void deleteHandler(int socket);
   void waitHandler(int socket);
   void watchHandler(int socket);
+  void multiGetHandler(int socket) const;
 
   bool checkKeys(const std::vector<std::string>& keys) const;
+  // Helper function to drop the wait-tracking state of a closed socket
+  void clearSocketWaitState(int socket);
   // Helper function to alerts waiting workers, used in setHandler, getHandler
   void wakeupWaitingClients(const std::string& key);
   // Helper function used when the key is changed
@@ -271,27 +279,8 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
       tcputil::closeSocket(fds[fdIdx].fd);
 
       // Remove all the tracking state of the close FD
-      for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
-        for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
-          if (*vecIt == fds[fdIdx].fd) {
-            vecIt = it->second.erase(vecIt);
-          } else {
-            ++vecIt;
-          }
-        }
-        if (it->second.size() == 0) {
-          it = waitingSockets_.erase(it);
-        } else {
-          ++it;
-        }
-      }
-      for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
-        if (it->first == fds[fdIdx].fd) {
-          it = keysAwaited_.erase(it);
-        } else {
-          ++it;
-        }
-      }
+      clearSocketWaitState(fds[fdIdx].fd);
+
       fds.erase(fds.begin() + fdIdx);
       sockets_.erase(sockets_.begin() + fdIdx - CONNECT_SOCKET_OFFSET);
       --fdIdx;
@@ -300,6 +289,30 @@ void TCPStoreMasterDaemon::queryFds(std::vector<struct pollfd>& fds) {
   }
 }
 
+void TCPStoreMasterDaemon::clearSocketWaitState(int socket) {
+  for (auto it = waitingSockets_.begin(); it != waitingSockets_.end();) {
+    for (auto vecIt = it->second.begin(); vecIt != it->second.end();) {
+      if (*vecIt == socket) {
+        vecIt = it->second.erase(vecIt);
+      } else {
+        ++vecIt;
+      }
+    }
+    if (it->second.size() == 0) {
+      it = waitingSockets_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  for (auto it = keysAwaited_.begin(); it != keysAwaited_.end();) {
+    if (it->first == socket) {
+      it = keysAwaited_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 // query communicates with the worker. The format
 // of the query is as follows:
 // type of query | size of arg1 | arg1 | size of arg2 | arg2 | ...
@@ -335,6 +348,9 @@ void TCPStoreMasterDaemon::query(int socket) {
   } else if (qt == QueryType::WATCH_KEY) {
     watchHandler(socket);
 
+  } else if (qt == QueryType::MULTI_GET) {
+    multiGetHandler(socket);
+
   } else {
     TORCH_CHECK(false, "Unexpected query type");
   }
@@ -452,6 +468,17 @@ void TCPStoreMasterDaemon::getHandler(int socket) const {
   tcputil::sendVector<uint8_t>(socket, data);
 }
 
+void TCPStoreMasterDaemon::multiGetHandler(int socket) const {
+  SizeType nargs;
+  tcputil::recvBytes<SizeType>(socket, &nargs, 1);
+  // The keys have all been sent in a single batch, so the values can be
+  // streamed back as the keys are read off the socket.
+  for (const auto i : c10::irange(nargs)) {
+    const auto& data = tcpStore_.at(tcputil::recvString(socket));
+    tcputil::sendVector<uint8_t>(socket, data, /*moreData=*/i + 1 < nargs);
+  }
+}
+
 void TCPStoreMasterDaemon::getNumKeysHandler(int socket) const {
   tcputil::sendValue<int64_t>(socket, tcpStore_.size());
 }
@@ -569,6 +596,110 @@ void TCPStoreMasterDaemon::run() {
     queryFds(fds);
   }
 }
+#elif defined(__linux__)
+// On Linux the master daemon multiplexes its connections with epoll rather
+// than poll. poll hands the kernel the full socket list on every call and
+// scans every entry for events, which is O(connections) per wakeup; with
+// thousands of ranks hammering the store during rendezvous that scan
+// dominates. epoll registers each socket once and only readable sockets are
+// reported. The event loop is level-triggered, so a client that pipelines
+// several requests onto its socket keeps getting reported until they have
+// all been drained, one request per wakeup.
+void TCPStoreMasterDaemon::run() {
+  TCPSocket epollFd{};
+  {
+    int fd;
+    SYSCHECK_ERR_RETURN_NEG1(fd = ::epoll_create1(0));
+    epollFd = TCPSocket{fd};
+  }
+
+  auto registerFd = [&epollFd](int fd) {
+    struct epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    SYSCHECK_ERR_RETURN_NEG1(
+        ::epoll_ctl(epollFd.handle(), EPOLL_CTL_ADD, fd, &event));
+  };
+
+  registerFd(storeListenSocket_.handle());
+  // Register the read end of the pipe to signal the stopping of the daemon run
+  registerFd(controlPipeFd_[0]);
+
+  std::array<struct epoll_event, 64> events{};
+
+  // receive the queries
+  bool finished = false;
+  while (!finished) {
+    int numReady;
+    SYSCHECK_ERR_RETURN_NEG1(
+        numReady = ::epoll_wait(
+            epollFd.handle(),
+            events.data(),
+            static_cast<int>(events.size()),
+            -1));
+
+    for (const auto i : c10::irange(numReady)) {
+      const struct epoll_event& event = events[i];
+
+      // The pipe receives an event which tells us to shutdown the daemon
+      if (event.data.fd == controlPipeFd_[0]) {
+        // Will be EPOLLHUP when the pipe is closed
+        if (!(event.events & EPOLLHUP)) {
+          throw std::system_error(
+              ECONNABORTED,
+              std::system_category(),
+              "Unexpected epoll event on the control pipe's reading fd: " +
+                  std::to_string(event.events));
+        }
+        finished = true;
+        break;
+      }
+
+      // TCPStore's listening socket has an event and it should now be able
+      // to accept new connections.
+      if (event.data.fd == storeListenSocket_.handle()) {
+        if (!(event.events & EPOLLIN)) {
+          throw std::system_error(
+              ECONNABORTED,
+              std::system_category(),
+              "Unexpected epoll event on the master's listening socket: " +
+                  std::to_string(event.events));
+        }
+        TCPSocket socket =
+            std::get<0>(tcputil::accept(storeListenSocket_.handle()));
+        int rawSocket = socket.handle();
+        sockets_.emplace_back(std::move(socket));
+        registerFd(rawSocket);
+        continue;
+      }
+
+      // Now query the socket that has the event
+      try {
+        query(event.data.fd);
+      } catch (...) {
+        // There was an error when processing query. Probably an exception
+        // occurred in recv/send what would indicate that socket on the other
+        // side has been closed. If the closing was due to normal exit, then
+        // the store should continue executing. Otherwise, if it was different
+        // exception, other connections will get an exception once they try to
+        // use the store. We will go ahead and close this connection whenever
+        // we hit an exception here.
+
+        // Remove all the tracking state of the closed FD
+        clearSocketWaitState(event.data.fd);
+
+        // Dropping the TCPSocket closes the socket, which also removes it
+        // from the epoll set.
+        for (auto it = sockets_.begin(); it != sockets_.end(); ++it) {
+          if (it->handle() == event.data.fd) {
+            sockets_.erase(it);
+            break;
+          }
+        }
+      }
+    }
+  }
+}
 #else
 void TCPStoreMasterDaemon::run() {
   std::vector<struct pollfd> fds;
@@ -1084,6 +1215,30 @@ std::vector<uint8_t> TCPStore::doGet(const std::string& key) {
   return client_->receiveBits();
 }
 
+std::vector<std::vector<uint8_t>> TCPStore::multiGet(
+    const std::vector<std::string>& keys) {
+  std::vector<std::string> prefixedKeys{};
+  prefixedKeys.reserve(keys.size());
+  for (const std::string& key : keys) {
+    prefixedKeys.emplace_back(keyPrefix_ + key);
+  }
+
+  // A single batched wait on all keys followed by a single batched fetch --
+  // two round trips to the master in total, instead of two per key.
+  doWait(prefixedKeys, timeout_);
+
+  client_->sendCommand(detail::QueryType::MULTI_GET);
+  client_->sendStrings(prefixedKeys);
+
+  std::vector<std::vector<uint8_t>> result{};
+  result.reserve(keys.size());
+  for (const auto i : c10::irange(keys.size())) {
+    (void)i; // Suppress unused variable warning
+    result.emplace_back(client_->receiveBits());
+  }
+  return result;
+}
+
 int64_t TCPStore::add(const std::string& key, int64_t value) {
   return incrementValueBy(keyPrefix_ + key, value);
 }
@@ -59,6 +59,12 @@ class TORCH_API TCPStore : public Store {
 
   std::vector<uint8_t> get(const std::string& key) override;
 
+  // Waits for all keys to be set and then fetches their values in a single
+  // round trip to the master. Equivalent to calling get() on each key, but
+  // the cost over the wire does not grow with the number of keys.
+  std::vector<std::vector<uint8_t>> multiGet(
+      const std::vector<std::string>& keys);
+
   int64_t add(const std::string& key, int64_t value) override;
 
   bool deleteKey(const std::string& key) override;
@@ -1,11 +1,15 @@
 #include <c10d/default_comm_hooks.hpp>
+#include <ATen/CPUGeneratorImpl.h>
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
+#include <c10/util/irange.h>
 
 #include <c10d/ProcessGroup.hpp>
 #include <c10d/comm.hpp>
 #include <torch/torch.h>
 
+#include <cmath>
+
 namespace c10d {
 
 c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
@@ -45,6 +49,119 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+namespace {
+
+// Base seed for initializing the low-rank factor Q. The factors are only
+// initialized once per bucket and then refined by power iteration, and all
+// ranks must start the iteration from the same Q, so the seed has to be
+// deterministic.
+constexpr uint64_t kPowerSGDSeedBase = 42;
+
+// Makes the columns of the given 2D tensor orthonormal with one pass of
+// Gram-Schmidt, in place. Same procedure as the `_orthogonalize` helper of
+// the Python PowerSGD hook.
+void orthogonalize(at::Tensor& matrix) {
+  const auto num_cols = matrix.size(1);
+  for (const auto i : c10::irange(num_cols)) {
+    auto col = matrix.select(1, i).unsqueeze(1);
+    col.div_(col.norm());
+    if (i + 1 < num_cols) {
+      auto rest = matrix.narrow(1, i + 1, num_cols - (i + 1));
+      rest.sub_(col.matmul(col.t().matmul(rest)));
+    }
+  }
+}
+
+} // namespace
+
+c10::intrusive_ptr<c10::ivalue::Future> PowerSGDCommHook::runHook(
+    GradBucket& bucket) {
+  auto& buffer = bucket.getBufferRef();
+
+  // Low-rank approximation only makes sense for floating-point gradients.
+  if (!buffer.is_floating_point()) {
+    std::vector<at::Tensor> tensors = {buffer};
+    // Apply the division first to avoid overflow.
+    tensors[0] /= state_->getSize();
+    return state_->allreduce(tensors)->getFuture();
+  }
+
+  const auto numel = buffer.numel();
+  const auto bucket_index = bucket.getIndex();
+
+  auto state_it = bucket_states_.find(bucket_index);
+  if (state_it == bucket_states_.end() ||
+      state_it->second.input.numel() < numel) {
+    BucketState bucket_state;
+    const auto side =
+        static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(numel))));
+    bucket_state.side = side;
+    bucket_state.input = at::zeros({side * side}, buffer.options());
+    bucket_state.error = at::zeros({side * side}, buffer.options());
+    bucket_state.p =
+        at::empty({side, matrix_approximation_rank_}, buffer.options());
+    // Q is drawn on the CPU from a fixed per-bucket seed and copied to the
+    // bucket's device, so that every rank starts the power iteration from
+    // the same factor.
+    auto generator =
+        at::detail::createCPUGenerator(kPowerSGDSeedBase + bucket_index);
+    auto q_init = at::randn(
+        {side, matrix_approximation_rank_},
+        generator,
+        buffer.options().device(at::kCPU));
+    orthogonalize(q_init);
+    bucket_state.q = q_init.to(buffer.device());
+    state_it = bucket_states_.emplace(bucket_index, std::move(bucket_state))
+                   .first;
+  }
+  BucketState* s = &state_it->second;
+
+  // Error feedback: compress the sum of this iteration's gradient and the
+  // part of the previous iteration's gradient that compression dropped.
+  s->input.narrow(0, 0, numel).copy_(buffer);
+  s->input.add_(s->error);
+  auto matrix = s->input.view({s->side, s->side});
+
+  // One step of power iteration on the allreduced gradient matrix:
+  // allreduce(M Q) sums the per-rank gradients inside the low-rank factor.
+  at::matmul_out(s->p, matrix, s->q);
+
+  std::vector<at::Tensor> ps = {s->p};
+  auto allreduce_p_fut = state_->allreduce(ps)->getFuture();
+
+  const auto world_size = state_->getSize();
+  // Note that `buffer` and `matrix` are captured by value, which only copies
+  // the tensor handles; `s` stays valid because unordered_map references are
+  // stable and the hook outlives all in-flight buckets.
+  auto compute_q_and_decompress =
+      [this, s, matrix, buffer, numel, world_size](
+          c10::ivalue::Future& /* unused */) mutable -> c10::IValue {
+    orthogonalize(s->p);
+    at::matmul_out(s->q, matrix.t(), s->p);
+
+    std::vector<at::Tensor> qs = {s->q};
+    auto allreduce_q_fut = state_->allreduce(qs)->getFuture();
+    // Mirrors the Python hook, which also waits on the second allreduce
+    // inside the callback of the first. This blocks a callback thread, not
+    // the autograd engine.
+    allreduce_q_fut->wait();
+    s->q.div_(world_size);
+
+    // The new error is the part of the input that P Q^T cannot represent.
+    // The approximation is written over the input buffer, which also primes
+    // it for the error-feedback addition of the next iteration.
+    s->error.copy_(s->input);
+    at::matmul_out(matrix, s->p, s->q.t());
+    s->error.sub_(s->input);
+
+    buffer.copy_(s->input.narrow(0, 0, numel));
+    return c10::IValue(buffer);
+  };
+
+  return allreduce_p_fut->then(
+      compute_q_and_decompress, allreduce_p_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::
     runHook(GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
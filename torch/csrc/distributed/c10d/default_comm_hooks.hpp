@@ -1,5 +1,7 @@
 #pragma once
 
+#include <unordered_map>
+
 #include <c10d/ProcessGroup.hpp>
 #include <c10d/comm.hpp>
 
@@ -8,6 +10,7 @@ namespace c10d {
 enum class BuiltinCommHookType {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  POWER_SGD = 3,
 };
 
 class AllReduceCommHook : public CppCommHookInterface<ProcessGroup*> {
@@ -30,6 +33,47 @@ class FP16CompressCommHook : public CppCommHookInterface<ProcessGroup*> {
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+// Native implementation of the batched PowerSGD gradient compression
+// algorithm (https://arxiv.org/abs/1905.13727). The flattened bucket buffer
+// is viewed as a square matrix M and approximated as P Q^T with
+// `matrix_approximation_rank` columns, so only the two low-rank factors are
+// allreduced. One power-iteration step refines the factors per bucket per
+// iteration, and the part of the gradient dropped by compression is fed back
+// into the next iteration through a preallocated per-bucket error buffer.
+// Unlike the Python hook of the same name, the whole pipeline runs in C++,
+// so the backward hot path pays no GIL or Python dispatch overhead.
+class PowerSGDCommHook : public CppCommHookInterface<ProcessGroup*> {
+ public:
+  explicit PowerSGDCommHook(
+      ProcessGroup* state,
+      int64_t matrix_approximation_rank = 1)
+      : CppCommHookInterface<ProcessGroup*>(state),
+        matrix_approximation_rank_(matrix_approximation_rank) {}
+
+  ~PowerSGDCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+
+ private:
+  // Per-bucket compression state, allocated the first time a bucket is seen
+  // and reused on every iteration afterwards.
+  struct BucketState {
+    // Error-compensated, zero-padded copy of the bucket buffer; its numel is
+    // side * side.
+    at::Tensor input;
+    // Error-feedback buffer holding what compression dropped last iteration.
+    at::Tensor error;
+    // Low-rank factors, of shape side x matrix_approximation_rank.
+    at::Tensor p;
+    at::Tensor q;
+    // The bucket buffer is padded up to a side x side square matrix.
+    int64_t side = 0;
+  };
+
+  int64_t matrix_approximation_rank_;
+  std::unordered_map<size_t, BucketState> bucket_states_;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the user.
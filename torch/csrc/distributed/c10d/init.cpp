@@ -335,9 +335,10 @@ Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS`` and ``POWER_SGD``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("POWER_SGD", ::c10d::BuiltinCommHookType::POWER_SGD);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -824,6 +825,105 @@ Example::
     >>> store = dist.TCPStore("127.0.0.1", 0, 1, True, timedelta(seconds=30))
     >>> # This will throw an exception after 10 seconds
     >>> store.wait(["bad_key"], timedelta(seconds=10))
+)")
+          .def(
+              "barrier",
+              [](::c10d::Store& store,
+                 const std::string& prefix,
+                 int64_t rank,
+                 int64_t world_size) {
+                store.barrier(prefix, rank, world_size);
+              },
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Blocks until all ``world_size`` ranks have called ``barrier`` with the same
+``prefix``. Ranks are arranged in a tree so each rank issues a constant number
+of store operations regardless of ``world_size``; prefer this over polling a
+counter key when synchronizing many ranks. A ``prefix`` must not be reused for
+a later barrier.
+
+Arguments:
+    prefix (str): Key prefix identifying this barrier; must be identical on all ranks.
+    rank (int): The rank of the calling process, in ``[0, world_size)``.
+    world_size (int): The number of processes participating in the barrier.
+)")
+          .def(
+              "barrier",
+              [](::c10d::Store& store,
+                 const std::string& prefix,
+                 int64_t rank,
+                 int64_t world_size,
+                 const std::chrono::milliseconds& timeout) {
+                store.barrier(prefix, rank, world_size, timeout);
+              },
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Like :meth:`~torch.distributed.store.barrier`, but throws an exception if the
+other ranks have not all arrived within ``timeout`` instead of the store's
+default timeout.
+)")
+          .def(
+              "broadcast",
+              [](::c10d::Store& store,
+                 const std::string& prefix,
+                 int64_t rank,
+                 int64_t world_size,
+                 const std::string& value) -> py::bytes {
+                std::vector<uint8_t> value_(value.begin(), value.end());
+                auto result = store.broadcast(prefix, rank, world_size, value_);
+                return py::bytes(
+                    reinterpret_cast<char*>(result.data()), result.size());
+              },
+              py::arg("prefix"),
+              py::arg("rank"),
+              py::arg("world_size"),
+              py::arg("value") = "",
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Broadcasts ``value`` from rank 0 to all other ranks and returns it. The value
+fans out along a tree of ranks, so no single key is read by all ranks.
+``value`` is ignored on nonzero ranks.
+
+Arguments:
+    prefix (str): Key prefix identifying this broadcast; must be identical on all ranks.
+    rank (int): The rank of the calling process, in ``[0, world_size)``.
+    world_size (int): The number of processes participating in the broadcast.
+    value (str): The value to broadcast; only inspected on rank 0.
+
+Returns:
+    Rank 0's ``value``, on every rank.
+)")
+          .def(
+              "all_gather",
+              [](::c10d::Store& store,
+                 const std::string& prefix,
+                 int64_t rank,
+                 int64_t world_size,
+                 const std::string& value) {
+                std::vector<uint8_t> value_(value.begin(), value.end());
+                auto result = store.allGather(prefix, rank, world_size, value_);
+                std::vector<py::bytes> result_;
+                result_.reserve(result.size());
+                for (auto& v : result) {
+                  result_.emplace_back(
+                      reinterpret_cast<char*>(v.data()), v.size());
+                }
+                return result_;
+              },
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Gathers one ``value`` from every rank and returns the values of all ranks,
+indexed by rank. The ranks synchronize with a single batched wait on all keys
+rather than polling each key.
+
+Arguments:
+    prefix (str): Key prefix identifying this allgather; must be identical on all ranks.
+    rank (int): The rank of the calling process, in ``[0, world_size)``.
+    world_size (int): The number of processes participating in the allgather.
+    value (str): The calling rank's contribution.
+
+Returns:
+    A list of ``world_size`` values, where the i-th element is rank i's ``value``.
 )")
           .def_property_readonly(
               "timeout",
@@ -945,7 +1045,46 @@ Example::
       .def_property_readonly(
           "port",
           &::c10d::TCPStore::getPort,
-          R"(Gets the port number on which the store listens for requests.)");
+          R"(Gets the port number on which the store listens for requests.)")
+      // Convert from std::vector<uint8_t> to py::bytes.
+      // The returned values are not guaranteed to be valid UTF-8.
+      .def(
+          "multi_get",
+          [](::c10d::TCPStore& store,
+             const std::vector<std::string>& keys) -> std::vector<py::bytes> {
+            std::vector<std::vector<uint8_t>> values;
+            {
+              py::gil_scoped_release guard;
+              values = store.multiGet(keys);
+            }
+            std::vector<py::bytes> result;
+            result.reserve(values.size());
+            for (const auto& value : values) {
+              result.emplace_back(
+                  reinterpret_cast<const char*>(value.data()), value.size());
+            }
+            return result;
+          },
+          R"(
+Retrieves the values associated with the given ``keys`` in a single batched
+request to the server. If any key is not present in the store, the function
+will first wait for ``timeout``, which is defined when initializing the store,
+before throwing an exception.
+
+Arguments:
+    keys (list[str]): The function will return the values associated with these keys.
+
+Returns:
+    Values associated with ``keys``, in the same order.
+
+Example::
+    >>> import torch.distributed as dist
+    >>> from datetime import timedelta
+    >>> store = dist.TCPStore("127.0.0.1", 0, 1, True, timedelta(seconds=30))
+    >>> store.set("first_key", "first_value")
+    >>> store.set("second_key", "second_value")
+    >>> store.multi_get(["first_key", "second_key"])
+)");
 
   intrusive_ptr_class_<::c10d::PrefixStore>(
       module,
@@ -1308,7 +1447,10 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
       processGroupGloo, "_Options", processGroupOptions)
       .def(py::init<>())
       .def_readwrite("_devices", &::c10d::ProcessGroupGloo::Options::devices)
-      .def_readwrite("_threads", &::c10d::ProcessGroupGloo::Options::threads);
+      .def_readwrite("_threads", &::c10d::ProcessGroupGloo::Options::threads)
+      .def_readwrite(
+          "_allreduce_max_segment_size",
+          &::c10d::ProcessGroupGloo::Options::allreduceMaxSegmentSize);
 
   processGroupGloo
       .def_static(
@@ -1421,7 +1563,54 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
               py::arg("timeout") = kProcessGroupDefaultTimeout,
               py::call_guard<py::gil_scoped_release>())
           .def_property_readonly(
-              "options", &::c10d::ProcessGroupNCCL::getOptions);
+              "options", &::c10d::ProcessGroupNCCL::getOptions)
+          .def(
+              "alltoall_permute",
+              &::c10d::ProcessGroupNCCL::alltoall_permute,
+              py::arg("output"),
+              py::arg("input"),
+              py::arg("permutation"),
+              py::arg("output_split_sizes") = std::vector<int64_t>(),
+              py::arg("input_split_sizes") = std::vector<int64_t>(),
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Fused exchange for expert-parallel layers: gathers the rows of ``input``
+given by ``permutation`` into a packed send buffer and exchanges the
+per-rank splits, with the gather and the grouped NCCL send/recv issued as a
+single collective. Empty split lists mean an equal split across ranks, as in
+``all_to_all_single``.
+)")
+          .def(
+              "_init_comms",
+              [](::c10d::ProcessGroupNCCL& self,
+                 const std::vector<std::vector<int64_t>>& deviceGroups,
+                 bool warmup) {
+                std::vector<std::vector<at::Device>> groups;
+                groups.reserve(deviceGroups.size());
+                for (const auto& deviceIds : deviceGroups) {
+                  std::vector<at::Device> devices;
+                  devices.reserve(deviceIds.size());
+                  for (auto deviceId : deviceIds) {
+                    devices.emplace_back(
+                        at::DeviceType::CUDA,
+                        static_cast<c10::DeviceIndex>(deviceId));
+                  }
+                  groups.push_back(std::move(devices));
+                }
+                self.initComms(groups, warmup);
+              },
+              py::arg("device_groups"),
+              py::arg("warmup") = false,
+              py::call_guard<py::gil_scoped_release>(),
+              R"(
+Eagerly creates and connects the NCCL communicators for the given device
+groups (lists of CUDA device indices) instead of leaving it to the first
+collective, moving connection setup out of the first training step. The
+unique-id exchange through the store is batched across groups. Must be
+called by all ranks with the same ``device_groups``. When ``warmup`` is
+True, additionally runs a one-element allreduce over each group so NCCL
+establishes its rings and channels up front.
+)");
 
   intrusive_ptr_class_<::c10d::ProcessGroupNCCL::Options>(
       processGroupNCCL,
@@ -1435,6 +1624,12 @@ Arguments:
             group to pick up high priority cuda streams. It lets CUDA driver
             to prioritize NCCL kernels when there are compute kernels waiting.
             Default is False.
+    hierarchical_allreduce (bool, optional): flag to run allreduce as a
+            two-level hierarchy (intra-node reduce-scatter, cross-node
+            allreduce, intra-node allgather), reducing inter-node traffic
+            by the number of ranks per node. Node topology is detected
+            automatically and the flat algorithm is used when there is no
+            hierarchy to exploit. Default is False.
 
 Example::
     >>> import torch.distributed as dist
@@ -1446,7 +1641,10 @@ Example::
       .def(py::init<bool>(), py::arg("is_high_priority_stream") = false)
       .def_readwrite(
           "is_high_priority_stream",
-          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream);
+          &::c10d::ProcessGroupNCCL::Options::is_high_priority_stream)
+      .def_readwrite(
+          "hierarchical_allreduce",
+          &::c10d::ProcessGroupNCCL::Options::hierarchical_allreduce);
   processGroupNCCL.def_static(
       "_group_start", []() { ::c10d::ProcessGroupNCCL::groupStart(); });
   processGroupNCCL.def_static(
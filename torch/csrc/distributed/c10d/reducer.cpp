@@ -26,6 +26,41 @@ namespace {
 
 constexpr int kUnsetDivFactor = -1;
 
+// Note [Reduced-dtype buckets]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// With PYTORCH_DDP_COMM_DTYPE=bf16 (or fp16), buckets holding float
+// gradients are allocated in the reduced dtype instead of keeping the
+// gradient dtype. No extra passes over the gradients are introduced:
+// mark_variable_ready_dense already sweeps each gradient once to copy it
+// into its bucket view (fusing the gradient-averaging divide via mul_out),
+// and TensorIterator performs that divide in float before storing in the
+// bucket's dtype, so the downcast rides along for free. The allreduce then
+// moves half the bytes, and copy_bucket_to_grad's copy_ back into the
+// float grads fuses the upcast the same way. Gradients themselves stay in
+// float; only the wire format changes. Incompatible with
+// gradient_as_bucket_view, since a gradient cannot alias a bucket of a
+// different dtype.
+c10::optional<c10::ScalarType> parseGradCommDtype(const char* envVarName) {
+  char* stringValue = std::getenv(envVarName);
+  if (stringValue == nullptr) {
+    return c10::nullopt;
+  }
+  std::string val(stringValue);
+  if (val == "bf16" || val == "bfloat16") {
+    return at::ScalarType::BFloat16;
+  }
+  if (val == "fp16" || val == "float16" || val == "half") {
+    return at::ScalarType::Half;
+  }
+  TORCH_CHECK(
+      false,
+      "Invalid value for environment variable: ",
+      envVarName,
+      " (expected bf16 or fp16, got ",
+      val,
+      ")");
+}
+
 // Macro that wraps TORCH_CHECK with DDP logging.
 #define REDUCER_CHECK(cond, logger_, ...)             \
   if (C10_UNLIKELY_OR_CONST(!(cond))) {               \
@@ -90,6 +125,10 @@ Reducer::Reducer(
       has_marked_unused_parameters_(false),
       find_unused_parameters_(find_unused_parameters),
       gradient_as_bucket_view_(gradient_as_bucket_view),
+      eager_grad_views_(
+          gradient_as_bucket_view &&
+          parseEnvVarFlag("PYTORCH_DDP_EAGER_GRAD_VIEWS")),
+      grad_comm_dtype_(parseGradCommDtype("PYTORCH_DDP_COMM_DTYPE")),
       local_used_map_reduced_(false),
       num_iterations_(0),
       num_buckets_ready_(0),
@@ -104,6 +143,11 @@ Reducer::Reducer(
   C10_LOG_API_USAGE_ONCE("torch.distributed.ddp.reducer");
   TORCH_INTERNAL_ASSERT(
       params_.size() >= 1, "Expected at least one parameter.");
+  TORCH_CHECK(
+      !(grad_comm_dtype_.has_value() && gradient_as_bucket_view_),
+      "PYTORCH_DDP_COMM_DTYPE cannot be combined with "
+      "gradient_as_bucket_view=True: a gradient cannot alias a bucket of a "
+      "different dtype.");
 
   if (ddp_debug_level_ != c10d::DistributedDebugLevel::OFF) {
     LOG(INFO) << "Reducer initialized with bucket_bytes_cap: "
@@ -297,9 +341,16 @@ void Reducer::initialize_local_used_map() {
 void Reducer::check_grad_layout(
     const at::Tensor& grad,
     const at::Tensor& bucket_view) {
-  // Ensure that the gradient type matches the bucket type.
+  // Ensure that the gradient type matches the bucket type, modulo a
+  // configured communication dtype: reduced-dtype buckets hold downcast
+  // copies of float gradients (see Note [Reduced-dtype buckets]).
+  auto expected_options = bucket_view.options();
+  if (grad_comm_dtype_.has_value() &&
+      bucket_view.scalar_type() == *grad_comm_dtype_) {
+    expected_options = expected_options.dtype(at::ScalarType::Float);
+  }
   REDUCER_CHECK(
-      grad.options().type_equal(bucket_view.options()),
+      grad.options().type_equal(expected_options),
       logger_,
       c10::str("Expected ", bucket_view.toString(), ", got ", grad.toString()));
 
@@ -358,7 +409,10 @@ void Reducer::mark_variable_ready_dense(size_t variable_index) {
               at::native::wrapped_scalar_tensor(double(1.) / div_factor_);
           if (!grad.requires_grad()) {
             // Divides while copying into the bucket view to save one scan over
-            // all the input parameters.
+            // all the input parameters. If the bucket is in a reduced
+            // communication dtype, the divide happens in float and the
+            // downcast is fused into the store, still in the same scan (see
+            // Note [Reduced-dtype buckets]).
             at::mul_out(bucket_view, grad, wrapped);
           } else {
             // If DDP is running with create_graph=True, gradients require_grad
@@ -424,6 +478,15 @@ void Reducer::mark_variable_ready_sparse(size_t variable_index) {
         logger_,
         "Expected variable to have sparse gradient.");
 
+    // Embedding-style backward passes produce uncoalesced sparse gradients
+    // whose indices repeat once per occurrence in the batch, and the
+    // allreduce ships indices+values verbatim, duplicated rows included.
+    // Sum up duplicates locally before communicating: the reduced result
+    // is unchanged, and the payload shrinks by the duplication factor.
+    if (!grad.is_coalesced()) {
+      grad = grad.coalesce();
+    }
+
     // Sparse tensors cannot be grouped together with other sparse tensors
     // in a single reduction operation like we can for dense tensors.
     // Therefore, the `offsets` and `lengths` vectors in the bucket replica
@@ -489,6 +552,7 @@ void Reducer::push_rebuilt_params_for_all_indices() {
 void Reducer::push_rebuilt_params(const size_t& index) {
   rebuilt_params_.push_back(params_[index]);
   rebuilt_param_indices_.push_back(index);
+  rebuilt_param_ready_times_.push_back(current_time_in_nanos());
 }
 
 void Reducer::set_divide_factor() {
@@ -1052,7 +1116,14 @@ void Reducer::initialize_buckets(
         offset += length;
       }
 
-      // Allocate bucket contents tensor.
+      // Allocate bucket contents tensor. Float buckets are allocated in the
+      // configured communication dtype, if any; the casts in and out of it
+      // are fused into the bucket copies (see Note [Reduced-dtype buckets]).
+      if (grad_comm_dtype_.has_value() &&
+          c10::typeMetaToScalarType(options.dtype()) ==
+              at::ScalarType::Float) {
+        options = options.dtype(*grad_comm_dtype_);
+      }
       replica.contents = at::empty({static_cast<long>(offset)}, options);
 
       // Note:  "Gradient Layout Contract"
@@ -1158,6 +1229,23 @@ void Reducer::initialize_bucket_views(
           // The grad is modefied and needs to be written back.
           return true;
         }
+        // Note [Eager gradient views]
+        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+        // An undefined grad is normally left alone here (see the comment
+        // above this block). When the user opts into eager gradient views
+        // we hand out a zeroed bucket view right away instead:
+        // AccumulateGrad then accumulates in place into bucket storage and
+        // mark_variable_ready_dense finds the grad already aliasing its
+        // bucket view, so even the first backward pass skips the
+        // grad-to-bucket copy. The trade-off, which is why this is opt-in,
+        // is that globally unused parameters observe a zero gradient
+        // rather than an undefined one.
+        if (eager_grad_views_ && !grad.defined()) {
+          bucket_view.zero_();
+          grad = bucket_view;
+          // The grad is materialized and needs to be written back.
+          return true;
+        }
         // The grad is not modified and does not need to be written back.
         return false;
       });
@@ -1346,10 +1434,18 @@ void Reducer::copy_bucket_to_grad(
     if (!global_unused) {
       if (!grad.defined()) {
         // Creates grad according to the "Gradient Layout Contract"
-        // (see torch/csrc/grad/AccumulateGrad.h)
+        // (see torch/csrc/grad/AccumulateGrad.h). The dense branch of
+        // clone_obey_contract allocates with the variable's options, so a
+        // reduced-dtype bucket view is upcast in its copy; only the
+        // non-dense clone stays in bucket dtype and needs a cast here.
         grad =
             torch::autograd::utils::clone_obey_contract(bucket_view, variable);
+        if (C10_UNLIKELY(grad.scalar_type() != variable.scalar_type())) {
+          grad = grad.to(variable.scalar_type());
+        }
       } else {
+        // When the bucket is in a reduced communication dtype, this copy
+        // also fuses the upcast back to the gradient's dtype.
         grad.copy_(bucket_view);
       }
       // The grad is modified and needs to be written back.
@@ -1648,6 +1744,67 @@ void Reducer::sync_bucket_indices(
   }
 }
 
+// Note [Profile-guided bucket sizing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Rebuilt buckets are ordered by measured gradient arrival, but their sizes
+// are cut by fixed byte caps, so a bucket can straddle a long stretch of the
+// backward pass: its first gradient is ready early while its last gradient
+// (often a straggler) holds up the whole allreduce and kills overlap. When
+// DDP_PROFILE_GUIDED_BUCKETING=1, the per-parameter gradient-ready
+// timestamps recorded during the warmup iteration are used to derive the
+// byte caps instead: the measured backward span is divided into equal time
+// slices (as many as the fixed cap would have produced buckets), and each
+// bucket's cap is the number of bytes that became ready within its slice.
+// Buckets then close in step with gradient production, so every allreduce
+// launches as soon as its slice of the backward pass has finished instead of
+// waiting for a byte threshold that ignores timing.
+std::vector<size_t> Reducer::compute_profiled_bucket_size_limits() const {
+  if (rebuilt_param_ready_times_.size() != rebuilt_params_.size()) {
+    return {};
+  }
+  // Timestamps are recorded in arrival order, so front/back span the
+  // backward pass. A zero span means the parameters were pushed in bulk
+  // (e.g. via push_rebuilt_params_for_all_indices), not measured.
+  const int64_t first_ready = rebuilt_param_ready_times_.front();
+  const int64_t last_ready = rebuilt_param_ready_times_.back();
+  if (last_ready <= first_ready) {
+    return {};
+  }
+
+  int64_t total_bytes = 0;
+  for (const auto& param : rebuilt_params_) {
+    total_bytes += param.numel() * param.element_size();
+  }
+  const int64_t num_buckets =
+      std::max<int64_t>(1, (total_bytes + bucket_bytes_cap_ - 1) / bucket_bytes_cap_);
+  if (num_buckets < 2) {
+    return {};
+  }
+
+  const double slice =
+      static_cast<double>(last_ready - first_ready) / num_buckets;
+  std::vector<size_t> sliced_bytes(num_buckets, 0);
+  for (const auto i : c10::irange(rebuilt_params_.size())) {
+    const auto k = std::min(
+        num_buckets - 1,
+        static_cast<int64_t>(
+            (rebuilt_param_ready_times_[i] - first_ready) / slice));
+    sliced_bytes[k] +=
+        rebuilt_params_[i].numel() * rebuilt_params_[i].element_size();
+  }
+
+  // Slices in which no gradient became ready contribute no bucket; a zero
+  // cap would otherwise split every following parameter into its own bucket.
+  std::vector<size_t> bucket_size_limits;
+  bucket_size_limits.reserve(num_buckets);
+  for (const auto bytes : sliced_bytes) {
+    if (bytes > 0) {
+      bucket_size_limits.push_back(bytes);
+    }
+  }
+  return bucket_size_limits;
+}
+
 bool Reducer::rebuild_buckets() {
   // Ensure reduction for previous backwards pass is finished. If user's model
   // has unused parameters for example, this will raise an error recommending to
@@ -1676,10 +1833,27 @@ bool Reducer::rebuild_buckets() {
           rebuilt_param_indices_.size()));
   std::vector<std::vector<size_t>> rebuilt_bucket_indices;
   std::vector<size_t> bucket_size_limits;
-  bucket_size_limits.push_back(first_bucket_bytes_cap_);
-  bucket_size_limits.push_back(bucket_bytes_cap_);
+  auto ddp_profile_guided_bucketing =
+      (parse_env("DDP_PROFILE_GUIDED_BUCKETING").compare("1") == 0);
+  if (ddp_profile_guided_bucketing) {
+    // See Note [Profile-guided bucket sizing]
+    bucket_size_limits = compute_profiled_bucket_size_limits();
+    if (bucket_size_limits.empty()) {
+      LOG(INFO)
+          << "Profile-guided bucketing requested but no usable gradient "
+          << "timing was recorded; falling back to fixed bucket size caps.";
+    }
+  }
+  const bool using_profiled_limits = !bucket_size_limits.empty();
+  if (!using_profiled_limits) {
+    bucket_size_limits.push_back(first_bucket_bytes_cap_);
+    bucket_size_limits.push_back(bucket_bytes_cap_);
+  }
   std::vector<size_t> per_bucket_size_limits;
-  auto ddp_set_last_bucket_as_small =
+  // The profiled limits are keyed to gradient arrival order, so the
+  // last-bucket reversal below would misalign them; the two modes are
+  // mutually exclusive.
+  auto ddp_set_last_bucket_as_small = !using_profiled_limits &&
       (parse_env("DDP_SET_LAST_BUCKET_CAP").compare("1") == 0);
 
   if (ddp_set_last_bucket_as_small) {
@@ -1723,6 +1897,7 @@ bool Reducer::rebuild_buckets() {
   has_rebuilt_bucket_ = true;
   rebuilt_params_.clear();
   rebuilt_param_indices_.clear();
+  rebuilt_param_ready_times_.clear();
 
   initialize_buckets(
       std::move(rebuilt_bucket_indices), std::move(per_bucket_size_limits));
@@ -1759,6 +1934,11 @@ void Reducer::register_builtin_comm_hook(
           std::make_unique<c10d::FP16CompressCommHook>(process_group_.get());
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::POWER_SGD:
+      comm_hook_ =
+          std::make_unique<c10d::PowerSGDCommHook>(process_group_.get());
+      LOG(INFO) << "Built-in communication hook POWER_SGD is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
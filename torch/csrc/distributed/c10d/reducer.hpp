@@ -237,6 +237,13 @@ class TORCH_API Reducer {
 
   void push_rebuilt_params(const size_t& index);
 
+  // Derives per-bucket size limits from the gradient-ready timestamps
+  // recorded during the warmup iteration. Returns an empty vector when the
+  // recorded timing is unusable (e.g. all parameters were pushed at once),
+  // in which case the caller falls back to the fixed byte caps.
+  // See Note [Profile-guided bucket sizing].
+  std::vector<size_t> compute_profiled_bucket_size_limits() const;
+
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   mutable std::mutex mutex_;
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
@@ -266,6 +273,20 @@ class TORCH_API Reducer {
   const bool find_unused_parameters_;
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   const bool gradient_as_bucket_view_;
+  // Opt-in refinement of gradient_as_bucket_view_, enabled by setting
+  // PYTORCH_DDP_EAGER_GRAD_VIEWS=1 together with gradient_as_bucket_view.
+  // Materializes each dense parameter's .grad as a zeroed view into its
+  // bucket when buckets are (re)initialized, so even the first backward
+  // pass accumulates directly into bucket storage and never pays the
+  // grad-to-bucket copy. See Note [Eager gradient views].
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  const bool eager_grad_views_;
+  // Reduced dtype that float gradient buckets are communicated in, set via
+  // PYTORCH_DDP_COMM_DTYPE=bf16 (or fp16). The downcast is fused into the
+  // bucket copy-in, the allreduce moves half the bytes, and the upcast is
+  // fused into the copy back into grads. See Note [Reduced-dtype buckets].
+  // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
+  const c10::optional<c10::ScalarType> grad_comm_dtype_;
   // NOLINTNEXTLINE(cppcoreguidelines-non-private-member-variables-in-classes)
   std::vector<size_t> unused_parameters_;
   // Previous iteration's unused params, used for checking if unused parameters
@@ -498,6 +519,10 @@ class TORCH_API Reducer {
   bool has_rebuilt_bucket_;
   std::vector<at::Tensor> rebuilt_params_;
   std::vector<int64_t> rebuilt_param_indices_;
+  // Gradient-ready timestamps (nanoseconds) recorded when the corresponding
+  // entries of rebuilt_params_ were pushed. Only consumed by the
+  // profile-guided bucketing mode. See Note [Profile-guided bucket sizing].
+  std::vector<int64_t> rebuilt_param_ready_times_;
   const int64_t bucket_bytes_cap_;
 
 #ifndef _WIN32
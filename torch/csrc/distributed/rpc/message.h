@@ -84,6 +84,10 @@ enum MessageType {
   RREF_BACKWARD_REQ = 0x17 | MessageTypeFlags::REQUEST_TYPE,
   RREF_BACKWARD_RESP = 0x18 | MessageTypeFlags::RESPONSE_TYPE,
 
+  // Message carrying several coalesced gradient propagations between the
+  // same pair of workers. Answered with BACKWARD_AUTOGRAD_RESP.
+  BACKWARD_AUTOGRAD_BATCH_REQ = 0x19 | MessageTypeFlags::REQUEST_TYPE,
+
   // Other internal message types
   EXCEPTION = 0x37 | MessageTypeFlags::RESPONSE_TYPE,
   UNKNOWN = 0x3c
@@ -5,6 +5,7 @@
 #include <torch/csrc/distributed/autograd/engine/dist_engine.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/cleanup_autograd_context_req.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/cleanup_autograd_context_resp.h>
+#include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_batch_req.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_req.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/propagate_gradients_resp.h>
 #include <torch/csrc/distributed/autograd/rpc_messages/rpc_with_autograd.h>
@@ -388,6 +389,61 @@ c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
       c10::getCustomClassType<c10::intrusive_ptr<Message>>());
 }
 
+c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
+    processBackwardAutogradBatchReq(
+        RpcCommandBase& rpc,
+        std::vector<c10::Stream> streams) const {
+  c10::MultiStreamGuard guard(streams);
+  auto& batchCall = static_cast<PropagateGradientsBatchReq&>(rpc);
+
+  // Kick off one engine execution per folded propagation, exactly as if each
+  // entry had arrived in its own BACKWARD_AUTOGRAD_REQ.
+  std::vector<c10::intrusive_ptr<JitFuture>> execFutures;
+  execFutures.reserve(batchCall.getEntries().size());
+  for (const auto& entry : batchCall.getEntries()) {
+    const auto& autogradMetadata = entry.autogradMetadata;
+
+    auto autogradContext = DistAutogradContainer::getInstance().retrieveContext(
+        autogradMetadata.autogradContextId);
+
+    std::shared_ptr<SendRpcBackward> sendFunction =
+        autogradContext->retrieveSendFunction(
+            autogradMetadata.autogradMessageId);
+
+    sendFunction->setGrads(entry.grads);
+
+    execFutures.emplace_back(DistEngine::getInstance().executeSendFunctionAsync(
+        autogradContext, sendFunction, entry.retainGraph));
+  }
+  TORCH_INTERNAL_ASSERT(
+      !execFutures.empty(), "Received an empty gradient batch");
+
+  // Respond once all the executions have finished, propagating the first
+  // error if any of them failed.
+  auto responseFuture = c10::make_intrusive<JitFuture>(
+      c10::getCustomClassType<c10::intrusive_ptr<Message>>());
+  struct State {
+    std::atomic<int32_t> remaining{0};
+    std::atomic<bool> alreadySentError{false};
+  };
+  auto state = std::make_shared<State>();
+  state->remaining = execFutures.size();
+  for (const auto& execFuture : execFutures) {
+    execFuture->addCallback([state, responseFuture](JitFuture& future) {
+      if (future.hasError() && !state->alreadySentError.exchange(true)) {
+        responseFuture->setError(future.exception_ptr());
+      }
+      if (state->remaining.fetch_sub(1) == 1 && !state->alreadySentError) {
+        auto withStorage = withStorages(PropagateGradientsResp().toMessage());
+        responseFuture->markCompleted(
+            IValue(std::get<0>(withStorage)),
+            std::move(std::get<1>(withStorage)));
+      }
+    });
+  }
+  return responseFuture;
+}
+
 c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
     processCleanupAutogradContextReq(RpcCommandBase& rpc) const {
   auto& cleanupContextReq = static_cast<CleanupAutogradContextReq&>(rpc);
@@ -536,6 +592,9 @@ c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::processRpc(
     case MessageType::BACKWARD_AUTOGRAD_REQ: {
       return processBackwardAutogradReq(rpc, std::move(streams));
     };
+    case MessageType::BACKWARD_AUTOGRAD_BATCH_REQ: {
+      return processBackwardAutogradBatchReq(rpc, std::move(streams));
+    };
     case MessageType::CLEANUP_AUTOGRAD_CONTEXT_REQ: {
       return processCleanupAutogradContextReq(rpc);
     }
@@ -69,6 +69,10 @@ class TORCH_API RequestCallbackNoPython : public RequestCallback {
       RpcCommandBase& rpc,
       std::vector<c10::Stream> streams) const;
 
+  c10::intrusive_ptr<JitFuture> processBackwardAutogradBatchReq(
+      RpcCommandBase& rpc,
+      std::vector<c10::Stream> streams) const;
+
   c10::intrusive_ptr<JitFuture> processCleanupAutogradContextReq(
       RpcCommandBase& rpc) const;
 
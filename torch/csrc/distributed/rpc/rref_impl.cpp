@@ -1,5 +1,6 @@
 #include <torch/csrc/distributed/rpc/rref_impl.h>
 
+#include <ATen/ThreadLocalState.h>
 #include <ATen/record_function.h>
 #include <c10/core/impl/DeviceGuardImplInterface.h>
 #include <fmt/format.h>
@@ -144,6 +145,27 @@ IValue UserRRef::toHere(const float timeoutSeconds) const {
         RpcAgent::getCurrentRpcAgent()->getWorkerInfo(ownerId_).name_);
   }
   RECORD_USER_SCOPE(toHereKey);
+
+  auto valueFuture = toHereAsync(timeoutSeconds);
+
+  // TODO: we should ideally be able to interrupt this blocking wait if we check
+  // getTimedOut() and it is true
+  // (https://github.com/pytorch/pytorch/issues/39411).
+  valueFuture->waitAndThrow();
+  return valueFuture->constValue();
+}
+
+c10::intrusive_ptr<JitFuture> UserRRef::toHereAsync(
+    const float timeoutSeconds) const {
+  TORCH_CHECK(
+      !getTimedOut(),
+      "RRef creation via rpc.remote() timed out, and it "
+      "is possible that the RRef on the owner node does not exist.");
+  // see Note [Best-Effort Check on Deleted UserRRefs]
+  TORCH_CHECK(
+      !deletedOnOwner_,
+      *this,
+      " has been deleted. Cannot call to_here() on it after deletion.");
   TORCH_CHECK(
       !type_->is_module(),
       *this,
@@ -179,27 +201,36 @@ IValue UserRRef::toHere(const float timeoutSeconds) const {
       timeoutSeconds,
       true /* forceDisableProfiling */);
 
-  // TODO: we should ideally be able to interrupt this blocking wait if we check
-  // getTimedOut() and it is true
-  // (https://github.com/pytorch/pytorch/issues/39411).
-  jitFuture->waitAndThrow();
-  auto messagePtr = jitFuture->constValue().toCustomClass<Message>();
-  MessageType msgType = messagePtr->type();
-  auto response = deserializeResponse(*messagePtr, msgType);
-  TORCH_INTERNAL_ASSERT(
-      msgType == MessageType::SCRIPT_RREF_FETCH_RET ||
-          msgType == MessageType::PYTHON_RREF_FETCH_RET,
-      "Message type should either be SCRIPT_RREF_FETCH_RET "
-      "or PYTHON_RREF_FETCH_RET");
-  RpcCommandBase& rpc = *response;
-  auto& rrefFetchRet = static_cast<RRefFetchRet&>(rpc);
-  if (isPyObj()) {
-    // wrap python serialized vector of ivalues into tuple, this
-    // made the C++ toHere interface to return single IValue
-    return ivalue::Tuple::create(rrefFetchRet.values());
-  } else {
-    return rrefFetchRet.values().front();
-  }
+  const bool isPy = isPyObj();
+  auto valueFuture = jitFuture->createInstance(
+      isPy ? c10::TypePtr(c10::AnyType::get()) : type_);
+  jitFuture->addCallback(
+      at::wrapPropagateTLSState([valueFuture, isPy](JitFuture& future) {
+        if (future.hasError()) {
+          valueFuture->setError(future.exception_ptr());
+          return;
+        }
+        auto messagePtr = future.constValue().toCustomClass<Message>();
+        MessageType msgType = messagePtr->type();
+        auto response = deserializeResponse(*messagePtr, msgType);
+        TORCH_INTERNAL_ASSERT(
+            msgType == MessageType::SCRIPT_RREF_FETCH_RET ||
+                msgType == MessageType::PYTHON_RREF_FETCH_RET,
+            "Message type should either be SCRIPT_RREF_FETCH_RET "
+            "or PYTHON_RREF_FETCH_RET");
+        RpcCommandBase& rpc = *response;
+        auto& rrefFetchRet = static_cast<RRefFetchRet&>(rpc);
+        if (isPy) {
+          // wrap python serialized vector of ivalues into tuple, this
+          // made the C++ toHere interface to return single IValue
+          valueFuture->markCompleted(
+              ivalue::Tuple::create(rrefFetchRet.values()), future.storages());
+        } else {
+          valueFuture->markCompleted(
+              rrefFetchRet.values().front(), future.storages());
+        }
+      }));
+  return valueFuture;
 }
 
 RRefForkData UserRRef::fork() const {
@@ -315,6 +315,16 @@ class TORCH_API UserRRef final : public RRef {
       const float timeoutSeconds =
           torch::distributed::rpc::kUnsetRpcTimeout) const;
 
+  // Asynchronous version of toHere(). Sends the fetch message and returns a
+  // Future that completes with the value (or the error) once the owner's
+  // response arrives. Callers fetching many RRefs should issue all fetches
+  // through this API before waiting, so the round trips overlap instead of
+  // serializing. Unlike toHere(), this does not emit a profiler record; the
+  // call site owns the scope that covers the eventual wait.
+  c10::intrusive_ptr<JitFuture> toHereAsync(
+      const float timeoutSeconds =
+          torch::distributed::rpc::kUnsetRpcTimeout) const;
+
   void tryDel() override;
 
   // Will be called when refcount reaches 0.
@@ -44,6 +44,15 @@ std::unique_ptr<ChannelRegistration> makeCudaGdrChannel() {
 // in order to ensure readiness and to agree on the device indices and thus the
 // queue pair to use. It automatically pairs each GPU to the "closest" NIC if
 // there are multiple of them (closest = longest prefix match in PCI tree).
+//
+// Note that the registration cache only pays off if the tensors being sent
+// and received live in stable memory. Both directions get this for free when
+// the CUDACachingAllocator is in use: it hands out blocks carved from
+// long-lived cudaMalloc'd segments, so after warmup the same registered
+// regions are hit over and over and steady-state transfers involve no copy
+// and no new registration. Calling emptyCache(), or allocating tensors
+// outside the caching allocator, releases/bypasses those segments and forces
+// the channel to re-register on the next send.
 C10_REGISTER_CREATOR(TensorPipeChannelRegistry, cuda_gdr, makeCudaGdrChannel);
 
 #endif
@@ -73,6 +73,41 @@ struct TORCH_API Method : public torch::IMethod {
   Function* function_;
 };
 
+// A method bound to its owning module with all per-call resolution hoisted
+// out of the hot path, for serving loops that invoke the same method at high
+// rates. Method::operator() re-resolves the function, normalizes inputs
+// against the schema, and takes the executor's plan lock on every call; a
+// BoundMethod resolves the function and executor once at construction,
+// reuses one preallocated stack frame call-to-call, and, once the executor
+// has settled on its optimized plan, runs that plan's code directly.
+//
+// The trade-offs relative to Method:
+//  - inputs are positional only and must already match the schema (no
+//    kwargs, no default filling);
+//  - the reused frame makes a BoundMethod NOT thread-safe; create one per
+//    serving thread instead of sharing;
+//  - the cached plan lives as long as the function's executor, so don't
+//    hold a BoundMethod across debugFlushCompilationCache().
+struct TORCH_API BoundMethod {
+  BoundMethod(ObjectPtr owner, Function* function);
+
+  IValue operator()(std::vector<IValue> inputs);
+
+  const std::string& name() const {
+    return function_->name();
+  }
+
+ private:
+  ObjectPtr owner_;
+  Function* function_;
+  GraphExecutor* executor_;
+  const ExecutionPlan* plan_{nullptr};
+  size_t num_inputs_;
+  // Reused across calls so the frame (and the interpreter registers pushed
+  // onto it) stop allocating after the first call.
+  Stack frame_;
+};
+
 namespace script {
 // We once had a `script::` namespace that was deleted. This is for backcompat
 // of the public API; new code should not use this type alias.
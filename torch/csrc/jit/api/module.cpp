@@ -15,6 +15,7 @@
 #include <torch/csrc/jit/passes/frozen_graph_optimizations.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
 #include <torch/csrc/jit/passes/inliner.h>
+#include <torch/csrc/jit/runtime/cuda_graph_executor.h>
 #include <torch/csrc/jit/runtime/operator.h>
 
 namespace torch {
@@ -218,6 +219,45 @@ c10::intrusive_ptr<c10::ivalue::Future> Method::run_async(
   return function_->runAsync(stack, std::move(taskLauncher));
 }
 
+BoundMethod::BoundMethod(ObjectPtr owner, Function* function)
+    : owner_(std::move(owner)), function_(function) {
+  function_->ensure_defined();
+  executor_ = &function_->get_executor();
+  num_inputs_ = function_->num_inputs();
+}
+
+IValue BoundMethod::operator()(std::vector<IValue> inputs) {
+  TORCH_CHECK(
+      inputs.size() + 1 == num_inputs_,
+      "Method '",
+      name(),
+      "' expected ",
+      num_inputs_ - 1,
+      " inputs, but got ",
+      inputs.size());
+  frame_.clear();
+  frame_.emplace_back(owner_); // self
+  for (auto& input : inputs) {
+    frame_.emplace_back(std::move(input));
+  }
+  RECORD_TORCHSCRIPT_FUNCTION(name(), frame_);
+  if (C10_UNLIKELY(plan_ == nullptr)) {
+    // While the executor is still profiling, drive it normally so
+    // specialization proceeds; adopt its plan once it reports optimized.
+    // CUDA graphs mode and shape-bucketed executors route through run()
+    // permanently, since their plan selection is per-call.
+    if (executor_->isOptimized() && !getGraphExecutorCudaGraphsMode()) {
+      plan_ = &executor_->getPlanFor(
+          frame_, GraphExecutor::getDefaultNumBailOuts());
+    } else {
+      executor_->run(frame_);
+      return std::move(frame_.front());
+    }
+  }
+  InterpreterState(plan_->code).run(frame_);
+  return std::move(frame_.front());
+}
+
 void Method::setArgumentNames(
     std::vector<std::string>& argumentNamesOut) const {
   TORCH_INTERNAL_ASSERT(function_);
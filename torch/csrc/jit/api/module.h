@@ -115,6 +115,13 @@ struct TORCH_API Module : public Object {
     return get_method("forward")(std::move(inputs), kwargs);
   }
 
+  // Returns a fast positional-only handle to a method that skips per-call
+  // name lookup, schema normalization, and executor state checks. See the
+  // BoundMethod docs in method.h for its restrictions.
+  BoundMethod get_bound_method(const std::string& name) const {
+    return BoundMethod(_ivalue(), &get_method(name).function());
+  }
+
   // In script modules, buffers are Tensors attribute that are _not_ registered
   // as parameters. This is different than in nn.Module where there is a special
   // register_buffer method. With this simplification, we only need to track
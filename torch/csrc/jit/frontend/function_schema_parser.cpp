@@ -6,8 +6,14 @@
 #include <torch/csrc/jit/frontend/parse_string_literal.h>
 #include <torch/csrc/jit/frontend/schema_type_parser.h>
 
+#include <cstdlib>
+#include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 using at::TypeKind;
@@ -324,16 +330,90 @@ struct SchemaParser {
 };
 } // namespace
 
+namespace {
+
+// Note [Schema parse cache]
+// Parsing a schema string is pure, but identical strings are re-parsed over
+// and over: every module load runs the parser on schemas that some earlier
+// load (or operator registration) already parsed. parseSchema therefore
+// memoizes its result process-wide, keyed on the raw string, and returns a
+// copy of the cached FunctionSchema, which is much cheaper than a parse.
+// Lookups take a shared lock, so concurrent loads only contend on a cache
+// miss. If TORCH_SCHEMA_CACHE_FILE names a newline-separated schema registry
+// (as written by a previous run, one declaration per line), it is parsed
+// once to warm the cache before the first lookup, moving that work ahead of
+// the first module load.
+class SchemaParseCache {
+ public:
+  static SchemaParseCache& get() {
+    static SchemaParseCache cache;
+    return cache;
+  }
+
+  c10::optional<FunctionSchema> find(const std::string& schema) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto it = map_.find(schema);
+    if (it == map_.end()) {
+      return c10::nullopt;
+    }
+    return it->second;
+  }
+
+  void insert(const std::string& schema, const FunctionSchema& parsed) {
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+    map_.emplace(schema, parsed);
+  }
+
+ private:
+  SchemaParseCache() {
+    const char* path = std::getenv("TORCH_SCHEMA_CACHE_FILE");
+    if (path == nullptr) {
+      return;
+    }
+    std::ifstream registry(path);
+    if (!registry) {
+      TORCH_WARN("Could not open schema registry '", path, "', skipping");
+      return;
+    }
+    std::string line;
+    while (std::getline(registry, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      try {
+        auto parsed = SchemaParser(line).parseExactlyOneDeclaration();
+        if (parsed.is_right()) {
+          map_.emplace(line, std::move(parsed.right()));
+        }
+      } catch (const std::exception& e) {
+        TORCH_WARN(
+            "Skipping unparseable schema registry entry '", line, "'");
+      }
+    }
+  }
+
+  std::shared_timed_mutex mutex_;
+  std::unordered_map<std::string, FunctionSchema> map_;
+};
+
+} // namespace
+
 C10_EXPORT either<OperatorName, FunctionSchema> parseSchemaOrName(
     const std::string& schemaOrName) {
   return SchemaParser(schemaOrName).parseExactlyOneDeclaration();
 }
 
 C10_EXPORT FunctionSchema parseSchema(const std::string& schema) {
+  // See Note [Schema parse cache]
+  auto& cache = SchemaParseCache::get();
+  if (auto cached = cache.find(schema)) {
+    return std::move(*cached);
+  }
   auto parsed = parseSchemaOrName(schema);
   TORCH_CHECK(
       parsed.is_right(),
       "Tried to parse a function schema but only the operator name was given");
+  cache.insert(schema, parsed.right());
   return std::move(parsed.right());
 }
 
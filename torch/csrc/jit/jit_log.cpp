@@ -50,7 +50,10 @@ class JitLoggingConfig {
     parse();
   }
 
-  std::unordered_map<std::string, size_t> getFilesToLevels() {
+  // Returned by reference: is_enabled() runs for every JIT_LOG site even
+  // when logging is completely disabled, so the guard must not copy the map
+  // (or allocate at all) just to find out that nothing is enabled.
+  const std::unordered_map<std::string, size_t>& getFilesToLevels() const {
     return this->files_to_levels;
   }
 
@@ -112,7 +115,7 @@ void JitLoggingConfig::parse() {
 }
 
 bool is_enabled(const char* cfname, JitLoggingLevels level) {
-  const std::unordered_map<std::string, size_t> files_to_levels =
+  const std::unordered_map<std::string, size_t>& files_to_levels =
       JitLoggingConfig::getInstance().getFilesToLevels();
   std::string fname{cfname};
   fname = c10::detail::StripBasename(fname);
@@ -0,0 +1,119 @@
+#include <torch/csrc/jit/jit_pass_timing.h>
+
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+std::atomic<bool> pass_timing_enabled{[]() {
+  const char* env = std::getenv("PYTORCH_JIT_PASS_TIMING");
+  return env && env[0] == '1';
+}()};
+
+// Guards the event vector and the generation counter. Pass timing is a
+// debugging surface; compilations already serialize on their executor's
+// compile_mutex, so a single global mutex here is not a bottleneck.
+std::mutex pass_timing_mutex;
+std::vector<PassTimingEvent> pass_timing_events;
+// Bumped by clearPassTimingEvents so guards that were live across a clear
+// don't write through stale indices.
+uint64_t pass_timing_generation = 0;
+
+// Nesting depth of the current thread's active guards.
+thread_local uint32_t pass_timing_depth = 0;
+
+uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+int64_t countNodes(const Block* block) {
+  int64_t count = 0;
+  for (const Node* node : block->nodes()) {
+    count++;
+    for (const Block* inner : node->blocks()) {
+      count += countNodes(inner);
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+bool passTimingEnabled() {
+  return pass_timing_enabled.load(std::memory_order_relaxed);
+}
+
+void setPassTimingEnabled(bool enabled) {
+  pass_timing_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<PassTimingEvent> getPassTimingEvents() {
+  std::lock_guard<std::mutex> lock(pass_timing_mutex);
+  return pass_timing_events;
+}
+
+void clearPassTimingEvents() {
+  std::lock_guard<std::mutex> lock(pass_timing_mutex);
+  pass_timing_events.clear();
+  pass_timing_generation++;
+}
+
+void dumpPassTimingReport(std::ostream& out) {
+  auto events = getPassTimingEvents();
+  out << "JIT pass timing report (" << events.size() << " events)\n";
+  for (const auto& event : events) {
+    out << std::string(static_cast<size_t>(event.depth) * 2, ' ') << event.name
+        << ": " << event.duration_us << "us, " << event.nodes_before
+        << " -> " << event.nodes_after << " nodes\n";
+  }
+}
+
+PassTimingGuard::PassTimingGuard(const char* name, const Graph& graph) {
+  if (!passTimingEnabled()) {
+    return;
+  }
+  active_ = true;
+  graph_ = &graph;
+  start_ns_ = nowNs();
+  PassTimingEvent event;
+  event.name = name;
+  event.depth = pass_timing_depth++;
+  event.start_us = start_ns_ / 1000;
+  event.duration_us = 0;
+  event.nodes_before = countNodes(graph.block());
+  event.nodes_after = event.nodes_before;
+  std::lock_guard<std::mutex> lock(pass_timing_mutex);
+  event_index_ = pass_timing_events.size();
+  generation_ = pass_timing_generation;
+  pass_timing_events.emplace_back(std::move(event));
+}
+
+PassTimingGuard::~PassTimingGuard() {
+  if (!active_) {
+    return;
+  }
+  pass_timing_depth--;
+  const uint64_t duration_us = (nowNs() - start_ns_) / 1000;
+  const int64_t nodes_after = countNodes(graph_->block());
+  std::lock_guard<std::mutex> lock(pass_timing_mutex);
+  if (generation_ != pass_timing_generation ||
+      event_index_ >= pass_timing_events.size()) {
+    // the event buffer was cleared while this pass was running
+    return;
+  }
+  auto& event = pass_timing_events[event_index_];
+  event.duration_us = duration_us;
+  event.nodes_after = nodes_after;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,73 @@
+#pragma once
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// `TorchScript` offers a structured pass-timing surface for attributing JIT
+// warmup latency to individual optimization passes. It can be enabled by
+// setting the environment variable `PYTORCH_JIT_PASS_TIMING=1` or by calling
+// `setPassTimingEnabled(true)`.
+
+// While enabled, every pass invocation wrapped in `JIT_TIMED_PASS` records a
+// `PassTimingEvent` carrying the pass name, wall-clock duration and the graph
+// node count before/after the pass. Pipeline functions record an enclosing
+// event, so the event stream forms a preorder walk of the pass tree and can
+// be rendered as a flame-style report with `dumpPassTimingReport`.
+
+// Events accumulate across compilations until `clearPassTimingEvents` is
+// called; query them programmatically with `getPassTimingEvents` or from
+// Python via `torch._C._jit_get_pass_timing_events()`.
+
+// When timing is disabled the guard is a cheap no-op (one relaxed atomic
+// load), so `JIT_TIMED_PASS` is safe to leave on hot compilation paths.
+
+namespace torch {
+namespace jit {
+
+struct Graph;
+
+struct PassTimingEvent {
+  std::string name;
+  // Nesting depth; pipeline-level events enclose the passes they run.
+  uint32_t depth;
+  // Start time relative to a process-local steady clock.
+  uint64_t start_us;
+  uint64_t duration_us;
+  int64_t nodes_before;
+  int64_t nodes_after;
+};
+
+TORCH_API bool passTimingEnabled();
+TORCH_API void setPassTimingEnabled(bool enabled);
+
+TORCH_API std::vector<PassTimingEvent> getPassTimingEvents();
+TORCH_API void clearPassTimingEvents();
+
+// Writes an indented, flame-style report: one line per event in preorder,
+// children indented below the pipeline that ran them.
+TORCH_API void dumpPassTimingReport(std::ostream& out);
+
+struct TORCH_API PassTimingGuard {
+  PassTimingGuard(const char* name, const Graph& graph);
+  ~PassTimingGuard();
+  PassTimingGuard(const PassTimingGuard&) = delete;
+  PassTimingGuard& operator=(const PassTimingGuard&) = delete;
+
+ private:
+  const Graph* graph_ = nullptr;
+  size_t event_index_ = 0;
+  uint64_t generation_ = 0;
+  uint64_t start_ns_ = 0;
+  bool active_ = false;
+};
+
+#define JIT_TIMED_PASS(NAME, GRAPH, ...)                             \
+  {                                                                  \
+    ::torch::jit::PassTimingGuard pass_timing_guard((NAME), (GRAPH)); \
+    __VA_ARGS__;                                                     \
+  }
+
+} // namespace jit
+} // namespace torch
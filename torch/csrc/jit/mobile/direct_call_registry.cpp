@@ -0,0 +1,34 @@
+#include <torch/csrc/jit/mobile/direct_call_registry.h>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+std::unordered_map<std::string, std::function<void(Stack&)>>&
+directCallFnTable() {
+  static std::unordered_map<std::string, std::function<void(Stack&)>>
+      direct_call_fn;
+  return direct_call_fn;
+}
+
+void registerDirectCallFunction(
+    const std::string& name,
+    const std::function<void(Stack&)>& fn) {
+  directCallFnTable()[name] = fn;
+}
+
+bool hasDirectCallFn(const std::string& name) {
+  return directCallFnTable().count(name);
+}
+
+std::function<void(Stack&)>& getDirectCallFn(const std::string& name) {
+  TORCH_CHECK(
+      hasDirectCallFn(name),
+      "No direct call stub is registered for operator ",
+      name);
+  return directCallFnTable()[name];
+}
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <ATen/core/ivalue.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace jit {
+namespace mobile {
+
+using Stack = std::vector<c10::IValue>;
+
+// Table of codegenerated unboxed call stubs, keyed by the operator's
+// qualified name including the overload (e.g. "aten::add.Tensor"). The
+// stubs are emitted by tools/codegen/gen_mobile_direct_calls.py for the
+// selective build operator list and registered at static initialization
+// time; Function::append_operator consults the table when binding an
+// operator into mobile Code, so matching op calls become a direct
+// unboxed function call instead of a boxed dispatcher round trip.
+
+void registerDirectCallFunction(
+    const std::string& name,
+    const std::function<void(Stack&)>& fn);
+
+bool hasDirectCallFn(const std::string& name);
+
+std::function<void(Stack&)>& getDirectCallFn(const std::string& name);
+
+class direct_call_fn_register {
+ public:
+  direct_call_fn_register(
+      const std::string& name,
+      const std::function<void(Stack&)>& fn) {
+    registerDirectCallFunction(name, fn);
+  }
+};
+
+} // namespace mobile
+} // namespace jit
+} // namespace torch
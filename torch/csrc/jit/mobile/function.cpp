@@ -1,4 +1,5 @@
 #include <caffe2/serialize/inline_container.h>
+#include <torch/csrc/jit/mobile/direct_call_registry.h>
 #include <torch/csrc/jit/mobile/function.h>
 #include <torch/csrc/jit/mobile/interpreter.h>
 #include <torch/csrc/jit/mobile/prim_ops_registery.h>
@@ -55,10 +56,28 @@ bool Function::append_operator(
   bool promoted_op = mobile::hasPrimOpsFn(full_name);
   if (promoted_op) {
     fn = mobile::getPrimOpsFn(full_name);
+  } else if (mobile::hasDirectCallFn(full_name)) {
+    // A codegenerated selective-build stub: a direct unboxed call into the
+    // at:: API with no IValue boxing and no boxed dispatcher round trip.
+    // See tools/codegen/gen_mobile_direct_calls.py. The schema is still
+    // needed below for default-argument backfill.
+    fn = mobile::getDirectCallFn(full_name);
+    auto op = c10::Dispatcher::singleton().findSchema(opname);
+    TORCH_CHECK(
+        op.has_value() && op->hasSchema(),
+        "a direct call stub is registered for operator ",
+        full_name,
+        ", but its schema is not");
+    pArgs = &op->schema().arguments();
   } else {
     std::shared_ptr<Operator> jit_op = findOperatorFor(opname);
     if (jit_op) {
-      fn = [jit_op](Stack& stack) { jit_op->getOperation()(stack); };
+      // Resolve the Operation once at load time. Calling getOperation() per
+      // invocation copies a std::function and thus heap-allocates on every
+      // op call; the operator itself is captured to keep it registered.
+      fn = [jit_op, op_fn = jit_op->getOperation()](Stack& stack) {
+        op_fn(stack);
+      };
       pArgs = &jit_op->schema().arguments();
     } else {
       auto op = c10::Dispatcher::singleton().findSchema(opname);
@@ -94,36 +113,41 @@ bool Function::append_operator(
       // from model. We can use it to handle backward compatibility.
       if (num_specified_args &&
           num_specified_args.value() < static_cast<int64_t>(args.size())) {
-        fn = [fn, num_specified_args, args](Stack& stack) {
-          std::vector<IValue> out_args;
-          // The following logic pops and temporarily stores all out arguments
-          // from the stack (which can be 0 or more, and always appended to the
-          // schema), in order to push the necessary default values. Finally,
-          // the out arguments are pushed back into the stack.
-          for (size_t i = args.size() - 1; i > 0 && args.at(i).is_out(); i--) {
-            out_args.push_back(stack.back());
-            stack.pop_back();
-          }
-          size_t start_index = num_specified_args.value() - out_args.size();
+        // The default values that have to be filled in before the out
+        // arguments (which can be 0 or more, and always appended to the
+        // schema) only depend on the schema, so materialize them here once
+        // instead of on every call.
+        size_t num_out_args = 0;
+        for (size_t i = args.size() - 1; i > 0 && args.at(i).is_out(); i--) {
+          num_out_args++;
+        }
+        const int64_t start_index = num_specified_args.value() - num_out_args;
+        TORCH_CHECK(
+            start_index >= 0,
+            "The number of output arguments is: ",
+            num_out_args,
+            ", which is more then the number of specified arguments: ",
+            num_specified_args.value());
+        std::vector<IValue> default_args;
+        for (size_t i = start_index; i < (args.size() - num_out_args); ++i) {
           TORCH_CHECK(
-              start_index >= 0,
-              "The number of output arguments is: ",
-              out_args.size(),
-              ", which is more then the number of specified arguments: ",
-              num_specified_args.value());
-          for (size_t i = start_index; i < (args.size() - out_args.size());
-               ++i) {
-            TORCH_CHECK(
-                args[i].default_value().has_value(),
-                "Error happened at preparing for default values for the argument. The ",
-                i,
-                "th argument ",
-                args[i].name(),
-                " does not have a specified value or default value. ");
-
-            stack.push_back(args[i].default_value());
-          }
-          stack.insert(stack.end(), out_args.rbegin(), out_args.rend());
+              args[i].default_value().has_value(),
+              "Error happened at preparing for default values for the argument. The ",
+              i,
+              "th argument ",
+              args[i].name(),
+              " does not have a specified value or default value. ");
+
+          default_args.push_back(*args[i].default_value());
+        }
+        fn = [fn, default_args, num_out_args](Stack& stack) {
+          // Splice the defaults in right before the out arguments; inserting
+          // in place avoids popping the out arguments into a temporary
+          // vector on every call.
+          stack.insert(
+              stack.end() - num_out_args,
+              default_args.begin(),
+              default_args.end());
           fn(stack);
         };
       }
@@ -18,10 +18,42 @@ namespace jit {
 char const* toString(OpCode op);
 std::ostream& operator<<(std::ostream& out, Instruction inst);
 namespace mobile {
+namespace {
+// Note [Reusing interpreter buffers]
+// An InterpreterState is created for every method invocation, and its
+// register and frame vectors would otherwise be heap-allocated on every
+// call. On mobile that per-inference allocation churn is visible as jank,
+// so the storage is handed back to a thread-local cache on destruction and
+// picked up again by the next InterpreterState on the same thread. Nested
+// invocations simply miss the (empty) cache and allocate; the outermost
+// state's buffers are the ones that get reused.
+std::vector<c10::IValue>& cachedRegisters() {
+  static thread_local std::vector<c10::IValue> registers;
+  return registers;
+}
+
+std::vector<Frame>& cachedFrames() {
+  static thread_local std::vector<Frame> frames;
+  return frames;
+}
+} // namespace
+
 InterpreterState::InterpreterState(const Code& code) {
+  registers_ = std::move(cachedRegisters());
+  frames_ = std::move(cachedFrames());
   enterFrame(code);
 }
 
+InterpreterState::~InterpreterState() {
+  // clear() releases the IValues held by this run but keeps the heap
+  // buffers, which go back to the cache; see
+  // Note [Reusing interpreter buffers].
+  registers_.clear();
+  frames_.clear();
+  cachedRegisters() = std::move(registers_);
+  cachedFrames() = std::move(frames_);
+}
+
 namespace {
 static thread_local DebugHandle exception_debug_handle_{-1};
 void createObject(Stack& stack, const at::ClassTypePtr& type) {
@@ -11,6 +11,7 @@ namespace mobile {
 
 struct InterpreterState {
   TORCH_API explicit InterpreterState(const Code& code);
+  TORCH_API ~InterpreterState();
   TORCH_API bool run(Stack& stack);
 
  private:
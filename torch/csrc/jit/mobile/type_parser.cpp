@@ -5,6 +5,8 @@
 #include <torch/csrc/jit/mobile/type_parser.h>
 #include <torch/custom_class.h>
 #include <queue>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace torch {
 namespace jit {
@@ -339,8 +341,27 @@ C10_NODISCARD c10::string_view TypeParser::cur() const {
 }
 
 TORCH_API at::TypePtr parseType(const std::string& pythonStr) {
+  // Identical type strings recur across (and within) module loads, and
+  // parsed types are immutable, so successful parses are memoized
+  // process-wide. Lookups take a shared lock; concurrent loads only contend
+  // on a miss. The map is intentionally leaked: cached TypePtrs must not be
+  // destroyed during static shutdown.
+  static auto* mutex = new std::shared_timed_mutex();
+  static auto* cache = new std::unordered_map<std::string, at::TypePtr>();
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(*mutex);
+    auto it = cache->find(pythonStr);
+    if (it != cache->end()) {
+      return it->second;
+    }
+  }
   at::TypeParser parser(pythonStr);
-  return parser.parse();
+  at::TypePtr type = parser.parse();
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(*mutex);
+    cache->emplace(pythonStr, type);
+  }
+  return type;
 }
 
 TORCH_API std::vector<at::TypePtr> parseType(
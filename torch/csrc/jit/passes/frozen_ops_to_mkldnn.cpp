@@ -672,11 +672,26 @@ void moveConvWeightsToMKLDNN(Node* conv) {
   }
 }
 
+void moveLinearWeightsToMKLDNN(Node* linear) {
+  auto linear_w_mkldnn =
+      constant_as<Tensor>(linear->namedInput("weight")).value().to_mkldnn();
+  // Pack the weight into the blocked format the inner product primitive
+  // expects, so the kernel does not reorder it on every forward call.
+  linear_w_mkldnn = mkldnn_reorder_linear_weight(linear_w_mkldnn, c10::nullopt);
+  replaceInputWithMKLDNNTensor(linear, "weight", linear_w_mkldnn);
+
+  if (linear->namedInput("bias")->type() != NoneType::get()) {
+    replaceInputWithMKLDNNTensor(linear, "bias");
+  }
+}
+
 void moveWeightsToMKLDNN(Node* n) {
   // conv goes through special pathway so we can call mkldnn reorder conv
   // primitive
   if (n->kind() == aten::conv2d || n->kind() == aten::conv3d) {
     moveConvWeightsToMKLDNN(n);
+  } else if (n->kind() == aten::linear) {
+    moveLinearWeightsToMKLDNN(n);
   } else {
     for (size_t i = 0; i < n->inputs().size(); ++i) {
       if (!n->input(i)->type()->cast<TensorType>() ||
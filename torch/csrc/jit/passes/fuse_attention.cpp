@@ -0,0 +1,111 @@
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/fuse_attention.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+size_t countAttentionNodes(Block* block) {
+  size_t count = 0;
+  for (Node* node : block->nodes()) {
+    if (node->kind() == Symbol::aten("_scaled_dot_product_attention")) {
+      count++;
+    }
+    for (Block* subblock : node->blocks()) {
+      count += countAttentionNodes(subblock);
+    }
+  }
+  return count;
+}
+
+} // namespace
+
+bool FuseAttention(std::shared_ptr<Graph>& graph) {
+  // The op scales scores by `scale`, while the idiom divides by it, hence
+  // the reciprocal in the replacements.
+  std::string attention_pattern = R"IR(
+    graph(%query, %key, %value, %scale : float):
+        %neg1 : int = prim::Constant[value=-1]()
+        %neg2 : int = prim::Constant[value=-2]()
+        %none : NoneType = prim::Constant()
+        %key_t = aten::transpose(%key, %neg2, %neg1)
+        %scores = aten::matmul(%query, %key_t)
+        %scaled = aten::div(%scores, %scale)
+        %weights = aten::softmax(%scaled, %neg1, %none)
+        %out = aten::matmul(%weights, %value)
+        return (%out))IR";
+  std::string fused_attention = R"IR(
+    graph(%query, %key, %value, %scale : float):
+        %none : NoneType = prim::Constant()
+        %dropout : float = prim::Constant[value=0.0]()
+        %false : bool = prim::Constant[value=0]()
+        %one : float = prim::Constant[value=1.]()
+        %inv_scale : float = aten::div(%one, %scale)
+        %out = aten::_scaled_dot_product_attention(%query, %key, %value, %none, %dropout, %false, %inv_scale)
+        return (%out))IR";
+
+  std::string masked_attention_pattern = R"IR(
+    graph(%query, %key, %value, %scale : float, %mask, %fill : float):
+        %neg1 : int = prim::Constant[value=-1]()
+        %neg2 : int = prim::Constant[value=-2]()
+        %none : NoneType = prim::Constant()
+        %key_t = aten::transpose(%key, %neg2, %neg1)
+        %scores = aten::matmul(%query, %key_t)
+        %scaled = aten::div(%scores, %scale)
+        %masked = aten::masked_fill(%scaled, %mask, %fill)
+        %weights = aten::softmax(%masked, %neg1, %none)
+        %out = aten::matmul(%weights, %value)
+        return (%out))IR";
+  std::string fused_masked_attention = R"IR(
+    graph(%query, %key, %value, %scale : float, %mask, %fill : float):
+        %dropout : float = prim::Constant[value=0.0]()
+        %false : bool = prim::Constant[value=0]()
+        %one : float = prim::Constant[value=1.]()
+        %inv_scale : float = aten::div(%one, %scale)
+        %attn_mask = aten::logical_not(%mask)
+        %out = aten::_scaled_dot_product_attention(%query, %key, %value, %attn_mask, %dropout, %false, %inv_scale)
+        return (%out))IR";
+
+  // masked_fill only turns into attention masking when the fill value is
+  // -inf; anything else changes the softmax result.
+  auto fill_is_neg_inf = [](const Match& match,
+                            const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    auto fill = toIValue(match_vmap.at(vmap.at("fill")));
+    if (!fill || !fill->isDouble()) {
+      return false;
+    }
+    const auto value = fill->toDouble();
+    return std::isinf(value) && value < 0;
+  };
+
+  const size_t before = countAttentionNodes(graph->block());
+
+  SubgraphRewriter masked_rewriter;
+  masked_rewriter.RegisterRewritePattern(
+      masked_attention_pattern, fused_masked_attention);
+  masked_rewriter.runOnGraph(graph, fill_is_neg_inf);
+
+  SubgraphRewriter rewriter;
+  rewriter.RegisterRewritePattern(attention_pattern, fused_attention);
+  rewriter.runOnGraph(graph);
+
+  return countAttentionNodes(graph->block()) != before;
+}
+
+bool fuseAttentionEnabled() {
+  static bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_JIT_FUSE_ATTENTION");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Rewrites the unfused scaled-dot-product-attention idiom
+//
+//   matmul(query, transpose(key, -2, -1)) -> div(scale)
+//     [-> masked_fill(mask, -inf)] -> softmax(-1) -> matmul(value)
+//
+// into a single aten::_scaled_dot_product_attention call. The fused op
+// processes the query in row chunks, so the full (..., L, S) score matrix
+// of the idiom is never materialized at once.
+//
+// The masked variant is only rewritten when the fill value is a constant
+// -inf (the idiom's way of zeroing attention weights under softmax); the
+// mask's sense is inverted to the fused op's participate-semantics with a
+// logical_not at run time. Dropout between softmax and the second matmul
+// is not matched - run this after dropout removal on inference graphs.
+//
+// Returns true if the graph was modified.
+TORCH_API bool FuseAttention(std::shared_ptr<Graph>& graph);
+
+// Gated by the PYTORCH_JIT_FUSE_ATTENTION environment variable.
+TORCH_API bool fuseAttentionEnabled();
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,65 @@
+#include <torch/csrc/jit/passes/fuse_dropout_add_layer_norm.h>
+
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/subgraph_matcher.h>
+#include <torch/csrc/jit/passes/graph_rewrite_helper.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+void fuseDropoutAddLayerNormImpl(std::shared_ptr<Graph>& graph) {
+  SubgraphRewriter rewriter;
+
+  std::string dropout_add_layer_norm = R"(
+    graph(%x, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn_enable):
+        %dropout_res = aten::dropout(%x, %p, %train)
+        %add_res = aten::add(%dropout_res, %residual, %alpha)
+        %res = aten::layer_norm(%add_res, %shape, %w, %b, %eps, %cudnn_enable)
+        return (%res))";
+  std::string dropout_add_layer_norm_fused = R"(
+    graph(%x, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn_enable):
+        %gen : NoneType = prim::Constant()
+        %res, %mask, %add_out, %mean, %rstd = aten::_dropout_add_layer_norm(%x, %residual, %shape, %w, %b, %p, %eps, %train, %gen)
+        return (%res))";
+  rewriter.RegisterRewritePattern(
+      dropout_add_layer_norm, dropout_add_layer_norm_fused);
+
+  // add is commutative; also match the residual as the first operand.
+  std::string add_dropout_layer_norm = R"(
+    graph(%x, %residual, %p, %train, %alpha, %shape, %w, %b, %eps, %cudnn_enable):
+        %dropout_res = aten::dropout(%x, %p, %train)
+        %add_res = aten::add(%residual, %dropout_res, %alpha)
+        %res = aten::layer_norm(%add_res, %shape, %w, %b, %eps, %cudnn_enable)
+        return (%res))";
+  rewriter.RegisterRewritePattern(
+      add_dropout_layer_norm, dropout_add_layer_norm_fused);
+
+  // The fused op folds the residual in unscaled, so the add's alpha must be
+  // the literal 1.
+  auto alpha_is_one = [](const Match& match,
+                         const std::unordered_map<std::string, Value*>& vmap) {
+    const auto& match_vmap = match.values_map;
+    auto alpha = graph_rewrite_helper::getIValue("alpha", match_vmap, vmap);
+    if (!alpha) {
+      return false;
+    }
+    return (alpha->isInt() && alpha->toInt() == 1) ||
+        (alpha->isDouble() && alpha->toDouble() == 1.0);
+  };
+
+  rewriter.runOnGraph(graph, alpha_is_one);
+}
+} // namespace
+
+void FuseDropoutAddLayerNorm(script::Module& module) {
+  auto graph = module.get_method("forward").graph();
+  fuseDropoutAddLayerNormImpl(graph);
+}
+
+void FuseDropoutAddLayerNorm(std::shared_ptr<Graph>& graph) {
+  fuseDropoutAddLayerNormImpl(graph);
+}
+} // namespace jit
+} // namespace torch
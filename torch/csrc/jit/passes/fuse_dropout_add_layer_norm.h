@@ -0,0 +1,14 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+// Rewrites layer_norm(dropout(x, p, train) + residual) into the fused
+// aten::_dropout_add_layer_norm op. The fused op only has a CUDA kernel, so
+// this pass is opt-in and should only be run on graphs that execute on CUDA.
+TORCH_API void FuseDropoutAddLayerNorm(script::Module& module);
+TORCH_API void FuseDropoutAddLayerNorm(std::shared_ptr<Graph>& graph);
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,175 @@
+#include <torch/csrc/jit/passes/fuse_parallel_linear.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Below this, the fused GEMM cannot beat the per-head ones by enough to
+// justify the extra split.
+constexpr size_t kMinGroupSize = 2;
+
+c10::optional<at::Tensor> constantTensor(Value* v) {
+  if (v->node()->kind() != prim::Constant) {
+    return c10::nullopt;
+  }
+  auto ival = toIValue(v);
+  if (ival && ival->isTensor()) {
+    return ival->toTensor();
+  }
+  return c10::nullopt;
+}
+
+bool isConstantNone(Value* v) {
+  return v->node()->kind() == prim::Constant &&
+      v->type()->isSubtypeOf(NoneType::get());
+}
+
+// A linear node is fusable if its parameters are compile-time constants
+// (so we can concatenate them during the pass and know the split sizes)
+// and neither its input nor its output is ever written to. The output
+// check matters because the rewritten graph hands out views of the fused
+// GEMM result.
+bool isFusableLinear(Node* n, AliasDb& db) {
+  if (n->kind() != aten::linear) {
+    return false;
+  }
+  auto weight = constantTensor(n->input(1));
+  if (!weight || weight->dim() != 2) {
+    return false;
+  }
+  if (!isConstantNone(n->input(2))) {
+    auto bias = constantTensor(n->input(2));
+    if (!bias || bias->dim() != 1 || bias->size(0) != weight->size(0)) {
+      return false;
+    }
+  }
+  if (db.hasWriters(n->input(0)) || db.hasWriters(n->output())) {
+    return false;
+  }
+  return true;
+}
+
+// Two fusable linears can join the same group if their parameters can be
+// concatenated: same dtype, same device, same in_features, and biases
+// either both present or both absent.
+bool isCompatible(Node* a, Node* b) {
+  auto wa = *constantTensor(a->input(1));
+  auto wb = *constantTensor(b->input(1));
+  if (wa.scalar_type() != wb.scalar_type() || wa.device() != wb.device() ||
+      wa.size(1) != wb.size(1)) {
+    return false;
+  }
+  return isConstantNone(a->input(2)) == isConstantNone(b->input(2));
+}
+
+// Collects groups of fusable linear nodes per block, keyed by the shared
+// input value. Nodes come out in topological order because we walk the
+// block in order.
+void collectGroups(
+    Block* block,
+    AliasDb& db,
+    std::vector<std::vector<Node*>>& groups) {
+  std::unordered_map<Value*, std::vector<size_t>> groups_for_input;
+  for (Node* n : block->nodes()) {
+    for (Block* inner : n->blocks()) {
+      collectGroups(inner, db, groups);
+    }
+    if (!isFusableLinear(n, db)) {
+      continue;
+    }
+    auto& candidates = groups_for_input[n->input(0)];
+    bool placed = false;
+    for (size_t group_idx : candidates) {
+      if (isCompatible(groups[group_idx].front(), n)) {
+        groups[group_idx].push_back(n);
+        placed = true;
+        break;
+      }
+    }
+    if (!placed) {
+      candidates.push_back(groups.size());
+      groups.emplace_back(std::vector<Node*>{n});
+    }
+  }
+}
+
+void fuseGroup(Graph* graph, const std::vector<Node*>& nodes) {
+  std::vector<at::Tensor> weights;
+  std::vector<at::Tensor> biases;
+  std::vector<int64_t> split_sizes;
+  for (Node* n : nodes) {
+    auto weight = *constantTensor(n->input(1));
+    weights.push_back(weight);
+    split_sizes.push_back(weight.size(0));
+    if (!isConstantNone(n->input(2))) {
+      biases.push_back(*constantTensor(n->input(2)));
+    }
+  }
+
+  Node* first = nodes.front();
+  WithInsertPoint guard(first);
+  Value* fused_weight = graph->insertConstant(at::cat(weights, 0));
+  Value* fused_bias = biases.empty()
+      ? graph->insertConstant(IValue())
+      : graph->insertConstant(at::cat(biases, 0));
+  Value* fused = graph->insert(
+      aten::linear, {first->input(0), fused_weight, fused_bias});
+  Value* chunks = graph->insert(
+      aten::split_with_sizes, {fused, IValue(split_sizes), IValue(-1)});
+  Node* unpack = graph->insertNode(graph->createListUnpack(chunks, nodes.size()));
+
+  for (const auto i : c10::irange(nodes.size())) {
+    Value* slice = unpack->outputs()[i];
+    slice->setType(nodes[i]->output()->type());
+    nodes[i]->output()->replaceAllUsesWith(slice);
+  }
+  for (Node* n : nodes) {
+    GRAPH_UPDATE("FuseParallelLinear: fusing ", getHeader(n));
+    n->destroy();
+  }
+}
+
+} // namespace
+
+bool FuseParallelLinear(const std::shared_ptr<Graph>& graph) {
+  AliasDb db(graph);
+  // Collect everything up front so alias queries run against the
+  // unmodified graph.
+  std::vector<std::vector<Node*>> groups;
+  collectGroups(graph->block(), db, groups);
+
+  bool changed = false;
+  for (const auto& nodes : groups) {
+    if (nodes.size() < kMinGroupSize) {
+      continue;
+    }
+    fuseGroup(graph.get(), nodes);
+    changed = true;
+  }
+  if (changed) {
+    GRAPH_DUMP("After FuseParallelLinear: ", graph);
+  }
+  return changed;
+}
+
+bool fuseParallelLinearEnabled() {
+  static bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_JIT_FUSE_PARALLEL_LINEAR");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Horizontal fusion for sibling linear layers. Multi-task and multi-head
+// models often apply many small `aten::linear` ops to the same activation
+// (one per head/task); each one is a GEMM too small to saturate the
+// machine. This pass detects groups of linear nodes in the same block
+// that share their input and have constant weights/biases, concatenates
+// the parameters along the output-features dimension at pass time, and
+// replaces the group with a single well-shaped GEMM followed by
+// split_with_sizes, so downstream per-head ops keep their original
+// slices.
+//
+// The pass is conservative: parameters must be prim::Constant tensors
+// (run it after freezing or on traced graphs), all weights in a group
+// must agree on dtype, device and in_features, biases must be all
+// present or all absent, and neither the shared input nor any output may
+// have writers according to alias analysis (the split outputs are views
+// of the fused GEMM, so in-place mutation downstream would alias
+// siblings). Linears with distinct inputs (the baddbmm formulation) are
+// out of scope here.
+//
+// Returns true if the graph was modified.
+TORCH_API bool FuseParallelLinear(const std::shared_ptr<Graph>& graph);
+
+// Gated by the PYTORCH_JIT_FUSE_PARALLEL_LINEAR environment variable.
+TORCH_API bool fuseParallelLinearEnabled();
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,232 @@
+#include <torch/csrc/jit/passes/parallelize_branches.h>
+
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Forking a branch only pays off if it amortizes the future/task overhead
+// over at least a couple of ops.
+constexpr size_t kMinBranchSize = 2;
+
+struct Branch {
+  // in topological order
+  std::vector<Node*> nodes;
+  // the single value consumed outside the branch
+  Value* output;
+};
+
+// The whole block must be free of mutation and control flow for the
+// reordering implied by fork/wait to be sound. Mutation is checked through
+// the alias db so indirect writers (e.g. through views) are caught too.
+bool blockIsEligible(Block* block, AliasDb& db) {
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::Constant) {
+      continue;
+    }
+    if (n->kind() == prim::fork) {
+      // the author already parallelized this graph by hand
+      return false;
+    }
+    if (!n->blocks().empty() || n->hasSideEffects()) {
+      return false;
+    }
+    for (Value* v : n->inputs()) {
+      if (db.hasWriters(v)) {
+        return false;
+      }
+    }
+    for (Value* v : n->outputs()) {
+      if (db.hasWriters(v)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Assigns each node to a branch: a node joins the branch of its in-block
+// producers when they all agree; a node whose inputs come from several
+// branches is a join and stays unassigned, acting as a synchronization
+// point (its consumers then start fresh branches).
+std::vector<std::vector<Node*>> collectBranches(
+    Block* block,
+    std::unordered_map<Node*, size_t>& branch_of) {
+  std::vector<std::vector<Node*>> members;
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::Constant) {
+      continue;
+    }
+    bool is_join = false;
+    size_t found = members.size();
+    for (Value* input : n->inputs()) {
+      auto it = branch_of.find(input->node());
+      if (it == branch_of.end()) {
+        // graph input, constant, or join node
+        continue;
+      }
+      if (found == members.size()) {
+        found = it->second;
+      } else if (found != it->second) {
+        is_join = true;
+        break;
+      }
+    }
+    if (is_join) {
+      continue;
+    }
+    if (found == members.size()) {
+      members.emplace_back();
+    }
+    branch_of[n] = found;
+    members[found].push_back(n);
+  }
+  return members;
+}
+
+// A branch is forkable if exactly one of the values it produces is
+// consumed outside of it (prim::fork returns a single future).
+c10::optional<Value*> singleExternalOutput(
+    const std::vector<Node*>& nodes,
+    const std::unordered_set<Node*>& node_set) {
+  Value* output = nullptr;
+  for (Node* n : nodes) {
+    for (Value* v : n->outputs()) {
+      for (const Use& use : v->uses()) {
+        if (node_set.count(use.user) != 0) {
+          continue;
+        }
+        if (output != nullptr && output != v) {
+          return c10::nullopt;
+        }
+        output = v;
+      }
+    }
+  }
+  if (output == nullptr) {
+    return c10::nullopt;
+  }
+  return output;
+}
+
+void rewriteBranchAsFork(Graph* graph, const Branch& branch) {
+  const std::unordered_set<Node*> node_set(
+      branch.nodes.begin(), branch.nodes.end());
+
+  // Clone the branch into a forked subgraph; values defined outside become
+  // subgraph inputs (and fork inputs, in the same order).
+  auto subgraph = std::make_shared<Graph>();
+  std::vector<Value*> inputs;
+  std::unordered_map<Value*, Value*> local;
+  auto env = [&](Value* v) -> Value* {
+    auto it = local.find(v);
+    if (it != local.end()) {
+      return it->second;
+    }
+    Value* in = subgraph->addInput()->copyMetadata(v);
+    local[v] = in;
+    inputs.push_back(v);
+    return in;
+  };
+  for (Node* n : branch.nodes) {
+    Node* cloned = subgraph->insertNode(subgraph->createClone(n, env));
+    for (const auto i : c10::irange(n->outputs().size())) {
+      local[n->outputs()[i]] = cloned->outputs()[i];
+    }
+  }
+  subgraph->registerOutput(local.at(branch.output));
+
+  // All fork inputs dominate the branch's last node, so that's a valid
+  // insertion point.
+  Node* fork = nullptr;
+  {
+    WithInsertPoint guard(branch.nodes.back());
+    fork = graph->insertNode(graph->create(prim::fork, 1));
+    fork->g_(attr::Subgraph, std::move(subgraph));
+    for (Value* v : inputs) {
+      fork->addInput(v);
+    }
+    fork->output()->setType(FutureType::create(branch.output->type()));
+  }
+
+  // Join as late as possible: right before the first external use.
+  Node* first_use = nullptr;
+  for (const Use& use : branch.output->uses()) {
+    if (node_set.count(use.user) != 0) {
+      continue;
+    }
+    if (first_use == nullptr || use.user->isBefore(first_use)) {
+      first_use = use.user;
+    }
+  }
+  TORCH_INTERNAL_ASSERT(first_use != nullptr);
+  {
+    WithInsertPoint guard(first_use);
+    Node* wait = graph->insertNode(graph->create(aten::wait, 1));
+    wait->addInput(fork->output());
+    wait->output()->setType(branch.output->type());
+    branch.output->replaceAllUsesWith(wait->output());
+  }
+
+  // The original branch nodes are dead now; destroy consumers first.
+  for (auto it = branch.nodes.rbegin(); it != branch.nodes.rend(); ++it) {
+    (*it)->destroy();
+  }
+}
+
+} // namespace
+
+bool ParallelizeIndependentBranches(const std::shared_ptr<Graph>& graph) {
+  Block* block = graph->block();
+  AliasDb db(graph);
+  if (!blockIsEligible(block, db)) {
+    return false;
+  }
+
+  std::unordered_map<Node*, size_t> branch_of;
+  auto members = collectBranches(block, branch_of);
+
+  std::vector<Branch> branches;
+  for (auto& nodes : members) {
+    if (nodes.size() < kMinBranchSize) {
+      continue;
+    }
+    const std::unordered_set<Node*> node_set(nodes.begin(), nodes.end());
+    if (auto output = singleExternalOutput(nodes, node_set)) {
+      branches.push_back(Branch{std::move(nodes), *output});
+    }
+  }
+  // With fewer than two independent branches there is nothing to overlap.
+  if (branches.size() < 2) {
+    return false;
+  }
+
+  // Keep the last branch inline so the calling thread has work to do while
+  // the forked ones run.
+  for (const auto i : c10::irange(branches.size() - 1)) {
+    rewriteBranchAsFork(graph.get(), branches[i]);
+  }
+  GRAPH_DUMP("After ParallelizeIndependentBranches: ", graph);
+  return true;
+}
+
+bool parallelizeBranchesEnabled() {
+  static bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_JIT_PARALLELIZE_BRANCHES");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Rewrites data-independent branches of the top-level block into
+// prim::fork/aten::wait pairs so the runtime can execute them in parallel
+// (and, with PYTORCH_JIT_FORK_STREAMS, on separate device streams).
+//
+// A branch is a maximal group of nodes connected through producer/consumer
+// edges that only consumes graph inputs and constants; nodes that join
+// several branches (e.g. a cat over multiple heads) act as synchronization
+// points and stay in the main graph, with waits inserted before them
+// automatically. The pass is conservative: it leaves the graph untouched
+// if any node in the block has side effects, owns sub-blocks, or touches
+// values with writers according to alias analysis.
+//
+// Returns true if the graph was modified.
+TORCH_API bool ParallelizeIndependentBranches(
+    const std::shared_ptr<Graph>& graph);
+
+// Gated by the PYTORCH_JIT_PARALLELIZE_BRANCHES environment variable.
+TORCH_API bool parallelizeBranchesEnabled();
+
+} // namespace jit
+} // namespace torch
@@ -10,6 +10,7 @@
 #include <torch/csrc/jit/frontend/tracer.h>
 #include <torch/csrc/jit/ir/irparser.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_timing.h>
 #include <torch/csrc/jit/passes/batch_mm.h>
 #include <torch/csrc/jit/passes/canonicalize.h>
 #include <torch/csrc/jit/passes/canonicalize_graph_fuser_ops.h>
@@ -31,6 +32,7 @@
 #include <torch/csrc/jit/passes/frozen_linear_transpose.h>
 #include <torch/csrc/jit/passes/frozen_ops_to_mkldnn.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
+#include <torch/csrc/jit/passes/fuse_dropout_add_layer_norm.h>
 #include <torch/csrc/jit/passes/fuse_relu.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/inline_fork_wait.h>
@@ -378,6 +380,11 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_pass_fuse_add_relu",
           [](std::shared_ptr<Graph>& graph) { FuseAddRelu(graph); })
+      .def(
+          "_jit_pass_fuse_dropout_add_layer_norm",
+          [](std::shared_ptr<Graph>& graph) {
+            FuseDropoutAddLayerNorm(graph);
+          })
       .def("_jit_pass_dedup_module_uses", &DedupModuleUses)
       .def("_jit_pass_replicate_dequantize", &ReplicateDeQuant)
       .def(
@@ -692,6 +699,20 @@ void initJITBindings(PyObject* module) {
             getBailoutDepth() = depth;
             return old_depth;
           })
+      .def(
+          "_jit_set_shape_plan_cache_size",
+          [](size_t size) {
+            size_t old_size = getShapePlanCacheSize();
+            getShapePlanCacheSize() = size;
+            return old_size;
+          })
+      .def(
+          "_jit_set_background_compilation",
+          [](bool enabled) {
+            bool old_enabled = getBackgroundCompilation();
+            getBackgroundCompilation() = enabled;
+            return old_enabled;
+          })
       .def(
           "_jit_set_inline_everything_mode",
           [](bool enabled) { getInlineEverythingMode() = enabled; })
@@ -718,6 +739,37 @@ void initJITBindings(PyObject* module) {
                         << "are supported as output options" << std::endl;
             }
           })
+      .def(
+          "_jit_set_pass_timing_enabled",
+          [](bool enabled) { ::torch::jit::setPassTimingEnabled(enabled); })
+      .def(
+          "_jit_get_pass_timing_enabled",
+          []() { return ::torch::jit::passTimingEnabled(); })
+      .def(
+          "_jit_get_pass_timing_events",
+          []() {
+            py::list events;
+            for (const auto& e : ::torch::jit::getPassTimingEvents()) {
+              events.append(py::make_tuple(
+                  e.name,
+                  e.depth,
+                  e.start_us,
+                  e.duration_us,
+                  e.nodes_before,
+                  e.nodes_after));
+            }
+            return events;
+          })
+      .def(
+          "_jit_clear_pass_timing_events",
+          []() { ::torch::jit::clearPassTimingEvents(); })
+      .def(
+          "_jit_pass_timing_report",
+          []() {
+            std::ostringstream report;
+            ::torch::jit::dumpPassTimingReport(report);
+            return report.str();
+          })
       .def(
           "_jit_try_infer_type",
           [](py::object obj) -> InferredType {
@@ -801,6 +853,18 @@ void initJITBindings(PyObject* module) {
             using namespace torch::jit::tensorexpr;
             getOptConditionals() = opt_conds;
           })
+      .def(
+          "_jit_set_te_allow_dynamic_batch",
+          [](bool allow_dynamic_batch) {
+            using namespace torch::jit::tensorexpr;
+            getTEAllowDynamicBatch() = allow_dynamic_batch;
+          })
+      .def(
+          "_jit_get_te_allow_dynamic_batch",
+          []() -> bool {
+            using namespace torch::jit::tensorexpr;
+            return getTEAllowDynamicBatch();
+          })
       .def(
           "_llvm_enabled",
           []() {
@@ -1447,6 +1447,28 @@ void initJitScriptBindings(PyObject* module) {
           [](const StrongFunctionPtr& self) {
             return self.function_->get_executor().debugFlushCompilationCache();
           })
+      .def(
+          "_trigger_compilation",
+          [](py::args args, py::kwargs kwargs) {
+            // see: [pybind11 varargs]
+            // Requests the execution plan for these example inputs without
+            // running the graph, so warmup can pre-trigger compilation for
+            // each expected shape bucket. See Note [Background compilation]
+            // in profiling_graph_executor_impl.cpp.
+            HANDLE_TH_ERRORS
+            auto strongPtr = py::cast<StrongFunctionPtr>(args[0]);
+            Function& callee = *strongPtr.function_;
+            auto stack = createStackForSchema(
+                callee.getSchema(),
+                // NOLINTNEXTLINE(performance-move-const-arg)
+                tuple_slice(std::move(args), 1),
+                kwargs,
+                c10::nullopt);
+            py::gil_scoped_release release;
+            callee.get_executor().getPlanFor(
+                stack, GraphExecutor::getDefaultNumBailOuts());
+            END_HANDLE_TH_ERRORS_PYBIND
+          })
       .def_property_readonly(
           "name",
           [](const StrongFunctionPtr& self) { return self.function_->name(); })
@@ -1500,6 +1522,24 @@ void initJitScriptBindings(PyObject* module) {
           [](Method& self) {
             return self.get_executor().debugFlushCompilationCache();
           })
+      .def(
+          "_trigger_compilation",
+          [](py::args args, py::kwargs kwargs) {
+            // see: [pybind11 varargs]
+            // Warmup counterpart of ScriptFunction._trigger_compilation.
+            HANDLE_TH_ERRORS
+            Method& method = py::cast<Method&>(args[0]);
+            auto stack = createStackForSchema(
+                method.function().getSchema(),
+                // NOLINTNEXTLINE(performance-move-const-arg)
+                tuple_slice(std::move(args), 1),
+                kwargs,
+                method.owner()._ivalue());
+            py::gil_scoped_release release;
+            method.get_executor().getPlanFor(
+                stack, GraphExecutor::getDefaultNumBailOuts());
+            END_HANDLE_TH_ERRORS_PYBIND
+          })
       .def_property_readonly(
           "code_with_constants",
           [](Method& self) {
@@ -0,0 +1,31 @@
+#include <torch/csrc/jit/runtime/cuda_graph_executor.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace torch {
+namespace jit {
+
+std::atomic<bool>& getGraphExecutorCudaGraphsMode() {
+  static std::atomic<bool> cuda_graphs_mode{[]() {
+    const char* enable_c_str = std::getenv("PYTORCH_JIT_CUDA_GRAPHS");
+    return enable_c_str != nullptr && std::strcmp(enable_c_str, "1") == 0;
+  }()};
+  return cuda_graphs_mode;
+}
+
+CudaGraphExecutorInterface* getCudaGraphExecutorInterface() {
+  static CudaGraphExecutorInterface cuda_graph_executor_interface_;
+  return &cuda_graph_executor_interface_;
+}
+
+std::unique_ptr<CudaGraphRunner> createCudaGraphRunner() {
+  auto create_runner = getCudaGraphExecutorInterface()->fn_create_runner;
+  if (create_runner == nullptr) {
+    return nullptr;
+  }
+  return std::unique_ptr<CudaGraphRunner>(create_runner());
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/runtime/graph_executor.h>
+
+#include <atomic>
+#include <memory>
+
+/*
+ * Optional CUDA graph capture support for the graph executor.
+ *
+ * This mirrors the registration scheme of
+ * torch/csrc/jit/codegen/cuda/interface.h: an empty static struct holds
+ * function pointers that are filled in by the CUDA build
+ * (torch/csrc/jit/runtime/cuda_graph_executor_impl.cpp), so that cpu-only
+ * builds still link. When the mode is on and an implementation is
+ * registered, the profiling executor hands invocations of its optimized
+ * plan to a CudaGraphRunner. After a few calls with identical input
+ * metadata the runner captures the plan's CUDA work into a cudaGraph and
+ * replays it on later calls, collapsing per-op kernel launches into a
+ * single graph launch. Calls whose input shapes differ from the captured
+ * ones fall back to normal interpretation.
+ *
+ * Replays reuse static input and output buffers: each call overwrites the
+ * tensors returned by the previous one, like torch.cuda's graphed
+ * callables. The mode is therefore opt-in and intended for fixed-shape
+ * inference loops.
+ */
+
+namespace torch {
+namespace jit {
+
+// Opt-in switch for capture/replay; initialized from the
+// PYTORCH_JIT_CUDA_GRAPHS environment variable.
+TORCH_API std::atomic<bool>& getGraphExecutorCudaGraphsMode();
+
+// One runner per graph executor. runOrCapture returns true if the call was
+// served by the runner (it replayed a previously captured graph, or it just
+// captured one and materialized this call's outputs); false means the
+// caller should interpret the plan as usual (shapes changed, the inputs are
+// not eligible, or capture failed).
+struct TORCH_API CudaGraphRunner {
+  virtual ~CudaGraphRunner() = default;
+  virtual bool runOrCapture(const ExecutionPlan& plan, Stack& stack) = 0;
+};
+
+// dummy struct to allow API registration
+struct CudaGraphExecutorInterface {
+  CudaGraphRunner* (*fn_create_runner)() = nullptr;
+};
+
+// Get interface, this is used by registration and the executor internally
+C10_EXPORT CudaGraphExecutorInterface* getCudaGraphExecutorInterface();
+
+// Returns nullptr when no implementation is registered (cpu-only build).
+C10_EXPORT std::unique_ptr<CudaGraphRunner> createCudaGraphRunner();
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,205 @@
+#include <torch/csrc/jit/runtime/cuda_graph_executor.h>
+
+#include <ATen/core/grad_mode.h>
+#include <ATen/cuda/CUDAGraph.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
+
+#include <mutex>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Number of consecutive calls whose input metadata must match before we pay
+// the (substantial) one-time cost of a stream capture.
+constexpr size_t kNumStableRunsBeforeCapture = 3;
+
+struct TensorSig {
+  std::vector<int64_t> sizes;
+  std::vector<int64_t> strides;
+  at::ScalarType dtype;
+  c10::DeviceIndex device;
+
+  bool operator==(const TensorSig& other) const {
+    return dtype == other.dtype && device == other.device &&
+        sizes == other.sizes && strides == other.strides;
+  }
+};
+
+struct CudaGraphRunnerImpl : CudaGraphRunner {
+  bool runOrCapture(const ExecutionPlan& plan, Stack& stack) override {
+    // Serializes concurrent callers of the same executor; capture and
+    // replay both mutate the static buffers.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (disabled_) {
+      return false;
+    }
+    const size_t num_inputs = plan.code.num_inputs();
+    if (stack.size() < num_inputs) {
+      return false;
+    }
+    auto inputs = last(stack, num_inputs);
+
+    std::vector<TensorSig> sig;
+    sig.reserve(num_inputs);
+    for (const IValue& input : inputs) {
+      if (!input.isTensor()) {
+        // Non-tensor inputs can steer CPU-side control flow that a replay
+        // would not re-run; never try to capture this executor.
+        disabled_ = true;
+        return false;
+      }
+      const at::Tensor& t = input.toTensor();
+      if (!t.is_cuda() || !t.defined()) {
+        disabled_ = true;
+        return false;
+      }
+      if (!sig.empty() && t.get_device() != sig.front().device) {
+        // cudaGraph capture is single-device
+        disabled_ = true;
+        return false;
+      }
+      if (t.requires_grad() && at::GradMode::is_enabled()) {
+        // The autograd bookkeeping done while building the graph runs on
+        // the CPU and would not be re-run by a replay.
+        return false;
+      }
+      sig.push_back(TensorSig{
+          t.sizes().vec(),
+          t.strides().vec(),
+          t.scalar_type(),
+          static_cast<c10::DeviceIndex>(t.get_device())});
+    }
+
+    if (!signature_ || !(*signature_ == sig)) {
+      signature_ = std::move(sig);
+      stable_runs_ = 1;
+      if (graph_) {
+        // Input shapes changed: drop the stale capture and fall back to
+        // interpretation until the shapes stabilize again.
+        GRAPH_DEBUG("CUDA graph runner: input shapes changed, releasing graph");
+        graph_.reset();
+        static_inputs_.clear();
+        static_outputs_.clear();
+      }
+      return false;
+    }
+
+    if (graph_) {
+      replay(stack, num_inputs);
+      return true;
+    }
+
+    if (++stable_runs_ < kNumStableRunsBeforeCapture) {
+      return false;
+    }
+    return captureAndRun(plan, stack, num_inputs);
+  }
+
+ private:
+  void replay(Stack& stack, size_t num_inputs) {
+    auto inputs = last(stack, num_inputs);
+    for (const auto i : c10::irange(num_inputs)) {
+      static_inputs_[i].copy_(inputs[i].toTensor(), /*non_blocking=*/true);
+    }
+    // Launches on the current stream, ordered after the input copies.
+    graph_->replay();
+    drop(stack, num_inputs);
+    for (const IValue& output : static_outputs_) {
+      stack.push_back(output);
+    }
+  }
+
+  bool captureAndRun(
+      const ExecutionPlan& plan,
+      Stack& stack,
+      size_t num_inputs) {
+    auto inputs = last(stack, num_inputs);
+    try {
+      const auto device = inputs[0].toTensor().get_device();
+      // Capture must happen on a non-default stream.
+      at::cuda::CUDAStream capture_stream = at::cuda::getStreamFromPool(
+          /*isHighPriority=*/false, static_cast<c10::DeviceIndex>(device));
+      {
+        at::cuda::CUDAStreamGuard stream_guard(capture_stream);
+
+        static_inputs_.clear();
+        static_inputs_.reserve(num_inputs);
+        for (const IValue& input : inputs) {
+          static_inputs_.push_back(input.toTensor().clone());
+        }
+
+        // Warm-up run on the side stream so lazy initialization (library
+        // handles, autotuning, first-touch allocations) does not end up
+        // inside the capture.
+        {
+          Stack warmup_stack(static_inputs_.begin(), static_inputs_.end());
+          InterpreterState(plan.code).run(warmup_stack);
+        }
+        capture_stream.synchronize();
+
+        graph_ = std::make_unique<at::cuda::CUDAGraph>();
+        Stack capture_stack(static_inputs_.begin(), static_inputs_.end());
+        graph_->capture_begin();
+        InterpreterState(plan.code).run(capture_stack);
+        graph_->capture_end();
+        // The capture run only recorded kernels, it didn't execute them;
+        // whatever it left on the stack are the plan's (still unwritten)
+        // static output buffers.
+        static_outputs_ = std::move(capture_stack);
+      }
+      // Materialize this call's outputs on the caller's stream. The static
+      // inputs already hold this call's values (they were cloned above).
+      graph_->replay();
+    } catch (const std::exception& e) {
+      // Ops that can't be stream captured (unsafe syncs, D2H copies, ...)
+      // surface here. Clean up as well as CUDAGraph allows and interpret
+      // from now on.
+      GRAPH_DEBUG("CUDA graph capture failed, falling back: ", e.what());
+      try {
+        graph_.reset();
+      } catch (...) {
+      }
+      static_inputs_.clear();
+      static_outputs_.clear();
+      disabled_ = true;
+      return false;
+    }
+    drop(stack, num_inputs);
+    for (const IValue& output : static_outputs_) {
+      stack.push_back(output);
+    }
+    return true;
+  }
+
+  std::mutex mutex_;
+  bool disabled_ = false;
+  size_t stable_runs_ = 0;
+  c10::optional<std::vector<TensorSig>> signature_;
+  std::unique_ptr<at::cuda::CUDAGraph> graph_;
+  std::vector<at::Tensor> static_inputs_;
+  Stack static_outputs_;
+};
+
+CudaGraphRunner* createCudaGraphRunnerImpl() {
+  return new CudaGraphRunnerImpl();
+}
+
+struct RegisterInterface {
+  RegisterInterface() {
+    auto ptr = getCudaGraphExecutorInterface();
+    ptr->fn_create_runner = &createCudaGraphRunnerImpl;
+  }
+};
+
+static RegisterInterface register_interface_;
+
+} // namespace
+
+} // namespace jit
+} // namespace torch
@@ -33,6 +33,7 @@
 #include <torch/csrc/jit/resource_guard.h>
 #include <torch/csrc/jit/runtime/argument_spec.h>
 #include <torch/csrc/jit/runtime/autodiff.h>
+#include <torch/csrc/jit/runtime/cuda_graph_executor.h>
 #include <torch/csrc/jit/runtime/custom_operator.h>
 #include <torch/csrc/jit/runtime/graph_executor_impl.h>
 #include <torch/csrc/jit/runtime/interpreter.h>
@@ -540,6 +541,14 @@ void GraphExecutorImplBase::run(Stack& stack) {
 
   const ExecutionPlan& plan =
       getPlanFor(stack, GraphExecutor::getDefaultNumBailOuts());
+  if (C10_UNLIKELY(getGraphExecutorCudaGraphsMode())) {
+    if (auto* runner = cudaGraphRunner()) {
+      if (runner->runOrCapture(plan, stack)) {
+        last_executed_optimized_graph = plan.graph;
+        return;
+      }
+    }
+  }
   InterpreterState(plan.code).run(stack);
   last_executed_optimized_graph = plan.graph;
 }
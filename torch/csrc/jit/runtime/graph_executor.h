@@ -112,6 +112,15 @@ TORCH_API std::atomic<bool>& getProfilingMode();
 TORCH_API std::atomic<bool>& getExecutorMode();
 TORCH_API std::atomic<size_t>& getNumProfiledRuns();
 TORCH_API std::atomic<size_t>& getBailoutDepth();
+// Maximum number of per-shape-class execution plans a profiling executor may
+// cache; 0 (the default) keeps the single-plan behavior. See
+// Note [Shape-bucketed plan cache] in profiling_graph_executor_impl.cpp.
+TORCH_API std::atomic<size_t>& getShapePlanCacheSize();
+// When true, profiling executors run the optimizing pass pipeline on a side
+// thread and keep serving the instrumented graph until the optimized plan is
+// ready, instead of blocking a request on compilation. See
+// Note [Background compilation] in profiling_graph_executor_impl.cpp.
+TORCH_API std::atomic<bool>& getBackgroundCompilation();
 TORCH_API bool IsNewExecutorEnabled();
 
 struct TORCH_API GraphOptimizerEnabledGuard {
@@ -29,6 +29,8 @@
 namespace torch {
 namespace jit {
 
+struct CudaGraphRunner;
+
 void packGradient(const Gradient& gradient, Node* dnode);
 bool needsGradient(const std::shared_ptr<const Graph>& graph);
 void runOptimization(
@@ -86,6 +88,12 @@ struct GraphExecutorImplBase {
     return false;
   }
 
+  // Overridden by executors that can serve calls by capturing/replaying
+  // CUDA graphs; see torch/csrc/jit/runtime/cuda_graph_executor.h.
+  virtual CudaGraphRunner* cudaGraphRunner() {
+    return nullptr;
+  }
+
  protected:
   friend struct GraphExecutor;
 
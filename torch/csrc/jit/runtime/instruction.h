@@ -55,7 +55,12 @@ namespace jit {
   _(FORK, "CN") /* launch a thread to run code entry x with N inputs  */       \
   _(WARN, "I") /* emit a warning with line information */                      \
   _(ENTER, "EN") /* enter scope of a contextmanager */                         \
-  _(EXIT, "EX") /* exit the last entered contextmanager */
+  _(EXIT, "EX") /* exit the last entered contextmanager */                     \
+  _(OPD, "O") /* invoke c10 operator X directly via its dispatcher handle */   \
+  _(LOAD2, "RR") /* fused LOAD X; LOAD N */                                    \
+  _(MOVE2, "RR") /* fused MOVE X; MOVE N */                                    \
+  _(OPSTORE, "OR") /* fused: invoke operator X, store result to register N */  \
+  _(OPDSTORE, "OR") /* fused: invoke c10 operator X, store to register N */
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
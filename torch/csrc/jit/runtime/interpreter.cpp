@@ -3,6 +3,9 @@
 #include <ATen/Parallel.h>
 #include <ATen/core/ivalue.h>
 #include <ATen/record_function.h>
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
 #include <c10/core/thread_pool.h>
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
@@ -32,6 +35,8 @@
 using torch::distributed::autograd::DistAutogradContainer;
 #endif
 
+#include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -92,6 +97,37 @@ inline int64_t getDistAutogradContextId() {
   return 0;
 #endif
 }
+
+// Note [Forked tasks on device streams]
+// By default a forked task inherits nothing about streams, so its kernels are
+// queued on the default stream of whatever thread the launcher picks and
+// serialize with the parent's work. With PYTORCH_JIT_FORK_STREAMS=1 each fork
+// instead grabs a stream from the device's global pool, ordered after the
+// caller's current stream via an event, and the continuation runs with that
+// stream current. The forked future is constructed as device-aware
+// (see Note [Future device(s)] machinery in ivalue_inl.h): on completion it
+// records events on the task's streams and makes aten::wait on the consumer
+// side synchronize with them and stream-record the output storages, so the
+// usual caching-allocator safety rules hold across the join.
+inline c10::optional<c10::Stream> streamForForkedTask() {
+  static bool enabled = []() {
+    const char* env = std::getenv("PYTORCH_JIT_FORK_STREAMS");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  if (!enabled || !c10::impl::hasDeviceGuardImpl(c10::DeviceType::CUDA)) {
+    return c10::nullopt;
+  }
+  c10::impl::VirtualGuardImpl impl(c10::DeviceType::CUDA);
+  const auto device = impl.getDevice();
+  c10::Stream current = impl.getStream(device);
+  c10::Stream side = impl.getStreamFromGlobalPool(device);
+  // Order the side stream after work already queued by the caller, without
+  // blocking the host.
+  c10::Event ready(c10::DeviceType::CUDA);
+  ready.record(current);
+  ready.block(side);
+  return side;
+}
 } // namespace
 
 thread_local InterpreterStateImpl* tls_int_state_ptr_ = nullptr;
@@ -111,8 +147,12 @@ struct TLSCurrentInterpreterGuard {
 
 // InterpreterState state that and used to compute a Code
 struct InterpreterStateImpl : c10::intrusive_ptr_target {
-  InterpreterStateImpl(const Code& code, TaskLauncher taskLauncher)
-      : taskLauncher_(std::move(taskLauncher)) {
+  InterpreterStateImpl(
+      const Code& code,
+      TaskLauncher taskLauncher,
+      std::vector<c10::Device> future_devices = {})
+      : taskLauncher_(std::move(taskLauncher)),
+        future_devices_(std::move(future_devices)) {
     enterFrame(code, 0);
   }
 
@@ -141,6 +181,10 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
   c10::intrusive_ptr<Future> future_;
   TaskLauncher taskLauncher_;
 
+  // devices the future should record events on when it completes; empty for
+  // CPU-only execution. See Note [Forked tasks on device streams].
+  std::vector<c10::Device> future_devices_;
+
   // this holds all the tensors for this interpreter run
   // we don't bother minimizing the size of this vector, since the extra
   // memory used by the pointers in this will be small
@@ -243,6 +287,11 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 #define INST_NEXT       \
   inst = INST_FETCH(1); \
   INST_DISPATCH
+// For fused superinstructions, which execute the absorbed next slot as
+// well; see Note [Superinstruction fusion] in code_impl.h.
+#define INST_NEXT2      \
+  inst = INST_FETCH(2); \
+  INST_DISPATCH
 
   bool runImpl(Stack& stack) {
     // if we have never run before, then we might have to return the
@@ -306,6 +355,11 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             frame.function->operator_table_[inst.X](stack);
           }
             INST_NEXT;
+          case INST(OPD): {
+            INST_GUARD;
+            frame.function->c10_operator_table_[inst.X].callBoxed(stack);
+          }
+            INST_NEXT;
           case INST(LOAD): {
             INST_GUARD;
             stack.emplace_back(reg(inst.X));
@@ -316,6 +370,30 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             stack.emplace_back(std::move(reg(inst.X)));
           }
             INST_NEXT;
+          case INST(LOAD2): {
+            INST_GUARD;
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(reg(inst.N));
+          }
+            INST_NEXT2;
+          case INST(MOVE2): {
+            INST_GUARD;
+            stack.emplace_back(std::move(reg(inst.X)));
+            stack.emplace_back(std::move(reg(inst.N)));
+          }
+            INST_NEXT2;
+          case INST(OPSTORE): {
+            INST_GUARD;
+            frame.function->operator_table_[inst.X](stack);
+            reg(inst.N) = pop(stack);
+          }
+            INST_NEXT2;
+          case INST(OPDSTORE): {
+            INST_GUARD;
+            frame.function->c10_operator_table_[inst.X].callBoxed(stack);
+            reg(inst.N) = pop(stack);
+          }
+            INST_NEXT2;
           case INST(STORE): {
             INST_GUARD;
             reg(inst.X) = pop(stack);
@@ -535,6 +613,19 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             for (i = 0; i < num_inputs; i++) {
               auto& input = peek(stack, i, num_inputs);
               auto& t = input.toTensor();
+              // Packed-signature sweep; can only accept, never reject. See
+              // Note [TypeCheck fast path] in code_impl.h.
+              const auto& sig =
+                  frame.function->type_check_signatures_[inst.X + i];
+              if (sig.valid && t.defined()) {
+                bool rg = at::GradMode::is_enabled() && t.requires_grad();
+                if (t.scalar_type() == sig.dtype &&
+                    t.device() == sig.device && rg == sig.requires_grad &&
+                    t.sizes().equals(sig.sizes) &&
+                    t.strides().equals(sig.strides)) {
+                  continue;
+                }
+              }
               const TypePtr& expected = frame.function->type_table_[inst.X + i];
               auto* expected_type = expected->castRaw<TensorType>();
               if (t.defined() && !expected_type->matchTensor(t)) {
@@ -650,15 +741,23 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             INST_GUARD;
             // Move inputs to a separate stack
             Function* forked_fn = frame.function->function_table_[inst.X];
+            auto fork_stream = streamForForkedTask();
+            std::vector<c10::Device> future_devices;
+            if (fork_stream) {
+              future_devices.push_back(fork_stream->device());
+            }
             InterpreterState forked_interpreter(
                 forked_fn->get_executor()
                     .getPlanFor(stack, GraphExecutor::getDefaultNumBailOuts())
                     .code,
-                taskLauncher_);
+                taskLauncher_,
+                std::move(future_devices));
             InterpreterContinuation continuation(
                 forked_interpreter,
                 Stack(stack.end() - inst.N, stack.end()),
-                getDistAutogradContextId());
+                getDistAutogradContextId(),
+                c10::nullopt,
+                fork_stream);
             drop(stack, inst.N);
             push(stack, forked_interpreter.getFuture());
             taskLauncher_(std::move(continuation));
@@ -734,6 +833,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
   }
 
 #undef INST_NEXT
+#undef INST_NEXT2
 #undef INST_DISPATCH
 #undef INST
 #undef INST_GUARD
@@ -911,8 +1011,8 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
 
   c10::intrusive_ptr<Future> getOrCreateFuture() {
     if (!future_) {
-      future_ =
-          c10::make_intrusive<Future>(frames.front().function->return_type_);
+      future_ = c10::make_intrusive<Future>(
+          frames.front().function->return_type_, future_devices_);
     }
     return future_;
   }
@@ -1041,10 +1141,14 @@ size_t Code::register_size() const {
   return pImpl->register_size_;
 }
 
-InterpreterState::InterpreterState(const Code& code, TaskLauncher taskLauncher)
+InterpreterState::InterpreterState(
+    const Code& code,
+    TaskLauncher taskLauncher,
+    std::vector<c10::Device> future_devices)
     : pImpl(c10::make_intrusive<InterpreterStateImpl>(
           code,
-          std::move(taskLauncher))) {}
+          std::move(taskLauncher),
+          std::move(future_devices))) {}
 InterpreterState::~InterpreterState() = default;
 
 void InterpreterState::run(Stack& stack) {
@@ -1068,6 +1172,7 @@ void InterpreterContinuation::operator()() {
   auto prev_dist_id = DistAutogradContainer::currentContextId();
   DistAutogradContainer::forceCurrentContextId(dist_autograd_context_id_);
 #endif
+  c10::OptionalStreamGuard stream_guard(stream_);
   if (tls_state_ != c10::nullopt) {
     at::ThreadLocalStateGuard g(*tls_state_);
     state.runAsync(stack);
@@ -1,4 +1,5 @@
 #pragma once
+#include <c10/core/Stream.h>
 #include <c10/util/Optional.h>
 #include <memory>
 #include <vector>
@@ -88,9 +89,14 @@ struct TORCH_API MobileCode : Code {
 };
 
 struct InterpreterState {
+  // future_devices, when non-empty, makes the state's future device-aware:
+  // on completion it records events on the current streams of those devices
+  // so consumers can synchronize instead of blocking. Used when forked tasks
+  // run on side streams; see Note [Forked tasks on device streams].
   TORCH_API InterpreterState(
       const Code& code,
-      TaskLauncher taskLauncher = at::launch);
+      TaskLauncher taskLauncher = at::launch,
+      std::vector<c10::Device> future_devices = {});
   TORCH_API void run(Stack& stack);
   TORCH_API c10::intrusive_ptr<Future> runAsync(Stack& stack);
   c10::intrusive_ptr<Future> getFuture();
@@ -127,10 +133,12 @@ struct InterpreterContinuation {
       const InterpreterState& state_,
       Stack stack_,
       int64_t dist_autograd_context_id = 0,
-      c10::optional<at::ThreadLocalState> tls_state = c10::nullopt)
+      c10::optional<at::ThreadLocalState> tls_state = c10::nullopt,
+      c10::optional<c10::Stream> stream = c10::nullopt)
       : state(state_),
         stack(std::move(stack_)),
-        tls_state_(std::move(tls_state)) {
+        tls_state_(std::move(tls_state)),
+        stream_(stream) {
 #ifdef USE_DISTRIBUTED
     dist_autograd_context_id_ = dist_autograd_context_id;
 #endif
@@ -142,6 +150,8 @@ struct InterpreterContinuation {
   InterpreterState state;
   Stack stack;
   c10::optional<at::ThreadLocalState> tls_state_ = c10::nullopt;
+  // if set, the continuation runs with this stream current on its device
+  c10::optional<c10::Stream> stream_ = c10::nullopt;
 #ifdef USE_DISTRIBUTED
   int64_t dist_autograd_context_id_;
 #endif
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -45,6 +46,29 @@ struct BailoutBlock {
   explicit BailoutBlock(size_t jf_index) : jf_instruction_index(jf_index) {}
 };
 
+// Note [TypeCheck fast path]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// prim::TypeCheck guards re-verify the full profiled tensor type (dtype,
+// device, requires_grad, sizes and stride properties) on every invocation
+// through TensorType::matchTensor, which allocates a VaryingShape and
+// recomputes stride properties per input. For graphs with many guarded
+// inputs this shows up in small-model latency. When the profiled type is
+// complete, concrete and contiguous, we precompile it at emit time into a
+// packed signature that the interpreter can sweep with plain scalar and
+// size/stride-array comparisons; any tensor that fails the packed
+// comparison (or any type that does not get a signature, e.g. with
+// symbolic dimensions or non-contiguous stride properties) falls back to
+// matchTensor for the exact answer, so the fast path can only accept,
+// never reject.
+struct TypeCheckSignature {
+  bool valid = false;
+  at::ScalarType dtype = at::ScalarType::Undefined;
+  c10::Device device = c10::Device(c10::DeviceType::CPU);
+  bool requires_grad = false;
+  std::vector<int64_t> sizes;
+  std::vector<int64_t> strides;
+};
+
 // for keeping track of the current node
 struct WithCurrentNode {
   WithCurrentNode(Node** loc, Node* new_value) : loc_(loc), old_value_(*loc_) {
@@ -77,9 +101,18 @@ struct CodeImpl {
       int,
       std::function<size_t(const std::pair<std::string, int>& p)>>
       operator_table_inv_;
+  // operators invoked through OPD instructions; holding the dispatcher
+  // handle here lets the interpreter call into the dispatcher directly
+  // instead of going through a type-erased Operation (see emitOperator)
+  std::vector<c10::OperatorHandle> c10_operator_table_;
+  // map<op name, index in c10 operator table>, to avoid duplicates
+  std::unordered_map<std::string, int> c10_operator_table_inv_;
   std::vector<Function*> function_table_;
   std::vector<std::unique_ptr<GraphFunction>> forked_functions_;
   std::vector<TypePtr> type_table_;
+  // precompiled fast-accept signatures for TYPECHECK guards, parallel to
+  // type_table_; see Note [TypeCheck fast path]
+  std::vector<TypeCheckSignature> type_check_signatures_;
   std::vector<std::function<void(std::vector<IValue>&)>>
       profile_function_table_;
 
@@ -129,6 +162,12 @@ struct CodeImpl {
   std::vector<std::unique_ptr<Function>> bailout_functions_;
   size_t remaining_bailout_depth_;
 
+  // whether emitOperator may emit OPD instructions, which invoke c10
+  // operators through their dispatcher handle instead of the generic
+  // operator table. Disabled for mobile, whose bytecode format and
+  // interpreter do not know about OPD.
+  bool emit_direct_c10_dispatch_ = true;
+
   CodeImpl(
       const std::shared_ptr<Graph>& graph,
       std::string function_name,
@@ -171,6 +210,52 @@ struct CodeImpl {
     // we deferred the emission of bailout blocks so they appear at the end
     // emit them now and patch up the jumps
     insertBailoutBlocks();
+    fuseInstructions();
+  }
+
+  // Note [Superinstruction fusion]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Small graphs are dispatch bound: sequences like LOAD;LOAD;OP;STORE
+  // cost four trips through the interpreter's dispatch for a few machine
+  // instructions of real work. After emission we peephole adjacent pairs
+  // into fused superinstructions (LOAD2, MOVE2, OPSTORE, OPDSTORE) that
+  // do both halves in one dispatch; the canonical four-instruction
+  // sequence becomes LOAD2;OPSTORE, i.e. two dispatches.
+  //
+  // Only the first slot of a pair is rewritten; the absorbed instruction
+  // stays in place and the fused handler advances the pc by two. This
+  // keeps every instruction index valid: jumps that land on the second
+  // slot execute it stand-alone, and pc-based machinery (suspension,
+  // exception reporting, GUARD patching) is unaffected. Pairs are fused
+  // only when both slots come from the same source node, so debug
+  // attribution through instructions_source_ stays exact. Mobile code
+  // (MobileCodeImpl::run) does not fuse; its interpreter does not know
+  // these opcodes.
+  void fuseInstructions() {
+    for (size_t i = 0; i + 1 < instructions_.size(); ++i) {
+      Instruction& first = instructions_[i];
+      const Instruction& second = instructions_[i + 1];
+      if (instructions_source_[i] != instructions_source_[i + 1]) {
+        continue;
+      }
+      // The absorbed operand has to be encodable in the 16-bit N field.
+      if (second.X < 0 || second.X > std::numeric_limits<uint16_t>::max()) {
+        continue;
+      }
+      if (first.op == LOAD && second.op == LOAD) {
+        first = Instruction(LOAD2, first.X, second.X);
+      } else if (first.op == MOVE && second.op == MOVE) {
+        first = Instruction(MOVE2, first.X, second.X);
+      } else if (first.op == OP && second.op == STORE) {
+        first = Instruction(OPSTORE, first.X, second.X);
+      } else if (first.op == OPD && second.op == STORE) {
+        first = Instruction(OPDSTORE, first.X, second.X);
+      } else {
+        continue;
+      }
+      // Skip the absorbed slot so it is not fused a second time.
+      ++i;
+    }
   }
 
   const std::vector<c10::IValue>& constant_table() const {
@@ -217,7 +302,7 @@ struct CodeImpl {
     instructions_source_.emplace_back(current_node_);
 
     // check that we didn't accidentally emit nodes out of topological order
-    if (op == OP) {
+    if (op == OP || op == OPD) {
       if (last_inserted_op_ != nullptr && current_node_ != last_inserted_op_ &&
           current_node_->owningBlock() == last_inserted_op_->owningBlock()) {
         TORCH_INTERNAL_ASSERT(
@@ -320,6 +405,19 @@ struct CodeImpl {
     int num_inputs = node->inputs().size();
     bool is_vararg = op.schema().is_vararg();
 
+    if (emit_direct_c10_dispatch_ && !is_vararg) {
+      if (auto handle = op.c10Handle()) {
+        // For c10-backed operators the Operation stored in operator_table_
+        // is just a closure over the handle calling callBoxed, so resolve
+        // the dispatch target at emit time and invoke the dispatcher
+        // directly from the instruction loop. The dispatch key set is still
+        // computed from the actual arguments on every execution, so the
+        // kernel tracks input tensor types as usual.
+        insertInstruction(OPD, add_to_c10_operator_table(*handle));
+        return;
+      }
+    }
+
     int operation_index = add_to_operator_table(
         op.getOperation(node),
         c10::toString(op.schema().operator_name()),
@@ -421,9 +519,48 @@ struct CodeImpl {
   size_t emitType(TypePtr t) {
     size_t r = type_table_.size();
     type_table_.emplace_back(std::move(t));
+    // keep the signature table aligned; only emitTypeCheck fills entries in
+    type_check_signatures_.emplace_back();
     return r;
   }
 
+  // Precompile a packed fast-accept signature for a profiled type. Only
+  // complete, concrete and contiguous tensor types get one; everything else
+  // keeps an invalid signature and is checked with matchTensor at runtime.
+  // See Note [TypeCheck fast path].
+  static TypeCheckSignature buildTypeCheckSignature(const TypePtr& type) {
+    TypeCheckSignature sig;
+    auto* tensor_type = type->castRaw<TensorType>();
+    if (!tensor_type) {
+      return sig;
+    }
+    auto scalar_type = tensor_type->scalarType();
+    auto device = tensor_type->device();
+    auto requires_grad = tensor_type->requiresGrad();
+    auto sizes = tensor_type->sizes().concrete_sizes();
+    if (!scalar_type || !device || !requires_grad || !sizes ||
+        tensor_type->undefined().value_or(false)) {
+      return sig;
+    }
+    // The runtime fast path only accepts tensors whose strides are exactly
+    // the canonical contiguous ones (for which is_contiguous() is always
+    // true), so the profiled stride properties must match what matchTensor
+    // computes for such a tensor.
+    auto strides = TensorType::contiguousStridesOf(*sizes);
+    auto contiguous_props = TensorType::computeStrideProps(
+        *sizes, strides, /*tensor_contiguity=*/true);
+    if (!(tensor_type->stride_properties() == contiguous_props)) {
+      return sig;
+    }
+    sig.valid = true;
+    sig.dtype = *scalar_type;
+    sig.device = *device;
+    sig.requires_grad = *requires_grad;
+    sig.sizes = std::move(*sizes);
+    sig.strides = std::move(strides);
+    return sig;
+  }
+
   void emitTypeCheck(Node* node) {
     auto num_inputs = node->inputs().size();
 
@@ -436,7 +573,8 @@ struct CodeImpl {
     size_t types_start = type_table_.size();
     auto types = node->tys(attr::types);
     for (const auto i : c10::irange(num_inputs)) {
-      emitType(types[i]);
+      auto type_index = emitType(types[i]);
+      type_check_signatures_[type_index] = buildTypeCheckSignature(types[i]);
     }
     insertInstruction(TYPECHECK, types_start, num_inputs);
   }
@@ -723,7 +861,7 @@ struct CodeImpl {
   void dump(std::ostream& out, size_t i) const {
     out << i << " " << instructions_[i];
     if (instructions_[i].op == OP || instructions_[i].op == CALL ||
-        instructions_[i].op == OPN) {
+        instructions_[i].op == OPN || instructions_[i].op == OPD) {
       out << " # " << *instructions_source_[i];
     } else {
       out << "\n";
@@ -761,6 +899,22 @@ struct CodeImpl {
     operator_table_.emplace_back(oper);
     return size;
   }
+
+  /**
+   * Add a c10 operator handle to c10_operator_table_ if not a duplicate and
+   * return its index
+   */
+  int add_to_c10_operator_table(const c10::OperatorHandle& handle) {
+    int size = c10_operator_table_.size();
+    std::string key = c10::toString(handle.operator_name());
+    auto found = c10_operator_table_inv_.find(key);
+    if (found != c10_operator_table_inv_.end()) {
+      return found->second;
+    }
+    c10_operator_table_inv_.emplace(std::move(key), size);
+    c10_operator_table_.emplace_back(handle);
+    return size;
+  }
 };
 
 struct MobileCodeImpl : CodeImpl {
@@ -773,6 +927,7 @@ struct MobileCodeImpl : CodeImpl {
       : CodeImpl(graph, function_name, remaining_bailout_depth, false),
         emit_default_input_instructions_(emit_default_input_instructions),
         support_default_args_before_out_(support_default_args_before_out) {
+    emit_direct_c10_dispatch_ = false;
     // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
     run();
   }
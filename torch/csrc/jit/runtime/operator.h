@@ -147,6 +147,19 @@ struct TORCH_API Operator {
     return op_.is_left();
   }
 
+  // The dispatcher handle backing a c10 operator, or nullopt for a pure JIT
+  // operator. Lets callers invoke the operator through the dispatcher
+  // directly instead of going through the type-erased Operation wrapper.
+  c10::optional<c10::OperatorHandle> c10Handle() const {
+    return op_.fold<c10::optional<c10::OperatorHandle>>(
+        [](const C10Operator& op) {
+          return c10::optional<c10::OperatorHandle>(op.handle_);
+        },
+        [](const JitOnlyOperator&) {
+          return c10::optional<c10::OperatorHandle>(c10::nullopt);
+        });
+  }
+
   c10::AliasAnalysisKind aliasAnalysisKind() const {
     const FunctionSchema& schemaRef = schema();
     c10::AliasAnalysisKind alias_analysis = schemaRef.aliasAnalysis();
@@ -0,0 +1,248 @@
+#include <torch/csrc/jit/runtime/pipeline.h>
+
+#include <c10/core/DeviceGuard.h>
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/irange.h>
+#include <c10/util/thread_name.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Moves every tensor inside the value to the given device, recursing
+// through tuples and lists; non-tensor values pass through untouched.
+IValue toDevice(const IValue& value, c10::Device device, bool non_blocking) {
+  if (value.isTensor()) {
+    const auto& tensor = value.toTensor();
+    if (!tensor.defined() || tensor.device() == device) {
+      return value;
+    }
+    return tensor.to(device, non_blocking);
+  }
+  if (value.isTuple()) {
+    const auto& elements = value.toTuple()->elements();
+    std::vector<IValue> moved;
+    moved.reserve(elements.size());
+    for (const auto& element : elements) {
+      moved.push_back(toDevice(element, device, non_blocking));
+    }
+    return c10::ivalue::Tuple::create(std::move(moved));
+  }
+  if (value.isList()) {
+    const auto& list = value.toList();
+    auto moved = c10::impl::GenericList(list.elementType());
+    moved.reserve(list.size());
+    for (const auto i : c10::irange(list.size())) {
+      moved.push_back(toDevice(list.get(i), device, non_blocking));
+    }
+    return moved;
+  }
+  return value;
+}
+
+} // namespace
+
+struct Pipeline::Task {
+  std::vector<IValue> inputs;
+  // Recorded on the producing stage's compute stream; the consumer
+  // orders its reads of inputs after this event.
+  c10::optional<c10::Event> event;
+  c10::intrusive_ptr<c10::ivalue::Future> result;
+};
+
+struct Pipeline::Stage {
+  Module module;
+  c10::Device device;
+  // Compute and copy streams. Only populated for devices with stream
+  // support; CPU stages run inline on the worker thread.
+  c10::optional<c10::Stream> stream;
+  c10::optional<c10::Stream> copy_stream;
+
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<Task> tasks;
+  bool shutdown = false;
+  std::thread worker;
+
+  Stage(Module module, c10::Device device)
+      : module(std::move(module)), device(device) {}
+};
+
+Pipeline::Pipeline(
+    Module module,
+    std::vector<std::string> stage_names,
+    std::vector<c10::Device> devices,
+    PipelineOptions options)
+    : options_(options) {
+  TORCH_CHECK(!stage_names.empty(), "Pipeline requires at least one stage");
+  TORCH_CHECK(
+      stage_names.size() == devices.size(),
+      "Pipeline: got ",
+      stage_names.size(),
+      " stage names but ",
+      devices.size(),
+      " devices");
+  TORCH_CHECK(
+      options_.queue_capacity > 0, "Pipeline: queue_capacity must be positive");
+
+  stages_.reserve(stage_names.size());
+  for (const auto i : c10::irange(stage_names.size())) {
+    auto stage = std::make_unique<Stage>(
+        module.attr(stage_names[i]).toModule(), devices[i]);
+    stage->module.to(stage->device);
+    if (stage->device.type() != c10::DeviceType::CPU) {
+      c10::impl::VirtualGuardImpl impl(stage->device.type());
+      stage->stream = impl.getStreamFromGlobalPool(stage->device);
+      stage->copy_stream = impl.getStreamFromGlobalPool(stage->device);
+      if (std::find(
+              future_devices_.begin(), future_devices_.end(),
+              stage->device) == future_devices_.end()) {
+        future_devices_.push_back(stage->device);
+      }
+    }
+    stages_.push_back(std::move(stage));
+  }
+
+  for (const auto i : c10::irange(stages_.size())) {
+    stages_[i]->worker = std::thread([this, i]() { workerLoop(i); });
+  }
+}
+
+Pipeline::~Pipeline() {
+  // Stop the stages front to back so in-flight micro-batches drain
+  // through the tail of the pipeline instead of erroring out mid-way.
+  for (auto& stage : stages_) {
+    {
+      std::lock_guard<std::mutex> lock(stage->mutex);
+      stage->shutdown = true;
+    }
+    stage->not_empty.notify_all();
+    stage->not_full.notify_all();
+    if (stage->worker.joinable()) {
+      stage->worker.join();
+    }
+  }
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> Pipeline::forwardAsync(
+    std::vector<IValue> inputs) {
+  auto future = c10::make_intrusive<c10::ivalue::Future>(
+      c10::AnyType::get(), future_devices_);
+  Task task;
+  task.inputs = std::move(inputs);
+  task.result = future;
+  enqueue(0, std::move(task));
+  return future;
+}
+
+IValue Pipeline::forward(std::vector<IValue> inputs) {
+  auto future = forwardAsync(std::move(inputs));
+  future->waitAndThrow();
+  return future->value();
+}
+
+void Pipeline::enqueue(size_t stage_index, Task task) {
+  auto& stage = *stages_[stage_index];
+  {
+    std::unique_lock<std::mutex> lock(stage.mutex);
+    stage.not_full.wait(lock, [&]() {
+      return stage.shutdown || stage.tasks.size() < options_.queue_capacity;
+    });
+    TORCH_CHECK(!stage.shutdown, "Pipeline has been shut down");
+    stage.tasks.push_back(std::move(task));
+  }
+  stage.not_empty.notify_one();
+}
+
+void Pipeline::workerLoop(size_t stage_index) {
+  c10::setThreadName("pt_pipeline");
+  auto& stage = *stages_[stage_index];
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(stage.mutex);
+      stage.not_empty.wait(
+          lock, [&]() { return stage.shutdown || !stage.tasks.empty(); });
+      if (stage.tasks.empty()) {
+        // Shut down and drained.
+        return;
+      }
+      task = std::move(stage.tasks.front());
+      stage.tasks.pop_front();
+    }
+    stage.not_full.notify_one();
+
+    try {
+      c10::DeviceGuard device_guard(stage.device);
+
+      // Order our reads of the producer's outputs after its compute. A
+      // stream-capable stage blocks its copy stream; a CPU stage blocks
+      // the producer device's current stream, which the synchronous
+      // copies below then run on.
+      if (task.event) {
+        task.event->block(
+            stage.copy_stream ? *stage.copy_stream
+                              : c10::impl::VirtualGuardImpl(
+                                    task.event->device_type())
+                                    .getStream(task.event->device()));
+      }
+
+      std::vector<IValue> inputs;
+      inputs.reserve(task.inputs.size());
+      if (stage.copy_stream) {
+        // Stage the inputs on the copy stream so the transfer overlaps
+        // with whatever is still running on the compute stream, then
+        // hand them over with an event.
+        c10::StreamGuard copy_guard(*stage.copy_stream);
+        for (const auto& input : task.inputs) {
+          inputs.push_back(
+              toDevice(input, stage.device, /*non_blocking=*/true));
+        }
+        c10::Event copied(stage.device.type());
+        copied.record(*stage.copy_stream);
+        copied.block(*stage.stream);
+      } else {
+        for (const auto& input : task.inputs) {
+          inputs.push_back(
+              toDevice(input, stage.device, /*non_blocking=*/false));
+        }
+      }
+
+      c10::OptionalStreamGuard stream_guard;
+      if (stage.stream) {
+        stream_guard.reset_stream(*stage.stream);
+      }
+      auto output = stage.module.forward(std::move(inputs));
+
+      if (stage_index + 1 < stages_.size()) {
+        Task next;
+        next.inputs.push_back(std::move(output));
+        next.result = std::move(task.result);
+        if (stage.stream) {
+          next.event.emplace(stage.device.type());
+          next.event->record(*stage.stream);
+        }
+        enqueue(stage_index + 1, std::move(next));
+      } else {
+        // The stream guard is still active, so the future records its
+        // completion events on this stage's compute stream; wait()ing
+        // consumers synchronize through the Future's stream semantics.
+        task.result->markCompleted(std::move(output));
+      }
+    } catch (...) {
+      task.result->setError(std::current_exception());
+    }
+  }
+}
+
+} // namespace jit
+} // namespace torch
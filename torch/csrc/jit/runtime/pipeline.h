@@ -0,0 +1,90 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/api/module.h>
+
+#include <c10/core/Device.h>
+#include <c10/core/Stream.h>
+#include <c10/util/Optional.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Inter-op inference pipeline over a partitioned Module.
+ *
+ * A Pipeline partitions a Module at submodule boundaries: each named
+ * direct submodule becomes one stage, placed on its own device and
+ * driven by its own worker thread. Micro-batches submitted through
+ * forwardAsync flow through the stages in order over bounded queues, so
+ * stage k runs micro-batch n while stage k+1 is still busy with
+ * micro-batch n-1, and submission applies backpressure once
+ * queue_capacity micro-batches are in flight ahead of the first stage.
+ *
+ * Each stream-capable stage owns a compute stream and a copy stream:
+ * the inputs handed over by the previous stage are staged onto the
+ * stage's device on the copy stream (ordered after the producer's
+ * compute by an event carried with the micro-batch), so
+ * device-to-device transfers overlap with the stage's own compute.
+ * Results are surfaced as ivalue::Future, which records the stage
+ * streams at completion time; wait()ing consumers are synchronized
+ * through the usual Future stream semantics rather than host blocking.
+ *
+ * This runs entirely in C++ worker threads; there is no Python (or GIL)
+ * involvement in stage handoff.
+ */
+
+namespace torch {
+namespace jit {
+
+struct PipelineOptions {
+  // Maximum number of micro-batches queued in front of each stage.
+  // forwardAsync blocks when the first stage's queue is full, bounding
+  // the memory held by in-flight activations.
+  size_t queue_capacity = 2;
+};
+
+// See the file comment. Construction moves each stage submodule to its
+// device; the destructor drains in-flight micro-batches front to back
+// before joining the workers.
+class TORCH_API Pipeline {
+ public:
+  Pipeline(
+      Module module,
+      std::vector<std::string> stage_names,
+      std::vector<c10::Device> devices,
+      PipelineOptions options = PipelineOptions());
+  ~Pipeline();
+
+  Pipeline(const Pipeline&) = delete;
+  Pipeline& operator=(const Pipeline&) = delete;
+
+  // Submits one micro-batch and returns a Future that is completed with
+  // the last stage's output (or the first stage error encountered).
+  // Blocks when queue_capacity micro-batches are already waiting for the
+  // first stage.
+  c10::intrusive_ptr<c10::ivalue::Future> forwardAsync(
+      std::vector<IValue> inputs);
+
+  // Synchronous convenience wrapper around forwardAsync.
+  IValue forward(std::vector<IValue> inputs);
+
+ private:
+  struct Task;
+  struct Stage;
+
+  void enqueue(size_t stage_index, Task task);
+  void workerLoop(size_t stage_index);
+
+  std::vector<std::unique_ptr<Stage>> stages_;
+  // Stream-capable stage devices, deduplicated; result futures are
+  // created over these so that Future::wait synchronizes with the stage
+  // streams.
+  std::vector<c10::Device> future_devices_;
+  PipelineOptions options_;
+};
+
+} // namespace jit
+} // namespace torch
@@ -2,6 +2,7 @@
 
 #include <c10/util/irange.h>
 #include <torch/csrc/jit/jit_log.h>
+#include <torch/csrc/jit/jit_pass_timing.h>
 #include <torch/csrc/jit/passes/bailout_graph.h>
 #include <torch/csrc/jit/passes/batch_mm.h>
 #include <torch/csrc/jit/passes/canonicalize_graph_fuser_ops.h>
@@ -14,6 +15,8 @@
 #include <torch/csrc/jit/passes/cuda_graph_fuser.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/decompose_ops.h>
+#include <torch/csrc/jit/passes/fuse_attention.h>
+#include <torch/csrc/jit/passes/fuse_parallel_linear.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/guard_elimination.h>
 #include <torch/csrc/jit/passes/inline_autodiff_subgraphs.h>
@@ -23,6 +26,7 @@
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_grad_of.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
+#include <torch/csrc/jit/passes/parallelize_branches.h>
 #include <torch/csrc/jit/passes/pass_manager.h>
 #include <torch/csrc/jit/passes/peephole.h>
 #include <torch/csrc/jit/passes/remove_expands.h>
@@ -55,6 +59,16 @@ C10_DEFINE_int64(
     torch_jit_bailout_depth,
     kDefaultBailoutDepth,
     "Number of re-specializations");
+C10_DEFINE_int64(
+    torch_jit_shape_plan_cache_size,
+    0,
+    "Maximum number of per-shape execution plans cached by an executor; "
+    "0 keeps the single-plan behavior");
+C10_DEFINE_bool(
+    torch_jit_background_compilation,
+    false,
+    "Compile optimized execution plans on a side thread while requests "
+    "keep running the instrumented graph");
 
 namespace torch {
 namespace jit {
@@ -96,6 +110,28 @@ std::atomic<size_t>& getBailoutDepth() {
   return bailout_depth;
 }
 
+static std::atomic<size_t> shape_plan_cache_size{0};
+
+std::atomic<size_t>& getShapePlanCacheSize() {
+  // Initialize shape_plan_cache_size from command-line flag.
+  static const size_t init = []() {
+    return shape_plan_cache_size = FLAGS_torch_jit_shape_plan_cache_size;
+  }();
+  (void)init; // Silence clang-tidy.
+  return shape_plan_cache_size;
+}
+
+static std::atomic<bool> background_compilation{false};
+
+std::atomic<bool>& getBackgroundCompilation() {
+  // Initialize background_compilation from command-line flag.
+  static const bool init = []() {
+    return background_compilation = FLAGS_torch_jit_background_compilation;
+  }();
+  (void)init; // Silence clang-tidy.
+  return background_compilation;
+}
+
 static bool needsGradientInProfilingMode(Block* b) {
   for (auto n : b->nodes()) {
     if (n->kind() == prim::BailOut) {
@@ -250,149 +286,169 @@ bool guardDifferentiableGraph(Node* dnode) {
 }
 
 void runNooptPassPipeline(std::shared_ptr<Graph>& graph) {
+  PassTimingGuard pipeline_timing_guard("runNooptPassPipeline", *graph);
   GRAPH_DEBUG(
       "Before LowerGradOf (beginning of runNooptPassPipeline)\n", *graph);
-  LowerGradOf(*graph);
+  JIT_TIMED_PASS("LowerGradOf", *graph, LowerGradOf(*graph));
   GRAPH_DEBUG("After LowerGradOf, before RemoveExpands\n", *graph);
-  RemoveExpands(graph);
+  JIT_TIMED_PASS("RemoveExpands", *graph, RemoveExpands(graph));
   GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-  CanonicalizeOps(graph);
+  JIT_TIMED_PASS("CanonicalizeOps", *graph, CanonicalizeOps(graph));
   GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
   GRAPH_DEBUG(
       "After EliminateDeadCode (end of runNooptPassPipeline)\n", *graph);
 }
 
 void runPreAutodiffPassPipeline(std::shared_ptr<Graph>& graph) {
+  PassTimingGuard pipeline_timing_guard("runPreAutodiffPassPipeline", *graph);
   GRAPH_DEBUG(
       "Before InsertGuards (beginning of runPreAutodiffPassPipeline)\n",
       *graph);
 
   if (tensorExprFuserEnabled() || RegisterCudaFuseGraph::isRegistered()) {
     // With TE fuser or nvfuser, we don't generate bailouts
-    LowerGradOf(*graph);
+    JIT_TIMED_PASS("LowerGradOf", *graph, LowerGradOf(*graph));
     GRAPH_DEBUG("After LowerGradOf, before specializeAutogradZero\n", *graph);
   } else {
-    InsertGuards(graph);
+    JIT_TIMED_PASS("InsertGuards", *graph, InsertGuards(graph));
     GRAPH_DEBUG("After InsertGuards, before LowerGradOf\n", *graph);
-    LowerGradOf(*graph);
+    JIT_TIMED_PASS("LowerGradOf", *graph, LowerGradOf(*graph));
     GRAPH_DEBUG("After LowerGradOf, before EliminateRedundantGuards\n", *graph);
-    EliminateRedundantGuards(graph);
+    JIT_TIMED_PASS(
+        "EliminateRedundantGuards", *graph, EliminateRedundantGuards(graph));
     GRAPH_DEBUG(
         "After EliminateRedundantGuards, before InsertBailOuts\n", *graph);
-    InsertBailOuts(graph);
+    JIT_TIMED_PASS("InsertBailOuts", *graph, InsertBailOuts(graph));
     GRAPH_DEBUG(
         "After InsertBailOuts, before specializeAutogradZero\n", *graph);
   }
 
-  specializeAutogradZero(graph);
+  JIT_TIMED_PASS(
+      "specializeAutogradZero", *graph, specializeAutogradZero(graph));
   GRAPH_DEBUG("After specializeAutogradZero\n", *graph);
   // runRequiredPasses
   {
-    RemoveExpands(graph);
+    JIT_TIMED_PASS("RemoveExpands", *graph, RemoveExpands(graph));
     GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-    CanonicalizeOps(graph);
+    JIT_TIMED_PASS("CanonicalizeOps", *graph, CanonicalizeOps(graph));
     GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-    EliminateDeadCode(graph);
+    JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
     GRAPH_DEBUG("After EliminateDeadCode", *graph);
   }
-  PeepholeOptimize(graph);
+  JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
   GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-  ConstantPropagation(graph);
+  JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
 
   // runOptimization:
   {
-    EliminateDeadCode(graph);
+    JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
     GRAPH_DEBUG(
         "After EliminateDeadCode, before EliminateCommonSubexpression\n",
         *graph);
-    EliminateCommonSubexpression(graph);
+    JIT_TIMED_PASS(
+        "EliminateCommonSubexpression",
+        *graph,
+        EliminateCommonSubexpression(graph));
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before PeepholeOptimize\n",
         *graph);
 
-    PeepholeOptimize(graph);
+    JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
     GRAPH_DEBUG("After ConstantPropagation, before ConstantPooling\n", *graph);
-    ConstantPooling(graph);
+    JIT_TIMED_PASS("ConstantPooling", *graph, ConstantPooling(graph));
     GRAPH_DEBUG("After ConstantPooling, before UnrollLoops\n", *graph);
 
-    UnrollLoops(graph);
+    JIT_TIMED_PASS("UnrollLoops", *graph, UnrollLoops(graph));
     GRAPH_DEBUG("After UnrollLoops, before RemoveListMutation\n", *graph);
     // run again with unrolled loops
-    RemoveListMutation(graph);
+    JIT_TIMED_PASS("RemoveListMutation", *graph, RemoveListMutation(graph));
     GRAPH_DEBUG("After RemoveListMutation, before PeepholeOptimize\n", *graph);
-    PeepholeOptimize(graph);
+    JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
     GRAPH_DEBUG(
         "After ConstantPropagation, before EliminateCommonSubexpression\n",
         *graph);
 
-    EliminateCommonSubexpression(graph);
+    JIT_TIMED_PASS(
+        "EliminateCommonSubexpression",
+        *graph,
+        EliminateCommonSubexpression(graph));
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before CheckInplace\n", *graph);
 
-    CheckInplace(graph);
+    JIT_TIMED_PASS("CheckInplace", *graph, CheckInplace(graph));
   }
   GRAPH_DEBUG(
       "After CheckInplace (end of runPreAutodiffPassPipeline)\n", *graph);
 }
 
 void runDiffGraphPasses(std::shared_ptr<Graph>& graph) {
+  PassTimingGuard pipeline_timing_guard("runDiffGraphPasses", *graph);
   GRAPH_DEBUG(
       "Before EliminateDeadCode (beginning of runDiffGraphPasses)\n", *graph);
   // runOptimization:
   {
     // Basic graph preprocessing to eliminate noise.
-    EliminateDeadCode(graph);
+    JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
     GRAPH_DEBUG(
         "After EliminateDeadCode, before EliminateCommonSubexpression\n",
         *graph);
-    EliminateCommonSubexpression(graph);
+    JIT_TIMED_PASS(
+        "EliminateCommonSubexpression",
+        *graph,
+        EliminateCommonSubexpression(graph));
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before PeepholeOptimize\n",
         *graph);
 
-    PeepholeOptimize(graph);
+    JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
     GRAPH_DEBUG("After ConstantPropagation, before ConstantPooling\n", *graph);
-    ConstantPooling(graph);
+    JIT_TIMED_PASS("ConstantPooling", *graph, ConstantPooling(graph));
     GRAPH_DEBUG("After ConstantPooling, before UnrollLoops\n", *graph);
 
-    UnrollLoops(graph);
+    JIT_TIMED_PASS("UnrollLoops", *graph, UnrollLoops(graph));
     GRAPH_DEBUG("After UnrollLoops, before RemoveListMutation\n", *graph);
     // run again with unrolled loops
-    RemoveListMutation(graph);
+    JIT_TIMED_PASS("RemoveListMutation", *graph, RemoveListMutation(graph));
     GRAPH_DEBUG("After RemoveListMutation, before PeepholeOptimize\n", *graph);
-    PeepholeOptimize(graph);
+    JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
     GRAPH_DEBUG("After PeepholeOptimize, before ConstantPropagation\n", *graph);
-    ConstantPropagation(graph);
+    JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
     GRAPH_DEBUG(
         "After ConstantPropagation, before EliminateCommonSubexpression\n",
         *graph);
 
-    EliminateCommonSubexpression(graph);
+    JIT_TIMED_PASS(
+        "EliminateCommonSubexpression",
+        *graph,
+        EliminateCommonSubexpression(graph));
     GRAPH_DEBUG(
         "After EliminateCommonSubexpression, before CheckInplace\n", *graph);
 
-    CheckInplace(graph);
+    JIT_TIMED_PASS("CheckInplace", *graph, CheckInplace(graph));
   }
   GRAPH_DEBUG("After CheckInplace, before customPrePasses\n", *graph);
 
   // runNondiffOptimization
   {
     // Run custom passes that different backends can register.
-    for (const auto& passPair : getCustomPrePasses()) {
-      passPair.first(graph);
+    {
+      PassTimingGuard custom_pass_timing_guard("customPrePasses", *graph);
+      for (const auto& passPair : getCustomPrePasses()) {
+        passPair.first(graph);
+      }
     }
     GRAPH_DEBUG("After customPrePasses, before LowerSimpleTuples\n", *graph);
 
     // TupleConstruct / TupleUnpack pairs can still be present at this point
     // and must be removed for fusion.
-    LowerSimpleTuples(graph);
+    JIT_TIMED_PASS("LowerSimpleTuples", *graph, LowerSimpleTuples(graph));
     GRAPH_DEBUG("After LowerSimpleTuples\n", *graph);
 
     if (tensorExprFuserEnabled()) {
@@ -404,54 +460,70 @@ void runDiffGraphPasses(std::shared_ptr<Graph>& graph) {
       // inserting proper type checks. Once we're done with these optimizations
       // we will wipe the tensor type information from the IR, so that it's not
       // accidentally used by any other pass.
-      RemoveProfileNodesAndSpecializeTypes(graph);
+      JIT_TIMED_PASS(
+          "RemoveProfileNodesAndSpecializeTypes",
+          *graph,
+          RemoveProfileNodesAndSpecializeTypes(graph));
       GRAPH_DEBUG(
           "After RemoveProfileNodesAndSpecializeTypes, before BatchMM\n",
           *graph);
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      JIT_TIMED_PASS("BatchMM", *graph, BatchMM(graph));
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
 
-      FuseTensorExprs(graph, getFusionGroupInlining() ? 2 : 1);
+      JIT_TIMED_PASS(
+          "FuseTensorExprs",
+          *graph,
+          FuseTensorExprs(graph, getFusionGroupInlining() ? 2 : 1));
       GRAPH_DEBUG(
           "After Fusion, before RemoveTensorTypeSpecializations\n", *graph);
 
       // Wipe tensor type info from the IR
-      RemoveTensorTypeSpecializations(graph);
+      JIT_TIMED_PASS(
+          "RemoveTensorTypeSpecializations",
+          *graph,
+          RemoveTensorTypeSpecializations(graph));
       GRAPH_DEBUG(
           "After RemoveTensorTypeSpecializations, before customPostPasses\n",
           *graph);
     } else {
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      JIT_TIMED_PASS("BatchMM", *graph, BatchMM(graph));
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
 
-      FuseGraph(graph, true);
+      JIT_TIMED_PASS("FuseGraph", *graph, FuseGraph(graph, true));
       GRAPH_DEBUG("After Fusion, before customPostPasses\n", *graph);
     }
 
     // Run custom post-fusion passes
-    for (const auto& passPair : getCustomPostPasses()) {
-      passPair.first(graph);
+    {
+      PassTimingGuard custom_pass_timing_guard("customPostPasses", *graph);
+      for (const auto& passPair : getCustomPostPasses()) {
+        passPair.first(graph);
+      }
     }
   }
   GRAPH_DEBUG("After customPostPasses (end of runDiffGraphPasses)\n", *graph);
 }
 
 void runNoGradOptimizations(std::shared_ptr<Graph>& graph) {
+  PassTimingGuard pipeline_timing_guard("runNoGradOptimizations", *graph);
   GRAPH_DEBUG(
       "After customPostPasses (beginning of runNoGradOptimizations)\n", *graph);
   // runNondiffOptimization
   {
     // Run custom passes that different backends can register.
-    for (const auto& passPair : getCustomPrePasses()) {
-      passPair.first(graph);
+    {
+      PassTimingGuard custom_pass_timing_guard("customPrePasses", *graph);
+      for (const auto& passPair : getCustomPrePasses()) {
+        passPair.first(graph);
+      }
     }
     GRAPH_DEBUG("After customPrePasses, before LowerSimpleTuples\n", *graph);
 
     // TupleConstruct / TupleUnpack pairs can still be present at this point
     // and must be removed for fusion.
-    LowerSimpleTuples(graph);
+    JIT_TIMED_PASS("LowerSimpleTuples", *graph, LowerSimpleTuples(graph));
     GRAPH_DEBUG("After LowerSimpleTuples\n", *graph);
 
     if (tensorExprFuserEnabled()) {
@@ -463,35 +535,47 @@ void runNoGradOptimizations(std::shared_ptr<Graph>& graph) {
       // inserting proper type checks. Once we're done with these optimizations
       // we will wipe the tensor type information from the IR, so that it's not
       // accidentally used by any other pass.
-      RemoveProfileNodesAndSpecializeTypes(graph);
+      JIT_TIMED_PASS(
+          "RemoveProfileNodesAndSpecializeTypes",
+          *graph,
+          RemoveProfileNodesAndSpecializeTypes(graph));
       GRAPH_DEBUG(
           "After RemoveProfileNodesAndSpecializeTypes, before BatchMM\n",
           *graph);
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      JIT_TIMED_PASS("BatchMM", *graph, BatchMM(graph));
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
 
-      FuseTensorExprs(graph, getFusionGroupInlining() ? 2 : 1);
+      JIT_TIMED_PASS(
+          "FuseTensorExprs",
+          *graph,
+          FuseTensorExprs(graph, getFusionGroupInlining() ? 2 : 1));
       GRAPH_DEBUG(
           "After Fusion, before RemoveTensorTypeSpecializations\n", *graph);
 
       // Wipe tensor type info from the IR
-      RemoveTensorTypeSpecializations(graph);
+      JIT_TIMED_PASS(
+          "RemoveTensorTypeSpecializations",
+          *graph,
+          RemoveTensorTypeSpecializations(graph));
       GRAPH_DEBUG(
           "After RemoveTensorTypeSpecializations, before customPostPasses\n",
           *graph);
     } else {
       // Rewrite subgraphs with many MMs into expressions that batch them.
-      BatchMM(graph);
+      JIT_TIMED_PASS("BatchMM", *graph, BatchMM(graph));
       GRAPH_DEBUG("After BatchMM, before Fusion\n", *graph);
 
-      FuseGraph(graph, true);
+      JIT_TIMED_PASS("FuseGraph", *graph, FuseGraph(graph, true));
       GRAPH_DEBUG("After Fusion, before customPostPasses\n", *graph);
     }
 
     // Run custom post-fusion passes
-    for (const auto& passPair : getCustomPostPasses()) {
-      passPair.first(graph);
+    {
+      PassTimingGuard custom_pass_timing_guard("customPostPasses", *graph);
+      for (const auto& passPair : getCustomPostPasses()) {
+        passPair.first(graph);
+      }
     }
   }
   GRAPH_DEBUG(
@@ -550,37 +634,55 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
     runNoGradOptimizations(copy);
   }
   EliminateDeadCode(copy);
+  if (fuseParallelLinearEnabled()) {
+    if (FuseParallelLinear(copy)) {
+      GRAPH_DEBUG("After FuseParallelLinear:\n", *copy);
+    }
+  }
+  if (fuseAttentionEnabled()) {
+    if (FuseAttention(copy)) {
+      GRAPH_DEBUG("After FuseAttention:\n", *copy);
+    }
+  }
+  if (parallelizeBranchesEnabled()) {
+    if (ParallelizeIndependentBranches(copy)) {
+      GRAPH_DEBUG("After ParallelizeIndependentBranches:\n", *copy);
+    }
+  }
   GRAPH_DEBUG("After runProfilingOptimizations:\n", *copy);
 }
 
 void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
     std::shared_ptr<Graph>& graph) {
+  PassTimingGuard pipeline_timing_guard(
+      "runProfilingInsensitiveOptimizations", *graph);
   GRAPH_DEBUG(
       "Before inlining (beginning of runProfilingInsensitiveOptimizations)\n",
       *graph);
   // TODO: maybe this can go later in pipeline / directly in autodiff forward
   // creation
   if (getGraphExecutorOptimize()) {
-    Inline(*graph);
+    JIT_TIMED_PASS("Inline", *graph, Inline(*graph));
   }
   GRAPH_DEBUG("After inlining, before ClearProfilingInformation\n", *graph);
-  ClearProfilingInformation(graph);
+  JIT_TIMED_PASS(
+      "ClearProfilingInformation", *graph, ClearProfilingInformation(graph));
   GRAPH_DEBUG("After ClearProfilingInformation, before LowerGradOf\n", *graph);
-  LowerGradOf(*graph);
+  JIT_TIMED_PASS("LowerGradOf", *graph, LowerGradOf(*graph));
   GRAPH_DEBUG("After LowerGradOf, before ClearUndefinedness\n", *graph);
   // clear any residual undefinedness
   // as double backward graph inputs'
   // may carry over undefinedness
   // from profiled backward graphs
-  ClearUndefinedness(graph);
+  JIT_TIMED_PASS("ClearUndefinedness", *graph, ClearUndefinedness(graph));
   // runRequiredPasses
   {
     GRAPH_DEBUG("After ClearUndefinedness, before RemoveExpands\n", *graph);
-    RemoveExpands(graph);
+    JIT_TIMED_PASS("RemoveExpands", *graph, RemoveExpands(graph));
     GRAPH_DEBUG("After RemoveExpands, before CanonicalizeOps\n", *graph);
-    CanonicalizeOps(graph);
+    JIT_TIMED_PASS("CanonicalizeOps", *graph, CanonicalizeOps(graph));
     GRAPH_DEBUG("After CanonicalizeOps, before EliminateDeadCode\n", *graph);
-    EliminateDeadCode(graph);
+    JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
   }
   if (!getGraphExecutorOptimize()) {
     GRAPH_DEBUG(
@@ -590,25 +692,28 @@ void ProfilingGraphExecutorImpl::runProfilingInsensitiveOptimizations(
   }
 
   GRAPH_DEBUG("After EliminateDeadCode, before DecomposeOps\n", *graph);
-  DecomposeOps(graph);
+  JIT_TIMED_PASS("DecomposeOps", *graph, DecomposeOps(graph));
   GRAPH_DEBUG("After DecomposeOps, before ConstantPropagation\n", *graph);
-  ConstantPropagation(graph);
+  JIT_TIMED_PASS("ConstantPropagation", *graph, ConstantPropagation(graph));
   GRAPH_DEBUG("After ConstantPropagation, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
   GRAPH_DEBUG(
       "After EliminateDeadCode, before EliminateCommonSubexpression\n", *graph);
-  EliminateCommonSubexpression(graph);
+  JIT_TIMED_PASS(
+      "EliminateCommonSubexpression",
+      *graph,
+      EliminateCommonSubexpression(graph));
   GRAPH_DEBUG(
       "After EliminateCommonSubexpression, before ConstantPooling\n", *graph);
-  ConstantPooling(graph);
+  JIT_TIMED_PASS("ConstantPooling", *graph, ConstantPooling(graph));
   GRAPH_DEBUG("After ConstantPooling, before PeepholeOptimize\n", *graph);
-  PeepholeOptimize(graph);
+  JIT_TIMED_PASS("PeepholeOptimize", *graph, PeepholeOptimize(graph));
   GRAPH_DEBUG("After PeepholeOptimize, before EliminateDeadCode\n", *graph);
-  EliminateDeadCode(graph);
+  JIT_TIMED_PASS("EliminateDeadCode", *graph, EliminateDeadCode(graph));
   GRAPH_DEBUG("After EliminateDeadCode, before LowerSimpleTuples\n", *graph);
-  LowerSimpleTuples(graph);
+  JIT_TIMED_PASS("LowerSimpleTuples", *graph, LowerSimpleTuples(graph));
   GRAPH_DEBUG("After LowerSimpleTuples, before CheckInplace\n", *graph);
-  CheckInplace(graph);
+  JIT_TIMED_PASS("CheckInplace", *graph, CheckInplace(graph));
   GRAPH_DEBUG(
       "After CheckInplace (end of runProfilingInsensitiveOptimizations)\n",
       *graph);
@@ -619,6 +724,78 @@ ProfilingGraphExecutorImpl::ProfilingGraphExecutorImpl(
     std::string function_name)
     : GraphExecutorImplBase(graph, std::move(function_name)) {}
 
+ProfilingGraphExecutorImpl::~ProfilingGraphExecutorImpl() {
+  // The background compile task references this executor's profiling record
+  // and fallback function list; don't tear those down under it.
+  waitForBackgroundCompilation();
+}
+
+void ProfilingGraphExecutorImpl::waitForBackgroundCompilation() {
+  std::shared_ptr<BackgroundCompile> handle;
+  {
+    std::lock_guard<std::mutex> lock(compile_mutex);
+    handle = background_compile_;
+  }
+  if (handle) {
+    std::unique_lock<std::mutex> lock(handle->mutex);
+    handle->cv.wait(lock, [&handle] { return handle->done; });
+  }
+}
+
+// Note [Background compilation]
+// Once profiling completes, producing the optimized plan runs the full
+// profiling-sensitive pass pipeline (autodiff splitting, guard insertion,
+// fusion and kernel compilation). On the request path that shows up as a
+// multi-second latency spike for whichever caller arrives right after the
+// profiling runs finish. When getBackgroundCompilation() is set, the
+// pipeline runs on the inter-op thread pool instead, while requests keep
+// executing the instrumented graph (its profile callbacks become no-ops once
+// the record is ready); the finished plan is published under compile_mutex
+// and picked up by the next call, so the swap is atomic with respect to
+// getPlanFor. If the task fails, the next request compiles synchronously so
+// the error surfaces to a caller instead of being swallowed. The destructor
+// and debugFlushCompilationCache wait for an in-flight task, which is what
+// keeps `this`, the profiling record and fallback_functions_ valid for the
+// task's lifetime. Combined with Note [Shape-bucketed plan cache], warmup
+// traffic can pre-trigger one compile per expected shape bucket through
+// ScriptFunction._trigger_compilation without waiting for live requests to
+// pay for them. Must be called with compile_mutex held.
+void ProfilingGraphExecutorImpl::kickOffBackgroundCompilation() {
+  // Snapshot everything the task needs up front; the passes then only touch
+  // this private copy until publication.
+  auto copy = pr_->graph()->copy();
+  ProfilingRecord::removeProfileCounter(copy->block());
+  size_t remaining_bailout_depth = *remaining_bailout_depth_;
+  auto handle = std::make_shared<BackgroundCompile>();
+  background_compile_ = handle;
+  at::launch([this, copy, handle, remaining_bailout_depth]() mutable {
+    try {
+      runProfilingOptimizations(copy);
+      // replaces a fallback graph inserted by
+      // specialize_autogradzero if one exists
+      replaceFallbackGraphWithFallbackFunction(copy->block());
+      GRAPH_DUMP("Optimized Graph (compiled in background): ", copy);
+      ExecutionPlan plan(copy, function_name_, remaining_bailout_depth);
+      std::lock_guard<std::mutex> lock(compile_mutex);
+      optimized_plan_ = std::move(plan);
+    } catch (const std::exception& e) {
+      TORCH_WARN(
+          "Background compilation of ",
+          function_name_,
+          " failed: ",
+          e.what(),
+          "; the next call will compile synchronously.");
+      std::lock_guard<std::mutex> lock(compile_mutex);
+      background_compile_failed_ = true;
+    }
+    {
+      std::lock_guard<std::mutex> lock(handle->mutex);
+      handle->done = true;
+    }
+    handle->cv.notify_all();
+  });
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
     Stack& stack,
     size_t remaining_bailout_depth) {
@@ -685,6 +862,18 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
     return *profiling_plan_;
   }
 
+  // See Note [Background compilation]. Checking background_compile_ as well
+  // keeps requests off the synchronous path while a task kicked off before
+  // the mode was toggled is still running.
+  if ((getBackgroundCompilation() || background_compile_) &&
+      !background_compile_failed_) {
+    if (!background_compile_) {
+      kickOffBackgroundCompilation();
+    }
+    // Keep serving the instrumented graph until the optimized plan lands.
+    return *profiling_plan_;
+  }
+
   auto copy = pr_->graph()->copy();
   ProfilingRecord::removeProfileCounter(copy->block());
   runProfilingOptimizations(copy);
@@ -697,6 +886,84 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   return *optimized_plan_;
 }
 
+// Note [Shape-bucketed plan cache]
+// The profiling executor normally specializes once: the first profiled shape
+// class wins, and later requests with different shapes take bailout paths in
+// the optimized plan instead of getting their own specialization. Workloads
+// that legitimately cycle through a moderate number of input shapes (e.g.
+// (batch, seqlen) combinations in an NLP service) end up running mostly
+// deoptimized code. When torch_jit_shape_plan_cache_size is set to N > 0,
+// getPlanFor routes each request to a bucket determined by the exact dims,
+// dtype, device and requires_grad of its tensor inputs. Each bucket owns a
+// nested single-plan executor, so it profiles, specializes and fuses
+// independently for its shape class; at most N buckets are live and the least
+// recently used one is evicted when a new shape class arrives. Evicted
+// executors are parked rather than destroyed because the plan references
+// they handed out may still be in use by concurrent runs (see the header).
+// Coarser keys (e.g. sizes padded to the next power of two) can be layered
+// on by relaxing shapeBucketKey, at the price of intra-bucket bailouts.
+const ExecutionPlan& ProfilingGraphExecutorImpl::getShapeBucketPlanFor(
+    Stack& stack,
+    size_t remaining_bailout_depth) {
+  auto key = shapeBucketKey(stack);
+  if (!key) {
+    // no tensor inputs to key on; use the single-plan path
+    return getOptimizedPlanFor(stack, remaining_bailout_depth);
+  }
+  auto it = shape_bucket_index_.find(*key);
+  if (it != shape_bucket_index_.end()) {
+    shape_buckets_.splice(shape_buckets_.begin(), shape_buckets_, it->second);
+  } else {
+    const size_t cache_size = getShapePlanCacheSize();
+    while (shape_buckets_.size() >= cache_size) {
+      auto& lru = shape_buckets_.back();
+      GRAPH_DEBUG("Evicting plan cache bucket for shape key ", lru.key);
+      shape_bucket_index_.erase(lru.key);
+      retired_shape_buckets_.emplace_back(std::move(lru.executor));
+      shape_buckets_.pop_back();
+    }
+    GRAPH_DEBUG("Creating plan cache bucket for shape key ", *key);
+    auto executor =
+        std::make_unique<ProfilingGraphExecutorImpl>(graph, function_name_);
+    executor->shape_bucketing_allowed_ = false;
+    shape_buckets_.emplace_front(ShapeBucket{*key, std::move(executor)});
+    shape_bucket_index_.emplace(*key, shape_buckets_.begin());
+  }
+  return shape_buckets_.front().executor->getPlanFor(
+      stack, remaining_bailout_depth);
+}
+
+c10::optional<std::string> ProfilingGraphExecutorImpl::shapeBucketKey(
+    Stack& stack) const {
+  if (stack.size() < num_inputs) {
+    return c10::nullopt;
+  }
+  bool saw_tensor = false;
+  std::stringstream key;
+  for (const IValue& input : last(stack, num_inputs)) {
+    if (!input.isTensor()) {
+      // non-tensor inputs don't participate in shape specialization
+      key << "*;";
+      continue;
+    }
+    const at::Tensor& t = input.toTensor();
+    saw_tensor = true;
+    if (!t.defined()) {
+      key << "U;";
+      continue;
+    }
+    key << static_cast<int>(t.scalar_type()) << '@' << t.device() << ':';
+    for (auto size : t.sizes()) {
+      key << size << ',';
+    }
+    key << (t.requires_grad() ? "g;" : "n;");
+  }
+  if (!saw_tensor) {
+    return c10::nullopt;
+  }
+  return key.str();
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     size_t remaining_bailout_depth) {
@@ -708,6 +975,11 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     return *optimized_plan_;
   }
 
+  if (shape_bucketing_allowed_ && getShapePlanCacheSize() > 0 &&
+      getGraphExecutorOptimize() && getProfilingMode()) {
+    return getShapeBucketPlanFor(stack, remaining_bailout_depth);
+  }
+
   return getOptimizedPlanFor(stack, remaining_bailout_depth);
 }
 
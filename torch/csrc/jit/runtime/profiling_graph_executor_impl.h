@@ -1,6 +1,11 @@
 #pragma once
+#include <torch/csrc/jit/runtime/cuda_graph_executor.h>
 #include <torch/csrc/jit/runtime/graph_executor_impl.h>
 
+#include <condition_variable>
+#include <list>
+#include <mutex>
+
 namespace torch {
 namespace jit {
 
@@ -12,10 +17,16 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   const ExecutionPlan& getPlanFor(Stack& stack, size_t remaining_bailout_depth)
       override;
   GraphExecutorState getDebugState() override;
-  ~ProfilingGraphExecutorImpl() override = default;
+  // Waits for an in-flight background compilation; see
+  // Note [Background compilation] in the .cpp.
+  ~ProfilingGraphExecutorImpl() override;
 
   void debugFlushCompilationCache() {
+    // An in-flight background task works on the state we are about to clear.
+    waitForBackgroundCompilation();
     std::lock_guard<std::mutex> lock(compile_mutex);
+    background_compile_.reset();
+    background_compile_failed_ = false;
     pr_.reset();
     fallback_plan_.reset();
     profiling_plan_.reset();
@@ -23,16 +34,40 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
     // prevent memory leaks
     fallback_functions_.clear();
     remaining_bailout_depth_.reset();
+    shape_buckets_.clear();
+    shape_bucket_index_.clear();
+    retired_shape_buckets_.clear();
+    cuda_graph_runner_.reset();
+    cuda_graph_runner_initialized_ = false;
   }
 
   bool isOptimized() const override {
     return optimized_plan_.has_value();
   }
 
+  // Only the optimized plan is eligible for CUDA graph capture; while the
+  // executor is still profiling there is nothing worth capturing.
+  CudaGraphRunner* cudaGraphRunner() override {
+    if (!optimized_plan_) {
+      return nullptr;
+    }
+    if (!cuda_graph_runner_initialized_) {
+      cuda_graph_runner_ = createCudaGraphRunner();
+      cuda_graph_runner_initialized_ = true;
+    }
+    return cuda_graph_runner_.get();
+  }
+
  private:
   const ExecutionPlan& getOptimizedPlanFor(
       Stack& stack,
       size_t remaining_bailout_depth);
+  const ExecutionPlan& getShapeBucketPlanFor(
+      Stack& stack,
+      size_t remaining_bailout_depth);
+  c10::optional<std::string> shapeBucketKey(Stack& stack) const;
+  void kickOffBackgroundCompilation();
+  void waitForBackgroundCompilation();
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(std::shared_ptr<Graph>& graph);
   void replaceFallbackGraphWithFallbackFunction(Block* b);
@@ -52,6 +87,41 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
   // of the GraphExecutor and only shared with InterpreterState
   std::vector<std::unique_ptr<Function>> fallback_functions_;
   c10::optional<size_t> remaining_bailout_depth_;
+  // See Note [Shape-bucketed plan cache] in the .cpp. Each bucket owns a
+  // nested executor with its own profiling record and optimized plan for one
+  // input shape class. The list is kept in MRU order for LRU eviction, and
+  // the index maps shape keys to list entries. Evicted executors are parked
+  // in retired_shape_buckets_ because plans they handed out may still be
+  // referenced by in-flight runs; they are freed by
+  // debugFlushCompilationCache() or with this executor.
+  struct ShapeBucket {
+    std::string key;
+    std::unique_ptr<ProfilingGraphExecutorImpl> executor;
+  };
+  std::list<ShapeBucket> shape_buckets_;
+  std::unordered_map<std::string, std::list<ShapeBucket>::iterator>
+      shape_bucket_index_;
+  std::vector<std::unique_ptr<ProfilingGraphExecutorImpl>>
+      retired_shape_buckets_;
+  // cleared on nested executors so buckets don't bucket recursively
+  bool shape_bucketing_allowed_ = true;
+  // See Note [Background compilation] in the .cpp. The handle is shared with
+  // the compile task so waiters can block on completion; non-null means a
+  // task was kicked off (it stays set once the task finishes so the compile
+  // is never re-run).
+  struct BackgroundCompile {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+  };
+  std::shared_ptr<BackgroundCompile> background_compile_;
+  // set by a failed task; routes the next request to the synchronous path so
+  // the compilation error surfaces to a caller
+  bool background_compile_failed_ = false;
+  // See Note in torch/csrc/jit/runtime/cuda_graph_executor.h. Stays null in
+  // cpu-only builds; the bool avoids re-querying the registry on every run.
+  std::unique_ptr<CudaGraphRunner> cuda_graph_runner_;
+  bool cuda_graph_runner_initialized_ = false;
 };
 
 } // namespace jit
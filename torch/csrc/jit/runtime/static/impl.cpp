@@ -1,10 +1,12 @@
 #include <torch/csrc/jit/runtime/static/impl.h>
 
 #include <ATen/MemoryOverlap.h>
+#include <ATen/core/dispatch/Dispatcher.h>
 #include <ATen/core/interned_strings.h>
 #include <ATen/record_function.h>
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/InferenceMode.h>
+#include <c10/util/ThreadLocalDebugInfo.h>
 #include <c10/util/irange.h>
 #include <caffe2/core/scope_guard.h>
 #include <caffe2/core/timer.h>
@@ -97,6 +99,7 @@ void OptimizeGraph(
         fromQualString("fb::sigrid_transforms_torch_bind"),
         fromQualString("fb::variadic_sigrid_transforms_torch_bind"));
     FuseSignLog1P(graph);
+    FuseLinearActivation(graph);
 
     // TODO: we can avoid this guard by moving operations
     // to exposed folders.
@@ -937,7 +940,8 @@ c10::IValue StaticRuntime::run_impl(
           static_module_.values_share_same_storage(),
           static_module_.value_group(),
           static_module_.opts().enable_out_variant,
-          static_module_.opts().manage_output_tensors);
+          static_module_.opts().manage_output_tensors,
+          static_module_.opts().optimize_memory_offsets);
     }
     planner_->deallocate();
     // clean up owning refs of input tensors
@@ -1080,6 +1084,30 @@ void StaticRuntime::benchmark(
             static_cast<float>(results.total_nodes_count)
               << "%)" << std::endl;
   }
+
+  AllocationMetrics alloc_results =
+      benchmark_allocations(args, kwargs, warmup_runs);
+  std::cout << "Steady state allocations per iter: "
+            << alloc_results.total_allocations << " ("
+            << alloc_results.total_allocated_bytes << " bytes)" << std::endl;
+  std::vector<std::pair<std::string, size_t>> bytes_per_node_type_vec{
+      alloc_results.bytes_per_node_type.begin(),
+      alloc_results.bytes_per_node_type.end()};
+  std::sort(
+      bytes_per_node_type_vec.begin(),
+      bytes_per_node_type_vec.end(),
+      [](auto& left, auto& right) { return left.second > right.second; });
+  for (const auto& p : bytes_per_node_type_vec) {
+    const std::string& kind = p.first;
+    std::cout << std::setw(15) << p.second << " bytes. "
+              << alloc_results.allocations_per_node_type[kind]
+              << " allocations. " << kind;
+    if (alloc_results.fallback_allocating_nodes.count(kind)) {
+      std::cout << " (no out variant ran)";
+    }
+    std::cout << std::endl;
+  }
+
   check_for_memory_leak();
 
 #ifndef NDEBUG
@@ -1182,7 +1210,8 @@ void StaticRuntime::display_nodes(
           static_module_.values_share_same_storage(),
           static_module_.value_group(),
           static_module_.opts().enable_out_variant,
-          static_module_.opts().manage_output_tensors);
+          static_module_.opts().manage_output_tensors,
+          static_module_.opts().optimize_memory_offsets);
     }
     planner_->deallocate();
     // clean up owning refs of input tensors
@@ -1251,7 +1280,8 @@ StaticRuntime::IndividualMetrics StaticRuntime::benchmark_individual_ops(
             static_module_.values_share_same_storage(),
             static_module_.value_group(),
             static_module_.opts().enable_out_variant,
-            static_module_.opts().manage_output_tensors);
+            static_module_.opts().manage_output_tensors,
+            static_module_.opts().optimize_memory_offsets);
       }
       planner_->deallocate();
       // clean up owning refs of input tensors
@@ -1311,6 +1341,106 @@ StaticRuntime::IndividualMetrics StaticRuntime::benchmark_individual_ops(
   return results;
 }
 
+namespace {
+
+// Thread-local memory reporter behind benchmark_allocations. It occupies
+// the same ThreadLocalDebugInfo slot as the profiler, so every allocator
+// that reports through c10::reportMemoryUsageToProfiler is observed.
+// Allocations made on intra-op worker threads are not attributed, the same
+// limitation the profiler's memory events have.
+class AllocationAdvisor : public c10::MemoryReportingInfoBase {
+ public:
+  void reportMemoryUsage(
+      void* /* ptr */,
+      int64_t alloc_size,
+      int64_t /* total_allocated */,
+      int64_t /* total_reserved */,
+      c10::Device /* device */) override {
+    // Only allocator pressure is of interest here; skip deallocations.
+    if (alloc_size <= 0) {
+      return;
+    }
+    allocations_++;
+    allocated_bytes_ += alloc_size;
+  }
+
+  bool memoryProfilingEnabled() const override {
+    return true;
+  }
+
+  size_t allocations() const {
+    return allocations_;
+  }
+
+  size_t allocated_bytes() const {
+    return allocated_bytes_;
+  }
+
+ private:
+  size_t allocations_ = 0;
+  size_t allocated_bytes_ = 0;
+};
+
+} // namespace
+
+StaticRuntime::AllocationMetrics StaticRuntime::benchmark_allocations(
+    const std::vector<c10::IValue>& args,
+    const std::unordered_map<std::string, c10::IValue>& kwargs,
+    const int warmup_runs) {
+  TORCH_CHECK(warmup_runs >= 1);
+
+  // See comment on above use of InferenceMode for
+  // explanation.
+  c10::InferenceMode mode;
+
+  // Warm up so the memory planner reaches steady state; whatever still
+  // hits the allocator in the measured iteration below does so on every
+  // iteration.
+  for (const auto i : c10::irange(warmup_runs)) {
+    (void)i; // Suppress unused variable warning
+    operator()(args, kwargs);
+  }
+
+  AllocationMetrics results;
+  auto advisor = std::make_shared<AllocationAdvisor>();
+  c10::DebugInfoGuard guard(c10::DebugInfoKind::PROFILER_STATE, advisor);
+
+  set_inputs(args, kwargs);
+  if (planner_) {
+    planner_->allocate();
+  }
+  for (const auto i : c10::irange(nodes_.size())) {
+    const size_t allocations_before = advisor->allocations();
+    const size_t bytes_before = advisor->allocated_bytes();
+    nodes_[i].run();
+    const size_t allocations = advisor->allocations() - allocations_before;
+    if (allocations == 0) {
+      continue;
+    }
+    const std::string kind = nodes_[i].node()->kind().toQualString();
+    results.allocations_per_node_type[kind] += allocations;
+    results.bytes_per_node_type[kind] +=
+        advisor->allocated_bytes() - bytes_before;
+    if (!nodes_[i].has_out_variant()) {
+      results.fallback_allocating_nodes.insert(kind);
+    }
+  }
+  results.total_allocations = advisor->allocations();
+  results.total_allocated_bytes = advisor->allocated_bytes();
+
+  if (static_module_.opts().cleanup_activations && planner_) {
+    planner_->deallocate();
+    // clean up owning refs of input tensors
+    clean_up_input_ivalues();
+  }
+  // release outputs so the runtime can be reused
+  for (const auto i : c10::irange(static_module_.num_outputs())) {
+    *outputs_[i] = IValue();
+  }
+
+  return results;
+}
+
 void StaticRuntime::check_for_memory_leak(bool output_returned) {
   if (!static_module_.opts().cleanup_activations) {
     return;
@@ -1404,6 +1534,54 @@ bool StaticRuntime::isManagedOutputTensor(const IValue& ivalue) {
   return planner_ && planner_->isManagedOutputTensor(ivalue);
 }
 
+StaticRuntimePool::~StaticRuntimePool() {
+  // No handles may be outstanding at this point, so the free list holds
+  // every node the pool ever created.
+  Node* node = head_.load(std::memory_order_relaxed);
+  while (node) {
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+StaticRuntimePool::LeasedRuntime StaticRuntimePool::acquire() {
+  // Take the entire free list. We now own it exclusively, which is what
+  // makes the compare-exchange below immune to ABA: it can only install a
+  // chain no other thread has a pointer into.
+  Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+  if (!node) {
+    return LeasedRuntime(
+        *this, new Node{std::make_unique<StaticRuntime>(*module_), nullptr});
+  }
+  Node* rest = node->next;
+  if (rest) {
+    // Splice the remainder back in front of whatever was pushed while we
+    // held the list.
+    Node* tail = rest;
+    while (tail->next) {
+      tail = tail->next;
+    }
+    Node* expected = nullptr;
+    while (!head_.compare_exchange_weak(
+        expected,
+        rest,
+        std::memory_order_release,
+        std::memory_order_relaxed)) {
+      tail->next = expected;
+    }
+  }
+  node->next = nullptr;
+  return LeasedRuntime(*this, node);
+}
+
+void StaticRuntimePool::release(Node* node) {
+  node->next = head_.load(std::memory_order_relaxed);
+  while (!head_.compare_exchange_weak(
+      node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
 ProcessedNode::ProcessedNode(
     Node* node,
     std::unique_ptr<const IValue*[]> inputs,
@@ -1435,6 +1613,45 @@ ProcessedNode::ProcessedNode(
   }
   {
     const Operator& op = node->getOperator();
+    auto handle = op.c10Handle();
+    if (handle && !op.schema().is_vararg() && !hasVarArgs(node)) {
+      // For c10-backed operators, dispatch directly through the cached
+      // handle. The argument key set is extracted on the first run and
+      // reused afterwards: a node in a static module sees tensors of a
+      // fixed backend on every iteration, so only the thread-local
+      // pieces (applied inside the dispatcher per call) can change.
+      std::function<void(ProcessedNode*)> f =
+          [handle = std::move(*handle),
+           arg_key_set = c10::DispatchKeySet(),
+           first_run = true](ProcessedNode* pnode) mutable {
+            std::vector<IValue> stack;
+            const size_t size = pnode->node()->inputs().size();
+            stack.reserve(size);
+            for (const auto i : c10::irange(size)) {
+              stack.emplace_back(pnode->Input(i));
+            }
+
+            if (C10_UNLIKELY(first_run)) {
+              arg_key_set = c10::Dispatcher::singleton()
+                                .extractArgDispatchKeySetBoxed(handle, &stack);
+              first_run = false;
+            } else {
+              DCHECK(
+                  arg_key_set ==
+                  c10::Dispatcher::singleton().extractArgDispatchKeySetBoxed(
+                      handle, &stack));
+            }
+            handle.callBoxedWithPrecomputedDispatchKeySet(arg_key_set, &stack);
+
+            DCHECK_EQ(stack.size(), pnode->node()->outputs().size());
+            for (const auto i : c10::irange(pnode->node()->outputs().size())) {
+              pnode->Output(i) = std::move(stack[i]);
+            }
+          };
+      fn_ = {f, FunctionKind::kInterpreterFallback};
+      VLOG(1) << "Direct dispatch for node: " << PrintNode(node);
+      return;
+    }
     std::function<void(ProcessedNode*)> f =
         [node_op = op.getOperation(node)](ProcessedNode* pnode) mutable {
           std::vector<IValue> stack;
@@ -2,6 +2,7 @@
 
 #include <ATen/core/interned_strings.h>
 #include <ATen/core/ivalue.h>
+#include <atomic>
 #include <c10/core/CPUAllocator.h>
 #include <c10/util/ArrayRef.h>
 #include <c10/util/variant.h>
@@ -91,6 +92,11 @@ struct TORCH_API StaticModuleOptions {
   // graph, where storage is deallocated outside static runtime
   // (enable_out_variant must be true)
   bool manage_output_tensors{false};
+  // to pack managed tensors into the arena by exact lifetime intervals,
+  // letting tensors whose live ranges do not overlap share memory at
+  // different offsets instead of getting disjoint extents
+  // (enable_out_variant must be true)
+  bool optimize_memory_offsets{false};
 };
 
 /// The static runime supports two execution modes.
@@ -114,27 +120,20 @@ struct TORCH_API StaticModuleOptions {
 /// Mode 2: similar to data parallelism, run the same model for different inputs
 /// on different threads at the same time.
 /// You should have one StaticModule per model, and one StaticRuntime instance
-/// per running thread. To avoiding creating StaticRuntimes on the fly, use a
-/// synchronized stack (i.e. boost::lockfree::stack) to cache all the
-/// StaticRuntime instances in your code.
+/// per running thread. To avoiding creating StaticRuntimes on the fly, use
+/// StaticRuntimePool to cache the StaticRuntime instances. The pool shares one
+/// StaticModule (graph, constants, resolved ops) across all runtimes; each
+/// runtime only holds the mutable per-request state (input/output registers
+/// and the memory planner), so clones are cheap.
 /// @code
 ///   // initialization
 ///   auto module = std::make_shared<StaticModule>(m, opts);
-///
-///   // 128 is good for most cases. Pick a number that works for you
-///   boost::lockfree::stack<std::shared_ptr<StaticRuntime>,
-///     boost::lockfree::fixed_sized<true>> pool(128);
+///   StaticRuntimePool pool(module);
 ///
 ///   // inference
-///   std::shared_ptr<StaticRuntime> runtime = nullptr;
-///   pool.pop(runtime);
-///   if (!runtime) {
-///     // holds a reference to the underlying module
-///     // but does its own memory management
-///     runtime = std::make_shared<StaticRuntime>(*module);
-///   }
-///   auto output = runtime(args, kwargs);
-///   pool.push(runtime);
+///   auto runtime = pool.acquire();
+///   auto output = (*runtime)(args, kwargs);
+///   // runtime is returned to the pool when the handle goes out of scope
 /// @endcode
 ///
 
@@ -318,6 +317,25 @@ class TORCH_API StaticRuntime {
       const int warmup_runs,
       const int main_runs);
 
+  // Allocation advisor. After warmup the memory planner has reached steady
+  // state, so anything still hitting the allocator in the measured
+  // iteration does so on every iteration - these are the nodes worth
+  // chasing with out variants and output reuse.
+  struct AllocationMetrics {
+    size_t total_allocations{0};
+    size_t total_allocated_bytes{0};
+    std::unordered_map<std::string, size_t> allocations_per_node_type;
+    std::unordered_map<std::string, size_t> bytes_per_node_type;
+    // Node kinds that allocated in steady state while falling back to the
+    // functional op (no out variant ran): the candidates for out= coverage.
+    std::unordered_set<std::string> fallback_allocating_nodes;
+  };
+
+  AllocationMetrics benchmark_allocations(
+      const std::vector<c10::IValue>& args,
+      const std::unordered_map<std::string, c10::IValue>& kwargs,
+      const int warmup_runs);
+
   // Input is readwrite
   IValue& Input(size_t i) {
     DCHECK(i < inputs_.size());
@@ -391,6 +409,75 @@ class TORCH_API StaticRuntime {
   std::vector<ProcessedNode> nodes_;
 };
 
+/// A lock-free cache of StaticRuntime instances for one StaticModule; see
+/// Mode 2 above. acquire() pops a cached runtime (or creates one if the pool
+/// is empty) and returns a RAII handle that pushes it back on destruction.
+/// The immutable StaticModule is shared by all runtimes in the pool; each
+/// runtime only owns its registers and memory planner.
+///
+/// Both acquire() and release are lock-free. Pop takes the whole free list
+/// with an exchange, keeps the head node and splices the rest back with a
+/// compare-exchange; since the spliced chain is exclusively owned by the
+/// popping thread, the classic ABA problem of a Treiber stack cannot occur.
+/// Nodes are never freed until the pool is destroyed, so a pool that saw a
+/// burst of N concurrent requests keeps N runtimes alive. The pool must
+/// outlive all handles obtained from it.
+class TORCH_API StaticRuntimePool {
+  struct Node {
+    std::unique_ptr<StaticRuntime> runtime;
+    Node* next;
+  };
+
+ public:
+  class LeasedRuntime {
+   public:
+    LeasedRuntime(LeasedRuntime&& rhs) noexcept
+        : pool_(rhs.pool_), node_(rhs.node_) {
+      rhs.node_ = nullptr;
+    }
+    LeasedRuntime(const LeasedRuntime&) = delete;
+    LeasedRuntime& operator=(const LeasedRuntime&) = delete;
+    LeasedRuntime& operator=(LeasedRuntime&&) = delete;
+    ~LeasedRuntime() {
+      if (node_) {
+        pool_.release(node_);
+      }
+    }
+
+    StaticRuntime& operator*() const {
+      return *node_->runtime;
+    }
+    StaticRuntime* operator->() const {
+      return node_->runtime.get();
+    }
+    StaticRuntime* get() const {
+      return node_->runtime.get();
+    }
+
+   private:
+    friend class StaticRuntimePool;
+    LeasedRuntime(StaticRuntimePool& pool, Node* node)
+        : pool_(pool), node_(node) {}
+
+    StaticRuntimePool& pool_;
+    Node* node_;
+  };
+
+  explicit StaticRuntimePool(std::shared_ptr<StaticModule> module)
+      : module_(std::move(module)) {}
+  StaticRuntimePool(const StaticRuntimePool&) = delete;
+  StaticRuntimePool& operator=(const StaticRuntimePool&) = delete;
+  ~StaticRuntimePool();
+
+  LeasedRuntime acquire();
+
+ private:
+  void release(Node* node);
+
+  std::shared_ptr<StaticModule> module_;
+  std::atomic<Node*> head_{nullptr};
+};
+
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 class TORCH_API ProcessedNode {
  public:
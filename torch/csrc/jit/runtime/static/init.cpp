@@ -45,6 +45,23 @@ void initStaticModuleBindings(PyObject* module) {
           "instances_per_node_type",
           &StaticRuntime::IndividualMetrics::instances_per_node_type)
       .def_readonly("out_nodes", &StaticRuntime::IndividualMetrics::out_nodes);
+  py::class_<StaticRuntime::AllocationMetrics>(
+      static_module, "AllocationMetrics")
+      .def_readonly(
+          "total_allocations",
+          &StaticRuntime::AllocationMetrics::total_allocations)
+      .def_readonly(
+          "total_allocated_bytes",
+          &StaticRuntime::AllocationMetrics::total_allocated_bytes)
+      .def_readonly(
+          "allocations_per_node_type",
+          &StaticRuntime::AllocationMetrics::allocations_per_node_type)
+      .def_readonly(
+          "bytes_per_node_type",
+          &StaticRuntime::AllocationMetrics::bytes_per_node_type)
+      .def_readonly(
+          "fallback_allocating_nodes",
+          &StaticRuntime::AllocationMetrics::fallback_allocating_nodes);
   static_module
       .def(
           "__call__",
@@ -82,6 +99,18 @@ void initStaticModuleBindings(PyObject* module) {
                 kwargs.begin(), kwargs.end()};
             return self.runtime().benchmark_individual_ops(
                 arg_ivalues, kwarg_ivalues, warmup_runs, main_runs);
+          })
+      .def(
+          "benchmark_allocations",
+          [](StaticModule& self,
+             const std::vector<at::Tensor>& args,
+             const std::unordered_map<std::string, at::Tensor>& kwargs,
+             const int warmup_runs) {
+            std::vector<c10::IValue> arg_ivalues{args.begin(), args.end()};
+            std::unordered_map<std::string, c10::IValue> kwarg_ivalues{
+                kwargs.begin(), kwargs.end()};
+            return self.runtime().benchmark_allocations(
+                arg_ivalues, kwarg_ivalues, warmup_runs);
           });
   m.def(
        "_jit_to_static_module",
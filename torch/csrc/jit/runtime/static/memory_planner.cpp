@@ -3,6 +3,9 @@
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/runtime/static/impl.h>
 
+#include <algorithm>
+#include <numeric>
+
 namespace torch {
 namespace jit {
 
@@ -11,12 +14,35 @@ static void assign_storage_to_managed_tensors(
     const FastSet<const Value*>& managed_tensor_values,
     const FastMap<const Value*, std::vector<const Value*>>&
         value_to_same_storage_values,
-    std::vector<std::pair<size_t, std::vector<at::Tensor*>>>& managed_tensors) {
+    std::vector<std::pair<size_t, std::vector<at::Tensor*>>>& managed_tensors,
+    std::vector<MemoryPlanner::StorageInterval>* managed_tensor_intervals) {
   // map Value to index to managed_storage, where multiple values can
   // map to the same index (i.e., sharing the same storage)
   FastMap<const Value*, size_t> value_to_storage_idx;
 
+  // Node order doubles as the execution timeline for lifetime intervals.
+  const uint32_t num_nodes = static_cast<uint32_t>(runtime->nodes().size());
+  FastMap<const Node*, uint32_t> node_to_index;
+  if (managed_tensor_intervals) {
+    node_to_index.reserve(num_nodes);
+    for (const auto i : c10::irange(num_nodes)) {
+      node_to_index.emplace(runtime->nodes()[i].node(), i);
+    }
+  }
+  const auto last_use_of = [&](const Value* v, uint32_t def_idx) {
+    uint32_t last = def_idx;
+    for (const auto& use : v->uses()) {
+      auto it = node_to_index.find(use.user);
+      // Users that are not processed nodes are not on the timeline; keep
+      // the storage alive to the end of the iteration to stay safe.
+      last = std::max(
+          last, it == node_to_index.end() ? num_nodes : it->second);
+    }
+    return last;
+  };
+
   // Snapshot of the current memory state
+  uint32_t node_idx = 0;
   for (auto& pnode : runtime->nodes()) {
     for (const auto i : c10::irange(pnode.outputs().size())) {
       auto& ival = pnode.Output(i);
@@ -28,10 +54,20 @@ static void assign_storage_to_managed_tensors(
         if (f != value_to_storage_idx.end()) {
           auto storage_idx = f->second;
           managed_tensors[storage_idx].second.emplace_back(tensor);
+          if (managed_tensor_intervals) {
+            auto& interval = (*managed_tensor_intervals)[storage_idx];
+            interval.start = std::min(interval.start, node_idx);
+            interval.end =
+                std::max(interval.end, last_use_of(val, node_idx));
+          }
         } else {
           auto p =
               std::make_pair<size_t, std::vector<at::Tensor*>>(0, {tensor});
           managed_tensors.emplace_back(std::move(p));
+          if (managed_tensor_intervals) {
+            managed_tensor_intervals->push_back(
+                {node_idx, last_use_of(val, node_idx)});
+          }
           // first of a group, update the value_to_storage_idx map with the
           // index
           auto f = value_to_same_storage_values.find(val);
@@ -45,6 +81,7 @@ static void assign_storage_to_managed_tensors(
         }
       }
     }
+    node_idx++;
   }
 }
 
@@ -76,7 +113,9 @@ MemoryPlanner::MemoryPlanner(
         value_to_same_storage_values,
     const ValueGroup& value_group,
     bool enable_out_variant,
-    bool manage_output_tensors) {
+    bool manage_output_tensors,
+    bool optimize_memory_offsets)
+    : optimize_memory_offsets_(optimize_memory_offsets) {
   // collect register indices of outputs of ops with out variant
   FastSet<const Value*> managed_tensor_values;
   FastSet<const Value*> leaked_values;
@@ -151,7 +190,8 @@ MemoryPlanner::MemoryPlanner(
         runtime,
         managed_tensor_values,
         value_to_same_storage_values,
-        managed_tensors_);
+        managed_tensors_,
+        optimize_memory_offsets_ ? &managed_tensor_intervals_ : nullptr);
   }
 
   if (enable_out_variant && manage_output_tensors) {
@@ -177,10 +217,97 @@ at::DataPtr MemoryPlanner::allocate_buffer(size_t size) {
   return allocator->allocate(size);
 }
 
+// Greedy best-fit packing of storage groups into one slab: visit groups in
+// decreasing size order and give each the lowest offset that does not
+// collide in memory with an already-placed group whose lifetime interval
+// overlaps. This is the standard near-optimal heuristic for offset
+// assignment over interval graphs (optimal placement is NP-hard); placing
+// large groups first bounds the fragmentation and makes the result
+// deterministic. Group sizes are aligned, so all offsets stay aligned.
+void MemoryPlanner::assignStorageOffsets() {
+  const auto num_groups = managed_tensors_.size();
+  managed_tensor_offsets_.assign(num_groups, 0);
+  std::vector<size_t> order(num_groups);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return managed_tensors_[a].first > managed_tensors_[b].first;
+  });
+
+  packed_buffer_bytes_ = 0;
+  std::vector<size_t> placed;
+  placed.reserve(num_groups);
+  std::vector<std::pair<size_t, size_t>> busy; // [offset, offset + size)
+  for (const auto idx : order) {
+    const size_t tensor_size = managed_tensors_[idx].first;
+    if (tensor_size == 0) {
+      continue;
+    }
+    const auto& interval = managed_tensor_intervals_[idx];
+    busy.clear();
+    for (const auto placed_idx : placed) {
+      const auto& other = managed_tensor_intervals_[placed_idx];
+      if (other.start <= interval.end && interval.start <= other.end) {
+        busy.emplace_back(
+            managed_tensor_offsets_[placed_idx],
+            managed_tensor_offsets_[placed_idx] +
+                managed_tensors_[placed_idx].first);
+      }
+    }
+    std::sort(busy.begin(), busy.end());
+    size_t offset = 0;
+    for (const auto& extent : busy) {
+      if (offset + tensor_size <= extent.first) {
+        break;
+      }
+      offset = std::max(offset, extent.second);
+    }
+    managed_tensor_offsets_[idx] = offset;
+    packed_buffer_bytes_ = std::max(packed_buffer_bytes_, offset + tensor_size);
+    placed.push_back(idx);
+  }
+  GRAPH_DEBUG(
+      "assignStorageOffsets: packed ",
+      managed_bytes_,
+      " managed bytes into ",
+      packed_buffer_bytes_);
+}
+
 void MemoryPlanner::allocateManagedTensors() {
   if (managed_bytes_ == 0) {
     return;
   }
+
+  if (optimize_memory_offsets_) {
+    if (offsets_dirty_) {
+      assignStorageOffsets();
+      offsets_dirty_ = false;
+    }
+    buffer_ = allocate_buffer(packed_buffer_bytes_);
+    uint8_t* start = static_cast<uint8_t*>(buffer_.get());
+
+    reused_tensors_ = 0;
+    for (const auto group_idx : c10::irange(managed_tensors_.size())) {
+      const auto& ms = managed_tensors_[group_idx];
+      auto tensor_size = ms.first;
+      if (tensor_size == 0) {
+        continue;
+      }
+      DCHECK_LE(
+          managed_tensor_offsets_[group_idx] + tensor_size,
+          packed_buffer_bytes_);
+      void* src =
+          static_cast<void*>(start + managed_tensor_offsets_[group_idx]);
+      for (auto* tensor : ms.second) {
+        tensor->storage().set_data_ptr_noswap(
+            at::DataPtr(src, src, nullptr, tensor->device()));
+        tensor->storage().set_nbytes(tensor_size);
+        reused_tensors_++;
+      }
+      reused_tensors_--;
+    }
+    return;
+  }
+
   buffer_ = allocate_buffer(managed_bytes_);
 
   size_t offset = 0;
@@ -261,7 +388,12 @@ void MemoryPlanner::deallocate() {
     // run (following C2 tradition), exploiting the fact that tensor storage
     // size does not have to match that of real tensor size. The following logic
     // records the tensor storage size for the next run.
-    ms.first = max;
+    if (max > ms.first) {
+      ms.first = max;
+      // Sizes changed, so cached storage offsets are stale. They settle
+      // once recorded sizes stop growing, typically after warmup.
+      offsets_dirty_ = true;
+    }
     managed_bytes_ += max;
   }
 
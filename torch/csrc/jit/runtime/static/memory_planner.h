@@ -27,6 +27,9 @@ namespace jit {
 ///      the default allocator for memory allocation.
 ///   3. free the buffer at the end of each iteration
 /// Steps 1 and 3 are handled by `deallocate()`, and step 2 by `allocate()`.
+/// With optimize_memory_offsets, step 2 additionally packs storage groups
+/// whose lifetime intervals do not overlap into the same region of the
+/// buffer, shrinking it below the sum of the per-group maxima.
 /// Only models with simple output types are supported, i.e. None, Tensor or
 /// List/Tuple/Dict of Tensors. Complex output types such as List of Lists are
 /// not supported.
@@ -38,7 +41,8 @@ class MemoryPlanner {
       const FastMap<const Value*, std::vector<const Value*>>&,
       const ValueGroup& value_group,
       bool enable_out_variant,
-      bool manage_output_tensors);
+      bool manage_output_tensors,
+      bool optimize_memory_offsets = false);
   // disable copying and moving
   MemoryPlanner(const MemoryPlanner&) = delete;
   MemoryPlanner& operator=(const MemoryPlanner&) = delete;
@@ -98,6 +102,15 @@ class MemoryPlanner {
     return buffer_start <= tensor_ptr && tensor_ptr < buffer_end;
   }
 
+  // Execution interval of a storage group, in node indices of the
+  // runtime's node list: `start` is the first node that defines any value
+  // in the group, `end` the last node that uses one. Two groups may share
+  // memory iff their intervals do not overlap.
+  struct StorageInterval {
+    uint32_t start;
+    uint32_t end;
+  };
+
  private:
   // ivalues created in one run but not managed by MemoryPlanner
   std::vector<IValue*> unmanaged_ivalues_;
@@ -111,6 +124,19 @@ class MemoryPlanner {
   size_t managed_bytes_{0};
   size_t reused_tensors_{0};
 
+  // State for interval-based offset packing, populated only when
+  // optimize_memory_offsets is set. Intervals are parallel to
+  // managed_tensors_ and fixed at construction; offsets are recomputed by
+  // assignStorageOffsets() whenever a group's recorded size grew during
+  // deallocate(), and reused unchanged otherwise.
+  bool optimize_memory_offsets_{false};
+  std::vector<StorageInterval> managed_tensor_intervals_;
+  std::vector<size_t> managed_tensor_offsets_;
+  size_t packed_buffer_bytes_{0};
+  bool offsets_dirty_{true};
+
+  void assignStorageOffsets();
+
   // Since output tensors are alive after one inference, their storage
   // is managed differently (e.g., deallocation happens on the client side).
   FastSet<const Value*> managed_output_tensor_values_{};
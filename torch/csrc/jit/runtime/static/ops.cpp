@@ -5,6 +5,7 @@
 #include <ATen/NativeFunctions.h>
 #include <ATen/ScalarOps.h>
 #include <ATen/TensorUtils.h>
+#include <ATen/native/CPUBlas.h>
 #include <ATen/native/EmbeddingBag.h>
 #include <ATen/native/Fill.h>
 #include <ATen/native/IndexingUtils.h>
@@ -477,6 +478,36 @@ REGISTER_OPERATOR_FUNCTOR(aten::abs, aten_abs, [](Node* n) -> SROperator {
   };
 });
 
+namespace {
+
+// Note [Static Runtime elementwise fast path]
+// The at::cpu out variants rebuild a TensorIterator on every call,
+// re-running shape inference and dtype promotion even though a Static
+// Runtime graph sees the same shapes request after request. Once the
+// output tensor exists from a previous iteration, the recurring case --
+// both inputs and the output contiguous with identical sizes and dtype --
+// fully determines the output metadata, so the kernel can write straight
+// into the pre-shaped output. Any deviation (first iteration,
+// broadcasting, type promotion, odd strides) falls through to the regular
+// out variant, which re-derives metadata and resizes. Checking against
+// the live inputs on every iteration, rather than against a signature
+// cached at first run, is also what keeps a mid-stream change in input
+// shapes or dtypes safe.
+bool elementwise_fast_path_applicable(
+    const at::Tensor& out,
+    const at::Tensor& a,
+    const at::Tensor& b) {
+  const auto dtype = a.scalar_type();
+  return out.defined() && out.is_contiguous() && a.is_contiguous() &&
+      b.is_contiguous() && !a.is_neg() && !b.is_neg() &&
+      b.scalar_type() == dtype && out.scalar_type() == dtype &&
+      (at::isIntegralType(dtype, /*includeBool=*/false) ||
+       at::isFloatingType(dtype)) &&
+      a.sizes().equals(b.sizes()) && out.sizes().equals(a.sizes());
+}
+
+} // namespace
+
 REGISTER_OPERATOR_FUNCTOR(aten::mul, aten_mul, [](Node* n) -> SROperator {
   if (!n->matches(torch::schema(
           "aten::mul.Tensor(Tensor self, Tensor other) -> Tensor"))) {
@@ -491,6 +522,20 @@ REGISTER_OPERATOR_FUNCTOR(aten::mul, aten_mul, [](Node* n) -> SROperator {
       p_node->Output(0) = at::cpu::mul(in0_t, in1_t);
     } else {
       auto& out_t = p_node->Output(0).toTensor();
+      if (elementwise_fast_path_applicable(out_t, in0_t, in1_t)) {
+        // See Note [Static Runtime elementwise fast path]
+        AT_DISPATCH_ALL_TYPES_AND2(
+            kHalf, kBFloat16, out_t.scalar_type(), "static_runtime_mul", [&]() {
+              const auto N = out_t.numel();
+              const auto* a_data = in0_t.data_ptr<scalar_t>();
+              const auto* b_data = in1_t.data_ptr<scalar_t>();
+              auto* out_data = out_t.data_ptr<scalar_t>();
+              for (const auto i : c10::irange(N)) {
+                out_data[i] = a_data[i] * b_data[i];
+              }
+            });
+        return;
+      }
       fastResizeToZero(out_t);
       at::cpu::mul_out(out_t, in0_t, in1_t);
     }
@@ -1316,6 +1361,24 @@ REGISTER_OPERATOR_FUNCTOR(aten::div, aten_div, [](Node* n) -> SROperator {
       p_node->Output(0) = at::cpu::div(in0_t, in1_t, rounding_mode);
     } else {
       auto& out_t = p_node->Output(0).toTensor();
+      if (!rounding_mode.has_value() &&
+          // True division promotes integral inputs to floating point, so
+          // the fast path only covers floating dtypes.
+          at::isFloatingType(out_t.scalar_type()) &&
+          elementwise_fast_path_applicable(out_t, in0_t, in1_t)) {
+        // See Note [Static Runtime elementwise fast path]
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+            kHalf, kBFloat16, out_t.scalar_type(), "static_runtime_div", [&]() {
+              const auto N = out_t.numel();
+              const auto* a_data = in0_t.data_ptr<scalar_t>();
+              const auto* b_data = in1_t.data_ptr<scalar_t>();
+              auto* out_data = out_t.data_ptr<scalar_t>();
+              for (const auto i : c10::irange(N)) {
+                out_data[i] = a_data[i] / b_data[i];
+              }
+            });
+        return;
+      }
       fastResizeToZero(out_t);
 
       at::cpu::div_out(out_t, in0_t, in1_t, rounding_mode);
@@ -1352,6 +1415,29 @@ REGISTER_OPERATOR_FUNCTOR(aten::sub, aten_sub, [](Node* n) -> SROperator {
         p_node->Output(0) = at::cpu::sub(in0_t, in1_t, alpha);
       } else {
         auto& out_t = p_node->Output(0).toTensor();
+        if (elementwise_fast_path_applicable(out_t, in0_t, in1_t) &&
+            // A floating alpha on integral tensors is an error in the
+            // regular kernel; let it produce the diagnostic.
+            !(at::isIntegralType(out_t.scalar_type(), /*includeBool=*/false) &&
+              alpha.isFloatingPoint())) {
+          // See Note [Static Runtime elementwise fast path]
+          AT_DISPATCH_ALL_TYPES_AND2(
+              kHalf,
+              kBFloat16,
+              out_t.scalar_type(),
+              "static_runtime_sub",
+              [&]() {
+                const auto N = out_t.numel();
+                const auto alpha_v = alpha.to<scalar_t>();
+                const auto* a_data = in0_t.data_ptr<scalar_t>();
+                const auto* b_data = in1_t.data_ptr<scalar_t>();
+                auto* out_data = out_t.data_ptr<scalar_t>();
+                for (const auto i : c10::irange(N)) {
+                  out_data[i] = a_data[i] - alpha_v * b_data[i];
+                }
+              });
+          return;
+        }
         fastResizeToZero(out_t);
         at::cpu::sub_out(out_t, in0_t, in1_t, alpha);
       }
@@ -2009,6 +2095,105 @@ REGISTER_OPERATOR_FUNCTOR(
       };
     });
 
+namespace {
+
+// Computes act(input @ weight.T + bias) with the activation fused into the
+// GEMM epilogue (see cpublas::gemm_with_epilogue) when the operands are
+// plain contiguous fp32 CPU tensors. Falls back to linear + out-of-place
+// activation otherwise.
+void linear_activation_out(
+    at::Tensor& out,
+    const at::Tensor& input,
+    const at::Tensor& weight,
+    const c10::optional<at::Tensor>& bias,
+    bool gelu) {
+  const bool can_fuse = input.dim() == 2 && weight.dim() == 2 &&
+      input.scalar_type() == at::kFloat && weight.scalar_type() == at::kFloat &&
+      input.device().is_cpu() && weight.device().is_cpu() &&
+      input.is_contiguous() && weight.is_contiguous() &&
+      weight.size(1) == input.size(1) &&
+      (!bias.has_value() ||
+       (bias->dim() == 1 && bias->scalar_type() == at::kFloat &&
+        bias->is_contiguous() && bias->size(0) == weight.size(0)));
+  if (can_fuse) {
+    const auto M = input.size(0);
+    const auto K = input.size(1);
+    const auto N = weight.size(0);
+    at::native::resize_(out, {M, N}, c10::nullopt);
+    at::native::cpublas::gemm_with_epilogue(
+        at::native::TransposeType::Transpose,
+        at::native::TransposeType::NoTranspose,
+        N,
+        M,
+        K,
+        1.f,
+        weight.data_ptr<float>(),
+        K,
+        input.data_ptr<float>(),
+        K,
+        bias.has_value() ? bias->data_ptr<float>() : nullptr,
+        gelu ? at::native::cpublas::GemmEpilogue::GELU
+             : at::native::cpublas::GemmEpilogue::ReLU,
+        out.data_ptr<float>(),
+        N);
+    return;
+  }
+  at::native::linear_out(out, input, weight, bias);
+  if (gelu) {
+    at::gelu_out(out, out);
+  } else {
+    out.relu_();
+  }
+}
+
+} // namespace
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_OPERATOR_FUNCTOR(
+    static_runtime::linear_relu,
+    static_runtime_linear_relu,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "static_runtime::linear_relu(Tensor input, Tensor weight, Tensor? bias=None) -> Tensor"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        const auto& input = p_node->Input(0).toTensor();
+        const auto& weight = p_node->Input(1).toTensor();
+        auto bias = p_node->Input(2).toOptional<at::Tensor>();
+        if (p_node->Output(0).isNone()) {
+          p_node->Output(0) = create_empty_from(input);
+        }
+        auto& out = p_node->Output(0).toTensor();
+        fastResizeToZero(out);
+        linear_activation_out(out, input, weight, bias, /*gelu=*/false);
+      };
+    });
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_OPERATOR_FUNCTOR(
+    static_runtime::linear_gelu,
+    static_runtime_linear_gelu,
+    [](Node* n) -> SROperator {
+      if (!n->matches(torch::schema(
+              "static_runtime::linear_gelu(Tensor input, Tensor weight, Tensor? bias=None) -> Tensor"))) {
+        LogAndDumpSchema(n);
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        const auto& input = p_node->Input(0).toTensor();
+        const auto& weight = p_node->Input(1).toTensor();
+        auto bias = p_node->Input(2).toOptional<at::Tensor>();
+        if (p_node->Output(0).isNone()) {
+          p_node->Output(0) = create_empty_from(input);
+        }
+        auto& out = p_node->Output(0).toTensor();
+        fastResizeToZero(out);
+        linear_activation_out(out, input, weight, bias, /*gelu=*/true);
+      };
+    });
+
 REGISTER_OPERATOR_FUNCTOR(
     aten::remainder,
     aten_remainder,
@@ -341,6 +341,12 @@ TORCH_LIBRARY_FRAGMENT(static_runtime, m) {
       "static_runtime::layer_norm(Tensor input, int[] normalized_shape, Tensor? weight=None, Tensor? bias=None, float eps=1e-05, bool cudnn_enable=True) -> (Tensor, Tensor, Tensor)",
       c10::AliasAnalysisKind::PURE_FUNCTION));
   m.def("static_runtime::signed_log1p(Tensor input) -> Tensor");
+  m.def(torch::schema(
+      "static_runtime::linear_relu(Tensor input, Tensor weight, Tensor? bias=None) -> Tensor",
+      c10::AliasAnalysisKind::PURE_FUNCTION));
+  m.def(torch::schema(
+      "static_runtime::linear_gelu(Tensor input, Tensor weight, Tensor? bias=None) -> Tensor",
+      c10::AliasAnalysisKind::PURE_FUNCTION));
   m.def(torch::schema(
       "static_runtime::dict_unpack(...) -> ...",
       c10::AliasAnalysisKind::CONSERVATIVE));
@@ -373,6 +379,39 @@ void FuseSignLog1P(std::shared_ptr<torch::jit::Graph>& graph) {
   fuse.runOnGraph(graph);
 }
 
+void FuseLinearActivation(std::shared_ptr<torch::jit::Graph>& graph) {
+  std::string linear_relu_pattern = R"IR(
+    graph(%input, %weight, %bias):
+        %0 : Tensor = aten::linear(%input, %weight, %bias)
+        %res : Tensor = aten::relu(%0)
+        return (%res)
+  )IR";
+
+  std::string fused_linear_relu_pattern = R"IR(
+    graph(%input, %weight, %bias):
+        %res : Tensor = static_runtime::linear_relu(%input, %weight, %bias)
+        return (%res)
+    )IR";
+
+  std::string linear_gelu_pattern = R"IR(
+    graph(%input, %weight, %bias):
+        %0 : Tensor = aten::linear(%input, %weight, %bias)
+        %res : Tensor = aten::gelu(%0)
+        return (%res)
+  )IR";
+
+  std::string fused_linear_gelu_pattern = R"IR(
+    graph(%input, %weight, %bias):
+        %res : Tensor = static_runtime::linear_gelu(%input, %weight, %bias)
+        return (%res)
+    )IR";
+
+  SubgraphRewriter fuse;
+  fuse.RegisterRewritePattern(linear_relu_pattern, fused_linear_relu_pattern);
+  fuse.RegisterRewritePattern(linear_gelu_pattern, fused_linear_gelu_pattern);
+  fuse.runOnGraph(graph);
+}
+
 namespace {
 
 using TupleUnpackBlock = std::vector<Node*>;
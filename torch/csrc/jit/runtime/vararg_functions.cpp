@@ -102,7 +102,16 @@ void addFormattedArg(
 
 void tupleUnpack(Stack& stack) {
   auto tuple = pop(stack).toTuple();
-  stack.insert(stack.end(), tuple->elements().begin(), tuple->elements().end());
+  if (tuple.unique()) {
+    // We are the sole owner, so hand element ownership over to the stack
+    // instead of bumping a pair of atomic refcounts per element.
+    auto elements = std::move(*tuple).elements();
+    for (auto& element : elements) {
+      stack.emplace_back(std::move(element));
+    }
+  } else {
+    stack.insert(stack.end(), tuple->elements().begin(), tuple->elements().end());
+  }
 }
 
 void format(Stack& stack, size_t num_inputs) {
@@ -265,24 +274,85 @@ void listUnpack(Stack& stack, size_t num_outputs) {
       num_outputs,
       " elements in a list but found ",
       list.size());
-  stack.insert(stack.end(), list.begin(), list.end());
+  if (list.use_count() == 1) {
+    // Sole owner: extract moves each element out instead of copying it.
+    for (const auto i : c10::irange(num_outputs)) {
+      stack.emplace_back(list.extract(i));
+    }
+  } else {
+    stack.insert(stack.end(), list.begin(), list.end());
+  }
 }
 
 void tupleConstruct(Stack& stack, size_t num_inputs) {
-  std::vector<IValue> elems{
-      std::make_move_iterator(stack.end() - num_inputs),
-      std::make_move_iterator(stack.end())};
-  drop(stack, num_inputs);
-  push(stack, c10::ivalue::Tuple::create(std::move(elems)));
+  // Tuples of up to three elements fit in TupleElements' inline
+  // storage, so hand the elements over directly instead of routing
+  // them through a heap-allocated std::vector.
+  switch (num_inputs) {
+    case 0:
+      stack.emplace_back(c10::ivalue::Tuple::create());
+      break;
+    case 1:
+      stack.back() = c10::ivalue::Tuple::create(std::move(stack.back()));
+      break;
+    case 2: {
+      auto tuple = c10::ivalue::Tuple::create(
+          std::move(stack[stack.size() - 2]),
+          std::move(stack[stack.size() - 1]));
+      stack.pop_back();
+      stack.back() = std::move(tuple);
+      break;
+    }
+    case 3: {
+      auto tuple = c10::ivalue::Tuple::create(
+          std::move(stack[stack.size() - 3]),
+          std::move(stack[stack.size() - 2]),
+          std::move(stack[stack.size() - 1]));
+      stack.pop_back();
+      stack.pop_back();
+      stack.back() = std::move(tuple);
+      break;
+    }
+    default: {
+      std::vector<IValue> elems{
+          std::make_move_iterator(stack.end() - num_inputs),
+          std::make_move_iterator(stack.end())};
+      drop(stack, num_inputs - 1);
+      stack.back() = c10::ivalue::Tuple::create(std::move(elems));
+      break;
+    }
+  }
 }
 
 void namedTupleConstruct(
     Stack& stack,
     at::TupleTypePtr type,
     size_t num_inputs) {
-  std::vector<IValue> elems{
-      std::make_move_iterator(stack.end() - num_inputs),
-      std::make_move_iterator(stack.end())};
+  // Same inline-storage fast paths as tupleConstruct above.
+  c10::ivalue::TupleElements elems;
+  switch (num_inputs) {
+    case 0:
+      break;
+    case 1:
+      elems = c10::ivalue::TupleElements(std::move(stack[stack.size() - 1]));
+      break;
+    case 2:
+      elems = c10::ivalue::TupleElements(
+          std::move(stack[stack.size() - 2]),
+          std::move(stack[stack.size() - 1]));
+      break;
+    case 3:
+      elems = c10::ivalue::TupleElements(
+          std::move(stack[stack.size() - 3]),
+          std::move(stack[stack.size() - 2]),
+          std::move(stack[stack.size() - 1]));
+      break;
+    default:
+      elems = c10::ivalue::TupleElements(std::vector<IValue>{
+          std::make_move_iterator(stack.end() - num_inputs),
+          std::make_move_iterator(stack.end())});
+      break;
+  }
   drop(stack, num_inputs);
   push(
       stack,
@@ -354,8 +424,15 @@ void tupleSlice(Stack& stack, size_t begin, size_t end) {
   auto tuple = pop(stack).toTuple();
   std::vector<IValue> output_elems;
   output_elems.reserve(end - begin);
-  for (const auto i : c10::irange(begin, end)) {
-    output_elems.emplace_back(tuple->elements()[i]);
+  if (tuple.unique()) {
+    auto elements = std::move(*tuple).elements();
+    for (const auto i : c10::irange(begin, end)) {
+      output_elems.emplace_back(std::move(elements[i]));
+    }
+  } else {
+    for (const auto i : c10::irange(begin, end)) {
+      output_elems.emplace_back(tuple->elements()[i]);
+    }
   }
   push(stack, c10::ivalue::Tuple::create(std::move(output_elems)));
 }
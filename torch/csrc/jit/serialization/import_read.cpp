@@ -1,9 +1,118 @@
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace torch {
 namespace jit {
 
+namespace {
+
+// Note [Prefetching tensor records]
+// Deserialization alternates between unpickling and pulling tensor payloads
+// out of the zip archive, so for storage-bound models the reader sits idle
+// while the unpickler runs and vice versa. When
+// TORCH_PREFETCH_TENSOR_RECORDS=1 is set, a single background thread walks
+// the archive's tensor records in file order and reads them ahead of the
+// unpickler, which then picks up each payload from an in-memory cache (or
+// waits for the record currently in flight). A pool of reader threads would
+// not help here: PyTorchStreamReader serializes every read under its
+// reader_lock_, so one sequential reader already saturates the archive; the
+// win is overlapping that stream with unpickling.
+bool prefetchTensorRecordsEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_PREFETCH_TENSOR_RECORDS");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+class RecordPrefetcher {
+ public:
+  RecordPrefetcher(
+      caffe2::serialize::PyTorchStreamReader& reader,
+      const std::string& prefix)
+      : reader_(reader) {
+    for (auto& name : reader_.getAllRecords()) {
+      if (name.compare(0, prefix.size(), prefix) == 0) {
+        pending_.insert(name);
+        order_.emplace_back(std::move(name));
+      }
+    }
+    if (!order_.empty()) {
+      thread_ = std::thread([this]() { readRecords(); });
+    }
+  }
+
+  RecordPrefetcher(const RecordPrefetcher&) = delete;
+  RecordPrefetcher& operator=(const RecordPrefetcher&) = delete;
+
+  ~RecordPrefetcher() {
+    stop_ = true;
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  // Hands out the prefetched bytes for `name`, waiting if the background
+  // thread has not reached that record yet. Returns c10::nullopt for names
+  // this prefetcher does not cover (and for everything once the background
+  // thread has hit an error); the caller then reads the record directly,
+  // which surfaces any failure on the calling thread.
+  c10::optional<at::DataPtr> take(const std::string& name) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return failed_ || pending_.count(name) == 0; });
+    auto it = ready_.find(name);
+    if (it == ready_.end()) {
+      return c10::nullopt;
+    }
+    at::DataPtr data = std::move(it->second);
+    ready_.erase(it);
+    return c10::optional<at::DataPtr>(std::move(data));
+  }
+
+ private:
+  void readRecords() {
+    for (const auto& name : order_) {
+      if (stop_) {
+        break;
+      }
+      at::DataPtr data;
+      try {
+        data = std::get<0>(reader_.getRecord(name));
+      } catch (...) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        failed_ = true;
+        cv_.notify_all();
+        return;
+      }
+      std::lock_guard<std::mutex> guard(mutex_);
+      pending_.erase(name);
+      ready_.emplace(name, std::move(data));
+      cv_.notify_all();
+    }
+  }
+
+  caffe2::serialize::PyTorchStreamReader& reader_;
+  std::vector<std::string> order_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::unordered_set<std::string> pending_;
+  std::unordered_map<std::string, at::DataPtr> ready_;
+  bool failed_ = false;
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+};
+
+} // namespace
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     const std::string& pickle_prefix,
@@ -35,8 +144,21 @@ IValue readArchiveAndTensors(
   std::string tensor_dir_path =
       (tensor_prefix.compare("") != 0) ? tensor_prefix : archive_name + "/";
 
+  // See Note [Prefetching tensor records]. A shared storage context means the
+  // reader is shared across archives and records read here may belong to a
+  // later archive, so prefetching is restricted to the standalone case.
+  c10::optional<RecordPrefetcher> prefetcher;
+  if (prefetchTensorRecordsEnabled() && storage_context == nullptr) {
+    prefetcher.emplace(stream_reader, tensor_dir_path);
+  }
+
   auto read_record = [&](const std::string& name) {
     std::string ss = tensor_dir_path + name;
+    if (prefetcher) {
+      if (auto data = prefetcher->take(ss)) {
+        return std::move(*data);
+      }
+    }
     return std::get<0>(stream_reader.getRecord(ss));
   };
 
@@ -73,6 +73,36 @@ std::vector<char> pickle_save(const at::IValue& ivalue) {
 #endif
 }
 
+GatheredPickle pickle_gather(const IValue& ivalue) {
+  GatheredPickle result;
+  Pickler pickler([&](const char* buf, size_t size) {
+    result.pickle_data.insert(result.pickle_data.end(), buf, buf + size);
+  });
+  pickler.protocol();
+  pickler.pushIValue(ivalue);
+  pickler.stop();
+
+  // All tensor records written by PyTorchStreamWriter start on 64 byte
+  // boundaries; pad each payload to the same alignment within the gathered
+  // stream so consumers mapping the result see identically aligned data.
+  constexpr size_t kGatherAlignment = 64;
+  size_t offset = result.pickle_data.size();
+  result.tensor_segments.reserve(pickler.tensorData().size());
+  for (const auto& tensor : pickler.tensorData()) {
+    TensorSegment segment;
+    // For CPU tensors this borrows the storage without copying; non-CPU
+    // storages are materialized on CPU here, and the resulting tensor held
+    // by the WriteableTensorData keeps the bytes alive either way.
+    segment.payload = getWriteableTensorData(tensor);
+    const size_t padding =
+        (kGatherAlignment - offset % kGatherAlignment) % kGatherAlignment;
+    segment.header.assign(padding, '\0');
+    offset += padding + segment.payload.sizeInBytes();
+    result.tensor_segments.push_back(std::move(segment));
+  }
+  return result;
+}
+
 #ifndef C10_MOBILE
 class VectorReader : public caffe2::serialize::ReadAdapterInterface {
  public:
@@ -57,6 +57,45 @@ TORCH_API std::vector<char> pickle(
 /// `torch::pickle_load` in C++ and `torch.load` in Python.
 TORCH_API std::vector<char> pickle_save(const IValue& ivalue);
 
+/// One tensor payload of a scatter/gather pickle produced by
+/// `pickle_gather`.
+///
+/// `header` is owned by the segment and must be emitted immediately before
+/// the payload; it consists of zero padding that brings the payload to a
+/// 64 byte boundary of the gathered stream, matching the alignment
+/// `PyTorchStreamWriter` guarantees for tensor records so consumers that
+/// map the result can use vectorized reads.
+///
+/// `payload.data()`/`payload.sizeInBytes()` borrow the payload directly
+/// from the tensor's storage; `payload` keeps that storage alive, so the
+/// segment must outlive any transport operation that still references the
+/// span.
+struct TensorSegment {
+  std::vector<char> header;
+  WriteableTensorData payload;
+};
+
+/// Result of `pickle_gather`: the pickle program for the IValue, with
+/// tensor payloads stored out of band, followed by one segment per
+/// distinct tensor storage in the order the program references them.
+struct GatheredPickle {
+  std::vector<char> pickle_data;
+  std::vector<TensorSegment> tensor_segments;
+};
+
+/// Serialize an IValue without copying CPU tensor payloads.
+///
+/// Unlike `jit::pickle`, which memcpys every tensor byte through the
+/// writer callback, this returns borrowed spans of the tensors' storages
+/// so scatter/gather transports (e.g. writev-style sockets or
+/// shared-memory channels) can transmit the payloads directly from source
+/// memory. Non-CPU tensors are still copied to CPU first, as in
+/// `getWriteableTensorData`.
+///
+/// The per-segment sizes are not self-describing; a transport must convey
+/// them in its own framing to reassemble the stream on the receiving side.
+TORCH_API GatheredPickle pickle_gather(const IValue& ivalue);
+
 /// Deserialize a `torch::IValue` from bytes produced by either
 /// `torch::pickle_save` in C++ or `torch.save` in Python
 TORCH_API IValue pickle_load(const std::vector<char>& data);
@@ -8,13 +8,89 @@
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/jit/serialization/storage_context.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace torch {
 namespace jit {
 
 using ::c10::IValue;
 
+namespace {
+
+// Note [Deduplicating tensor storages at load]
+// Loading many model variants that share most of their weights materializes
+// one storage per variant per tensor, so resident memory scales with the
+// number of variants even though the bytes are identical. When
+// TORCH_DEDUP_TENSOR_STORAGES=1 is set, every freshly read CPU storage is
+// looked up in a process-wide cache keyed by its size and a hash of its
+// contents; a hit (confirmed by comparing the actual bytes, so hash
+// collisions cannot mix up weights) discards the fresh copy and aliases the
+// cached storage instead. The cache holds weak references, so it never
+// extends a storage's lifetime and entries vanish when the last module using
+// them is unloaded. Deduplicated modules genuinely share storage: an
+// in-place write to one is visible in the others, which is why this is
+// opt-in.
+bool dedupTensorStoragesEnabled() {
+  static const bool enabled = []() {
+    const char* env = std::getenv("TORCH_DEDUP_TENSOR_STORAGES");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+  }();
+  return enabled;
+}
+
+uint64_t hashStorageBytes(const void* data, size_t nbytes) {
+  // FNV-1a; collisions are tolerable because matches are verified bytewise.
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < nbytes; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+class StorageDedupCache {
+ public:
+  static StorageDedupCache& get() {
+    static StorageDedupCache cache;
+    return cache;
+  }
+
+  // Returns a cached storage holding the same bytes as `storage`, or caches
+  // `storage` itself and returns it if there is none.
+  at::Storage dedup(at::Storage storage) {
+    const size_t nbytes = storage.nbytes();
+    const uint64_t hash = hashStorageBytes(storage.data(), nbytes);
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto range = cache_.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      auto cached = it->second.lock();
+      if (!cached) {
+        // The last module using this entry was unloaded; drop it.
+        it = cache_.erase(it);
+        continue;
+      }
+      if (cached->nbytes() == nbytes &&
+          std::memcmp(cached->data(), storage.data(), nbytes) == 0) {
+        return at::Storage(std::move(cached));
+      }
+      ++it;
+    }
+    cache_.emplace(hash, storage.getWeakStorageImpl());
+    return storage;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_multimap<uint64_t, c10::weak_intrusive_ptr<c10::StorageImpl>>
+      cache_;
+};
+
+} // namespace
+
 static void restoreAccurateTypeTagsIfPossible(const IValue& root) {
   if (root.isObject()) {
     restoreAccurateTypeTags(root, root.type());
@@ -319,7 +395,7 @@ PickleOpCode Unpickler::readInstruction() {
     } break;
     case PickleOpCode::BINUNICODE: {
       uint32_t length = read<uint32_t>();
-      stack_.emplace_back(readBytes(length));
+      stack_.emplace_back(internedString(readBytes(length)));
     } break;
     case PickleOpCode::BINFLOAT:
       stack_.emplace_back(readFloat());
@@ -421,7 +497,26 @@ PickleOpCode Unpickler::readInstruction() {
       // Module name, it's not needed for anything
       auto module_name = readString();
       auto class_name = readString();
+      // Resolve each (module, class) pair at most once per run; later
+      // occurrences just push the index of the closure the first one
+      // installed.
+      std::string key;
+      key.reserve(module_name.size() + class_name.size() + 1);
+      key.append(module_name).append("\n").append(class_name);
+      auto memo_entry = globals_memo_.find(key);
+      if (memo_entry != globals_memo_.end()) {
+        stack_.emplace_back(int64_t(memo_entry->second));
+        break;
+      }
+      size_t globals_size_before = globals_.size();
       readGlobal(module_name, class_name);
+      if (globals_.size() > globals_size_before) {
+        // readGlobal installed a closure and left its index on the stack.
+        // The enum-like torch globals (storage scalar types, qschemes) push
+        // a plain value instead and are cheap to re-read, so they are not
+        // memoized.
+        globals_memo_.emplace(std::move(key), globals_.size() - 1);
+      }
     } break;
     case PickleOpCode::NEWOBJ: {
       // pop empty tuple, the actual action is stored in the globals_stack_
@@ -469,6 +564,11 @@ PickleOpCode Unpickler::readInstruction() {
             /*allocator=*/nullptr,
             /*resizable=*/false); // NB: we didn't set any allocator for the
                                   // tensor
+        // See Note [Deduplicating tensor storages at load]
+        if (dedupTensorStoragesEnabled() && storage.device().is_cpu() &&
+            storage.nbytes() > 0) {
+          storage = StorageDedupCache::get().dedup(std::move(storage));
+        }
         if (storage_context_ != nullptr) {
           storage_context_->addStorage(key, storage);
         }
@@ -877,6 +977,25 @@ std::string Unpickler::readBytes(size_t length) {
   return data;
 }
 
+// Share one ConstantString per distinct small string value. The pickler's
+// memo table is keyed on object identity, so value-equal strings that were
+// distinct objects at save time (dict keys of large checkpoints are the
+// common case) arrive as separate BINUNICODE records; interning caps the
+// allocations at one per distinct value. Long strings pass through: they
+// are rarely repeated and would bloat the table.
+IValue Unpickler::internedString(std::string&& s) {
+  static const size_t kMaxInternedStringSize = 64;
+  if (s.size() > kMaxInternedStringSize) {
+    return IValue(std::move(s));
+  }
+  auto it = string_intern_table_.find(s);
+  if (it == string_intern_table_.end()) {
+    IValue value(s);
+    it = string_intern_table_.emplace(std::move(s), std::move(value)).first;
+  }
+  return it->second;
+}
+
 // Pop all the list items off of the stack and append them to the list at
 // the corresponding MARK
 void Unpickler::readList(IValue list_ivalue) {
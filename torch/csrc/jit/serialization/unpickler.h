@@ -102,6 +102,7 @@ class TORCH_API Unpickler {
   }
   void readSlowWithBuffer(char* dest, size_t sz);
   std::string readBytes(size_t num_bytes);
+  IValue internedString(std::string&& s);
 
   double readFloat();
   void readGlobal(
@@ -144,6 +145,17 @@ class TORCH_API Unpickler {
   // pickler, so we can just use the actual data pointer of each string.
   std::unordered_map<std::string, c10::TypePtr> type_cache_;
 
+  // One closure in globals_ per distinct (module, class) pair; repeated
+  // GLOBAL opcodes for the same pair reuse the closure installed by the
+  // first occurrence instead of re-resolving the type.
+  std::unordered_map<std::string, size_t> globals_memo_;
+
+  // Value-based interning for small strings read via BINUNICODE; see
+  // internedString(). The pickler's memo is keyed on object identity,
+  // so value-equal strings may still arrive as separate BINUNICODE
+  // records.
+  std::unordered_map<std::string, IValue> string_intern_table_;
+
   // optionally nullptr, needs to be present for creating classes
   TypeResolver type_resolver_;
   ObjLoader obj_loader_;
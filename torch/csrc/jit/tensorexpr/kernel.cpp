@@ -43,6 +43,7 @@ static bool te_generate_block_code = false;
 static bool te_must_use_llvm_on_cpu = true;
 static bool cat_wo_conditionals = true; // NOLINT
 static bool opt_conditionals = false; // NOLINT
+static bool te_allow_dynamic_batch = false; // NOLINT
 
 bool setFallbackAllowed(bool value) {
   bool old_value = fallback_allowed;
@@ -115,6 +116,10 @@ bool& getOptConditionals() {
   return opt_conditionals;
 }
 
+bool& getTEAllowDynamicBatch() {
+  return te_allow_dynamic_batch;
+}
+
 c10::optional<at::Device> pickDeviceType(
     const at::ArrayRef<torch::jit::Value*>& inputs) {
   c10::optional<at::Device> device = c10::nullopt;
@@ -353,6 +358,56 @@ ArgValue TensorExprKernel::toArg(const torch::jit::Value* v) const {
   return scalars_.at(v);
 }
 
+// Note [Dynamic batch dimension]
+//
+// The kernel is normally specialized on the concrete shapes recorded by the
+// profiler, so every new batch size triggers a full recompilation. When
+// getTEAllowDynamicBatch() is set, the leading dimension is compiled as a
+// runtime parameter instead: every tensor whose leading dimension matches the
+// profiled batch size gets a symbolic leading dimension, loop bounds over
+// that dimension become expressions of a kernel argument, and the actual
+// batch size is passed as a trailing scalar argument on every call. One
+// compiled kernel then serves the whole family of shapes that only differ in
+// the batch dimension.
+//
+// Restrictions: the profiled batch size must be greater than one (a leading
+// dimension of one is indistinguishable from a broadcast), tensors must be
+// contiguous in the batched dimension so that the inner strides do not depend
+// on it, and ops whose output size depends on the batch other than
+// one-to-one (e.g. cat along the batch dimension) are not supported. Callers
+// are responsible for only feeding inputs from the kernel's shape family;
+// the fusion guards still check full shapes, so this is currently only
+// exploitable by clients constructing TensorExprKernel directly.
+void TensorExprKernel::planSymbolicBatchDim() {
+  for (size_t idx = 0; idx < graph_->inputs().size(); idx++) {
+    auto const& input = graph_->inputs()[idx];
+    auto tt = input->type()->cast<TensorType>();
+    if (!tt || !tt->sizes().concrete_sizes()) {
+      continue;
+    }
+    auto sizes = *tt->sizes().concrete_sizes();
+    if (sizes.empty() || sizes[0] <= 1) {
+      continue;
+    }
+    profiledBatchSize_ = sizes[0];
+    batchInputIdx_ = idx;
+    batchVar_ = VarHandle("batch_size", kLong);
+    hasSymbolicBatch_ = true;
+    return;
+  }
+}
+
+void TensorExprKernel::symbolizeBatchDim(
+    std::vector<ExprHandle>& sizes) const {
+  if (!hasSymbolicBatch_ || sizes.empty()) {
+    return;
+  }
+  auto dim0 = intValue(sizes[0].node());
+  if (dim0 && *dim0 == profiledBatchSize_) {
+    sizes[0] = batchVar_;
+  }
+}
+
 std::vector<ExprHandle> TensorExprKernel::sizesFromVaryingShape(
     const c10::VaryingShape<int64_t>& shape) {
   std::vector<ExprHandle> dims;
@@ -373,7 +428,9 @@ std::vector<ExprHandle> TensorExprKernel::sizesForValue(
   if (v->type()->kind() == TypeKind::TensorType) {
     auto tt = v->type()->cast<TensorType>();
     if (tt->sizes().concrete_sizes()) {
-      return sizesFromVaryingShape(tt->sizes());
+      auto sizes = sizesFromVaryingShape(tt->sizes());
+      symbolizeBatchDim(sizes);
+      return sizes;
     }
   }
 
@@ -559,6 +616,9 @@ static void pruneByThreadCount(std::vector<ForPtr>& loops) {
     }
     auto tc = tripCount(*it);
     if (!tc) {
+      // A symbolic trip count (e.g. a dynamic batch dimension) is assumed to
+      // provide enough parallelism on its own.
+      it++;
       break;
     }
     trips *= *tc;
@@ -698,6 +758,24 @@ StmtPtr TensorExprKernel::transformLoops(BackendType backendType, StmtPtr st) {
     }
   }
 
+  // Expose vector lanes in reduction loops while ReduceOps are still explicit;
+  // after prepareForCodegen they become accumulating stores through a
+  // loop-invariant index, which cannot be vectorized directly (see
+  // Vectorizer::mutate(StorePtr)).
+  if (backendType == kLLVMCodeGen && hasReduction) {
+    const int kReductionVectorWidth = 8;
+    std::vector<ForPtr> innerLoops;
+    for (auto loop : NodeFinder<For>::find(l.root_stmt())) {
+      if (NodeFinder<For>::find(loop->body()).empty()) {
+        innerLoops.push_back(loop);
+      }
+    }
+    for (auto loop : innerLoops) {
+      l.vectorizeReduction(loop, kReductionVectorWidth);
+    }
+    GRAPH_DEBUG("after reduction vectorization", *l.root_stmt());
+  }
+
   if (backendType == kBlockCodeGen) {
     for (auto buf : bufOutputs_) {
       const int default_fp16_blocksize = 16;
@@ -737,7 +815,10 @@ StmtPtr TensorExprKernel::transformLoops(BackendType backendType, StmtPtr st) {
   l.simplify();
   GRAPH_DEBUG("after simplification", *l.root_stmt());
 
-  if (backendType == kLLVMCodeGen && !hasReduction) {
+  // This is safe in the presence of reductions: the Vectorizer refuses
+  // accumulating stores, so reduction loops that were not rfactored above are
+  // left untouched while any surrounding elementwise loops still vectorize.
+  if (backendType == kLLVMCodeGen) {
     l.vectorizeInnerLoops();
     GRAPH_DEBUG("after vectorization", *l.root_stmt());
   }
@@ -833,9 +914,11 @@ Tensor TensorExprKernel::bindInput(const torch::jit::Value* input) {
         throw malformed_input(msg);
       }
       if (isContiguous(input)) {
+        auto inputSizes = toExprHandles(*tt->sizes().concrete_sizes());
+        symbolizeBatchDim(inputSizes);
         BufHandle inBuffer(
             "t" + input_name_map_[input],
-            toExprHandles(*tt->sizes().concrete_sizes()),
+            inputSizes,
             ToDtype(static_cast<ScalarType>(*tt->scalarType())));
         bufs_.emplace(input, inBuffer.node());
         bufferArgs_.emplace_back(inBuffer);
@@ -845,10 +928,12 @@ Tensor TensorExprKernel::bindInput(const torch::jit::Value* input) {
           "t" + input_name_map_[input],
           {0},
           ToDtype(static_cast<ScalarType>(*tt->scalarType())));
+      auto inputSizes = toExprHandles(*tt->sizes().concrete_sizes());
+      symbolizeBatchDim(inputSizes);
       std::vector<DimArg> inputTensorDims;
-      for (size_t i = 0; i < *tt->sizes().size(); i++) {
-        auto const size = *tt->sizes()[i];
-        inputTensorDims.emplace_back(DimArg(size, "i" + c10::to_string(i)));
+      for (size_t i = 0; i < inputSizes.size(); i++) {
+        inputTensorDims.emplace_back(
+            DimArg(inputSizes[i], "i" + c10::to_string(i)));
       }
       auto const strides = tt->strides();
       result = Compute(
@@ -954,6 +1039,15 @@ Tensor TensorExprKernel::convertOutputToCorrectStrides(torch::jit::Value* v) {
     return Tensor(buf, nullptr);
   }
 
+  // The restriding loop below bakes the profiled sizes and strides into the
+  // generated code, which a symbolic batch dimension cannot satisfy.  See
+  // Note [Dynamic batch dimension].
+  if (hasSymbolicBatch_) {
+    std::string msg = std::string("Cannot restride output '%") +
+        v->debugName() + "' with a dynamic batch dimension";
+    throw malformed_input(msg);
+  }
+
   auto dims = c10::fmap<DimArg>(sizesForValue(v));
   // We need to convert the output tensor so that its values are layed
   // so that when viewed from the output strides the values are correct.
@@ -1090,6 +1184,11 @@ void TensorExprKernel::compile() {
   device_ = *pickDeviceType(graph_);
   OptimizeCat(graph_);
 
+  // See Note [Dynamic batch dimension]
+  if (getTEAllowDynamicBatch() && device_.type() == at::kCPU) {
+    planSymbolicBatchDim();
+  }
+
   // Block to collect the Stmts corresponding to all tensors.
   auto block = alloc<Block>(std::vector<StmtPtr>({}));
 
@@ -1142,6 +1241,8 @@ void TensorExprKernel::compile() {
     const auto& tt = output->type()->expect<TensorType>();
     auto sizes = *tt->sizes().concrete_sizes();
     tensorOutputSizes_.push_back(sizes);
+    tensorOutputHasBatchDim_.push_back(
+        hasSymbolicBatch_ && !sizes.empty() && sizes[0] == profiledBatchSize_);
     auto strides = tt->strides().concrete_sizes();
 
     // If the tensor is not dense or overlaps, we have
@@ -1165,6 +1266,9 @@ void TensorExprKernel::compile() {
   for (auto c : constants_) {
     bufferArgs_.emplace_back(BufHandle(c.buf));
   }
+  if (hasSymbolicBatch_) {
+    bufferArgs_.emplace_back(batchVar_);
+  }
 
   // Generate code.
   codegen_ = CreateCodeGen(
@@ -1233,11 +1337,23 @@ std::vector<CodeGen::CallArg> TensorExprKernel::prepareRunArgs(
     }
   }
 
+  // See Note [Dynamic batch dimension]
+  int64_t batch_size = profiledBatchSize_;
+  if (hasSymbolicBatch_) {
+    batch_size = inputs[batchInputIdx_].toTensor().size(0);
+  }
+
   for (size_t i = 0, e = bufOutputs_.size(); i < e; ++i) {
     auto const& opts = tensorOutputTensorOptions_[i];
+    auto sizes = tensorOutputSizes_[i];
+    auto strides = tensorOutputStrides_[i];
+    if (tensorOutputHasBatchDim_[i] && batch_size != profiledBatchSize_) {
+      sizes[0] = batch_size;
+      strides = TensorType::contiguousStridesOf(sizes);
+    }
     outputs.emplace_back(codegen_->empty_strided(
-        tensorOutputSizes_[i],
-        tensorOutputStrides_[i],
+        sizes,
+        strides,
         opts.dtype,
         opts.layout,
         opts.device,
@@ -1248,6 +1364,9 @@ std::vector<CodeGen::CallArg> TensorExprKernel::prepareRunArgs(
   for (auto c : constants_) {
     runArgs.emplace_back(c.ptr);
   }
+  if (hasSymbolicBatch_) {
+    runArgs.emplace_back(batch_size);
+  }
 
   return runArgs;
 }
@@ -1276,6 +1395,12 @@ void TensorExprKernel::runKernel(Stack& stack) {
 void TensorExprKernel::runFast(
     const std::vector<void*>& inputs,
     const std::vector<void*>& outputs) {
+  // The raw-pointer interface carries no size information, so the batch size
+  // argument cannot be recovered here.  See Note [Dynamic batch dimension].
+  TORCH_INTERNAL_ASSERT(
+      !hasSymbolicBatch_,
+      buildErrorMessage(
+          "runFast is not supported with a dynamic batch dimension in the fuser."));
   std::vector<void*> args(inputs);
   args.reserve(inputs.size() + outputs.size() + constants_.size());
   args.insert(args.end(), outputs.begin(), outputs.end());
@@ -173,6 +173,10 @@ class TORCH_API TensorExprKernel {
 
   Tensor bindInput(const torch::jit::Value* input);
 
+  // See Note [Dynamic batch dimension]
+  void planSymbolicBatchDim();
+  void symbolizeBatchDim(std::vector<ExprHandle>& sizes) const;
+
   Tensor convertOutputToCorrectStrides(torch::jit::Value* v);
 
   // Captures the information for reduction operation nodes.
@@ -227,6 +231,13 @@ class TORCH_API TensorExprKernel {
   bool use_fallback_{false};
   bool hasRandom_{false};
   bool hasBroadcast_{false};
+
+  // See Note [Dynamic batch dimension]
+  bool hasSymbolicBatch_{false};
+  int64_t profiledBatchSize_{-1};
+  size_t batchInputIdx_{0};
+  VarHandle batchVar_;
+  std::vector<bool> tensorOutputHasBatchDim_;
   std::unordered_map<const torch::jit::Value*, std::vector<ExprHandle>>
       known_sizes_;
 
@@ -246,6 +257,7 @@ TORCH_API bool fallbackAllowed();
 TORCH_API bool setFallbackAllowed(bool value);
 TORCH_API bool& getCatWoConditionals();
 TORCH_API bool& getOptConditionals();
+TORCH_API bool& getTEAllowDynamicBatch();
 
 TORCH_API c10::optional<at::Device> pickDeviceType(
     const at::ArrayRef<torch::jit::Value*>& inputs);
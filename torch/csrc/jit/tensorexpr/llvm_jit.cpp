@@ -5,6 +5,7 @@
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/JITSymbol.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/Orc/CompileUtils.h>
 #include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
 #include <llvm/ExecutionEngine/Orc/IRCompileLayer.h>
@@ -14,10 +15,15 @@
 #include <llvm/ExecutionEngine/RTDyldMemoryManager.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/DataLayout.h>
+#include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Mangler.h>
 #include <llvm/Support/CFGUpdate.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SmallVectorMemoryBuffer.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Target/TargetMachine.h>
 
@@ -26,6 +32,7 @@
 #include <c10/util/Half.h>
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -124,12 +131,101 @@ static void registerIntrinsics(
 namespace llvm {
 namespace orc {
 
+// Note [TensorExpr kernel cache]
+// Compiling a fused kernel through the LLVM backend dominates process warmup
+// when a service executes a fixed set of models. The emitted object code is a
+// pure function of the optimized module IR and of the target machine
+// configuration, so it can be reused across process restarts. When
+// PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR is set, compiled kernel objects are
+// persisted in that directory, keyed by an MD5 digest of the module IR (which
+// embeds the target triple, the data layout and every shape specialization
+// baked into the kernel) combined with the CPU name and subtarget features.
+// A restarted process memory-maps the prebuilt object and links it instead of
+// re-running IR optimization and instruction selection. The cache is
+// best-effort: any I/O failure silently degrades to a recompile.
+class PytorchKernelObjectCache : public ObjectCache {
+ public:
+  explicit PytorchKernelObjectCache(const TargetMachine& TM) {
+    const char* dir = std::getenv("PYTORCH_TENSOREXPR_KERNEL_CACHE_DIR");
+    if (!dir || !*dir) {
+      return;
+    }
+    if (llvm::sys::fs::create_directories(dir)) {
+      // Could not create the cache directory; leave the cache disabled.
+      return;
+    }
+    cacheDir_ = dir;
+    targetSpec_ = TM.getTargetTriple().str();
+    targetSpec_ += ';';
+    targetSpec_ += TM.getTargetCPU().str();
+    targetSpec_ += ';';
+    targetSpec_ += TM.getTargetFeatureString().str();
+  }
+
+  bool enabled() const {
+    return !cacheDir_.empty();
+  }
+
+  void notifyObjectCompiled(const Module* M, MemoryBufferRef Obj) override {
+    if (!enabled()) {
+      return;
+    }
+    // Write to a unique temporary file first so that concurrent processes
+    // sharing the cache directory never observe a partially written object,
+    // then move it into place atomically.
+    SmallString<256> tmpPath;
+    int tmpFD = 0;
+    if (llvm::sys::fs::createUniqueFile(
+            cacheDir_ + "/tmp-%%%%%%.o", tmpFD, tmpPath)) {
+      return;
+    }
+    {
+      raw_fd_ostream out(tmpFD, /*shouldClose=*/true);
+      out.write(Obj.getBufferStart(), Obj.getBufferSize());
+    }
+    if (llvm::sys::fs::rename(tmpPath, objectPath(*M))) {
+      llvm::sys::fs::remove(tmpPath);
+    }
+  }
+
+  std::unique_ptr<MemoryBuffer> getObject(const Module* M) override {
+    if (!enabled()) {
+      return nullptr;
+    }
+    // getFile memory-maps the object when profitable; RuntimeDyld copies the
+    // sections it needs and the mapping is dropped afterwards.
+    auto buffer = MemoryBuffer::getFile(
+        objectPath(*M), /*FileSize=*/-1, /*RequiresNullTerminator=*/false);
+    if (!buffer) {
+      return nullptr;
+    }
+    return std::move(*buffer);
+  }
+
+ private:
+  std::string objectPath(const Module& M) const {
+    std::string ir;
+    raw_string_ostream irStream(ir);
+    M.print(irStream, nullptr);
+    MD5 hasher;
+    hasher.update(irStream.str());
+    hasher.update(targetSpec_);
+    MD5::MD5Result digest;
+    hasher.final(digest);
+    return cacheDir_ + "/" + MD5::stringifyResult(digest).str().str() + ".o";
+  }
+
+  std::string cacheDir_;
+  std::string targetSpec_;
+};
+
 // Lightly modified implementation from LLVM's Kaleidoscope JIT tutorial:
 // https://llvm.org/docs/tutorial/BuildingAJIT1.html
 #if LLVM_VERSION_MAJOR >= 9
 class TORCH_API PytorchLLVMJITImpl {
  private:
   std::unique_ptr<TargetMachine> TM;
+  std::unique_ptr<PytorchKernelObjectCache> kernelCache_;
   std::unique_ptr<LLJIT> LLJ;
   std::unordered_set<std::string> intrinsics;
 
@@ -140,6 +236,7 @@ class TORCH_API PytorchLLVMJITImpl {
       c10::optional<std::string> attrs)
       : TM(assertSuccess(makeTargetMachineBuilder(triple, cpu, attrs)
                              .createTargetMachine())),
+        kernelCache_(std::make_unique<PytorchKernelObjectCache>(*TM)),
         LLJ(assertSuccess(LLJITBuilder()
                               .setJITTargetMachineBuilder(
                                   makeTargetMachineBuilder(triple, cpu, attrs))
@@ -162,6 +259,37 @@ class TORCH_API PytorchLLVMJITImpl {
   }
 
   void addModule(std::unique_ptr<Module> M, std::unique_ptr<LLVMContext> C) {
+    if (kernelCache_->enabled()) {
+      // See Note [TensorExpr kernel cache]. Link a prebuilt object when one
+      // exists; otherwise compile eagerly so the result can be persisted
+      // before it is handed to the JIT.
+      if (auto Obj = kernelCache_->getObject(M.get())) {
+        assertSuccess(
+            LLJ->addObjectFile(std::move(Obj)),
+            "Failed to add cached kernel object to the JIT");
+        return;
+      }
+      SmallVector<char, 0> objBuffer;
+      raw_svector_ostream objStream(objBuffer);
+      legacy::PassManager PM;
+      TM->addPassesToEmitFile(
+          PM,
+          objStream,
+          nullptr,
+#if LLVM_VERSION_MAJOR >= 10
+          llvm::CodeGenFileType::CGFT_ObjectFile);
+#else
+          llvm::TargetMachine::CodeGenFileType::CGFT_ObjectFile);
+#endif
+      PM.run(*M);
+      auto Obj = std::make_unique<SmallVectorMemoryBuffer>(
+          std::move(objBuffer));
+      kernelCache_->notifyObjectCompiled(M.get(), Obj->getMemBufferRef());
+      assertSuccess(
+          LLJ->addObjectFile(std::move(Obj)),
+          "Failed to add kernel object to the JIT");
+      return;
+    }
     assertSuccess(
         LLJ->addIRModule(ThreadSafeModule(std::move(M), std::move(C))),
         "Failed to add module to compile layer");
@@ -191,6 +319,7 @@ class TORCH_API PytorchLLVMJITImpl {
   ExecutionSession ES;
   std::shared_ptr<SymbolResolver> Resolver;
   std::unique_ptr<TargetMachine> TM;
+  std::unique_ptr<PytorchKernelObjectCache> kernelCache_;
   const DataLayout DL;
   RTDyldObjectLinkingLayer ObjectLayer;
   IRCompileLayer<decltype(ObjectLayer), SimpleCompiler> CompileLayer;
@@ -222,6 +351,7 @@ class TORCH_API PytorchLLVMJITImpl {
             })),
         TM(assertSuccess(makeTargetMachineBuilder(triple, cpu, attrs)
                              .createTargetMachine())),
+        kernelCache_(std::make_unique<PytorchKernelObjectCache>(*TM)),
         DL(TM->createDataLayout()),
         ObjectLayer(
             ES,
@@ -229,7 +359,9 @@ class TORCH_API PytorchLLVMJITImpl {
               return RTDyldObjectLinkingLayer::Resources{
                   std::make_shared<SectionMemoryManager>(), Resolver};
             }),
-        CompileLayer(ObjectLayer, SimpleCompiler(*TM)) {
+        // SimpleCompiler consults the object cache before compiling; see
+        // Note [TensorExpr kernel cache].
+        CompileLayer(ObjectLayer, SimpleCompiler(*TM, kernelCache_.get())) {
     auto& JD = ES.getMainJITDylib();
     MangleAndInterner Mangle(ES, DL);
     registerIntrinsics(JD, Mangle, intrinsics);
@@ -465,11 +465,29 @@ class Vectorizer : public IRMutator {
 
   StmtPtr mutate(StorePtr v) override {
     BufPtr buf = v->buf();
-    std::vector<ExprPtr> inputs = {v->flat_index(), v->value()};
-    return try_vectorize(v, inputs, [&]() {
-      return Store::make(
-          BufHandle(buf), {ExprHandle(inputs[0])}, ExprHandle(inputs[1]));
-    });
+    ExprPtr index = v->flat_index();
+    ExprPtr value = v->value();
+
+    ExprPtr new_index = index->accept_mutator(this);
+    ExprPtr new_value = value->accept_mutator(this);
+    if (new_index == index && new_value == value) {
+      return (StmtPtr)v;
+    }
+
+    if (new_index == index) {
+      // The value was vectorized but the index is invariant in the loop being
+      // vectorized, i.e. all lanes would write through the same location. This
+      // happens for accumulating stores produced by expanding a ReduceOp over
+      // this axis; a broadcast-index store would make the lanes clobber each
+      // other. Such loops need an rfactor first (see vectorizeReduction).
+      success_ = false;
+      return (StmtPtr)v;
+    }
+    if (new_value == value) {
+      new_value = Broadcast::make(ExprHandle(value), lanes_).node();
+    }
+    return Store::make(
+        BufHandle(buf), {ExprHandle(new_index)}, ExprHandle(new_value));
   }
 
   StmtPtr mutate(ForPtr v) override {
@@ -615,6 +633,100 @@ bool LoopNest::vectorize(ForPtr f) {
   return false;
 }
 
+bool LoopNest::vectorizeReduction(ForPtr f, int lanes) {
+  if (!f || lanes <= 1) {
+    return false;
+  }
+
+  // Only handle innermost loops whose sole statement is a reduction store
+  // over the loop variable; anything fancier should be scheduled explicitly.
+  if (!NodeFinder<For>::find(f->body()).empty()) {
+    return false;
+  }
+  if (f->body()->nstmts() != 1) {
+    return false;
+  }
+  auto stores = NodeFinder<Store>::find(f);
+  if (stores.size() != 1) {
+    return false;
+  }
+  StorePtr reduce_store = stores.front();
+  ReduceOpPtr reduce_op = to<ReduceOp>(reduce_store->value());
+  if (!reduce_op) {
+    return false;
+  }
+
+  // rfactor requires all other reduction axes to be nested inside the axis
+  // being factored out. Since the lanes are carved out of this innermost
+  // loop, it must be the only reduction axis of the store.
+  const auto& reduce_args = reduce_op->reduce_args();
+  if (reduce_args.size() != 1 || reduce_args.front() != f->var()) {
+    return false;
+  }
+
+  // Need a constant trip count covering at least one full vector of lanes.
+  auto start = intValue(f->start());
+  auto stop = intValue(f->stop());
+  if (!start || !stop || *stop - *start < lanes) {
+    return false;
+  }
+  BufPtr reduce_buf = reduce_store->buf();
+
+  // Split out the vector lanes and rotate them to the outer position so the
+  // lane axis becomes the outermost reduction axis, which rfactor can then
+  // turn into a normal axis of a temporary accumulator.
+  ForPtr inner = nullptr;
+  ForPtr tail = nullptr;
+  splitWithTail(f, lanes, &inner, &tail);
+  VarPtr lane_var = inner->var();
+  reorderAxis(f, inner);
+
+  // reorderAxis rebuilds the nest, so re-find the lane loop and the store.
+  ForPtr lane_loop = nullptr;
+  for (auto loop : NodeFinder<For>::find(root_stmt_)) {
+    if (loop->var() == lane_var) {
+      lane_loop = loop;
+      break;
+    }
+  }
+  if (!lane_loop) {
+    return false;
+  }
+  StorePtr rfactor_target = nullptr;
+  for (auto s : NodeFinder<Store>::find(lane_loop)) {
+    if (s->buf() == reduce_buf && to<ReduceOp>(s->value())) {
+      rfactor_target = s;
+      break;
+    }
+  }
+  if (!rfactor_target) {
+    return false;
+  }
+
+  BufPtr rfac_buf = nullptr;
+  if (!rfactor(rfactor_target, lane_loop, &rfac_buf)) {
+    return false;
+  }
+  // Separate the rfac initializer and the final cross-lane reduction from
+  // the accumulation so the accumulation can be vectorized on its own.
+  distributeLoop(lane_loop);
+
+  // The first nest writing to rfac_buf is its initializer, the second is the
+  // accumulation. Vectorizing the lane loop of the accumulation yields one
+  // vector ReduceOp per step of the remaining reduction axis; the final
+  // cross-lane reduction stays a lanes-long scalar loop.
+  auto rfac_nests = getAllLoopNestsWritingToBuf(rfac_buf);
+  if (rfac_nests.size() < 2) {
+    return false;
+  }
+  for (auto loop : rfac_nests[1]) {
+    if (loop->var() == lane_var) {
+      return vectorize(loop);
+    }
+  }
+  return false;
+}
+
 void LoopNest::initialize(
     const std::vector<Tensor>& output_tensors,
     const std::vector<Tensor>& tensors_to_compute) {
@@ -544,8 +544,42 @@ class TORCH_API LoopNest {
   // It returns true if vectorization is successful and false otherwise.
   static bool vectorize(ForPtr);
 
+  // Vectorize the reduction computed by the given loop. The loop must be an
+  // innermost loop whose only statement is a reduction store and whose
+  // variable is the sole reduction axis of that store.
+  //
+  // This splits `lanes` vector lanes out of the reduction axis and rfactors
+  // them into a normal axis of a temporary accumulator so the accumulation
+  // can be vectorized; a `lanes`-long scalar loop combines the partial sums.
+  //
+  // For example, with lanes == 8:
+  //   for (int j = 0; j < 64; ++j) {
+  //     B[0] = ReduceOp((B[0]) + (A[j]), reduce_args={j})
+  //   }
+  // is transformed to:
+  //   for (int j_inner = 0; j_inner < 8; ++j_inner) {
+  //     B_rfac[j_inner] = 0.f
+  //   }
+  //   for (int j_outer = 0; j_outer < 8; ++j_outer) {
+  //     B_rfac[Ramp(0, 1, 8)] = ReduceOp(
+  //         (B_rfac[Ramp(0, 1, 8)]) + (A[Ramp(8 * j_outer, 1, 8)]),
+  //         reduce_args={j_outer})
+  //   }
+  //   for (int j_inner = 0; j_inner < 8; ++j_inner) {
+  //     B[0] = ReduceOp((B[0]) + (B_rfac[j_inner]), reduce_args={j_inner})
+  //   }
+  // Iterations that do not fill a whole vector are reduced by a scalar tail
+  // loop.
+  //
+  // It returns true if the transformation succeeds and false otherwise. On
+  // failure the loop may have been split and reordered, but it still computes
+  // the same result.
+  bool vectorizeReduction(ForPtr f, int lanes);
+
   // Find the inner-most loops and vectorize them. Currently, this only works
-  // for the LLVM backend, when no reductions are involved.
+  // for the LLVM backend. Loops that accumulate through a loop-invariant
+  // index (i.e. expanded reductions) are left scalar; use vectorizeReduction
+  // on such loops before the ReduceOps are expanded.
   void vectorizeInnerLoops();
 
   void eliminateDeadStores();
@@ -186,6 +186,31 @@ def init():
     _lazy_init()
 
 
+def warmup(devices=None, alloc_bytes: int = 0) -> None:
+    r"""Eagerly initialize per-device CUDA state, one thread per device.
+
+    Creating a device's primary context and library handles normally
+    happens on first use and takes seconds per device; multi-GPU hosts pay
+    that serially. This initializes the primary context and cuBLAS/cuDNN
+    handles of all requested devices concurrently, so startup pays only the
+    slowest device's share. It is intended to be called once while a
+    service comes up, before the first request arrives.
+
+    Args:
+        devices (iterable of torch.device or int, optional): devices to
+            warm up. Defaults to all visible devices.
+        alloc_bytes (int, optional): if positive, additionally allocate and
+            free a block of this many bytes on each device, leaving it in
+            the caching allocator's pool so the first real allocation does
+            not call cudaMalloc.
+    """
+    _lazy_init()
+    if devices is None:
+        devices = range(device_count())
+    device_ids = [_get_device_index(d) for d in devices]
+    torch._C._cuda_warmup(device_ids, alloc_bytes)
+
+
 def _lazy_init():
     global _initialized, _queued_calls
     if is_initialized() or hasattr(_tls, 'is_initializing'):
@@ -3,7 +3,6 @@ import io
 import logging
 import os
 import pickle
-import time
 import warnings
 from datetime import timedelta
 from typing import Callable, Dict, Optional, Tuple, Union
@@ -222,40 +221,22 @@ def _store_based_barrier(rank, store, timeout):
     those two methods and is not a generic alternative to ``barrier()``.
     """
     store_key = "{}:{}".format(STORE_BASED_BARRIER_PREFIX, _group_count)
-    store.add(store_key, 1)
-    logger.info("Added key: {} to store for rank: {}".format(store_key, rank))
-
-    # Now wait for all workers to check in with the store.
     world_size = get_world_size()
-    # Use 'add' instead of 'get' since for some store implementations 'add'
-    # doesn't work well with 'get'. Ideally the store implementations should
-    # be fixed, but for backward compatiblity reasons it is risky to change
-    # the store implementations. Once, we completely migrate away from these
-    # legacy stores, we can use 'get' here instead.
-    worker_count = store.add(store_key, 0)
-    start = time.time()
-    log_time = time.time()
-    while worker_count != world_size:
-        time.sleep(0.01)
-        worker_count = store.add(store_key, 0)
-
-        # Print status periodically to keep track.
-        if timedelta(seconds=(time.time() - log_time)) > timedelta(seconds=10):
-            logger.info(
-                "Waiting in store based barrier to initialize process group for "
-                "rank: {}, key: {} (world_size={}, worker_count={}, timeout={})".format(
-                    rank, store_key, world_size, worker_count, timeout
-                )
-            )
-            log_time = time.time()
+    logger.info("Entering store based barrier for rank: {}, key: {}".format(rank, store_key))
 
-        if timedelta(seconds=(time.time() - start)) > timeout:
-            raise RuntimeError(
-                "Timed out initializing process group in store based barrier on "
-                "rank: {}, for key: {} (world_size={}, worker_count={}, timeout={})".format(
-                    rank, store_key, world_size, worker_count, timeout
-                )
+    # The ranks synchronize along a tree instead of all polling a single
+    # counter key, so each rank issues a constant number of store operations
+    # regardless of world size. See Note [Store control-plane collectives]
+    # in Store.cpp.
+    try:
+        store.barrier(store_key, rank, world_size, timeout)
+    except RuntimeError as e:
+        raise RuntimeError(
+            "Timed out initializing process group in store based barrier on "
+            "rank: {}, for key: {} (world_size={}, timeout={}): {}".format(
+                rank, store_key, world_size, timeout, e
             )
+        )
 
     logger.info(
         f"Rank {rank}: Completed store-based barrier for key:{store_key} with {world_size} nodes."
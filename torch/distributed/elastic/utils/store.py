@@ -26,6 +26,9 @@ def get_all(store, prefix: str, size: int):
      value3 = values[2] # retrieves the data for key torchelastic/data2
 
     """
+    # Wait on all the keys at once so the store sees a single (long-polling)
+    # wait request instead of each get() polling for its key individually.
+    store.wait([f"{prefix}{idx}" for idx in range(size)])
     data_arr = []
     for idx in range(size):
         data = store.get(f"{prefix}{idx}")
@@ -63,5 +66,7 @@ def barrier(
     Note: Since the data is not removed from the store, the barrier can be used
         once per unique ``key_prefix``.
     """
-    data = f"{rank}".encode(encoding="UTF-8")
-    synchronize(store, data, rank, world_size, key_prefix, barrier_timeout)
+    # Tree-based barrier: each agent issues a constant number of store
+    # operations regardless of world size. See Note [Store control-plane
+    # collectives] in Store.cpp.
+    store.barrier(key_prefix, rank, world_size, timedelta(seconds=barrier_timeout))
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cerrno>
+#include <csignal>
 #include <fcntl.h>
 #include <memory>
 #include <poll.h>
@@ -87,6 +88,10 @@ void free_used_object(const std::string &name) {
 // NOLINTNEXTLINE(bugprone-exception-escape)
 int main(int argc, char *argv[]) {
   setsid();  // Daemonize the process
+  // Confirming a registration drained from a client that has already hung
+  // up would otherwise kill the manager with SIGPIPE; the failed write is
+  // handled where it happens instead.
+  signal(SIGPIPE, SIG_IGN);
 
   std::unique_ptr<ManagerServerSocket> srv_socket;
   c10::optional<c10::TempDir> tempdir;
@@ -128,14 +133,13 @@ int main(int argc, char *argv[]) {
       break;
 
     for (auto &pfd: pollfds) {
-      if (pfd.revents & (POLLERR | POLLHUP)) {
-        // some process died
-        DEBUG("detaching process");
-        auto &session = client_sessions.at(pfd.fd);
-        (void) session;
-        DEBUG("%d has died", session.pid);
-        to_remove.push_back(pfd.fd);
-      } else if (pfd.revents & POLLIN) {
+      // Check POLLIN before POLLERR/POLLHUP: clients pipeline their
+      // registrations, so a dying client may hang up with messages still
+      // buffered on the socket. poll keeps reporting POLLIN until the
+      // buffer is drained, after which the bare POLLHUP detaches the
+      // session; handling hangup first would discard those registrations
+      // and leak the segments.
+      if (pfd.revents & POLLIN) {
         if (pfd.fd == srv_socket->socket_fd) {
           // someone is joining
           DEBUG("registered new client");
@@ -147,17 +151,30 @@ int main(int argc, char *argv[]) {
           // someone wants to register a segment
           DEBUG("got alloc info");
           auto &session = client_sessions.at(pfd.fd);
-          AllocInfo info = session.socket.receive();
-          session.pid = info.pid;
-          DEBUG("got alloc info: %d %d %s", (int)info.free, info.pid, info.filename);
-          if (info.free) {
-            free_used_object(info.filename);
-          } else {
-            used_objects.insert(info.filename);
-            DEBUG("registered object %s", info.filename);
-            session.socket.confirm();
+          try {
+            AllocInfo info = session.socket.receive();
+            session.pid = info.pid;
+            DEBUG("got alloc info: %d %d %s", (int)info.free, info.pid, info.filename);
+            if (info.free) {
+              free_used_object(info.filename);
+            } else {
+              used_objects.insert(info.filename);
+              DEBUG("registered object %s", info.filename);
+              session.socket.confirm();
+            }
+          } catch (const std::exception &) {
+            // The client hung up mid-message; detach it.
+            DEBUG("failed to read alloc info");
+            to_remove.push_back(pfd.fd);
           }
         }
+      } else if (pfd.revents & (POLLERR | POLLHUP)) {
+        // some process died
+        DEBUG("detaching process");
+        auto &session = client_sessions.at(pfd.fd);
+        (void) session;
+        DEBUG("%d has died", session.pid);
+        to_remove.push_back(pfd.fd);
       }
     }
 
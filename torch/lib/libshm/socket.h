@@ -148,16 +148,36 @@ public:
     }
   }
 
+  // Registrations are pipelined: the manager confirms each one in order,
+  // so instead of a full round trip per segment we only block for the
+  // accumulated "OK"s once enough registrations are in flight. Messages on
+  // a single socket are processed in FIFO order by the manager, so a
+  // deallocation sent while confirmations are pending is still handled
+  // after the matching registration.
   void register_allocation(AllocInfo &info) {
-    char buffer[3] = {0, 0, 0};
     send(&info, sizeof(info));
-    recv(buffer, 2);
-    if (strcmp(buffer, "OK") != 0)
-      throw std::runtime_error("Shared memory manager didn't respond with an OK");
+    pending_confirmations_++;
+    if (pending_confirmations_ >= MAX_PENDING_CONFIRMATIONS)
+      drain_confirmations();
   }
 
   void register_deallocation(AllocInfo &info) {
     send(&info, sizeof(info));
   }
 
+  // Block until every pipelined registration has been acknowledged.
+  void drain_confirmations() {
+    char buffer[3] = {0, 0, 0};
+    while (pending_confirmations_ > 0) {
+      recv(buffer, 2);
+      if (strcmp(buffer, "OK") != 0)
+        throw std::runtime_error("Shared memory manager didn't respond with an OK");
+      pending_confirmations_--;
+    }
+  }
+
+private:
+  static constexpr size_t MAX_PENDING_CONFIRMATIONS = 16;
+
+  size_t pending_confirmations_ = 0;
 };
@@ -185,6 +185,10 @@ def get_ignored_functions() -> Set[Callable]:
         torch.set_autocast_enabled,
         torch.is_autocast_enabled,
         torch.clear_autocast_cache,
+        torch.prune_autocast_cache,
+        torch.autocast_cache_hit_count,
+        torch.autocast_cache_miss_count,
+        torch.reset_autocast_cache_stats,
         torch.set_autocast_cpu_enabled,
         torch.is_autocast_cpu_enabled,
         torch.set_autocast_cpu_dtype,
@@ -506,6 +510,8 @@ def get_testing_overrides() -> Dict[Callable, Callable]:
         torch.fmod: lambda input, other, out=None: -1,
         torch.frac: lambda input, out=None: -1,
         torch.frexp: lambda input, out=None: -1,
+        torch._fused_clip_where: lambda input, other, threshold, cmp, min=None, max=None: -1,
+        torch._fused_unary: lambda input, ops: -1,
         torch.full_like: lambda input, fill_value, out=None, dtype=None, layout=torch.strided, device=None, requires_grad=False: -1,
         torch.lu_unpack: lambda LU_data, LU_pivots, unpack_data=True, unpack_pivots=True: -1,
         torch.gather: lambda input, dim, index, out=None, sparse_grad=False: -1,
@@ -880,6 +886,8 @@ def get_testing_overrides() -> Dict[Callable, Callable]:
         torch.rsqrt: lambda input, out=None: -1,
         torch.rsub: lambda input, other, alpha=1: -1,
         torch.saddmm: lambda input, mat1, mat2, beta=1, alpha=1, out=None: -1,
+        torch._scaled_dot_product_attention: (
+            lambda query, key, value, attn_mask=None, dropout_p=0.0, is_causal=False, scale=None: -1),
         torch.scatter: lambda input, dim, index, src: -1,
         torch.scatter_add: lambda input, dim, index, src: -1,
         torch.searchsorted: lambda sorted_sequence, input, out_int32=False, right=False, out=None: -1,
@@ -1074,6 +1082,7 @@ def get_testing_overrides() -> Dict[Callable, Callable]:
         Tensor._dimV: lambda self: -1,
         Tensor._indices: lambda self: -1,
         Tensor._is_view: lambda self: -1,
+        Tensor._mmap_advise: lambda self, advice: -1,
         Tensor._nnz: lambda self: -1,
         Tensor.crow_indices: lambda self: -1,
         Tensor.col_indices: lambda self: -1,
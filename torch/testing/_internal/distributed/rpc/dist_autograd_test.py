@@ -1097,6 +1097,22 @@ class TensorPipeAgentDistAutogradTest(CommonDistAutogradTest):
             True
         )
 
+    @dist_init
+    def test_backward_simple_sparse_gradient_batching(self):
+        # Sparse gradients can't be packed and ride along in the batched
+        # message as-is.
+        torch._C._distributed_autograd._set_gradient_batching(True)
+        try:
+            self._backward_simple(
+                self._next_rank(),
+                build_sparse_tensor(requires_grad=True),
+                build_sparse_tensor(requires_grad=True),
+                None,
+                True
+            )
+        finally:
+            torch._C._distributed_autograd._set_gradient_batching(False)
+
     @dist_init
     def test_backward_simple_self_sparse(self):
         self._backward_simple(
@@ -1459,6 +1475,23 @@ class DistAutogradTest(CommonDistAutogradTest):
             False
         )
 
+    @dist_init
+    def test_backward_simple_gradient_batching(self):
+        # Exercises the coalesced gradient message path; the remote worker
+        # receives one BACKWARD_AUTOGRAD_BATCH_REQ instead of individual
+        # gradient messages.
+        torch._C._distributed_autograd._set_gradient_batching(True)
+        try:
+            self._backward_simple(
+                self._next_rank(),
+                torch.rand((3, 3), requires_grad=True),
+                torch.rand((3, 3), requires_grad=True),
+                None,
+                False
+            )
+        finally:
+            torch._C._distributed_autograd._set_gradient_batching(False)
+
     @dist_init
     def test_backward_simple_self(self):
         self._backward_simple(
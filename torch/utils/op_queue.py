@@ -0,0 +1,289 @@
+r"""Deferred execution of small elementwise ops, batched through ``_foreach``.
+
+Eager feature-transform code frequently issues hundreds of tiny elementwise
+ops (per-feature scale/shift and activations) per request. Each of those ops
+pays the fixed dispatcher overhead but does almost no work, so overhead
+dominates. An :class:`OpQueue` lets such code keep its eager structure while
+amortizing dispatch: tensors handed to :meth:`OpQueue.defer` record supported
+elementwise ops as thin descriptors instead of executing them, and a flush
+(explicit, or implicit on any read or unsupported op) replays the queue with
+runs of like ops grouped into single ``torch._foreach_*`` calls -- dozens of
+dispatches collapse into one.
+
+Example::
+
+    queue = torch.utils.op_queue.OpQueue()
+    outs = []
+    for feature, scale, shift in zip(features, scales, shifts):
+        x = queue.defer(feature)
+        outs.append(torch.tanh(x * scale + shift))
+    results = [out.materialize() for out in outs]  # single flush
+
+Only inference-style tensors can be deferred: gradients cannot be threaded
+through queued descriptors, so tensors that require grad are rejected.
+"""
+
+import numbers
+import threading
+
+import torch
+
+__all__ = ["OpQueue", "DeferredTensor"]
+
+# Ops that have a _foreach analogue and elementwise semantics. Binary entries
+# accept a scalar or a same-shaped tensor second operand; unary entries take
+# no second operand.
+_BINARY_OPS = ("add", "sub", "mul", "div")
+_UNARY_OPS = (
+    "abs",
+    "exp",
+    "log",
+    "neg",
+    "reciprocal",
+    "sigmoid",
+    "sqrt",
+    "tanh",
+)
+
+
+def _build_op_table():
+    table = {}
+    for name in _BINARY_OPS + _UNARY_OPS:
+        table[getattr(torch, name)] = name
+        table[getattr(torch.Tensor, name)] = name
+    for name, dunders in (
+        ("add", ("__add__", "__radd__")),
+        ("sub", ("__sub__",)),
+        ("mul", ("__mul__", "__rmul__")),
+        ("div", ("__truediv__",)),
+        ("neg", ("__neg__",)),
+    ):
+        for dunder in dunders:
+            table[getattr(torch.Tensor, dunder)] = name
+    return table
+
+
+_OP_TABLE = _build_op_table()
+_COMMUTATIVE = ("add", "mul")
+
+
+class DeferredTensor(object):
+    r"""Handle for the (possibly not yet computed) result of queued ops.
+
+    Returned by :meth:`OpQueue.defer` and by supported elementwise ops on
+    other deferred tensors. Any unsupported torch function or operator
+    flushes the owning queue and runs on the concrete result, so deferred
+    tensors can be passed wherever a tensor is expected; :meth:`materialize`
+    flushes explicitly and returns the plain :class:`torch.Tensor`.
+    """
+
+    __slots__ = ["_queue", "_op", "_inputs", "_result", "_shape"]
+
+    def __init__(self, queue, op, inputs, shape, result=None):
+        self._queue = queue
+        self._op = op
+        self._inputs = inputs
+        self._shape = shape
+        self._result = result
+
+    def materialize(self):
+        """Flushes the owning queue and returns the concrete tensor."""
+        if self._result is None:
+            self._queue.flush()
+        return self._result
+
+    def __repr__(self):
+        return "DeferredTensor containing:\n{}".format(self.materialize())
+
+    def __getattr__(self, name):
+        # Any other attribute access is a read: flush and forward to the
+        # concrete tensor, so .shape, .item(), .sum() etc. all work.
+        return getattr(self.materialize(), name)
+
+    # Operator dunders route through the torch functions so that
+    # __torch_function__ above sees them like any other call.
+    def __add__(self, other):
+        return torch.add(self, other)
+
+    def __radd__(self, other):
+        return torch.add(other, self)
+
+    def __sub__(self, other):
+        return torch.sub(self, other)
+
+    def __rsub__(self, other):
+        return torch.sub(other, self)
+
+    def __mul__(self, other):
+        return torch.mul(self, other)
+
+    def __rmul__(self, other):
+        return torch.mul(other, self)
+
+    def __truediv__(self, other):
+        return torch.div(self, other)
+
+    def __rtruediv__(self, other):
+        return torch.div(other, self)
+
+    def __neg__(self):
+        return torch.neg(self)
+
+    @classmethod
+    def __torch_function__(cls, func, types, args=(), kwargs=None):
+        kwargs = kwargs or {}
+        op = _OP_TABLE.get(func)
+        if op is not None and not kwargs:
+            deferred = cls._try_defer(op, args)
+            if deferred is not None:
+                return deferred
+        # Unsupported op, or operands the queue cannot express: fall back to
+        # eager execution on the materialized values.
+        args = tuple(
+            a.materialize() if isinstance(a, DeferredTensor) else a for a in args
+        )
+        kwargs = {
+            k: v.materialize() if isinstance(v, DeferredTensor) else v
+            for k, v in kwargs.items()
+        }
+        return func(*args, **kwargs)
+
+    @classmethod
+    def _try_defer(cls, op, args):
+        """Returns a new deferred node for ``op(*args)``, or None."""
+        if op in _UNARY_OPS:
+            if len(args) != 1 or not isinstance(args[0], DeferredTensor):
+                return None
+            return args[0]._queue._enqueue(op, [args[0]])
+        if len(args) != 2:
+            return None
+        first, second = args
+        if not isinstance(first, DeferredTensor):
+            if op not in _COMMUTATIVE:
+                # Tensor - deferred / tensor / deferred have no foreach form
+                # with the deferred operand on the right; run them eagerly.
+                return None
+            first, second = second, first
+        queue = first._queue
+        if isinstance(second, DeferredTensor):
+            if second._queue is not queue or second._shape != first._shape:
+                return None
+        elif isinstance(second, torch.Tensor):
+            if second.requires_grad or second.shape != first._shape:
+                return None
+        elif not isinstance(second, numbers.Number):
+            return None
+        return queue._enqueue(op, [first, second])
+
+
+class OpQueue(object):
+    r"""Queues small elementwise ops and flushes them in ``_foreach`` groups.
+
+    Args:
+        max_defer_numel (int): ops whose operands exceed this many elements
+            are executed eagerly rather than queued; for large tensors the
+            kernel cost dwarfs dispatch overhead and batching buys nothing.
+            Default: 16384.
+    """
+
+    def __init__(self, max_defer_numel=16384):
+        if max_defer_numel <= 0:
+            raise ValueError(
+                "max_defer_numel must be positive, got {}".format(max_defer_numel)
+            )
+        self.max_defer_numel = max_defer_numel
+        self._pending = []
+        self._lock = threading.Lock()
+
+    def defer(self, tensor):
+        """Wraps ``tensor`` so that supported ops on it are queued."""
+        if not isinstance(tensor, torch.Tensor):
+            raise TypeError("OpQueue.defer expects a Tensor")
+        if tensor.requires_grad:
+            raise RuntimeError(
+                "OpQueue cannot defer ops on tensors that require grad"
+            )
+        return DeferredTensor(self, None, [], tensor.shape, result=tensor)
+
+    def flush(self):
+        """Executes all queued ops, grouping runs of like ops via _foreach."""
+        with self._lock:
+            pending = self._pending
+            self._pending = []
+        for start, stop in self._group_runs(pending):
+            self._execute_group(pending[start:stop])
+
+    def pending_ops(self):
+        """The number of queued, not yet executed, op descriptors."""
+        with self._lock:
+            return len(self._pending)
+
+    def _enqueue(self, op, inputs):
+        # Large results are computed eagerly: the kernel dominates there and
+        # queuing would only delay it (and hold extra memory alive).
+        shape = inputs[0]._shape
+        if shape.numel() > self.max_defer_numel:
+            concrete = [
+                i.materialize() if isinstance(i, DeferredTensor) else i
+                for i in inputs
+            ]
+            return DeferredTensor(
+                self, None, [], shape, result=getattr(torch, op)(*concrete)
+            )
+        node = DeferredTensor(self, op, inputs, shape)
+        with self._lock:
+            self._pending.append(node)
+        return node
+
+    @staticmethod
+    def _group_key(node):
+        if node._op in _UNARY_OPS:
+            return (node._op, "unary")
+        second = node._inputs[1]
+        if isinstance(second, numbers.Number):
+            return (node._op, "scalar")
+        return (node._op, "tensor")
+
+    def _group_runs(self, pending):
+        """Yields (start, stop) runs of queued nodes that can share one call.
+
+        Queue order is topological (producers are enqueued before their
+        consumers), so a run is only broken when the op or operand kind
+        changes, or when a node consumes the output of an earlier node in
+        the same run -- those must execute in separate calls.
+        """
+        start = 0
+        while start < len(pending):
+            key = self._group_key(pending[start])
+            members = {id(pending[start])}
+            stop = start + 1
+            while stop < len(pending):
+                node = pending[stop]
+                if self._group_key(node) != key:
+                    break
+                if any(id(i) in members for i in node._inputs):
+                    break
+                members.add(id(node))
+                stop += 1
+            yield start, stop
+            start = stop
+
+    def _execute_group(self, nodes):
+        concrete = [
+            [i.materialize() if isinstance(i, DeferredTensor) else i for i in n._inputs]
+            for n in nodes
+        ]
+        op = nodes[0]._op
+        if len(nodes) == 1:
+            nodes[0]._result = getattr(torch, op)(*concrete[0])
+            return
+        foreach = getattr(torch, "_foreach_" + op)
+        if op in _UNARY_OPS:
+            results = foreach([inputs[0] for inputs in concrete])
+        else:
+            results = foreach(
+                [inputs[0] for inputs in concrete],
+                [inputs[1] for inputs in concrete],
+            )
+        for node, result in zip(nodes, results):
+            node._result = result